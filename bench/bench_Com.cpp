@@ -0,0 +1,34 @@
+/**
+ * @file bench_Com.cpp
+ * @brief Micro-Benchmarks for the COM Module
+ * @details Reception of the light switch I-PDU: RX indication and the RX
+ *          main function
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include "BSW/Com/Com.h"
+#include "BSW/E2E/E2E_P01.h"
+#include "FLM_Config.h"
+
+static void BM_Com_RxIndication_MainFunctionRx(benchmark::State& state) {
+    uint8_t data[4] = {0};
+    PduInfoType pduInfo;
+
+    Com_Init();
+    Com_IpduGroupStart(COM_IPDUGROUP_RX);
+    data[COM_LIGHTSWITCH_CMD_BYTE] = static_cast<uint8_t>(LIGHT_SWITCH_AUTO);
+    pduInfo.SduDataPtr = data;
+    pduInfo.MetaDataPtr = NULL_PTR;
+    pduInfo.SduLength = 4U;
+
+    for (auto _ : state) {
+        Com_RxIndication(COM_IPDU_LIGHTSWITCH_RX, &pduInfo);
+        Com_MainFunctionRx();
+        benchmark::ClobberMemory();
+    }
+
+    Com_DeInit();
+}
+BENCHMARK(BM_Com_RxIndication_MainFunctionRx);
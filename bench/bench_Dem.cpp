@@ -0,0 +1,39 @@
+/**
+ * @file bench_Dem.cpp
+ * @brief Micro-Benchmarks for the Diagnostic Event Manager
+ * @details Event status reports with and without status changes
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include "BSW/Dem/Dem.h"
+
+/* Steady PASSED reports, the common case of the cyclic monitors */
+static void BM_Dem_SetEventStatus_Passed(benchmark::State& state) {
+    Dem_Init();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT, DEM_EVENT_STATUS_PASSED));
+    }
+
+    Dem_Shutdown();
+}
+BENCHMARK(BM_Dem_SetEventStatus_Passed);
+
+/* Alternating FAILED/PASSED: status byte update and event memory on every report */
+static void BM_Dem_SetEventStatus_Toggle(benchmark::State& state) {
+    uint32_t report = 0U;
+
+    Dem_Init();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT,
+                                                    ((report & 1U) == 0U) ? DEM_EVENT_STATUS_FAILED :
+                                                                            DEM_EVENT_STATUS_PASSED));
+        report++;
+    }
+
+    Dem_Shutdown();
+}
+BENCHMARK(BM_Dem_SetEventStatus_Toggle);
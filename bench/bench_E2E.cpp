@@ -0,0 +1,121 @@
+/**
+ * @file bench_E2E.cpp
+ * @brief Micro-Benchmarks for E2E Profile 01
+ * @details CRC per data length, protect/check of the light switch frame and
+ *          the E2E state machine
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include "BSW/E2E/E2E_P01.h"
+#include "FLM_Config.h"
+#include <vector>
+
+/**
+ * @brief Light switch E2E configuration of SwitchEvent
+ */
+static E2E_P01ConfigType BenchE2E_GetConfig(void) {
+    E2E_P01ConfigType config;
+
+    config.DataLength = FLM_E2E_LIGHTSWITCH_DATA_LENGTH;
+    config.DataID = FLM_E2E_LIGHTSWITCH_DATA_ID;
+    config.MaxDeltaCounter = FLM_E2E_MAX_DELTA_COUNTER;
+    config.MaxNoNewOrRepeatedData = FLM_E2E_MAX_NO_NEW_DATA;
+    config.SyncCounter = FLM_E2E_SYNC_COUNTER;
+    config.CounterOffset = FLM_E2E_COUNTER_OFFSET;
+    config.CRCOffset = FLM_E2E_CRC_OFFSET;
+    config.DataIDNibbleOffset = 0U;
+    config.DataIDMode = FALSE;
+    return config;
+}
+
+/*============================================================================*
+ * CRC BENCHMARKS
+ *============================================================================*/
+
+static void BM_E2E_CalculateCRC8(benchmark::State& state) {
+    const uint16_t length = static_cast<uint16_t>(state.range(0));
+    std::vector<uint8_t> data(length);
+    uint16_t i;
+
+    for (i = 0U; i < length; i++) {
+        data[i] = static_cast<uint8_t>(i * 37U);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(E2E_P01_CalculateCRC8(data.data(), length, 0xFFU, TRUE));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * length);
+}
+BENCHMARK(BM_E2E_CalculateCRC8)->RangeMultiplier(2)->Range(1, 256);
+
+/*============================================================================*
+ * PROTECT / CHECK BENCHMARKS
+ *============================================================================*/
+
+static void BM_E2E_P01Protect(benchmark::State& state) {
+    const E2E_P01ConfigType config = BenchE2E_GetConfig();
+    E2E_P01ProtectStateType protectState;
+    uint8_t data[4] = {0};
+
+    (void)E2E_P01ProtectInit(&protectState);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(E2E_P01Protect(&config, &protectState, data, 4U));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_E2E_P01Protect);
+
+/** @brief Frames of one counter cycle, protected in sequence */
+#define BENCH_E2E_NUM_FRAMES    (E2E_P01_COUNTER_MAX + 1U)
+
+static void BM_E2E_P01Check(benchmark::State& state) {
+    const E2E_P01ConfigType config = BenchE2E_GetConfig();
+    E2E_P01ProtectStateType protectState;
+    E2E_P01CheckStateType checkState;
+    uint8_t frames[BENCH_E2E_NUM_FRAMES][4] = {{0}};
+    uint32_t frame = 0U;
+    uint32_t i;
+
+    /* A counter cycle of valid frames, checked in order */
+    (void)E2E_P01ProtectInit(&protectState);
+    for (i = 0U; i < BENCH_E2E_NUM_FRAMES; i++) {
+        (void)E2E_P01Protect(&config, &protectState, frames[i], 4U);
+    }
+    (void)E2E_P01CheckInit(&checkState);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(E2E_P01Check(&config, &checkState, frames[frame], 4U));
+        frame = (frame + 1U) % BENCH_E2E_NUM_FRAMES;
+    }
+}
+BENCHMARK(BM_E2E_P01Check);
+
+/*============================================================================*
+ * STATE MACHINE BENCHMARKS
+ *============================================================================*/
+
+static void BM_E2E_SMCheck(benchmark::State& state) {
+    E2E_SMConfigType config;
+    E2E_SMCheckStateType smState;
+    uint32_t cycle = 0U;
+
+    config.WindowSize = 5U;
+    config.MinOkStateInit = 2U;
+    config.MaxErrorStateInit = 2U;
+    config.MinOkStateValid = 2U;
+    config.MinOkStateInvalid = 3U;
+    config.MaxErrorStateValid = 2U;
+    config.MaxErrorStateInvalid = 3U;
+    (void)E2E_SMCheckInit(&smState);
+
+    /* Every eighth frame corrupted: the window slides over errors */
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(E2E_SMCheck(&config, &smState,
+                                             ((cycle % 8U) == 7U) ? E2E_P01STATUS_WRONGCRC :
+                                                                    E2E_P01STATUS_OK));
+        cycle++;
+    }
+}
+BENCHMARK(BM_E2E_SMCheck);
@@ -0,0 +1,55 @@
+/**
+ * @file bench_LightRequest.cpp
+ * @brief Micro-Benchmarks for the LightRequest Filter Chain
+ * @details One sample through the configured chain and through single
+ *          stages of each type
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include "Application/LightRequest/LightRequest_Filter.h"
+#include "LightRequest_Cfg.h"
+
+/**
+ * @brief Run samples of a noisy ramp through a chain
+ */
+static void BenchLightRequest_Run(benchmark::State& state, LightRequest_FilterChainType* chain) {
+    uint16_t sample = 0U;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LightRequest_FilterUpdate(chain, static_cast<uint16_t>(
+            500U + (sample & 0x3FFU) + ((sample * 7919U) & 0x3FU))));
+        sample++;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_LightRequest_FilterUpdate_Configured(benchmark::State& state) {
+    static LightRequest_FilterChainType chain;
+
+    (void)LightRequest_FilterInit(&chain, LightRequest_FilterChainConfig, LIGHTREQUEST_NUM_FILTER_STAGES);
+    BenchLightRequest_Run(state, &chain);
+}
+BENCHMARK(BM_LightRequest_FilterUpdate_Configured);
+
+/* Single stage: Arg(0) = stage type, Arg(1) = window length / IIR coefficient */
+static void BM_LightRequest_FilterUpdate_Stage(benchmark::State& state) {
+    static LightRequest_FilterChainType chain;
+    LightRequest_FilterStageConfigType stage;
+
+    stage.Type = static_cast<LightRequest_FilterType>(state.range(0));
+    stage.Param = static_cast<uint16_t>(state.range(1));
+    if (LightRequest_FilterInit(&chain, &stage, 1U) != E_OK) {
+        state.SkipWithError("Invalid filter stage");
+        return;
+    }
+    BenchLightRequest_Run(state, &chain);
+}
+BENCHMARK(BM_LightRequest_FilterUpdate_Stage)
+    ->ArgNames({"type", "param"})
+    ->Args({LIGHTREQUEST_FILTER_MOVING_AVERAGE, 8})
+    ->Args({LIGHTREQUEST_FILTER_MOVING_AVERAGE, 512})
+    ->Args({LIGHTREQUEST_FILTER_IIR_LOWPASS, 4096})
+    ->Args({LIGHTREQUEST_FILTER_MEDIAN, 5})
+    ->Args({LIGHTREQUEST_FILTER_MEDIAN, 31});
@@ -0,0 +1,159 @@
+/**
+ * @file bench_System.cpp
+ * @brief Macro-Benchmarks for the Task Chain
+ * @details The started ECU with the lamp model in virtual time: one 10ms
+ *          task iteration and one simulated second with the task split of
+ *          the main scheduler
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <benchmark/benchmark.h>
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+#include "BSW/EcuM/EcuM.h"
+#include "BSW/E2E/E2E_P01.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Com/Com.h"
+#include "Rte/Rte_Tasks.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Pwm/Pwm.h"
+#include "Sim/Lamp/Lamp.h"
+#include "FLM_Config.h"
+
+/** @brief Run before measuring, lights on and all E2E windows filled (ms) */
+#define BENCH_SYSTEM_WARMUP_MS      1000U
+
+/** @brief Ticks of one simulated second */
+#define BENCH_SYSTEM_SECOND_TICKS   1000U
+
+/** @brief Light switch sender */
+static E2E_P01ConfigType BenchSystem_SenderConfig;
+static E2E_P01ProtectStateType BenchSystem_Sender;
+
+/** @brief Virtual time of the next tick (ms) */
+static uint32_t BenchSystem_TickMs = 0U;
+
+/**
+ * @brief Receive the E2E-protected light switch (AUTO)
+ */
+static void BenchSystem_SendLightSwitch(void) {
+    uint8_t data[4] = {0};
+    PduInfoType pduInfo;
+
+    data[COM_LIGHTSWITCH_CMD_BYTE] = static_cast<uint8_t>(LIGHT_SWITCH_AUTO);
+    (void)E2E_P01Protect(&BenchSystem_SenderConfig, &BenchSystem_Sender, data, 4U);
+    pduInfo.SduDataPtr = data;
+    pduInfo.MetaDataPtr = NULL_PTR;
+    pduInfo.SduLength = 4U;
+    Com_RxIndication(COM_IPDU_LIGHTSWITCH_RX, &pduInfo);
+}
+
+/**
+ * @brief One 1ms tick: dark ambient, light switch every 10ms
+ */
+static void BenchSystem_Tick(void) {
+    const uint32_t tickMs = BenchSystem_TickMs;
+    const uint64_t timeUs = static_cast<uint64_t>(tickMs) * 1000U;
+
+    Adc_SimSetTimeUs(timeUs);
+    Pwm_SimSetTimeUs(timeUs);
+    WdgM_SimSetTimeUs(static_cast<uint32_t>(timeUs));
+    Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT, static_cast<Adc_ValueGroupType>(400U + (tickMs % 200U)));
+    Adc_MainFunction();
+
+    if ((tickMs % FLM_SAFETY_MONITOR_PERIOD_MS) == 0U) {
+        Rte_Task_5ms();
+    }
+    if ((tickMs % FLM_MAIN_FUNCTION_PERIOD_MS) == 0U) {
+        BenchSystem_SendLightSwitch();
+        Rte_Task_10ms();
+    }
+    if ((tickMs % FLM_AMBIENT_LIGHT_PERIOD_MS) == 0U) {
+        Rte_Task_20ms();
+    }
+
+    BenchSystem_TickMs++;
+}
+
+/**
+ * @brief Start the ECU and the lamp model and run the warm-up
+ */
+static void BenchSystem_Start(void) {
+    EcuM_ConfigType config;
+
+    Adc_SimSetTimeUs(0U);
+    Pwm_SimSetTimeUs(0U);
+    WdgM_SimSetTimeUs(0U);
+    config.MaxParallelInit = 1U;
+    (void)EcuM_Init(&config, ECUM_STARTUP_COLD);
+    Lamp_Init();
+
+    BenchSystem_SenderConfig.DataLength = FLM_E2E_LIGHTSWITCH_DATA_LENGTH;
+    BenchSystem_SenderConfig.DataID = FLM_E2E_LIGHTSWITCH_DATA_ID;
+    BenchSystem_SenderConfig.CounterOffset = FLM_E2E_COUNTER_OFFSET;
+    BenchSystem_SenderConfig.CRCOffset = FLM_E2E_CRC_OFFSET;
+    (void)E2E_P01ProtectInit(&BenchSystem_Sender);
+
+    BenchSystem_TickMs = 0U;
+    while (BenchSystem_TickMs < BENCH_SYSTEM_WARMUP_MS) {
+        BenchSystem_Tick();
+    }
+}
+
+/**
+ * @brief Stop the lamp model and the ECU
+ */
+static void BenchSystem_Stop(benchmark::State& state) {
+    /* A run that ended in the safe state measured the wrong path */
+    if (SafetyMonitor_IsInSafeState()) {
+        state.SkipWithError("ECU entered the safe state");
+    }
+    Lamp_DeInit();
+    EcuM_GoDown(ECUM_STARTUP_COLD);
+}
+
+/*============================================================================*
+ * TASK BENCHMARKS
+ *============================================================================*/
+
+/* One 10ms task iteration with a fresh light switch frame, 10ms apart in
+ * virtual time. Only the 10ms task runs, as in the scheduler slot it
+ * occupies; without the 5ms task the supervision is not evaluated. */
+static void BM_System_Task10ms(benchmark::State& state) {
+    BenchSystem_Start();
+
+    for (auto _ : state) {
+        const uint64_t timeUs = static_cast<uint64_t>(BenchSystem_TickMs) * 1000U;
+
+        Adc_SimSetTimeUs(timeUs);
+        Pwm_SimSetTimeUs(timeUs);
+        WdgM_SimSetTimeUs(static_cast<uint32_t>(timeUs));
+        BenchSystem_SendLightSwitch();
+        Rte_Task_10ms();
+        BenchSystem_TickMs += FLM_MAIN_FUNCTION_PERIOD_MS;
+    }
+
+    BenchSystem_Stop(state);
+}
+BENCHMARK(BM_System_Task10ms);
+
+/* One simulated second: 1000 ticks, 200 x 5ms, 100 x 10ms, 50 x 20ms tasks
+ * and the ADC/lamp model every tick. The rate counter is the speed-up over
+ * real time. */
+static void BM_System_SimulatedSecond(benchmark::State& state) {
+    uint32_t i;
+
+    BenchSystem_Start();
+
+    for (auto _ : state) {
+        for (i = 0U; i < BENCH_SYSTEM_SECOND_TICKS; i++) {
+            BenchSystem_Tick();
+        }
+    }
+    state.counters["RealTimeFactor"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                                          benchmark::Counter::kIsRate);
+
+    BenchSystem_Stop(state);
+}
+BENCHMARK(BM_System_SimulatedSecond)->Unit(benchmark::kMillisecond);
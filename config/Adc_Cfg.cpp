@@ -0,0 +1,60 @@
+/**
+ * @file Adc_Cfg.cpp
+ * @brief ADC Driver Configuration Data
+ * @details Group definitions of the FLM ECU
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Adc_Cfg.h"
+#include "MCAL/Adc/Adc.h"
+
+/*============================================================================*
+ * GROUP CHANNEL LISTS
+ *============================================================================*/
+
+static const Adc_ChannelType Adc_AmbientChannels[] = { FLM_ADC_CHANNEL_AMBIENT };
+static const Adc_ChannelType Adc_CurrentChannels[] = { FLM_ADC_CHANNEL_CURRENT };
+static const Adc_ChannelType Adc_SensorChannels[] = {
+    FLM_ADC_CHANNEL_AMBIENT,
+    FLM_ADC_CHANNEL_CURRENT
+};
+
+/*============================================================================*
+ * GROUP CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Groups, indexed by group ID
+ */
+const Adc_GroupConfigType Adc_GroupConfig[ADC_NUM_GROUPS] = {
+    /* Id, Trigger, ConvMode, Prio, NumCh, Channels,
+     * AccessMode, BufferMode, StreamingNumSamples, ConversionPeriodUs, Notification */
+    { ADC_GROUP_AMBIENT, ADC_TRIGG_SRC_SW, ADC_CONV_MODE_ONESHOT, 0U, 1U, Adc_AmbientChannels,
+      ADC_ACCESS_MODE_SINGLE, ADC_STREAM_BUFFER_LINEAR, 1U, 0U, NULL_PTR },
+    { ADC_GROUP_CURRENT, ADC_TRIGG_SRC_SW, ADC_CONV_MODE_ONESHOT, 0U, 1U, Adc_CurrentChannels,
+      ADC_ACCESS_MODE_SINGLE, ADC_STREAM_BUFFER_LINEAR, 1U, 0U, NULL_PTR },
+    { ADC_GROUP_AMBIENT_STREAM, ADC_TRIGG_SRC_SW, ADC_CONV_MODE_CONTINUOUS, 1U, 1U, Adc_AmbientChannels,
+      ADC_ACCESS_MODE_STREAMING, ADC_STREAM_BUFFER_CIRCULAR, ADC_AMBIENT_STREAM_SAMPLES,
+      ADC_STREAM_CONVERSION_PERIOD_US, NULL_PTR },
+    { ADC_GROUP_CURRENT_STREAM, ADC_TRIGG_SRC_SW, ADC_CONV_MODE_CONTINUOUS, 1U, 1U, Adc_CurrentChannels,
+      ADC_ACCESS_MODE_STREAMING, ADC_STREAM_BUFFER_CIRCULAR, ADC_CURRENT_STREAM_SAMPLES,
+      ADC_STREAM_CONVERSION_PERIOD_US, NULL_PTR },
+    { ADC_GROUP_SENSORS, ADC_TRIGG_SRC_SW, ADC_CONV_MODE_ONESHOT, 0U, 2U, Adc_SensorChannels,
+      ADC_ACCESS_MODE_SINGLE, ADC_STREAM_BUFFER_LINEAR, 1U, 0U, NULL_PTR }
+};
+
+/**
+ * @brief ADC configuration
+ */
+const Adc_ConfigType Adc_Config = {
+    ADC_NUM_GROUPS,
+    Adc_GroupConfig,
+    2U,
+    NULL_PTR
+};
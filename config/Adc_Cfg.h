@@ -0,0 +1,69 @@
+/**
+ * @file Adc_Cfg.h
+ * @brief ADC Driver Configuration
+ * @details ADC groups of the FLM ECU: one-shot groups for single reads and
+ *          continuous streaming groups oversampling the sensor channels
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef ADC_CFG_H
+#define ADC_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/*============================================================================*
+ * ADC GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Maximum number of ADC groups */
+#define ADC_MAX_GROUPS                      8U
+
+/** @brief Maximum number of channels in one group */
+#define ADC_MAX_GROUP_CHANNELS              4U
+
+/** @brief Samples per channel converted in one block (simulation) */
+#define ADC_MAX_STREAM_SAMPLES              256U
+
+/*============================================================================*
+ * GROUP CONFIGURATION
+ *============================================================================*/
+
+/** @brief Ambient light, one-shot single access */
+#define ADC_GROUP_AMBIENT                   0U
+
+/** @brief Headlight current sense, one-shot single access */
+#define ADC_GROUP_CURRENT                   1U
+
+/** @brief Ambient light, continuous streaming (LightRequest oversampling) */
+#define ADC_GROUP_AMBIENT_STREAM            2U
+
+/** @brief Headlight current sense, continuous streaming (Headlight oversampling) */
+#define ADC_GROUP_CURRENT_STREAM            3U
+
+/** @brief Ambient light and current sense, one-shot single access */
+#define ADC_GROUP_SENSORS                   4U
+
+/** @brief Number of configured groups */
+#define ADC_NUM_GROUPS                      5U
+
+/*----------------------------------------------------------------------------*
+ * Streaming groups
+ *----------------------------------------------------------------------------*/
+
+/** @brief Conversion period of the streaming groups (us, 4 kHz) */
+#define ADC_STREAM_CONVERSION_PERIOD_US     250U
+
+/** @brief Ring buffer depth of the ambient stream (> 20 ms at 4 kHz) */
+#define ADC_AMBIENT_STREAM_SAMPLES          128U
+
+/** @brief Ring buffer depth of the current sense stream (> 10 ms at 4 kHz) */
+#define ADC_CURRENT_STREAM_SAMPLES          64U
+
+#endif /* ADC_CFG_H */
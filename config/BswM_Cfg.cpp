@@ -0,0 +1,131 @@
+/**
+ * @file BswM_Cfg.cpp
+ * @brief BSW Mode Manager Configuration Data
+ * @details Mode port defaults, conditions, rules and action lists
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "BswM_Cfg.h"
+#include "BSW/BswM/BswM.h"
+#include "MCAL/Can/Can.h"
+#include "Com_Cfg.h"
+#include "Dem_Cfg.h"
+
+/*============================================================================*
+ * MODE PORT CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Initial mode port values
+ */
+const uint8_t BswM_ModePortInitValues[BSWM_NUM_MODE_PORTS] = {
+    BSWM_INIT_ECU_MODE_REQUEST,     /* BSWM_PORT_ECU_MODE_REQUEST */
+    BSWM_INIT_ECUM_STATE,           /* BSWM_PORT_ECUM_STATE */
+    BSWM_INIT_COMM_MODE             /* BSWM_PORT_COMM_MODE */
+};
+
+/*============================================================================*
+ * CONDITION CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Conditions, indexed by condition ID
+ */
+const BswM_ConditionConfigType BswM_ConditionConfig[BSWM_NUM_CONDITIONS] = {
+    { BSWM_PORT_ECU_MODE_REQUEST, BSWM_CONDITION_EQUALS,     BSWM_MODE_RUN },
+    { BSWM_PORT_ECUM_STATE,       BSWM_CONDITION_EQUALS,     BSWM_ECUM_STATE_RUN },
+    { BSWM_PORT_COMM_MODE,        BSWM_CONDITION_NOT_EQUALS, COMM_NO_COMMUNICATION },
+    { BSWM_PORT_COMM_MODE,        BSWM_CONDITION_EQUALS,     COMM_FULL_COMMUNICATION },
+    { BSWM_PORT_ECU_MODE_REQUEST, BSWM_CONDITION_EQUALS,     BSWM_MODE_POST_RUN },
+    { BSWM_PORT_ECU_MODE_REQUEST, BSWM_CONDITION_EQUALS,     BSWM_MODE_SHUTDOWN },
+    { BSWM_PORT_ECU_MODE_REQUEST, BSWM_CONDITION_EQUALS,     BSWM_MODE_SLEEP }
+};
+
+/** @brief Condition bit */
+#define BSWM_COND(id)   (static_cast<BswM_ConditionMaskType>(1U) << (id))
+
+/*============================================================================*
+ * ACTION LIST CONFIGURATION DATA
+ *============================================================================*/
+
+static const BswM_ActionConfigType BswM_RunTrueActions[] = {
+    { BSWM_ACTION_SET_MODE,             0U,                             BSWM_MODE_RUN },
+    { BSWM_ACTION_DEM_ENABLE_CONDITION, DEM_ENABLE_CONDITION_ECU_RUN,   TRUE }
+};
+
+static const BswM_ActionConfigType BswM_RunFalseActions[] = {
+    { BSWM_ACTION_DEM_ENABLE_CONDITION, DEM_ENABLE_CONDITION_ECU_RUN,   FALSE }
+};
+
+static const BswM_ActionConfigType BswM_ComRxTrueActions[] = {
+    { BSWM_ACTION_CAN_SET_CONTROLLER_MODE, BSWM_CAN_CONTROLLER,              CAN_MODE_START },
+    { BSWM_ACTION_COM_IPDUGROUP_START,     COM_IPDUGROUP_RX,                 0U },
+    { BSWM_ACTION_DEM_ENABLE_CONDITION,    DEM_ENABLE_CONDITION_COMMUNICATION, TRUE }
+};
+
+static const BswM_ActionConfigType BswM_ComRxFalseActions[] = {
+    { BSWM_ACTION_DEM_ENABLE_CONDITION,    DEM_ENABLE_CONDITION_COMMUNICATION, FALSE },
+    { BSWM_ACTION_COM_IPDUGROUP_STOP,      COM_IPDUGROUP_RX,                 0U },
+    { BSWM_ACTION_CAN_SET_CONTROLLER_MODE, BSWM_CAN_CONTROLLER,              CAN_MODE_STOP }
+};
+
+static const BswM_ActionConfigType BswM_ComTxTrueActions[] = {
+    { BSWM_ACTION_COM_IPDUGROUP_START,  COM_IPDUGROUP_TX,   0U }
+};
+
+static const BswM_ActionConfigType BswM_ComTxFalseActions[] = {
+    { BSWM_ACTION_COM_IPDUGROUP_STOP,   COM_IPDUGROUP_TX,   0U }
+};
+
+static const BswM_ActionConfigType BswM_PostRunActions[] = {
+    { BSWM_ACTION_SET_MODE,             0U,                 BSWM_MODE_POST_RUN }
+};
+
+static const BswM_ActionConfigType BswM_ShutdownActions[] = {
+    { BSWM_ACTION_SET_MODE,             0U,                 BSWM_MODE_SHUTDOWN }
+};
+
+static const BswM_ActionConfigType BswM_SleepActions[] = {
+    { BSWM_ACTION_SET_MODE,             0U,                 BSWM_MODE_SLEEP }
+};
+
+/** @brief Action list of a static action array */
+#define BSWM_ACTION_LIST(actions) \
+    { static_cast<uint8_t>(sizeof(actions) / sizeof((actions)[0])), (actions) }
+
+/** @brief Empty action list */
+#define BSWM_NO_ACTIONS     { 0U, NULL_PTR }
+
+/*============================================================================*
+ * RULE CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Rules, indexed by rule ID
+ */
+const BswM_RuleConfigType BswM_RuleConfig[BSWM_NUM_RULES] = {
+    { "Run",
+      BSWM_COND(BSWM_COND_REQUEST_RUN) | BSWM_COND(BSWM_COND_ECUM_RUN),
+      BSWM_ACTION_LIST(BswM_RunTrueActions), BSWM_ACTION_LIST(BswM_RunFalseActions) },
+    { "ComRx",
+      BSWM_COND(BSWM_COND_COMM_AVAILABLE),
+      BSWM_ACTION_LIST(BswM_ComRxTrueActions), BSWM_ACTION_LIST(BswM_ComRxFalseActions) },
+    { "ComTx",
+      BSWM_COND(BSWM_COND_REQUEST_RUN) | BSWM_COND(BSWM_COND_COMM_FULL),
+      BSWM_ACTION_LIST(BswM_ComTxTrueActions), BSWM_ACTION_LIST(BswM_ComTxFalseActions) },
+    { "PostRun",
+      BSWM_COND(BSWM_COND_REQUEST_POST_RUN),
+      BSWM_ACTION_LIST(BswM_PostRunActions), BSWM_NO_ACTIONS },
+    { "Shutdown",
+      BSWM_COND(BSWM_COND_REQUEST_SHUTDOWN),
+      BSWM_ACTION_LIST(BswM_ShutdownActions), BSWM_NO_ACTIONS },
+    { "Sleep",
+      BSWM_COND(BSWM_COND_REQUEST_SLEEP),
+      BSWM_ACTION_LIST(BswM_SleepActions), BSWM_NO_ACTIONS }
+};
@@ -0,0 +1,208 @@
+/**
+ * @file BswM_Cfg.h
+ * @brief BSW Mode Manager Configuration
+ * @details Mode ports, conditions, rules and action lists of the BswM rule
+ *          engine
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef BSWM_CFG_H
+#define BSWM_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "ComStack_Types.h"
+
+/*============================================================================*
+ * BSWM GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Enable development error detection */
+#define BSWM_DEV_ERROR_DETECT               STD_ON
+
+/** @brief Maximum number of conditions (bits of BswM_ConditionMaskType) */
+#define BSWM_MAX_CONDITIONS                 32U
+
+/** @brief Maximum number of rules (bits of BswM_RuleMaskType) */
+#define BSWM_MAX_RULES                      32U
+
+/** @brief Number of values a mode port can take (decision table width) */
+#define BSWM_MAX_PORT_VALUES                8U
+
+/*============================================================================*
+ * MODE PORT CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Mode port ID type
+ */
+typedef uint8_t BswM_ModePortIdType;
+
+/** @brief Mode requested through BswM_RequestMode (BswM_ModeType) */
+#define BSWM_PORT_ECU_MODE_REQUEST          0U
+
+/** @brief EcuM state reported through BswM_EcuM_CurrentState */
+#define BSWM_PORT_ECUM_STATE                1U
+
+/** @brief ComM mode of the CAN network (ComM_ModeType) */
+#define BSWM_PORT_COMM_MODE                 2U
+
+/** @brief Number of mode ports */
+#define BSWM_NUM_MODE_PORTS                 3U
+
+/** @brief Network handle of the CAN network */
+#define BSWM_COMM_NETWORK_CAN               0U
+
+/** @brief CAN controller switched by BswM */
+#define BSWM_CAN_CONTROLLER                 0U
+
+/*----------------------------------------------------------------------------*
+ * EcuM states reported to BswM
+ *----------------------------------------------------------------------------*/
+
+#define BSWM_ECUM_STATE_STARTUP             0x00U
+#define BSWM_ECUM_STATE_RUN                 0x01U
+#define BSWM_ECUM_STATE_POST_RUN            0x02U
+#define BSWM_ECUM_STATE_SHUTDOWN            0x03U
+
+/*----------------------------------------------------------------------------*
+ * Initial mode port values
+ *----------------------------------------------------------------------------*/
+
+/** @brief Initially requested mode (BSWM_MODE_RUN) */
+#define BSWM_INIT_ECU_MODE_REQUEST          0x01U
+
+/** @brief Initial EcuM state (startup already done when BswM_Init runs) */
+#define BSWM_INIT_ECUM_STATE                BSWM_ECUM_STATE_RUN
+
+/** @brief Initial ComM mode of the CAN network */
+#define BSWM_INIT_COMM_MODE                 COMM_FULL_COMMUNICATION
+
+/*============================================================================*
+ * CONDITION CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Condition operator type
+ */
+typedef enum {
+    BSWM_CONDITION_EQUALS       = 0x00U,
+    BSWM_CONDITION_NOT_EQUALS   = 0x01U
+} BswM_ConditionOperatorType;
+
+/**
+ * @brief Condition over one mode port
+ */
+typedef struct {
+    BswM_ModePortIdType Port;               /**< Mode port */
+    BswM_ConditionOperatorType Operator;    /**< Comparison */
+    uint8_t Value;                          /**< Reference value */
+} BswM_ConditionConfigType;
+
+/** @brief Requested mode is RUN */
+#define BSWM_COND_REQUEST_RUN               0U
+/** @brief EcuM is in RUN */
+#define BSWM_COND_ECUM_RUN                  1U
+/** @brief CAN network has (at least silent) communication */
+#define BSWM_COND_COMM_AVAILABLE            2U
+/** @brief CAN network has full communication */
+#define BSWM_COND_COMM_FULL                 3U
+/** @brief Requested mode is POST_RUN */
+#define BSWM_COND_REQUEST_POST_RUN          4U
+/** @brief Requested mode is SHUTDOWN */
+#define BSWM_COND_REQUEST_SHUTDOWN          5U
+/** @brief Requested mode is SLEEP */
+#define BSWM_COND_REQUEST_SLEEP             6U
+
+/** @brief Number of conditions */
+#define BSWM_NUM_CONDITIONS                 7U
+
+/*============================================================================*
+ * ACTION CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Action type
+ */
+typedef enum {
+    BSWM_ACTION_SET_MODE                = 0x00U,    /**< Target: -, Value: BswM_ModeType */
+    BSWM_ACTION_COM_IPDUGROUP_START     = 0x01U,    /**< Target: I-PDU group */
+    BSWM_ACTION_COM_IPDUGROUP_STOP      = 0x02U,    /**< Target: I-PDU group */
+    BSWM_ACTION_CAN_SET_CONTROLLER_MODE = 0x03U,    /**< Target: controller, Value: Can_ModeType */
+    BSWM_ACTION_DEM_ENABLE_CONDITION    = 0x04U     /**< Target: enable condition, Value: fulfilled */
+} BswM_ActionType;
+
+/**
+ * @brief Action configuration
+ */
+typedef struct {
+    BswM_ActionType Action;     /**< Action to execute */
+    uint16_t Target;            /**< Addressed module object */
+    uint8_t Value;              /**< Action parameter */
+} BswM_ActionConfigType;
+
+/**
+ * @brief Action list configuration
+ */
+typedef struct {
+    uint8_t NumActions;                     /**< Number of actions */
+    const BswM_ActionConfigType* Actions;   /**< Actions executed in order */
+} BswM_ActionListConfigType;
+
+/*============================================================================*
+ * RULE CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Condition bitset type (bit per condition ID)
+ */
+typedef uint32_t BswM_ConditionMaskType;
+
+/**
+ * @brief Rule configuration
+ * @details The rule is TRUE when all conditions in ConditionMask are TRUE.
+ *          The action list of the new result is executed when the result
+ *          changes (triggered action lists).
+ */
+typedef struct {
+    const char* Name;                           /**< Rule name for reports */
+    BswM_ConditionMaskType ConditionMask;       /**< AND of these conditions */
+    BswM_ActionListConfigType TrueActionList;   /**< Executed on FALSE -> TRUE */
+    BswM_ActionListConfigType FalseActionList;  /**< Executed on TRUE -> FALSE */
+} BswM_RuleConfigType;
+
+/** @brief ECU RUN mode, Dem ECU_RUN enable condition */
+#define BSWM_RULE_RUN                       0U
+/** @brief CAN controller, RX I-PDU group, Dem communication enable condition */
+#define BSWM_RULE_COM_RX                    1U
+/** @brief TX I-PDU group in RUN with full communication */
+#define BSWM_RULE_COM_TX                    2U
+/** @brief POST_RUN mode */
+#define BSWM_RULE_POST_RUN                  3U
+/** @brief SHUTDOWN mode */
+#define BSWM_RULE_SHUTDOWN                  4U
+/** @brief SLEEP mode */
+#define BSWM_RULE_SLEEP                     5U
+
+/** @brief Number of rules */
+#define BSWM_NUM_RULES                      6U
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Initial mode port values, indexed by port ID */
+extern const uint8_t BswM_ModePortInitValues[BSWM_NUM_MODE_PORTS];
+
+/** @brief Conditions, indexed by condition ID */
+extern const BswM_ConditionConfigType BswM_ConditionConfig[BSWM_NUM_CONDITIONS];
+
+/** @brief Rules, indexed by rule ID (evaluation order) */
+extern const BswM_RuleConfigType BswM_RuleConfig[BSWM_NUM_RULES];
+
+#endif /* BSWM_CFG_H */
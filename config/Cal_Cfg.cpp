@@ -0,0 +1,65 @@
+/**
+ * @file Cal_Cfg.cpp
+ * @brief Sensor Calibration Configuration Data
+ * @details Calibration curves of the FLM ECU sensors
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Cal_Cfg.h"
+#include "BSW/Cal/Cal.h"
+
+/*============================================================================*
+ * CURVE DATA
+ *============================================================================*/
+
+/**
+ * @brief Ambient light sensor characteristic (photodiode with log-like response)
+ * @details The FLM thresholds (ADC 800 / 1000) lie at about 200 / 250 lux
+ */
+static const uint16_t Cal_AmbientRaw[] = {
+    0U, 400U, 800U, 1000U, 1600U, 2400U, 3200U, 4095U
+};
+static const uint16_t Cal_AmbientLux[] = {
+    0U, 80U,  200U, 250U,  600U,  1400U, 3000U, 6000U
+};
+
+/**
+ * @brief Headlight current sense (linear shunt amplifier, mA per count)
+ */
+static const float64 Cal_HeadlightCurrentCoefficients[] = {
+    0.0, static_cast<float64>(FLM_HEADLIGHT_CURRENT_FACTOR)
+};
+
+/*============================================================================*
+ * CURVE CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Curves, indexed by curve ID
+ */
+static const Cal_CurveConfigType Cal_Curves[CAL_NUM_CURVES] = {
+    /* Shape, Mode, NumPoints, RawPoints, Values, Degree, Coefficients, OutMin, OutMax */
+    { CAL_CURVE_PIECEWISE_LINEAR, CAL_MODE_LUT,
+      static_cast<uint8_t>(sizeof(Cal_AmbientRaw) / sizeof(Cal_AmbientRaw[0])),
+      Cal_AmbientRaw, Cal_AmbientLux, 0U, NULL_PTR, 0U, 0xFFFFU },
+    { CAL_CURVE_POLYNOMIAL, CAL_MODE_LUT, 0U, NULL_PTR, NULL_PTR,
+      1U, Cal_HeadlightCurrentCoefficients, 0U, FLM_ADC_MAX_VALUE * FLM_HEADLIGHT_CURRENT_FACTOR }
+};
+
+STD_STATIC_ASSERT((sizeof(Cal_AmbientRaw) / sizeof(Cal_AmbientRaw[0])) ==
+                  (sizeof(Cal_AmbientLux) / sizeof(Cal_AmbientLux[0])),
+                  "Ambient curve breakpoint count mismatch");
+
+/**
+ * @brief Calibration configuration
+ */
+const Cal_ConfigType Cal_Config = {
+    CAL_NUM_CURVES,
+    Cal_Curves
+};
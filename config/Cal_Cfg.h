@@ -0,0 +1,66 @@
+/**
+ * @file Cal_Cfg.h
+ * @brief Sensor Calibration Configuration
+ * @details Calibration curves of the FLM ECU sensors and the build switch
+ *          for the precomputed lookup tables
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef CAL_CFG_H
+#define CAL_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/*============================================================================*
+ * CAL GENERAL CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Precomputed lookup tables (STD_OFF for memory constrained builds)
+ * @details A table takes CAL_LUT_SIZE * 2 bytes per curve. Without tables
+ *          all curves use the interpolation mode.
+ */
+#define CAL_LUT_SUPPORT                     STD_ON
+
+/** @brief Resolution of the raw input values (ADC resolution) */
+#define CAL_INPUT_BITS                      FLM_ADC_RESOLUTION
+
+/** @brief Largest raw input value */
+#define CAL_INPUT_MAX                       ((1U << CAL_INPUT_BITS) - 1U)
+
+/** @brief Lookup table entries per curve (one per raw value) */
+#define CAL_LUT_SIZE                        (1U << CAL_INPUT_BITS)
+
+/** @brief Maximum breakpoints of a piecewise linear curve */
+#define CAL_MAX_POINTS                      33U
+
+/** @brief Breakpoints a polynomial is sampled at for interpolation mode */
+#define CAL_POLY_INTERP_POINTS              33U
+
+/** @brief Maximum polynomial degree */
+#define CAL_MAX_POLY_DEGREE                 5U
+
+/*============================================================================*
+ * CURVE CONFIGURATION
+ *============================================================================*/
+
+/** @brief Ambient light sensor: ADC counts -> lux */
+#define CAL_CURVE_AMBIENT_LUX               0U
+
+/** @brief Headlight current sense: ADC counts -> mA */
+#define CAL_CURVE_HEADLIGHT_CURRENT         1U
+
+/** @brief Number of configured curves */
+#define CAL_NUM_CURVES                      2U
+
+STD_STATIC_ASSERT(CAL_POLY_INTERP_POINTS <= CAL_MAX_POINTS,
+                  "Polynomial interpolation needs more breakpoints than CAL_MAX_POINTS");
+
+#endif /* CAL_CFG_H */
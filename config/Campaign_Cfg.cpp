@@ -0,0 +1,77 @@
+/**
+ * @file Campaign_Cfg.cpp
+ * @brief Fault Campaign Configuration Data
+ * @details Fault catalogue and known findings of the flm_fault_campaign runner
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Campaign_Cfg.h"
+#include "Sim/Campaign/Campaign.h"
+
+/*============================================================================*
+ * CATALOGUE CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Every fault model */
+static const Campaign_FaultType Campaign_DefaultFaults[] = {
+    CAMPAIGN_FAULT_E2E_CRC,
+    CAMPAIGN_FAULT_E2E_COUNTER_JUMP,
+    CAMPAIGN_FAULT_CAN_LOSS,
+    CAMPAIGN_FAULT_ADC_OPEN,
+    CAMPAIGN_FAULT_ADC_SHORT,
+    CAMPAIGN_FAULT_ADC_STUCK,
+    CAMPAIGN_FAULT_LAMP_OPEN_LOAD,
+    CAMPAIGN_FAULT_WDGM_ALIVE_MISS
+};
+
+/** @brief From single missed frames to permanent faults (ms) */
+static const uint32_t Campaign_DefaultDurations[] = {
+    5U, 10U, 20U, 50U, 100U, 200U, 500U, 1000U
+};
+
+/**
+ * @brief Full catalogue
+ * @details Every injection time within four WdgM supervision cycles, so all
+ *          phases of the 5/10/20ms tasks and of the supervision are hit
+ */
+const Campaign_CatalogueType Campaign_DefaultCatalogue = {
+    Campaign_DefaultFaults,
+    static_cast<uint8_t>(sizeof(Campaign_DefaultFaults) / sizeof(Campaign_DefaultFaults[0])),
+    CAMPAIGN_DEFAULT_FIRST_INJECTION_MS,
+    CAMPAIGN_DEFAULT_INJECTION_STEP_MS,
+    CAMPAIGN_DEFAULT_NUM_INJECTIONS,
+    Campaign_DefaultDurations,
+    static_cast<uint8_t>(sizeof(Campaign_DefaultDurations) / sizeof(Campaign_DefaultDurations[0]))
+};
+
+/*============================================================================*
+ * KNOWN FINDINGS CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Outcome of the default catalogue per fault model
+ * @details Regression baseline of flm_fault_campaign --known-findings;
+ *          update it with the change that moves an outcome. Transient faults
+ *          below the detection times are tolerated (not detected). Known
+ *          FTTI gaps:
+ *          - Ambient sensor open/short (>= 100ms) and low beam open load reach
+ *            the safe state only through the DEGRADED time budget
+ *          - An ambient sensor stuck at a plausible level is never detected
+ */
+const Campaign_FindingType Campaign_DefaultFindings[CAMPAIGN_NUM_FAULTS] = {
+    /* MaxLate, MaxNotDetected, MaxResponseMs */
+    {    0U,   710U, FLM_FTTI_MS },     /* e2e-crc */
+    {    0U,   600U, FLM_FTTI_MS },     /* e2e-counter-jump */
+    {    0U,  2000U, FLM_FTTI_MS },     /* can-loss */
+    { 1600U,  1600U, 292U },            /* adc-open */
+    { 1600U,  1600U, 301U },            /* adc-short */
+    {    0U,  3200U, FLM_FTTI_MS },     /* adc-stuck */
+    { 2800U,   400U, 223U },            /* lamp-open-load */
+    {    0U,  1200U, FLM_FTTI_MS }      /* wdgm-alive-miss */
+};
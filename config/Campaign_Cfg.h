@@ -0,0 +1,91 @@
+/**
+ * @file Campaign_Cfg.h
+ * @brief Fault Campaign Configuration
+ * @details Warm start, observation window, nominal operating point and
+ *          fault levels of the fault-injection campaign
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef CAMPAIGN_CFG_H
+#define CAMPAIGN_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/*============================================================================*
+ * CAMPAIGN GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Fault-free run from cold start to the warm-start state (ms) */
+#define CAMPAIGN_WARMUP_MS                  1000U
+
+/** @brief Observation after the end of a fault (ms) */
+#define CAMPAIGN_OBSERVATION_MS             (2U * FLM_FTTI_MS)
+
+/** @brief Maximum injection times of a catalogue (one warm start each) */
+#define CAMPAIGN_MAX_INJECTIONS             512U
+
+/** @brief Maximum worker processes */
+#define CAMPAIGN_MAX_WORKERS                64U
+
+/*============================================================================*
+ * NOMINAL OPERATING POINT
+ *============================================================================*/
+
+/* Night drive in AUTO: the low beam is on and the ambient level wanders
+ * between dark levels, clear of the sensor fault thresholds */
+
+/** @brief Darkest nominal ambient level (ADC counts) */
+#define CAMPAIGN_AMBIENT_MIN_LEVEL          300U
+
+/** @brief Brightest nominal ambient level (ADC counts) */
+#define CAMPAIGN_AMBIENT_MAX_LEVEL          700U
+
+/** @brief Period of the nominal ambient triangle (ms) */
+#define CAMPAIGN_AMBIENT_PERIOD_MS          2000U
+
+/*============================================================================*
+ * FAULT LEVELS
+ *============================================================================*/
+
+/** @brief Ambient sensor with an open circuit (ADC counts) */
+#define CAMPAIGN_AMBIENT_OPEN_LEVEL         0U
+
+/** @brief Ambient sensor shorted to the supply (ADC counts) */
+#define CAMPAIGN_AMBIENT_SHORT_LEVEL        ADC_MAX_VALUE
+
+/** @brief Counter advance per frame of a counter jump (beyond the max delta) */
+#define CAMPAIGN_E2E_COUNTER_JUMP           (FLM_E2E_MAX_DELTA_COUNTER + 1U)
+
+/** @brief CRC bits flipped by a CRC corruption */
+#define CAMPAIGN_E2E_CRC_FLIP_MASK          0x01U
+
+/*============================================================================*
+ * DEFAULT CATALOGUE
+ *============================================================================*/
+
+/** @brief First injection time after the warm start (ms) */
+#define CAMPAIGN_DEFAULT_FIRST_INJECTION_MS 0U
+
+/** @brief Injection time step (ms); one step covers every task phase */
+#define CAMPAIGN_DEFAULT_INJECTION_STEP_MS  1U
+
+/** @brief Injection times, four WdgM supervision cycles */
+#define CAMPAIGN_DEFAULT_NUM_INJECTIONS     (4U * FLM_WDGM_SUPERVISION_CYCLE_MS)
+
+STD_STATIC_ASSERT(CAMPAIGN_AMBIENT_MIN_LEVEL > FLM_AMBIENT_OPEN_CIRCUIT,
+                  "Nominal ambient must not look like an open circuit");
+
+STD_STATIC_ASSERT(CAMPAIGN_AMBIENT_MAX_LEVEL < FLM_AMBIENT_THRESHOLD_ON,
+                  "Nominal ambient must keep the low beam on");
+
+STD_STATIC_ASSERT(CAMPAIGN_DEFAULT_NUM_INJECTIONS <= CAMPAIGN_MAX_INJECTIONS,
+                  "Default catalogue exceeds the warm starts");
+
+#endif /* CAMPAIGN_CFG_H */
@@ -52,6 +52,22 @@
 /** @brief Total number of I-PDUs configured */
 #define COM_NUM_IPDUS                       3U
 
+/*============================================================================*
+ * I-PDU GROUP CONFIGURATION
+ *============================================================================*/
+
+/** @brief I-PDU group of received I-PDUs */
+#define COM_IPDUGROUP_RX                    0U
+
+/** @brief I-PDU group of transmitted I-PDUs */
+#define COM_IPDUGROUP_TX                    1U
+
+/** @brief Total number of I-PDU groups */
+#define COM_NUM_IPDU_GROUPS                 2U
+
+/** @brief I-PDU groups are started by Com_Init (BswM may stop them) */
+#define COM_IPDUGROUP_START_ON_INIT         STD_ON
+
 /*============================================================================*
  * SIGNAL CONFIGURATION
  *============================================================================*/
@@ -158,8 +158,8 @@ typedef struct {
     uint32_t DTCValue;                  /**< Associated DTC value */
     uint8_t EventKind;                  /**< Event kind (BSW/SWC) */
     Dem_DebounceAlgorithmType DebounceAlgo; /**< Debounce algorithm */
-    sint16_t FailThreshold;             /**< Fail threshold */
-    sint16_t PassThreshold;             /**< Pass threshold */
+    sint16 FailThreshold;             /**< Fail threshold */
+    sint16 PassThreshold;             /**< Pass threshold */
     uint16_t AgingThreshold;            /**< Aging cycles threshold */
     boolean EnableStorage;              /**< Enable event storage */
     boolean EnableAging;                /**< Enable aging */
@@ -189,6 +189,24 @@ typedef uint8_t Dem_OperationCycleIdType;
 /** @brief Number of operation cycles */
 #define DEM_NUM_OPERATION_CYCLES            2U
 
+/*============================================================================*
+ * ENABLE CONDITION CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Enable condition ID type
+ */
+typedef uint8_t Dem_EnableConditionIdType;
+
+/** @brief Communication available (set by BswM) */
+#define DEM_ENABLE_CONDITION_COMMUNICATION  0x00U
+
+/** @brief ECU in RUN mode (set by BswM) */
+#define DEM_ENABLE_CONDITION_ECU_RUN        0x01U
+
+/** @brief Number of enable conditions */
+#define DEM_NUM_ENABLE_CONDITIONS           2U
+
 /*============================================================================*
  * AGING CONFIGURATION
  *============================================================================*/
@@ -0,0 +1,102 @@
+/**
+ * @file EcuM_Cfg.cpp
+ * @brief ECU State Manager Configuration Data
+ * @details Init items of the FLM ECU and their dependencies
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "EcuM_Cfg.h"
+
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Can/Can.h"
+#include "MCAL/Pwm/Pwm.h"
+
+#include "BSW/Dem/Dem.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Com/Com.h"
+#include "BSW/BswM/BswM.h"
+#include "BSW/Cal/Cal.h"
+
+#include "Rte/Rte.h"
+
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/LightRequest/LightRequest.h"
+#include "Application/FLM/FLM_Application.h"
+#include "Application/Headlight/Headlight.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+
+/*============================================================================*
+ * MODULE CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief CAN configuration (stub) */
+static const Can_ConfigType EcuM_CanConfig = { 1U, NULL_PTR };
+
+/** @brief WdgM configuration */
+static const WdgM_ConfigType EcuM_WdgMConfig = {
+    WDGM_NUM_SUPERVISED_ENTITIES,
+    WDGM_SUPERVISION_CYCLE_MS,
+    WDGM_FAILED_REFERENCE_CYCLES
+};
+
+/** @brief BswM configuration (stub) */
+static const BswM_ConfigType EcuM_BswMConfig = { 5U };
+
+/*============================================================================*
+ * INIT WRAPPERS (modules with configuration pointer)
+ *============================================================================*/
+
+static void EcuM_AdcInit(void) { Adc_Init(&Adc_Config); }
+static void EcuM_CanInit(void) { Can_Init(&EcuM_CanConfig); }
+static void EcuM_WdgMInit(void) { WdgM_Init(&EcuM_WdgMConfig); }
+static void EcuM_BswMInit(void) { BswM_Init(&EcuM_BswMConfig); }
+static void EcuM_CalInit(void) { Cal_Init(&Cal_Config); }
+
+/*============================================================================*
+ * INIT ITEM CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Init items, indexed by init item ID
+ * @details MCAL drivers and Dem (event memory) keep their state over a warm
+ *          restart. SwitchEvent shares the E2E library state with Com's
+ *          reception path and therefore runs after Com. Cal compiles the
+ *          calibration tables used by the sensor reading SWCs.
+ *          LightRequest and Headlight start ADC groups, whose first
+ *          conversions run the stimulus and lamp models and the replay
+ *          recording hook. They are not parallel, so those conversions
+ *          happen one after the other in a fixed order.
+ */
+const EcuM_InitItemConfigType EcuM_InitItemConfig[ECUM_NUM_INIT_ITEMS] = {
+    /* Name,           Phase,          Init,                 DeInit,        DependsOn, Parallel, Preserved */
+    { "Adc",           ECUM_PHASE_MCAL, EcuM_AdcInit,         Adc_DeInit,    0U, TRUE,  TRUE },
+    { "Dio",           ECUM_PHASE_MCAL, Dio_Init,             Dio_DeInit,    0U, TRUE,  TRUE },
+    { "Can",           ECUM_PHASE_MCAL, EcuM_CanInit,         Can_DeInit,    0U, TRUE,  TRUE },
+    { "Dem",           ECUM_PHASE_BSW,  Dem_Init,             Dem_Shutdown,  0U, TRUE,  TRUE },
+    { "WdgM",          ECUM_PHASE_BSW,  EcuM_WdgMInit,        WdgM_DeInit,   0U, TRUE,  FALSE },
+    { "Com",           ECUM_PHASE_BSW,  Com_Init,             Com_DeInit,
+      ECUM_DEP(ECUM_ITEM_CAN), TRUE, FALSE },
+    { "BswM",          ECUM_PHASE_BSW,  EcuM_BswMInit,        BswM_Deinit,
+      ECUM_DEP(ECUM_ITEM_CAN) | ECUM_DEP(ECUM_ITEM_COM) | ECUM_DEP(ECUM_ITEM_DEM), TRUE, FALSE },
+    { "SwitchEvent",   ECUM_PHASE_SWC,  SwitchEvent_Init,     NULL_PTR,
+      ECUM_DEP(ECUM_ITEM_COM) | ECUM_DEP(ECUM_ITEM_RTE), TRUE, FALSE },
+    { "LightRequest",  ECUM_PHASE_SWC,  LightRequest_Init,    NULL_PTR,
+      ECUM_DEP(ECUM_ITEM_ADC) | ECUM_DEP(ECUM_ITEM_CAL) | ECUM_DEP(ECUM_ITEM_RTE), FALSE, FALSE },
+    { "FLM",           ECUM_PHASE_SWC,  FLM_Init,             NULL_PTR,
+      ECUM_DEP(ECUM_ITEM_BSWM) | ECUM_DEP(ECUM_ITEM_RTE), TRUE, FALSE },
+    { "Headlight",     ECUM_PHASE_SWC,  Headlight_Init,       NULL_PTR,
+      ECUM_DEP(ECUM_ITEM_DIO) | ECUM_DEP(ECUM_ITEM_PWM) | ECUM_DEP(ECUM_ITEM_ADC) |
+      ECUM_DEP(ECUM_ITEM_CAL) | ECUM_DEP(ECUM_ITEM_RTE), FALSE, FALSE },
+    { "SafetyMonitor", ECUM_PHASE_SWC,  SafetyMonitor_Init,   NULL_PTR,
+      ECUM_DEP(ECUM_ITEM_WDGM) | ECUM_DEP(ECUM_ITEM_DEM) | ECUM_DEP(ECUM_ITEM_RTE), TRUE, FALSE },
+    { "Cal",           ECUM_PHASE_BSW,  EcuM_CalInit,         Cal_DeInit,    0U, TRUE,  TRUE },
+    { "Pwm",           ECUM_PHASE_MCAL, Pwm_Init,             Pwm_DeInit,    0U, TRUE,  TRUE },
+    { "Rte",           ECUM_PHASE_SWC,  Rte_Start,            NULL_PTR,      0U, TRUE,  FALSE }
+};
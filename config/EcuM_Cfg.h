@@ -0,0 +1,109 @@
+/**
+ * @file EcuM_Cfg.h
+ * @brief ECU State Manager Configuration
+ * @details Init item list with declared dependencies for the startup
+ *          sequencer
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef ECUM_CFG_H
+#define ECUM_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+
+/*============================================================================*
+ * ECUM GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Maximum number of init items (bits of EcuM_InitItemMaskType) */
+#define ECUM_MAX_INIT_ITEMS                 32U
+
+/** @brief Maximum init items executed concurrently */
+#define ECUM_MAX_PARALLEL_INIT              4U
+
+/**
+ * @brief Default concurrency of the application startup (1 = serial)
+ * @details The init functions of this ECU take microseconds, starting a
+ *          worker thread costs more than it saves. Raise for init items
+ *          that block (device probing, NvM read-all).
+ */
+#define ECUM_DEFAULT_PARALLEL_INIT          1U
+
+/*============================================================================*
+ * INIT PHASES
+ *============================================================================*/
+
+/**
+ * @brief Init phase type (reporting only, ordering follows dependencies)
+ */
+typedef enum {
+    ECUM_PHASE_MCAL     = 0x00U,    /**< Driver init list */
+    ECUM_PHASE_BSW      = 0x01U,    /**< Basic software */
+    ECUM_PHASE_SWC      = 0x02U     /**< Application SWCs (RTE start) */
+} EcuM_PhaseType;
+
+/** @brief Number of init phases */
+#define ECUM_NUM_PHASES                     3U
+
+/*============================================================================*
+ * INIT ITEM CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Init item bitset type (bit per init item ID)
+ */
+typedef uint32_t EcuM_InitItemMaskType;
+
+/**
+ * @brief Init item configuration
+ */
+typedef struct {
+    const char* Name;                   /**< Module name for reports */
+    EcuM_PhaseType Phase;               /**< Reporting phase */
+    void (*InitFn)(void);               /**< Module initialization */
+    void (*DeInitFn)(void);             /**< Module de-initialization (NULL_PTR = none) */
+    EcuM_InitItemMaskType DependsOn;    /**< Items that must be initialized before */
+    boolean ParallelAllowed;            /**< May run on a worker thread */
+    boolean PreservedOnWarmStart;       /**< State kept over a warm restart */
+} EcuM_InitItemConfigType;
+
+/** @brief Dependency bit of an init item */
+#define ECUM_DEP(item)                      (static_cast<EcuM_InitItemMaskType>(1U) << (item))
+
+/*----------------------------------------------------------------------------*
+ * Init item IDs (configuration order)
+ *----------------------------------------------------------------------------*/
+
+#define ECUM_ITEM_ADC                       0U
+#define ECUM_ITEM_DIO                       1U
+#define ECUM_ITEM_CAN                       2U
+#define ECUM_ITEM_DEM                       3U
+#define ECUM_ITEM_WDGM                      4U
+#define ECUM_ITEM_COM                       5U
+#define ECUM_ITEM_BSWM                      6U
+#define ECUM_ITEM_SWITCHEVENT               7U
+#define ECUM_ITEM_LIGHTREQUEST              8U
+#define ECUM_ITEM_FLM                       9U
+#define ECUM_ITEM_HEADLIGHT                 10U
+#define ECUM_ITEM_SAFETYMONITOR             11U
+#define ECUM_ITEM_CAL                       12U
+#define ECUM_ITEM_PWM                       13U
+#define ECUM_ITEM_RTE                       14U
+
+/** @brief Number of init items */
+#define ECUM_NUM_INIT_ITEMS                 15U
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Init items, indexed by init item ID */
+extern const EcuM_InitItemConfigType EcuM_InitItemConfig[ECUM_NUM_INIT_ITEMS];
+
+#endif /* ECUM_CFG_H */
@@ -0,0 +1,47 @@
+/**
+ * @file FLM_Cfg.cpp
+ * @brief FLM Application SWC Configuration Data
+ * @details Transition table of the FLM state machine
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "FLM_Cfg.h"
+
+/*============================================================================*
+ * TRANSITION CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Transitions [FunSafReq01-03]
+ * @details SAFE has no outgoing transition: the safe state is final.
+ */
+const FLM_TransitionConfigType FLM_TransitionConfig[FLM_NUM_TRANSITIONS] = {
+    /* Name, FromState,
+       GuardMask, GuardValue, ToState */
+    { "INIT_SAFE_REQUEST", FLM_STATE_INIT,
+      FLM_GUARD_SAFE_REQUEST, FLM_GUARD_SAFE_REQUEST, FLM_STATE_SAFE },
+    { "INIT_NORMAL", FLM_STATE_INIT,
+      FLM_GUARD_INPUTS_VALID, FLM_GUARD_INPUTS_VALID, FLM_STATE_NORMAL },
+
+    { "NORMAL_SAFE_REQUEST", FLM_STATE_NORMAL,
+      FLM_GUARD_SAFE_REQUEST, FLM_GUARD_SAFE_REQUEST, FLM_STATE_SAFE },
+    { "NORMAL_SAFE_E2E_TIMEOUT", FLM_STATE_NORMAL,
+      FLM_GUARD_E2E_TIMEOUT, FLM_GUARD_E2E_TIMEOUT, FLM_STATE_SAFE },
+    { "NORMAL_DEGRADED", FLM_STATE_NORMAL,
+      FLM_GUARD_ERROR_LIMIT, FLM_GUARD_ERROR_LIMIT, FLM_STATE_DEGRADED },
+
+    { "DEGRADED_SAFE_REQUEST", FLM_STATE_DEGRADED,
+      FLM_GUARD_SAFE_REQUEST, FLM_GUARD_SAFE_REQUEST, FLM_STATE_SAFE },
+    { "DEGRADED_NORMAL", FLM_STATE_DEGRADED,
+      FLM_GUARD_INPUTS_VALID, FLM_GUARD_INPUTS_VALID, FLM_STATE_NORMAL },
+    { "DEGRADED_SAFE_E2E_TIMEOUT", FLM_STATE_DEGRADED,
+      FLM_GUARD_E2E_TIMEOUT, FLM_GUARD_E2E_TIMEOUT, FLM_STATE_SAFE },
+    { "DEGRADED_SAFE_TIMEOUT", FLM_STATE_DEGRADED,
+      FLM_GUARD_DEGRADED_TIMEOUT, FLM_GUARD_DEGRADED_TIMEOUT, FLM_STATE_SAFE }
+};
@@ -0,0 +1,112 @@
+/**
+ * @file FLM_Cfg.h
+ * @brief FLM Application SWC Configuration
+ * @details Guards and transition table of the FLM state machine
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety ASIL B - [FunSafReq01-03] Safe state transitions
+ */
+
+#ifndef FLM_CFG_H
+#define FLM_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Rte/Rte_Type.h"
+
+/*============================================================================*
+ * STATE CONFIGURATION
+ *============================================================================*/
+
+/** @brief Number of FLM_StateType values */
+#define FLM_NUM_STATES                      4U
+
+/*============================================================================*
+ * GUARD CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Guard bitset type (bit per guard)
+ * @details Evaluated once per main function cycle
+ */
+typedef uint8_t FLM_GuardMaskType;
+
+/** @brief External safe state request (FLM_TriggerSafeState) */
+#define FLM_GUARD_SAFE_REQUEST              0x01U
+/** @brief E2E timeout of the light switch signal */
+#define FLM_GUARD_E2E_TIMEOUT               0x02U
+/** @brief Light switch and ambient light are valid */
+#define FLM_GUARD_INPUTS_VALID              0x04U
+/** @brief FLM_MAX_CONSECUTIVE_ERRORS cycles with an invalid input */
+#define FLM_GUARD_ERROR_LIMIT               0x08U
+/** @brief Time since entering DEGRADED exceeds FTTI minus transition time [ECU17] */
+#define FLM_GUARD_DEGRADED_TIMEOUT          0x10U
+
+/** @brief Number of guards */
+#define FLM_NUM_GUARDS                      5U
+
+/** @brief Number of guard combinations (lookup table width) */
+#define FLM_NUM_GUARD_MASKS                 (1U << FLM_NUM_GUARDS)
+
+/*============================================================================*
+ * TRANSITION CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Transition configuration
+ * @details The transition is enabled in FromState when the guards selected
+ *          by GuardMask equal GuardValue. Of several enabled transitions the
+ *          first in the table is taken.
+ */
+typedef struct {
+    const char* Name;                   /**< Transition name for reports */
+    FLM_StateType FromState;            /**< Source state */
+    FLM_GuardMaskType GuardMask;        /**< Guards evaluated */
+    FLM_GuardMaskType GuardValue;       /**< Required values of these guards */
+    FLM_StateType ToState;              /**< Target state */
+} FLM_TransitionConfigType;
+
+/** @brief Transition ID type */
+typedef uint8_t FLM_TransitionIdType;
+
+/** @brief INIT -> SAFE on an external safe state request */
+#define FLM_TRANSITION_INIT_SAFE_REQUEST            0U
+/** @brief INIT -> NORMAL once all inputs are valid */
+#define FLM_TRANSITION_INIT_NORMAL                  1U
+/** @brief NORMAL -> SAFE on an external safe state request */
+#define FLM_TRANSITION_NORMAL_SAFE_REQUEST          2U
+/** @brief NORMAL -> SAFE on E2E timeout */
+#define FLM_TRANSITION_NORMAL_SAFE_E2E_TIMEOUT      3U
+/** @brief NORMAL -> DEGRADED after consecutive input errors */
+#define FLM_TRANSITION_NORMAL_DEGRADED              4U
+/** @brief DEGRADED -> SAFE on an external safe state request */
+#define FLM_TRANSITION_DEGRADED_SAFE_REQUEST        5U
+/** @brief DEGRADED -> NORMAL once all inputs recovered */
+#define FLM_TRANSITION_DEGRADED_NORMAL              6U
+/** @brief DEGRADED -> SAFE on E2E timeout */
+#define FLM_TRANSITION_DEGRADED_SAFE_E2E_TIMEOUT    7U
+/** @brief DEGRADED -> SAFE when the degraded time budget is used up */
+#define FLM_TRANSITION_DEGRADED_SAFE_TIMEOUT        8U
+
+/** @brief Number of transitions */
+#define FLM_NUM_TRANSITIONS                         9U
+
+/** @brief No transition enabled (lookup table entry) */
+#define FLM_TRANSITION_NONE                         0xFFU
+
+STD_STATIC_ASSERT(FLM_NUM_TRANSITIONS < FLM_TRANSITION_NONE,
+                  "FLM_NUM_TRANSITIONS exceeds FLM_TransitionIdType");
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Transitions, indexed by transition ID (priority order per state) */
+extern const FLM_TransitionConfigType FLM_TransitionConfig[FLM_NUM_TRANSITIONS];
+
+#endif /* FLM_CFG_H */
@@ -0,0 +1,34 @@
+/**
+ * @file Lamp_Cfg.cpp
+ * @brief Lamp Model Configuration Data
+ * @details Low and high beam lamps on the shared current sense
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Lamp_Cfg.h"
+#include "Sim/Lamp/Lamp.h"
+#include "MCAL/Pwm/Pwm.h"
+#include "MCAL/Dio/Dio.h"
+
+/*============================================================================*
+ * LAMP CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Lamps, indexed by lamp ID
+ * @details Each lamp is switched by its beam relay and its PWM output stage
+ */
+const Lamp_ConfigType Lamp_Config[LAMP_NUM_LAMPS] = {
+    /* PwmChannel,           RelayChannel,           NominalCurrentMa,
+       ColdResistanceRatio,           HeatTimeUs,           CoolTimeUs */
+    { PWM_CHANNEL_LOW_BEAM,  DIO_CHANNEL_LOW_BEAM,  LAMP_H7_NOMINAL_CURRENT_MA,
+      LAMP_H7_COLD_RESISTANCE_RATIO, LAMP_H7_HEAT_TIME_US, LAMP_H7_COOL_TIME_US },
+    { PWM_CHANNEL_HIGH_BEAM, DIO_CHANNEL_HIGH_BEAM, LAMP_H7_NOMINAL_CURRENT_MA,
+      LAMP_H7_COLD_RESISTANCE_RATIO, LAMP_H7_HEAT_TIME_US, LAMP_H7_COOL_TIME_US }
+};
@@ -0,0 +1,62 @@
+/**
+ * @file Lamp_Cfg.h
+ * @brief Lamp Model Configuration
+ * @details Electrical and thermal parameters of the simulated halogen
+ *          headlamps behind the PWM output stages
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef LAMP_CFG_H
+#define LAMP_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/*============================================================================*
+ * LAMP GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Number of simulated lamps */
+#define LAMP_NUM_LAMPS                      2U
+
+/** @brief Low beam lamp */
+#define LAMP_LOW_BEAM                       0U
+
+/** @brief High beam lamp */
+#define LAMP_HIGH_BEAM                      1U
+
+/** @brief ADC channel of the shared current sense */
+#define LAMP_ADC_CHANNEL                    FLM_ADC_CHANNEL_CURRENT
+
+/** @brief Current sense scaling (mA per ADC count) */
+#define LAMP_SENSE_MA_PER_COUNT             FLM_HEADLIGHT_CURRENT_FACTOR
+
+/** @brief Current limit of a high-side switch into a short circuit (mA) */
+#define LAMP_SHORT_CIRCUIT_CURRENT_MA       30000.0f
+
+/** @brief Samples computed per model pass */
+#define LAMP_BLOCK_SAMPLES                  256U
+
+/*============================================================================*
+ * H7 HALOGEN LAMP (55 W AT 13.5 V)
+ *============================================================================*/
+
+/** @brief Current with a hot filament at full duty (mA) */
+#define LAMP_H7_NOMINAL_CURRENT_MA          4100.0f
+
+/** @brief Cold to hot filament resistance (inrush about 10x nominal) */
+#define LAMP_H7_COLD_RESISTANCE_RATIO       0.1f
+
+/** @brief Thermal time constant while heating (us) */
+#define LAMP_H7_HEAT_TIME_US                30000U
+
+/** @brief Thermal time constant while cooling (us) */
+#define LAMP_H7_COOL_TIME_US                120000U
+
+#endif /* LAMP_CFG_H */
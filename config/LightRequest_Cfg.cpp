@@ -0,0 +1,29 @@
+/**
+ * @file LightRequest_Cfg.cpp
+ * @brief LightRequest SWC Configuration Data
+ * @details Filter chain of the ambient light sensor
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "LightRequest_Cfg.h"
+
+/*============================================================================*
+ * FILTER CHAIN CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Filter chain [FunSafReq01-02]
+ * @details Averaging over FLM_ADC_SAMPLES cycles. Noisy sensors may add a
+ *          median stage for spikes ahead of a longer average, e.g.
+ *          { MEDIAN, 5 }, { MOVING_AVERAGE, 64 }.
+ */
+const LightRequest_FilterStageConfigType LightRequest_FilterChainConfig[LIGHTREQUEST_NUM_FILTER_STAGES] = {
+    /* Type, Param */
+    { LIGHTREQUEST_FILTER_MOVING_AVERAGE, FLM_ADC_SAMPLES }
+};
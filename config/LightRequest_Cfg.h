@@ -0,0 +1,87 @@
+/**
+ * @file LightRequest_Cfg.h
+ * @brief LightRequest SWC Configuration
+ * @details Signal conditioning filter chain of the ambient light sensor
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety ASIL A - [FunSafReq01-02] Ambient light sensor validation
+ */
+
+#ifndef LIGHTREQUEST_CFG_H
+#define LIGHTREQUEST_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/*============================================================================*
+ * FILTER GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Maximum number of stages in the filter chain */
+#define LIGHTREQUEST_FILTER_MAX_STAGES      4U
+
+/** @brief Longest moving average window (samples) */
+#define LIGHTREQUEST_FILTER_MAX_WINDOW      512U
+
+/** @brief Longest median window (samples, spike rejection) */
+#define LIGHTREQUEST_FILTER_MAX_MEDIAN      31U
+
+/** @brief IIR coefficient of 1.0 (Q15) */
+#define LIGHTREQUEST_FILTER_IIR_ONE         32768U
+
+/*============================================================================*
+ * FILTER STAGE CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Filter stage type
+ */
+typedef enum {
+    LIGHTREQUEST_FILTER_MOVING_AVERAGE  = 0x00U,    /**< Running sum over Param samples */
+    LIGHTREQUEST_FILTER_IIR_LOWPASS     = 0x01U,    /**< y += Param/32768 * (x - y) */
+    LIGHTREQUEST_FILTER_MEDIAN          = 0x02U     /**< Median of Param samples (odd) */
+} LightRequest_FilterType;
+
+/**
+ * @brief Filter stage configuration
+ */
+typedef struct {
+    LightRequest_FilterType Type;       /**< Stage type */
+    uint16_t Param;                     /**< Window length / IIR coefficient (Q15) */
+} LightRequest_FilterStageConfigType;
+
+/** @brief Number of stages of the configured chain */
+#define LIGHTREQUEST_NUM_FILTER_STAGES      1U
+
+STD_STATIC_ASSERT(LIGHTREQUEST_NUM_FILTER_STAGES <= LIGHTREQUEST_FILTER_MAX_STAGES,
+                  "Filter chain exceeds LIGHTREQUEST_FILTER_MAX_STAGES");
+STD_STATIC_ASSERT(FLM_ADC_SAMPLES <= LIGHTREQUEST_FILTER_MAX_WINDOW,
+                  "FLM_ADC_SAMPLES exceeds LIGHTREQUEST_FILTER_MAX_WINDOW");
+
+/*============================================================================*
+ * BATCH EVALUATION CONFIGURATION
+ *============================================================================*/
+
+/** @brief Maximum sensor channels of a batch (fleet simulation) */
+#define LIGHTREQUEST_BATCH_MAX_CHANNELS     4096U
+
+/** @brief Longest moving average window of a batch (samples) */
+#define LIGHTREQUEST_BATCH_MAX_WINDOW       16U
+
+STD_STATIC_ASSERT(FLM_ADC_SAMPLES <= LIGHTREQUEST_BATCH_MAX_WINDOW,
+                  "FLM_ADC_SAMPLES exceeds LIGHTREQUEST_BATCH_MAX_WINDOW");
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Filter chain, applied in order to the oversampled sensor value */
+extern const LightRequest_FilterStageConfigType LightRequest_FilterChainConfig[LIGHTREQUEST_NUM_FILTER_STAGES];
+
+#endif /* LIGHTREQUEST_CFG_H */
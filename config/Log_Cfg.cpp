@@ -0,0 +1,29 @@
+/**
+ * @file Log_Cfg.cpp
+ * @brief Log Configuration Data
+ * @details Line prefixes of the log levels; informational lines are
+ *          written without prefix
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Log_Cfg.h"
+
+/*============================================================================*
+ * LEVEL CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Line prefix per level
+ */
+const char* const Log_LevelPrefixes[LOG_NUM_LEVELS] = {
+    "DEBUG: ",
+    "",
+    "WARNING: ",
+    "ERROR: "
+};
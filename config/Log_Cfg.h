@@ -0,0 +1,74 @@
+/**
+ * @file Log_Cfg.h
+ * @brief Log Configuration
+ * @details Levels, compile-time filter and ring dimensions of the
+ *          asynchronous logger
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef LOG_CFG_H
+#define LOG_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+
+/*============================================================================*
+ * LOG LEVELS
+ *============================================================================*/
+
+#define LOG_LEVEL_DEBUG                     0U  /**< Development details */
+#define LOG_LEVEL_INFO                      1U  /**< Normal operation */
+#define LOG_LEVEL_WARNING                   2U  /**< Degraded operation */
+#define LOG_LEVEL_ERROR                     3U  /**< Failures */
+#define LOG_LEVEL_OFF                       4U  /**< Nothing is logged */
+
+/** @brief Number of levels that produce messages */
+#define LOG_NUM_LEVELS                      4U
+
+/*============================================================================*
+ * LOG GENERAL CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Lowest level compiled in
+ * @details Log statements below this level compile to nothing, including the
+ *          evaluation of their arguments. Set from the build (LOG_LEVEL).
+ */
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL                   LOG_LEVEL_DEBUG
+#endif
+
+/** @brief Lowest level logged after Log_Init (Log_SetLevel changes it) */
+#define LOG_DEFAULT_LEVEL                   LOG_LEVEL_INFO
+
+/** @brief Maximum threads with their own ring */
+#define LOG_MAX_THREADS                     4U
+
+/** @brief Messages per ring (power of two) */
+#define LOG_RING_SIZE                       256U
+
+/** @brief Maximum format arguments of a message */
+#define LOG_MAX_ARGS                        8U
+
+/** @brief Period of the background writer (ms) */
+#define LOG_DRAIN_PERIOD_MS                 10U
+
+/** @brief Maximum length of a formatted line including the terminator */
+#define LOG_LINE_SIZE                       256U
+
+STD_STATIC_ASSERT((LOG_RING_SIZE & (LOG_RING_SIZE - 1U)) == 0U,
+                  "Log ring size must be a power of two");
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Line prefix per level */
+extern const char* const Log_LevelPrefixes[LOG_NUM_LEVELS];
+
+#endif /* LOG_CFG_H */
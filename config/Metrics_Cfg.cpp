@@ -0,0 +1,174 @@
+/**
+ * @file Metrics_Cfg.cpp
+ * @brief Metrics Configuration Data
+ * @details Metric families and label sets of the metrics registry
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Metrics_Cfg.h"
+
+/*============================================================================*
+ * HISTOGRAM CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief FLM state visits, from a single main function period to minutes (ms) */
+static const uint64_t Metrics_StateVisitBucketsMs[] = {
+    10U, 50U, 100U, 200U, 500U, 1000U, 5000U, 10000U, 60000U, 300000U
+};
+
+/*============================================================================*
+ * SERIES CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Series, indexed by Metrics_IdType
+ */
+const Metrics_SeriesConfigType Metrics_SeriesConfig[METRICS_NUM_SERIES] = {
+    /* Name, Help,
+       Type, Labels, Buckets, NumBuckets */
+    { "flm_e2e_checks_total", "E2E Profile 01 check results of the light switch frame",
+      METRICS_TYPE_COUNTER, "status=\"OK\"", NULL_PTR, 0U },
+    { "flm_e2e_checks_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "status=\"NONEWDATA\"", NULL_PTR, 0U },
+    { "flm_e2e_checks_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "status=\"WRONGCRC\"", NULL_PTR, 0U },
+    { "flm_e2e_checks_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "status=\"SYNC\"", NULL_PTR, 0U },
+    { "flm_e2e_checks_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "status=\"INITIAL\"", NULL_PTR, 0U },
+    { "flm_e2e_checks_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "status=\"REPEATED\"", NULL_PTR, 0U },
+    { "flm_e2e_checks_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "status=\"OKSOMELOST\"", NULL_PTR, 0U },
+    { "flm_e2e_checks_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "status=\"WRONGSEQUENCE\"", NULL_PTR, 0U },
+
+    { "flm_e2e_sm_dwell_ms_total", "Time of the light switch E2E state machine in each state",
+      METRICS_TYPE_COUNTER, "state=\"VALID\"", NULL_PTR, 0U },
+    { "flm_e2e_sm_dwell_ms_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "state=\"DEINIT\"", NULL_PTR, 0U },
+    { "flm_e2e_sm_dwell_ms_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "state=\"NODATA\"", NULL_PTR, 0U },
+    { "flm_e2e_sm_dwell_ms_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "state=\"INIT\"", NULL_PTR, 0U },
+    { "flm_e2e_sm_dwell_ms_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "state=\"INVALID\"", NULL_PTR, 0U },
+
+    { "flm_dem_event_transitions_total", "Dem test failed transitions per event",
+      METRICS_TYPE_COUNTER, "event=\"E2E_LIGHTSWITCH_FAILED\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"E2E_LIGHTSWITCH_FAILED\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"AMBIENTLIGHT_OPEN_CIRCUIT\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"AMBIENTLIGHT_OPEN_CIRCUIT\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"AMBIENTLIGHT_SHORT_CIRCUIT\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"AMBIENTLIGHT_SHORT_CIRCUIT\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"AMBIENTLIGHT_PLAUSIBILITY\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"AMBIENTLIGHT_PLAUSIBILITY\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"HEADLIGHT_OPEN_LOAD\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"HEADLIGHT_OPEN_LOAD\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"HEADLIGHT_SHORT_CIRCUIT\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"HEADLIGHT_SHORT_CIRCUIT\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"CAN_TIMEOUT\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"CAN_TIMEOUT\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"WDGM_SUPERVISION_FAILED\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"WDGM_SUPERVISION_FAILED\",to=\"passed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"SAFE_STATE_ENTERED\",to=\"failed\"", NULL_PTR, 0U },
+    { "flm_dem_event_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "event=\"SAFE_STATE_ENTERED\",to=\"passed\"", NULL_PTR, 0U },
+
+    { "flm_wdgm_failed_cycles_total", "Failed supervision cycles per supervised entity",
+      METRICS_TYPE_COUNTER, "entity=\"SwitchEvent\"", NULL_PTR, 0U },
+    { "flm_wdgm_failed_cycles_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "entity=\"LightRequest\"", NULL_PTR, 0U },
+    { "flm_wdgm_failed_cycles_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "entity=\"FLM\"", NULL_PTR, 0U },
+    { "flm_wdgm_failed_cycles_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "entity=\"Headlight\"", NULL_PTR, 0U },
+    { "flm_wdgm_failed_cycles_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "entity=\"SafetyMonitor\"", NULL_PTR, 0U },
+
+    { "flm_state_dwell_ms_total", "Time of the FLM state machine in each state",
+      METRICS_TYPE_COUNTER, "state=\"INIT\"", NULL_PTR, 0U },
+    { "flm_state_dwell_ms_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "state=\"NORMAL\"", NULL_PTR, 0U },
+    { "flm_state_dwell_ms_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "state=\"DEGRADED\"", NULL_PTR, 0U },
+    { "flm_state_dwell_ms_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "state=\"SAFE\"", NULL_PTR, 0U },
+
+    { "flm_state", "Current FLM state (0 INIT, 1 NORMAL, 2 DEGRADED, 3 SAFE)",
+      METRICS_TYPE_GAUGE, NULL_PTR, NULL_PTR, 0U },
+
+    { "flm_state_visit_ms", "Duration of completed FLM state visits",
+      METRICS_TYPE_HISTOGRAM, NULL_PTR,
+      Metrics_StateVisitBucketsMs,
+      static_cast<uint8_t>(sizeof(Metrics_StateVisitBucketsMs) / sizeof(Metrics_StateVisitBucketsMs[0])) },
+
+    { "flm_state_transitions_total", "FLM state machine transitions taken (coverage)",
+      METRICS_TYPE_COUNTER, "transition=\"INIT_SAFE_REQUEST\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"INIT_NORMAL\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"NORMAL_SAFE_REQUEST\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"NORMAL_SAFE_E2E_TIMEOUT\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"NORMAL_DEGRADED\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"DEGRADED_SAFE_REQUEST\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"DEGRADED_NORMAL\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"DEGRADED_SAFE_E2E_TIMEOUT\"", NULL_PTR, 0U },
+    { "flm_state_transitions_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "transition=\"DEGRADED_SAFE_TIMEOUT\"", NULL_PTR, 0U },
+
+    { "flm_safe_state_entries_total", "Safe state entries per reason",
+      METRICS_TYPE_COUNTER, "reason=\"NONE\"", NULL_PTR, 0U },
+    { "flm_safe_state_entries_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "reason=\"E2E_FAILURE\"", NULL_PTR, 0U },
+    { "flm_safe_state_entries_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "reason=\"WDGM_FAILURE\"", NULL_PTR, 0U },
+    { "flm_safe_state_entries_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "reason=\"MULTI_FAULT\"", NULL_PTR, 0U },
+    { "flm_safe_state_entries_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "reason=\"TIMEOUT\"", NULL_PTR, 0U },
+    { "flm_safe_state_entries_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "reason=\"MANUAL\"", NULL_PTR, 0U },
+
+    { "flm_can_frames_total", "CAN driver frames",
+      METRICS_TYPE_COUNTER, "direction=\"rx\"", NULL_PTR, 0U },
+    { "flm_can_frames_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "direction=\"tx\"", NULL_PTR, 0U },
+
+    { "flm_can_dropped_frames_total", "CAN frames lost to a full RX FIFO or TX buffer",
+      METRICS_TYPE_COUNTER, "direction=\"rx\"", NULL_PTR, 0U },
+    { "flm_can_dropped_frames_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "direction=\"tx\"", NULL_PTR, 0U },
+
+    { "flm_com_rx_pdus_total", "Received I-PDUs",
+      METRICS_TYPE_COUNTER, "result=\"accepted\"", NULL_PTR, 0U },
+    { "flm_com_rx_pdus_total", NULL_PTR,
+      METRICS_TYPE_COUNTER, "result=\"discarded\"", NULL_PTR, 0U }
+};
@@ -0,0 +1,163 @@
+/**
+ * @file Metrics_Cfg.h
+ * @brief Metrics Configuration
+ * @details Series IDs, registry dimensions and export defaults of the
+ *          metrics registry
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef METRICS_CFG_H
+#define METRICS_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Dem_Cfg.h"
+#include "WdgM_Cfg.h"
+#include "FLM_Cfg.h"
+
+/*============================================================================*
+ * METRICS GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Threads with their own counter shard (further threads share the last) */
+#define METRICS_MAX_THREADS                 8U
+
+/** @brief Counter slots per shard (counters: 1, histograms: buckets + 2) */
+#define METRICS_MAX_SLOTS                   128U
+
+/** @brief Maximum finite buckets of a histogram */
+#define METRICS_MAX_BUCKETS                 12U
+
+/** @brief Size of the Prometheus text exposition buffer */
+#define METRICS_TEXT_BUFFER_SIZE            32768U
+
+/*============================================================================*
+ * EXPORT CONFIGURATION
+ *============================================================================*/
+
+/** @brief Default loopback HTTP port (Prometheus exporter range) */
+#define METRICS_DEFAULT_HTTP_PORT           9464U
+
+/** @brief Default period of the file dump (ms) */
+#define METRICS_DEFAULT_DUMP_PERIOD_MS      1000U
+
+/** @brief Poll period of the export thread (ms), bounds the stop latency */
+#define METRICS_EXPORT_POLL_MS              50U
+
+/** @brief Receive timeout for a scrape request (ms) */
+#define METRICS_HTTP_RECV_TIMEOUT_MS        200U
+
+/** @brief Maximum scrape request size */
+#define METRICS_HTTP_REQUEST_SIZE           1024U
+
+/*============================================================================*
+ * SERIES IDS
+ *============================================================================*/
+
+/** @brief E2E check results, one per E2E_P01CheckStatusType */
+#define METRICS_E2E_STATUS_BASE             0U
+#define METRICS_E2E_STATUS_COUNT            8U
+#define METRICS_E2E_STATUS(status) \
+    static_cast<Metrics_IdType>(METRICS_E2E_STATUS_BASE + static_cast<uint32_t>(status))
+
+/** @brief Time in each E2E_SMStateType (ms) */
+#define METRICS_E2E_SM_DWELL_BASE           (METRICS_E2E_STATUS_BASE + METRICS_E2E_STATUS_COUNT)
+#define METRICS_E2E_SM_DWELL_COUNT          5U
+#define METRICS_E2E_SM_DWELL(smState) \
+    static_cast<Metrics_IdType>(METRICS_E2E_SM_DWELL_BASE + static_cast<uint32_t>(smState))
+
+/** @brief Test failed transitions per Dem event (events 1..DEM_EVENT_MAX-1) */
+#define METRICS_DEM_TRANSITION_BASE         (METRICS_E2E_SM_DWELL_BASE + METRICS_E2E_SM_DWELL_COUNT)
+#define METRICS_DEM_TRANSITION_COUNT        (2U * (DEM_EVENT_MAX - 1U))
+#define METRICS_DEM_TRANSITION(eventId, failed) \
+    static_cast<Metrics_IdType>(METRICS_DEM_TRANSITION_BASE + \
+                                (2U * (static_cast<uint32_t>(eventId) - 1U)) + ((failed) ? 0U : 1U))
+
+/** @brief Failed supervision cycles per supervised entity */
+#define METRICS_WDGM_FAILED_BASE            (METRICS_DEM_TRANSITION_BASE + METRICS_DEM_TRANSITION_COUNT)
+#define METRICS_WDGM_FAILED_COUNT           WDGM_NUM_SUPERVISED_ENTITIES
+#define METRICS_WDGM_FAILED(entityIndex) \
+    static_cast<Metrics_IdType>(METRICS_WDGM_FAILED_BASE + static_cast<uint32_t>(entityIndex))
+
+/** @brief Time in each FLM_StateType (ms) */
+#define METRICS_FLM_DWELL_BASE              (METRICS_WDGM_FAILED_BASE + METRICS_WDGM_FAILED_COUNT)
+#define METRICS_FLM_DWELL_COUNT             4U
+#define METRICS_FLM_DWELL(state) \
+    static_cast<Metrics_IdType>(METRICS_FLM_DWELL_BASE + static_cast<uint32_t>(state))
+
+/** @brief Current FLM state (gauge) */
+#define METRICS_FLM_STATE                   (METRICS_FLM_DWELL_BASE + METRICS_FLM_DWELL_COUNT)
+
+/** @brief Duration of completed FLM state visits (ms, histogram) */
+#define METRICS_FLM_STATE_VISIT             (METRICS_FLM_STATE + 1U)
+
+/** @brief Taken FLM state machine transitions per FLM_TransitionIdType */
+#define METRICS_FLM_TRANSITION_BASE         (METRICS_FLM_STATE_VISIT + 1U)
+#define METRICS_FLM_TRANSITION_COUNT        FLM_NUM_TRANSITIONS
+#define METRICS_FLM_TRANSITION(transitionId) \
+    static_cast<Metrics_IdType>(METRICS_FLM_TRANSITION_BASE + static_cast<uint32_t>(transitionId))
+
+/** @brief Safe state entries per SafeStateReason */
+#define METRICS_SAFE_STATE_BASE             (METRICS_FLM_TRANSITION_BASE + METRICS_FLM_TRANSITION_COUNT)
+#define METRICS_SAFE_STATE_COUNT            6U
+#define METRICS_SAFE_STATE(reason) \
+    static_cast<Metrics_IdType>(METRICS_SAFE_STATE_BASE + static_cast<uint32_t>(reason))
+
+/** @brief CAN driver frames */
+#define METRICS_CAN_RX                      (METRICS_SAFE_STATE_BASE + METRICS_SAFE_STATE_COUNT)
+#define METRICS_CAN_TX                      (METRICS_CAN_RX + 1U)
+#define METRICS_CAN_RX_DROPPED              (METRICS_CAN_RX + 2U)
+#define METRICS_CAN_TX_DROPPED              (METRICS_CAN_RX + 3U)
+
+/** @brief COM received I-PDUs */
+#define METRICS_COM_RX_ACCEPTED             (METRICS_CAN_RX + 4U)
+#define METRICS_COM_RX_DISCARDED            (METRICS_CAN_RX + 5U)
+
+/** @brief Number of series */
+#define METRICS_NUM_SERIES                  (METRICS_COM_RX_DISCARDED + 1U)
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Series ID
+ */
+typedef uint16_t Metrics_IdType;
+
+/**
+ * @brief Metric types
+ */
+typedef enum {
+    METRICS_TYPE_COUNTER    = 0x00U,    /**< Monotonic, per-thread shards */
+    METRICS_TYPE_GAUGE      = 0x01U,    /**< Last value */
+    METRICS_TYPE_HISTOGRAM  = 0x02U     /**< Bucket counts and sum, per-thread shards */
+} Metrics_TypeType;
+
+/**
+ * @brief Series configuration
+ * @details Consecutive series with the same name form one metric family;
+ *          HELP and TYPE are taken from its first series
+ */
+typedef struct {
+    const char* Name;                   /**< Metric family name */
+    const char* Help;                   /**< Description (first series of a family) */
+    Metrics_TypeType Type;              /**< Metric type */
+    const char* Labels;                 /**< Label set, e.g. status="OK" (NULL_PTR = none) */
+    const uint64_t* Buckets;            /**< Histogram upper bounds, ascending */
+    uint8_t NumBuckets;                 /**< Histogram finite buckets */
+} Metrics_SeriesConfigType;
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Series, indexed by Metrics_IdType */
+extern const Metrics_SeriesConfigType Metrics_SeriesConfig[METRICS_NUM_SERIES];
+
+#endif /* METRICS_CFG_H */
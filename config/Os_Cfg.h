@@ -0,0 +1,78 @@
+/**
+ * @file Os_Cfg.h
+ * @brief Operating System Configuration
+ * @details Limits, spinlocks and the task mapping defaults of the FLM ECU
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef OS_CFG_H
+#define OS_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/*============================================================================*
+ * OS GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Maximum number of tasks */
+#define OS_MAX_TASKS                        8U
+
+/** @brief Interval of the Os_Tick calls (ms) */
+#define OS_TICK_MS                          FLM_SYSTEM_TICK_MS
+
+/** @brief Core ID of a task that is not pinned */
+#define OS_CORE_ANY                         (-1)
+
+/*============================================================================*
+ * SPINLOCK CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Spinlock ID type
+ */
+typedef uint8_t Os_SpinlockIdType;
+
+/** @brief WdgM checkpoint and supervision data (all tasks) */
+#define OS_SPINLOCK_WDGM                    0U
+
+/** @brief Com, Can and Dem state shared by BswM actions and the COM main functions */
+#define OS_SPINLOCK_COMSTACK                1U
+
+/** @brief Number of spinlocks */
+#define OS_NUM_SPINLOCKS                    2U
+
+/*============================================================================*
+ * FLM TASK CONFIGURATION
+ *============================================================================*/
+
+/** @brief Task IDs of the FLM ECU (priority order) */
+#define OS_TASK_5MS                         0U
+#define OS_TASK_10MS                        1U
+#define OS_TASK_20MS                        2U
+
+/** @brief Number of FLM tasks */
+#define OS_NUM_FLM_TASKS                    3U
+
+/** @brief Task periods (ms) */
+#define OS_TASK_5MS_PERIOD_MS               FLM_SAFETY_MONITOR_PERIOD_MS
+#define OS_TASK_10MS_PERIOD_MS              FLM_MAIN_FUNCTION_PERIOD_MS
+#define OS_TASK_20MS_PERIOD_MS              FLM_AMBIENT_LIGHT_PERIOD_MS
+
+/** @brief SCHED_FIFO priorities, rate monotonic (0 = default policy) */
+#define OS_TASK_5MS_PRIORITY                30U
+#define OS_TASK_10MS_PRIORITY               20U
+#define OS_TASK_20MS_PRIORITY               10U
+
+/** @brief Default cores of the multi-core mapping (--multicore overrides) */
+#define OS_TASK_5MS_CORE                    0
+#define OS_TASK_10MS_CORE                   1
+#define OS_TASK_20MS_CORE                   2
+
+#endif /* OS_CFG_H */
@@ -0,0 +1,109 @@
+/**
+ * @file Stimulus_Cfg.cpp
+ * @brief Stimulus Engine Configuration Data
+ * @details Named ambient light scenarios (--scenario <name>)
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Stimulus_Cfg.h"
+#include "Sim/Stimulus/Stimulus.h"
+
+/*============================================================================*
+ * SEGMENT CONFIGURATION DATA
+ *============================================================================*/
+
+/* Shape, DurationMs, From, To, ParamMs */
+
+/** @brief Demo: 1500..2400 in steps of 100 every 100ms, then 1s dark */
+static const Stimulus_SegmentConfigType Stimulus_DemoSegments[] = {
+    { STIMULUS_SHAPE_HOLD, 100U, 1500.0f, 1500.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 1600.0f, 1600.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 1700.0f, 1700.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 1800.0f, 1800.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 1900.0f, 1900.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 2000.0f, 2000.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 2100.0f, 2100.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 2200.0f, 2200.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 2300.0f, 2300.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 100U, 2400.0f, 2400.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 1000U, 500.0f, 500.0f, 0U }
+};
+
+/** @brief Dusk: one minute from daylight to night */
+static const Stimulus_SegmentConfigType Stimulus_DuskSegments[] = {
+    { STIMULUS_SHAPE_HOLD, 2000U, 2500.0f, 2500.0f, 0U },
+    { STIMULUS_SHAPE_SCURVE, 60000U, 2500.0f, 300.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 5000U, 300.0f, 300.0f, 0U }
+};
+
+/** @brief Dawn: one minute from night to daylight */
+static const Stimulus_SegmentConfigType Stimulus_DawnSegments[] = {
+    { STIMULUS_SHAPE_HOLD, 2000U, 300.0f, 300.0f, 0U },
+    { STIMULUS_SHAPE_SCURVE, 60000U, 300.0f, 2500.0f, 0U },
+    { STIMULUS_SHAPE_HOLD, 5000U, 2500.0f, 2500.0f, 0U }
+};
+
+/** @brief Tunnel: long tunnel, daylight, short underpass */
+static const Stimulus_SegmentConfigType Stimulus_TunnelSegments[] = {
+    { STIMULUS_SHAPE_HOLD, 3000U, 2800.0f, 2800.0f, 0U },
+    { STIMULUS_SHAPE_TUNNEL, 8000U, 2800.0f, 400.0f, 300U },
+    { STIMULUS_SHAPE_HOLD, 4000U, 2800.0f, 2800.0f, 0U },
+    { STIMULUS_SHAPE_TUNNEL, 3000U, 2800.0f, 600.0f, 200U }
+};
+
+/** @brief Flicker: alley of trees, then buildings in the evening */
+static const Stimulus_SegmentConfigType Stimulus_FlickerSegments[] = {
+    { STIMULUS_SHAPE_HOLD, 1000U, 1800.0f, 1800.0f, 0U },
+    { STIMULUS_SHAPE_FLICKER, 10000U, 1800.0f, 700.0f, 250U },
+    { STIMULUS_SHAPE_RAMP, 2000U, 1800.0f, 1200.0f, 0U },
+    { STIMULUS_SHAPE_FLICKER, 8000U, 1200.0f, 400.0f, 120U }
+};
+
+/*============================================================================*
+ * TRACK CONFIGURATION DATA
+ *============================================================================*/
+
+#define STIMULUS_AMBIENT_TRACK(segments, loop, noise, seed) \
+    { STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, (loop), (noise), (seed), \
+      (segments), static_cast<uint8_t>(sizeof(segments) / sizeof((segments)[0])) }
+
+static const Stimulus_TrackConfigType Stimulus_DemoTracks[] = {
+    STIMULUS_AMBIENT_TRACK(Stimulus_DemoSegments, TRUE, 0U, 0U)
+};
+
+static const Stimulus_TrackConfigType Stimulus_DuskTracks[] = {
+    STIMULUS_AMBIENT_TRACK(Stimulus_DuskSegments, FALSE, 20U, 0x1001U)
+};
+
+static const Stimulus_TrackConfigType Stimulus_DawnTracks[] = {
+    STIMULUS_AMBIENT_TRACK(Stimulus_DawnSegments, FALSE, 20U, 0x1002U)
+};
+
+static const Stimulus_TrackConfigType Stimulus_TunnelTracks[] = {
+    STIMULUS_AMBIENT_TRACK(Stimulus_TunnelSegments, TRUE, 30U, 0x1003U)
+};
+
+static const Stimulus_TrackConfigType Stimulus_FlickerTracks[] = {
+    STIMULUS_AMBIENT_TRACK(Stimulus_FlickerSegments, TRUE, 40U, 0x1004U)
+};
+
+/*============================================================================*
+ * SCENARIO CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Scenarios, indexed by scenario ID
+ */
+const Stimulus_ScenarioConfigType Stimulus_ScenarioConfig[STIMULUS_NUM_SCENARIOS] = {
+    { "demo", "Ambient steps 1500..2400, dark every other second", Stimulus_DemoTracks, 1U },
+    { "dusk", "Daylight fading to night within one minute", Stimulus_DuskTracks, 1U },
+    { "dawn", "Night brightening to daylight within one minute", Stimulus_DawnTracks, 1U },
+    { "tunnel", "Tunnel entries and exits from daylight", Stimulus_TunnelTracks, 1U },
+    { "flicker", "Shadows of trees and buildings", Stimulus_FlickerTracks, 1U }
+};
@@ -0,0 +1,84 @@
+/**
+ * @file Stimulus_Cfg.h
+ * @brief Stimulus Engine Configuration
+ * @details Pool sizes of the waveform tracks and the named ambient light
+ *          scenarios played into the simulated ADC and DIO channels
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef STIMULUS_CFG_H
+#define STIMULUS_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/*============================================================================*
+ * STIMULUS GENERAL CONFIGURATION
+ *============================================================================*/
+
+/** @brief Maximum number of tracks (one per stimulated channel) */
+#define STIMULUS_MAX_TRACKS                 8U
+
+/** @brief Maximum number of segments per track */
+#define STIMULUS_MAX_TRACK_SEGMENTS         64U
+
+/** @brief Table points shared by all recorded (CSV) segments */
+#define STIMULUS_MAX_TABLE_POINTS           8192U
+
+/** @brief Samples computed per generator pass */
+#define STIMULUS_BLOCK_SAMPLES              256U
+
+/** @brief Maximum CSV line length */
+#define STIMULUS_CSV_LINE_LENGTH            128U
+
+/*============================================================================*
+ * RANDOM AMBIENT SCENARIOS
+ *============================================================================*/
+
+/** @brief Darkest ambient level (kept clear of the open circuit threshold) */
+#define STIMULUS_RANDOM_MIN_LEVEL           300U
+
+/** @brief Brightest ambient level (kept clear of the short circuit threshold) */
+#define STIMULUS_RANDOM_MAX_LEVEL           3500U
+
+/** @brief Largest sensor noise amplitude (peak, ADC counts) */
+#define STIMULUS_RANDOM_MAX_NOISE           100U
+
+/** @brief Shortest segment of a random scenario (ms) */
+#define STIMULUS_RANDOM_MIN_SEGMENT_MS      200U
+
+/** @brief Longest segment of a random scenario (ms) */
+#define STIMULUS_RANDOM_MAX_SEGMENT_MS      5000U
+
+/*============================================================================*
+ * SCENARIO CONFIGURATION
+ *============================================================================*/
+
+/** @brief Ambient pattern of the demo (steps, dark phase every other second) */
+#define STIMULUS_SCENARIO_DEMO              0U
+
+/** @brief Dusk: daylight fading to night on an S-curve */
+#define STIMULUS_SCENARIO_DUSK              1U
+
+/** @brief Dawn: night brightening to daylight on an S-curve */
+#define STIMULUS_SCENARIO_DAWN              2U
+
+/** @brief Tunnel entries and exits from daylight */
+#define STIMULUS_SCENARIO_TUNNEL            3U
+
+/** @brief Shadows of trees and buildings flickering over the sensor */
+#define STIMULUS_SCENARIO_FLICKER           4U
+
+/** @brief Number of configured scenarios */
+#define STIMULUS_NUM_SCENARIOS              5U
+
+/** @brief Default scenario of the application */
+#define STIMULUS_DEFAULT_SCENARIO           "demo"
+
+#endif /* STIMULUS_CFG_H */
@@ -0,0 +1,37 @@
+/**
+ * @file Trace_Cfg.cpp
+ * @brief Trace Configuration Data
+ * @details Names of the traced runnables as shown in the timeline
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Trace_Cfg.h"
+
+/*============================================================================*
+ * RUNNABLE CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Runnable names, indexed by Trace_RunnableIdType
+ */
+const char* const Trace_RunnableNames[TRACE_NUM_RUNNABLES] = {
+    "SwitchEvent_MainFunction",
+    "LightRequest_MainFunction",
+    "FLM_MainFunction",
+    "Headlight_MainFunction",
+    "SafetyMonitor_MainFunction",
+    "WdgM_MainFunction",
+    "BswM_MainFunction",
+    "Com_MainFunctionRx",
+    "Com_MainFunctionTx",
+    "Dem_MainFunction",
+    "Adc_MainFunction",
+    "Can_MainFunction_Read",
+    "Can_MainFunction_Write"
+};
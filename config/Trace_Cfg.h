@@ -0,0 +1,79 @@
+/**
+ * @file Trace_Cfg.h
+ * @brief Trace Configuration
+ * @details Compile-time switch, ring dimensions and runnable IDs of the
+ *          trace facility
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef TRACE_CFG_H
+#define TRACE_CFG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+
+/*============================================================================*
+ * TRACE GENERAL CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Enable trace points
+ * @details With STD_OFF every trace point compiles to nothing, including the
+ *          evaluation of its arguments. Set from the build (ENABLE_TRACE).
+ */
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED                       STD_ON
+#endif
+
+/** @brief Maximum threads with their own ring */
+#define TRACE_MAX_THREADS                   8U
+
+/** @brief Records per ring (power of two), a full drain period at simulation speed */
+#define TRACE_RING_SIZE                     16384U
+
+/** @brief Period of the background drainer (ms) */
+#define TRACE_DRAIN_PERIOD_MS               10U
+
+/** @brief Maximum thread name length including the terminator */
+#define TRACE_THREAD_NAME_LENGTH            16U
+
+STD_STATIC_ASSERT((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1U)) == 0U,
+                  "Trace ring size must be a power of two");
+
+/*============================================================================*
+ * RUNNABLE IDS
+ *============================================================================*/
+
+/**
+ * @brief Traced main functions
+ */
+typedef enum {
+    TRACE_RUNNABLE_SWITCHEVENT      = 0x00U,    /**< SwitchEvent_MainFunction */
+    TRACE_RUNNABLE_LIGHTREQUEST     = 0x01U,    /**< LightRequest_MainFunction */
+    TRACE_RUNNABLE_FLM              = 0x02U,    /**< FLM_MainFunction */
+    TRACE_RUNNABLE_HEADLIGHT        = 0x03U,    /**< Headlight_MainFunction */
+    TRACE_RUNNABLE_SAFETYMONITOR    = 0x04U,    /**< SafetyMonitor_MainFunction */
+    TRACE_RUNNABLE_WDGM             = 0x05U,    /**< WdgM_MainFunction */
+    TRACE_RUNNABLE_BSWM             = 0x06U,    /**< BswM_MainFunction */
+    TRACE_RUNNABLE_COM_RX           = 0x07U,    /**< Com_MainFunctionRx */
+    TRACE_RUNNABLE_COM_TX           = 0x08U,    /**< Com_MainFunctionTx */
+    TRACE_RUNNABLE_DEM              = 0x09U,    /**< Dem_MainFunction */
+    TRACE_RUNNABLE_ADC              = 0x0AU,    /**< Adc_MainFunction */
+    TRACE_RUNNABLE_CAN_READ         = 0x0BU,    /**< Can_MainFunction_Read */
+    TRACE_RUNNABLE_CAN_WRITE        = 0x0CU,    /**< Can_MainFunction_Write */
+    TRACE_NUM_RUNNABLES             = 0x0DU
+} Trace_RunnableIdType;
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Runnable names, indexed by Trace_RunnableIdType */
+extern const char* const Trace_RunnableNames[TRACE_NUM_RUNNABLES];
+
+#endif /* TRACE_CFG_H */
@@ -0,0 +1,119 @@
+/**
+ * @file WdgM_Cfg.cpp
+ * @brief Watchdog Manager Configuration Data
+ * @details Supervised entity, alive, deadline and logical supervision tables
+ *          for the FLM software components
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety ASIL B - [SysSafReq03] Watchdog supervision
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "WdgM_Cfg.h"
+
+/*============================================================================*
+ * SUPERVISED ENTITY CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Supervised entity configurations
+ * @details Indexed by (SEId - 1)
+ */
+const WdgM_SupervisedEntityConfigType WdgM_SEConfig[WDGM_NUM_SUPERVISED_ENTITIES] = {
+    { WDGM_SE_SWITCHEVENT,   TRUE, FALSE, TRUE, WDGM_FAILED_REFERENCE_CYCLES, WDGM_LOCAL_STATUS_OK, "SwitchEvent" },
+    { WDGM_SE_LIGHTREQUEST,  TRUE, FALSE, TRUE, WDGM_FAILED_REFERENCE_CYCLES, WDGM_LOCAL_STATUS_OK, "LightRequest" },
+    { WDGM_SE_FLM,           TRUE, TRUE,  TRUE, WDGM_FAILED_REFERENCE_CYCLES, WDGM_LOCAL_STATUS_OK, "FLM" },
+    { WDGM_SE_HEADLIGHT,     TRUE, TRUE,  TRUE, WDGM_FAILED_REFERENCE_CYCLES, WDGM_LOCAL_STATUS_OK, "Headlight" },
+    { WDGM_SE_SAFETYMONITOR, TRUE, TRUE,  TRUE, WDGM_FAILED_REFERENCE_CYCLES, WDGM_LOCAL_STATUS_OK, "SafetyMonitor" }
+};
+
+/*============================================================================*
+ * ALIVE SUPERVISION CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Alive supervision configurations
+ * @details Indexed by (SEId - 1). The entry checkpoint of each main function
+ *          is counted as the alive indication.
+ */
+const WdgM_AliveSupervisionConfigType WdgM_AliveConfig[WDGM_NUM_SUPERVISED_ENTITIES] = {
+    { WDGM_SE_SWITCHEVENT,   WDGM_CP_SWITCHEVENT_ENTRY,   WDGM_SWITCHEVENT_EXPECTED_ALIVE,
+      WDGM_DEFAULT_MIN_MARGIN, WDGM_DEFAULT_MAX_MARGIN, WDGM_ALIVE_REFERENCE_CYCLE },
+    { WDGM_SE_LIGHTREQUEST,  WDGM_CP_LIGHTREQUEST_ENTRY,  WDGM_LIGHTREQUEST_EXPECTED_ALIVE,
+      WDGM_DEFAULT_MIN_MARGIN, WDGM_DEFAULT_MAX_MARGIN, WDGM_ALIVE_REFERENCE_CYCLE },
+    { WDGM_SE_FLM,           WDGM_CP_FLM_ENTRY,           WDGM_FLM_EXPECTED_ALIVE,
+      WDGM_DEFAULT_MIN_MARGIN, WDGM_DEFAULT_MAX_MARGIN, WDGM_ALIVE_REFERENCE_CYCLE },
+    { WDGM_SE_HEADLIGHT,     WDGM_CP_HEADLIGHT_ENTRY,     WDGM_HEADLIGHT_EXPECTED_ALIVE,
+      WDGM_DEFAULT_MIN_MARGIN, WDGM_DEFAULT_MAX_MARGIN, WDGM_ALIVE_REFERENCE_CYCLE },
+    { WDGM_SE_SAFETYMONITOR, WDGM_CP_SAFETYMONITOR_ENTRY, WDGM_SAFETYMONITOR_EXPECTED_ALIVE,
+      WDGM_DEFAULT_MIN_MARGIN, WDGM_DEFAULT_MAX_MARGIN, WDGM_ALIVE_REFERENCE_CYCLE }
+};
+
+/*============================================================================*
+ * DEADLINE SUPERVISION CONFIGURATION DATA
+ *============================================================================*/
+
+/**
+ * @brief Deadline supervision configurations
+ * @details Main function execution time from entry to exit checkpoint
+ */
+const WdgM_DeadlineSupervisionConfigType WdgM_DeadlineConfig[WDGM_NUM_DEADLINE_SUPERVISIONS] = {
+    { WDGM_SE_FLM,           WDGM_CP_FLM_ENTRY,           WDGM_CP_FLM_EXIT,
+      WDGM_DEFAULT_DEADLINE_MIN_US, WDGM_FLM_DEADLINE_MAX_US },
+    { WDGM_SE_HEADLIGHT,     WDGM_CP_HEADLIGHT_ENTRY,     WDGM_CP_HEADLIGHT_EXIT,
+      WDGM_DEFAULT_DEADLINE_MIN_US, WDGM_HEADLIGHT_DEADLINE_MAX_US },
+    { WDGM_SE_SAFETYMONITOR, WDGM_CP_SAFETYMONITOR_ENTRY, WDGM_CP_SAFETYMONITOR_EXIT,
+      WDGM_DEFAULT_DEADLINE_MIN_US, WDGM_SAFETYMONITOR_DEADLINE_MAX_US }
+};
+
+/*============================================================================*
+ * LOGICAL SUPERVISION CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief SwitchEvent program flow: ENTRY -> EXIT */
+static const WdgM_LogicalTransitionType WdgM_SwitchEventTransitions[] = {
+    { WDGM_CP_SWITCHEVENT_ENTRY, WDGM_CP_SWITCHEVENT_EXIT }
+};
+
+/** @brief LightRequest program flow: ENTRY -> EXIT */
+static const WdgM_LogicalTransitionType WdgM_LightRequestTransitions[] = {
+    { WDGM_CP_LIGHTREQUEST_ENTRY, WDGM_CP_LIGHTREQUEST_EXIT }
+};
+
+/** @brief FLM program flow: ENTRY -> STATEMACHINE -> EXIT */
+static const WdgM_LogicalTransitionType WdgM_FlmTransitions[] = {
+    { WDGM_CP_FLM_ENTRY,        WDGM_CP_FLM_STATEMACHINE },
+    { WDGM_CP_FLM_STATEMACHINE, WDGM_CP_FLM_EXIT }
+};
+
+/** @brief Headlight program flow: ENTRY -> EXIT */
+static const WdgM_LogicalTransitionType WdgM_HeadlightTransitions[] = {
+    { WDGM_CP_HEADLIGHT_ENTRY, WDGM_CP_HEADLIGHT_EXIT }
+};
+
+/** @brief SafetyMonitor program flow: ENTRY -> AGGREGATION -> EXIT */
+static const WdgM_LogicalTransitionType WdgM_SafetyMonitorTransitions[] = {
+    { WDGM_CP_SAFETYMONITOR_ENTRY,       WDGM_CP_SAFETYMONITOR_AGGREGATION },
+    { WDGM_CP_SAFETYMONITOR_AGGREGATION, WDGM_CP_SAFETYMONITOR_EXIT }
+};
+
+/**
+ * @brief Logical supervision configurations
+ */
+const WdgM_LogicalSupervisionConfigType WdgM_LogicalConfig[WDGM_NUM_LOGICAL_SUPERVISIONS] = {
+    { WDGM_SE_SWITCHEVENT,   WDGM_CP_SWITCHEVENT_ENTRY,   WDGM_CP_SWITCHEVENT_EXIT,
+      1U, WdgM_SwitchEventTransitions },
+    { WDGM_SE_LIGHTREQUEST,  WDGM_CP_LIGHTREQUEST_ENTRY,  WDGM_CP_LIGHTREQUEST_EXIT,
+      1U, WdgM_LightRequestTransitions },
+    { WDGM_SE_FLM,           WDGM_CP_FLM_ENTRY,           WDGM_CP_FLM_EXIT,
+      2U, WdgM_FlmTransitions },
+    { WDGM_SE_HEADLIGHT,     WDGM_CP_HEADLIGHT_ENTRY,     WDGM_CP_HEADLIGHT_EXIT,
+      1U, WdgM_HeadlightTransitions },
+    { WDGM_SE_SAFETYMONITOR, WDGM_CP_SAFETYMONITOR_ENTRY, WDGM_CP_SAFETYMONITOR_EXIT,
+      2U, WdgM_SafetyMonitorTransitions }
+};
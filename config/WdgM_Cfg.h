@@ -36,6 +36,15 @@
 /** @brief Enable immediate reset on failure */
 #define WDGM_IMMEDIATE_RESET                STD_OFF
 
+/** @brief Trigger the watchdog driver (Wdg) from WdgM_MainFunction */
+#define WDGM_WDG_TRIGGER_ENABLED            STD_ON
+
+/** @brief Watchdog trigger timeout (ms), several main function periods */
+#define WDGM_WDG_TRIGGER_TIMEOUT_MS         50U
+
+/** @brief Enable runnable execution time and jitter profiler */
+#define WDGM_PROFILER_ENABLED               STD_ON
+
 /** @brief WdgM main function period (ms) */
 #define WDGM_MAIN_FUNCTION_PERIOD_MS        FLM_WDGM_PERIOD_MS
 
@@ -116,6 +125,7 @@
  */
 typedef struct {
     WdgM_SupervisedEntityIdType SEId;   /**< Supervised entity ID */
+    WdgM_CheckpointIdType CheckpointId; /**< Checkpoint counted as alive indication */
     uint16_t ExpectedAliveIndications;  /**< Expected alive indications per cycle */
     uint16_t MinMargin;                 /**< Minimum margin (tolerance) */
     uint16_t MaxMargin;                 /**< Maximum margin (tolerance) */
@@ -147,6 +157,9 @@ typedef struct {
 /** @brief Default maximum margin */
 #define WDGM_DEFAULT_MAX_MARGIN             2U
 
+/** @brief Alive supervision reference cycle count */
+#define WDGM_ALIVE_REFERENCE_CYCLE          1U
+
 /*============================================================================*
  * DEADLINE SUPERVISION CONFIGURATION
  *============================================================================*/
@@ -175,6 +188,12 @@ typedef struct {
 /** @brief SafetyMonitor main function maximum deadline (microseconds) */
 #define WDGM_SAFETYMONITOR_DEADLINE_MAX_US  2000U   /* 2ms max execution */
 
+/** @brief Default minimum deadline (microseconds) */
+#define WDGM_DEFAULT_DEADLINE_MIN_US        0U
+
+/** @brief Number of configured deadline supervisions */
+#define WDGM_NUM_DEADLINE_SUPERVISIONS      3U
+
 /*============================================================================*
  * LOGICAL SUPERVISION CONFIGURATION
  *============================================================================*/
@@ -198,6 +217,9 @@ typedef struct {
     const WdgM_LogicalTransitionType* Transitions; /**< Valid transitions */
 } WdgM_LogicalSupervisionConfigType;
 
+/** @brief Number of configured logical supervision graphs */
+#define WDGM_NUM_LOGICAL_SUPERVISIONS       5U
+
 /*============================================================================*
  * MODE CONFIGURATION
  *============================================================================*/
@@ -241,6 +263,7 @@ typedef struct {
     boolean LogicalSupervisionEnabled;              /**< Logical supervision enabled */
     uint16_t FailedRefCycleCounter;                 /**< Failed cycles before expired */
     WdgM_LocalStatusType InitialStatus;             /**< Initial local status */
+    const char* Name;                               /**< Runnable name for reports */
 } WdgM_SupervisedEntityConfigType;
 
 /*============================================================================*
@@ -254,9 +277,9 @@ extern const WdgM_SupervisedEntityConfigType WdgM_SEConfig[WDGM_NUM_SUPERVISED_E
 extern const WdgM_AliveSupervisionConfigType WdgM_AliveConfig[WDGM_NUM_SUPERVISED_ENTITIES];
 
 /** @brief Deadline supervision configurations */
-extern const WdgM_DeadlineSupervisionConfigType WdgM_DeadlineConfig[];
+extern const WdgM_DeadlineSupervisionConfigType WdgM_DeadlineConfig[WDGM_NUM_DEADLINE_SUPERVISIONS];
 
 /** @brief Logical supervision configurations */
-extern const WdgM_LogicalSupervisionConfigType WdgM_LogicalConfig[];
+extern const WdgM_LogicalSupervisionConfigType WdgM_LogicalConfig[WDGM_NUM_LOGICAL_SUPERVISIONS];
 
 #endif /* WDGM_CFG_H */
@@ -0,0 +1,111 @@
+/**
+ * @file Rte.h
+ * @brief RTE Lifecycle and Sender/Receiver Port Buffers
+ * @details Every sender/receiver port between the SWCs is a double-buffered
+ *          slot with a publish sequence:
+ *          - The sender fills the inactive buffer and publishes it with one
+ *            atomic increment of the sequence (index flip: the published
+ *            buffer is sequence & 1)
+ *          - Receivers get a const pointer to the published buffer without
+ *            copying (Rte_IRead_*). The buffer is written again only after
+ *            the sender has published once more, so the snapshot stays
+ *            consistent for one sender period.
+ *          - The sequence doubles as a seqlock: a receiver whose snapshot
+ *            may outlive a sender period checks Rte_GetPortSequence after
+ *            use; while it is unchanged the snapshot was not overwritten
+ *          One sender per port, any number of receivers, no locks.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef RTE_H
+#define RTE_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Rte_Type.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define RTE_SW_MAJOR_VERSION                1
+#define RTE_SW_MINOR_VERSION                0
+#define RTE_SW_PATCH_VERSION                0
+
+/*============================================================================*
+ * PORT CONFIGURATION
+ *============================================================================*/
+
+/**
+ * @brief Sender/receiver port ID
+ */
+typedef uint8_t Rte_PortIdType;
+
+/** @brief SwitchEvent -> FLM, SafetyMonitor: validated light switch */
+#define RTE_PORT_LIGHTSWITCH                0U
+
+/** @brief LightRequest -> FLM, SafetyMonitor: ambient light level */
+#define RTE_PORT_AMBIENTLIGHT               1U
+
+/** @brief FLM -> Headlight, SafetyMonitor: headlight command and FLM state */
+#define RTE_PORT_HEADLIGHTCMD               2U
+
+/** @brief Headlight -> SafetyMonitor: output stage status */
+#define RTE_PORT_HEADLIGHTSTATUS            3U
+
+/** @brief SafetyMonitor -> FLM: global safety status */
+#define RTE_PORT_SAFETYSTATUS               4U
+
+/** @brief Number of sender/receiver ports */
+#define RTE_NUM_PORTS                       5U
+
+/**
+ * @brief Port buffers and publish sequences (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    Rte_IrvLightSwitchType LightSwitch[2];
+    Rte_IrvAmbientLightType AmbientLight[2];
+    Rte_IrvHeadlightCmdType HeadlightCmd[2];
+    Rte_IrvHeadlightStatusType HeadlightStatus[2];
+    Rte_IrvSafetyStatusType SafetyStatus[2];
+    uint32_t PortSequence[RTE_NUM_PORTS];
+} Rte_SnapshotType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Start the RTE
+ * @details Fills both buffers of every port with its initial value and
+ *          resets the publish sequences. Call before the SWC init runnables,
+ *          which publish their own initial outputs.
+ */
+void Rte_Start(void);
+
+/**
+ * @brief Get the publish sequence of a port
+ * @details Number of publishes since Rte_Start; 0 = never written
+ * @param[in] Port Port ID
+ * @return Publish sequence, 0 for invalid ports
+ */
+uint32_t Rte_GetPortSequence(Rte_PortIdType Port);
+
+/**
+ * @brief Save the port buffers (Ecu_SaveSnapshot)
+ * @details Call while no runnable executes
+ * @param[out] Snapshot Port buffers and publish sequences
+ */
+void Rte_SaveSnapshot(Rte_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore the port buffers (Ecu_RestoreSnapshot)
+ * @details Call while no runnable executes
+ * @param[in] Snapshot Port buffers and publish sequences
+ */
+void Rte_RestoreSnapshot(const Rte_SnapshotType* Snapshot);
+
+#endif /* RTE_H */
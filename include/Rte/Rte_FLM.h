@@ -63,45 +63,22 @@ typedef struct {
 
 /**
  * @brief Read light switch status from SwitchEvent SWC
- * @param[out] status Pointer to receive light switch status
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Read_FLM_LightSwitchStatus(LightSwitchStatus* status);
-
-/**
- * @brief Read E2E status from SwitchEvent SWC
- * @param[out] e2eStatus Pointer to receive E2E status
- * @return RTE_E_OK on success
+ * @return Published port data (zero-copy, valid for one sender period)
  */
-Rte_StatusType Rte_Read_FLM_E2EStatus(E2E_P01CheckStatusType* e2eStatus);
+const Rte_IrvLightSwitchType* Rte_IRead_FLM_LightSwitch(void);
 
 /**
  * @brief Read ambient light level from LightRequest SWC
- * @param[out] level Pointer to receive ambient light level
- * @return RTE_E_OK on success
+ * @return Published port data (zero-copy, valid for one sender period)
  */
-Rte_StatusType Rte_Read_FLM_AmbientLightLevel(AmbientLightLevel* level);
+const Rte_IrvAmbientLightType* Rte_IRead_FLM_AmbientLight(void);
 
 /**
- * @brief Read ambient light signal status
- * @param[out] status Pointer to receive signal status
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Read_FLM_AmbientSignalStatus(SignalStatus* status);
-
-/**
- * @brief Write headlight command to Headlight SWC
- * @param[in] command Headlight command to write
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Write_FLM_HeadlightCommand(HeadlightCommand command);
-
-/**
- * @brief Write current FLM state
- * @param[in] state Current state
- * @return RTE_E_OK on success
+ * @brief Publish headlight command and FLM state
+ * @param[in] data Port data
+ * @return RTE_E_OK on success, RTE_E_INVALID for a NULL pointer
  */
-Rte_StatusType Rte_Write_FLM_CurrentState(FLM_StateType state);
+Rte_StatusType Rte_Write_FLM_HeadlightCmd(const Rte_IrvHeadlightCmdType* data);
 
 /*============================================================================*
  * RTE API - CLIENT/SERVER PORTS
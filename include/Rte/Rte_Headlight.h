@@ -73,24 +73,16 @@ typedef struct {
 
 /**
  * @brief Read headlight command from FLM SWC
- * @param[out] command Pointer to receive headlight command
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Read_Headlight_Command(HeadlightCommand* command);
-
-/**
- * @brief Write headlight fault status
- * @param[in] status Fault status to write
- * @return RTE_E_OK on success
+ * @return Published port data (zero-copy, valid for one sender period)
  */
-Rte_StatusType Rte_Write_Headlight_FaultStatus(HeadlightFaultStatus status);
+const Rte_IrvHeadlightCmdType* Rte_IRead_Headlight_HeadlightCmd(void);
 
 /**
- * @brief Write actual headlight state
- * @param[in] state Actual output state
- * @return RTE_E_OK on success
+ * @brief Publish fault status and actual output state
+ * @param[in] data Port data
+ * @return RTE_E_OK on success, RTE_E_INVALID for a NULL pointer
  */
-Rte_StatusType Rte_Write_Headlight_ActualState(boolean state);
+Rte_StatusType Rte_Write_Headlight_Status(const Rte_IrvHeadlightStatusType* data);
 
 /*============================================================================*
  * RTE API - CLIENT/SERVER PORTS
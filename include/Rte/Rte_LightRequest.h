@@ -70,18 +70,11 @@ typedef struct {
 Rte_StatusType Rte_Read_LightRequest_AdcAmbientLight(uint16_t* adcValue);
 
 /**
- * @brief Write validated ambient light level
- * @param[in] level Ambient light level to write
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Write_LightRequest_AmbientLightLevel(const AmbientLightLevel* level);
-
-/**
- * @brief Write signal status
- * @param[in] status Signal status to write
- * @return RTE_E_OK on success
+ * @brief Publish validated ambient light level with signal status
+ * @param[in] data Port data
+ * @return RTE_E_OK on success, RTE_E_INVALID for a NULL pointer
  */
-Rte_StatusType Rte_Write_LightRequest_SignalStatus(SignalStatus status);
+Rte_StatusType Rte_Write_LightRequest_AmbientLight(const Rte_IrvAmbientLightType* data);
 
 /*============================================================================*
  * RTE API - CLIENT/SERVER PORTS
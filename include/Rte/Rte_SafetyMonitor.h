@@ -96,60 +96,35 @@ typedef struct {
  *============================================================================*/
 
 /**
- * @brief Read FLM state
- * @param[out] state Pointer to receive FLM state
- * @return RTE_E_OK on success
+ * @brief Read light switch and E2E status from SwitchEvent
+ * @return Published port data (zero-copy, valid for one sender period)
  */
-Rte_StatusType Rte_Read_SafetyMonitor_FLMState(FLM_StateType* state);
+const Rte_IrvLightSwitchType* Rte_IRead_SafetyMonitor_LightSwitch(void);
 
 /**
- * @brief Read E2E status from SwitchEvent
- * @param[out] status Pointer to receive E2E status
- * @return RTE_E_OK on success
+ * @brief Read ambient light level from LightRequest
+ * @return Published port data (zero-copy, valid for one sender period)
  */
-Rte_StatusType Rte_Read_SafetyMonitor_E2EStatus(E2E_P01CheckStatusType* status);
+const Rte_IrvAmbientLightType* Rte_IRead_SafetyMonitor_AmbientLight(void);
 
 /**
- * @brief Read headlight fault status
- * @param[out] status Pointer to receive fault status
- * @return RTE_E_OK on success
+ * @brief Read headlight command and FLM state from FLM
+ * @return Published port data (zero-copy, valid for one sender period)
  */
-Rte_StatusType Rte_Read_SafetyMonitor_HeadlightFault(HeadlightFaultStatus* status);
+const Rte_IrvHeadlightCmdType* Rte_IRead_SafetyMonitor_HeadlightCmd(void);
 
 /**
- * @brief Read ambient light signal status
- * @param[out] status Pointer to receive signal status
- * @return RTE_E_OK on success
+ * @brief Read output stage status from Headlight
+ * @return Published port data (zero-copy, valid for one sender period)
  */
-Rte_StatusType Rte_Read_SafetyMonitor_AmbientStatus(SignalStatus* status);
+const Rte_IrvHeadlightStatusType* Rte_IRead_SafetyMonitor_HeadlightStatus(void);
 
 /**
- * @brief Read current ambient light value
- * @param[out] level Pointer to receive ambient light level
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Read_SafetyMonitor_AmbientLight(AmbientLightLevel* level);
-
-/**
- * @brief Write global safety status
- * @param[in] status Safety status to write
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Write_SafetyMonitor_GlobalStatus(SafetyStatusType status);
-
-/**
- * @brief Write safe state active flag
- * @param[in] active Safe state active flag
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Write_SafetyMonitor_SafeStateActive(boolean active);
-
-/**
- * @brief Write safe state headlight command
- * @param[in] command Headlight command for safe state
- * @return RTE_E_OK on success
+ * @brief Publish global safety status and safe state command
+ * @param[in] data Port data
+ * @return RTE_E_OK on success, RTE_E_INVALID for a NULL pointer
  */
-Rte_StatusType Rte_Write_SafetyMonitor_SafeStateCommand(HeadlightCommand command);
+Rte_StatusType Rte_Write_SafetyMonitor_SafetyStatus(const Rte_IrvSafetyStatusType* data);
 
 /*============================================================================*
  * RTE API - CLIENT/SERVER PORTS
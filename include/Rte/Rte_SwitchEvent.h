@@ -57,18 +57,11 @@ typedef struct {
 Rte_StatusType Rte_Read_SwitchEvent_CanLightSwitchMsg(Rte_CanMessageType* message);
 
 /**
- * @brief Write validated light switch status
- * @param[in] status Light switch status to write
- * @return RTE_E_OK on success
- */
-Rte_StatusType Rte_Write_SwitchEvent_LightSwitchStatus(const LightSwitchStatus* status);
-
-/**
- * @brief Write E2E check status
- * @param[in] e2eStatus E2E protection status
- * @return RTE_E_OK on success
+ * @brief Publish validated light switch status with E2E and timeout status
+ * @param[in] data Port data
+ * @return RTE_E_OK on success, RTE_E_INVALID for a NULL pointer
  */
-Rte_StatusType Rte_Write_SwitchEvent_E2EStatus(E2E_P01CheckStatusType e2eStatus);
+Rte_StatusType Rte_Write_SwitchEvent_LightSwitch(const Rte_IrvLightSwitchType* data);
 
 /*============================================================================*
  * RTE API - CLIENT/SERVER PORTS
@@ -0,0 +1,60 @@
+/**
+ * @file Rte_Tasks.h
+ * @brief OS Task Bodies of the FLM ECU
+ * @details Runnable to task mapping: the main functions of the SWCs and the
+ *          BSW modules in the order they run in the 5ms, 10ms and 20ms
+ *          tasks. The main scheduler (through Os), the fault campaign and
+ *          the benchmarks run the same bodies.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef RTE_TASKS_H
+#define RTE_TASKS_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Simulated FLM runnable hook type (fault injection, measurement)
+ * @return TRUE to run FLM_MainFunction, FALSE to skip it (stalled runnable)
+ */
+typedef boolean (*Rte_SimFlmHookType)(void);
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief 5ms task: SafetyMonitor, WdgM and BswM main functions
+ */
+void Rte_Task_5ms(void);
+
+/**
+ * @brief 10ms task: COM/CAN reception, SwitchEvent, FLM, Headlight, CAN/COM
+ *        transmission and Dem
+ * @details The COM stack main functions run under OS_SPINLOCK_COMSTACK
+ */
+void Rte_Task_10ms(void);
+
+/**
+ * @brief 20ms task: LightRequest main function
+ */
+void Rte_Task_20ms(void);
+
+/**
+ * @brief Set simulated FLM runnable hook
+ * @details Called in the 10ms task right before FLM_MainFunction
+ * @param[in] Hook FLM runnable hook, NULL_PTR to remove (FLM always runs)
+ */
+void Rte_SimSetFlmHook(Rte_SimFlmHookType Hook);
+
+#endif /* RTE_TASKS_H */
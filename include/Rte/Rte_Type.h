@@ -186,20 +186,22 @@ typedef uint8_t Rte_StatusType;
 #define RTE_E_MAX_AGE_EXCEEDED      0x0CU   /**< Max age exceeded */
 
 /*============================================================================*
- * RTE INTERNAL DATA STRUCTURES
+ * RTE PORT DATA STRUCTURES
  *============================================================================*/
 
 /**
- * @brief Inter-runnable variable for light switch data
+ * @brief Light switch port data (RTE_PORT_LIGHTSWITCH)
  */
 typedef struct {
     LightSwitchStatus status;
     Rte_TimestampType timestamp;
     E2E_P01CheckStatusType e2eStatus;
+    E2E_SMStateType e2eSmStatus;
+    boolean timeoutActive;
 } Rte_IrvLightSwitchType;
 
 /**
- * @brief Inter-runnable variable for ambient light data
+ * @brief Ambient light port data (RTE_PORT_AMBIENTLIGHT)
  */
 typedef struct {
     AmbientLightLevel level;
@@ -208,7 +210,7 @@ typedef struct {
 } Rte_IrvAmbientLightType;
 
 /**
- * @brief Inter-runnable variable for headlight command
+ * @brief Headlight command port data (RTE_PORT_HEADLIGHTCMD)
  */
 typedef struct {
     HeadlightCommand command;
@@ -216,4 +218,23 @@ typedef struct {
     Rte_TimestampType timestamp;
 } Rte_IrvHeadlightCmdType;
 
+/**
+ * @brief Headlight status port data (RTE_PORT_HEADLIGHTSTATUS)
+ */
+typedef struct {
+    HeadlightFaultStatus faultStatus;
+    boolean actualState;
+    Rte_TimestampType timestamp;
+} Rte_IrvHeadlightStatusType;
+
+/**
+ * @brief Safety status port data (RTE_PORT_SAFETYSTATUS)
+ */
+typedef struct {
+    SafetyStatusType globalStatus;
+    boolean safeStateActive;
+    HeadlightCommand safeStateCommand;
+    Rte_TimestampType timestamp;
+} Rte_IrvSafetyStatusType;
+
 #endif /* RTE_TYPE_H */
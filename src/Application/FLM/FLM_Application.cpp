@@ -14,9 +14,11 @@
  * INCLUDES
  *============================================================================*/
 #include "FLM_Application.h"
-#include "Application/SwitchEvent/SwitchEvent.h"
-#include "Application/LightRequest/LightRequest.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
 #include "Dem_Cfg.h"
+#include <atomic>
 #include <cstring>
 
 /*============================================================================*
@@ -39,27 +41,31 @@ static FLM_Application_StateType FLM_State;
 /** @brief System time counter */
 static uint32_t FLM_SystemTime = 0U;
 
-/** @brief Safe state trigger from external */
-static boolean FLM_ExternalSafeStateTrigger = FALSE;
+/** @brief Safe state trigger from external (SafetyMonitor, other task);
+ *         the reason is published by the flag */
+static std::atomic<boolean> FLM_ExternalSafeStateTrigger(FALSE);
 static SafeStateReason FLM_SafeStateReason = SAFE_STATE_REASON_NONE;
 
+/** @brief Transition enabled per (state, guards), built from FLM_TransitionConfig */
+static FLM_TransitionIdType FLM_TransitionLookup[FLM_NUM_STATES][FLM_NUM_GUARD_MASKS];
+
+/** @brief Times each transition was taken since FLM_Init (coverage) */
+static uint32_t FLM_TransitionHits[FLM_NUM_TRANSITIONS];
+
 /*============================================================================*
  * LOCAL FUNCTION PROTOTYPES
  *============================================================================*/
 
 static void FLM_ReadInputs(void);
 static void FLM_ProcessStateMachine(void);
-static void FLM_StateInit(void);
-static void FLM_StateNormal(void);
-static void FLM_StateDegraded(void);
-static void FLM_StateSafe(void);
+static FLM_GuardMaskType FLM_EvaluateGuards(void);
+static void FLM_BuildTransitionLookup(void);
+static void FLM_ApplySafeStateCommand(void);
 static void FLM_DetermineHeadlightCommand(void);
 static void FLM_ApplyAutoMode(void);
-static void FLM_ReportWdgMCheckpoint(void);
+static void FLM_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId);
 static void FLM_ReportDemEvents(void);
-static boolean FLM_AreAllInputsValid(void);
-static boolean FLM_IsAnyInputInvalid(void);
-static boolean FLM_IsCriticalFault(void);
+static void FLM_WriteOutputs(void);
 
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
@@ -99,6 +105,13 @@ void FLM_Init(void) {
     FLM_ExternalSafeStateTrigger = FALSE;
     FLM_SafeStateReason = SAFE_STATE_REASON_NONE;
 
+    /* Resolve the transition table, clear the coverage */
+    FLM_BuildTransitionLookup();
+    (void)memset(FLM_TransitionHits, 0, sizeof(FLM_TransitionHits));
+
+    /* Publish lights OFF */
+    FLM_WriteOutputs();
+
     /* Mark as initialized */
     FLM_State.isInitialized = TRUE;
 }
@@ -111,8 +124,10 @@ void FLM_MainFunction(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_FLM);
+
     /* Report entry checkpoint to WdgM [SysSafReq03] */
-    FLM_ReportWdgMCheckpoint();
+    FLM_ReportWdgMCheckpoint(FLM_CP_MAIN_ENTRY);
 
     /* Update timestamp */
     FLM_State.currentTime = FLM_SystemTime;
@@ -123,157 +138,160 @@ void FLM_MainFunction(void) {
 
     /* Process state machine [FunSafReq01-03] */
     FLM_ProcessStateMachine();
+    FLM_ReportWdgMCheckpoint(FLM_CP_STATE_MACHINE);
+    Metrics_Add(METRICS_FLM_DWELL(FLM_State.currentState), FLM_MAIN_FUNCTION_PERIOD_MS);
+    Metrics_SetGauge(METRICS_FLM_STATE, static_cast<sint64>(FLM_State.currentState));
 
     /* Determine headlight command based on state */
     FLM_DetermineHeadlightCommand();
 
     /* Report DEM events */
     FLM_ReportDemEvents();
+
+    /* Publish headlight command to Headlight and SafetyMonitor */
+    FLM_WriteOutputs();
+
+    /* Report exit checkpoint to WdgM [SysSafReq03] */
+    FLM_ReportWdgMCheckpoint(FLM_CP_MAIN_EXIT);
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_FLM);
 }
 
 /**
  * @brief Read inputs from other SWCs
+ * @details Reads the published port snapshots in place
  */
 static void FLM_ReadInputs(void) {
-    /* Get light switch status from SwitchEvent SWC */
-    FLM_State.lightSwitch = SwitchEvent_GetLightRequest();
-    FLM_State.e2eStatus = SwitchEvent_GetE2EStatus();
+    const Rte_IrvLightSwitchType* lightSwitch = Rte_IRead_FLM_LightSwitch();
+    const Rte_IrvAmbientLightType* ambientLight = Rte_IRead_FLM_AmbientLight();
 
-    if (FLM_State.lightSwitch.isValid) {
+    /* Light switch status from SwitchEvent SWC */
+    FLM_State.lightSwitch = lightSwitch->status;
+    FLM_State.e2eStatus = lightSwitch->e2eStatus;
+
+    if (lightSwitch->status.isValid) {
         FLM_State.switchSignalStatus = SIGNAL_STATUS_VALID;
-    } else if (SwitchEvent_IsTimeoutActive()) {
+    } else if (lightSwitch->timeoutActive) {
         FLM_State.switchSignalStatus = SIGNAL_STATUS_TIMEOUT;
     } else {
         FLM_State.switchSignalStatus = SIGNAL_STATUS_INVALID;
     }
 
-    /* Get ambient light from LightRequest SWC */
-    FLM_State.ambientLight = LightRequest_GetAmbientLight();
-    FLM_State.ambientSignalStatus = LightRequest_GetSignalStatus();
+    /* Ambient light from LightRequest SWC */
+    FLM_State.ambientLight = ambientLight->level;
+    FLM_State.ambientSignalStatus = ambientLight->status;
 }
 
 /**
  * @brief Process state machine
- * @details [FunSafReq01-03] State machine for safe state transition
+ * @details [FunSafReq01-03] State machine for safe state transition. The
+ *          guards are evaluated once, the transition is looked up by
+ *          (state, guards).
  */
 static void FLM_ProcessStateMachine(void) {
-    FLM_State.previousState = FLM_State.currentState;
-
-    switch (FLM_State.currentState) {
-        case FLM_STATE_INIT:
-            FLM_StateInit();
-            break;
+    FLM_GuardMaskType guards;
+    FLM_TransitionIdType transitionId;
 
-        case FLM_STATE_NORMAL:
-            FLM_StateNormal();
-            break;
-
-        case FLM_STATE_DEGRADED:
-            FLM_StateDegraded();
-            break;
+    FLM_State.previousState = FLM_State.currentState;
 
-        case FLM_STATE_SAFE:
-            FLM_StateSafe();
-            break;
+    if (static_cast<uint32_t>(FLM_State.currentState) >= FLM_NUM_STATES) {
+        /* Invalid state - transition to SAFE */
+        FLM_State.currentState = FLM_STATE_SAFE;
+    } else {
+        guards = FLM_EvaluateGuards();
+        transitionId = FLM_TransitionLookup[FLM_State.currentState][guards];
 
-        default:
-            /* Invalid state - transition to SAFE */
-            FLM_State.currentState = FLM_STATE_SAFE;
-            break;
+        if (transitionId != FLM_TRANSITION_NONE) {
+            FLM_TransitionHits[transitionId]++;
+            Metrics_Increment(METRICS_FLM_TRANSITION(transitionId));
+            FLM_State.currentState = FLM_TransitionConfig[transitionId].ToState;
+        }
     }
 
     /* Record state entry time on transition */
     if (FLM_State.currentState != FLM_State.previousState) {
+        if (FLM_State.currentState == FLM_STATE_DEGRADED) {
+            FLM_State.degradedEntryTime = FLM_State.currentTime;
+        }
+
+        Metrics_Observe(METRICS_FLM_STATE_VISIT, FLM_State.currentTime - FLM_State.stateEntryTime);
         FLM_State.stateEntryTime = FLM_State.currentTime;
+        TRACE_FLM_STATE(FLM_State.previousState, FLM_State.currentState);
     }
 }
 
 /**
- * @brief INIT state processing
+ * @brief Evaluate the transition guards
+ * @details Also counts the consecutive cycles with an invalid input; the
+ *          count is only used in NORMAL and cleared by valid inputs, which
+ *          every transition to NORMAL requires.
+ * @return Guard bitset (FLM_GUARD_*)
  */
-static void FLM_StateInit(void) {
-    /* Check for external safe state trigger */
-    if (FLM_ExternalSafeStateTrigger) {
-        FLM_State.currentState = FLM_STATE_SAFE;
-        return;
-    }
+static FLM_GuardMaskType FLM_EvaluateGuards(void) {
+    FLM_GuardMaskType guards = 0U;
 
-    /* Transition to NORMAL when all inputs are valid */
-    if (FLM_AreAllInputsValid()) {
-        FLM_State.currentState = FLM_STATE_NORMAL;
-        FLM_State.consecutiveErrors = 0U;
-    }
-
-    /* Default command in INIT is OFF */
-    FLM_State.headlightCommand = HEADLIGHT_CMD_OFF;
-}
-
-/**
- * @brief NORMAL state processing
- */
-static void FLM_StateNormal(void) {
-    /* Check for external safe state trigger */
     if (FLM_ExternalSafeStateTrigger) {
-        FLM_State.currentState = FLM_STATE_SAFE;
-        return;
+        guards |= FLM_GUARD_SAFE_REQUEST;
     }
 
-    /* Check for critical faults -> SAFE state */
-    if (FLM_IsCriticalFault()) {
-        FLM_State.currentState = FLM_STATE_SAFE;
-        return;
+    if (FLM_State.e2eTimeoutActive) {
+        guards |= FLM_GUARD_E2E_TIMEOUT;
     }
 
-    /* Check for any input invalid -> DEGRADED state */
-    if (FLM_IsAnyInputInvalid()) {
+    if (FLM_State.lightSwitch.isValid && FLM_State.ambientLight.isValid) {
+        guards |= FLM_GUARD_INPUTS_VALID;
+        FLM_State.consecutiveErrors = 0U;
+    } else if (FLM_State.consecutiveErrors < FLM_MAX_CONSECUTIVE_ERRORS) {
         FLM_State.consecutiveErrors++;
-
-        if (FLM_State.consecutiveErrors >= FLM_MAX_CONSECUTIVE_ERRORS) {
-            FLM_State.currentState = FLM_STATE_DEGRADED;
-            FLM_State.degradedEntryTime = FLM_State.currentTime;
-        }
     } else {
-        FLM_State.consecutiveErrors = 0U;
+        /* Saturated */
     }
-}
 
-/**
- * @brief DEGRADED state processing
- */
-static void FLM_StateDegraded(void) {
-    uint32_t timeInDegraded;
-
-    /* Check for external safe state trigger */
-    if (FLM_ExternalSafeStateTrigger) {
-        FLM_State.currentState = FLM_STATE_SAFE;
-        return;
+    if (FLM_State.consecutiveErrors >= FLM_MAX_CONSECUTIVE_ERRORS) {
+        guards |= FLM_GUARD_ERROR_LIMIT;
     }
 
-    /* Check if all inputs recovered -> back to NORMAL */
-    if (FLM_AreAllInputsValid()) {
-        FLM_State.currentState = FLM_STATE_NORMAL;
-        FLM_State.consecutiveErrors = 0U;
-        return;
+    /* [ECU17] FTTI */
+    if ((FLM_State.currentTime - FLM_State.degradedEntryTime) >
+        (FLM_FTTI_MS - FLM_SAFE_STATE_TRANSITION_MS)) {
+        guards |= FLM_GUARD_DEGRADED_TIMEOUT;
     }
 
-    /* Check for critical faults -> SAFE state */
-    if (FLM_IsCriticalFault()) {
-        FLM_State.currentState = FLM_STATE_SAFE;
-        return;
-    }
+    return guards;
+}
 
-    /* Check degraded timeout [ECU17] FTTI */
-    timeInDegraded = FLM_State.currentTime - FLM_State.degradedEntryTime;
-    if (timeInDegraded > (FLM_FTTI_MS - FLM_SAFE_STATE_TRANSITION_MS)) {
-        FLM_State.currentState = FLM_STATE_SAFE;
+/**
+ * @brief Build the transition lookup table from FLM_TransitionConfig
+ * @details Resolves the priority order once, so that a cycle needs a
+ *          single table access
+ */
+static void FLM_BuildTransitionLookup(void) {
+    uint32_t state;
+    uint32_t guards;
+    uint32_t transitionId;
+
+    for (state = 0U; state < FLM_NUM_STATES; state++) {
+        for (guards = 0U; guards < FLM_NUM_GUARD_MASKS; guards++) {
+            FLM_TransitionLookup[state][guards] = FLM_TRANSITION_NONE;
+
+            for (transitionId = 0U; transitionId < FLM_NUM_TRANSITIONS; transitionId++) {
+                const FLM_TransitionConfigType* transition = &FLM_TransitionConfig[transitionId];
+
+                if ((static_cast<uint32_t>(transition->FromState) == state) &&
+                    ((guards & transition->GuardMask) == transition->GuardValue)) {
+                    FLM_TransitionLookup[state][guards] = static_cast<FLM_TransitionIdType>(transitionId);
+                    break;
+                }
+            }
+        }
     }
 }
 
 /**
- * @brief SAFE state processing
+ * @brief SAFE state headlight command
  * @details [FunSafReq01-03] Safe state behavior
  */
-static void FLM_StateSafe(void) {
+static void FLM_ApplySafeStateCommand(void) {
     /* Safe state is final - no automatic recovery */
     /* Safe state command is determined based on ambient light */
 
@@ -299,9 +317,12 @@ static void FLM_StateSafe(void) {
  * @brief Determine headlight command based on current state
  */
 static void FLM_DetermineHeadlightCommand(void) {
-    /* Safe state has its own logic */
+    /* Safe state has its own logic, from the cycle after the entry */
     if (FLM_State.currentState == FLM_STATE_SAFE) {
-        return;  /* Already handled in FLM_StateSafe */
+        if (FLM_State.previousState == FLM_STATE_SAFE) {
+            FLM_ApplySafeStateCommand();
+        }
+        return;
     }
 
     /* INIT state - lights OFF */
@@ -377,52 +398,14 @@ static void FLM_ApplyAutoMode(void) {
     }
 }
 
-/**
- * @brief Check if all inputs are valid
- */
-static boolean FLM_AreAllInputsValid(void) {
-    return (FLM_State.lightSwitch.isValid &&
-            FLM_State.ambientLight.isValid);
-}
-
-/**
- * @brief Check if any input is invalid
- */
-static boolean FLM_IsAnyInputInvalid(void) {
-    return (!FLM_State.lightSwitch.isValid ||
-            !FLM_State.ambientLight.isValid);
-}
-
-/**
- * @brief Check for critical faults requiring immediate safe state
- */
-static boolean FLM_IsCriticalFault(void) {
-    /* E2E timeout exceeds limit */
-    if (FLM_State.e2eTimeoutActive) {
-        return TRUE;
-    }
-
-    /* External safe state request */
-    if (FLM_ExternalSafeStateTrigger) {
-        return TRUE;
-    }
-
-    return FALSE;
-}
-
 /**
  * @brief Report checkpoint to Watchdog Manager
+ * @param[in] checkpointId Checkpoint reached
  */
-static void FLM_ReportWdgMCheckpoint(void) {
-    (void)Rte_Call_FLM_WdgM_CheckpointReached(
-        FLM_SE_ID,
-        FLM_CP_MAIN_ENTRY
-    );
-
-    /* Report state machine checkpoint */
+static void FLM_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId) {
     (void)Rte_Call_FLM_WdgM_CheckpointReached(
         FLM_SE_ID,
-        FLM_CP_STATE_MACHINE
+        checkpointId
     );
 }
 
@@ -439,6 +422,19 @@ static void FLM_ReportDemEvents(void) {
     }
 }
 
+/**
+ * @brief Publish headlight command and state in one port write
+ */
+static void FLM_WriteOutputs(void) {
+    Rte_IrvHeadlightCmdType output;
+
+    output.command = FLM_State.headlightCommand;
+    output.flmState = FLM_State.currentState;
+    output.timestamp = FLM_State.currentTime;
+
+    (void)Rte_Write_FLM_HeadlightCmd(&output);
+}
+
 /*============================================================================*
  * PUBLIC INTERFACE FUNCTIONS
  *============================================================================*/
@@ -452,8 +448,8 @@ FLM_StateType FLM_GetCurrentState(void) {
 }
 
 void FLM_TriggerSafeState(SafeStateReason reason) {
-    FLM_ExternalSafeStateTrigger = TRUE;
     FLM_SafeStateReason = reason;
+    FLM_ExternalSafeStateTrigger = TRUE;
 }
 
 boolean FLM_IsInSafeState(void) {
@@ -464,58 +460,40 @@ const FLM_Application_StateType* FLM_GetState(void) {
     return &FLM_State;
 }
 
-/*============================================================================*
- * RTE PORT IMPLEMENTATIONS (STUBS)
- *============================================================================*/
-
-Rte_StatusType Rte_Read_FLM_LightSwitchStatus(LightSwitchStatus* status) {
-    if (status != NULL_PTR) {
-        *status = FLM_State.lightSwitch;
-        return RTE_E_OK;
+Std_ReturnType FLM_GetTransitionCoverage(FLM_TransitionIdType transitionId, uint32_t* hits) {
+    if ((transitionId >= FLM_NUM_TRANSITIONS) || (hits == NULL_PTR)) {
+        return E_NOT_OK;
     }
-    return RTE_E_INVALID;
-}
 
-Rte_StatusType Rte_Read_FLM_E2EStatus(E2E_P01CheckStatusType* e2eStatus) {
-    if (e2eStatus != NULL_PTR) {
-        *e2eStatus = FLM_State.e2eStatus;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
+    *hits = FLM_TransitionHits[transitionId];
+    return E_OK;
 }
 
-Rte_StatusType Rte_Read_FLM_AmbientLightLevel(AmbientLightLevel* level) {
-    if (level != NULL_PTR) {
-        *level = FLM_State.ambientLight;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
+void FLM_SaveSnapshot(FLM_SnapshotType* snapshot) {
+    snapshot->State = FLM_State;
+    snapshot->SystemTime = FLM_SystemTime;
+    snapshot->Reason = FLM_SafeStateReason;
+    snapshot->ExternalSafeStateTrigger = FLM_ExternalSafeStateTrigger.load();
 }
 
-Rte_StatusType Rte_Read_FLM_AmbientSignalStatus(SignalStatus* status) {
-    if (status != NULL_PTR) {
-        *status = FLM_State.ambientSignalStatus;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
-}
-
-Rte_StatusType Rte_Write_FLM_HeadlightCommand(HeadlightCommand command) {
-    STD_UNUSED(command);
-    return RTE_E_OK;
+void FLM_RestoreSnapshot(const FLM_SnapshotType* snapshot) {
+    FLM_State = snapshot->State;
+    FLM_SystemTime = snapshot->SystemTime;
+    FLM_SafeStateReason = snapshot->Reason;
+    FLM_ExternalSafeStateTrigger.store(snapshot->ExternalSafeStateTrigger);
 }
 
-Rte_StatusType Rte_Write_FLM_CurrentState(FLM_StateType state) {
-    STD_UNUSED(state);
-    return RTE_E_OK;
-}
+/*============================================================================*
+ * RTE PORT IMPLEMENTATIONS (STUBS)
+ *============================================================================*/
 
 Rte_StatusType Rte_Call_FLM_WdgM_CheckpointReached(
     WdgM_SupervisedEntityIdType SEId,
     WdgM_CheckpointIdType CPId
 ) {
-    STD_UNUSED(SEId);
-    STD_UNUSED(CPId);
+    if (WdgM_CheckpointReached(SEId, CPId) != E_OK) {
+        return RTE_E_INVALID;
+    }
     return RTE_E_OK;
 }
 
@@ -535,13 +513,6 @@ Rte_StatusType Rte_Call_FLM_SafetyMonitor_RequestSafeState(
     return RTE_E_OK;
 }
 
-Rte_StatusType Rte_Mode_FLM_SafetyMode(SafetyStatusType* status) {
-    if (status != NULL_PTR) {
-        *status = SAFETY_STATUS_OK;
-    }
-    return RTE_E_OK;
-}
-
 Rte_TimestampType Rte_IrvRead_FLM_SystemTime(void) {
     return FLM_SystemTime;
 }
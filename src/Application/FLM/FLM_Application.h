@@ -18,6 +18,7 @@
  *============================================================================*/
 #include "Rte/Rte_FLM.h"
 #include "FLM_Config.h"
+#include "FLM_Cfg.h"
 
 /*============================================================================*
  * TYPE DEFINITIONS
@@ -59,6 +60,16 @@ typedef struct {
     uint32_t currentTime;
 } FLM_Application_StateType;
 
+/**
+ * @brief FLM Application snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    FLM_Application_StateType State;
+    uint32_t SystemTime;
+    boolean ExternalSafeStateTrigger;
+    SafeStateReason Reason;
+} FLM_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -106,4 +117,24 @@ boolean FLM_IsInSafeState(void);
  */
 const FLM_Application_StateType* FLM_GetState(void);
 
+/**
+ * @brief Get how often a state machine transition was taken (coverage)
+ * @param[in] transitionId Transition (FLM_TRANSITION_*)
+ * @param[out] hits Times taken since FLM_Init
+ * @return E_OK on success, E_NOT_OK on invalid ID or NULL_PTR
+ */
+Std_ReturnType FLM_GetTransitionCoverage(FLM_TransitionIdType transitionId, uint32_t* hits);
+
+/**
+ * @brief Save component state (Ecu_SaveSnapshot)
+ * @param[out] snapshot Component state
+ */
+void FLM_SaveSnapshot(FLM_SnapshotType* snapshot);
+
+/**
+ * @brief Restore component state (Ecu_RestoreSnapshot)
+ * @param[in] snapshot Component state
+ */
+void FLM_RestoreSnapshot(const FLM_SnapshotType* snapshot);
+
 #endif /* FLM_APPLICATION_H */
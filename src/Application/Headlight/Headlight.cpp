@@ -14,36 +14,120 @@
  * INCLUDES
  *============================================================================*/
 #include "Headlight.h"
-#include "Application/FLM/FLM_Application.h"
 #include "MCAL/Dio/Dio.h"
 #include "MCAL/Adc/Adc.h"
+#include "MCAL/Pwm/Pwm.h"
+#include "BSW/Cal/Cal.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Trace/Trace.h"
 #include "Dem_Cfg.h"
 #include <cstring>
 
+/*============================================================================*
+ * LOCAL DEFINITIONS
+ *============================================================================*/
+
+/** @brief Duty cycle increase per cycle while soft-starting */
+#define HEADLIGHT_SOFT_START_STEP   ((PWM_DUTY_100_PERCENT * FLM_MAIN_FUNCTION_PERIOD_MS) / \
+                                     HEADLIGHT_SOFT_START_MS)
+
+/** @brief Duty cycle decrease per cycle while fading */
+#define HEADLIGHT_FADE_STEP         ((PWM_DUTY_100_PERCENT * FLM_MAIN_FUNCTION_PERIOD_MS) / \
+                                     HEADLIGHT_FADE_MS)
+
+/** @brief Number of headlight commands */
+#define HEADLIGHT_NUM_COMMANDS      3U
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Blanking of the fault checks after a command change
+ */
+typedef struct {
+    uint32_t OpenLoadUs;            /**< Open load check blanked */
+    uint32_t ShortCircuitUs;        /**< Short circuit check blanked */
+} Headlight_BlankingType;
+
 /*============================================================================*
  * LOCAL VARIABLES
  *============================================================================*/
 
+STD_STATIC_ASSERT((PWM_DEFAULT_PERIOD_US % ADC_STREAM_CONVERSION_PERIOD_US) == 0U,
+                  "Statistics window must cover whole PWM periods");
+STD_STATIC_ASSERT(HEADLIGHT_WINDOW_SAMPLES <= 0xFFU, "Window queue index is 8 bit");
+STD_STATIC_ASSERT(((HEADLIGHT_BLANK_LOW_SHORT_US + HEADLIGHT_SHORT_CONFIRM_US) <=
+                   (FLM_HEADLIGHT_FAULT_DETECT_MS * 1000U)) &&
+                  ((HEADLIGHT_BLANK_HIGH_SHORT_US + HEADLIGHT_SHORT_CONFIRM_US) <=
+                   (FLM_HEADLIGHT_FAULT_DETECT_MS * 1000U)),
+                  "Short circuit at switch-on must be confirmed within FLM_HEADLIGHT_FAULT_DETECT_MS");
+
+STD_STATIC_ASSERT((DIO_CHANNEL_PORT(HEADLIGHT_DIO_LOW_BEAM) ==
+                   DIO_CHANNEL_PORT(HEADLIGHT_DIO_HIGH_BEAM)) &&
+                  (HEADLIGHT_DIO_HIGH_BEAM == (HEADLIGHT_DIO_LOW_BEAM + 1U)),
+                  "Beam relays must be adjacent channels of one port");
+
+/** @brief Beam relays as one channel group: bit 0 low beam, bit 1 high beam */
+static const Dio_ChannelGroupType Headlight_BeamGroup = {
+    static_cast<uint8_t>(0x03U << DIO_CHANNEL_BIT(HEADLIGHT_DIO_LOW_BEAM)),
+    static_cast<uint8_t>(DIO_CHANNEL_BIT(HEADLIGHT_DIO_LOW_BEAM)),
+    static_cast<Dio_PortType>(DIO_CHANNEL_PORT(HEADLIGHT_DIO_LOW_BEAM))
+};
+
+/** @brief Blanking windows, indexed by the command switched to */
+static const Headlight_BlankingType Headlight_Blanking[HEADLIGHT_NUM_COMMANDS] = {
+    /* OpenLoadUs,                        ShortCircuitUs */
+    { 0U,                                 0U },                              /* OFF */
+    { HEADLIGHT_BLANK_LOW_OPEN_LOAD_US,   HEADLIGHT_BLANK_LOW_SHORT_US },    /* LOW_BEAM */
+    { HEADLIGHT_BLANK_HIGH_OPEN_LOAD_US,  HEADLIGHT_BLANK_HIGH_SHORT_US }    /* HIGH_BEAM */
+};
+
 /** @brief Component internal state */
 static Headlight_StateType Headlight_State;
 
+/** @brief Current sense statistics window */
+static Headlight_WindowType Headlight_Window;
+
 /** @brief System time counter */
 static uint32_t Headlight_SystemTime = 0U;
 
+/** @brief Result buffer of the current sense stream (written by the ADC) */
+static Adc_ValueGroupType Headlight_AdcStream[ADC_CURRENT_STREAM_SAMPLES];
+
+/** @brief Samples converted since the previous cycle */
+static Adc_ValueGroupType Headlight_AdcBlock[ADC_CURRENT_STREAM_SAMPLES];
+
 /** @brief Simulated feedback current */
 static uint16_t Headlight_SimCurrent = 0U;
 static boolean Headlight_SimCurrentEnabled = FALSE;
 
+/** @brief Simulated feedback hook (NULL_PTR = none) */
+static Headlight_SimFeedbackHookType Headlight_SimFeedbackHook = NULL_PTR;
+
 /*============================================================================*
  * LOCAL FUNCTION PROTOTYPES
  *============================================================================*/
 
 static void Headlight_ReadFeedback(void);
 static void Headlight_SetOutputs(void);
-static void Headlight_CheckOpenLoad(void);
-static void Headlight_CheckShortCircuit(void);
+static void Headlight_WriteBeams(boolean lowBeam, boolean highBeam);
+static uint16_t Headlight_RampDuty(uint16_t duty, boolean on);
+static void Headlight_SwitchOff(void);
+static void Headlight_WindowPush(Adc_ValueGroupType value);
+static void Headlight_QueuePush(Headlight_WindowQueueType* queue, uint32_t seq,
+                                Adc_ValueGroupType value, boolean keepMin);
+static void Headlight_Diagnose(uint16_t meanCurrent, uint16_t maxCurrent, uint32_t durationUs);
+static void Headlight_CheckOpenLoad(uint16_t maxCurrent, uint32_t durationUs);
+static void Headlight_CheckShortCircuit(uint16_t meanCurrent, uint16_t maxCurrent,
+                                        uint32_t durationUs);
+static boolean Headlight_Debounce(uint32_t* counter, uint32_t* blankUs, uint32_t confirmUs,
+                                  boolean failed, uint32_t durationUs);
+static void Headlight_ArmBlanking(HeadlightCommand command);
 static void Headlight_UpdateFaultStatus(void);
 static void Headlight_ReportDemEvents(void);
+static void Headlight_WriteOutputs(void);
+static void Headlight_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId);
 static boolean Headlight_IsOutputCommanded(void);
 
 /*============================================================================*
@@ -62,10 +146,13 @@ void Headlight_Init(void) {
     Headlight_State.requestedCommand = HEADLIGHT_CMD_OFF;
     Headlight_State.lowBeamOutput = FALSE;
     Headlight_State.highBeamOutput = FALSE;
+    Headlight_State.lowBeamDuty = PWM_DUTY_0_PERCENT;
+    Headlight_State.highBeamDuty = PWM_DUTY_0_PERCENT;
 
     /* Initialize feedback */
     Headlight_State.feedbackCurrent = 0U;
     Headlight_State.feedbackState = FALSE;
+    (void)memset(&Headlight_Window, 0, sizeof(Headlight_Window));
 
     /* Initialize fault detection */
     Headlight_State.faultStatus = HEADLIGHT_FAULT_NONE;
@@ -73,9 +160,17 @@ void Headlight_Init(void) {
     Headlight_State.shortCircuitCounter = 0U;
     Headlight_State.faultConfirmed = FALSE;
 
-    /* Initialize DIO outputs to OFF */
-    Dio_WriteChannel(HEADLIGHT_DIO_LOW_BEAM, STD_LOW);
-    Dio_WriteChannel(HEADLIGHT_DIO_HIGH_BEAM, STD_LOW);
+    /* Initialize relays and output stages to OFF */
+    Headlight_SwitchOff();
+
+    /* Oversample the current sense: continuous conversion into the stream buffer */
+    Adc_StopGroupConversion(ADC_GROUP_CURRENT_STREAM);
+    if (Adc_SetupResultBuffer(ADC_GROUP_CURRENT_STREAM, Headlight_AdcStream) == E_OK) {
+        Adc_StartGroupConversion(ADC_GROUP_CURRENT_STREAM);
+    }
+
+    /* Publish the switched off output stage */
+    Headlight_WriteOutputs();
 
     /* Mark as initialized */
     Headlight_State.isInitialized = TRUE;
@@ -90,95 +185,186 @@ void Headlight_MainFunction(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_HEADLIGHT);
+
+    /* Report entry checkpoint to WdgM [SysSafReq03] */
+    Headlight_ReportWdgMCheckpoint(HEADLIGHT_CP_MAIN_ENTRY);
+
     /* Update timestamp */
     Headlight_State.currentTime = Headlight_SystemTime;
     Headlight_SystemTime += FLM_MAIN_FUNCTION_PERIOD_MS;
 
     /* Get command from FLM */
-    Headlight_State.requestedCommand = FLM_GetHeadlightCommand();
+    Headlight_State.requestedCommand = Rte_IRead_Headlight_HeadlightCmd()->command;
 
     /* Set physical outputs */
     Headlight_SetOutputs();
 
-    /* Read feedback current */
+    /* Read feedback current, check for open load and short circuit [SysSafReq10] */
     Headlight_ReadFeedback();
 
-    /* Check for open load [SysSafReq10] */
-    Headlight_CheckOpenLoad();
-
-    /* Check for short circuit [SysSafReq10] */
-    Headlight_CheckShortCircuit();
-
     /* Update overall fault status */
     Headlight_UpdateFaultStatus();
 
     /* Report DEM events */
     Headlight_ReportDemEvents();
 
-    /* Update current command */
+    /* Publish output stage status to SafetyMonitor */
+    Headlight_WriteOutputs();
+
+    /* Update current command; the checks of the new command start blanked */
+    if (Headlight_State.requestedCommand != Headlight_State.currentCommand) {
+        Headlight_ArmBlanking(Headlight_State.requestedCommand);
+    }
     Headlight_State.currentCommand = Headlight_State.requestedCommand;
+
+    /* Report exit checkpoint to WdgM [SysSafReq03] */
+    Headlight_ReportWdgMCheckpoint(HEADLIGHT_CP_MAIN_EXIT);
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_HEADLIGHT);
 }
 
 /**
  * @brief Set physical outputs based on command
+ * @details Beams ramp their duty cycle up (soft-start, limits the inrush
+ *          of the cold filaments) and down (fade); a relay stays closed
+ *          until its beam has faded out
  */
 static void Headlight_SetOutputs(void) {
     switch (Headlight_State.requestedCommand) {
         case HEADLIGHT_CMD_OFF:
             Headlight_State.lowBeamOutput = FALSE;
             Headlight_State.highBeamOutput = FALSE;
-            Dio_WriteChannel(HEADLIGHT_DIO_LOW_BEAM, STD_LOW);
-            Dio_WriteChannel(HEADLIGHT_DIO_HIGH_BEAM, STD_LOW);
             break;
 
         case HEADLIGHT_CMD_LOW_BEAM:
             Headlight_State.lowBeamOutput = TRUE;
             Headlight_State.highBeamOutput = FALSE;
-            Dio_WriteChannel(HEADLIGHT_DIO_LOW_BEAM, STD_HIGH);
-            Dio_WriteChannel(HEADLIGHT_DIO_HIGH_BEAM, STD_LOW);
             break;
 
         case HEADLIGHT_CMD_HIGH_BEAM:
             Headlight_State.lowBeamOutput = TRUE;
             Headlight_State.highBeamOutput = TRUE;
-            Dio_WriteChannel(HEADLIGHT_DIO_LOW_BEAM, STD_HIGH);
-            Dio_WriteChannel(HEADLIGHT_DIO_HIGH_BEAM, STD_HIGH);
             break;
 
         default:
             /* Invalid command - turn off for safety */
             Headlight_State.lowBeamOutput = FALSE;
             Headlight_State.highBeamOutput = FALSE;
-            Dio_WriteChannel(HEADLIGHT_DIO_LOW_BEAM, STD_LOW);
-            Dio_WriteChannel(HEADLIGHT_DIO_HIGH_BEAM, STD_LOW);
             break;
     }
 
+    Headlight_State.lowBeamDuty = Headlight_RampDuty(Headlight_State.lowBeamDuty,
+                                                     Headlight_State.lowBeamOutput);
+    Headlight_State.highBeamDuty = Headlight_RampDuty(Headlight_State.highBeamDuty,
+                                                      Headlight_State.highBeamOutput);
+
+    Headlight_WriteBeams((Headlight_State.lowBeamDuty != PWM_DUTY_0_PERCENT),
+                         (Headlight_State.highBeamDuty != PWM_DUTY_0_PERCENT));
+    Pwm_SetDutyCycle(PWM_CHANNEL_LOW_BEAM, Headlight_State.lowBeamDuty);
+    Pwm_SetDutyCycle(PWM_CHANNEL_HIGH_BEAM, Headlight_State.highBeamDuty);
+
     /* Record command change time */
     if (Headlight_State.requestedCommand != Headlight_State.currentCommand) {
         Headlight_State.commandChangeTime = Headlight_State.currentTime;
     }
 }
 
+/**
+ * @brief Write both beam relays in one port update
+ * @details Low and high beam never appear half switched to a port reader
+ * @param[in] lowBeam Low beam relay level
+ * @param[in] highBeam High beam relay level
+ */
+static void Headlight_WriteBeams(boolean lowBeam, boolean highBeam) {
+    Dio_PortLevelType level = 0U;
+
+    if (lowBeam) {
+        level |= 0x01U;
+    }
+    if (highBeam) {
+        level |= 0x02U;
+    }
+
+    Dio_WriteChannelGroup(&Headlight_BeamGroup, level);
+}
+
+/**
+ * @brief Step a beam duty cycle towards full brightness or off
+ * @param[in] duty Duty cycle of the previous cycle
+ * @param[in] on Beam commanded ON
+ * @return Duty cycle of this cycle
+ */
+static uint16_t Headlight_RampDuty(uint16_t duty, boolean on) {
+    if (on) {
+        return ((PWM_DUTY_100_PERCENT - duty) > HEADLIGHT_SOFT_START_STEP) ?
+               static_cast<uint16_t>(duty + HEADLIGHT_SOFT_START_STEP) :
+               static_cast<uint16_t>(PWM_DUTY_100_PERCENT);
+    }
+
+    return (duty > HEADLIGHT_FADE_STEP) ?
+           static_cast<uint16_t>(duty - HEADLIGHT_FADE_STEP) :
+           static_cast<uint16_t>(PWM_DUTY_0_PERCENT);
+}
+
+/**
+ * @brief Switch both beams off at once (no fade)
+ */
+static void Headlight_SwitchOff(void) {
+    Pwm_SetOutputToIdle(PWM_CHANNEL_LOW_BEAM);
+    Pwm_SetOutputToIdle(PWM_CHANNEL_HIGH_BEAM);
+    Headlight_WriteBeams(FALSE, FALSE);
+    Headlight_State.lowBeamDuty = PWM_DUTY_0_PERCENT;
+    Headlight_State.highBeamDuty = PWM_DUTY_0_PERCENT;
+}
+
 /**
  * @brief Read feedback current from ADC
+ * @details Pushes every current sense sample streamed since the previous
+ *          cycle (ADC_STREAM_CONVERSION_PERIOD_US apart) into the statistics
+ *          window and runs the fault checks on the window of each sample.
+ *          The samples were taken under the command of the previous cycle.
  */
 static void Headlight_ReadFeedback(void) {
-    Adc_ValueGroupType adcValue;
-    Std_ReturnType result;
+    Adc_StreamNumSampleType numSamples;
+    Adc_StreamNumSampleType i;
+    uint16_t meanCurrent;
+    uint16_t maxCurrent;
 
     /* Check if using simulated value */
     if (Headlight_SimCurrentEnabled) {
         Headlight_State.feedbackCurrent = Headlight_SimCurrent;
+        Headlight_State.feedbackMin = Headlight_SimCurrent;
+        Headlight_State.feedbackMax = Headlight_SimCurrent;
+        Headlight_Diagnose(Headlight_SimCurrent, Headlight_SimCurrent,
+                           FLM_MAIN_FUNCTION_PERIOD_MS * 1000U);
     } else {
         /* Read current sense ADC */
-        Adc_StartGroupConversion(HEADLIGHT_ADC_CURRENT_SENSE);
-        result = Adc_ReadGroup(HEADLIGHT_ADC_CURRENT_SENSE, &adcValue);
+        numSamples = Adc_ReadGroupStream(ADC_GROUP_CURRENT_STREAM, Headlight_AdcBlock,
+                                         ADC_CURRENT_STREAM_SAMPLES);
+
+        for (i = 0U; i < numSamples; i++) {
+            Headlight_WindowPush(Headlight_AdcBlock[i]);
+
+            /* Diagnose once the window covers a whole PWM period */
+            if (Headlight_Window.Seq >= HEADLIGHT_WINDOW_SAMPLES) {
+                meanCurrent = Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT,
+                                          static_cast<uint16_t>(Headlight_Window.Sum /
+                                                                HEADLIGHT_WINDOW_SAMPLES));
+                maxCurrent = Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT,
+                    Headlight_Window.Max.Entries[Headlight_Window.Max.Head].Value);
+                Headlight_Diagnose(meanCurrent, maxCurrent, ADC_STREAM_CONVERSION_PERIOD_US);
+            }
+        }
 
-        if (result == E_OK) {
+        if ((numSamples > 0U) && (Headlight_Window.Seq >= HEADLIGHT_WINDOW_SAMPLES)) {
             /* Convert ADC to current (mA) */
-            Headlight_State.feedbackCurrent =
-                adcValue * FLM_HEADLIGHT_CURRENT_FACTOR;
+            Headlight_State.feedbackCurrent = Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT,
+                static_cast<uint16_t>(Headlight_Window.Sum / HEADLIGHT_WINDOW_SAMPLES));
+            Headlight_State.feedbackMin = Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT,
+                Headlight_Window.Min.Entries[Headlight_Window.Min.Head].Value);
+            Headlight_State.feedbackMax = Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT,
+                Headlight_Window.Max.Entries[Headlight_Window.Max.Head].Value);
         }
     }
 
@@ -188,61 +374,160 @@ static void Headlight_ReadFeedback(void) {
 }
 
 /**
- * @brief Check for open load condition
- * @details [SysSafReq10] Detect when commanded ON but no current flows
+ * @brief Push a sample into the statistics window
  */
-static void Headlight_CheckOpenLoad(void) {
-    uint32_t timeSinceCommand;
+static void Headlight_WindowPush(Adc_ValueGroupType value) {
+    Headlight_WindowType* window = &Headlight_Window;
+    const uint32_t slot = window->Seq % HEADLIGHT_WINDOW_SAMPLES;
 
-    /* Only check if output is commanded ON */
-    if (!Headlight_IsOutputCommanded()) {
-        Headlight_State.openLoadCounter = 0U;
-        return;
+    /* Running sum: the new sample replaces the oldest one */
+    if (window->Seq >= HEADLIGHT_WINDOW_SAMPLES) {
+        window->Sum -= window->Samples[slot];
     }
+    window->Samples[slot] = value;
+    window->Sum += value;
 
-    /* Wait for settling time after command change */
-    timeSinceCommand = Headlight_State.currentTime -
-                       Headlight_State.commandChangeTime;
+    Headlight_QueuePush(&window->Min, window->Seq, value, TRUE);
+    Headlight_QueuePush(&window->Max, window->Seq, value, FALSE);
+    window->Seq++;
+}
 
-    if (timeSinceCommand < FLM_HEADLIGHT_FAULT_DETECT_MS) {
-        return;  /* Still settling */
+/**
+ * @brief Push a sample into a monotonic min/max queue
+ * @details Samples that can no longer become the min (max) are dropped
+ *          from the back, samples that left the window from the front
+ * @param[in,out] queue Queue to update
+ * @param[in] seq Sample number
+ * @param[in] value Sample
+ * @param[in] keepMin TRUE for the min queue, FALSE for the max queue
+ */
+static void Headlight_QueuePush(Headlight_WindowQueueType* queue, uint32_t seq,
+                                Adc_ValueGroupType value, boolean keepMin) {
+    uint8_t back;
+
+    while (queue->Count > 0U) {
+        back = static_cast<uint8_t>((queue->Head + queue->Count - 1U) % HEADLIGHT_WINDOW_SAMPLES);
+        if (keepMin ? (queue->Entries[back].Value < value) :
+                      (queue->Entries[back].Value > value)) {
+            break;
+        }
+        queue->Count--;
     }
 
-    /* Check for open load: commanded ON but no current */
-    if (Headlight_State.feedbackCurrent < FLM_HEADLIGHT_OPEN_LOAD_MA) {
-        Headlight_State.openLoadCounter++;
+    if ((queue->Count > 0U) &&
+        ((seq - queue->Entries[queue->Head].Seq) >= HEADLIGHT_WINDOW_SAMPLES)) {
+        queue->Head = static_cast<uint8_t>((queue->Head + 1U) % HEADLIGHT_WINDOW_SAMPLES);
+        queue->Count--;
+    }
 
-        if (Headlight_State.openLoadCounter >= HEADLIGHT_FAULT_CONFIRM_CYCLES) {
-            Headlight_State.faultStatus = HEADLIGHT_FAULT_OPEN_LOAD;
-            Headlight_State.faultConfirmed = TRUE;
-        }
-    } else {
+    back = static_cast<uint8_t>((queue->Head + queue->Count) % HEADLIGHT_WINDOW_SAMPLES);
+    queue->Entries[back].Seq = seq;
+    queue->Entries[back].Value = value;
+    queue->Count++;
+}
+
+/**
+ * @brief Run the output stage diagnosis on one window
+ * @param[in] meanCurrent Window mean (mA)
+ * @param[in] maxCurrent Window maximum (mA)
+ * @param[in] durationUs Time covered since the previous window
+ */
+static void Headlight_Diagnose(uint16_t meanCurrent, uint16_t maxCurrent, uint32_t durationUs) {
+    /* Check for open load [SysSafReq10] */
+    Headlight_CheckOpenLoad(maxCurrent, durationUs);
+
+    /* Check for short circuit [SysSafReq10] */
+    Headlight_CheckShortCircuit(meanCurrent, maxCurrent, durationUs);
+}
+
+/**
+ * @brief Check for open load condition
+ * @details [SysSafReq10] Detect when commanded ON but no current flows:
+ *          no sample of a whole PWM period above the open load threshold
+ * @param[in] maxCurrent Window maximum (mA)
+ * @param[in] durationUs Time covered since the previous window
+ */
+static void Headlight_CheckOpenLoad(uint16_t maxCurrent, uint32_t durationUs) {
+    /* Only check if output is commanded ON */
+    if (!Headlight_IsOutputCommanded()) {
         Headlight_State.openLoadCounter = 0U;
+        return;
+    }
+
+    if (Headlight_Debounce(&Headlight_State.openLoadCounter, &Headlight_State.openLoadBlankUs,
+                           HEADLIGHT_FAULT_CONFIRM_US,
+                           (maxCurrent < FLM_HEADLIGHT_OPEN_LOAD_MA), durationUs)) {
+        Headlight_State.faultStatus = HEADLIGHT_FAULT_OPEN_LOAD;
+        Headlight_State.faultConfirmed = TRUE;
     }
 }
 
 /**
  * @brief Check for short circuit condition
- * @details [SysSafReq10] Detect overcurrent condition
+ * @details [SysSafReq10] Detect overcurrent condition: on phase peak of a
+ *          whole PWM period above the short circuit current, independent of
+ *          the soft-start duty cycle, or mean above the maximum current
+ * @param[in] meanCurrent Window mean (mA)
+ * @param[in] maxCurrent Window maximum (mA)
+ * @param[in] durationUs Time covered since the previous window
  */
-static void Headlight_CheckShortCircuit(void) {
+static void Headlight_CheckShortCircuit(uint16_t meanCurrent, uint16_t maxCurrent,
+                                        uint32_t durationUs) {
     /* Check for overcurrent regardless of command */
-    if (Headlight_State.feedbackCurrent > FLM_HEADLIGHT_MAX_CURRENT_MA) {
-        Headlight_State.shortCircuitCounter++;
+    if (Headlight_Debounce(&Headlight_State.shortCircuitCounter,
+                           &Headlight_State.shortCircuitBlankUs, HEADLIGHT_SHORT_CONFIRM_US,
+                           ((maxCurrent > HEADLIGHT_SHORT_PEAK_MA) ||
+                            (meanCurrent > FLM_HEADLIGHT_MAX_CURRENT_MA)), durationUs)) {
+        Headlight_State.faultStatus = HEADLIGHT_FAULT_SHORT;
+        Headlight_State.faultConfirmed = TRUE;
+
+        /* Immediately turn off outputs for protection */
+        Headlight_SwitchOff();
+        Headlight_State.lowBeamOutput = FALSE;
+        Headlight_State.highBeamOutput = FALSE;
+    }
+}
 
-        if (Headlight_State.shortCircuitCounter >= HEADLIGHT_FAULT_CONFIRM_CYCLES) {
-            Headlight_State.faultStatus = HEADLIGHT_FAULT_SHORT;
-            Headlight_State.faultConfirmed = TRUE;
+/**
+ * @brief Counter based debouncing of a fault check
+ * @details Within the blanking window the check is skipped. Otherwise fail
+ *          time counts up and pass time counts down (not below 0), so a
+ *          single outlier neither confirms nor fully clears a fault.
+ * @param[in,out] counter Net fail time (us)
+ * @param[in,out] blankUs Remaining blanking time (us)
+ * @param[in] confirmUs Net fail time that confirms the fault (us)
+ * @param[in] failed Check failed for this window
+ * @param[in] durationUs Time covered since the previous window
+ * @return TRUE when the fault is confirmed
+ */
+static boolean Headlight_Debounce(uint32_t* counter, uint32_t* blankUs, uint32_t confirmUs,
+                                  boolean failed, uint32_t durationUs) {
+    if (*blankUs > 0U) {
+        *blankUs = (*blankUs > durationUs) ? (*blankUs - durationUs) : 0U;
+        return FALSE;
+    }
 
-            /* Immediately turn off outputs for protection */
-            Dio_WriteChannel(HEADLIGHT_DIO_LOW_BEAM, STD_LOW);
-            Dio_WriteChannel(HEADLIGHT_DIO_HIGH_BEAM, STD_LOW);
-            Headlight_State.lowBeamOutput = FALSE;
-            Headlight_State.highBeamOutput = FALSE;
-        }
+    if (failed) {
+        *counter = (*counter < confirmUs) ? (*counter + durationUs) : *counter;
     } else {
-        Headlight_State.shortCircuitCounter = 0U;
+        *counter = (*counter > durationUs) ? (*counter - durationUs) : 0U;
     }
+
+    return (*counter >= confirmUs) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Start the blanking windows of a new command
+ * @param[in] command Command switched to
+ */
+static void Headlight_ArmBlanking(HeadlightCommand command) {
+    const uint8_t index = (static_cast<uint8_t>(command) < HEADLIGHT_NUM_COMMANDS) ?
+                          static_cast<uint8_t>(command) : 0U;
+
+    Headlight_State.openLoadBlankUs = Headlight_Blanking[index].OpenLoadUs;
+    Headlight_State.shortCircuitBlankUs = Headlight_Blanking[index].ShortCircuitUs;
+    Headlight_State.openLoadCounter = 0U;
+    Headlight_State.shortCircuitCounter = 0U;
 }
 
 /**
@@ -260,10 +545,21 @@ static void Headlight_UpdateFaultStatus(void) {
 }
 
 /**
- * @brief Check if any output is commanded ON
+ * @brief Check if any output was commanded ON while the samples were taken
  */
 static boolean Headlight_IsOutputCommanded(void) {
-    return (Headlight_State.requestedCommand != HEADLIGHT_CMD_OFF);
+    return (Headlight_State.currentCommand != HEADLIGHT_CMD_OFF);
+}
+
+/**
+ * @brief Report checkpoint to Watchdog Manager
+ * @param[in] checkpointId Checkpoint reached
+ */
+static void Headlight_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId) {
+    (void)Rte_Call_Headlight_WdgM_CheckpointReached(
+        HEADLIGHT_SE_ID,
+        checkpointId
+    );
 }
 
 /**
@@ -297,6 +593,19 @@ static void Headlight_ReportDemEvents(void) {
     }
 }
 
+/**
+ * @brief Publish fault status and actual output state in one port write
+ */
+static void Headlight_WriteOutputs(void) {
+    Rte_IrvHeadlightStatusType output;
+
+    output.faultStatus = Headlight_State.faultStatus;
+    output.actualState = Headlight_State.feedbackState;
+    output.timestamp = Headlight_State.currentTime;
+
+    (void)Rte_Write_Headlight_Status(&output);
+}
+
 /*============================================================================*
  * PUBLIC INTERFACE FUNCTIONS
  *============================================================================*/
@@ -318,35 +627,43 @@ HeadlightCommand Headlight_GetCurrentCommand(void) {
 }
 
 void Headlight_SimSetFeedbackCurrent(uint16_t current) {
+    if (Headlight_SimFeedbackHook != NULL_PTR) {
+        Headlight_SimFeedbackHook(current);
+    }
+
     Headlight_SimCurrent = current;
     Headlight_SimCurrentEnabled = TRUE;
 }
 
+void Headlight_SimSetFeedbackHook(Headlight_SimFeedbackHookType hook) {
+    Headlight_SimFeedbackHook = hook;
+}
+
 const Headlight_StateType* Headlight_GetState(void) {
     return &Headlight_State;
 }
 
-/*============================================================================*
- * RTE PORT IMPLEMENTATIONS (STUBS)
- *============================================================================*/
-
-Rte_StatusType Rte_Read_Headlight_Command(HeadlightCommand* command) {
-    if (command != NULL_PTR) {
-        *command = Headlight_State.requestedCommand;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
+void Headlight_SaveSnapshot(Headlight_SnapshotType* snapshot) {
+    snapshot->State = Headlight_State;
+    snapshot->Window = Headlight_Window;
+    snapshot->SystemTime = Headlight_SystemTime;
+    (void)memcpy(snapshot->AdcStream, Headlight_AdcStream, sizeof(Headlight_AdcStream));
+    snapshot->SimCurrent = Headlight_SimCurrent;
+    snapshot->SimCurrentEnabled = Headlight_SimCurrentEnabled;
 }
 
-Rte_StatusType Rte_Write_Headlight_FaultStatus(HeadlightFaultStatus status) {
-    STD_UNUSED(status);
-    return RTE_E_OK;
+void Headlight_RestoreSnapshot(const Headlight_SnapshotType* snapshot) {
+    Headlight_State = snapshot->State;
+    Headlight_Window = snapshot->Window;
+    Headlight_SystemTime = snapshot->SystemTime;
+    (void)memcpy(Headlight_AdcStream, snapshot->AdcStream, sizeof(Headlight_AdcStream));
+    Headlight_SimCurrent = snapshot->SimCurrent;
+    Headlight_SimCurrentEnabled = snapshot->SimCurrentEnabled;
 }
 
-Rte_StatusType Rte_Write_Headlight_ActualState(boolean state) {
-    STD_UNUSED(state);
-    return RTE_E_OK;
-}
+/*============================================================================*
+ * RTE PORT IMPLEMENTATIONS (STUBS)
+ *============================================================================*/
 
 Rte_StatusType Rte_Call_Headlight_Dio_WriteChannel(
     uint8_t channelId,
@@ -383,8 +700,9 @@ Rte_StatusType Rte_Call_Headlight_WdgM_CheckpointReached(
     WdgM_SupervisedEntityIdType SEId,
     WdgM_CheckpointIdType CPId
 ) {
-    STD_UNUSED(SEId);
-    STD_UNUSED(CPId);
+    if (WdgM_CheckpointReached(SEId, CPId) != E_OK) {
+        return RTE_E_INVALID;
+    }
     return RTE_E_OK;
 }
 
@@ -1,7 +1,9 @@
 /**
  * @file Headlight.h
  * @brief Headlight SWC Interface
- * @details Controls headlight output with feedback monitoring
+ * @details Controls headlight output with feedback monitoring; beams are
+ *          switched by their relays and dimmed by PWM output stages with
+ *          soft-start and fade ramps
  * @version 1.0.0
  * @date 2024
  *
@@ -17,14 +19,54 @@
  * INCLUDES
  *============================================================================*/
 #include "Rte/Rte_Headlight.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Pwm/Pwm.h"
 #include "FLM_Config.h"
 
 /*============================================================================*
  * CONFIGURATION
  *============================================================================*/
 
-/** @brief Fault confirmation cycles (at 10ms) */
-#define HEADLIGHT_FAULT_CONFIRM_CYCLES      (FLM_HEADLIGHT_FAULT_DETECT_MS / FLM_MAIN_FUNCTION_PERIOD_MS)
+/** @brief Net fail time of a fault check until the fault is confirmed (us)
+ *  @details Fail samples count up, pass samples count down; together with
+ *           the statistics window and the cycle of the 10ms task a fault is
+ *           confirmed within FLM_HEADLIGHT_FAULT_DETECT_MS */
+#define HEADLIGHT_FAULT_CONFIRM_US          5000U
+
+/** @brief On phase current above which an output is shorted (mA)
+ *  @details Above the inrush peak of an intact cold lamp once the short
+ *           circuit blanking has passed, below the current limit of the
+ *           output stage */
+#define HEADLIGHT_SHORT_PEAK_MA             29000U
+
+/** @brief Net fail time of the short circuit check until confirmed (us)
+ *  @details The window max holds a peak for one window after it, so the
+ *           fail time of the peak check exceeds the fault by up to one
+ *           PWM period */
+#define HEADLIGHT_SHORT_CONFIRM_US          (HEADLIGHT_FAULT_CONFIRM_US + PWM_DEFAULT_PERIOD_US)
+
+/** @brief Open load blanking after switching to low beam (soft-start, us) */
+#define HEADLIGHT_BLANK_LOW_OPEN_LOAD_US    10000U
+
+/** @brief Short circuit blanking after switching to low beam (inrush, us) */
+#define HEADLIGHT_BLANK_LOW_SHORT_US        10000U
+
+/** @brief Open load blanking after switching to high beam (soft-start, us) */
+#define HEADLIGHT_BLANK_HIGH_OPEN_LOAD_US   10000U
+
+/** @brief Short circuit blanking after switching to high beam (inrush, us;
+ *         the phase shifted on phases keep the inrush of both lamps apart) */
+#define HEADLIGHT_BLANK_HIGH_SHORT_US       10000U
+
+/** @brief Duty cycle ramp of a beam from off to full brightness (soft-start, ms) */
+#define HEADLIGHT_SOFT_START_MS             100U
+
+/** @brief Duty cycle ramp of a beam from full brightness to off (fade, ms) */
+#define HEADLIGHT_FADE_MS                   50U
+
+/** @brief Current sense samples per statistics window: one PWM period, so the
+ *         window mean does not depend on the PWM phase */
+#define HEADLIGHT_WINDOW_SAMPLES            (PWM_DEFAULT_PERIOD_US / ADC_STREAM_CONVERSION_PERIOD_US)
 
 /*============================================================================*
  * TYPE DEFINITIONS
@@ -42,15 +84,21 @@ typedef struct {
     HeadlightCommand requestedCommand;
     boolean lowBeamOutput;
     boolean highBeamOutput;
+    uint16_t lowBeamDuty;           /**< PWM duty cycle (0 .. 0x8000) */
+    uint16_t highBeamDuty;          /**< PWM duty cycle (0 .. 0x8000) */
 
-    /* Feedback monitoring */
-    uint16_t feedbackCurrent;       /**< Current sense in mA */
+    /* Feedback monitoring (window of the latest PWM period) */
+    uint16_t feedbackCurrent;       /**< Current sense in mA (window mean) */
+    uint16_t feedbackMin;           /**< Window minimum in mA */
+    uint16_t feedbackMax;           /**< Window maximum in mA */
     boolean feedbackState;          /**< Actual current flow detected */
 
     /* Fault detection [SysSafReq10] */
     HeadlightFaultStatus faultStatus;
-    uint8_t openLoadCounter;
-    uint8_t shortCircuitCounter;
+    uint32_t openLoadCounter;       /**< Net open load fail time (us) */
+    uint32_t shortCircuitCounter;   /**< Net short circuit fail time (us) */
+    uint32_t openLoadBlankUs;       /**< Remaining open load blanking (us) */
+    uint32_t shortCircuitBlankUs;   /**< Remaining short circuit blanking (us) */
     uint32_t faultDetectStartTime;
     boolean faultConfirmed;
 
@@ -59,6 +107,53 @@ typedef struct {
     uint32_t currentTime;
 } Headlight_StateType;
 
+/**
+ * @brief Sample of a monotonic min/max queue
+ */
+typedef struct {
+    uint32_t Seq;                   /**< Sample number */
+    Adc_ValueGroupType Value;       /**< Current sense sample */
+} Headlight_WindowEntryType;
+
+/**
+ * @brief Monotonic queue (ring): front holds the min/max of the window
+ */
+typedef struct {
+    Headlight_WindowEntryType Entries[HEADLIGHT_WINDOW_SAMPLES];
+    uint8_t Head;
+    uint8_t Count;
+} Headlight_WindowQueueType;
+
+/**
+ * @brief Sliding statistics over the last HEADLIGHT_WINDOW_SAMPLES samples
+ * @details Every update is O(1): the sum drops the oldest sample, each
+ *          sample enters and leaves the min and max queues at most once
+ */
+typedef struct {
+    Adc_ValueGroupType Samples[HEADLIGHT_WINDOW_SAMPLES];
+    uint32_t Sum;                   /**< Sum of the window */
+    uint32_t Seq;                   /**< Samples pushed */
+    Headlight_WindowQueueType Min;  /**< Increasing values */
+    Headlight_WindowQueueType Max;  /**< Decreasing values */
+} Headlight_WindowType;
+
+/**
+ * @brief Headlight snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    Headlight_StateType State;
+    Headlight_WindowType Window;
+    uint32_t SystemTime;
+    Adc_ValueGroupType AdcStream[ADC_CURRENT_STREAM_SAMPLES];
+    uint16_t SimCurrent;
+    boolean SimCurrentEnabled;
+} Headlight_SnapshotType;
+
+/**
+ * @brief Simulated feedback hook type (e.g. input recorder)
+ */
+typedef void (*Headlight_SimFeedbackHookType)(uint16_t current);
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -106,10 +201,29 @@ HeadlightCommand Headlight_GetCurrentCommand(void);
  */
 void Headlight_SimSetFeedbackCurrent(uint16_t current);
 
+/**
+ * @brief Set simulated feedback hook
+ * @details Called with every Headlight_SimSetFeedbackCurrent
+ * @param[in] hook Feedback hook, NULL_PTR to remove
+ */
+void Headlight_SimSetFeedbackHook(Headlight_SimFeedbackHookType hook);
+
 /**
  * @brief Get component state (for testing)
  * @return Pointer to internal state
  */
 const Headlight_StateType* Headlight_GetState(void);
 
+/**
+ * @brief Save component state (Ecu_SaveSnapshot)
+ * @param[out] snapshot Component state
+ */
+void Headlight_SaveSnapshot(Headlight_SnapshotType* snapshot);
+
+/**
+ * @brief Restore component state (Ecu_RestoreSnapshot)
+ * @param[in] snapshot Component state
+ */
+void Headlight_RestoreSnapshot(const Headlight_SnapshotType* snapshot);
+
 #endif /* HEADLIGHT_H */
@@ -15,6 +15,9 @@
  *============================================================================*/
 #include "LightRequest.h"
 #include "MCAL/Adc/Adc.h"
+#include "BSW/Cal/Cal.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Trace/Trace.h"
 #include "Dem_Cfg.h"
 #include <cstring>
 
@@ -28,6 +31,12 @@ static LightRequest_StateType LightRequest_State;
 /** @brief System time counter */
 static uint32_t LightRequest_SystemTime = 0U;
 
+/** @brief Result buffer of the ambient light stream (written by the ADC) */
+static Adc_ValueGroupType LightRequest_AdcStream[ADC_AMBIENT_STREAM_SAMPLES];
+
+/** @brief Samples converted since the previous cycle */
+static Adc_ValueGroupType LightRequest_AdcBlock[ADC_AMBIENT_STREAM_SAMPLES];
+
 /** @brief Simulated ADC value */
 static uint16_t LightRequest_SimAdcValue = 2000U;
 static boolean LightRequest_SimAdcEnabled = FALSE;
@@ -43,7 +52,9 @@ static void LightRequest_CheckShortCircuit(void);
 static void LightRequest_CheckPlausibility(void);
 static void LightRequest_UpdateOutput(void);
 static void LightRequest_ReportDemEvents(void);
+static void LightRequest_WriteOutputs(void);
 static uint16_t LightRequest_AdcToLux(uint16_t adcValue);
+static void LightRequest_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId);
 
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
@@ -53,16 +64,12 @@ static uint16_t LightRequest_AdcToLux(uint16_t adcValue);
  * @brief Initialize LightRequest component
  */
 void LightRequest_Init(void) {
-    uint8_t i;
-
     /* Clear state structure */
     (void)memset(&LightRequest_State, 0, sizeof(LightRequest_State));
 
-    /* Initialize ADC buffer */
-    for (i = 0U; i < LIGHTREQUEST_ADC_BUFFER_SIZE; i++) {
-        LightRequest_State.adcBuffer[i] = 0U;
-    }
-    LightRequest_State.adcBufferIndex = 0U;
+    /* Initialize filter chain */
+    (void)LightRequest_FilterInit(&LightRequest_State.filter, LightRequest_FilterChainConfig,
+                                  LIGHTREQUEST_NUM_FILTER_STAGES);
     LightRequest_State.adcSampleCount = 0U;
     LightRequest_State.adcFilteredValue = 0U;
     LightRequest_State.adcRawValue = 0U;
@@ -82,6 +89,18 @@ void LightRequest_Init(void) {
     LightRequest_State.plausibilityErrorCount = 0U;
     LightRequest_State.plausibilityFault = FALSE;
 
+    /* Read the ADC until a simulated value is set */
+    LightRequest_SimAdcEnabled = FALSE;
+
+    /* Oversample the sensor: continuous conversion into the stream buffer */
+    Adc_StopGroupConversion(ADC_GROUP_AMBIENT_STREAM);
+    if (Adc_SetupResultBuffer(ADC_GROUP_AMBIENT_STREAM, LightRequest_AdcStream) == E_OK) {
+        Adc_StartGroupConversion(ADC_GROUP_AMBIENT_STREAM);
+    }
+
+    /* Publish the invalid ambient light level */
+    LightRequest_WriteOutputs();
+
     /* Mark as initialized */
     LightRequest_State.isInitialized = TRUE;
 }
@@ -95,6 +114,11 @@ void LightRequest_MainFunction(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_LIGHTREQUEST);
+
+    /* Report entry checkpoint to WdgM [SysSafReq03] */
+    LightRequest_ReportWdgMCheckpoint(LIGHTREQUEST_CP_MAIN_ENTRY);
+
     /* Update timestamp */
     LightRequest_State.currentTimestamp = LightRequest_SystemTime;
     LightRequest_SystemTime += FLM_AMBIENT_LIGHT_PERIOD_MS;
@@ -119,14 +143,25 @@ void LightRequest_MainFunction(void) {
 
     /* Report DEM events */
     LightRequest_ReportDemEvents();
+
+    /* Publish ambient light level to FLM and SafetyMonitor */
+    LightRequest_WriteOutputs();
+
+    /* Report exit checkpoint to WdgM [SysSafReq03] */
+    LightRequest_ReportWdgMCheckpoint(LIGHTREQUEST_CP_MAIN_EXIT);
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_LIGHTREQUEST);
 }
 
 /**
  * @brief Read ADC value
+ * @details Mean of the samples streamed since the previous cycle
+ *          (oversampling at ADC_STREAM_CONVERSION_PERIOD_US)
  */
 static void LightRequest_ReadAdc(void) {
-    Adc_ValueGroupType adcValue;
-    Std_ReturnType result;
+    Adc_StreamNumSampleType numSamples;
+    Adc_StreamNumSampleType i;
+    uint32_t sum = 0U;
 
     /* Check if using simulated value */
     if (LightRequest_SimAdcEnabled) {
@@ -134,48 +169,31 @@ static void LightRequest_ReadAdc(void) {
         return;
     }
 
-    /* Start ADC conversion */
-    Adc_StartGroupConversion(LIGHTREQUEST_ADC_CHANNEL);
-
-    /* Read result (in simulation, conversion is instant) */
-    result = Adc_ReadGroup(LIGHTREQUEST_ADC_CHANNEL, &adcValue);
+    numSamples = Adc_ReadGroupStream(ADC_GROUP_AMBIENT_STREAM, LightRequest_AdcBlock,
+                                     ADC_AMBIENT_STREAM_SAMPLES);
 
-    if (result == E_OK) {
-        LightRequest_State.adcRawValue = adcValue;
+    if (numSamples > 0U) {
+        for (i = 0U; i < numSamples; i++) {
+            sum += LightRequest_AdcBlock[i];
+        }
+        LightRequest_State.adcRawValue = static_cast<uint16_t>(sum / numSamples);
     }
     /* If read fails, keep previous value */
 }
 
 /**
  * @brief Apply signal conditioning filter
- * @details Averaging over FLM_ADC_SAMPLES samples
+ * @details Filter chain of LightRequest_FilterChainConfig, constant cost per
+ *          cycle for any window length
  */
 static void LightRequest_ApplyFilter(void) {
-    uint32_t sum = 0U;
-    uint8_t i;
-    uint8_t count;
-
-    /* Add new sample to buffer */
-    LightRequest_State.adcBuffer[LightRequest_State.adcBufferIndex] =
-        LightRequest_State.adcRawValue;
-
-    /* Update buffer index (circular) */
-    LightRequest_State.adcBufferIndex =
-        (LightRequest_State.adcBufferIndex + 1U) % FLM_ADC_SAMPLES;
+    LightRequest_State.adcFilteredValue =
+        LightRequest_FilterUpdate(&LightRequest_State.filter, LightRequest_State.adcRawValue);
 
     /* Track sample count for startup */
     if (LightRequest_State.adcSampleCount < FLM_ADC_SAMPLES) {
         LightRequest_State.adcSampleCount++;
     }
-
-    /* Calculate average */
-    count = LightRequest_State.adcSampleCount;
-    for (i = 0U; i < count; i++) {
-        sum += LightRequest_State.adcBuffer[i];
-    }
-
-    LightRequest_State.adcFilteredValue =
-        static_cast<uint16_t>(sum / count);
 }
 
 /**
@@ -281,15 +299,23 @@ static void LightRequest_UpdateOutput(void) {
 
 /**
  * @brief Convert ADC value to lux
+ * @details Ambient sensor calibration curve (CAL_CURVE_AMBIENT_LUX)
  * @param[in] adcValue ADC value (0-4095)
  * @return Lux value
  */
 static uint16_t LightRequest_AdcToLux(uint16_t adcValue) {
-    /* Simple linear conversion for simulation */
-    /* ADC 800 ~ 200 lux (threshold ON) */
-    /* ADC 1000 ~ 250 lux (threshold OFF) */
-    /* Approximate: lux = ADC / 4 */
-    return adcValue / 4U;
+    return Cal_Convert(CAL_CURVE_AMBIENT_LUX, adcValue);
+}
+
+/**
+ * @brief Report checkpoint to Watchdog Manager
+ * @param[in] checkpointId Checkpoint reached
+ */
+static void LightRequest_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId) {
+    (void)Rte_Call_LightRequest_WdgM_CheckpointReached(
+        LIGHTREQUEST_SE_ID,
+        checkpointId
+    );
 }
 
 /**
@@ -336,6 +362,19 @@ static void LightRequest_ReportDemEvents(void) {
     }
 }
 
+/**
+ * @brief Publish ambient light level and signal status in one port write
+ */
+static void LightRequest_WriteOutputs(void) {
+    Rte_IrvAmbientLightType output;
+
+    output.level = LightRequest_State.ambientLight;
+    output.status = LightRequest_State.signalStatus;
+    output.timestamp = LightRequest_State.currentTimestamp;
+
+    (void)Rte_Write_LightRequest_AmbientLight(&output);
+}
+
 /*============================================================================*
  * PUBLIC INTERFACE FUNCTIONS
  *============================================================================*/
@@ -360,6 +399,21 @@ boolean LightRequest_IsPlausibilityFault(void) {
     return LightRequest_State.plausibilityFault;
 }
 
+Std_ReturnType LightRequest_SetFilterChain(const LightRequest_FilterStageConfigType* Stages,
+                                           uint8_t NumStages) {
+    LightRequest_FilterChainType* chain = &LightRequest_State.filter;
+    static LightRequest_FilterChainType candidate;
+
+    if (LightRequest_FilterInit(&candidate, Stages, NumStages) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    *chain = candidate;
+    LightRequest_State.adcSampleCount = 0U;
+
+    return E_OK;
+}
+
 void LightRequest_SimSetAdcValue(uint16_t value) {
     LightRequest_SimAdcValue = value;
     LightRequest_SimAdcEnabled = TRUE;
@@ -369,6 +423,22 @@ const LightRequest_StateType* LightRequest_GetState(void) {
     return &LightRequest_State;
 }
 
+void LightRequest_SaveSnapshot(LightRequest_SnapshotType* snapshot) {
+    snapshot->State = LightRequest_State;
+    snapshot->SystemTime = LightRequest_SystemTime;
+    (void)memcpy(snapshot->AdcStream, LightRequest_AdcStream, sizeof(LightRequest_AdcStream));
+    snapshot->SimAdcValue = LightRequest_SimAdcValue;
+    snapshot->SimAdcEnabled = LightRequest_SimAdcEnabled;
+}
+
+void LightRequest_RestoreSnapshot(const LightRequest_SnapshotType* snapshot) {
+    LightRequest_State = snapshot->State;
+    LightRequest_SystemTime = snapshot->SystemTime;
+    (void)memcpy(LightRequest_AdcStream, snapshot->AdcStream, sizeof(LightRequest_AdcStream));
+    LightRequest_SimAdcValue = snapshot->SimAdcValue;
+    LightRequest_SimAdcEnabled = snapshot->SimAdcEnabled;
+}
+
 /*============================================================================*
  * RTE PORT IMPLEMENTATIONS (STUBS)
  *============================================================================*/
@@ -381,16 +451,6 @@ Rte_StatusType Rte_Read_LightRequest_AdcAmbientLight(uint16_t* adcValue) {
     return RTE_E_OK;
 }
 
-Rte_StatusType Rte_Write_LightRequest_AmbientLightLevel(const AmbientLightLevel* level) {
-    STD_UNUSED(level);
-    return RTE_E_OK;
-}
-
-Rte_StatusType Rte_Write_LightRequest_SignalStatus(SignalStatus status) {
-    STD_UNUSED(status);
-    return RTE_E_OK;
-}
-
 Rte_StatusType Rte_Call_LightRequest_Adc_StartConversion(uint8_t channel) {
     Adc_StartGroupConversion(channel);
     return RTE_E_OK;
@@ -409,8 +469,9 @@ Rte_StatusType Rte_Call_LightRequest_WdgM_CheckpointReached(
     WdgM_SupervisedEntityIdType SEId,
     WdgM_CheckpointIdType CPId
 ) {
-    STD_UNUSED(SEId);
-    STD_UNUSED(CPId);
+    if (WdgM_CheckpointReached(SEId, CPId) != E_OK) {
+        return RTE_E_INVALID;
+    }
     return RTE_E_OK;
 }
 
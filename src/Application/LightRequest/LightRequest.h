@@ -17,7 +17,9 @@
  * INCLUDES
  *============================================================================*/
 #include "Rte/Rte_LightRequest.h"
+#include "MCAL/Adc/Adc.h"
 #include "FLM_Config.h"
+#include "LightRequest_Filter.h"
 
 /*============================================================================*
  * CONFIGURATION
@@ -41,8 +43,7 @@ typedef struct {
     boolean isInitialized;
 
     /* ADC data and filtering */
-    uint16_t adcBuffer[LIGHTREQUEST_ADC_BUFFER_SIZE];
-    uint8_t adcBufferIndex;
+    LightRequest_FilterChainType filter;
     uint8_t adcSampleCount;
     uint16_t adcFilteredValue;
     uint16_t adcRawValue;
@@ -67,6 +68,17 @@ typedef struct {
     boolean conversionPending;
 } LightRequest_StateType;
 
+/**
+ * @brief LightRequest snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    LightRequest_StateType State;
+    uint32_t SystemTime;
+    Adc_ValueGroupType AdcStream[ADC_AMBIENT_STREAM_SAMPLES];
+    uint16_t SimAdcValue;
+    boolean SimAdcEnabled;
+} LightRequest_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -114,6 +126,18 @@ uint16_t LightRequest_GetRateOfChange(void);
  */
 boolean LightRequest_IsPlausibilityFault(void);
 
+/**
+ * @brief Replace the filter chain (tuning, testing)
+ * @details Restarts filtering; the signal is invalid again until
+ *          FLM_ADC_SAMPLES cycles have passed
+ * @param[in] Stages Stage configurations in processing order
+ * @param[in] NumStages Number of stages
+ * @return E_OK on success, E_NOT_OK on invalid configuration (the
+ *         configured chain stays active)
+ */
+Std_ReturnType LightRequest_SetFilterChain(const LightRequest_FilterStageConfigType* Stages,
+                                           uint8_t NumStages);
+
 /**
  * @brief Set simulated ADC value (for testing)
  * @param[in] value ADC value to simulate
@@ -126,4 +150,16 @@ void LightRequest_SimSetAdcValue(uint16_t value);
  */
 const LightRequest_StateType* LightRequest_GetState(void);
 
+/**
+ * @brief Save component state (Ecu_SaveSnapshot)
+ * @param[out] snapshot Component state
+ */
+void LightRequest_SaveSnapshot(LightRequest_SnapshotType* snapshot);
+
+/**
+ * @brief Restore component state (Ecu_RestoreSnapshot)
+ * @param[in] snapshot Component state
+ */
+void LightRequest_RestoreSnapshot(const LightRequest_SnapshotType* snapshot);
+
 #endif /* LIGHTREQUEST_H */
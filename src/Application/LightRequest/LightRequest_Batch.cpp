@@ -0,0 +1,756 @@
+/**
+ * @file LightRequest_Batch.cpp
+ * @brief LightRequest Batch Evaluation Implementation
+ * @details Each filter stage and the checks run as one loop over all
+ *          channels. The SSE4.1 and AVX2 loops are compiled with function
+ *          target attributes and selected at runtime; channels left over at
+ *          the end of a vector loop run through the scalar loop.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Simulation support, not part of the ECU signal path
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "LightRequest_Batch.h"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LIGHTREQUEST_BATCH_X86              STD_ON
+#include <immintrin.h>
+#define LIGHTREQUEST_BATCH_TARGET_SSE41     __attribute__((target("sse4.1")))
+#define LIGHTREQUEST_BATCH_TARGET_AVX2      __attribute__((target("avx2")))
+#else
+#define LIGHTREQUEST_BATCH_X86              STD_OFF
+#endif
+
+/*============================================================================*
+ * LOCAL TYPES AND MACROS
+ *============================================================================*/
+
+/** @brief IIR coefficient fraction bits (Q15) */
+#define LIGHTREQUEST_BATCH_IIR_SHIFT        15U
+
+/**
+ * @brief Per cycle data of a filter stage, the same for all channels
+ */
+typedef struct {
+    boolean Full;               /**< Moving average: oldest sample drops out */
+    uint16_t Index;             /**< Moving average: History slot of the new sample */
+    uint16_t Count;             /**< Moving average: samples after the update */
+    boolean First;              /**< IIR: first sample, state starts at it */
+} LightRequest_BatchStageStepType;
+
+/**
+ * @brief Per cycle data of the checks, the same for all channels
+ */
+typedef struct {
+    boolean Settled;            /**< Filter settled: signal may be valid */
+    boolean RateCheck;          /**< 100ms passed: compare rate of change */
+} LightRequest_BatchCheckStepType;
+
+/* Fault statuses are the highest values; everything below is re-qualified */
+STD_STATIC_ASSERT((SIGNAL_STATUS_OPEN_CIRCUIT > SIGNAL_STATUS_TIMEOUT) &&
+                  (SIGNAL_STATUS_SHORT_CIRCUIT > SIGNAL_STATUS_OPEN_CIRCUIT) &&
+                  (SIGNAL_STATUS_PLAUSIBILITY > SIGNAL_STATUS_SHORT_CIRCUIT),
+                  "Batch status handling expects fault statuses last");
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static void LightRequest_BatchMovingAverage(LightRequest_BatchType* Batch, uint8_t Stage,
+                                            const LightRequest_BatchStageStepType* Step);
+static void LightRequest_BatchIir(LightRequest_BatchType* Batch, uint8_t Stage,
+                                  const LightRequest_BatchStageStepType* Step);
+static void LightRequest_BatchChecks(LightRequest_BatchType* Batch,
+                                     const LightRequest_BatchCheckStepType* Step);
+
+static void LightRequest_BatchMovingAverageScalar(LightRequest_BatchType* Batch, uint8_t Stage,
+                                                  const LightRequest_BatchStageStepType* Step,
+                                                  uint16_t Begin);
+static void LightRequest_BatchIirScalar(LightRequest_BatchType* Batch, uint8_t Stage,
+                                        const LightRequest_BatchStageStepType* Step,
+                                        uint16_t Begin);
+static void LightRequest_BatchChecksScalar(LightRequest_BatchType* Batch,
+                                           const LightRequest_BatchCheckStepType* Step,
+                                           uint16_t Begin);
+
+#if (LIGHTREQUEST_BATCH_X86 == STD_ON)
+static uint16_t LightRequest_BatchMovingAverageSse41(LightRequest_BatchType* Batch, uint8_t Stage,
+                                                     const LightRequest_BatchStageStepType* Step);
+static uint16_t LightRequest_BatchIirSse41(LightRequest_BatchType* Batch, uint8_t Stage,
+                                           const LightRequest_BatchStageStepType* Step);
+static uint16_t LightRequest_BatchChecksSse41(LightRequest_BatchType* Batch,
+                                              const LightRequest_BatchCheckStepType* Step);
+static uint16_t LightRequest_BatchMovingAverageAvx2(LightRequest_BatchType* Batch, uint8_t Stage,
+                                                    const LightRequest_BatchStageStepType* Step);
+static uint16_t LightRequest_BatchIirAvx2(LightRequest_BatchType* Batch, uint8_t Stage,
+                                          const LightRequest_BatchStageStepType* Step);
+static uint16_t LightRequest_BatchChecksAvx2(LightRequest_BatchType* Batch,
+                                             const LightRequest_BatchCheckStepType* Step);
+#endif
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Set up a batch
+ */
+Std_ReturnType LightRequest_BatchInit(LightRequest_BatchType* Batch, uint16_t NumChannels,
+                                      const LightRequest_FilterStageConfigType* Stages,
+                                      uint8_t NumStages) {
+    uint16_t param;
+    uint8_t i;
+
+    if ((Batch == NULL_PTR) || (NumChannels == 0U) ||
+        (NumChannels > LIGHTREQUEST_BATCH_MAX_CHANNELS) ||
+        (NumStages > LIGHTREQUEST_FILTER_MAX_STAGES) ||
+        ((NumStages > 0U) && (Stages == NULL_PTR))) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0U; i < NumStages; i++) {
+        param = Stages[i].Param;
+        switch (Stages[i].Type) {
+            case LIGHTREQUEST_FILTER_MOVING_AVERAGE:
+                /* Window sums stay below 2^24: the float division is exact */
+                if ((param < 1U) || (param > LIGHTREQUEST_BATCH_MAX_WINDOW)) {
+                    return E_NOT_OK;
+                }
+                break;
+
+            case LIGHTREQUEST_FILTER_IIR_LOWPASS:
+                if ((param < 1U) || (param > LIGHTREQUEST_FILTER_IIR_ONE)) {
+                    return E_NOT_OK;
+                }
+                break;
+
+            default:
+                /* Median needs a sort per channel, not supported */
+                return E_NOT_OK;
+        }
+    }
+
+    (void)std::memset(Batch, 0, sizeof(*Batch));
+    (void)std::memset(Batch->Status, static_cast<int>(SIGNAL_STATUS_INVALID), sizeof(Batch->Status));
+
+    for (i = 0U; i < NumStages; i++) {
+        Batch->Stages[i] = Stages[i];
+    }
+    Batch->NumStages = NumStages;
+    Batch->NumChannels = NumChannels;
+
+    if (LightRequest_BatchIsaSupported(LIGHTREQUEST_BATCH_ISA_AVX2)) {
+        Batch->Isa = LIGHTREQUEST_BATCH_ISA_AVX2;
+    } else if (LightRequest_BatchIsaSupported(LIGHTREQUEST_BATCH_ISA_SSE41)) {
+        Batch->Isa = LIGHTREQUEST_BATCH_ISA_SSE41;
+    } else {
+        Batch->Isa = LIGHTREQUEST_BATCH_ISA_SCALAR;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Evaluate one LightRequest cycle for all channels
+ * @details Same order as LightRequest_MainFunction: filter, sample count,
+ *          open and short circuit, plausibility, output qualification
+ */
+void LightRequest_BatchUpdate(LightRequest_BatchType* Batch, const uint16_t* Samples) {
+    LightRequest_BatchStageStepType stageStep;
+    LightRequest_BatchCheckStepType checkStep;
+    uint8_t s;
+
+    if ((Batch == NULL_PTR) || (Samples == NULL_PTR) || (Batch->NumChannels == 0U)) {
+        return;
+    }
+
+    /* Stages filter Filtered in place */
+    (void)std::memcpy(Batch->Filtered, Samples,
+                      static_cast<size_t>(Batch->NumChannels) * sizeof(uint16_t));
+
+    for (s = 0U; s < Batch->NumStages; s++) {
+        stageStep.Full = (Batch->StageCount[s] == Batch->Stages[s].Param) ? TRUE : FALSE;
+        stageStep.Index = Batch->StageIndex[s];
+        stageStep.Count = stageStep.Full ? Batch->StageCount[s] :
+                          static_cast<uint16_t>(Batch->StageCount[s] + 1U);
+        stageStep.First = (Batch->StageCount[s] == 0U) ? TRUE : FALSE;
+
+        if (Batch->Stages[s].Type == LIGHTREQUEST_FILTER_MOVING_AVERAGE) {
+            LightRequest_BatchMovingAverage(Batch, s, &stageStep);
+
+            Batch->StageCount[s] = stageStep.Count;
+            Batch->StageIndex[s]++;
+            if (Batch->StageIndex[s] >= Batch->Stages[s].Param) {
+                Batch->StageIndex[s] = 0U;
+            }
+        } else {
+            LightRequest_BatchIir(Batch, s, &stageStep);
+            Batch->StageCount[s] = 1U;
+        }
+    }
+
+    if (Batch->SampleCount < FLM_ADC_SAMPLES) {
+        Batch->SampleCount++;
+    }
+
+    /* Rate of change every 100ms, as in LightRequest_CheckPlausibility */
+    Batch->RateCheckCounter++;
+    checkStep.RateCheck = (Batch->RateCheckCounter >= LIGHTREQUEST_RATE_CHECK_CYCLES) ? TRUE : FALSE;
+    if (checkStep.RateCheck) {
+        Batch->RateCheckCounter = 0U;
+    }
+    checkStep.Settled = (Batch->SampleCount >= FLM_ADC_SAMPLES) ? TRUE : FALSE;
+
+    LightRequest_BatchChecks(Batch, &checkStep);
+}
+
+/**
+ * @brief Check if an implementation can run on this build and CPU
+ */
+boolean LightRequest_BatchIsaSupported(LightRequest_BatchIsaType Isa) {
+    switch (Isa) {
+        case LIGHTREQUEST_BATCH_ISA_SCALAR:
+            return TRUE;
+
+#if (LIGHTREQUEST_BATCH_X86 == STD_ON)
+        case LIGHTREQUEST_BATCH_ISA_SSE41:
+            return (__builtin_cpu_supports("sse4.1") != 0) ? TRUE : FALSE;
+
+        case LIGHTREQUEST_BATCH_ISA_AVX2:
+            return (__builtin_cpu_supports("avx2") != 0) ? TRUE : FALSE;
+#endif
+
+        default:
+            return FALSE;
+    }
+}
+
+/**
+ * @brief Select the implementation
+ */
+Std_ReturnType LightRequest_BatchSetIsa(LightRequest_BatchType* Batch, LightRequest_BatchIsaType Isa) {
+    if ((Batch == NULL_PTR) || (!LightRequest_BatchIsaSupported(Isa))) {
+        return E_NOT_OK;
+    }
+
+    Batch->Isa = Isa;
+    return E_OK;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS - DISPATCH
+ *============================================================================*/
+
+/**
+ * @brief Moving average stage over all channels
+ */
+static void LightRequest_BatchMovingAverage(LightRequest_BatchType* Batch, uint8_t Stage,
+                                            const LightRequest_BatchStageStepType* Step) {
+    uint16_t done = 0U;
+
+#if (LIGHTREQUEST_BATCH_X86 == STD_ON)
+    if (Batch->Isa == LIGHTREQUEST_BATCH_ISA_AVX2) {
+        done = LightRequest_BatchMovingAverageAvx2(Batch, Stage, Step);
+    } else if (Batch->Isa == LIGHTREQUEST_BATCH_ISA_SSE41) {
+        done = LightRequest_BatchMovingAverageSse41(Batch, Stage, Step);
+    }
+#endif
+
+    LightRequest_BatchMovingAverageScalar(Batch, Stage, Step, done);
+}
+
+/**
+ * @brief IIR stage over all channels
+ */
+static void LightRequest_BatchIir(LightRequest_BatchType* Batch, uint8_t Stage,
+                                  const LightRequest_BatchStageStepType* Step) {
+    uint16_t done = 0U;
+
+#if (LIGHTREQUEST_BATCH_X86 == STD_ON)
+    if (Batch->Isa == LIGHTREQUEST_BATCH_ISA_AVX2) {
+        done = LightRequest_BatchIirAvx2(Batch, Stage, Step);
+    } else if (Batch->Isa == LIGHTREQUEST_BATCH_ISA_SSE41) {
+        done = LightRequest_BatchIirSse41(Batch, Stage, Step);
+    }
+#endif
+
+    LightRequest_BatchIirScalar(Batch, Stage, Step, done);
+}
+
+/**
+ * @brief Checks and output qualification over all channels
+ */
+static void LightRequest_BatchChecks(LightRequest_BatchType* Batch,
+                                     const LightRequest_BatchCheckStepType* Step) {
+    uint16_t done = 0U;
+
+#if (LIGHTREQUEST_BATCH_X86 == STD_ON)
+    if (Batch->Isa == LIGHTREQUEST_BATCH_ISA_AVX2) {
+        done = LightRequest_BatchChecksAvx2(Batch, Step);
+    } else if (Batch->Isa == LIGHTREQUEST_BATCH_ISA_SSE41) {
+        done = LightRequest_BatchChecksSse41(Batch, Step);
+    }
+#endif
+
+    LightRequest_BatchChecksScalar(Batch, Step, done);
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS - SCALAR
+ *============================================================================*/
+
+/**
+ * @brief Moving average, channels Begin..NumChannels-1
+ */
+static void LightRequest_BatchMovingAverageScalar(LightRequest_BatchType* Batch, uint8_t Stage,
+                                                  const LightRequest_BatchStageStepType* Step,
+                                                  uint16_t Begin) {
+    uint16_t* history = Batch->History[Stage][Step->Index];
+    uint32_t* sum = Batch->Sum[Stage];
+    uint16_t* value = Batch->Filtered;
+    uint16_t c;
+
+    for (c = Begin; c < Batch->NumChannels; c++) {
+        if (Step->Full) {
+            sum[c] -= history[c];
+        }
+        history[c] = value[c];
+        sum[c] += value[c];
+        value[c] = static_cast<uint16_t>(sum[c] / Step->Count);
+    }
+}
+
+/**
+ * @brief IIR low-pass, channels Begin..NumChannels-1
+ */
+static void LightRequest_BatchIirScalar(LightRequest_BatchType* Batch, uint8_t Stage,
+                                        const LightRequest_BatchStageStepType* Step,
+                                        uint16_t Begin) {
+    const int64_t param = static_cast<int64_t>(Batch->Stages[Stage].Param);
+    int32_t* state = Batch->IirState[Stage];
+    uint16_t* value = Batch->Filtered;
+    int32_t input;
+    int64_t step;
+    uint16_t c;
+
+    for (c = Begin; c < Batch->NumChannels; c++) {
+        input = static_cast<int32_t>(static_cast<uint32_t>(value[c]) << 16U);
+        if (Step->First) {
+            state[c] = input;
+        } else {
+            step = (static_cast<int64_t>(input - state[c]) * param) / 32768;
+            state[c] += static_cast<int32_t>(step);
+        }
+        value[c] = static_cast<uint16_t>((state[c] + 0x8000) >> 16U);
+    }
+}
+
+/**
+ * @brief Checks and output qualification, channels Begin..NumChannels-1
+ */
+static void LightRequest_BatchChecksScalar(LightRequest_BatchType* Batch,
+                                           const LightRequest_BatchCheckStepType* Step,
+                                           uint16_t Begin) {
+    uint16_t filtered;
+    uint8_t status;
+    int32_t delta;
+    uint16_t c;
+
+    for (c = Begin; c < Batch->NumChannels; c++) {
+        filtered = Batch->Filtered[c];
+        status = Batch->Status[c];
+
+        if (filtered < FLM_AMBIENT_OPEN_CIRCUIT) {
+            status = SIGNAL_STATUS_OPEN_CIRCUIT;
+        }
+        if (filtered > FLM_AMBIENT_SHORT_CIRCUIT) {
+            status = SIGNAL_STATUS_SHORT_CIRCUIT;
+        }
+
+        if (Step->RateCheck) {
+            delta = static_cast<int32_t>(filtered) - static_cast<int32_t>(Batch->PreviousFiltered[c]);
+            if (delta < 0) {
+                delta = -delta;
+            }
+            Batch->RateOfChange[c] = static_cast<uint16_t>(delta);
+
+            if (delta > static_cast<int32_t>(FLM_AMBIENT_RATE_LIMIT)) {
+                if (Batch->PlausibilityErrorCount[c] < LIGHTREQUEST_PLAUSIBILITY_DEBOUNCE) {
+                    Batch->PlausibilityErrorCount[c]++;
+                }
+                if (Batch->PlausibilityErrorCount[c] >= LIGHTREQUEST_PLAUSIBILITY_DEBOUNCE) {
+                    Batch->PlausibilityFault[c] = TRUE;
+                    status = SIGNAL_STATUS_PLAUSIBILITY;
+                }
+            } else {
+                Batch->PlausibilityErrorCount[c] = 0U;
+                Batch->PlausibilityFault[c] = FALSE;
+            }
+
+            Batch->PreviousFiltered[c] = filtered;
+        }
+
+        if (status < SIGNAL_STATUS_OPEN_CIRCUIT) {
+            status = Step->Settled ? SIGNAL_STATUS_VALID : SIGNAL_STATUS_INVALID;
+        }
+        Batch->Status[c] = status;
+    }
+}
+
+#if (LIGHTREQUEST_BATCH_X86 == STD_ON)
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS - SSE4.1 (4 channels per vector)
+ *============================================================================*/
+
+LIGHTREQUEST_BATCH_TARGET_SSE41
+static inline __m128i LightRequest_BatchLoadU16Sse41(const uint16_t* p) {
+    return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+}
+
+LIGHTREQUEST_BATCH_TARGET_SSE41
+static inline __m128i LightRequest_BatchLoadU8Sse41(const uint8_t* p) {
+    int32_t bytes;
+    (void)std::memcpy(&bytes, p, sizeof(bytes));
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes));
+}
+
+LIGHTREQUEST_BATCH_TARGET_SSE41
+static inline void LightRequest_BatchStoreU16Sse41(uint16_t* p, __m128i v) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi32(v, v));
+}
+
+LIGHTREQUEST_BATCH_TARGET_SSE41
+static inline void LightRequest_BatchStoreU8Sse41(uint8_t* p, __m128i v) {
+    const __m128i words = _mm_packus_epi32(v, v);
+    const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+    (void)std::memcpy(p, &bytes, sizeof(bytes));
+}
+
+/**
+ * @brief Moving average, 4 channels per iteration
+ * @details Window sums are below 2^24 and the count at most 16, so the
+ *          truncated float quotient equals the integer quotient
+ * @return Channels done
+ */
+LIGHTREQUEST_BATCH_TARGET_SSE41
+static uint16_t LightRequest_BatchMovingAverageSse41(LightRequest_BatchType* Batch, uint8_t Stage,
+                                                     const LightRequest_BatchStageStepType* Step) {
+    const uint16_t end = static_cast<uint16_t>(Batch->NumChannels & ~3U);
+    const __m128 count = _mm_set1_ps(static_cast<float32>(Step->Count));
+    uint16_t* history = Batch->History[Stage][Step->Index];
+    uint32_t* sums = Batch->Sum[Stage];
+    uint16_t* value = Batch->Filtered;
+    __m128i x;
+    __m128i sum;
+    uint16_t c;
+
+    for (c = 0U; c < end; c += 4U) {
+        x = LightRequest_BatchLoadU16Sse41(&value[c]);
+        sum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sums[c]));
+        if (Step->Full) {
+            sum = _mm_sub_epi32(sum, LightRequest_BatchLoadU16Sse41(&history[c]));
+        }
+        sum = _mm_add_epi32(sum, x);
+        LightRequest_BatchStoreU16Sse41(&history[c], x);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&sums[c]), sum);
+        LightRequest_BatchStoreU16Sse41(&value[c],
+            _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(sum), count)));
+    }
+
+    return end;
+}
+
+/**
+ * @brief IIR low-pass, 4 channels per iteration
+ * @details (input - state) * coefficient needs 44 bits. The difference is
+ *          split at bit 15 so both products fit 32 bits; the remainder of the
+ *          low product corrects the quotient to truncation toward zero.
+ * @return Channels done
+ */
+LIGHTREQUEST_BATCH_TARGET_SSE41
+static uint16_t LightRequest_BatchIirSse41(LightRequest_BatchType* Batch, uint8_t Stage,
+                                           const LightRequest_BatchStageStepType* Step) {
+    const uint16_t end = static_cast<uint16_t>(Batch->NumChannels & ~3U);
+    const __m128i param = _mm_set1_epi32(static_cast<int32_t>(Batch->Stages[Stage].Param));
+    const __m128i fraction = _mm_set1_epi32(0x7FFF);
+    const __m128i half = _mm_set1_epi32(0x8000);
+    const __m128i zero = _mm_setzero_si128();
+    int32_t* states = Batch->IirState[Stage];
+    uint16_t* value = Batch->Filtered;
+    __m128i input;
+    __m128i state;
+    __m128i diff;
+    __m128i high;
+    __m128i low;
+    __m128i step;
+    __m128i round;
+    uint16_t c;
+
+    for (c = 0U; c < end; c += 4U) {
+        input = _mm_slli_epi32(LightRequest_BatchLoadU16Sse41(&value[c]), 16);
+        if (Step->First) {
+            state = input;
+        } else {
+            state = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&states[c]));
+            diff = _mm_sub_epi32(input, state);
+            low = _mm_mullo_epi32(_mm_and_si128(diff, fraction), param);
+            high = _mm_srai_epi32(diff, static_cast<int>(LIGHTREQUEST_BATCH_IIR_SHIFT));
+            step = _mm_add_epi32(_mm_mullo_epi32(high, param),
+                                 _mm_srli_epi32(low, static_cast<int>(LIGHTREQUEST_BATCH_IIR_SHIFT)));
+            round = _mm_and_si128(_mm_cmpgt_epi32(zero, diff),
+                                  _mm_cmpgt_epi32(_mm_and_si128(low, fraction), zero));
+            state = _mm_add_epi32(state, _mm_sub_epi32(step, round));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&states[c]), state);
+        LightRequest_BatchStoreU16Sse41(&value[c], _mm_srai_epi32(_mm_add_epi32(state, half), 16));
+    }
+
+    return end;
+}
+
+/**
+ * @brief Checks and output qualification, 4 channels per iteration
+ * @return Channels done
+ */
+LIGHTREQUEST_BATCH_TARGET_SSE41
+static uint16_t LightRequest_BatchChecksSse41(LightRequest_BatchType* Batch,
+                                              const LightRequest_BatchCheckStepType* Step) {
+    const uint16_t end = static_cast<uint16_t>(Batch->NumChannels & ~3U);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i openLimit = _mm_set1_epi32(static_cast<int32_t>(FLM_AMBIENT_OPEN_CIRCUIT));
+    const __m128i shortLimit = _mm_set1_epi32(static_cast<int32_t>(FLM_AMBIENT_SHORT_CIRCUIT));
+    const __m128i rateLimit = _mm_set1_epi32(static_cast<int32_t>(FLM_AMBIENT_RATE_LIMIT));
+    const __m128i debounce = _mm_set1_epi32(static_cast<int32_t>(LIGHTREQUEST_PLAUSIBILITY_DEBOUNCE));
+    const __m128i open = _mm_set1_epi32(SIGNAL_STATUS_OPEN_CIRCUIT);
+    const __m128i shorted = _mm_set1_epi32(SIGNAL_STATUS_SHORT_CIRCUIT);
+    const __m128i plausibility = _mm_set1_epi32(SIGNAL_STATUS_PLAUSIBILITY);
+    const __m128i lastUnfaulted = _mm_set1_epi32(SIGNAL_STATUS_OPEN_CIRCUIT - 1);
+    const __m128i qualified =
+        _mm_set1_epi32(Step->Settled ? SIGNAL_STATUS_VALID : SIGNAL_STATUS_INVALID);
+    __m128i filtered;
+    __m128i status;
+    __m128i delta;
+    __m128i exceeded;
+    __m128i count;
+    __m128i set;
+    __m128i fault;
+    uint16_t c;
+
+    for (c = 0U; c < end; c += 4U) {
+        filtered = LightRequest_BatchLoadU16Sse41(&Batch->Filtered[c]);
+        status = LightRequest_BatchLoadU8Sse41(&Batch->Status[c]);
+
+        status = _mm_blendv_epi8(status, open, _mm_cmpgt_epi32(openLimit, filtered));
+        status = _mm_blendv_epi8(status, shorted, _mm_cmpgt_epi32(filtered, shortLimit));
+
+        if (Step->RateCheck) {
+            delta = LightRequest_BatchLoadU16Sse41(&Batch->PreviousFiltered[c]);
+            delta = _mm_abs_epi32(_mm_sub_epi32(filtered, delta));
+            LightRequest_BatchStoreU16Sse41(&Batch->RateOfChange[c], delta);
+
+            exceeded = _mm_cmpgt_epi32(delta, rateLimit);
+            count = LightRequest_BatchLoadU8Sse41(&Batch->PlausibilityErrorCount[c]);
+            count = _mm_min_epi32(_mm_add_epi32(count, one), debounce);
+            count = _mm_and_si128(count, exceeded);
+            LightRequest_BatchStoreU8Sse41(&Batch->PlausibilityErrorCount[c], count);
+
+            /* Set on the debounced violation, cleared by a plausible rate */
+            set = _mm_cmpeq_epi32(count, debounce);
+            fault = LightRequest_BatchLoadU8Sse41(&Batch->PlausibilityFault[c]);
+            fault = _mm_and_si128(_mm_or_si128(fault, _mm_and_si128(set, one)), exceeded);
+            LightRequest_BatchStoreU8Sse41(&Batch->PlausibilityFault[c], fault);
+            status = _mm_blendv_epi8(status, plausibility, set);
+
+            LightRequest_BatchStoreU16Sse41(&Batch->PreviousFiltered[c], filtered);
+        }
+
+        status = _mm_blendv_epi8(qualified, status, _mm_cmpgt_epi32(status, lastUnfaulted));
+        LightRequest_BatchStoreU8Sse41(&Batch->Status[c], status);
+    }
+
+    return end;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS - AVX2 (8 channels per vector)
+ *============================================================================*/
+
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static inline __m256i LightRequest_BatchLoadU16Avx2(const uint16_t* p) {
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+}
+
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static inline __m256i LightRequest_BatchLoadU8Avx2(const uint8_t* p) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+}
+
+/** @brief Narrow 8 x 32 bit to 8 x 16 bit (packs work per 128-bit lane) */
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static inline __m128i LightRequest_BatchPackU16Avx2(__m256i v) {
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(v, v), 0x08));
+}
+
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static inline void LightRequest_BatchStoreU16Avx2(uint16_t* p, __m256i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), LightRequest_BatchPackU16Avx2(v));
+}
+
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static inline void LightRequest_BatchStoreU8Avx2(uint8_t* p, __m256i v) {
+    const __m128i words = LightRequest_BatchPackU16Avx2(v);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(words, words));
+}
+
+/**
+ * @brief Moving average, 8 channels per iteration
+ * @details See LightRequest_BatchMovingAverageSse41
+ * @return Channels done
+ */
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static uint16_t LightRequest_BatchMovingAverageAvx2(LightRequest_BatchType* Batch, uint8_t Stage,
+                                                    const LightRequest_BatchStageStepType* Step) {
+    const uint16_t end = static_cast<uint16_t>(Batch->NumChannels & ~7U);
+    const __m256 count = _mm256_set1_ps(static_cast<float32>(Step->Count));
+    uint16_t* history = Batch->History[Stage][Step->Index];
+    uint32_t* sums = Batch->Sum[Stage];
+    uint16_t* value = Batch->Filtered;
+    __m256i x;
+    __m256i sum;
+    uint16_t c;
+
+    for (c = 0U; c < end; c += 8U) {
+        x = LightRequest_BatchLoadU16Avx2(&value[c]);
+        sum = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&sums[c]));
+        if (Step->Full) {
+            sum = _mm256_sub_epi32(sum, LightRequest_BatchLoadU16Avx2(&history[c]));
+        }
+        sum = _mm256_add_epi32(sum, x);
+        LightRequest_BatchStoreU16Avx2(&history[c], x);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&sums[c]), sum);
+        LightRequest_BatchStoreU16Avx2(&value[c],
+            _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(sum), count)));
+    }
+
+    return end;
+}
+
+/**
+ * @brief IIR low-pass, 8 channels per iteration
+ * @details See LightRequest_BatchIirSse41
+ * @return Channels done
+ */
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static uint16_t LightRequest_BatchIirAvx2(LightRequest_BatchType* Batch, uint8_t Stage,
+                                          const LightRequest_BatchStageStepType* Step) {
+    const uint16_t end = static_cast<uint16_t>(Batch->NumChannels & ~7U);
+    const __m256i param = _mm256_set1_epi32(static_cast<int32_t>(Batch->Stages[Stage].Param));
+    const __m256i fraction = _mm256_set1_epi32(0x7FFF);
+    const __m256i half = _mm256_set1_epi32(0x8000);
+    const __m256i zero = _mm256_setzero_si256();
+    int32_t* states = Batch->IirState[Stage];
+    uint16_t* value = Batch->Filtered;
+    __m256i input;
+    __m256i state;
+    __m256i diff;
+    __m256i high;
+    __m256i low;
+    __m256i step;
+    __m256i round;
+    uint16_t c;
+
+    for (c = 0U; c < end; c += 8U) {
+        input = _mm256_slli_epi32(LightRequest_BatchLoadU16Avx2(&value[c]), 16);
+        if (Step->First) {
+            state = input;
+        } else {
+            state = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&states[c]));
+            diff = _mm256_sub_epi32(input, state);
+            low = _mm256_mullo_epi32(_mm256_and_si256(diff, fraction), param);
+            high = _mm256_srai_epi32(diff, static_cast<int>(LIGHTREQUEST_BATCH_IIR_SHIFT));
+            round = _mm256_and_si256(_mm256_cmpgt_epi32(zero, diff),
+                                     _mm256_cmpgt_epi32(_mm256_and_si256(low, fraction), zero));
+            low = _mm256_srli_epi32(low, static_cast<int>(LIGHTREQUEST_BATCH_IIR_SHIFT));
+            step = _mm256_add_epi32(_mm256_mullo_epi32(high, param), low);
+            state = _mm256_add_epi32(state, _mm256_sub_epi32(step, round));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&states[c]), state);
+        LightRequest_BatchStoreU16Avx2(&value[c],
+                                       _mm256_srai_epi32(_mm256_add_epi32(state, half), 16));
+    }
+
+    return end;
+}
+
+/**
+ * @brief Checks and output qualification, 8 channels per iteration
+ * @return Channels done
+ */
+LIGHTREQUEST_BATCH_TARGET_AVX2
+static uint16_t LightRequest_BatchChecksAvx2(LightRequest_BatchType* Batch,
+                                             const LightRequest_BatchCheckStepType* Step) {
+    const uint16_t end = static_cast<uint16_t>(Batch->NumChannels & ~7U);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i openLimit = _mm256_set1_epi32(static_cast<int32_t>(FLM_AMBIENT_OPEN_CIRCUIT));
+    const __m256i shortLimit = _mm256_set1_epi32(static_cast<int32_t>(FLM_AMBIENT_SHORT_CIRCUIT));
+    const __m256i rateLimit = _mm256_set1_epi32(static_cast<int32_t>(FLM_AMBIENT_RATE_LIMIT));
+    const __m256i debounce = _mm256_set1_epi32(static_cast<int32_t>(LIGHTREQUEST_PLAUSIBILITY_DEBOUNCE));
+    const __m256i open = _mm256_set1_epi32(SIGNAL_STATUS_OPEN_CIRCUIT);
+    const __m256i shorted = _mm256_set1_epi32(SIGNAL_STATUS_SHORT_CIRCUIT);
+    const __m256i plausibility = _mm256_set1_epi32(SIGNAL_STATUS_PLAUSIBILITY);
+    const __m256i lastUnfaulted = _mm256_set1_epi32(SIGNAL_STATUS_OPEN_CIRCUIT - 1);
+    const __m256i qualified =
+        _mm256_set1_epi32(Step->Settled ? SIGNAL_STATUS_VALID : SIGNAL_STATUS_INVALID);
+    __m256i filtered;
+    __m256i status;
+    __m256i delta;
+    __m256i exceeded;
+    __m256i count;
+    __m256i set;
+    __m256i fault;
+    uint16_t c;
+
+    for (c = 0U; c < end; c += 8U) {
+        filtered = LightRequest_BatchLoadU16Avx2(&Batch->Filtered[c]);
+        status = LightRequest_BatchLoadU8Avx2(&Batch->Status[c]);
+
+        status = _mm256_blendv_epi8(status, open, _mm256_cmpgt_epi32(openLimit, filtered));
+        status = _mm256_blendv_epi8(status, shorted, _mm256_cmpgt_epi32(filtered, shortLimit));
+
+        if (Step->RateCheck) {
+            delta = LightRequest_BatchLoadU16Avx2(&Batch->PreviousFiltered[c]);
+            delta = _mm256_abs_epi32(_mm256_sub_epi32(filtered, delta));
+            LightRequest_BatchStoreU16Avx2(&Batch->RateOfChange[c], delta);
+
+            exceeded = _mm256_cmpgt_epi32(delta, rateLimit);
+            count = LightRequest_BatchLoadU8Avx2(&Batch->PlausibilityErrorCount[c]);
+            count = _mm256_min_epi32(_mm256_add_epi32(count, one), debounce);
+            count = _mm256_and_si256(count, exceeded);
+            LightRequest_BatchStoreU8Avx2(&Batch->PlausibilityErrorCount[c], count);
+
+            /* Set on the debounced violation, cleared by a plausible rate */
+            set = _mm256_cmpeq_epi32(count, debounce);
+            fault = LightRequest_BatchLoadU8Avx2(&Batch->PlausibilityFault[c]);
+            fault = _mm256_and_si256(_mm256_or_si256(fault, _mm256_and_si256(set, one)), exceeded);
+            LightRequest_BatchStoreU8Avx2(&Batch->PlausibilityFault[c], fault);
+            status = _mm256_blendv_epi8(status, plausibility, set);
+
+            LightRequest_BatchStoreU16Avx2(&Batch->PreviousFiltered[c], filtered);
+        }
+
+        status = _mm256_blendv_epi8(qualified, status, _mm256_cmpgt_epi32(status, lastUnfaulted));
+        LightRequest_BatchStoreU8Avx2(&Batch->Status[c], status);
+    }
+
+    return end;
+}
+
+#endif /* LIGHTREQUEST_BATCH_X86 == STD_ON */
@@ -0,0 +1,117 @@
+/**
+ * @file LightRequest_Batch.h
+ * @brief LightRequest Batch Evaluation of Many Sensor Channels
+ * @details Runs the LightRequest signal path (filter chain, open/short
+ *          circuit thresholds, rate of change plausibility and debounce) for
+ *          up to LIGHTREQUEST_BATCH_MAX_CHANNELS sensors per call, e.g. one
+ *          per vehicle of a fleet simulation. State is held as structure of
+ *          arrays and evaluated with SSE4.1 or AVX2 when the CPU supports it,
+ *          otherwise with a scalar loop. Every implementation gives the same
+ *          results as LightRequest_MainFunction bit for bit.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Simulation support, not part of the ECU signal path
+ */
+
+#ifndef LIGHTREQUEST_BATCH_H
+#define LIGHTREQUEST_BATCH_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "LightRequest.h"
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Instruction set of the batch evaluation
+ */
+typedef enum {
+    LIGHTREQUEST_BATCH_ISA_SCALAR   = 0x00U,    /**< Portable scalar loop */
+    LIGHTREQUEST_BATCH_ISA_SSE41    = 0x01U,    /**< 4 channels per instruction */
+    LIGHTREQUEST_BATCH_ISA_AVX2     = 0x02U     /**< 8 channels per instruction */
+} LightRequest_BatchIsaType;
+
+/**
+ * @brief Batch state (structure of arrays, indexed by channel)
+ * @details Filter windows advance together for all channels, so window
+ *          position and fill level are kept once per stage. Results of the
+ *          last LightRequest_BatchUpdate are read from Filtered, Status,
+ *          RateOfChange and PlausibilityFault; a channel is valid if its
+ *          status is SIGNAL_STATUS_VALID. About 690 KiB, allocate statically
+ *          or on the heap.
+ */
+typedef struct {
+    uint16_t NumChannels;                               /**< Channels in use */
+    uint8_t NumStages;                                  /**< Filter stages */
+    LightRequest_BatchIsaType Isa;                      /**< Selected implementation */
+    LightRequest_FilterStageConfigType Stages[LIGHTREQUEST_FILTER_MAX_STAGES];
+    uint16_t StageIndex[LIGHTREQUEST_FILTER_MAX_STAGES];/**< Oldest sample in History */
+    uint16_t StageCount[LIGHTREQUEST_FILTER_MAX_STAGES];/**< Samples in the window */
+    uint8_t SampleCount;                                /**< Cycles, up to FLM_ADC_SAMPLES */
+    uint8_t RateCheckCounter;                           /**< Cycles since the last rate check */
+
+    /* Filter state per stage */
+    uint32_t Sum[LIGHTREQUEST_FILTER_MAX_STAGES][LIGHTREQUEST_BATCH_MAX_CHANNELS];
+    int32_t IirState[LIGHTREQUEST_FILTER_MAX_STAGES][LIGHTREQUEST_BATCH_MAX_CHANNELS];
+    uint16_t History[LIGHTREQUEST_FILTER_MAX_STAGES][LIGHTREQUEST_BATCH_MAX_WINDOW]
+                    [LIGHTREQUEST_BATCH_MAX_CHANNELS];
+
+    /* Plausibility state */
+    uint16_t PreviousFiltered[LIGHTREQUEST_BATCH_MAX_CHANNELS]; /**< Value at the last rate check */
+    uint8_t PlausibilityErrorCount[LIGHTREQUEST_BATCH_MAX_CHANNELS];
+
+    /* Results */
+    uint16_t Filtered[LIGHTREQUEST_BATCH_MAX_CHANNELS];     /**< Filtered ADC value */
+    uint16_t RateOfChange[LIGHTREQUEST_BATCH_MAX_CHANNELS]; /**< ADC counts per 100ms */
+    uint8_t Status[LIGHTREQUEST_BATCH_MAX_CHANNELS];        /**< SignalStatus */
+    uint8_t PlausibilityFault[LIGHTREQUEST_BATCH_MAX_CHANNELS]; /**< Plausibility fault */
+} LightRequest_BatchType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Set up a batch
+ * @details Moving average (window up to LIGHTREQUEST_BATCH_MAX_WINDOW) and
+ *          IIR stages are supported; median stages are not. Selects the
+ *          fastest implementation the CPU supports.
+ * @param[out] Batch Batch state
+ * @param[in] NumChannels Number of channels (1..LIGHTREQUEST_BATCH_MAX_CHANNELS)
+ * @param[in] Stages Filter chain, as for LightRequest_SetFilterChain
+ * @param[in] NumStages Number of stages
+ * @return E_OK on success, E_NOT_OK on invalid or unsupported configuration
+ */
+Std_ReturnType LightRequest_BatchInit(LightRequest_BatchType* Batch, uint16_t NumChannels,
+                                      const LightRequest_FilterStageConfigType* Stages,
+                                      uint8_t NumStages);
+
+/**
+ * @brief Evaluate one LightRequest cycle for all channels
+ * @param[in,out] Batch Batch state
+ * @param[in] Samples ADC value of each channel (NumChannels values)
+ */
+void LightRequest_BatchUpdate(LightRequest_BatchType* Batch, const uint16_t* Samples);
+
+/**
+ * @brief Check if an implementation can run on this build and CPU
+ * @param[in] Isa Implementation
+ * @return TRUE if supported
+ */
+boolean LightRequest_BatchIsaSupported(LightRequest_BatchIsaType Isa);
+
+/**
+ * @brief Select the implementation (testing, benchmarks)
+ * @param[in,out] Batch Batch state
+ * @param[in] Isa Implementation
+ * @return E_OK on success, E_NOT_OK if not supported
+ */
+Std_ReturnType LightRequest_BatchSetIsa(LightRequest_BatchType* Batch, LightRequest_BatchIsaType Isa);
+
+#endif /* LIGHTREQUEST_BATCH_H */
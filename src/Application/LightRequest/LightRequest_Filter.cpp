@@ -0,0 +1,225 @@
+/**
+ * @file LightRequest_Filter.cpp
+ * @brief LightRequest Signal Conditioning Filter Chain Implementation
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety ASIL A - [FunSafReq01-02] Ambient light sensor validation
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "LightRequest_Filter.h"
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static boolean LightRequest_FilterStageValid(const LightRequest_FilterStageConfigType* Stage);
+static uint16_t LightRequest_FilterMovingAverage(LightRequest_FilterStageType* stage, uint16_t x);
+static uint16_t LightRequest_FilterIir(LightRequest_FilterStageType* stage, uint16_t x);
+static uint16_t LightRequest_FilterMedian(LightRequest_FilterStageType* stage, uint16_t x);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Set up a filter chain
+ */
+Std_ReturnType LightRequest_FilterInit(LightRequest_FilterChainType* Chain,
+                                       const LightRequest_FilterStageConfigType* Stages,
+                                       uint8_t NumStages) {
+    uint8_t i;
+
+    if (Chain == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    (void)std::memset(Chain, 0, sizeof(*Chain));
+
+    if ((NumStages > LIGHTREQUEST_FILTER_MAX_STAGES) ||
+        ((NumStages > 0U) && (Stages == NULL_PTR))) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0U; i < NumStages; i++) {
+        if (!LightRequest_FilterStageValid(&Stages[i])) {
+            return E_NOT_OK;
+        }
+    }
+
+    for (i = 0U; i < NumStages; i++) {
+        Chain->Stages[i].Type = Stages[i].Type;
+        Chain->Stages[i].Param = Stages[i].Param;
+    }
+    Chain->NumStages = NumStages;
+
+    return E_OK;
+}
+
+/**
+ * @brief Clear the sample history of all stages
+ */
+void LightRequest_FilterReset(LightRequest_FilterChainType* Chain) {
+    LightRequest_FilterStageType* stage;
+    uint8_t i;
+
+    if (Chain == NULL_PTR) {
+        return;
+    }
+
+    for (i = 0U; i < Chain->NumStages; i++) {
+        stage = &Chain->Stages[i];
+        stage->Index = 0U;
+        stage->Count = 0U;
+        stage->Sum = 0U;
+        stage->IirState = 0;
+    }
+}
+
+/**
+ * @brief Pass one sample through the chain
+ */
+uint16_t LightRequest_FilterUpdate(LightRequest_FilterChainType* Chain, uint16_t Sample) {
+    LightRequest_FilterStageType* stage;
+    uint16_t value = Sample;
+    uint8_t i;
+
+    if (Chain == NULL_PTR) {
+        return Sample;
+    }
+
+    for (i = 0U; i < Chain->NumStages; i++) {
+        stage = &Chain->Stages[i];
+
+        switch (stage->Type) {
+            case LIGHTREQUEST_FILTER_MOVING_AVERAGE:
+                value = LightRequest_FilterMovingAverage(stage, value);
+                break;
+
+            case LIGHTREQUEST_FILTER_IIR_LOWPASS:
+                value = LightRequest_FilterIir(stage, value);
+                break;
+
+            case LIGHTREQUEST_FILTER_MEDIAN:
+                value = LightRequest_FilterMedian(stage, value);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return value;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Check a stage configuration
+ */
+static boolean LightRequest_FilterStageValid(const LightRequest_FilterStageConfigType* Stage) {
+    switch (Stage->Type) {
+        case LIGHTREQUEST_FILTER_MOVING_AVERAGE:
+            return ((Stage->Param >= 1U) && (Stage->Param <= LIGHTREQUEST_FILTER_MAX_WINDOW)) ?
+                   TRUE : FALSE;
+
+        case LIGHTREQUEST_FILTER_IIR_LOWPASS:
+            return ((Stage->Param >= 1U) && (Stage->Param <= LIGHTREQUEST_FILTER_IIR_ONE)) ?
+                   TRUE : FALSE;
+
+        case LIGHTREQUEST_FILTER_MEDIAN:
+            return ((Stage->Param <= LIGHTREQUEST_FILTER_MAX_MEDIAN) &&
+                    ((Stage->Param % 2U) == 1U)) ? TRUE : FALSE;
+
+        default:
+            return FALSE;
+    }
+}
+
+/**
+ * @brief Moving average: add the new sample, drop the oldest from the sum
+ */
+static uint16_t LightRequest_FilterMovingAverage(LightRequest_FilterStageType* stage, uint16_t x) {
+    if (stage->Count == stage->Param) {
+        stage->Sum -= stage->History[stage->Index];
+    } else {
+        stage->Count++;
+    }
+
+    stage->History[stage->Index] = x;
+    stage->Sum += x;
+
+    stage->Index++;
+    if (stage->Index >= stage->Param) {
+        stage->Index = 0U;
+    }
+
+    return static_cast<uint16_t>(stage->Sum / stage->Count);
+}
+
+/**
+ * @brief First order IIR low-pass, state in Q16, coefficient in Q15
+ */
+static uint16_t LightRequest_FilterIir(LightRequest_FilterStageType* stage, uint16_t x) {
+    const int32_t input = static_cast<int32_t>(static_cast<uint32_t>(x) << 16U);
+    int64_t step;
+
+    if (stage->Count == 0U) {
+        /* Start at the first sample instead of ramping up from zero */
+        stage->IirState = input;
+        stage->Count = 1U;
+    } else {
+        step = (static_cast<int64_t>(input - stage->IirState) * stage->Param) / 32768;
+        stage->IirState += static_cast<int32_t>(step);
+    }
+
+    return static_cast<uint16_t>((stage->IirState + 0x8000) >> 16U);
+}
+
+/**
+ * @brief Median: replace the oldest sample in the sorted window
+ * @details One removal and one insertion of at most
+ *          LIGHTREQUEST_FILTER_MAX_MEDIAN moves per sample
+ */
+static uint16_t LightRequest_FilterMedian(LightRequest_FilterStageType* stage, uint16_t x) {
+    uint16_t* sorted = stage->Sorted;
+    uint16_t count = stage->Count;
+    uint16_t pos;
+
+    if (count == stage->Param) {
+        /* Remove the oldest sample */
+        pos = 0U;
+        while (sorted[pos] != stage->History[stage->Index]) {
+            pos++;
+        }
+        count--;
+        (void)std::memmove(&sorted[pos], &sorted[pos + 1U],
+                           static_cast<size_t>(count - pos) * sizeof(uint16_t));
+    }
+
+    /* Insert the new sample */
+    pos = count;
+    while ((pos > 0U) && (sorted[pos - 1U] > x)) {
+        sorted[pos] = sorted[pos - 1U];
+        pos--;
+    }
+    sorted[pos] = x;
+    count++;
+    stage->Count = count;
+
+    stage->History[stage->Index] = x;
+    stage->Index++;
+    if (stage->Index >= stage->Param) {
+        stage->Index = 0U;
+    }
+
+    return sorted[(count - 1U) / 2U];
+}
@@ -0,0 +1,87 @@
+/**
+ * @file LightRequest_Filter.h
+ * @brief LightRequest Signal Conditioning Filter Chain
+ * @details Chain of filter stages applied sample by sample:
+ *          - Moving average with running sum, O(1) per sample for any window
+ *          - First order IIR low-pass in fixed point (Q16 state)
+ *          - Median of N for spike rejection (short windows)
+ *          Stage state is held in the chain object, no allocation.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety ASIL A - [FunSafReq01-02] Ambient light sensor validation
+ */
+
+#ifndef LIGHTREQUEST_FILTER_H
+#define LIGHTREQUEST_FILTER_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "LightRequest_Cfg.h"
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Filter stage state
+ */
+typedef struct {
+    LightRequest_FilterType Type;                       /**< Stage type */
+    uint16_t Param;                                     /**< Window / coefficient */
+    uint16_t Index;                                     /**< Oldest sample in History */
+    uint16_t Count;                                     /**< Samples in the window */
+    uint32_t Sum;                                       /**< Moving average: window sum */
+    int32_t IirState;                                   /**< IIR: output in Q16 */
+    uint16_t History[LIGHTREQUEST_FILTER_MAX_WINDOW];   /**< Window, arrival order */
+    uint16_t Sorted[LIGHTREQUEST_FILTER_MAX_MEDIAN];    /**< Median: window, sorted */
+} LightRequest_FilterStageType;
+
+/**
+ * @brief Filter chain state
+ */
+typedef struct {
+    uint8_t NumStages;                                          /**< Active stages */
+    LightRequest_FilterStageType Stages[LIGHTREQUEST_FILTER_MAX_STAGES];
+} LightRequest_FilterChainType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Set up a filter chain
+ * @details Window lengths: moving average 1..LIGHTREQUEST_FILTER_MAX_WINDOW,
+ *          median odd 1..LIGHTREQUEST_FILTER_MAX_MEDIAN; IIR coefficient
+ *          1..LIGHTREQUEST_FILTER_IIR_ONE. An invalid configuration leaves an
+ *          empty chain (samples pass unchanged).
+ * @param[out] Chain Filter chain
+ * @param[in] Stages Stage configurations in processing order
+ * @param[in] NumStages Number of stages (0..LIGHTREQUEST_FILTER_MAX_STAGES)
+ * @return E_OK on success, E_NOT_OK on invalid configuration
+ */
+Std_ReturnType LightRequest_FilterInit(LightRequest_FilterChainType* Chain,
+                                       const LightRequest_FilterStageConfigType* Stages,
+                                       uint8_t NumStages);
+
+/**
+ * @brief Clear the sample history of all stages
+ * @param[in,out] Chain Filter chain
+ */
+void LightRequest_FilterReset(LightRequest_FilterChainType* Chain);
+
+/**
+ * @brief Pass one sample through the chain
+ * @details Until a window is full, stages work on the samples received so
+ *          far; the IIR starts at the first sample.
+ * @param[in,out] Chain Filter chain
+ * @param[in] Sample Input sample
+ * @return Output of the last stage
+ */
+uint16_t LightRequest_FilterUpdate(LightRequest_FilterChainType* Chain, uint16_t Sample);
+
+#endif /* LIGHTREQUEST_FILTER_H */
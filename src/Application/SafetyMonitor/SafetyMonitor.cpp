@@ -14,10 +14,11 @@
  * INCLUDES
  *============================================================================*/
 #include "SafetyMonitor.h"
-#include "Application/SwitchEvent/SwitchEvent.h"
-#include "Application/LightRequest/LightRequest.h"
 #include "Application/FLM/FLM_Application.h"
-#include "Application/Headlight/Headlight.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
+#include "BSW/BswM/BswM.h"
 #include "Dem_Cfg.h"
 #include <cstring>
 
@@ -47,7 +48,8 @@ static void SafetyMonitor_CheckFTTI(void);
 static void SafetyMonitor_UpdateGlobalStatus(void);
 static void SafetyMonitor_DetermineSafeStateCommand(void);
 static void SafetyMonitor_ReportDemEvents(void);
-static void SafetyMonitor_ReportWdgMCheckpoint(void);
+static void SafetyMonitor_WriteOutputs(void);
+static void SafetyMonitor_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId);
 
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
@@ -76,6 +78,13 @@ void SafetyMonitor_Init(void) {
     /* Initialize ambient light tracking */
     SafetyMonitor_State.isDaytime = TRUE;  /* Assume daytime initially */
 
+    /* Supervision status from WdgM again */
+    SafetyMonitor_SimWdgmStatus = WDGM_GLOBAL_STATUS_OK;
+    SafetyMonitor_SimWdgmEnabled = FALSE;
+
+    /* Publish safety status OK */
+    SafetyMonitor_WriteOutputs();
+
     /* Mark as initialized */
     SafetyMonitor_State.isInitialized = TRUE;
 }
@@ -89,8 +98,10 @@ void SafetyMonitor_MainFunction(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_SAFETYMONITOR);
+
     /* Report entry checkpoint to WdgM */
-    SafetyMonitor_ReportWdgMCheckpoint();
+    SafetyMonitor_ReportWdgMCheckpoint(SAFETYMONITOR_CP_MAIN_ENTRY);
 
     /* Update timestamp */
     SafetyMonitor_State.currentTime = SafetyMonitor_SystemTime;
@@ -99,15 +110,16 @@ void SafetyMonitor_MainFunction(void) {
     /* Read status from all components */
     SafetyMonitor_ReadComponentStatus();
 
+    /* Check WdgM status first so a supervision failure is reported as such [SysSafReq03] */
+    SafetyMonitor_CheckWdgMStatus();
+
     /* Aggregate faults */
     SafetyMonitor_AggregrateFaults();
+    SafetyMonitor_ReportWdgMCheckpoint(SAFETYMONITOR_CP_AGGREGATION);
 
     /* Check E2E timeout [SysSafReq02] */
     SafetyMonitor_CheckE2ETimeout();
 
-    /* Check WdgM status [SysSafReq03] */
-    SafetyMonitor_CheckWdgMStatus();
-
     /* Check FTTI [ECU17] */
     SafetyMonitor_CheckFTTI();
 
@@ -121,48 +133,60 @@ void SafetyMonitor_MainFunction(void) {
 
     /* Report DEM events */
     SafetyMonitor_ReportDemEvents();
+
+    /* Publish global safety status */
+    SafetyMonitor_WriteOutputs();
+
+    /* Report exit checkpoint to WdgM */
+    SafetyMonitor_ReportWdgMCheckpoint(SAFETYMONITOR_CP_MAIN_EXIT);
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_SAFETYMONITOR);
 }
 
 /**
  * @brief Read status from all monitored components
+ * @details Reads the published port snapshots in place
  */
 static void SafetyMonitor_ReadComponentStatus(void) {
-    LightSwitchStatus switchStatus;
-    AmbientLightLevel ambientLevel;
+    const Rte_IrvLightSwitchType* lightSwitch = Rte_IRead_SafetyMonitor_LightSwitch();
+    const Rte_IrvAmbientLightType* ambientLight = Rte_IRead_SafetyMonitor_AmbientLight();
+    const Rte_IrvHeadlightCmdType* headlightCmd = Rte_IRead_SafetyMonitor_HeadlightCmd();
+    const Rte_IrvHeadlightStatusType* headlightStatus = Rte_IRead_SafetyMonitor_HeadlightStatus();
 
     /* Get SwitchEvent status */
-    switchStatus = SwitchEvent_GetLightRequest();
-    SafetyMonitor_State.switchEventFault = !switchStatus.isValid;
-    SafetyMonitor_State.e2eStatus = SwitchEvent_GetE2EStatus();
-    SafetyMonitor_State.e2eSmStatus = SwitchEvent_GetE2ESmStatus();
+    SafetyMonitor_State.switchEventFault = !lightSwitch->status.isValid;
+    SafetyMonitor_State.e2eStatus = lightSwitch->e2eStatus;
+    SafetyMonitor_State.e2eSmStatus = lightSwitch->e2eSmStatus;
 
     /* Get LightRequest status */
-    ambientLevel = LightRequest_GetAmbientLight();
-    SafetyMonitor_State.lastAmbientLight = ambientLevel;
-    SafetyMonitor_State.lightRequestFault = !ambientLevel.isValid;
+    SafetyMonitor_State.lastAmbientLight = ambientLight->level;
+    SafetyMonitor_State.lightRequestFault = !ambientLight->level.isValid;
 
     /* Determine if it's daytime based on ambient light */
-    if (ambientLevel.isValid) {
+    if (ambientLight->level.isValid) {
         SafetyMonitor_State.isDaytime =
-            (ambientLevel.adcValue > SAFETYMONITOR_DAY_THRESHOLD);
+            (ambientLight->level.adcValue > SAFETYMONITOR_DAY_THRESHOLD);
     }
 
     /* Get FLM status */
-    SafetyMonitor_State.flmState = FLM_GetCurrentState();
+    SafetyMonitor_State.flmState = headlightCmd->flmState;
     SafetyMonitor_State.flmFault =
         (SafetyMonitor_State.flmState == FLM_STATE_SAFE);
 
     /* Get Headlight status */
-    SafetyMonitor_State.headlightStatus = Headlight_GetFaultStatus();
+    SafetyMonitor_State.headlightStatus = headlightStatus->faultStatus;
     SafetyMonitor_State.headlightFault =
         (SafetyMonitor_State.headlightStatus != HEADLIGHT_FAULT_NONE);
 
     /* Get WdgM status */
     if (SafetyMonitor_SimWdgmEnabled) {
         SafetyMonitor_State.wdgmGlobalStatus = SafetyMonitor_SimWdgmStatus;
-    } else {
-        /* In real system, would call WdgM_GetGlobalStatus */
+    } else if (Rte_Call_SafetyMonitor_WdgM_GetGlobalStatus(
+                   &SafetyMonitor_State.wdgmGlobalStatus) != RTE_E_OK) {
+        /* WdgM not running - no supervision result available */
         SafetyMonitor_State.wdgmGlobalStatus = WDGM_GLOBAL_STATUS_OK;
+    } else {
+        /* Status read from WdgM */
     }
 
     SafetyMonitor_State.wdgmFault =
@@ -299,17 +323,12 @@ static void SafetyMonitor_DetermineSafeStateCommand(void) {
 
 /**
  * @brief Report checkpoint to Watchdog Manager
+ * @param[in] checkpointId Checkpoint reached
  */
-static void SafetyMonitor_ReportWdgMCheckpoint(void) {
+static void SafetyMonitor_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId) {
     (void)Rte_Call_SafetyMonitor_WdgM_CheckpointReached(
         SAFETYMONITOR_SE_ID,
-        SAFETYMONITOR_CP_MAIN_ENTRY
-    );
-
-    /* Report aggregation checkpoint */
-    (void)Rte_Call_SafetyMonitor_WdgM_CheckpointReached(
-        SAFETYMONITOR_SE_ID,
-        SAFETYMONITOR_CP_AGGREGATION
+        checkpointId
     );
 }
 
@@ -339,6 +358,20 @@ static void SafetyMonitor_ReportDemEvents(void) {
     }
 }
 
+/**
+ * @brief Publish global safety status and safe state command in one port write
+ */
+static void SafetyMonitor_WriteOutputs(void) {
+    Rte_IrvSafetyStatusType output;
+
+    output.globalStatus = SafetyMonitor_State.globalStatus;
+    output.safeStateActive = SafetyMonitor_State.inSafeState;
+    output.safeStateCommand = SafetyMonitor_State.safeStateCommand;
+    output.timestamp = SafetyMonitor_State.currentTime;
+
+    (void)Rte_Write_SafetyMonitor_SafetyStatus(&output);
+}
+
 /*============================================================================*
  * PUBLIC INTERFACE FUNCTIONS
  *============================================================================*/
@@ -353,6 +386,8 @@ void SafetyMonitor_TriggerSafeState(SafeStateReason reason) {
         SafetyMonitor_State.safeStateReason = reason;
         SafetyMonitor_State.safeStateEntryTime = SafetyMonitor_State.currentTime;
         SafetyMonitor_State.globalStatus = SAFETY_STATUS_SAFE_STATE;
+        TRACE_SAFE_STATE(reason);
+        Metrics_Increment(METRICS_SAFE_STATE(reason));
 
         /* Trigger FLM to enter safe state */
         FLM_TriggerSafeState(reason);
@@ -375,6 +410,20 @@ const SafetyMonitor_StateType* SafetyMonitor_GetState(void) {
     return &SafetyMonitor_State;
 }
 
+void SafetyMonitor_SaveSnapshot(SafetyMonitor_SnapshotType* snapshot) {
+    snapshot->State = SafetyMonitor_State;
+    snapshot->SystemTime = SafetyMonitor_SystemTime;
+    snapshot->SimWdgmStatus = SafetyMonitor_SimWdgmStatus;
+    snapshot->SimWdgmEnabled = SafetyMonitor_SimWdgmEnabled;
+}
+
+void SafetyMonitor_RestoreSnapshot(const SafetyMonitor_SnapshotType* snapshot) {
+    SafetyMonitor_State = snapshot->State;
+    SafetyMonitor_SystemTime = snapshot->SystemTime;
+    SafetyMonitor_SimWdgmStatus = snapshot->SimWdgmStatus;
+    SafetyMonitor_SimWdgmEnabled = snapshot->SimWdgmEnabled;
+}
+
 /*============================================================================*
  * TEST HELPER FUNCTIONS
  *============================================================================*/
@@ -392,90 +441,32 @@ void SafetyMonitor_SimSetWdgmStatus(WdgM_GlobalStatusType status) {
  * RTE PORT IMPLEMENTATIONS (STUBS)
  *============================================================================*/
 
-Rte_StatusType Rte_Read_SafetyMonitor_FLMState(FLM_StateType* state) {
-    if (state != NULL_PTR) {
-        *state = SafetyMonitor_State.flmState;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
-}
-
-Rte_StatusType Rte_Read_SafetyMonitor_E2EStatus(E2E_P01CheckStatusType* status) {
-    if (status != NULL_PTR) {
-        *status = SafetyMonitor_State.e2eStatus;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
-}
-
-Rte_StatusType Rte_Read_SafetyMonitor_HeadlightFault(HeadlightFaultStatus* status) {
-    if (status != NULL_PTR) {
-        *status = SafetyMonitor_State.headlightStatus;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
-}
-
-Rte_StatusType Rte_Read_SafetyMonitor_AmbientStatus(SignalStatus* status) {
-    if (status != NULL_PTR) {
-        *status = SafetyMonitor_State.lastAmbientLight.isValid ?
-                  SIGNAL_STATUS_VALID : SIGNAL_STATUS_INVALID;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
-}
-
-Rte_StatusType Rte_Read_SafetyMonitor_AmbientLight(AmbientLightLevel* level) {
-    if (level != NULL_PTR) {
-        *level = SafetyMonitor_State.lastAmbientLight;
-        return RTE_E_OK;
-    }
-    return RTE_E_INVALID;
-}
-
-Rte_StatusType Rte_Write_SafetyMonitor_GlobalStatus(SafetyStatusType status) {
-    STD_UNUSED(status);
-    return RTE_E_OK;
-}
-
-Rte_StatusType Rte_Write_SafetyMonitor_SafeStateActive(boolean active) {
-    STD_UNUSED(active);
-    return RTE_E_OK;
-}
-
-Rte_StatusType Rte_Write_SafetyMonitor_SafeStateCommand(HeadlightCommand command) {
-    STD_UNUSED(command);
-    return RTE_E_OK;
-}
-
 Rte_StatusType Rte_Call_SafetyMonitor_WdgM_GetGlobalStatus(
     WdgM_GlobalStatusType* status
 ) {
-    if (status != NULL_PTR) {
-        *status = SafetyMonitor_State.wdgmGlobalStatus;
-        return RTE_E_OK;
+    if (WdgM_GetGlobalStatus(status) != E_OK) {
+        return RTE_E_INVALID;
     }
-    return RTE_E_INVALID;
+    return RTE_E_OK;
 }
 
 Rte_StatusType Rte_Call_SafetyMonitor_WdgM_GetLocalStatus(
     WdgM_SupervisedEntityIdType SEId,
     WdgM_LocalStatusType* status
 ) {
-    STD_UNUSED(SEId);
-    if (status != NULL_PTR) {
-        *status = WDGM_LOCAL_STATUS_OK;
-        return RTE_E_OK;
+    if (WdgM_GetLocalStatus(SEId, status) != E_OK) {
+        return RTE_E_INVALID;
     }
-    return RTE_E_INVALID;
+    return RTE_E_OK;
 }
 
 Rte_StatusType Rte_Call_SafetyMonitor_WdgM_CheckpointReached(
     WdgM_SupervisedEntityIdType SEId,
     WdgM_CheckpointIdType CPId
 ) {
-    STD_UNUSED(SEId);
-    STD_UNUSED(CPId);
+    if (WdgM_CheckpointReached(SEId, CPId) != E_OK) {
+        return RTE_E_INVALID;
+    }
     return RTE_E_OK;
 }
 
@@ -489,6 +480,7 @@ Rte_StatusType Rte_Call_SafetyMonitor_Dem_SetEventStatus(
 }
 
 Rte_StatusType Rte_Call_SafetyMonitor_BswM_RequestReset(void) {
+    BswM_RequestReset();
     return RTE_E_OK;
 }
 
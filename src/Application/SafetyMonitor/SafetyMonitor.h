@@ -74,6 +74,16 @@ typedef struct {
     uint32_t currentTime;
 } SafetyMonitor_StateType;
 
+/**
+ * @brief SafetyMonitor snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    SafetyMonitor_StateType State;
+    uint32_t SystemTime;
+    WdgM_GlobalStatusType SimWdgmStatus;
+    boolean SimWdgmEnabled;
+} SafetyMonitor_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -127,4 +137,16 @@ HeadlightCommand SafetyMonitor_GetSafeStateCommand(void);
  */
 const SafetyMonitor_StateType* SafetyMonitor_GetState(void);
 
+/**
+ * @brief Save component state (Ecu_SaveSnapshot)
+ * @param[out] snapshot Component state
+ */
+void SafetyMonitor_SaveSnapshot(SafetyMonitor_SnapshotType* snapshot);
+
+/**
+ * @brief Restore component state (Ecu_RestoreSnapshot)
+ * @param[in] snapshot Component state
+ */
+void SafetyMonitor_RestoreSnapshot(const SafetyMonitor_SnapshotType* snapshot);
+
 #endif /* SAFETYMONITOR_H */
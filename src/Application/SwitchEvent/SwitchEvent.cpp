@@ -14,6 +14,9 @@
  * INCLUDES
  *============================================================================*/
 #include "SwitchEvent.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
 #include "Dem_Cfg.h"
 #include <cstring>
 
@@ -35,8 +38,9 @@ static void SwitchEvent_InitE2E(void);
 static void SwitchEvent_PerformE2ECheck(void);
 static void SwitchEvent_UpdateTimeoutStatus(void);
 static void SwitchEvent_ExtractLightSwitchCommand(const uint8_t* data);
-static void SwitchEvent_ReportWdgMCheckpoint(void);
+static void SwitchEvent_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId);
 static void SwitchEvent_ReportDemEvents(void);
+static void SwitchEvent_WriteOutputs(void);
 static boolean SwitchEvent_IsCommandValid(uint8_t command);
 
 /*============================================================================*
@@ -73,6 +77,9 @@ void SwitchEvent_Init(void) {
     /* No new message initially */
     SwitchEvent_State.newMessageReceived = FALSE;
 
+    /* Publish the invalid light switch status */
+    SwitchEvent_WriteOutputs();
+
     /* Mark as initialized */
     SwitchEvent_State.isInitialized = TRUE;
 }
@@ -113,12 +120,19 @@ static void SwitchEvent_InitE2E(void) {
  * @details [FunSafReq01-01] Performs E2E check and validates light switch request
  */
 void SwitchEvent_MainFunction(void) {
+#if (TRACE_ENABLED == STD_ON)
+    const E2E_P01CheckStatusType previousE2eStatus = SwitchEvent_State.e2eStatus;
+    const E2E_SMStateType previousE2eSmStatus = SwitchEvent_State.e2eSmStatus;
+#endif
+
     if (!SwitchEvent_State.isInitialized) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_SWITCHEVENT);
+
     /* Report entry checkpoint to WdgM [SysSafReq03] */
-    SwitchEvent_ReportWdgMCheckpoint();
+    SwitchEvent_ReportWdgMCheckpoint(SWITCHEVENT_CP_MAIN_ENTRY);
 
     /* Update current timestamp */
     SwitchEvent_State.currentTimestamp = SwitchEvent_SystemTime;
@@ -126,6 +140,14 @@ void SwitchEvent_MainFunction(void) {
 
     /* Perform E2E check on received data [SysSafReq02] */
     SwitchEvent_PerformE2ECheck();
+#if (TRACE_ENABLED == STD_ON)
+    if ((SwitchEvent_State.e2eStatus != previousE2eStatus) ||
+        (SwitchEvent_State.e2eSmStatus != previousE2eSmStatus)) {
+        TRACE_E2E_STATUS(SwitchEvent_State.e2eStatus, SwitchEvent_State.e2eSmStatus);
+    }
+#endif
+    Metrics_Increment(METRICS_E2E_STATUS(SwitchEvent_State.e2eStatus));
+    Metrics_Add(METRICS_E2E_SM_DWELL(SwitchEvent_State.e2eSmStatus), FLM_MAIN_FUNCTION_PERIOD_MS);
 
     /* Update timeout status [SysSafReq01] */
     SwitchEvent_UpdateTimeoutStatus();
@@ -147,6 +169,14 @@ void SwitchEvent_MainFunction(void) {
 
     /* Report DEM events */
     SwitchEvent_ReportDemEvents();
+
+    /* Publish light switch status to FLM and SafetyMonitor */
+    SwitchEvent_WriteOutputs();
+
+    /* Report exit checkpoint to WdgM [SysSafReq03] */
+    SwitchEvent_ReportWdgMCheckpoint(SWITCHEVENT_CP_MAIN_EXIT);
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_SWITCHEVENT);
 }
 
 /**
@@ -277,13 +307,13 @@ static boolean SwitchEvent_IsCommandValid(uint8_t command) {
 
 /**
  * @brief Report checkpoint to Watchdog Manager
- * @details [SysSafReq03] Alive supervision
+ * @details [SysSafReq03] Alive and logical supervision
+ * @param[in] checkpointId Checkpoint reached
  */
-static void SwitchEvent_ReportWdgMCheckpoint(void) {
-    /* Report entry checkpoint */
+static void SwitchEvent_ReportWdgMCheckpoint(WdgM_CheckpointIdType checkpointId) {
     (void)Rte_Call_SwitchEvent_WdgM_CheckpointReached(
         SWITCHEVENT_SE_ID,
-        SWITCHEVENT_CP_MAIN_ENTRY
+        checkpointId
     );
 }
 
@@ -318,6 +348,21 @@ static void SwitchEvent_ReportDemEvents(void) {
     }
 }
 
+/**
+ * @brief Publish light switch status, E2E and timeout status in one port write
+ */
+static void SwitchEvent_WriteOutputs(void) {
+    Rte_IrvLightSwitchType output;
+
+    output.status = SwitchEvent_State.lightSwitchStatus;
+    output.timestamp = SwitchEvent_State.currentTimestamp;
+    output.e2eStatus = SwitchEvent_State.e2eStatus;
+    output.e2eSmStatus = SwitchEvent_State.e2eSmStatus;
+    output.timeoutActive = SwitchEvent_State.timeoutActive;
+
+    (void)Rte_Write_SwitchEvent_LightSwitch(&output);
+}
+
 /*============================================================================*
  * PUBLIC INTERFACE FUNCTIONS
  *============================================================================*/
@@ -352,6 +397,16 @@ const SwitchEvent_StateType* SwitchEvent_GetState(void) {
     return &SwitchEvent_State;
 }
 
+void SwitchEvent_SaveSnapshot(SwitchEvent_SnapshotType* snapshot) {
+    snapshot->State = SwitchEvent_State;
+    snapshot->SystemTime = SwitchEvent_SystemTime;
+}
+
+void SwitchEvent_RestoreSnapshot(const SwitchEvent_SnapshotType* snapshot) {
+    SwitchEvent_State = snapshot->State;
+    SwitchEvent_SystemTime = snapshot->SystemTime;
+}
+
 /*============================================================================*
  * RTE PORT IMPLEMENTATIONS (STUBS)
  *============================================================================*/
@@ -373,22 +428,13 @@ Rte_StatusType Rte_Read_SwitchEvent_CanLightSwitchMsg(Rte_CanMessageType* messag
     return RTE_E_NO_DATA;
 }
 
-Rte_StatusType Rte_Write_SwitchEvent_LightSwitchStatus(const LightSwitchStatus* status) {
-    STD_UNUSED(status);
-    return RTE_E_OK;
-}
-
-Rte_StatusType Rte_Write_SwitchEvent_E2EStatus(E2E_P01CheckStatusType e2eStatus) {
-    STD_UNUSED(e2eStatus);
-    return RTE_E_OK;
-}
-
 Rte_StatusType Rte_Call_SwitchEvent_WdgM_CheckpointReached(
     WdgM_SupervisedEntityIdType SEId,
     WdgM_CheckpointIdType CPId
 ) {
-    STD_UNUSED(SEId);
-    STD_UNUSED(CPId);
+    if (WdgM_CheckpointReached(SEId, CPId) != E_OK) {
+        return RTE_E_INVALID;
+    }
     return RTE_E_OK;
 }
 
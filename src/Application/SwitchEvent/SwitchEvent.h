@@ -19,6 +19,7 @@
 #include "Rte/Rte_SwitchEvent.h"
 #include "BSW/E2E/E2E_P01.h"
 #include "FLM_Config.h"
+#include "Com_Cfg.h"
 
 /*============================================================================*
  * CONFIGURATION
@@ -72,6 +73,14 @@ typedef struct {
     boolean newMessageReceived;
 } SwitchEvent_StateType;
 
+/**
+ * @brief SwitchEvent snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    SwitchEvent_StateType State;        /**< Includes the E2E check and state machine states */
+    uint32_t SystemTime;
+} SwitchEvent_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -129,4 +138,16 @@ void SwitchEvent_ProcessCanMessage(const uint8_t* data, uint8_t length);
  */
 const SwitchEvent_StateType* SwitchEvent_GetState(void);
 
+/**
+ * @brief Save component state (Ecu_SaveSnapshot)
+ * @param[out] snapshot Component state
+ */
+void SwitchEvent_SaveSnapshot(SwitchEvent_SnapshotType* snapshot);
+
+/**
+ * @brief Restore component state (Ecu_RestoreSnapshot)
+ * @param[in] snapshot Component state
+ */
+void SwitchEvent_RestoreSnapshot(const SwitchEvent_SnapshotType* snapshot);
+
 #endif /* SWITCHEVENT_H */
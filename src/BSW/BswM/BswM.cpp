@@ -1,7 +1,7 @@
 /**
  * @file BswM.cpp
  * @brief AUTOSAR BSW Mode Manager Implementation
- * @details BSW Mode Manager for mode arbitration and management
+ * @details BSW Mode Manager with compiled rule evaluation and mode arbitration
  * @version 1.0.0
  * @date 2024
  *
@@ -12,6 +12,13 @@
  * INCLUDES
  *============================================================================*/
 #include "BswM.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Com/Com.h"
+#include "BSW/Dem/Dem.h"
+#include "MCAL/Can/Can.h"
+#include "BSW/Os/Os.h"
+#include "BSW/Trace/Trace.h"
+#include <cstring>
 
 /*============================================================================*
  * LOCAL VARIABLES
@@ -26,6 +33,35 @@ static BswM_ModeType BswM_CurrentMode = BSWM_MODE_STARTUP;
 /** @brief Reset requested flag */
 static boolean BswM_ResetRequested = FALSE;
 
+/** @brief Compiled decision table */
+static BswM_DecisionTableType BswM_DecisionTable;
+
+/** @brief Current mode port values */
+static uint8_t BswM_ModePortValues[BSWM_NUM_MODE_PORTS];
+
+/** @brief Mode ports written since the last evaluation (bit per port) */
+static uint32_t BswM_DirtyPorts = 0U;
+
+/** @brief Current condition results (bit per condition) */
+static BswM_ConditionMaskType BswM_ConditionResults = 0U;
+
+/** @brief Current rule results and evaluated rules (bit per rule) */
+static BswM_RuleMaskType BswM_RuleResults = 0U;
+static BswM_RuleMaskType BswM_RulesEvaluated = 0U;
+
+/** @brief Rule evaluation counter */
+static uint32_t BswM_RuleEvaluationCount = 0U;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static void BswM_BuildDecisionTable(void);
+static Std_ReturnType BswM_WriteModePort(BswM_ModePortIdType port, uint8_t value);
+static void BswM_EvaluateRules(void);
+static void BswM_ExecuteActionList(const BswM_ActionListConfigType* actionList);
+static uint8_t BswM_LowestBit(uint32_t mask);
+
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
  *============================================================================*/
@@ -34,10 +70,26 @@ static boolean BswM_ResetRequested = FALSE;
  * @brief Initialize BswM module
  */
 void BswM_Init(const BswM_ConfigType* ConfigPtr) {
+    uint8_t port;
+
     STD_UNUSED(ConfigPtr);
 
     BswM_CurrentMode = BSWM_MODE_STARTUP;
     BswM_ResetRequested = FALSE;
+
+    BswM_BuildDecisionTable();
+
+    for (port = 0U; port < BSWM_NUM_MODE_PORTS; port++) {
+        BswM_ModePortValues[port] = BswM_ModePortInitValues[port];
+    }
+
+    /* All rules are evaluated in the first main function */
+    BswM_DirtyPorts = (1UL << BSWM_NUM_MODE_PORTS) - 1UL;
+    BswM_ConditionResults = 0U;
+    BswM_RuleResults = 0U;
+    BswM_RulesEvaluated = 0U;
+    BswM_RuleEvaluationCount = 0U;
+
     BswM_Initialized = TRUE;
 }
 
@@ -57,18 +109,21 @@ void BswM_MainFunction(void) {
         return;
     }
 
-    /* Mode arbitration would happen here */
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_BSWM);
+
+    /* Mode arbitration: only rules with changed inputs */
+    if (BswM_DirtyPorts != 0U) {
+        BswM_EvaluateRules();
+    }
 
     /* Check for reset request */
     if (BswM_ResetRequested) {
-        /* In real system, would trigger reset sequence */
+        /* Reset is performed through the watchdog */
         BswM_ResetRequested = FALSE;
+        WdgM_PerformReset();
     }
 
-    /* Transition from STARTUP to RUN after initialization */
-    if (BswM_CurrentMode == BSWM_MODE_STARTUP) {
-        BswM_CurrentMode = BSWM_MODE_RUN;
-    }
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_BSWM);
 }
 
 /**
@@ -81,10 +136,7 @@ Std_ReturnType BswM_RequestMode(uint16_t requesting_user, BswM_ModeType requeste
         return E_NOT_OK;
     }
 
-    /* Simple mode request handling */
-    BswM_CurrentMode = requested_mode;
-
-    return E_OK;
+    return BswM_WriteModePort(BSWM_PORT_ECU_MODE_REQUEST, static_cast<uint8_t>(requested_mode));
 }
 
 /**
@@ -104,19 +156,18 @@ Std_ReturnType BswM_GetCurrentMode(BswM_ModeType* current_mode) {
  * @brief Communication mode indication
  */
 void BswM_ComM_CurrentMode(NetworkHandleType Network, ComM_ModeType RequestedMode) {
-    STD_UNUSED(Network);
-    STD_UNUSED(RequestedMode);
+    if (Network != BSWM_COMM_NETWORK_CAN) {
+        return;
+    }
 
-    /* Handle communication mode change */
+    (void)BswM_WriteModePort(BSWM_PORT_COMM_MODE, static_cast<uint8_t>(RequestedMode));
 }
 
 /**
  * @brief ECU state changed indication
  */
 void BswM_EcuM_CurrentState(uint8_t state) {
-    STD_UNUSED(state);
-
-    /* Handle ECU state change */
+    (void)BswM_WriteModePort(BSWM_PORT_ECUM_STATE, state);
 }
 
 /**
@@ -126,6 +177,50 @@ void BswM_RequestReset(void) {
     BswM_ResetRequested = TRUE;
 }
 
+/**
+ * @brief Get result of a rule
+ */
+Std_ReturnType BswM_GetRuleState(uint8_t RuleId, boolean* State) {
+    if ((State == NULL_PTR) || (RuleId >= BSWM_NUM_RULES)) {
+        return E_NOT_OK;
+    }
+
+    if ((BswM_RulesEvaluated & (1UL << RuleId)) == 0U) {
+        return E_NOT_OK;
+    }
+
+    *State = ((BswM_RuleResults & (1UL << RuleId)) != 0U);
+    return E_OK;
+}
+
+/**
+ * @brief Save mode and rule state
+ */
+void BswM_SaveSnapshot(BswM_SnapshotType* Snapshot) {
+    Snapshot->CurrentMode = BswM_CurrentMode;
+    Snapshot->ResetRequested = BswM_ResetRequested;
+    (void)memcpy(Snapshot->ModePortValues, BswM_ModePortValues, sizeof(BswM_ModePortValues));
+    Snapshot->DirtyPorts = BswM_DirtyPorts;
+    Snapshot->ConditionResults = BswM_ConditionResults;
+    Snapshot->RuleResults = BswM_RuleResults;
+    Snapshot->RulesEvaluated = BswM_RulesEvaluated;
+    Snapshot->RuleEvaluationCount = BswM_RuleEvaluationCount;
+}
+
+/**
+ * @brief Restore mode and rule state
+ */
+void BswM_RestoreSnapshot(const BswM_SnapshotType* Snapshot) {
+    BswM_CurrentMode = Snapshot->CurrentMode;
+    BswM_ResetRequested = Snapshot->ResetRequested;
+    (void)memcpy(BswM_ModePortValues, Snapshot->ModePortValues, sizeof(BswM_ModePortValues));
+    BswM_DirtyPorts = Snapshot->DirtyPorts;
+    BswM_ConditionResults = Snapshot->ConditionResults;
+    BswM_RuleResults = Snapshot->RuleResults;
+    BswM_RulesEvaluated = Snapshot->RulesEvaluated;
+    BswM_RuleEvaluationCount = Snapshot->RuleEvaluationCount;
+}
+
 /**
  * @brief Get version information
  */
@@ -140,3 +235,188 @@ void BswM_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
     VersionInfo->sw_minor_version = 0U;
     VersionInfo->sw_patch_version = 0U;
 }
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Compile conditions and rules into the decision table
+ * @details For every mode port value the set of TRUE conditions is
+ *          precomputed, so a port change updates all its conditions with
+ *          one mask operation
+ */
+static void BswM_BuildDecisionTable(void) {
+    uint8_t port;
+    uint8_t value;
+    uint8_t cond;
+    uint8_t rule;
+    const BswM_ConditionConfigType* condition;
+    BswM_ConditionMaskType condBit;
+    boolean isTrue;
+
+    (void)memset(&BswM_DecisionTable, 0, sizeof(BswM_DecisionTable));
+
+    for (cond = 0U; cond < BSWM_NUM_CONDITIONS; cond++) {
+        condition = &BswM_ConditionConfig[cond];
+        condBit = static_cast<BswM_ConditionMaskType>(1UL << cond);
+        port = condition->Port;
+
+        BswM_DecisionTable.portConditions[port] |= condBit;
+
+        for (value = 0U; value < BSWM_MAX_PORT_VALUES; value++) {
+            isTrue = (value == condition->Value);
+            if (condition->Operator == BSWM_CONDITION_NOT_EQUALS) {
+                isTrue = !isTrue;
+            }
+            if (isTrue) {
+                BswM_DecisionTable.valueConditions[port][value] |= condBit;
+            }
+        }
+    }
+
+    for (rule = 0U; rule < BSWM_NUM_RULES; rule++) {
+        for (port = 0U; port < BSWM_NUM_MODE_PORTS; port++) {
+            if ((BswM_RuleConfig[rule].ConditionMask & BswM_DecisionTable.portConditions[port]) != 0U) {
+                BswM_DecisionTable.portRules[port] |= static_cast<BswM_RuleMaskType>(1UL << rule);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Write a mode port and mark it for evaluation if it changed
+ */
+static Std_ReturnType BswM_WriteModePort(BswM_ModePortIdType port, uint8_t value) {
+    if ((port >= BSWM_NUM_MODE_PORTS) || (value >= BSWM_MAX_PORT_VALUES)) {
+        return E_NOT_OK;
+    }
+
+    if (BswM_ModePortValues[port] != value) {
+        BswM_ModePortValues[port] = value;
+        BswM_DirtyPorts |= (1UL << port);
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Re-evaluate the rules that depend on changed mode ports
+ */
+static void BswM_EvaluateRules(void) {
+    uint32_t dirtyPorts = BswM_DirtyPorts;
+    BswM_RuleMaskType dirtyRules = 0U;
+    BswM_RuleMaskType ruleBit;
+    uint8_t port;
+    uint8_t rule;
+    boolean result;
+    boolean changed;
+
+    BswM_DirtyPorts = 0U;
+
+    /* Update conditions of changed ports via the decision table */
+    while (dirtyPorts != 0U) {
+        port = BswM_LowestBit(dirtyPorts);
+        dirtyPorts &= (dirtyPorts - 1U);
+
+        BswM_ConditionResults = (BswM_ConditionResults & ~BswM_DecisionTable.portConditions[port]) |
+                                BswM_DecisionTable.valueConditions[port][BswM_ModePortValues[port]];
+        dirtyRules |= BswM_DecisionTable.portRules[port];
+    }
+
+    /* Evaluate affected rules in configuration order */
+    while (dirtyRules != 0U) {
+        rule = BswM_LowestBit(dirtyRules);
+        dirtyRules &= (dirtyRules - 1U);
+        ruleBit = static_cast<BswM_RuleMaskType>(1UL << rule);
+
+        result = ((BswM_ConditionResults & BswM_RuleConfig[rule].ConditionMask) ==
+                  BswM_RuleConfig[rule].ConditionMask);
+        changed = ((BswM_RulesEvaluated & ruleBit) == 0U) ||
+                  (((BswM_RuleResults & ruleBit) != 0U) != result);
+        BswM_RuleEvaluationCount++;
+
+        BswM_RulesEvaluated |= ruleBit;
+        if (result) {
+            BswM_RuleResults |= ruleBit;
+        } else {
+            BswM_RuleResults &= ~ruleBit;
+        }
+
+        /* Triggered action lists: executed on result change only */
+        if (changed) {
+            BswM_ExecuteActionList(result ? &BswM_RuleConfig[rule].TrueActionList :
+                                            &BswM_RuleConfig[rule].FalseActionList);
+        }
+    }
+}
+
+/**
+ * @brief Execute the actions of an action list in order
+ */
+static void BswM_ExecuteActionList(const BswM_ActionListConfigType* actionList) {
+    uint8_t i;
+    const BswM_ActionConfigType* action;
+
+    /* Com, Can and Dem are processed by the COM main functions of another task */
+    Os_GetSpinlock(OS_SPINLOCK_COMSTACK);
+
+    for (i = 0U; i < actionList->NumActions; i++) {
+        action = &actionList->Actions[i];
+
+        switch (action->Action) {
+            case BSWM_ACTION_SET_MODE:
+                BswM_CurrentMode = static_cast<BswM_ModeType>(action->Value);
+                break;
+
+            case BSWM_ACTION_COM_IPDUGROUP_START:
+                Com_IpduGroupStart(action->Target);
+                break;
+
+            case BSWM_ACTION_COM_IPDUGROUP_STOP:
+                Com_IpduGroupStop(action->Target);
+                break;
+
+            case BSWM_ACTION_CAN_SET_CONTROLLER_MODE:
+                (void)Can_SetControllerMode(static_cast<uint8_t>(action->Target),
+                                            static_cast<Can_ModeType>(action->Value));
+                break;
+
+            case BSWM_ACTION_DEM_ENABLE_CONDITION:
+                (void)Dem_SetEnableCondition(static_cast<Dem_EnableConditionIdType>(action->Target),
+                                             (action->Value != FALSE));
+                break;
+
+            default:
+                /* Unknown action: ignore */
+                break;
+        }
+    }
+
+    Os_ReleaseSpinlock(OS_SPINLOCK_COMSTACK);
+}
+
+/**
+ * @brief Index of the lowest set bit
+ */
+static uint8_t BswM_LowestBit(uint32_t mask) {
+    uint8_t index = 0U;
+
+    while ((mask & 1U) == 0U) {
+        mask >>= 1U;
+        index++;
+    }
+
+    return index;
+}
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS
+ *============================================================================*/
+
+/**
+ * @brief Get number of rule evaluations since BswM_Init
+ */
+uint32_t BswM_SimGetRuleEvaluationCount(void) {
+    return BswM_RuleEvaluationCount;
+}
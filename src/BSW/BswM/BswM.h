@@ -1,7 +1,9 @@
 /**
  * @file BswM.h
  * @brief AUTOSAR BSW Mode Manager Interface
- * @details BSW Mode Manager for mode arbitration and management
+ * @details BSW Mode Manager with rule engine: conditions over mode ports are
+ *          compiled into a decision table, rules are re-evaluated only when
+ *          one of their mode ports changed
  * @version 1.0.0
  * @date 2024
  *
@@ -16,6 +18,7 @@
  *============================================================================*/
 #include "Std_Types.h"
 #include "ComStack_Types.h"
+#include "BswM_Cfg.h"
 
 /*============================================================================*
  * TYPE DEFINITIONS
@@ -32,6 +35,28 @@ typedef enum {
     BSWM_MODE_SLEEP         = 0x04U
 } BswM_ModeType;
 
+/**
+ * @brief Rule bitset type (bit per rule ID)
+ */
+typedef uint32_t BswM_RuleMaskType;
+
+STD_STATIC_ASSERT(BSWM_NUM_CONDITIONS <= BSWM_MAX_CONDITIONS,
+                  "BswM_ConditionMaskType too small for condition count");
+STD_STATIC_ASSERT(BSWM_NUM_RULES <= BSWM_MAX_RULES,
+                  "BswM_RuleMaskType too small for rule count");
+
+/**
+ * @brief Decision table compiled from the rule configuration in BswM_Init
+ */
+typedef struct {
+    /** Conditions that depend on each mode port */
+    BswM_ConditionMaskType portConditions[BSWM_NUM_MODE_PORTS];
+    /** Conditions that are TRUE for each mode port value */
+    BswM_ConditionMaskType valueConditions[BSWM_NUM_MODE_PORTS][BSWM_MAX_PORT_VALUES];
+    /** Rules that depend on each mode port */
+    BswM_RuleMaskType portRules[BSWM_NUM_MODE_PORTS];
+} BswM_DecisionTableType;
+
 /**
  * @brief BswM configuration type
  */
@@ -39,6 +64,22 @@ typedef struct {
     uint8_t numModes;
 } BswM_ConfigType;
 
+/**
+ * @brief BswM snapshot (Ecu_SaveSnapshot)
+ * @details The decision table is derived from the configuration by
+ *          BswM_Init and not part of it
+ */
+typedef struct {
+    BswM_ModeType CurrentMode;
+    boolean ResetRequested;
+    uint8_t ModePortValues[BSWM_NUM_MODE_PORTS];
+    uint32_t DirtyPorts;
+    BswM_ConditionMaskType ConditionResults;
+    BswM_RuleMaskType RuleResults;
+    BswM_RuleMaskType RulesEvaluated;
+    uint32_t RuleEvaluationCount;
+} BswM_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -61,6 +102,7 @@ void BswM_MainFunction(void);
 
 /**
  * @brief Request mode
+ * @details Arbitrated by the rules in the next BswM_MainFunction
  * @param[in] requesting_user User requesting mode
  * @param[in] requested_mode Requested mode
  * @return E_OK on success
@@ -92,10 +134,40 @@ void BswM_EcuM_CurrentState(uint8_t state);
  */
 void BswM_RequestReset(void);
 
+/**
+ * @brief Get result of a rule
+ * @param[in] RuleId Rule ID
+ * @param[out] State Pointer to receive rule result
+ * @return E_OK if the rule has been evaluated
+ */
+Std_ReturnType BswM_GetRuleState(uint8_t RuleId, boolean* State);
+
+/**
+ * @brief Save mode and rule state (Ecu_SaveSnapshot)
+ * @param[out] Snapshot Mode and rule state
+ */
+void BswM_SaveSnapshot(BswM_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore mode and rule state (Ecu_RestoreSnapshot)
+ * @param[in] Snapshot Mode and rule state
+ */
+void BswM_RestoreSnapshot(const BswM_SnapshotType* Snapshot);
+
 /**
  * @brief Get version information
  * @param[out] VersionInfo Pointer to version info
  */
 void BswM_GetVersionInfo(Std_VersionInfoType* VersionInfo);
 
+/*============================================================================*
+ * SIMULATION FUNCTIONS (FOR TESTING)
+ *============================================================================*/
+
+/**
+ * @brief Get number of rule evaluations since BswM_Init
+ * @return Evaluation count
+ */
+uint32_t BswM_SimGetRuleEvaluationCount(void);
+
 #endif /* BSWM_H */
@@ -0,0 +1,318 @@
+/**
+ * @file Cal.cpp
+ * @brief Sensor Calibration Implementation
+ * @details Piecewise linear curves are interpolated with Q16 segment slopes.
+ *          Polynomial curves are evaluated once per raw value into the
+ *          lookup table, or sampled to CAL_POLY_INTERP_POINTS breakpoints
+ *          for interpolation mode. No floating point after init.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Cal.h"
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL TYPES AND MACROS
+ *============================================================================*/
+
+/** @brief Fractional bits of the segment slopes */
+#define CAL_SLOPE_SHIFT                     16U
+
+/**
+ * @brief Compiled curve
+ */
+typedef struct {
+    boolean Configured;                         /**< Curve converts */
+    Cal_ModeType Mode;                          /**< Effective conversion mode */
+    uint8_t NumPoints;                          /**< Breakpoints */
+    uint16_t OutMin;                            /**< Lower output limit */
+    uint16_t OutMax;                            /**< Upper output limit */
+    uint16_t Raw[CAL_MAX_POINTS];               /**< Breakpoint raw values */
+    uint16_t Value[CAL_MAX_POINTS];             /**< Breakpoint physical values */
+    sint64 Slope[CAL_MAX_POINTS];               /**< Segment slopes, Q16 */
+} Cal_CurveStateType;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static boolean Cal_CurveValid(const Cal_CurveConfigType* Curve);
+static void Cal_CompileCurve(Cal_CurveIdType CurveId, const Cal_CurveConfigType* Curve);
+static uint16_t Cal_Clamp(const Cal_CurveStateType* state, sint64 value);
+static uint16_t Cal_EvaluatePolynomial(const Cal_CurveConfigType* Curve, uint16_t raw);
+static uint16_t Cal_Interpolate(const Cal_CurveStateType* state, uint16_t raw);
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Initialization flag */
+static boolean Cal_Initialized = FALSE;
+
+/** @brief Compiled curves */
+static Cal_CurveStateType Cal_Curves[CAL_NUM_CURVES];
+
+#if (CAL_LUT_SUPPORT == STD_ON)
+/** @brief Lookup tables, one entry per raw value */
+static uint16_t Cal_Lut[CAL_NUM_CURVES][CAL_LUT_SIZE];
+#endif
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize calibration and compile all curves
+ */
+void Cal_Init(const Cal_ConfigType* ConfigPtr) {
+    uint8_t i;
+
+    Cal_Initialized = FALSE;
+    (void)std::memset(Cal_Curves, 0, sizeof(Cal_Curves));
+
+    if ((ConfigPtr == NULL_PTR) || (ConfigPtr->NumCurves > CAL_NUM_CURVES) ||
+        ((ConfigPtr->NumCurves > 0U) && (ConfigPtr->Curves == NULL_PTR))) {
+        return;
+    }
+
+    for (i = 0U; i < ConfigPtr->NumCurves; i++) {
+        if (Cal_CurveValid(&ConfigPtr->Curves[i])) {
+            Cal_CompileCurve(i, &ConfigPtr->Curves[i]);
+        }
+    }
+
+    Cal_Initialized = TRUE;
+}
+
+/**
+ * @brief Deinitialize calibration
+ */
+void Cal_DeInit(void) {
+    Cal_Initialized = FALSE;
+    (void)std::memset(Cal_Curves, 0, sizeof(Cal_Curves));
+}
+
+/**
+ * @brief Replace a calibration curve and recompile it
+ */
+Std_ReturnType Cal_SetCurve(Cal_CurveIdType CurveId, const Cal_CurveConfigType* Curve) {
+    if ((!Cal_Initialized) || (CurveId >= CAL_NUM_CURVES) || (!Cal_CurveValid(Curve))) {
+        return E_NOT_OK;
+    }
+
+    Cal_CompileCurve(CurveId, Curve);
+    return E_OK;
+}
+
+/**
+ * @brief Convert a raw value to its physical value
+ */
+uint16_t Cal_Convert(Cal_CurveIdType CurveId, uint16_t Raw) {
+    const Cal_CurveStateType* state;
+
+    if ((!Cal_Initialized) || (CurveId >= CAL_NUM_CURVES)) {
+        return 0U;
+    }
+
+    state = &Cal_Curves[CurveId];
+    if (!state->Configured) {
+        return 0U;
+    }
+
+    if (Raw > CAL_INPUT_MAX) {
+        Raw = CAL_INPUT_MAX;
+    }
+
+#if (CAL_LUT_SUPPORT == STD_ON)
+    if (state->Mode == CAL_MODE_LUT) {
+        return Cal_Lut[CurveId][Raw];
+    }
+#endif
+
+    return Cal_Interpolate(state, Raw);
+}
+
+/**
+ * @brief Get version information
+ */
+void Cal_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
+    if (VersionInfo == NULL_PTR) {
+        return;
+    }
+
+    VersionInfo->vendorID = 0U;
+    VersionInfo->moduleID = 255U;  /* Vendor specific module */
+    VersionInfo->sw_major_version = CAL_SW_MAJOR_VERSION;
+    VersionInfo->sw_minor_version = CAL_SW_MINOR_VERSION;
+    VersionInfo->sw_patch_version = CAL_SW_PATCH_VERSION;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Check a curve configuration
+ */
+static boolean Cal_CurveValid(const Cal_CurveConfigType* Curve) {
+    uint8_t i;
+
+    if ((Curve == NULL_PTR) || (Curve->OutMin > Curve->OutMax) ||
+        ((Curve->Mode != CAL_MODE_LUT) && (Curve->Mode != CAL_MODE_INTERPOLATE))) {
+        return FALSE;
+    }
+
+    switch (Curve->Shape) {
+        case CAL_CURVE_PIECEWISE_LINEAR:
+            if ((Curve->NumPoints < 2U) || (Curve->NumPoints > CAL_MAX_POINTS) ||
+                (Curve->RawPoints == NULL_PTR) || (Curve->Values == NULL_PTR)) {
+                return FALSE;
+            }
+            for (i = 0U; i < Curve->NumPoints; i++) {
+                if ((Curve->RawPoints[i] > CAL_INPUT_MAX) ||
+                    ((i > 0U) && (Curve->RawPoints[i] <= Curve->RawPoints[i - 1U]))) {
+                    return FALSE;
+                }
+            }
+            return TRUE;
+
+        case CAL_CURVE_POLYNOMIAL:
+            return ((Curve->Degree <= CAL_MAX_POLY_DEGREE) &&
+                    (Curve->Coefficients != NULL_PTR)) ? TRUE : FALSE;
+
+        default:
+            return FALSE;
+    }
+}
+
+/**
+ * @brief Build breakpoints, slopes and lookup table of a valid curve
+ */
+static void Cal_CompileCurve(Cal_CurveIdType CurveId, const Cal_CurveConfigType* Curve) {
+    Cal_CurveStateType* state = &Cal_Curves[CurveId];
+    sint64 dy;
+    sint64 dx;
+    uint32_t raw;
+    uint8_t i;
+
+    state->Configured = FALSE;
+    state->OutMin = Curve->OutMin;
+    state->OutMax = Curve->OutMax;
+
+    /* Breakpoints: copied, or sampled uniformly from the polynomial */
+    if (Curve->Shape == CAL_CURVE_PIECEWISE_LINEAR) {
+        state->NumPoints = Curve->NumPoints;
+        for (i = 0U; i < Curve->NumPoints; i++) {
+            state->Raw[i] = Curve->RawPoints[i];
+            state->Value[i] = Curve->Values[i];
+        }
+    } else {
+        state->NumPoints = CAL_POLY_INTERP_POINTS;
+        for (i = 0U; i < CAL_POLY_INTERP_POINTS; i++) {
+            raw = ((static_cast<uint32_t>(i) * CAL_INPUT_MAX) +
+                   ((CAL_POLY_INTERP_POINTS - 1U) / 2U)) / (CAL_POLY_INTERP_POINTS - 1U);
+            state->Raw[i] = static_cast<uint16_t>(raw);
+            state->Value[i] = Cal_EvaluatePolynomial(Curve, state->Raw[i]);
+        }
+    }
+
+    /* Segment slopes in Q16, rounded to nearest */
+    for (i = 0U; (i + 1U) < state->NumPoints; i++) {
+        dy = static_cast<sint64>(state->Value[i + 1U]) - static_cast<sint64>(state->Value[i]);
+        dx = static_cast<sint64>(state->Raw[i + 1U]) - static_cast<sint64>(state->Raw[i]);
+        dy *= (static_cast<sint64>(1) << CAL_SLOPE_SHIFT);
+        state->Slope[i] = ((dy >= 0) ? (dy + (dx / 2)) : (dy - (dx / 2))) / dx;
+    }
+
+#if (CAL_LUT_SUPPORT == STD_ON)
+    state->Mode = Curve->Mode;
+    if (Curve->Mode == CAL_MODE_LUT) {
+        /* Piecewise entries come from the interpolator, so both modes agree */
+        for (raw = 0U; raw < CAL_LUT_SIZE; raw++) {
+            Cal_Lut[CurveId][raw] = (Curve->Shape == CAL_CURVE_PIECEWISE_LINEAR) ?
+                Cal_Interpolate(state, static_cast<uint16_t>(raw)) :
+                Cal_EvaluatePolynomial(Curve, static_cast<uint16_t>(raw));
+        }
+    }
+#else
+    state->Mode = CAL_MODE_INTERPOLATE;
+#endif
+
+    state->Configured = TRUE;
+}
+
+/**
+ * @brief Limit a value to the output range of the curve
+ */
+static uint16_t Cal_Clamp(const Cal_CurveStateType* state, sint64 value) {
+    if (value < static_cast<sint64>(state->OutMin)) {
+        return state->OutMin;
+    }
+    if (value > static_cast<sint64>(state->OutMax)) {
+        return state->OutMax;
+    }
+    return static_cast<uint16_t>(value);
+}
+
+/**
+ * @brief Evaluate a polynomial (Horner), rounded and limited to the output range
+ */
+static uint16_t Cal_EvaluatePolynomial(const Cal_CurveConfigType* Curve, uint16_t raw) {
+    const float64 x = static_cast<float64>(raw);
+    float64 y = 0.0;
+    uint8_t i = static_cast<uint8_t>(Curve->Degree + 1U);
+
+    while (i > 0U) {
+        i--;
+        y = (y * x) + Curve->Coefficients[i];
+    }
+
+    /* Comparisons also catch NaN before the integer conversion */
+    if (!(y >= static_cast<float64>(Curve->OutMin))) {
+        return Curve->OutMin;
+    }
+    if (!(y <= static_cast<float64>(Curve->OutMax))) {
+        return Curve->OutMax;
+    }
+    return static_cast<uint16_t>(y + 0.5);
+}
+
+/**
+ * @brief Interpolate between the breakpoints of a curve
+ * @details Constant outside the breakpoint range
+ */
+static uint16_t Cal_Interpolate(const Cal_CurveStateType* state, uint16_t raw) {
+    const uint8_t last = static_cast<uint8_t>(state->NumPoints - 1U);
+    uint8_t lo = 0U;
+    uint8_t hi = last;
+    uint8_t mid;
+    sint64 offset;
+
+    if (raw <= state->Raw[0]) {
+        return Cal_Clamp(state, state->Value[0]);
+    }
+    if (raw >= state->Raw[last]) {
+        return Cal_Clamp(state, state->Value[last]);
+    }
+
+    /* Segment lo with Raw[lo] <= raw < Raw[lo + 1] */
+    while ((lo + 1U) < hi) {
+        mid = static_cast<uint8_t>((lo + hi) / 2U);
+        if (state->Raw[mid] <= raw) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    offset = (static_cast<sint64>(raw - state->Raw[lo]) * state->Slope[lo]) +
+             (static_cast<sint64>(1) << (CAL_SLOPE_SHIFT - 1U));
+
+    return Cal_Clamp(state, static_cast<sint64>(state->Value[lo]) + (offset >> CAL_SLOPE_SHIFT));
+}
@@ -0,0 +1,133 @@
+/**
+ * @file Cal.h
+ * @brief Sensor Calibration Interface
+ * @details Converts raw ADC values to physical values through calibration
+ *          curves (piecewise linear or polynomial). Curves are compiled at
+ *          init into a lookup table with one entry per raw value, or into
+ *          fixed-point breakpoint slopes for table-free interpolation.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef CAL_H
+#define CAL_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Cal_Cfg.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define CAL_AR_RELEASE_MAJOR_VERSION        23
+#define CAL_AR_RELEASE_MINOR_VERSION        11
+
+#define CAL_SW_MAJOR_VERSION                1
+#define CAL_SW_MINOR_VERSION                0
+#define CAL_SW_PATCH_VERSION                0
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Calibration curve identifier
+ */
+typedef uint8_t Cal_CurveIdType;
+
+/**
+ * @brief Calibration curve shape
+ */
+typedef enum {
+    CAL_CURVE_PIECEWISE_LINEAR  = 0x00U,    /**< Breakpoints, linear in between */
+    CAL_CURVE_POLYNOMIAL        = 0x01U     /**< c0 + c1*x + ... + cn*x^n */
+} Cal_CurveShapeType;
+
+/**
+ * @brief Conversion mode
+ */
+typedef enum {
+    CAL_MODE_LUT                = 0x00U,    /**< Precomputed lookup table */
+    CAL_MODE_INTERPOLATE        = 0x01U     /**< Fixed-point breakpoint interpolation */
+} Cal_ModeType;
+
+/**
+ * @brief Calibration curve configuration
+ */
+typedef struct {
+    Cal_CurveShapeType Shape;           /**< Curve shape */
+    Cal_ModeType Mode;                  /**< Conversion mode */
+    uint8_t NumPoints;                  /**< Piecewise: number of breakpoints */
+    const uint16_t* RawPoints;          /**< Piecewise: raw values, strictly increasing */
+    const uint16_t* Values;             /**< Piecewise: physical values */
+    uint8_t Degree;                     /**< Polynomial: degree */
+    const float64* Coefficients;        /**< Polynomial: c0..cDegree */
+    uint16_t OutMin;                    /**< Lower output limit */
+    uint16_t OutMax;                    /**< Upper output limit */
+} Cal_CurveConfigType;
+
+/**
+ * @brief Calibration configuration
+ */
+typedef struct {
+    uint8_t NumCurves;                  /**< Number of curves (<= CAL_NUM_CURVES) */
+    const Cal_CurveConfigType* Curves;  /**< Curves, indexed by curve ID */
+} Cal_ConfigType;
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Calibration configuration of the FLM ECU (Cal_Cfg.cpp) */
+extern const Cal_ConfigType Cal_Config;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize calibration and compile all curves
+ * @details A curve with an invalid configuration stays unconfigured and
+ *          converts to 0.
+ * @param[in] ConfigPtr Pointer to configuration
+ */
+void Cal_Init(const Cal_ConfigType* ConfigPtr);
+
+/**
+ * @brief Deinitialize calibration
+ */
+void Cal_DeInit(void);
+
+/**
+ * @brief Replace a calibration curve and recompile it
+ * @details With CAL_LUT_SUPPORT == STD_OFF a LUT curve is converted by
+ *          interpolation. The curve data is copied, the caller's arrays
+ *          need not outlive the call.
+ * @param[in] CurveId Curve identifier
+ * @param[in] Curve New curve configuration
+ * @return E_OK on success, E_NOT_OK if not initialized or invalid
+ */
+Std_ReturnType Cal_SetCurve(Cal_CurveIdType CurveId, const Cal_CurveConfigType* Curve);
+
+/**
+ * @brief Convert a raw value to its physical value
+ * @details Raw values above CAL_INPUT_MAX are treated as CAL_INPUT_MAX.
+ *          LUT and interpolation mode give identical results for piecewise
+ *          linear curves.
+ * @param[in] CurveId Curve identifier
+ * @param[in] Raw Raw value
+ * @return Physical value, 0 if not initialized or the curve is unconfigured
+ */
+uint16_t Cal_Convert(Cal_CurveIdType CurveId, uint16_t Raw);
+
+/**
+ * @brief Get version information
+ * @param[out] VersionInfo Pointer to version info structure
+ */
+void Cal_GetVersionInfo(Std_VersionInfoType* VersionInfo);
+
+#endif /* CAL_H */
@@ -13,23 +13,10 @@
  *============================================================================*/
 #include "Com.h"
 #include "Application/SwitchEvent/SwitchEvent.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
 #include <cstring>
 
-/*============================================================================*
- * LOCAL TYPES
- *============================================================================*/
-
-/**
- * @brief I-PDU runtime data
- */
-typedef struct {
-    uint8_t data[8];
-    uint8_t length;
-    boolean newData;
-    uint32_t rxTimestamp;
-    uint16_t timeoutCounter;
-} Com_IpduDataType;
-
 /*============================================================================*
  * LOCAL VARIABLES
  *============================================================================*/
@@ -46,6 +33,25 @@ static uint32_t Com_SignalData[COM_MAX_SIGNAL_COUNT];
 /** @brief RX timeout callback enabled */
 static boolean Com_TimeoutEnabled = TRUE;
 
+/** @brief I-PDU group of each I-PDU */
+static const uint8_t Com_IpduGroupOfIpdu[COM_NUM_IPDUS] = {
+    COM_IPDUGROUP_RX,   /* COM_IPDU_LIGHTSWITCH_RX */
+    COM_IPDUGROUP_TX,   /* COM_IPDU_LIGHTSWITCH_ACK_TX */
+    COM_IPDUGROUP_TX    /* COM_IPDU_HEADLIGHT_STATUS_TX */
+};
+
+/** @brief Started I-PDU groups (bit per group) */
+static uint8_t Com_IpduGroupsStarted = 0U;
+
+/** @brief RX indication hook (NULL_PTR = none) */
+static Com_RxIndicationHookType Com_RxIndicationHook = NULL_PTR;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static boolean Com_IsIpduActive(PduIdType PduId);
+
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
  *============================================================================*/
@@ -70,6 +76,12 @@ void Com_Init(void) {
         Com_SignalData[i] = 0U;
     }
 
+#if (COM_IPDUGROUP_START_ON_INIT == STD_ON)
+    Com_IpduGroupsStarted = static_cast<uint8_t>((1U << COM_NUM_IPDU_GROUPS) - 1U);
+#else
+    Com_IpduGroupsStarted = 0U;
+#endif
+
     Com_Initialized = TRUE;
 }
 
@@ -90,8 +102,15 @@ void Com_MainFunctionRx(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_COM_RX);
+
     /* Process received data and update timeout counters */
     for (i = 0U; i < COM_NUM_IPDUS; i++) {
+        /* No reception and no deadline monitoring in stopped groups */
+        if (!Com_IsIpduActive(i)) {
+            continue;
+        }
+
         if (Com_IpduData[i].newData) {
             /* Reset timeout counter on new data */
             Com_IpduData[i].timeoutCounter = 0U;
@@ -111,6 +130,8 @@ void Com_MainFunctionRx(void) {
             }
         }
     }
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_COM_RX);
 }
 
 /**
@@ -121,7 +142,11 @@ void Com_MainFunctionTx(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_COM_TX);
+
     /* TX processing would happen here */
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_COM_TX);
 }
 
 /**
@@ -164,6 +189,10 @@ Std_ReturnType Com_ReceiveSignal(uint16_t SignalId, void* SignalDataPtr) {
  * @brief RX indication callback
  */
 void Com_RxIndication(PduIdType PduId, const PduInfoType* PduInfoPtr) {
+    if (Com_RxIndicationHook != NULL_PTR) {
+        Com_RxIndicationHook(PduId, PduInfoPtr);
+    }
+
     if (!Com_Initialized) {
         return;
     }
@@ -176,6 +205,13 @@ void Com_RxIndication(PduIdType PduId, const PduInfoType* PduInfoPtr) {
         return;
     }
 
+    /* Discard I-PDUs of stopped groups */
+    if (!Com_IsIpduActive(PduId)) {
+        Metrics_Increment(METRICS_COM_RX_DISCARDED);
+        return;
+    }
+    Metrics_Increment(METRICS_COM_RX_ACCEPTED);
+
     /* Store received data */
     uint8_t length = (PduInfoPtr->SduLength > 8U) ? 8U :
                      static_cast<uint8_t>(PduInfoPtr->SduLength);
@@ -185,6 +221,13 @@ void Com_RxIndication(PduIdType PduId, const PduInfoType* PduInfoPtr) {
     Com_IpduData[PduId].newData = TRUE;
 }
 
+/**
+ * @brief Set RX indication hook
+ */
+void Com_SetRxIndicationHook(Com_RxIndicationHookType Hook) {
+    Com_RxIndicationHook = Hook;
+}
+
 /**
  * @brief TX confirmation callback
  */
@@ -210,6 +253,10 @@ Std_ReturnType Com_TriggerIPDUSend(PduIdType PduId) {
         return E_NOT_OK;
     }
 
+    if (!Com_IsIpduActive(PduId)) {
+        return E_NOT_OK;
+    }
+
     /* Would trigger actual transmission */
 
     return E_OK;
@@ -219,18 +266,79 @@ Std_ReturnType Com_TriggerIPDUSend(PduIdType PduId) {
  * @brief Start I-PDU group
  */
 void Com_IpduGroupStart(uint16_t IpduGroupId) {
-    STD_UNUSED(IpduGroupId);
+    uint8_t i;
 
-    /* Enable I-PDU group */
+    if (IpduGroupId >= COM_NUM_IPDU_GROUPS) {
+        return;
+    }
+
+    if (Com_IsIpduGroupStarted(IpduGroupId)) {
+        return;
+    }
+
+    /* Restart deadline monitoring of the group's I-PDUs */
+    for (i = 0U; i < COM_NUM_IPDUS; i++) {
+        if (Com_IpduGroupOfIpdu[i] == IpduGroupId) {
+            Com_IpduData[i].newData = FALSE;
+            Com_IpduData[i].timeoutCounter = 0U;
+        }
+    }
+
+    Com_IpduGroupsStarted = static_cast<uint8_t>(Com_IpduGroupsStarted | (1U << IpduGroupId));
 }
 
 /**
  * @brief Stop I-PDU group
  */
 void Com_IpduGroupStop(uint16_t IpduGroupId) {
-    STD_UNUSED(IpduGroupId);
+    if (IpduGroupId >= COM_NUM_IPDU_GROUPS) {
+        return;
+    }
+
+    Com_IpduGroupsStarted = static_cast<uint8_t>(Com_IpduGroupsStarted & ~(1U << IpduGroupId));
+}
+
+/**
+ * @brief Check if I-PDU group is started
+ */
+boolean Com_IsIpduGroupStarted(uint16_t IpduGroupId) {
+    if (IpduGroupId >= COM_NUM_IPDU_GROUPS) {
+        return FALSE;
+    }
+
+    return ((Com_IpduGroupsStarted & (1U << IpduGroupId)) != 0U);
+}
+
+/**
+ * @brief Save I-PDU and signal data
+ */
+void Com_SaveSnapshot(Com_SnapshotType* Snapshot) {
+    (void)memcpy(Snapshot->IpduData, Com_IpduData, sizeof(Com_IpduData));
+    (void)memcpy(Snapshot->SignalData, Com_SignalData, sizeof(Com_SignalData));
+    Snapshot->TimeoutEnabled = Com_TimeoutEnabled;
+    Snapshot->IpduGroupsStarted = Com_IpduGroupsStarted;
+}
+
+/**
+ * @brief Restore I-PDU and signal data
+ */
+void Com_RestoreSnapshot(const Com_SnapshotType* Snapshot) {
+    (void)memcpy(Com_IpduData, Snapshot->IpduData, sizeof(Com_IpduData));
+    (void)memcpy(Com_SignalData, Snapshot->SignalData, sizeof(Com_SignalData));
+    Com_TimeoutEnabled = Snapshot->TimeoutEnabled;
+    Com_IpduGroupsStarted = Snapshot->IpduGroupsStarted;
+}
+
+/**
+ * @brief Check if the group of an I-PDU is started
+ * @details I-PDUs without group assignment are always active
+ */
+static boolean Com_IsIpduActive(PduIdType PduId) {
+    if (PduId >= COM_NUM_IPDUS) {
+        return TRUE;
+    }
 
-    /* Disable I-PDU group */
+    return Com_IsIpduGroupStarted(Com_IpduGroupOfIpdu[PduId]);
 }
 
 /**
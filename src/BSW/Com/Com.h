@@ -18,6 +18,36 @@
 #include "ComStack_Types.h"
 #include "Com_Cfg.h"
 
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief RX indication hook type (e.g. input recorder)
+ */
+typedef void (*Com_RxIndicationHookType)(PduIdType PduId, const PduInfoType* PduInfoPtr);
+
+/**
+ * @brief I-PDU runtime data
+ */
+typedef struct {
+    uint8_t data[8];
+    uint8_t length;
+    boolean newData;
+    uint32_t rxTimestamp;
+    uint16_t timeoutCounter;
+} Com_IpduDataType;
+
+/**
+ * @brief COM snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    Com_IpduDataType IpduData[COM_MAX_IPDU_COUNT];
+    uint32_t SignalData[COM_MAX_SIGNAL_COUNT];
+    boolean TimeoutEnabled;
+    uint8_t IpduGroupsStarted;
+} Com_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -65,6 +95,13 @@ Std_ReturnType Com_ReceiveSignal(uint16_t SignalId, void* SignalDataPtr);
  */
 void Com_RxIndication(PduIdType PduId, const PduInfoType* PduInfoPtr);
 
+/**
+ * @brief Set RX indication hook
+ * @details Called with every Com_RxIndication before it is checked
+ * @param[in] Hook RX indication hook, NULL_PTR to remove
+ */
+void Com_SetRxIndicationHook(Com_RxIndicationHookType Hook);
+
 /**
  * @brief TX confirmation callback
  * @param[in] TxPduId PDU identifier
@@ -90,6 +127,25 @@ void Com_IpduGroupStart(uint16_t IpduGroupId);
  */
 void Com_IpduGroupStop(uint16_t IpduGroupId);
 
+/**
+ * @brief Check if I-PDU group is started
+ * @param[in] IpduGroupId I-PDU group identifier
+ * @return TRUE if started
+ */
+boolean Com_IsIpduGroupStarted(uint16_t IpduGroupId);
+
+/**
+ * @brief Save I-PDU and signal data (Ecu_SaveSnapshot)
+ * @param[out] Snapshot I-PDU and signal data
+ */
+void Com_SaveSnapshot(Com_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore I-PDU and signal data (Ecu_RestoreSnapshot)
+ * @param[in] Snapshot I-PDU and signal data
+ */
+void Com_RestoreSnapshot(const Com_SnapshotType* Snapshot);
+
 /**
  * @brief Get version information
  * @param[out] VersionInfo Pointer to version info
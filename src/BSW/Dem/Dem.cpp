@@ -12,22 +12,10 @@
  * INCLUDES
  *============================================================================*/
 #include "Dem.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
 #include <cstring>
 
-/*============================================================================*
- * LOCAL TYPES
- *============================================================================*/
-
-/**
- * @brief Event runtime data
- */
-typedef struct {
-    Dem_UdsStatusByteType udsStatus;
-    sint16_t debounceCounter;
-    uint16_t occurrenceCounter;
-    boolean stored;
-} Dem_EventDataType;
-
 /*============================================================================*
  * LOCAL VARIABLES
  *============================================================================*/
@@ -44,6 +32,35 @@ static Dem_EventDataType Dem_EventData[DEM_MAX_NUM_EVENTS];
 /** @brief Number of stored events */
 static uint16_t Dem_StoredEventCount = 0U;
 
+/** @brief Fulfilled enable conditions (bit per condition) */
+static uint8_t Dem_EnableConditions = 0U;
+
+/** @brief All enable conditions fulfilled */
+#define DEM_ENABLE_CONDITIONS_ALL \
+    static_cast<uint8_t>((1U << DEM_NUM_ENABLE_CONDITIONS) - 1U)
+
+/** @brief Enable condition mask of communication related events */
+#define DEM_ENABLE_CONDITIONS_COM \
+    static_cast<uint8_t>((1U << DEM_ENABLE_CONDITION_COMMUNICATION) | (1U << DEM_ENABLE_CONDITION_ECU_RUN))
+
+/** @brief Enable condition mask of the remaining events */
+#define DEM_ENABLE_CONDITIONS_RUN \
+    static_cast<uint8_t>(1U << DEM_ENABLE_CONDITION_ECU_RUN)
+
+/** @brief Required enable conditions per event, indexed by event ID */
+static const uint8_t Dem_EventEnableConditions[DEM_EVENT_MAX] = {
+    0U,                             /* DEM_EVENT_INVALID */
+    DEM_ENABLE_CONDITIONS_COM,      /* DEM_EVENT_E2E_LIGHTSWITCH_FAILED */
+    DEM_ENABLE_CONDITIONS_RUN,      /* DEM_EVENT_AMBIENTLIGHT_OPEN_CIRCUIT */
+    DEM_ENABLE_CONDITIONS_RUN,      /* DEM_EVENT_AMBIENTLIGHT_SHORT_CIRCUIT */
+    DEM_ENABLE_CONDITIONS_RUN,      /* DEM_EVENT_AMBIENTLIGHT_PLAUSIBILITY */
+    DEM_ENABLE_CONDITIONS_RUN,      /* DEM_EVENT_HEADLIGHT_OPEN_LOAD */
+    DEM_ENABLE_CONDITIONS_RUN,      /* DEM_EVENT_HEADLIGHT_SHORT_CIRCUIT */
+    DEM_ENABLE_CONDITIONS_COM,      /* DEM_EVENT_CAN_TIMEOUT */
+    0U,                             /* DEM_EVENT_WDGM_SUPERVISION_FAILED */
+    0U                              /* DEM_EVENT_SAFE_STATE_ENTERED */
+};
+
 /*============================================================================*
  * LOCAL FUNCTION PROTOTYPES
  *============================================================================*/
@@ -78,6 +95,7 @@ void Dem_PreInit(void) {
 void Dem_Init(void) {
     Dem_PreInit();
     Dem_DTCSettingEnabled = TRUE;
+    Dem_EnableConditions = DEM_ENABLE_CONDITIONS_ALL;
     Dem_Initialized = TRUE;
 }
 
@@ -97,7 +115,11 @@ void Dem_MainFunction(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_DEM);
+
     /* Aging and other periodic processing would happen here */
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_DEM);
 }
 
 /**
@@ -119,6 +141,14 @@ Std_ReturnType Dem_SetEventStatus(
         return E_NOT_OK;
     }
 
+    /* Results reported while an enable condition is not fulfilled are ignored */
+    if ((EventId < DEM_EVENT_MAX) &&
+        ((Dem_EventEnableConditions[EventId] & Dem_EnableConditions) != Dem_EventEnableConditions[EventId])) {
+        return E_NOT_OK;
+    }
+
+    TRACE_DEM_EVENT(EventId, EventStatus);
+
     /* Process debounce */
     Dem_ProcessDebounce(EventId, EventStatus);
 
@@ -129,7 +159,7 @@ Std_ReturnType Dem_SetEventStatus(
  * @brief Process debounce algorithm
  */
 static void Dem_ProcessDebounce(DEM_EventIdType EventId, Dem_EventStatusType Status) {
-    sint16_t* counter;
+    sint16* counter;
     boolean testFailed = FALSE;
 
     if (EventId >= DEM_MAX_NUM_EVENTS) {
@@ -181,12 +211,14 @@ static void Dem_ProcessDebounce(DEM_EventIdType EventId, Dem_EventStatusType Sta
  */
 static void Dem_UpdateUdsStatus(DEM_EventIdType EventId, boolean testFailed) {
     Dem_UdsStatusByteType* status;
+    boolean wasFailed;
 
     if (EventId >= DEM_MAX_NUM_EVENTS) {
         return;
     }
 
     status = &Dem_EventData[EventId].udsStatus;
+    wasFailed = ((*status & DEM_UDS_STATUS_TF) != 0U) ? TRUE : FALSE;
 
     /* Clear TNCTOC - test completed this operation cycle */
     *status &= ~DEM_UDS_STATUS_TNCTOC;
@@ -229,6 +261,11 @@ static void Dem_UpdateUdsStatus(DEM_EventIdType EventId, boolean testFailed) {
         /* Clear TFTOC */
         *status &= ~DEM_UDS_STATUS_TFTOC;
     }
+
+    /* Count TF transitions of the configured events */
+    if ((wasFailed != testFailed) && (EventId > DEM_EVENT_INVALID) && (EventId < DEM_EVENT_MAX)) {
+        Metrics_Increment(METRICS_DEM_TRANSITION(EventId, testFailed));
+    }
 }
 
 /**
@@ -356,6 +393,26 @@ Std_ReturnType Dem_DisableDTCSetting(void) {
     return E_OK;
 }
 
+/**
+ * @brief Set enable condition
+ */
+Std_ReturnType Dem_SetEnableCondition(
+    Dem_EnableConditionIdType EnableConditionID,
+    boolean ConditionFulfilled
+) {
+    if (EnableConditionID >= DEM_NUM_ENABLE_CONDITIONS) {
+        return E_NOT_OK;
+    }
+
+    if (ConditionFulfilled) {
+        Dem_EnableConditions = static_cast<uint8_t>(Dem_EnableConditions | (1U << EnableConditionID));
+    } else {
+        Dem_EnableConditions = static_cast<uint8_t>(Dem_EnableConditions & ~(1U << EnableConditionID));
+    }
+
+    return E_OK;
+}
+
 /**
  * @brief Get number of stored events
  */
@@ -369,6 +426,26 @@ Std_ReturnType Dem_GetNumberOfEvents(uint16_t* NumberOfEvents) {
     return E_OK;
 }
 
+/**
+ * @brief Save event memory
+ */
+void Dem_SaveSnapshot(Dem_SnapshotType* Snapshot) {
+    Snapshot->DTCSettingEnabled = Dem_DTCSettingEnabled;
+    (void)memcpy(Snapshot->EventData, Dem_EventData, sizeof(Dem_EventData));
+    Snapshot->StoredEventCount = Dem_StoredEventCount;
+    Snapshot->EnableConditions = Dem_EnableConditions;
+}
+
+/**
+ * @brief Restore event memory
+ */
+void Dem_RestoreSnapshot(const Dem_SnapshotType* Snapshot) {
+    Dem_DTCSettingEnabled = Snapshot->DTCSettingEnabled;
+    (void)memcpy(Dem_EventData, Snapshot->EventData, sizeof(Dem_EventData));
+    Dem_StoredEventCount = Snapshot->StoredEventCount;
+    Dem_EnableConditions = Snapshot->EnableConditions;
+}
+
 /**
  * @brief Get version information
  */
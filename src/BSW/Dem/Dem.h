@@ -18,6 +18,30 @@
 #include "Rte/Rte_Type.h"
 #include "Dem_Cfg.h"
 
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Event runtime data
+ */
+typedef struct {
+    Dem_UdsStatusByteType udsStatus;
+    sint16 debounceCounter;
+    uint16_t occurrenceCounter;
+    boolean stored;
+} Dem_EventDataType;
+
+/**
+ * @brief DEM snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    boolean DTCSettingEnabled;
+    Dem_EventDataType EventData[DEM_MAX_NUM_EVENTS];
+    uint16_t StoredEventCount;
+    uint8_t EnableConditions;
+} Dem_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -107,6 +131,19 @@ Std_ReturnType Dem_EnableDTCSetting(void);
  */
 Std_ReturnType Dem_DisableDTCSetting(void);
 
+/**
+ * @brief Set enable condition
+ * @details Events are only processed while all their enable conditions
+ *          are fulfilled
+ * @param[in] EnableConditionID Enable condition ID
+ * @param[in] ConditionFulfilled TRUE if fulfilled
+ * @return E_OK on success
+ */
+Std_ReturnType Dem_SetEnableCondition(
+    Dem_EnableConditionIdType EnableConditionID,
+    boolean ConditionFulfilled
+);
+
 /**
  * @brief Get number of stored events
  * @param[out] NumberOfEvents Pointer to receive count
@@ -114,6 +151,18 @@ Std_ReturnType Dem_DisableDTCSetting(void);
  */
 Std_ReturnType Dem_GetNumberOfEvents(uint16_t* NumberOfEvents);
 
+/**
+ * @brief Save event memory (Ecu_SaveSnapshot)
+ * @param[out] Snapshot Event memory
+ */
+void Dem_SaveSnapshot(Dem_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore event memory (Ecu_RestoreSnapshot)
+ * @param[in] Snapshot Event memory
+ */
+void Dem_RestoreSnapshot(const Dem_SnapshotType* Snapshot);
+
 /**
  * @brief Get version information
  * @param[out] VersionInfo Pointer to version info
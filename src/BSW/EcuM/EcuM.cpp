@@ -0,0 +1,403 @@
+/**
+ * @file EcuM.cpp
+ * @brief AUTOSAR ECU State Manager Implementation
+ * @details Dependency ordered, profiled startup and reverse order shutdown
+ *          of the init items configured in EcuM_Cfg
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "EcuM.h"
+#include "BSW/BswM/BswM.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static uint64_t EcuM_GetTimeNs(void);
+static void EcuM_RunItem(uint8_t itemId, uint8_t wave, uint8_t worker);
+static void EcuM_RunWorker(uint8_t worker);
+static void EcuM_RunWave(EcuM_InitItemMaskType wave, uint8_t waveIndex);
+static void EcuM_BuildPhaseProfile(void);
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief All init item bits */
+static const EcuM_InitItemMaskType EcuM_AllItems =
+    static_cast<EcuM_InitItemMaskType>((static_cast<uint64_t>(1U) << ECUM_NUM_INIT_ITEMS) - 1U);
+
+/** @brief Current state */
+static EcuM_StateType EcuM_State = ECUM_STATE_UNINIT;
+
+/** @brief Initialized (or preserved) init items */
+static EcuM_InitItemMaskType EcuM_InitializedItems = 0U;
+
+/** @brief Items kept by the last EcuM_GoDown for a warm start */
+static EcuM_InitItemMaskType EcuM_PreservedItems = 0U;
+
+/** @brief Initialization order of the executed items (shutdown in reverse) */
+static uint8_t EcuM_InitOrder[ECUM_NUM_INIT_ITEMS];
+static uint8_t EcuM_InitOrderCount = 0U;
+
+/** @brief Configured parallelism */
+static uint8_t EcuM_MaxParallelInit = 1U;
+
+/** @brief Startup profile of the last EcuM_Init */
+static EcuM_StartupProfileType EcuM_Profile;
+
+/** @brief Time reference of the startup profile */
+static uint64_t EcuM_StartNs = 0U;
+
+/** @brief Parallel items of the current wave, taken by the workers */
+static uint8_t EcuM_WaveItems[ECUM_NUM_INIT_ITEMS];
+static uint8_t EcuM_WaveItemCount = 0U;
+static uint8_t EcuM_WaveIndex = 0U;
+static std::atomic<uint8_t> EcuM_WaveNext(0U);
+
+/** @brief Phase names for reports, indexed by EcuM_PhaseType */
+static const char* const EcuM_PhaseNames[ECUM_NUM_PHASES] = { "MCAL", "BSW", "SWC" };
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Run the startup sequence
+ */
+Std_ReturnType EcuM_Init(const EcuM_ConfigType* ConfigPtr, EcuM_StartupType StartupType) {
+    EcuM_InitItemMaskType done;
+    EcuM_InitItemMaskType ready;
+    uint8_t waveIndex = 0U;
+    uint8_t i;
+
+    if (EcuM_State != ECUM_STATE_UNINIT) {
+        return E_NOT_OK;
+    }
+
+    EcuM_MaxParallelInit = 1U;
+    if ((ConfigPtr != NULL_PTR) && (ConfigPtr->MaxParallelInit > 1U)) {
+        EcuM_MaxParallelInit = (ConfigPtr->MaxParallelInit < ECUM_MAX_PARALLEL_INIT) ?
+                               ConfigPtr->MaxParallelInit :
+                               static_cast<uint8_t>(ECUM_MAX_PARALLEL_INIT);
+    }
+
+    /* Warm start needs state kept by EcuM_GoDown(WARM) */
+    if ((StartupType == ECUM_STARTUP_WARM) && (EcuM_PreservedItems == 0U)) {
+        StartupType = ECUM_STARTUP_COLD;
+    }
+
+    (void)std::memset(&EcuM_Profile, 0, sizeof(EcuM_Profile));
+    EcuM_Profile.StartupType = StartupType;
+    EcuM_Profile.MaxParallelInit = EcuM_MaxParallelInit;
+
+    EcuM_State = ECUM_STATE_STARTUP;
+    EcuM_StartNs = EcuM_GetTimeNs();
+
+    if (StartupType == ECUM_STARTUP_WARM) {
+        done = EcuM_PreservedItems;
+    } else {
+        done = 0U;
+        EcuM_InitOrderCount = 0U;
+    }
+    EcuM_PreservedItems = 0U;
+    EcuM_InitializedItems = done;
+
+    while (done != EcuM_AllItems) {
+        ready = 0U;
+        for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+            if (((done & ECUM_DEP(i)) == 0U) &&
+                ((EcuM_InitItemConfig[i].DependsOn & ~done) == 0U)) {
+                ready |= ECUM_DEP(i);
+            }
+        }
+
+        /* Remaining items wait for each other or for unknown items,
+         * the items started so far are left for EcuM_GoDown */
+        if (ready == 0U) {
+            EcuM_Profile.NumWaves = waveIndex;
+            EcuM_Profile.TotalNs = EcuM_GetTimeNs() - EcuM_StartNs;
+            return E_NOT_OK;
+        }
+
+        EcuM_RunWave(ready, waveIndex);
+        done |= ready;
+        EcuM_InitializedItems = done;
+        waveIndex++;
+    }
+
+    EcuM_Profile.NumWaves = waveIndex;
+    EcuM_Profile.TotalNs = EcuM_GetTimeNs() - EcuM_StartNs;
+    EcuM_BuildPhaseProfile();
+
+    EcuM_State = ECUM_STATE_RUN;
+    BswM_EcuM_CurrentState(BSWM_ECUM_STATE_RUN);
+
+    return E_OK;
+}
+
+/**
+ * @brief Shut down the init items in reverse initialization order
+ */
+void EcuM_GoDown(EcuM_StartupType NextStartup) {
+    EcuM_InitItemMaskType preserved = 0U;
+    uint8_t itemId;
+    uint8_t count;
+    uint8_t i;
+
+    if (EcuM_State == ECUM_STATE_UNINIT) {
+        return;
+    }
+
+    BswM_EcuM_CurrentState(BSWM_ECUM_STATE_SHUTDOWN);
+
+    if (NextStartup == ECUM_STARTUP_WARM) {
+        for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+            if (EcuM_InitItemConfig[i].PreservedOnWarmStart) {
+                preserved |= ECUM_DEP(i);
+            }
+        }
+        preserved &= EcuM_InitializedItems;
+    }
+
+    for (i = EcuM_InitOrderCount; i > 0U; i--) {
+        itemId = EcuM_InitOrder[i - 1U];
+        if (((preserved & ECUM_DEP(itemId)) == 0U) &&
+            (EcuM_InitItemConfig[itemId].DeInitFn != NULL_PTR)) {
+            EcuM_InitItemConfig[itemId].DeInitFn();
+        }
+    }
+
+    /* Preserved items keep their place at the start of the init order */
+    count = 0U;
+    for (i = 0U; i < EcuM_InitOrderCount; i++) {
+        if ((preserved & ECUM_DEP(EcuM_InitOrder[i])) != 0U) {
+            EcuM_InitOrder[count] = EcuM_InitOrder[i];
+            count++;
+        }
+    }
+
+    EcuM_InitOrderCount = count;
+    EcuM_PreservedItems = preserved;
+    EcuM_InitializedItems = preserved;
+    EcuM_State = ECUM_STATE_UNINIT;
+}
+
+/**
+ * @brief Get EcuM state
+ */
+EcuM_StateType EcuM_GetState(void) {
+    return EcuM_State;
+}
+
+/**
+ * @brief Check whether an init item is initialized
+ */
+boolean EcuM_IsItemInitialized(uint8_t ItemId) {
+    if (ItemId >= ECUM_NUM_INIT_ITEMS) {
+        return FALSE;
+    }
+
+    return ((EcuM_InitializedItems & ECUM_DEP(ItemId)) != 0U) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Get profile of the last startup
+ */
+const EcuM_StartupProfileType* EcuM_GetStartupProfile(void) {
+    return &EcuM_Profile;
+}
+
+/**
+ * @brief Write startup profile report
+ */
+void EcuM_PrintStartupProfile(FILE* stream) {
+    const EcuM_PhaseProfileType* phase;
+    const EcuM_InitItemProfileType* item;
+    uint8_t i;
+
+    if (stream == NULL_PTR) {
+        return;
+    }
+
+    (void)std::fprintf(stream, "Startup profile (%s start, %u waves, max %u parallel): %.1f us\n",
+                       (EcuM_Profile.StartupType == ECUM_STARTUP_WARM) ? "warm" : "cold",
+                       static_cast<unsigned>(EcuM_Profile.NumWaves),
+                       static_cast<unsigned>(EcuM_Profile.MaxParallelInit),
+                       static_cast<double>(EcuM_Profile.TotalNs) / 1000.0);
+
+    (void)std::fprintf(stream, "  %-14s %5s %10s %10s %10s\n",
+                       "Phase", "Items", "Start(us)", "End(us)", "Busy(us)");
+    for (i = 0U; i < ECUM_NUM_PHASES; i++) {
+        phase = &EcuM_Profile.Phases[i];
+        (void)std::fprintf(stream, "  %-14s %5u %10.1f %10.1f %10.1f\n",
+                           EcuM_PhaseNames[i],
+                           static_cast<unsigned>(phase->NumExecuted),
+                           static_cast<double>(phase->StartNs) / 1000.0,
+                           static_cast<double>(phase->EndNs) / 1000.0,
+                           static_cast<double>(phase->BusyNs) / 1000.0);
+    }
+
+    (void)std::fprintf(stream, "  %-14s %5s %6s %10s %10s\n",
+                       "Item", "Wave", "Worker", "Start(us)", "Init(us)");
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        item = &EcuM_Profile.Items[i];
+        if (item->Executed) {
+            (void)std::fprintf(stream, "  %-14s %5u %6u %10.1f %10.1f\n",
+                               EcuM_InitItemConfig[i].Name,
+                               static_cast<unsigned>(item->Wave),
+                               static_cast<unsigned>(item->Worker),
+                               static_cast<double>(item->StartNs) / 1000.0,
+                               static_cast<double>(item->EndNs - item->StartNs) / 1000.0);
+        } else {
+            (void)std::fprintf(stream, "  %-14s %5s %6s %10s %10s\n",
+                               EcuM_InitItemConfig[i].Name, "-", "-", "preserved", "-");
+        }
+    }
+}
+
+/**
+ * @brief Get version information
+ */
+void EcuM_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
+    if (VersionInfo == NULL_PTR) {
+        return;
+    }
+
+    VersionInfo->vendorID = 0U;
+    VersionInfo->moduleID = 10U;  /* EcuM module ID */
+    VersionInfo->sw_major_version = ECUM_SW_MAJOR_VERSION;
+    VersionInfo->sw_minor_version = ECUM_SW_MINOR_VERSION;
+    VersionInfo->sw_patch_version = ECUM_SW_PATCH_VERSION;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get monotonic time for the startup profile
+ */
+static uint64_t EcuM_GetTimeNs(void) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Initialize one item and record its profile
+ * @param[in] itemId Init item ID
+ * @param[in] wave Dependency wave
+ * @param[in] worker Executing worker
+ */
+static void EcuM_RunItem(uint8_t itemId, uint8_t wave, uint8_t worker) {
+    EcuM_InitItemProfileType* profile = &EcuM_Profile.Items[itemId];
+
+    profile->Wave = wave;
+    profile->Worker = worker;
+    profile->StartNs = EcuM_GetTimeNs() - EcuM_StartNs;
+    EcuM_InitItemConfig[itemId].InitFn();
+    profile->EndNs = EcuM_GetTimeNs() - EcuM_StartNs;
+    profile->Executed = TRUE;
+}
+
+/**
+ * @brief Take parallel items of the current wave until none is left
+ * @param[in] worker Worker index
+ */
+static void EcuM_RunWorker(uint8_t worker) {
+    uint8_t next = EcuM_WaveNext.fetch_add(1U);
+
+    while (next < EcuM_WaveItemCount) {
+        EcuM_RunItem(EcuM_WaveItems[next], EcuM_WaveIndex, worker);
+        next = EcuM_WaveNext.fetch_add(1U);
+    }
+}
+
+/**
+ * @brief Initialize all items of one dependency wave
+ * @details Items without ParallelAllowed run afterwards on the calling
+ *          thread. Every item only writes its own profile entry, the join
+ *          publishes the results.
+ * @param[in] wave Items of the wave
+ * @param[in] waveIndex Wave index
+ */
+static void EcuM_RunWave(EcuM_InitItemMaskType wave, uint8_t waveIndex) {
+    std::thread workers[ECUM_MAX_PARALLEL_INIT];
+    uint8_t numWorkers;
+    uint8_t i;
+
+    EcuM_WaveItemCount = 0U;
+    EcuM_WaveIndex = waveIndex;
+    EcuM_WaveNext = 0U;
+
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        if (((wave & ECUM_DEP(i)) != 0U) && EcuM_InitItemConfig[i].ParallelAllowed) {
+            EcuM_WaveItems[EcuM_WaveItemCount] = i;
+            EcuM_WaveItemCount++;
+        }
+    }
+
+    numWorkers = (EcuM_WaveItemCount < EcuM_MaxParallelInit) ? EcuM_WaveItemCount : EcuM_MaxParallelInit;
+
+    /* Calling thread is worker 0 */
+    for (i = 1U; i < numWorkers; i++) {
+        workers[i] = std::thread(EcuM_RunWorker, i);
+    }
+    EcuM_RunWorker(0U);
+    for (i = 1U; i < numWorkers; i++) {
+        workers[i].join();
+    }
+
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        if (((wave & ECUM_DEP(i)) != 0U) && (!EcuM_InitItemConfig[i].ParallelAllowed)) {
+            EcuM_RunItem(i, waveIndex, 0U);
+        }
+    }
+
+    /* Reverse of this order is a valid shutdown order */
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        if ((wave & ECUM_DEP(i)) != 0U) {
+            EcuM_InitOrder[EcuM_InitOrderCount] = i;
+            EcuM_InitOrderCount++;
+        }
+    }
+}
+
+/**
+ * @brief Aggregate item profiles per phase
+ */
+static void EcuM_BuildPhaseProfile(void) {
+    const EcuM_InitItemProfileType* item;
+    EcuM_PhaseProfileType* phase;
+    uint8_t i;
+
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        item = &EcuM_Profile.Items[i];
+        if (!item->Executed) {
+            continue;
+        }
+
+        phase = &EcuM_Profile.Phases[EcuM_InitItemConfig[i].Phase];
+        if ((phase->NumExecuted == 0U) || (item->StartNs < phase->StartNs)) {
+            phase->StartNs = item->StartNs;
+        }
+        if (item->EndNs > phase->EndNs) {
+            phase->EndNs = item->EndNs;
+        }
+        phase->BusyNs += item->EndNs - item->StartNs;
+        phase->NumExecuted++;
+    }
+}
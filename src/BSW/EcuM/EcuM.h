@@ -0,0 +1,157 @@
+/**
+ * @file EcuM.h
+ * @brief AUTOSAR ECU State Manager Interface
+ * @details Startup sequencer for the init items of EcuM_Cfg:
+ *          - Dependency ordered initialization in waves, independent items
+ *            of a wave run concurrently on worker threads
+ *          - Timestamped startup profile per item and per phase
+ *          - Warm restart that keeps the state of preserved items
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef ECUM_H
+#define ECUM_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include <cstdio>
+#include "Std_Types.h"
+#include "EcuM_Cfg.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define ECUM_AR_RELEASE_MAJOR_VERSION       23
+#define ECUM_AR_RELEASE_MINOR_VERSION       11
+
+#define ECUM_SW_MAJOR_VERSION               1
+#define ECUM_SW_MINOR_VERSION               0
+#define ECUM_SW_PATCH_VERSION               0
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+STD_STATIC_ASSERT(ECUM_NUM_INIT_ITEMS <= ECUM_MAX_INIT_ITEMS,
+                  "EcuM_InitItemMaskType too small for init item count");
+
+/**
+ * @brief Startup type
+ */
+typedef enum {
+    ECUM_STARTUP_COLD   = 0x00U,    /**< Initialize all init items */
+    ECUM_STARTUP_WARM   = 0x01U     /**< Skip items preserved on warm start */
+} EcuM_StartupType;
+
+/**
+ * @brief EcuM state type
+ */
+typedef enum {
+    ECUM_STATE_UNINIT   = 0x00U,    /**< Not started or shut down */
+    ECUM_STATE_STARTUP  = 0x01U,    /**< Init items running */
+    ECUM_STATE_RUN      = 0x02U     /**< All init items done */
+} EcuM_StateType;
+
+/**
+ * @brief EcuM configuration type
+ */
+typedef struct {
+    uint8_t MaxParallelInit;        /**< Concurrent init items (1 = serial) */
+} EcuM_ConfigType;
+
+/**
+ * @brief Startup profile of one init item (times relative to EcuM_Init)
+ */
+typedef struct {
+    uint64_t StartNs;               /**< Init function entered */
+    uint64_t EndNs;                 /**< Init function returned */
+    uint8_t Wave;                   /**< Dependency wave */
+    uint8_t Worker;                 /**< Worker (0 = calling thread) */
+    boolean Executed;               /**< FALSE if preserved on warm start */
+} EcuM_InitItemProfileType;
+
+/**
+ * @brief Startup profile of one phase (executed items only)
+ */
+typedef struct {
+    uint64_t StartNs;               /**< First item of the phase entered */
+    uint64_t EndNs;                 /**< Last item of the phase returned */
+    uint64_t BusyNs;                /**< Sum of item init times */
+    uint8_t NumExecuted;            /**< Executed items */
+} EcuM_PhaseProfileType;
+
+/**
+ * @brief Startup profile
+ */
+typedef struct {
+    EcuM_StartupType StartupType;                       /**< Startup performed */
+    uint8_t MaxParallelInit;                            /**< Configured parallelism */
+    uint8_t NumWaves;                                   /**< Dependency waves */
+    uint64_t TotalNs;                                   /**< EcuM_Init duration */
+    EcuM_InitItemProfileType Items[ECUM_NUM_INIT_ITEMS];
+    EcuM_PhaseProfileType Phases[ECUM_NUM_PHASES];
+} EcuM_StartupProfileType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Run the startup sequence
+ * @details Items whose dependencies are all initialized form a wave. Items of
+ *          a wave with ParallelAllowed run on up to MaxParallelInit workers,
+ *          the others on the calling thread. A warm start is only performed
+ *          after EcuM_GoDown(ECUM_STARTUP_WARM), otherwise a cold start is
+ *          done. Reports RUN to BswM when finished.
+ * @param[in] ConfigPtr Pointer to configuration (NULL_PTR = serial)
+ * @param[in] StartupType Requested startup type
+ * @return E_OK on success, E_NOT_OK if already started or on cyclic or
+ *         unknown dependencies (EcuM stays in STARTUP, EcuM_GoDown shuts
+ *         down the items initialized so far)
+ */
+Std_ReturnType EcuM_Init(const EcuM_ConfigType* ConfigPtr, EcuM_StartupType StartupType);
+
+/**
+ * @brief Shut down the init items in reverse initialization order
+ * @details Reports SHUTDOWN to BswM first. Items preserved on warm start
+ *          are kept when the next startup is warm.
+ * @param[in] NextStartup Startup type that will follow
+ */
+void EcuM_GoDown(EcuM_StartupType NextStartup);
+
+/**
+ * @brief Get EcuM state
+ * @return Current state
+ */
+EcuM_StateType EcuM_GetState(void);
+
+/**
+ * @brief Check whether an init item is initialized
+ * @param[in] ItemId Init item ID
+ * @return TRUE if initialized (or preserved), FALSE otherwise
+ */
+boolean EcuM_IsItemInitialized(uint8_t ItemId);
+
+/**
+ * @brief Get profile of the last startup
+ * @return Pointer to profile
+ */
+const EcuM_StartupProfileType* EcuM_GetStartupProfile(void);
+
+/**
+ * @brief Write startup profile report
+ * @param[in] stream Output stream
+ */
+void EcuM_PrintStartupProfile(FILE* stream);
+
+/**
+ * @brief Get version information
+ * @param[out] VersionInfo Pointer to version info structure
+ */
+void EcuM_GetVersionInfo(Std_VersionInfoType* VersionInfo);
+
+#endif /* ECUM_H */
@@ -0,0 +1,98 @@
+/**
+ * @file Ecu_Snapshot.cpp
+ * @brief ECU State Snapshot Implementation
+ * @details Collects the module snapshots into one blob
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Ecu_Snapshot.h"
+#include <cstring>
+#include <type_traits>
+
+/*============================================================================*
+ * LOCAL DEFINITIONS
+ *============================================================================*/
+
+STD_STATIC_ASSERT(std::is_trivially_copyable<Ecu_SnapshotType>::value,
+                  "Snapshot blob must be copyable with memcpy");
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Save the state of all modules
+ */
+Std_ReturnType Ecu_SaveSnapshot(Ecu_SnapshotType* Snapshot) {
+    if (Snapshot == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    /* No uninitialized bytes in the blob */
+    (void)std::memset(Snapshot, 0, sizeof(Ecu_SnapshotType));
+    Snapshot->Header.Magic = ECU_SNAPSHOT_MAGIC;
+    Snapshot->Header.Version = ECU_SNAPSHOT_VERSION;
+    Snapshot->Header.Size = static_cast<uint32_t>(sizeof(Ecu_SnapshotType));
+
+    SwitchEvent_SaveSnapshot(&Snapshot->SwitchEvent);
+    LightRequest_SaveSnapshot(&Snapshot->LightRequest);
+    FLM_SaveSnapshot(&Snapshot->Flm);
+    Headlight_SaveSnapshot(&Snapshot->Headlight);
+    SafetyMonitor_SaveSnapshot(&Snapshot->SafetyMonitor);
+
+    Rte_SaveSnapshot(&Snapshot->Rte);
+
+    Dem_SaveSnapshot(&Snapshot->Dem);
+    WdgM_SaveSnapshot(&Snapshot->WdgM);
+    Com_SaveSnapshot(&Snapshot->Com);
+    BswM_SaveSnapshot(&Snapshot->BswM);
+
+    Adc_SaveSnapshot(&Snapshot->Adc);
+    Can_SaveSnapshot(&Snapshot->Can);
+    Dio_SaveSnapshot(&Snapshot->Dio);
+    Pwm_SaveSnapshot(&Snapshot->Pwm);
+
+    return E_OK;
+}
+
+/**
+ * @brief Restore the state of all modules
+ */
+Std_ReturnType Ecu_RestoreSnapshot(const Ecu_SnapshotType* Snapshot) {
+    if (Snapshot == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    if ((Snapshot->Header.Magic != ECU_SNAPSHOT_MAGIC) ||
+        (Snapshot->Header.Version != ECU_SNAPSHOT_VERSION) ||
+        (Snapshot->Header.Size != static_cast<uint32_t>(sizeof(Ecu_SnapshotType)))) {
+        return E_NOT_OK;
+    }
+
+    /* Drivers first: Dio pushes the restored outputs to its backend */
+    Pwm_RestoreSnapshot(&Snapshot->Pwm);
+    Dio_RestoreSnapshot(&Snapshot->Dio);
+    Can_RestoreSnapshot(&Snapshot->Can);
+    Adc_RestoreSnapshot(&Snapshot->Adc);
+
+    BswM_RestoreSnapshot(&Snapshot->BswM);
+    Com_RestoreSnapshot(&Snapshot->Com);
+    WdgM_RestoreSnapshot(&Snapshot->WdgM);
+    Dem_RestoreSnapshot(&Snapshot->Dem);
+
+    Rte_RestoreSnapshot(&Snapshot->Rte);
+
+    SafetyMonitor_RestoreSnapshot(&Snapshot->SafetyMonitor);
+    Headlight_RestoreSnapshot(&Snapshot->Headlight);
+    FLM_RestoreSnapshot(&Snapshot->Flm);
+    LightRequest_RestoreSnapshot(&Snapshot->LightRequest);
+    SwitchEvent_RestoreSnapshot(&Snapshot->SwitchEvent);
+
+    return E_OK;
+}
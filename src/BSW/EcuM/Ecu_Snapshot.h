@@ -0,0 +1,117 @@
+/**
+ * @file Ecu_Snapshot.h
+ * @brief ECU State Snapshot Interface
+ * @details Saves the internal state of every module (SWCs, RTE, BSW, MCAL)
+ *          into one contiguous, versioned blob and restores it:
+ *          - The blob is plain data and can be copied with memcpy, e.g. to
+ *            fork many runs from one warmed-up state
+ *          - Save and restore between ticks, while no runnable executes
+ *          - Restore into an ECU initialized with the same configuration;
+ *            state derived from the configuration at init (compiled
+ *            supervision and decision tables, calibration) is not part of
+ *            the blob
+ *          - ADC result buffers are referenced, not copied: a blob is valid
+ *            within the process that saved it
+ *          Plant models and stimulus (Sim) are not ECU state and not
+ *          included.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef ECU_SNAPSHOT_H
+#define ECU_SNAPSHOT_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/LightRequest/LightRequest.h"
+#include "Application/FLM/FLM_Application.h"
+#include "Application/Headlight/Headlight.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+#include "Rte/Rte.h"
+#include "BSW/Dem/Dem.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Com/Com.h"
+#include "BSW/BswM/BswM.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Can/Can.h"
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Pwm/Pwm.h"
+
+/*============================================================================*
+ * CONFIGURATION
+ *============================================================================*/
+
+/** @brief Blob magic ("FLMS") */
+#define ECU_SNAPSHOT_MAGIC                  0x534D4C46U
+
+/** @brief Blob layout version, increment on every change of a module snapshot */
+#define ECU_SNAPSHOT_VERSION                2U
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Blob header
+ */
+typedef struct {
+    uint32_t Magic;                     /**< ECU_SNAPSHOT_MAGIC */
+    uint32_t Version;                   /**< ECU_SNAPSHOT_VERSION */
+    uint32_t Size;                      /**< sizeof(Ecu_SnapshotType) */
+} Ecu_SnapshotHeaderType;
+
+/**
+ * @brief ECU snapshot blob
+ */
+typedef struct {
+    Ecu_SnapshotHeaderType Header;
+
+    /* Application SWCs */
+    SwitchEvent_SnapshotType SwitchEvent;
+    LightRequest_SnapshotType LightRequest;
+    FLM_SnapshotType Flm;
+    Headlight_SnapshotType Headlight;
+    SafetyMonitor_SnapshotType SafetyMonitor;
+
+    /* RTE */
+    Rte_SnapshotType Rte;
+
+    /* BSW */
+    Dem_SnapshotType Dem;
+    WdgM_SnapshotType WdgM;
+    Com_SnapshotType Com;
+    BswM_SnapshotType BswM;
+
+    /* MCAL */
+    Adc_SnapshotType Adc;
+    Can_SnapshotType Can;
+    Dio_SnapshotType Dio;
+    Pwm_SnapshotType Pwm;
+} Ecu_SnapshotType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Save the state of all modules
+ * @param[out] Snapshot Blob to fill
+ * @return E_OK on success, E_NOT_OK for NULL_PTR
+ */
+Std_ReturnType Ecu_SaveSnapshot(Ecu_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore the state of all modules
+ * @details Nothing is restored unless the header matches this build
+ * @param[in] Snapshot Blob saved by Ecu_SaveSnapshot
+ * @return E_OK on success, E_NOT_OK for NULL_PTR or a header of another
+ *         magic, version or size
+ */
+Std_ReturnType Ecu_RestoreSnapshot(const Ecu_SnapshotType* Snapshot);
+
+#endif /* ECU_SNAPSHOT_H */
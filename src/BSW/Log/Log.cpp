@@ -0,0 +1,702 @@
+/**
+ * @file Log.cpp
+ * @brief Asynchronous Logger Implementation
+ * @details One single-producer/single-consumer ring per thread, claimed on
+ *          the first message of the thread. The writer wakes every
+ *          LOG_DRAIN_PERIOD_MS, merges the rings in timestamp order and
+ *          formats the messages into the output stream.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic output only, no influence on the function
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Log.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/*============================================================================*
+ * LOCAL MACROS
+ *============================================================================*/
+
+/** @brief Ring index mask */
+#define LOG_RING_MASK                       (LOG_RING_SIZE - 1U)
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Captured message
+ */
+typedef struct {
+    uint64_t TimeNs;                    /**< Monotonic timestamp (merge order) */
+    const char* Format;                 /**< printf-style format */
+    uint64_t Args[LOG_MAX_ARGS];        /**< Raw argument values */
+    uint32_t Suppressed;                /**< Suppressed before this message */
+    uint8_t Level;                      /**< Log_LevelType */
+    uint8_t NumArgs;                    /**< Captured arguments */
+    uint8_t ArgKinds[LOG_MAX_ARGS];     /**< Log_ArgKindType per argument */
+} Log_RecordType;
+
+/**
+ * @brief Per-thread message ring
+ * @details Head and tail on their own cache lines, so the producer and the
+ *          writer do not share a line on every message
+ */
+typedef struct {
+    alignas(64) std::atomic<uint32_t> Head;     /**< Written by the producer */
+    alignas(64) std::atomic<uint32_t> Tail;     /**< Written by the writer */
+    std::atomic<uint64_t> Dropped;              /**< Messages lost to a full ring */
+    Log_RecordType Records[LOG_RING_SIZE];
+} Log_RingType;
+
+/**
+ * @brief Formatted line
+ */
+typedef struct {
+    char Text[LOG_LINE_SIZE];
+    uint32_t Length;
+} Log_LineType;
+
+/**
+ * @brief Parsed conversion specification
+ */
+typedef struct {
+    boolean LeftAlign;                  /**< '-' flag */
+    boolean ZeroPad;                    /**< '0' flag */
+    boolean ForceSign;                  /**< '+' flag */
+    uint32_t Width;                     /**< Minimum field width */
+    sint32 Precision;                   /**< -1 = not given */
+    char Conversion;                    /**< Conversion character */
+} Log_SpecType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Rings, claimed in thread order */
+static Log_RingType Log_Rings[LOG_MAX_THREADS];
+
+/** @brief Rings claimed (may exceed LOG_MAX_THREADS) */
+static std::atomic<uint32_t> Log_NumRings(0U);
+
+/** @brief Incremented on every ring reset to invalidate the thread bindings */
+static std::atomic<uint32_t> Log_Generation(1U);
+
+/** @brief Messages of threads without a ring */
+static std::atomic<uint64_t> Log_Unbound(0U);
+
+/** @brief Messages written */
+static std::atomic<uint64_t> Log_Written(0U);
+
+/** @brief Messages suppressed by rate limits */
+static std::atomic<uint64_t> Log_Suppressed(0U);
+
+/** @brief Drops already reported in the output */
+static uint64_t Log_ReportedDrops = 0U;
+
+/** @brief Writer running */
+static std::atomic<boolean> Log_Active(FALSE);
+
+/** @brief Lowest level logged */
+static std::atomic<uint8_t> Log_Level(static_cast<uint8_t>(LOG_DEFAULT_LEVEL));
+
+/** @brief Output stream */
+static FILE* Log_Stream = NULL_PTR;
+
+/** @brief Time base of the message timestamps */
+static const std::chrono::steady_clock::time_point Log_Epoch = std::chrono::steady_clock::now();
+
+/** @brief Background writer */
+static std::thread Log_Writer;
+static std::mutex Log_WriterMutex;
+static std::condition_variable Log_WriterWakeup;
+static boolean Log_WriterStopping = FALSE;
+
+/** @brief Serializes the consumers (writer thread, Log_Flush, Log_Stop) */
+static std::mutex Log_DrainMutex;
+
+/** @brief Ring of the calling thread (NULL_PTR = none free) */
+static thread_local Log_RingType* Log_ThreadRing = NULL_PTR;
+
+/** @brief Generation of Log_ThreadRing (0 = not bound) */
+static thread_local uint32_t Log_ThreadGeneration = 0U;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static uint64_t Log_GetTimeNs(void);
+static Log_RingType* Log_GetThreadRing(void);
+static void Log_WriterMain(void);
+static void Log_Drain(void);
+static void Log_FormatRecord(const Log_RecordType* record, Log_LineType* line);
+static const char* Log_ParseSpec(const char* cursor, Log_SpecType* spec);
+static void Log_FormatArg(Log_LineType* line, const Log_SpecType* spec, uint64_t value, uint8_t kind);
+static void Log_AppendChar(Log_LineType* line, char value);
+static void Log_AppendText(Log_LineType* line, const char* value, uint32_t length);
+static uint32_t Log_FormatUnsigned(char* buffer, uint64_t value, uint32_t base, boolean upper);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize the logger
+ */
+void Log_Init(void) {
+    uint32_t i;
+
+    if (Log_Active.load()) {
+        return;
+    }
+
+    for (i = 0U; i < LOG_MAX_THREADS; i++) {
+        Log_Rings[i].Head.store(0U);
+        Log_Rings[i].Tail.store(0U);
+        Log_Rings[i].Dropped.store(0U);
+    }
+    Log_NumRings.store(0U);
+    Log_Unbound.store(0U);
+    Log_Written.store(0U);
+    Log_Suppressed.store(0U);
+    Log_ReportedDrops = 0U;
+    Log_Level.store(static_cast<uint8_t>(LOG_DEFAULT_LEVEL));
+    Log_Generation.fetch_add(1U);
+}
+
+/**
+ * @brief Start the background writer
+ */
+Std_ReturnType Log_Start(FILE* Stream) {
+    if ((Stream == NULL_PTR) || Log_Active.load()) {
+        return E_NOT_OK;
+    }
+
+    Log_Stream = Stream;
+    Log_WriterStopping = FALSE;
+    Log_Active.store(TRUE);
+    Log_Writer = std::thread(Log_WriterMain);
+
+    return E_OK;
+}
+
+/**
+ * @brief Stop the background writer
+ */
+void Log_Stop(void) {
+    if (!Log_Active.load()) {
+        return;
+    }
+
+    Log_Active.store(FALSE);
+    {
+        std::lock_guard<std::mutex> lock(Log_WriterMutex);
+        Log_WriterStopping = TRUE;
+    }
+    Log_WriterWakeup.notify_one();
+    if (Log_Writer.joinable()) {
+        Log_Writer.join();
+    }
+
+    Log_Flush();
+    Log_Stream = NULL_PTR;
+}
+
+/**
+ * @brief Check whether the writer is running
+ */
+boolean Log_IsActive(void) {
+    return Log_Active.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Write all messages captured so far
+ */
+void Log_Flush(void) {
+    std::lock_guard<std::mutex> lock(Log_DrainMutex);
+
+    if (Log_Stream != NULL_PTR) {
+        Log_Drain();
+    }
+}
+
+/**
+ * @brief Set the lowest level logged
+ */
+void Log_SetLevel(Log_LevelType Level) {
+    Log_Level.store(Level, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Check whether a level is logged
+ */
+boolean Log_IsEnabled(Log_LevelType Level) {
+    return (Log_Active.load(std::memory_order_relaxed) &&
+            (Level >= Log_Level.load(std::memory_order_relaxed))) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Rate limit a log statement
+ */
+boolean Log_RateLimitPass(Log_RateLimitType* RateLimit, uint32_t PeriodMs, uint32_t* Suppressed) {
+    const uint64_t now = Log_GetTimeNs();
+    uint64_t next;
+
+    if ((RateLimit == NULL_PTR) || (Suppressed == NULL_PTR)) {
+        return FALSE;
+    }
+
+    next = RateLimit->NextNs.load(std::memory_order_relaxed);
+    if ((now >= next) &&
+        RateLimit->NextNs.compare_exchange_strong(next, now + (static_cast<uint64_t>(PeriodMs) * 1000000U),
+                                                  std::memory_order_relaxed)) {
+        *Suppressed = RateLimit->Suppressed.exchange(0U, std::memory_order_relaxed);
+        return TRUE;
+    }
+
+    RateLimit->Suppressed.fetch_add(1U, std::memory_order_relaxed);
+    Log_Suppressed.fetch_add(1U, std::memory_order_relaxed);
+
+    return FALSE;
+}
+
+/**
+ * @brief Capture a message into the ring of the calling thread
+ */
+void Log_Write(
+    Log_LevelType Level,
+    uint32_t Suppressed,
+    const char* Format,
+    const Log_ArgType* Args,
+    uint8_t NumArgs
+) {
+    Log_RingType* ring;
+    Log_RecordType* record;
+    uint32_t head;
+    uint8_t i;
+
+    if (!Log_Active.load(std::memory_order_relaxed) || (Format == NULL_PTR) ||
+        (Level >= LOG_NUM_LEVELS) || ((NumArgs > 0U) && (Args == NULL_PTR))) {
+        return;
+    }
+
+    ring = Log_GetThreadRing();
+    if (ring == NULL_PTR) {
+        Log_Unbound.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    head = ring->Head.load(std::memory_order_relaxed);
+    if ((head - ring->Tail.load(std::memory_order_acquire)) >= LOG_RING_SIZE) {
+        ring->Dropped.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    record = &ring->Records[head & LOG_RING_MASK];
+    record->TimeNs = Log_GetTimeNs();
+    record->Format = Format;
+    record->Suppressed = Suppressed;
+    record->Level = Level;
+    record->NumArgs = (NumArgs < LOG_MAX_ARGS) ? NumArgs : static_cast<uint8_t>(LOG_MAX_ARGS);
+    for (i = 0U; i < record->NumArgs; i++) {
+        record->Args[i] = Args[i].Value;
+        record->ArgKinds[i] = Args[i].Kind;
+    }
+    ring->Head.store(head + 1U, std::memory_order_release);
+}
+
+/**
+ * @brief Get log statistics
+ */
+Std_ReturnType Log_GetStatistics(Log_StatisticsType* Statistics) {
+    uint32_t numRings;
+    uint32_t i;
+
+    if (Statistics == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    numRings = Log_NumRings.load();
+    numRings = (numRings < LOG_MAX_THREADS) ? numRings : LOG_MAX_THREADS;
+
+    Statistics->Written = Log_Written.load();
+    Statistics->Dropped = Log_Unbound.load();
+    for (i = 0U; i < numRings; i++) {
+        Statistics->Dropped += Log_Rings[i].Dropped.load();
+    }
+    Statistics->Suppressed = Log_Suppressed.load();
+    Statistics->Threads = static_cast<uint8_t>(numRings);
+
+    return E_OK;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get the message timestamp
+ */
+static uint64_t Log_GetTimeNs(void) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - Log_Epoch).count());
+}
+
+/**
+ * @brief Get the ring of the calling thread, claim one on first use
+ * @return Ring, NULL_PTR if all rings are taken
+ */
+static Log_RingType* Log_GetThreadRing(void) {
+    const uint32_t generation = Log_Generation.load(std::memory_order_acquire);
+    uint32_t index;
+
+    if (Log_ThreadGeneration == generation) {
+        return Log_ThreadRing;
+    }
+
+    Log_ThreadGeneration = generation;
+    Log_ThreadRing = NULL_PTR;
+
+    index = Log_NumRings.fetch_add(1U);
+    if (index < LOG_MAX_THREADS) {
+        Log_ThreadRing = &Log_Rings[index];
+    }
+
+    return Log_ThreadRing;
+}
+
+/**
+ * @brief Writer thread: write the rings every LOG_DRAIN_PERIOD_MS
+ */
+static void Log_WriterMain(void) {
+    std::unique_lock<std::mutex> lock(Log_WriterMutex);
+
+    while (!Log_WriterStopping) {
+        (void)Log_WriterWakeup.wait_for(lock, std::chrono::milliseconds(LOG_DRAIN_PERIOD_MS));
+        lock.unlock();
+        Log_Flush();
+        lock.lock();
+    }
+}
+
+/**
+ * @brief Write all captured messages in timestamp order
+ * @details Called with Log_DrainMutex held
+ */
+static void Log_Drain(void) {
+    static Log_LineType line;
+    uint32_t numRings = Log_NumRings.load();
+    uint32_t heads[LOG_MAX_THREADS];
+    uint32_t tails[LOG_MAX_THREADS];
+    uint64_t written = 0U;
+    uint64_t dropped;
+    uint32_t next;
+    uint32_t i;
+
+    numRings = (numRings < LOG_MAX_THREADS) ? numRings : LOG_MAX_THREADS;
+    for (i = 0U; i < numRings; i++) {
+        tails[i] = Log_Rings[i].Tail.load(std::memory_order_relaxed);
+        heads[i] = Log_Rings[i].Head.load(std::memory_order_acquire);
+    }
+
+    for (;;) {
+        /* Oldest pending message over all rings */
+        next = LOG_MAX_THREADS;
+        for (i = 0U; i < numRings; i++) {
+            if ((tails[i] != heads[i]) &&
+                ((next == LOG_MAX_THREADS) ||
+                 (Log_Rings[i].Records[tails[i] & LOG_RING_MASK].TimeNs <
+                  Log_Rings[next].Records[tails[next] & LOG_RING_MASK].TimeNs))) {
+                next = i;
+            }
+        }
+        if (next == LOG_MAX_THREADS) {
+            break;
+        }
+
+        Log_FormatRecord(&Log_Rings[next].Records[tails[next] & LOG_RING_MASK], &line);
+        tails[next]++;
+        Log_Rings[next].Tail.store(tails[next], std::memory_order_release);
+        (void)std::fwrite(line.Text, 1U, line.Length, Log_Stream);
+        written++;
+    }
+
+    /* Report new drops once, in the stream */
+    dropped = Log_Unbound.load();
+    for (i = 0U; i < numRings; i++) {
+        dropped += Log_Rings[i].Dropped.load();
+    }
+    if (dropped > Log_ReportedDrops) {
+        (void)std::fprintf(Log_Stream, "%s%llu log messages dropped\n",
+                           Log_LevelPrefixes[LOG_LEVEL_WARNING],
+                           static_cast<unsigned long long>(dropped - Log_ReportedDrops));
+        Log_ReportedDrops = dropped;
+    }
+
+    if (written > 0U) {
+        Log_Written.fetch_add(written);
+    }
+    (void)std::fflush(Log_Stream);
+}
+
+/**
+ * @brief Format a message into one line
+ */
+static void Log_FormatRecord(const Log_RecordType* record, Log_LineType* line) {
+    const char* cursor = record->Format;
+    Log_SpecType spec;
+    uint32_t argIndex = 0U;
+    char suffix[64];
+    int suffixLength;
+
+    line->Length = 0U;
+    Log_AppendText(line, Log_LevelPrefixes[record->Level],
+                   static_cast<uint32_t>(std::strlen(Log_LevelPrefixes[record->Level])));
+
+    while (*cursor != '\0') {
+        if (*cursor != '%') {
+            Log_AppendChar(line, *cursor);
+            cursor++;
+        } else if (cursor[1] == '%') {
+            Log_AppendChar(line, '%');
+            cursor += 2;
+        } else {
+            cursor = Log_ParseSpec(cursor + 1, &spec);
+            if (argIndex < record->NumArgs) {
+                Log_FormatArg(line, &spec, record->Args[argIndex], record->ArgKinds[argIndex]);
+                argIndex++;
+            } else {
+                Log_AppendChar(line, '?');
+            }
+        }
+    }
+
+    if (record->Suppressed > 0U) {
+        suffixLength = std::snprintf(suffix, sizeof(suffix), " (%u similar messages suppressed)",
+                                     record->Suppressed);
+        if (suffixLength > 0) {
+            Log_AppendText(line, suffix, static_cast<uint32_t>(suffixLength));
+        }
+    }
+
+    /* Truncated lines keep their line end */
+    if (line->Length >= (LOG_LINE_SIZE - 1U)) {
+        line->Length = LOG_LINE_SIZE - 2U;
+    }
+    line->Text[line->Length] = '\n';
+    line->Length++;
+}
+
+/**
+ * @brief Parse a conversion specification after the '%'
+ * @return Position after the conversion character
+ */
+static const char* Log_ParseSpec(const char* cursor, Log_SpecType* spec) {
+    spec->LeftAlign = FALSE;
+    spec->ZeroPad = FALSE;
+    spec->ForceSign = FALSE;
+    spec->Width = 0U;
+    spec->Precision = -1;
+    spec->Conversion = '\0';
+
+    for (;; cursor++) {
+        if (*cursor == '-') {
+            spec->LeftAlign = TRUE;
+        } else if (*cursor == '0') {
+            spec->ZeroPad = TRUE;
+        } else if (*cursor == '+') {
+            spec->ForceSign = TRUE;
+        } else if ((*cursor == ' ') || (*cursor == '#')) {
+            /* Accepted, no effect */
+        } else {
+            break;
+        }
+    }
+
+    while ((*cursor >= '0') && (*cursor <= '9')) {
+        spec->Width = (spec->Width * 10U) + static_cast<uint32_t>(*cursor - '0');
+        cursor++;
+    }
+
+    if (*cursor == '.') {
+        cursor++;
+        spec->Precision = 0;
+        while ((*cursor >= '0') && (*cursor <= '9')) {
+            spec->Precision = (spec->Precision * 10) + (*cursor - '0');
+            cursor++;
+        }
+    }
+
+    /* Length modifiers: all integers are captured as 64 bit */
+    while ((*cursor == 'h') || (*cursor == 'l') || (*cursor == 'L') || (*cursor == 'j') ||
+           (*cursor == 'z') || (*cursor == 't') || (*cursor == 'q')) {
+        cursor++;
+    }
+
+    if (*cursor != '\0') {
+        spec->Conversion = *cursor;
+        cursor++;
+    }
+
+    return cursor;
+}
+
+/**
+ * @brief Format one argument with padding
+ */
+static void Log_FormatArg(Log_LineType* line, const Log_SpecType* spec, uint64_t value, uint8_t kind) {
+    char buffer[72];
+    const char* text = buffer;
+    uint32_t length = 0U;
+    uint32_t signLength = 0U;
+    uint32_t pad;
+    double number;
+    int printed;
+
+    switch (spec->Conversion) {
+        case 'd':
+        case 'i':
+            if (static_cast<sint64>(value) < 0) {
+                buffer[0] = '-';
+                /* Two's complement magnitude, also for INT64_MIN */
+                length = 1U + Log_FormatUnsigned(&buffer[1], (~value) + 1U, 10U, FALSE);
+                signLength = 1U;
+            } else if (spec->ForceSign) {
+                buffer[0] = '+';
+                length = 1U + Log_FormatUnsigned(&buffer[1], value, 10U, FALSE);
+                signLength = 1U;
+            } else {
+                length = Log_FormatUnsigned(buffer, value, 10U, FALSE);
+            }
+            break;
+
+        case 'u':
+            length = Log_FormatUnsigned(buffer, value, 10U, FALSE);
+            break;
+
+        case 'x':
+        case 'X':
+            length = Log_FormatUnsigned(buffer, value, 16U, (spec->Conversion == 'X') ? TRUE : FALSE);
+            break;
+
+        case 'c':
+            buffer[0] = static_cast<char>(value);
+            length = 1U;
+            break;
+
+        case 's':
+            if (kind == LOG_ARG_STRING) {
+                text = reinterpret_cast<const char*>(static_cast<uintptr_t>(value));
+            }
+            if ((kind != LOG_ARG_STRING) || (text == NULL_PTR)) {
+                text = "(null)";
+            }
+            length = static_cast<uint32_t>(std::strlen(text));
+            if ((spec->Precision >= 0) && (length > static_cast<uint32_t>(spec->Precision))) {
+                length = static_cast<uint32_t>(spec->Precision);
+            }
+            break;
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'g':
+            (void)std::memcpy(&number, &value, sizeof(number));
+            if (kind != LOG_ARG_DOUBLE) {
+                number = static_cast<double>(static_cast<sint64>(value));
+            }
+            if (spec->Conversion == 'e') {
+                printed = std::snprintf(buffer, sizeof(buffer), spec->ForceSign ? "%+.*e" : "%.*e",
+                                        (spec->Precision >= 0) ? spec->Precision : 6, number);
+            } else if (spec->Conversion == 'g') {
+                printed = std::snprintf(buffer, sizeof(buffer), spec->ForceSign ? "%+.*g" : "%.*g",
+                                        (spec->Precision >= 0) ? spec->Precision : 6, number);
+            } else {
+                printed = std::snprintf(buffer, sizeof(buffer), spec->ForceSign ? "%+.*f" : "%.*f",
+                                        (spec->Precision >= 0) ? spec->Precision : 6, number);
+            }
+            length = (printed > 0) ? static_cast<uint32_t>(printed) : 0U;
+            length = (length < sizeof(buffer)) ? length : static_cast<uint32_t>(sizeof(buffer) - 1U);
+            signLength = ((buffer[0] == '-') || (buffer[0] == '+')) ? 1U : 0U;
+            break;
+
+        default:
+            /* Unsupported conversion: keep it visible */
+            buffer[0] = '%';
+            buffer[1] = spec->Conversion;
+            length = 2U;
+            break;
+    }
+
+    pad = (spec->Width > length) ? (spec->Width - length) : 0U;
+    if (spec->LeftAlign) {
+        Log_AppendText(line, text, length);
+        for (; pad > 0U; pad--) {
+            Log_AppendChar(line, ' ');
+        }
+    } else if (spec->ZeroPad && (spec->Conversion != 's') && (spec->Conversion != 'c')) {
+        Log_AppendText(line, text, signLength);
+        for (; pad > 0U; pad--) {
+            Log_AppendChar(line, '0');
+        }
+        Log_AppendText(line, &text[signLength], length - signLength);
+    } else {
+        for (; pad > 0U; pad--) {
+            Log_AppendChar(line, ' ');
+        }
+        Log_AppendText(line, text, length);
+    }
+}
+
+/**
+ * @brief Append a character, leaving room for the line end
+ */
+static void Log_AppendChar(Log_LineType* line, char value) {
+    if (line->Length < (LOG_LINE_SIZE - 1U)) {
+        line->Text[line->Length] = value;
+        line->Length++;
+    }
+}
+
+/**
+ * @brief Append characters, leaving room for the line end
+ */
+static void Log_AppendText(Log_LineType* line, const char* value, uint32_t length) {
+    uint32_t i;
+
+    for (i = 0U; i < length; i++) {
+        Log_AppendChar(line, value[i]);
+    }
+}
+
+/**
+ * @brief Format an unsigned integer
+ * @return Number of digits
+ */
+static uint32_t Log_FormatUnsigned(char* buffer, uint64_t value, uint32_t base, boolean upper) {
+    const char* const digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char reversed[24];
+    uint32_t count = 0U;
+    uint32_t i;
+
+    do {
+        reversed[count] = digits[value % base];
+        value /= base;
+        count++;
+    } while (value > 0U);
+
+    for (i = 0U; i < count; i++) {
+        buffer[i] = reversed[count - 1U - i];
+    }
+
+    return count;
+}
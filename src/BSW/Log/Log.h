@@ -0,0 +1,308 @@
+/**
+ * @file Log.h
+ * @brief Asynchronous Logger
+ * @details A log statement captures its format string pointer and its
+ *          arguments as binary values into a lock-free ring of the calling
+ *          thread; a background writer formats and writes them. The caller
+ *          never formats, allocates, locks or waits for I/O, and a full ring
+ *          drops the message instead of blocking.
+ *
+ *          The format string and string arguments are stored as pointers and
+ *          must outlive the writer: literals, name tables or argv. The
+ *          supported conversions are d, i, u, x, X, c, s, f, e, g and %%
+ *          with flags '-', '0', '+', width and precision; length modifiers
+ *          are accepted and ignored, as all integers are captured as 64 bit.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic output only, no influence on the function
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Log_Cfg.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Log level (LOG_LEVEL_*)
+ */
+typedef uint8_t Log_LevelType;
+
+/**
+ * @brief Captured argument kinds
+ */
+typedef enum {
+    LOG_ARG_INTEGER = 0x00U,            /**< Sign or zero extended to 64 bit */
+    LOG_ARG_DOUBLE  = 0x01U,            /**< Bit pattern of a double */
+    LOG_ARG_STRING  = 0x02U             /**< Pointer to a NUL terminated string */
+} Log_ArgKindType;
+
+/**
+ * @brief Captured argument
+ */
+typedef struct {
+    uint64_t Value;                     /**< Raw value */
+    uint8_t Kind;                       /**< Log_ArgKindType */
+} Log_ArgType;
+
+/**
+ * @brief Rate limit state of one log statement
+ * @details Zero initialized as a function-local static by the
+ *          LOG_*_RATELIMITED macros
+ */
+typedef struct {
+    std::atomic<uint64_t> NextNs;       /**< Earliest time of the next message */
+    std::atomic<uint32_t> Suppressed;   /**< Messages suppressed since the last one */
+} Log_RateLimitType;
+
+/**
+ * @brief Log statistics
+ */
+typedef struct {
+    uint64_t Written;                   /**< Messages written */
+    uint64_t Dropped;                   /**< Messages lost to a full ring or no free ring */
+    uint64_t Suppressed;                /**< Messages suppressed by rate limits */
+    uint8_t Threads;                    /**< Threads with a ring */
+} Log_StatisticsType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize the logger
+ * @details Releases all rings, clears the statistics and sets the level to
+ *          LOG_DEFAULT_LEVEL. Ignored while the writer is running.
+ */
+void Log_Init(void);
+
+/**
+ * @brief Start the background writer
+ * @details Messages are only captured while the writer is running
+ * @param[in] Stream Output stream
+ * @return E_OK on success, E_NOT_OK on NULL_PTR or if already running
+ */
+Std_ReturnType Log_Start(FILE* Stream);
+
+/**
+ * @brief Stop the background writer
+ * @details Writes all captured messages and flushes the stream
+ */
+void Log_Stop(void);
+
+/**
+ * @brief Check whether the writer is running
+ * @return TRUE while running
+ */
+boolean Log_IsActive(void);
+
+/**
+ * @brief Write all messages captured so far
+ * @details For callers about to write to the same stream directly; takes
+ *          the writer lock, so not for the scheduler loop
+ */
+void Log_Flush(void);
+
+/**
+ * @brief Set the lowest level logged
+ * @param[in] Level LOG_LEVEL_DEBUG .. LOG_LEVEL_OFF
+ */
+void Log_SetLevel(Log_LevelType Level);
+
+/**
+ * @brief Check whether a level is logged
+ * @param[in] Level Message level
+ * @return TRUE if the writer is running and the level is enabled
+ */
+boolean Log_IsEnabled(Log_LevelType Level);
+
+/**
+ * @brief Rate limit a log statement
+ * @param[in,out] RateLimit State of the statement
+ * @param[in] PeriodMs Minimum time between two messages
+ * @param[out] Suppressed Messages suppressed since the last one passed
+ * @return TRUE if the message passes
+ */
+boolean Log_RateLimitPass(Log_RateLimitType* RateLimit, uint32_t PeriodMs, uint32_t* Suppressed);
+
+/**
+ * @brief Capture a message into the ring of the calling thread
+ * @details Use the LOG_* macros, which check the format at compile time
+ * @param[in] Level Message level
+ * @param[in] Suppressed Messages suppressed before this one (rate limit)
+ * @param[in] Format printf-style format with static storage
+ * @param[in] Args Captured arguments
+ * @param[in] NumArgs Number of arguments (at most LOG_MAX_ARGS)
+ */
+void Log_Write(
+    Log_LevelType Level,
+    uint32_t Suppressed,
+    const char* Format,
+    const Log_ArgType* Args,
+    uint8_t NumArgs
+);
+
+/**
+ * @brief Get log statistics
+ * @param[out] Statistics Statistics
+ * @return E_OK on success, E_NOT_OK on NULL_PTR
+ */
+Std_ReturnType Log_GetStatistics(Log_StatisticsType* Statistics);
+
+/*============================================================================*
+ * ARGUMENT CAPTURE
+ *============================================================================*/
+
+/** @brief Capture an int (also smaller integers, bool and enums) */
+inline Log_ArgType Log_MakeArg(int Value) {
+    return { static_cast<uint64_t>(static_cast<sint64>(Value)), static_cast<uint8_t>(LOG_ARG_INTEGER) };
+}
+
+/** @brief Capture a long */
+inline Log_ArgType Log_MakeArg(long Value) {
+    return { static_cast<uint64_t>(static_cast<sint64>(Value)), static_cast<uint8_t>(LOG_ARG_INTEGER) };
+}
+
+/** @brief Capture a long long */
+inline Log_ArgType Log_MakeArg(long long Value) {
+    return { static_cast<uint64_t>(static_cast<sint64>(Value)), static_cast<uint8_t>(LOG_ARG_INTEGER) };
+}
+
+/** @brief Capture an unsigned int */
+inline Log_ArgType Log_MakeArg(unsigned int Value) {
+    return { static_cast<uint64_t>(Value), static_cast<uint8_t>(LOG_ARG_INTEGER) };
+}
+
+/** @brief Capture an unsigned long */
+inline Log_ArgType Log_MakeArg(unsigned long Value) {
+    return { static_cast<uint64_t>(Value), static_cast<uint8_t>(LOG_ARG_INTEGER) };
+}
+
+/** @brief Capture an unsigned long long */
+inline Log_ArgType Log_MakeArg(unsigned long long Value) {
+    return { static_cast<uint64_t>(Value), static_cast<uint8_t>(LOG_ARG_INTEGER) };
+}
+
+/** @brief Capture a double (also float) */
+inline Log_ArgType Log_MakeArg(double Value) {
+    Log_ArgType arg = { 0U, static_cast<uint8_t>(LOG_ARG_DOUBLE) };
+
+    (void)std::memcpy(&arg.Value, &Value, sizeof(Value));
+    return arg;
+}
+
+/** @brief Capture a string pointer */
+inline Log_ArgType Log_MakeArg(const char* Value) {
+    return { static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Value)), static_cast<uint8_t>(LOG_ARG_STRING) };
+}
+
+/**
+ * @brief Capture all arguments and write the message
+ */
+template <typename... ArgumentTypes>
+inline void Log_Emit(Log_LevelType Level, uint32_t Suppressed, const char* Format,
+                     ArgumentTypes... Arguments) {
+    static_assert(sizeof...(ArgumentTypes) <= LOG_MAX_ARGS, "Too many log arguments");
+    const Log_ArgType args[sizeof...(ArgumentTypes) + 1U] = {
+        Log_MakeArg(Arguments)..., { 0U, static_cast<uint8_t>(LOG_ARG_INTEGER) }
+    };
+
+    Log_Write(Level, Suppressed, Format, args, static_cast<uint8_t>(sizeof...(ArgumentTypes)));
+}
+
+/*============================================================================*
+ * LOG STATEMENTS
+ *============================================================================*/
+
+/**
+ * @brief Log a message
+ * @details The dead printf lets the compiler check the format against the
+ *          arguments; the arguments are only evaluated if the level is on
+ */
+#define LOG_WRITE(level, ...) \
+    do { \
+        if (FALSE) { \
+            (void)std::printf(__VA_ARGS__); \
+        } \
+        if (Log_IsEnabled(level)) { \
+            Log_Emit((level), 0U, __VA_ARGS__); \
+        } \
+    } while (0)
+
+/**
+ * @brief Log a message at most once per period
+ * @details The next message that passes reports the suppressed count
+ */
+#define LOG_WRITE_RATELIMITED(level, periodMs, ...) \
+    do { \
+        static Log_RateLimitType logRateLimit; \
+        uint32_t logSuppressed = 0U; \
+        if (FALSE) { \
+            (void)std::printf(__VA_ARGS__); \
+        } \
+        if (Log_IsEnabled(level) && Log_RateLimitPass(&logRateLimit, (periodMs), &logSuppressed)) { \
+            Log_Emit((level), logSuppressed, __VA_ARGS__); \
+        } \
+    } while (0)
+
+/**
+ * @brief Compiled-out log statement
+ * @details Arguments are neither evaluated nor reported as unused
+ */
+#define LOG_DISABLED(...) \
+    do { \
+        if (FALSE) { \
+            (void)std::printf(__VA_ARGS__); \
+        } \
+    } while (0)
+
+#if (LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG)
+#define LOG_DEBUG(...)                      LOG_WRITE(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LOG_DEBUG_RATELIMITED(periodMs, ...) \
+    LOG_WRITE_RATELIMITED(LOG_LEVEL_DEBUG, (periodMs), __VA_ARGS__)
+#else
+#define LOG_DEBUG(...)                      LOG_DISABLED(__VA_ARGS__)
+#define LOG_DEBUG_RATELIMITED(periodMs, ...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO)
+#define LOG_INFO(...)                       LOG_WRITE(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_INFO_RATELIMITED(periodMs, ...) \
+    LOG_WRITE_RATELIMITED(LOG_LEVEL_INFO, (periodMs), __VA_ARGS__)
+#else
+#define LOG_INFO(...)                       LOG_DISABLED(__VA_ARGS__)
+#define LOG_INFO_RATELIMITED(periodMs, ...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (LOG_COMPILE_LEVEL <= LOG_LEVEL_WARNING)
+#define LOG_WARNING(...)                    LOG_WRITE(LOG_LEVEL_WARNING, __VA_ARGS__)
+#define LOG_WARNING_RATELIMITED(periodMs, ...) \
+    LOG_WRITE_RATELIMITED(LOG_LEVEL_WARNING, (periodMs), __VA_ARGS__)
+#else
+#define LOG_WARNING(...)                    LOG_DISABLED(__VA_ARGS__)
+#define LOG_WARNING_RATELIMITED(periodMs, ...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if (LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR)
+#define LOG_ERROR(...)                      LOG_WRITE(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_ERROR_RATELIMITED(periodMs, ...) \
+    LOG_WRITE_RATELIMITED(LOG_LEVEL_ERROR, (periodMs), __VA_ARGS__)
+#else
+#define LOG_ERROR(...)                      LOG_DISABLED(__VA_ARGS__)
+#define LOG_ERROR_RATELIMITED(periodMs, ...) LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#endif /* LOG_H */
@@ -0,0 +1,443 @@
+/**
+ * @file Metrics.cpp
+ * @brief Metrics Registry Implementation
+ * @details Each thread claims a shard on its first update; threads beyond
+ *          METRICS_MAX_THREADS share the last shard, which stays correct as
+ *          all updates are atomic adds. A scrape sums a slot over all shards,
+ *          so it sees every completed update but no consistent snapshot
+ *          across series.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on the function
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Metrics.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Counter slots of one thread, on their own cache lines
+ */
+typedef struct {
+    alignas(64) std::atomic<uint64_t> Slots[METRICS_MAX_SLOTS];
+} Metrics_ShardType;
+
+/**
+ * @brief Text output state
+ */
+typedef struct {
+    char* Buffer;
+    uint32_t Size;
+    uint32_t Length;
+    boolean Truncated;
+} Metrics_TextType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Counter and histogram shards */
+static Metrics_ShardType Metrics_Shards[METRICS_MAX_THREADS];
+
+/** @brief Shards claimed (may exceed METRICS_MAX_THREADS) */
+static std::atomic<uint32_t> Metrics_NumShards(0U);
+
+/** @brief Incremented on every Metrics_Init to invalidate the thread bindings */
+static std::atomic<uint32_t> Metrics_Generation(1U);
+
+/** @brief Gauge values, indexed by Metrics_IdType */
+static std::atomic<sint64> Metrics_Gauges[METRICS_NUM_SERIES];
+
+/** @brief First slot of each series */
+static uint16_t Metrics_SlotOffset[METRICS_NUM_SERIES];
+
+/** @brief Registry laid out */
+static std::atomic<boolean> Metrics_Initialized(FALSE);
+
+/** @brief Shard of the calling thread */
+static thread_local Metrics_ShardType* Metrics_ThreadShard = NULL_PTR;
+
+/** @brief Generation of Metrics_ThreadShard (0 = not bound) */
+static thread_local uint32_t Metrics_ThreadGeneration = 0U;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static Metrics_ShardType* Metrics_GetThreadShard(void);
+static uint64_t Metrics_SumSlot(uint16_t slot);
+static const Metrics_SeriesConfigType* Metrics_GetSeries(Metrics_IdType Id, Metrics_TypeType Type);
+static void Metrics_AppendText(Metrics_TextType* text, const char* value);
+static void Metrics_AppendUnsigned(Metrics_TextType* text, uint64_t value);
+static void Metrics_AppendSigned(Metrics_TextType* text, sint64 value);
+static void Metrics_AppendSample(
+    Metrics_TextType* text,
+    const Metrics_SeriesConfigType* series,
+    const char* suffix,
+    const char* extraLabel
+);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize the registry
+ */
+Std_ReturnType Metrics_Init(void) {
+    uint32_t slot = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    Metrics_Initialized.store(FALSE);
+
+    for (i = 0U; i < METRICS_NUM_SERIES; i++) {
+        const Metrics_SeriesConfigType* series = &Metrics_SeriesConfig[i];
+
+        if ((series->Name == NULL_PTR) || (series->NumBuckets > METRICS_MAX_BUCKETS)) {
+            return E_NOT_OK;
+        }
+        if ((series->Type == METRICS_TYPE_HISTOGRAM) && (series->Buckets == NULL_PTR)) {
+            return E_NOT_OK;
+        }
+
+        Metrics_SlotOffset[i] = static_cast<uint16_t>(slot);
+        if (series->Type == METRICS_TYPE_COUNTER) {
+            slot += 1U;
+        } else if (series->Type == METRICS_TYPE_HISTOGRAM) {
+            /* Finite buckets, +Inf bucket, sum */
+            slot += static_cast<uint32_t>(series->NumBuckets) + 2U;
+        } else {
+            /* Gauges are not sharded */
+        }
+        if (slot > METRICS_MAX_SLOTS) {
+            return E_NOT_OK;
+        }
+        Metrics_Gauges[i].store(0);
+    }
+
+    for (i = 0U; i < METRICS_MAX_THREADS; i++) {
+        for (j = 0U; j < METRICS_MAX_SLOTS; j++) {
+            Metrics_Shards[i].Slots[j].store(0U, std::memory_order_relaxed);
+        }
+    }
+    Metrics_NumShards.store(0U);
+    Metrics_Generation.fetch_add(1U);
+    Metrics_Initialized.store(TRUE, std::memory_order_release);
+
+    return E_OK;
+}
+
+/**
+ * @brief Increment a counter by one
+ */
+void Metrics_Increment(Metrics_IdType Id) {
+    Metrics_Add(Id, 1U);
+}
+
+/**
+ * @brief Add to a counter
+ */
+void Metrics_Add(Metrics_IdType Id, uint64_t Value) {
+    Metrics_ShardType* shard;
+
+    if (Metrics_GetSeries(Id, METRICS_TYPE_COUNTER) == NULL_PTR) {
+        return;
+    }
+
+    shard = Metrics_GetThreadShard();
+    shard->Slots[Metrics_SlotOffset[Id]].fetch_add(Value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Set a gauge
+ */
+void Metrics_SetGauge(Metrics_IdType Id, sint64 Value) {
+    if (Metrics_GetSeries(Id, METRICS_TYPE_GAUGE) == NULL_PTR) {
+        return;
+    }
+
+    Metrics_Gauges[Id].store(Value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Record a histogram observation
+ */
+void Metrics_Observe(Metrics_IdType Id, uint64_t Value) {
+    const Metrics_SeriesConfigType* series = Metrics_GetSeries(Id, METRICS_TYPE_HISTOGRAM);
+    Metrics_ShardType* shard;
+    uint32_t bucket = 0U;
+
+    if (series == NULL_PTR) {
+        return;
+    }
+
+    /* First bucket whose upper bound holds the value, else +Inf */
+    while ((bucket < series->NumBuckets) && (Value > series->Buckets[bucket])) {
+        bucket++;
+    }
+
+    shard = Metrics_GetThreadShard();
+    shard->Slots[Metrics_SlotOffset[Id] + bucket].fetch_add(1U, std::memory_order_relaxed);
+    shard->Slots[Metrics_SlotOffset[Id] + series->NumBuckets + 1U].fetch_add(
+        Value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the aggregated value of a series
+ */
+uint64_t Metrics_GetValue(Metrics_IdType Id) {
+    const Metrics_SeriesConfigType* series;
+    uint64_t count = 0U;
+    uint32_t bucket;
+
+    if (!Metrics_Initialized.load(std::memory_order_acquire) || (Id >= METRICS_NUM_SERIES)) {
+        return 0U;
+    }
+
+    series = &Metrics_SeriesConfig[Id];
+    switch (series->Type) {
+        case METRICS_TYPE_COUNTER:
+            count = Metrics_SumSlot(Metrics_SlotOffset[Id]);
+            break;
+
+        case METRICS_TYPE_GAUGE:
+            count = static_cast<uint64_t>(Metrics_Gauges[Id].load(std::memory_order_relaxed));
+            break;
+
+        case METRICS_TYPE_HISTOGRAM:
+            for (bucket = 0U; bucket <= series->NumBuckets; bucket++) {
+                count += Metrics_SumSlot(static_cast<uint16_t>(Metrics_SlotOffset[Id] + bucket));
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Get the sum of a histogram
+ */
+uint64_t Metrics_GetHistogramSum(Metrics_IdType Id) {
+    const Metrics_SeriesConfigType* series = Metrics_GetSeries(Id, METRICS_TYPE_HISTOGRAM);
+
+    if (series == NULL_PTR) {
+        return 0U;
+    }
+
+    return Metrics_SumSlot(static_cast<uint16_t>(Metrics_SlotOffset[Id] + series->NumBuckets + 1U));
+}
+
+/**
+ * @brief Render all series in the Prometheus text exposition format
+ */
+Std_ReturnType Metrics_WriteText(char* Buffer, uint32_t Size, uint32_t* Length) {
+    static const char* const typeNames[] = { "counter", "gauge", "histogram" };
+    Metrics_TextType text = { Buffer, Size, 0U, FALSE };
+    char le[32];
+    uint64_t cumulative;
+    uint32_t i;
+    uint32_t bucket;
+
+    if ((Buffer == NULL_PTR) || (Size == 0U) || (Length == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    Buffer[0] = '\0';
+    if (!Metrics_Initialized.load(std::memory_order_acquire)) {
+        *Length = 0U;
+        return E_OK;
+    }
+
+    for (i = 0U; i < METRICS_NUM_SERIES; i++) {
+        const Metrics_SeriesConfigType* series = &Metrics_SeriesConfig[i];
+
+        /* HELP and TYPE once per family */
+        if ((i == 0U) || (std::strcmp(series->Name, Metrics_SeriesConfig[i - 1U].Name) != 0)) {
+            if (series->Help != NULL_PTR) {
+                Metrics_AppendText(&text, "# HELP ");
+                Metrics_AppendText(&text, series->Name);
+                Metrics_AppendText(&text, " ");
+                Metrics_AppendText(&text, series->Help);
+                Metrics_AppendText(&text, "\n");
+            }
+            Metrics_AppendText(&text, "# TYPE ");
+            Metrics_AppendText(&text, series->Name);
+            Metrics_AppendText(&text, " ");
+            Metrics_AppendText(&text, typeNames[series->Type]);
+            Metrics_AppendText(&text, "\n");
+        }
+
+        switch (series->Type) {
+            case METRICS_TYPE_COUNTER:
+                Metrics_AppendSample(&text, series, "", NULL_PTR);
+                Metrics_AppendUnsigned(&text, Metrics_SumSlot(Metrics_SlotOffset[i]));
+                break;
+
+            case METRICS_TYPE_GAUGE:
+                Metrics_AppendSample(&text, series, "", NULL_PTR);
+                Metrics_AppendSigned(&text, Metrics_Gauges[i].load(std::memory_order_relaxed));
+                break;
+
+            case METRICS_TYPE_HISTOGRAM:
+                cumulative = 0U;
+                for (bucket = 0U; bucket <= series->NumBuckets; bucket++) {
+                    cumulative += Metrics_SumSlot(static_cast<uint16_t>(Metrics_SlotOffset[i] + bucket));
+                    if (bucket < series->NumBuckets) {
+                        (void)std::snprintf(le, sizeof(le), "le=\"%llu\"",
+                                            static_cast<unsigned long long>(series->Buckets[bucket]));
+                    } else {
+                        (void)std::snprintf(le, sizeof(le), "le=\"+Inf\"");
+                    }
+                    Metrics_AppendSample(&text, series, "_bucket", le);
+                    Metrics_AppendUnsigned(&text, cumulative);
+                    Metrics_AppendText(&text, "\n");
+                }
+                Metrics_AppendSample(&text, series, "_sum", NULL_PTR);
+                Metrics_AppendUnsigned(&text, Metrics_SumSlot(static_cast<uint16_t>(
+                    Metrics_SlotOffset[i] + series->NumBuckets + 1U)));
+                Metrics_AppendText(&text, "\n");
+                Metrics_AppendSample(&text, series, "_count", NULL_PTR);
+                Metrics_AppendUnsigned(&text, cumulative);
+                break;
+
+            default:
+                break;
+        }
+        Metrics_AppendText(&text, "\n");
+    }
+
+    *Length = text.Length;
+
+    return text.Truncated ? E_NOT_OK : E_OK;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get the shard of the calling thread, claim one on first use
+ */
+static Metrics_ShardType* Metrics_GetThreadShard(void) {
+    const uint32_t generation = Metrics_Generation.load(std::memory_order_acquire);
+    uint32_t index;
+
+    if (Metrics_ThreadGeneration != generation) {
+        index = Metrics_NumShards.fetch_add(1U);
+        if (index >= METRICS_MAX_THREADS) {
+            index = METRICS_MAX_THREADS - 1U;
+        }
+        Metrics_ThreadShard = &Metrics_Shards[index];
+        Metrics_ThreadGeneration = generation;
+    }
+
+    return Metrics_ThreadShard;
+}
+
+/**
+ * @brief Sum one slot over all shards
+ */
+static uint64_t Metrics_SumSlot(uint16_t slot) {
+    uint64_t sum = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < METRICS_MAX_THREADS; i++) {
+        sum += Metrics_Shards[i].Slots[slot].load(std::memory_order_relaxed);
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Get the configuration of a series of the expected type
+ * @return Series, NULL_PTR if not initialized, unknown or of another type
+ */
+static const Metrics_SeriesConfigType* Metrics_GetSeries(Metrics_IdType Id, Metrics_TypeType Type) {
+    if (!Metrics_Initialized.load(std::memory_order_acquire) || (Id >= METRICS_NUM_SERIES)) {
+        return NULL_PTR;
+    }
+
+    if (Metrics_SeriesConfig[Id].Type != Type) {
+        return NULL_PTR;
+    }
+
+    return &Metrics_SeriesConfig[Id];
+}
+
+/**
+ * @brief Append a string, keeping the text NUL terminated
+ */
+static void Metrics_AppendText(Metrics_TextType* text, const char* value) {
+    const size_t length = std::strlen(value);
+
+    if ((text->Length + length) >= text->Size) {
+        text->Truncated = TRUE;
+        return;
+    }
+
+    (void)std::memcpy(&text->Buffer[text->Length], value, length + 1U);
+    text->Length += static_cast<uint32_t>(length);
+}
+
+/**
+ * @brief Append an unsigned decimal
+ */
+static void Metrics_AppendUnsigned(Metrics_TextType* text, uint64_t value) {
+    char digits[24];
+
+    (void)std::snprintf(digits, sizeof(digits), "%llu", static_cast<unsigned long long>(value));
+    Metrics_AppendText(text, digits);
+}
+
+/**
+ * @brief Append a signed decimal
+ */
+static void Metrics_AppendSigned(Metrics_TextType* text, sint64 value) {
+    char digits[24];
+
+    (void)std::snprintf(digits, sizeof(digits), "%lld", static_cast<long long>(value));
+    Metrics_AppendText(text, digits);
+}
+
+/**
+ * @brief Append "name<suffix>{labels,extra} " of a sample line
+ */
+static void Metrics_AppendSample(
+    Metrics_TextType* text,
+    const Metrics_SeriesConfigType* series,
+    const char* suffix,
+    const char* extraLabel
+) {
+    Metrics_AppendText(text, series->Name);
+    Metrics_AppendText(text, suffix);
+
+    if ((series->Labels != NULL_PTR) || (extraLabel != NULL_PTR)) {
+        Metrics_AppendText(text, "{");
+        if (series->Labels != NULL_PTR) {
+            Metrics_AppendText(text, series->Labels);
+        }
+        if (extraLabel != NULL_PTR) {
+            if (series->Labels != NULL_PTR) {
+                Metrics_AppendText(text, ",");
+            }
+            Metrics_AppendText(text, extraLabel);
+        }
+        Metrics_AppendText(text, "}");
+    }
+    Metrics_AppendText(text, " ");
+}
@@ -0,0 +1,90 @@
+/**
+ * @file Metrics.h
+ * @brief Metrics Registry
+ * @details Counters, gauges and histograms of the whole stack. Counters and
+ *          histograms are kept in per-thread shards of relaxed atomics and
+ *          summed on scrape, so an update is one uncontended atomic add and
+ *          never takes a lock. The registry renders the Prometheus text
+ *          exposition format; see Metrics_Export.h for the endpoints.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on the function
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Metrics_Cfg.h"
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize the registry
+ * @details Lays out the shards from Metrics_SeriesConfig and clears all
+ *          values. Updates before the first Metrics_Init are ignored.
+ * @return E_OK on success, E_NOT_OK if the configuration exceeds
+ *         METRICS_MAX_SLOTS or METRICS_MAX_BUCKETS
+ */
+Std_ReturnType Metrics_Init(void);
+
+/**
+ * @brief Increment a counter by one
+ * @param[in] Id Counter series
+ */
+void Metrics_Increment(Metrics_IdType Id);
+
+/**
+ * @brief Add to a counter
+ * @param[in] Id Counter series
+ * @param[in] Value Increment
+ */
+void Metrics_Add(Metrics_IdType Id, uint64_t Value);
+
+/**
+ * @brief Set a gauge
+ * @param[in] Id Gauge series
+ * @param[in] Value New value
+ */
+void Metrics_SetGauge(Metrics_IdType Id, sint64 Value);
+
+/**
+ * @brief Record a histogram observation
+ * @param[in] Id Histogram series
+ * @param[in] Value Observed value
+ */
+void Metrics_Observe(Metrics_IdType Id, uint64_t Value);
+
+/**
+ * @brief Get the aggregated value of a series
+ * @param[in] Id Series
+ * @return Counter sum over all threads, gauge value, or histogram count;
+ *         0 for an unknown series
+ */
+uint64_t Metrics_GetValue(Metrics_IdType Id);
+
+/**
+ * @brief Get the sum of a histogram
+ * @param[in] Id Histogram series
+ * @return Sum of the observations, 0 for other series
+ */
+uint64_t Metrics_GetHistogramSum(Metrics_IdType Id);
+
+/**
+ * @brief Render all series in the Prometheus text exposition format
+ * @param[out] Buffer Output text (NUL terminated)
+ * @param[in] Size Buffer size
+ * @param[out] Length Text length without the terminator
+ * @return E_OK on success, E_NOT_OK on NULL_PTR or if the text was truncated
+ */
+Std_ReturnType Metrics_WriteText(char* Buffer, uint32_t Size, uint32_t* Length);
+
+#endif /* METRICS_H */
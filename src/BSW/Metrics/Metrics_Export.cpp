@@ -0,0 +1,301 @@
+/**
+ * @file Metrics_Export.cpp
+ * @brief Metrics Export Implementation
+ * @details The export thread polls the listen socket with a timeout of
+ *          METRICS_EXPORT_POLL_MS and writes the dump file in between. Each
+ *          scrape renders the registry once and closes the connection.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on the function
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Metrics_Export.h"
+#include "Metrics.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Active configuration */
+static Metrics_ExportConfigType Metrics_ExportConfig;
+
+/** @brief Dump file path (copied, the caller's string may go away) */
+static std::string Metrics_DumpPath;
+
+/** @brief Listen socket (-1 = none) */
+static int Metrics_ListenFd = -1;
+
+/** @brief Bound port */
+static std::atomic<uint16_t> Metrics_BoundPort(0U);
+
+/** @brief Export thread */
+static std::thread Metrics_ExportThread;
+
+/** @brief Export thread running */
+static std::atomic<boolean> Metrics_ExportActive(FALSE);
+
+/** @brief Stop request for the export thread */
+static std::atomic<boolean> Metrics_ExportStopping(FALSE);
+
+/** @brief Exposition text, only used by the export thread */
+static char Metrics_TextBuffer[METRICS_TEXT_BUFFER_SIZE];
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static Std_ReturnType Metrics_OpenListener(uint16_t port);
+static void Metrics_ExportMain(void);
+static void Metrics_ServeClient(int clientFd);
+static void Metrics_SendAll(int fd, const char* data, size_t length);
+static void Metrics_WriteDump(void);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Start the export thread
+ */
+Std_ReturnType Metrics_StartExport(const Metrics_ExportConfigType* Config) {
+    if ((Config == NULL_PTR) || Metrics_ExportActive.load()) {
+        return E_NOT_OK;
+    }
+    if (!Config->HttpEnabled && (Config->DumpPath == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    Metrics_ExportConfig = *Config;
+    if (Config->DumpPath != NULL_PTR) {
+        Metrics_DumpPath = Config->DumpPath;
+        if (Metrics_ExportConfig.DumpPeriodMs == 0U) {
+            Metrics_ExportConfig.DumpPeriodMs = METRICS_DEFAULT_DUMP_PERIOD_MS;
+        }
+    }
+
+    if (Config->HttpEnabled && (Metrics_OpenListener(Config->HttpPort) != E_OK)) {
+        return E_NOT_OK;
+    }
+
+    Metrics_ExportStopping.store(FALSE);
+    Metrics_ExportActive.store(TRUE);
+    Metrics_ExportThread = std::thread(Metrics_ExportMain);
+
+    return E_OK;
+}
+
+/**
+ * @brief Stop the export thread
+ */
+void Metrics_StopExport(void) {
+    if (!Metrics_ExportActive.load()) {
+        return;
+    }
+
+    Metrics_ExportStopping.store(TRUE);
+    if (Metrics_ExportThread.joinable()) {
+        Metrics_ExportThread.join();
+    }
+
+    if (Metrics_ExportConfig.DumpPath != NULL_PTR) {
+        Metrics_WriteDump();
+    }
+    if (Metrics_ListenFd >= 0) {
+        (void)close(Metrics_ListenFd);
+        Metrics_ListenFd = -1;
+    }
+    Metrics_BoundPort.store(0U);
+    Metrics_ExportActive.store(FALSE);
+}
+
+/**
+ * @brief Get the bound HTTP port
+ */
+uint16_t Metrics_GetHttpPort(void) {
+    return Metrics_BoundPort.load();
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Open the loopback listen socket
+ */
+static Std_ReturnType Metrics_OpenListener(uint16_t port) {
+    struct sockaddr_in address;
+    socklen_t addressLength = sizeof(address);
+    const int reuse = 1;
+    int fd;
+
+    fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return E_NOT_OK;
+    }
+    (void)setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    (void)std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if ((bind(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0) ||
+        (listen(fd, 4) != 0) ||
+        (getsockname(fd, reinterpret_cast<struct sockaddr*>(&address), &addressLength) != 0)) {
+        (void)close(fd);
+        return E_NOT_OK;
+    }
+
+    Metrics_ListenFd = fd;
+    Metrics_BoundPort.store(ntohs(address.sin_port));
+
+    return E_OK;
+}
+
+/**
+ * @brief Export thread: serve scrapes and write the periodic dump
+ */
+static void Metrics_ExportMain(void) {
+    auto nextDump = std::chrono::steady_clock::now();
+    struct pollfd listener;
+    int clientFd;
+
+    while (!Metrics_ExportStopping.load()) {
+        if (Metrics_ListenFd >= 0) {
+            listener.fd = Metrics_ListenFd;
+            listener.events = POLLIN;
+            listener.revents = 0;
+            if ((poll(&listener, 1U, static_cast<int>(METRICS_EXPORT_POLL_MS)) > 0) &&
+                ((listener.revents & POLLIN) != 0)) {
+                clientFd = accept4(Metrics_ListenFd, NULL_PTR, NULL_PTR, SOCK_CLOEXEC);
+                if (clientFd >= 0) {
+                    Metrics_ServeClient(clientFd);
+                    (void)close(clientFd);
+                }
+            }
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(METRICS_EXPORT_POLL_MS));
+        }
+
+        if ((Metrics_ExportConfig.DumpPath != NULL_PTR) &&
+            (std::chrono::steady_clock::now() >= nextDump)) {
+            Metrics_WriteDump();
+            nextDump += std::chrono::milliseconds(Metrics_ExportConfig.DumpPeriodMs);
+        }
+    }
+}
+
+/**
+ * @brief Answer one HTTP request
+ * @details Only GET /metrics is served; the connection is closed afterwards
+ */
+static void Metrics_ServeClient(int clientFd) {
+    static const char notFound[] =
+        "HTTP/1.0 404 Not Found\r\n"
+        "Content-Type: text/plain\r\n"
+        "Content-Length: 10\r\n"
+        "Connection: close\r\n"
+        "\r\n"
+        "Not Found\n";
+    char request[METRICS_HTTP_REQUEST_SIZE];
+    char header[160];
+    struct timeval timeout;
+    size_t received = 0U;
+    ssize_t count;
+    uint32_t length = 0U;
+    int headerLength;
+
+    timeout.tv_sec = 0;
+    timeout.tv_usec = static_cast<suseconds_t>(METRICS_HTTP_RECV_TIMEOUT_MS * 1000U);
+    (void)setsockopt(clientFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    /* Read the request head; the body of a GET is empty */
+    while (received < (sizeof(request) - 1U)) {
+        count = recv(clientFd, &request[received], sizeof(request) - 1U - received, 0);
+        if (count <= 0) {
+            break;
+        }
+        received += static_cast<size_t>(count);
+        request[received] = '\0';
+        if (std::strstr(request, "\r\n\r\n") != NULL_PTR) {
+            break;
+        }
+    }
+    request[received] = '\0';
+
+    if ((std::strncmp(request, "GET /metrics", 12U) != 0) ||
+        ((request[12] != ' ') && (request[12] != '?'))) {
+        Metrics_SendAll(clientFd, notFound, sizeof(notFound) - 1U);
+        return;
+    }
+
+    /* A truncated text is still served, the registry is sized to fit */
+    (void)Metrics_WriteText(Metrics_TextBuffer, sizeof(Metrics_TextBuffer), &length);
+    headerLength = std::snprintf(header, sizeof(header),
+                                 "HTTP/1.0 200 OK\r\n"
+                                 "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                                 "Content-Length: %u\r\n"
+                                 "Connection: close\r\n"
+                                 "\r\n",
+                                 length);
+    if ((headerLength > 0) && (static_cast<size_t>(headerLength) < sizeof(header))) {
+        Metrics_SendAll(clientFd, header, static_cast<size_t>(headerLength));
+        Metrics_SendAll(clientFd, Metrics_TextBuffer, length);
+    }
+}
+
+/**
+ * @brief Send a buffer, giving up on the first error
+ */
+static void Metrics_SendAll(int fd, const char* data, size_t length) {
+    size_t sent = 0U;
+    ssize_t count;
+
+    while (sent < length) {
+        count = send(fd, &data[sent], length - sent, MSG_NOSIGNAL);
+        if (count <= 0) {
+            return;
+        }
+        sent += static_cast<size_t>(count);
+    }
+}
+
+/**
+ * @brief Rewrite the dump file
+ * @details Written to a temporary file and renamed, so a reader never sees
+ *          a partial dump
+ */
+static void Metrics_WriteDump(void) {
+    const std::string temporary = Metrics_DumpPath + ".tmp";
+    uint32_t length = 0U;
+    FILE* file;
+
+    (void)Metrics_WriteText(Metrics_TextBuffer, sizeof(Metrics_TextBuffer), &length);
+
+    file = std::fopen(temporary.c_str(), "w");
+    if (file == NULL_PTR) {
+        return;
+    }
+    (void)std::fwrite(Metrics_TextBuffer, 1U, length, file);
+    if (std::fclose(file) == 0) {
+        (void)std::rename(temporary.c_str(), Metrics_DumpPath.c_str());
+    }
+}
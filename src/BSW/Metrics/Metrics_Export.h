@@ -0,0 +1,63 @@
+/**
+ * @file Metrics_Export.h
+ * @brief Metrics Export
+ * @details Publishes the metrics registry on a loopback HTTP endpoint for
+ *          Prometheus scrapes and as a periodically rewritten text file. Both
+ *          are served by one background thread, so neither ever runs in a
+ *          task context.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on the function
+ */
+
+#ifndef METRICS_EXPORT_H
+#define METRICS_EXPORT_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Metrics_Cfg.h"
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Export configuration
+ */
+typedef struct {
+    boolean HttpEnabled;                /**< Serve GET /metrics on 127.0.0.1 */
+    uint16_t HttpPort;                  /**< Listen port (0 = ephemeral) */
+    const char* DumpPath;               /**< Dump file (NULL_PTR = no dump) */
+    uint32_t DumpPeriodMs;              /**< Dump period (ms) */
+} Metrics_ExportConfigType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Start the export thread
+ * @param[in] Config Export configuration
+ * @return E_OK on success, E_NOT_OK on NULL_PTR, if already running, if
+ *         nothing is enabled or if the port cannot be bound
+ */
+Std_ReturnType Metrics_StartExport(const Metrics_ExportConfigType* Config);
+
+/**
+ * @brief Stop the export thread
+ * @details Writes a final dump and closes the endpoint
+ */
+void Metrics_StopExport(void);
+
+/**
+ * @brief Get the bound HTTP port
+ * @return Port, 0 if the endpoint is not running
+ */
+uint16_t Metrics_GetHttpPort(void);
+
+#endif /* METRICS_EXPORT_H */
@@ -0,0 +1,502 @@
+/**
+ * @file Os.cpp
+ * @brief Operating System Task Mapping Implementation
+ * @details Tick driven task activation on the tick thread or on one pinned
+ *          thread per task, response time supervision and spinlocks
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Os.h"
+#include "BSW/Trace/Trace.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static uint64_t Os_GetTimeNs(void);
+static uint64_t Os_GetReleaseNs(uint32_t tickMs);
+static void Os_TaskThread(Os_TaskIdType taskId);
+static void Os_PinThread(Os_TaskIdType taskId);
+static boolean Os_HasOwnCore(Os_TaskIdType taskId);
+static void Os_SetRealTime(Os_TaskIdType taskId);
+static void Os_RecordResponse(Os_TaskIdType taskId, uint64_t responseNs);
+static boolean Os_IsDue(Os_TaskIdType taskId, uint32_t tickMs);
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Module initialized */
+static boolean Os_Initialized = FALSE;
+
+/** @brief Active configuration */
+static const Os_ConfigType* Os_ConfigPtr = NULL_PTR;
+
+/** @brief Task statistics, indexed by task ID */
+static Os_TaskStatsType Os_TaskStats[OS_MAX_TASKS];
+
+/** @brief Task threads of the multi-core mapping */
+static std::thread Os_TaskThreads[OS_MAX_TASKS];
+
+/** @brief Activation handshake between tick thread and task threads */
+static std::mutex Os_Mutex;
+static std::condition_variable Os_TaskActivate[OS_MAX_TASKS];
+static std::condition_variable Os_TickDone;
+static boolean Os_TaskPending[OS_MAX_TASKS];
+static uint64_t Os_TaskReleaseNs[OS_MAX_TASKS];
+static uint8_t Os_ActiveTasks = 0U;
+static boolean Os_Stopping = FALSE;
+
+/** @brief Time base of the nominal releases: tick and its release time */
+static boolean Os_TickBaseValid = FALSE;
+static uint32_t Os_TickBaseMs = 0U;
+static uint64_t Os_TickBaseNs = 0U;
+
+/** @brief Spinlocks, indexed by spinlock ID */
+static std::atomic<bool> Os_Spinlocks[OS_NUM_SPINLOCKS];
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize the OS and start the task threads
+ */
+Std_ReturnType Os_Init(const Os_ConfigType* ConfigPtr) {
+    Os_TaskIdType i;
+
+    if (Os_Initialized || (ConfigPtr == NULL_PTR) || (ConfigPtr->Tasks == NULL_PTR) ||
+        (ConfigPtr->NumTasks == 0U) || (ConfigPtr->NumTasks > OS_MAX_TASKS)) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0U; i < ConfigPtr->NumTasks; i++) {
+        if ((ConfigPtr->Tasks[i].Entry == NULL_PTR) || (ConfigPtr->Tasks[i].PeriodMs == 0U)) {
+            return E_NOT_OK;
+        }
+    }
+
+    Os_ConfigPtr = ConfigPtr;
+    Os_ActiveTasks = 0U;
+    Os_Stopping = FALSE;
+    Os_TickBaseValid = FALSE;
+
+    for (i = 0U; i < ConfigPtr->NumTasks; i++) {
+        (void)std::memset(&Os_TaskStats[i], 0, sizeof(Os_TaskStatsType));
+        Os_TaskStats[i].Core = OS_CORE_ANY;
+        Os_TaskPending[i] = FALSE;
+        Os_TaskReleaseNs[i] = 0U;
+    }
+
+    if (ConfigPtr->Mapping == OS_MAPPING_MULTI_CORE) {
+        for (i = 0U; i < ConfigPtr->NumTasks; i++) {
+            Os_TaskThreads[i] = std::thread(Os_TaskThread, i);
+            Os_PinThread(i);
+        }
+        /* A SCHED_FIFO task spinning on a lock held by a task of its core
+         * would never let the holder run */
+        for (i = 0U; i < ConfigPtr->NumTasks; i++) {
+            if (Os_HasOwnCore(i)) {
+                Os_SetRealTime(i);
+            }
+        }
+    }
+
+    Os_Initialized = TRUE;
+
+    return E_OK;
+}
+
+/**
+ * @brief Stop and join the task threads
+ */
+void Os_DeInit(void) {
+    Os_TaskIdType i;
+
+    if (!Os_Initialized) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(Os_Mutex);
+        Os_Stopping = TRUE;
+    }
+
+    for (i = 0U; i < Os_ConfigPtr->NumTasks; i++) {
+        Os_TaskActivate[i].notify_one();
+        if (Os_TaskThreads[i].joinable()) {
+            Os_TaskThreads[i].join();
+        }
+    }
+
+    Os_Initialized = FALSE;
+}
+
+/**
+ * @brief System tick: release the tasks due at this time
+ */
+void Os_Tick(uint32_t TickMs) {
+    Os_TaskIdType i;
+    uint64_t releaseNs;
+
+    if (!Os_Initialized) {
+        return;
+    }
+
+    releaseNs = Os_GetReleaseNs(TickMs);
+
+    if (Os_ConfigPtr->Mapping == OS_MAPPING_SINGLE_THREAD) {
+        /* Priority order: a task's response includes the higher priority tasks */
+        for (i = 0U; i < Os_ConfigPtr->NumTasks; i++) {
+            if (Os_IsDue(i, TickMs)) {
+                Os_ConfigPtr->Tasks[i].Entry();
+                Os_RecordResponse(i, Os_GetTimeNs() - releaseNs);
+            }
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(Os_Mutex);
+    for (i = 0U; i < Os_ConfigPtr->NumTasks; i++) {
+        if (!Os_IsDue(i, TickMs)) {
+            continue;
+        }
+        if (Os_TaskPending[i]) {
+            /* Previous job still running: the activation is lost */
+            Os_TaskStats[i].LostActivations++;
+            Os_TaskStats[i].DeadlineMisses++;
+        } else {
+            Os_TaskPending[i] = TRUE;
+            Os_TaskReleaseNs[i] = releaseNs;
+            Os_ActiveTasks++;
+            Os_TaskActivate[i].notify_one();
+        }
+    }
+
+    /* Simulated hardware advances while the tasks are idle, but an overrunning
+     * job does not hold back the next tick */
+    (void)Os_TickDone.wait_until(
+        lock,
+        std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::nanoseconds(releaseNs + (OS_TICK_MS * 1000000ULL)))),
+        [] { return (Os_ActiveTasks == 0U); });
+}
+
+/**
+ * @brief Resynchronize the nominal releases after dropped ticks
+ */
+void Os_SkipTicks(uint32_t TickMs, uint32_t NumTicks) {
+    Os_TaskIdType i;
+    uint32_t tick;
+
+    if ((!Os_Initialized) || (!Os_TickBaseValid) || (NumTicks == 0U)) {
+        return;
+    }
+
+    Os_TickBaseNs += static_cast<uint64_t>(NumTicks) * OS_TICK_MS * 1000000U;
+
+    std::lock_guard<std::mutex> lock(Os_Mutex);
+    for (i = 0U; i < Os_ConfigPtr->NumTasks; i++) {
+        for (tick = 0U; tick < NumTicks; tick++) {
+            if (Os_IsDue(i, TickMs + (tick * OS_TICK_MS))) {
+                Os_TaskStats[i].LostActivations++;
+                Os_TaskStats[i].DeadlineMisses++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Get statistics of a task
+ */
+Std_ReturnType Os_GetTaskStats(Os_TaskIdType TaskId, Os_TaskStatsType* Stats) {
+    if ((!Os_Initialized) || (Stats == NULL_PTR) || (TaskId >= Os_ConfigPtr->NumTasks)) {
+        return E_NOT_OK;
+    }
+
+    std::lock_guard<std::mutex> lock(Os_Mutex);
+    *Stats = Os_TaskStats[TaskId];
+
+    return E_OK;
+}
+
+/**
+ * @brief Write task mapping and deadline report
+ */
+void Os_PrintTaskStats(FILE* stream) {
+    Os_TaskStatsType stats;
+    const Os_TaskConfigType* task;
+    Os_TaskIdType i;
+    char core[8];
+
+    if ((stream == NULL_PTR) || (!Os_Initialized)) {
+        return;
+    }
+
+    (void)std::fprintf(stream, "Task mapping (%s):\n",
+                       (Os_ConfigPtr->Mapping == OS_MAPPING_MULTI_CORE) ? "multi-core" : "single thread");
+    (void)std::fprintf(stream, "  %-10s %4s %4s %11s %8s %6s %10s %10s %12s\n",
+                       "Task", "Core", "FIFO", "Activations", "Misses", "Lost", "Avg(us)", "Max(us)",
+                       "Deadline(us)");
+    for (i = 0U; i < Os_ConfigPtr->NumTasks; i++) {
+        task = &Os_ConfigPtr->Tasks[i];
+        if (Os_GetTaskStats(i, &stats) != E_OK) {
+            continue;
+        }
+
+        if (stats.Core == OS_CORE_ANY) {
+            (void)std::snprintf(core, sizeof(core), "-");
+        } else {
+            (void)std::snprintf(core, sizeof(core), "%d", static_cast<int>(stats.Core));
+        }
+
+        (void)std::fprintf(stream, "  %-10s %4s %4s %11u %8u %6u %10.1f %10.1f %12u\n",
+                           task->Name, core, stats.RealTime ? "yes" : "no",
+                           static_cast<unsigned>(stats.Activations),
+                           static_cast<unsigned>(stats.DeadlineMisses),
+                           static_cast<unsigned>(stats.LostActivations),
+                           (stats.Activations > 0U) ?
+                               (static_cast<double>(stats.SumResponseNs) /
+                                (1000.0 * static_cast<double>(stats.Activations))) : 0.0,
+                           static_cast<double>(stats.MaxResponseNs) / 1000.0,
+                           static_cast<unsigned>((task->DeadlineUs != 0U) ?
+                                                 task->DeadlineUs : (task->PeriodMs * 1000U)));
+    }
+}
+
+/**
+ * @brief Acquire a spinlock
+ */
+void Os_GetSpinlock(Os_SpinlockIdType SpinlockId) {
+    if (SpinlockId >= OS_NUM_SPINLOCKS) {
+        return;
+    }
+
+    while (Os_Spinlocks[SpinlockId].exchange(true, std::memory_order_acquire)) {
+        while (Os_Spinlocks[SpinlockId].load(std::memory_order_relaxed)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Release a spinlock
+ */
+void Os_ReleaseSpinlock(Os_SpinlockIdType SpinlockId) {
+    if (SpinlockId >= OS_NUM_SPINLOCKS) {
+        return;
+    }
+
+    Os_Spinlocks[SpinlockId].store(false, std::memory_order_release);
+}
+
+/**
+ * @brief Get version information
+ */
+void Os_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
+    if (VersionInfo == NULL_PTR) {
+        return;
+    }
+
+    VersionInfo->vendorID = 0U;
+    VersionInfo->moduleID = 1U;  /* Os module ID */
+    VersionInfo->sw_major_version = OS_SW_MAJOR_VERSION;
+    VersionInfo->sw_minor_version = OS_SW_MINOR_VERSION;
+    VersionInfo->sw_patch_version = OS_SW_PATCH_VERSION;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get monotonic time (ns)
+ */
+static uint64_t Os_GetTimeNs(void) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Get the nominal release time of a tick (ns)
+ * @details A tick is due TickMs - Os_TickBaseMs after the time base (the
+ *          first tick). A late tick releases its tasks at the nominal time, so
+ *          the delay counts against their deadlines. Ticks ahead of real time
+ *          (simulation without real time) move the time base, dropped ticks
+ *          move it by Os_SkipTicks.
+ * @param[in] tickMs System time (ms)
+ */
+static uint64_t Os_GetReleaseNs(uint32_t tickMs) {
+    const uint64_t nowNs = Os_GetTimeNs();
+    uint64_t nominalNs;
+
+    if (Os_TickBaseValid) {
+        nominalNs = Os_TickBaseNs + (static_cast<uint64_t>(tickMs - Os_TickBaseMs) * 1000000U);
+        if (nominalNs <= nowNs) {
+            return nominalNs;
+        }
+    }
+
+    Os_TickBaseValid = TRUE;
+    Os_TickBaseMs = tickMs;
+    Os_TickBaseNs = nowNs;
+
+    return nowNs;
+}
+
+/**
+ * @brief Task thread of the multi-core mapping: run the task body once per
+ *        activation
+ * @param[in] taskId Task ID
+ */
+static void Os_TaskThread(Os_TaskIdType taskId) {
+    std::unique_lock<std::mutex> lock(Os_Mutex);
+    uint64_t endNs;
+
+    Trace_SetThreadName(Os_ConfigPtr->Tasks[taskId].Name);
+
+    for (;;) {
+        Os_TaskActivate[taskId].wait(lock, [taskId] {
+            return (Os_TaskPending[taskId] || Os_Stopping);
+        });
+        if (Os_Stopping) {
+            break;
+        }
+
+        lock.unlock();
+        Os_ConfigPtr->Tasks[taskId].Entry();
+        endNs = Os_GetTimeNs();
+        lock.lock();
+
+        Os_RecordResponse(taskId, endNs - Os_TaskReleaseNs[taskId]);
+        Os_TaskPending[taskId] = FALSE;
+        Os_ActiveTasks--;
+        if (Os_ActiveTasks == 0U) {
+            Os_TickDone.notify_one();
+        }
+    }
+}
+
+/**
+ * @brief Pin a task thread to its core
+ * @details A failure leaves the thread unpinned, visible in the task
+ *          statistics
+ * @param[in] taskId Task ID
+ */
+static void Os_PinThread(Os_TaskIdType taskId) {
+    const Os_TaskConfigType* task = &Os_ConfigPtr->Tasks[taskId];
+
+#if defined(__linux__)
+    pthread_t handle = Os_TaskThreads[taskId].native_handle();
+    /* The task thread runs already */
+    std::lock_guard<std::mutex> lock(Os_Mutex);
+
+    if ((task->CoreId != OS_CORE_ANY) && (task->CoreId >= 0) && (task->CoreId < CPU_SETSIZE)) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(static_cast<size_t>(task->CoreId), &cpus);
+        if (pthread_setaffinity_np(handle, sizeof(cpus), &cpus) == 0) {
+            Os_TaskStats[taskId].Core = task->CoreId;
+        }
+    }
+#else
+    STD_UNUSED(task);
+#endif
+}
+
+/**
+ * @brief Check whether a task is pinned to a core no other task can run on
+ * @details Unpinned tasks may run on any core
+ * @param[in] taskId Task ID
+ */
+static boolean Os_HasOwnCore(Os_TaskIdType taskId) {
+    Os_TaskIdType i;
+
+    if (Os_TaskStats[taskId].Core == OS_CORE_ANY) {
+        return FALSE;
+    }
+    for (i = 0U; i < Os_ConfigPtr->NumTasks; i++) {
+        if ((i != taskId) && ((Os_TaskStats[i].Core == OS_CORE_ANY) ||
+                              (Os_TaskStats[i].Core == Os_TaskStats[taskId].Core))) {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Apply the SCHED_FIFO priority of a task thread
+ * @details A failure (no CAP_SYS_NICE) leaves the thread on the default
+ *          policy, visible in the task statistics
+ * @param[in] taskId Task ID
+ */
+static void Os_SetRealTime(Os_TaskIdType taskId) {
+    const Os_TaskConfigType* task = &Os_ConfigPtr->Tasks[taskId];
+
+#if defined(__linux__)
+    pthread_t handle = Os_TaskThreads[taskId].native_handle();
+    std::lock_guard<std::mutex> lock(Os_Mutex);
+
+    if (task->Priority > 0U) {
+        struct sched_param param;
+        (void)std::memset(&param, 0, sizeof(param));
+        param.sched_priority = static_cast<int>(task->Priority);
+        if (pthread_setschedparam(handle, SCHED_FIFO, &param) == 0) {
+            Os_TaskStats[taskId].RealTime = TRUE;
+        }
+    }
+#else
+    STD_UNUSED(task);
+#endif
+}
+
+/**
+ * @brief Record the response time of a completed activation
+ * @param[in] taskId Task ID
+ * @param[in] responseNs Nominal release to completion (ns)
+ */
+static void Os_RecordResponse(Os_TaskIdType taskId, uint64_t responseNs) {
+    const Os_TaskConfigType* task = &Os_ConfigPtr->Tasks[taskId];
+    Os_TaskStatsType* stats = &Os_TaskStats[taskId];
+    const uint64_t deadlineNs = static_cast<uint64_t>(
+        (task->DeadlineUs != 0U) ? task->DeadlineUs : (task->PeriodMs * 1000U)) * 1000U;
+
+    stats->Activations++;
+    stats->LastResponseNs = responseNs;
+    stats->SumResponseNs += responseNs;
+    if (responseNs > stats->MaxResponseNs) {
+        stats->MaxResponseNs = responseNs;
+    }
+    if (responseNs > deadlineNs) {
+        stats->DeadlineMisses++;
+    }
+}
+
+/**
+ * @brief Check whether a task is activated at this tick
+ */
+static boolean Os_IsDue(Os_TaskIdType taskId, uint32_t tickMs) {
+    return ((tickMs % Os_ConfigPtr->Tasks[taskId].PeriodMs) == 0U);
+}
@@ -0,0 +1,182 @@
+/**
+ * @file Os.h
+ * @brief Operating System Task Mapping Interface
+ * @details Periodic tasks activated by the system tick with two mappings:
+ *          - Single thread: due tasks run on the tick thread in priority
+ *            order
+ *          - Multi-core: every task runs on its own thread, pinned to a
+ *            configured core and scheduled SCHED_FIFO where permitted. Tasks
+ *            due in the same tick run concurrently; the tick returns when
+ *            all of them completed, so the simulated hardware is only
+ *            advanced while the tasks are idle.
+ *          Response times (activation to completion) are checked against
+ *          the task deadline. Data between SWCs of different tasks goes
+ *          through the lock-free RTE ports; BSW state used by several tasks
+ *          is protected by spinlocks.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef OS_H
+#define OS_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include <cstdio>
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define OS_AR_RELEASE_MAJOR_VERSION         23
+#define OS_AR_RELEASE_MINOR_VERSION         11
+
+#define OS_SW_MAJOR_VERSION                 1
+#define OS_SW_MINOR_VERSION                 0
+#define OS_SW_PATCH_VERSION                 0
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Task ID type (index into the task table)
+ */
+typedef uint8_t Os_TaskIdType;
+
+/**
+ * @brief Task body
+ */
+typedef void (*Os_TaskEntryType)(void);
+
+/**
+ * @brief Task mapping type
+ */
+typedef enum {
+    OS_MAPPING_SINGLE_THREAD    = 0x00U,    /**< All tasks on the tick thread */
+    OS_MAPPING_MULTI_CORE       = 0x01U     /**< Thread per task, pinned */
+} Os_MappingType;
+
+/**
+ * @brief Task configuration
+ */
+typedef struct {
+    const char* Name;               /**< Task name for reports */
+    Os_TaskEntryType Entry;         /**< Task body */
+    uint32_t PeriodMs;              /**< Activation period */
+    uint32_t DeadlineUs;            /**< Relative deadline (0 = period) */
+    uint8_t Priority;               /**< SCHED_FIFO priority on an own core (0 = default policy) */
+    int16_t CoreId;                 /**< Pinned core (OS_CORE_ANY = not pinned) */
+} Os_TaskConfigType;
+
+/**
+ * @brief OS configuration type
+ */
+typedef struct {
+    Os_MappingType Mapping;             /**< Task mapping */
+    const Os_TaskConfigType* Tasks;     /**< Tasks in priority order */
+    uint8_t NumTasks;                   /**< Number of tasks */
+} Os_ConfigType;
+
+/**
+ * @brief Task statistics since Os_Init
+ */
+typedef struct {
+    uint32_t Activations;           /**< Completed activations */
+    uint32_t DeadlineMisses;        /**< Activations completed after the deadline or lost */
+    uint32_t LostActivations;       /**< Releases that found the previous job running or were dropped */
+    uint64_t LastResponseNs;        /**< Response time of the last activation */
+    uint64_t MaxResponseNs;         /**< Worst response time */
+    uint64_t SumResponseNs;         /**< Sum of response times */
+    int16_t Core;                   /**< Core the task is pinned to (OS_CORE_ANY = none) */
+    boolean RealTime;               /**< SCHED_FIFO granted */
+} Os_TaskStatsType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize the OS and start the task threads
+ * @details In the multi-core mapping a task whose core or SCHED_FIFO
+ *          priority cannot be applied (missing core, no CAP_SYS_NICE) runs
+ *          unpinned or with the default policy; Os_GetTaskStats shows what
+ *          was granted. SCHED_FIFO is only applied to a task pinned to a
+ *          core of its own: a spinning task would never let a lower
+ *          priority lock holder of its core run.
+ * @param[in] ConfigPtr Pointer to configuration
+ * @return E_OK on success, E_NOT_OK on invalid configuration or if already
+ *         initialized
+ */
+Std_ReturnType Os_Init(const Os_ConfigType* ConfigPtr);
+
+/**
+ * @brief Stop and join the task threads
+ */
+void Os_DeInit(void);
+
+/**
+ * @brief System tick: release the tasks due at this time
+ * @details Releases every task with (TickMs % PeriodMs) == 0 at the nominal
+ *          time of the tick; the response time runs from there. In the
+ *          multi-core mapping a release that finds the previous job of the
+ *          task still running is lost and counted as deadline miss, and the
+ *          tick returns when the running jobs completed, at the latest
+ *          OS_TICK_MS after the release.
+ * @param[in] TickMs System time (ms), advancing by OS_TICK_MS
+ */
+void Os_Tick(uint32_t TickMs);
+
+/**
+ * @brief Resynchronize the nominal releases after the tick source dropped
+ *        ticks
+ * @details Moves the time base NumTicks ticks forward, so that TickMs is
+ *          released at its real time again instead of every later release
+ *          being measured against the stalled timeline. The releases due in
+ *          the dropped interval (ticks TickMs to TickMs + NumTicks - 1 of the
+ *          old timeline) are counted as lost and as deadline misses.
+ * @param[in] TickMs Next tick passed to Os_Tick
+ * @param[in] NumTicks Number of dropped ticks
+ */
+void Os_SkipTicks(uint32_t TickMs, uint32_t NumTicks);
+
+/**
+ * @brief Get statistics of a task
+ * @param[in] TaskId Task ID
+ * @param[out] Stats Pointer to statistics
+ * @return E_OK on success, E_NOT_OK if not initialized or on invalid
+ *         parameters
+ */
+Std_ReturnType Os_GetTaskStats(Os_TaskIdType TaskId, Os_TaskStatsType* Stats);
+
+/**
+ * @brief Write task mapping and deadline report
+ * @param[in] stream Output stream
+ */
+void Os_PrintTaskStats(FILE* stream);
+
+/**
+ * @brief Acquire a spinlock
+ * @details Busy waits (yielding) while another task holds the lock. Not
+ *          recursive; nested locks must be taken in ID order.
+ * @param[in] SpinlockId Spinlock ID
+ */
+void Os_GetSpinlock(Os_SpinlockIdType SpinlockId);
+
+/**
+ * @brief Release a spinlock
+ * @param[in] SpinlockId Spinlock ID
+ */
+void Os_ReleaseSpinlock(Os_SpinlockIdType SpinlockId);
+
+/**
+ * @brief Get version information
+ * @param[out] VersionInfo Pointer to version info structure
+ */
+void Os_GetVersionInfo(Std_VersionInfoType* VersionInfo);
+
+#endif /* OS_H */
@@ -0,0 +1,505 @@
+/**
+ * @file Trace.cpp
+ * @brief Runtime Trace Facility Implementation
+ * @details One single-producer/single-consumer ring per thread, claimed on
+ *          the first record after Trace_Start. The producer owns the head,
+ *          the drainer owns the tail; a record is a clock read, a 16 byte
+ *          store and a release store of the head. The drainer wakes every
+ *          TRACE_DRAIN_PERIOD_MS and converts the records to JSON.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on the function
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Trace.h"
+#include "Rte/Rte_Type.h"
+#include "ComStack_Types.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+/*============================================================================*
+ * LOCAL CONSTANTS
+ *============================================================================*/
+
+/** @brief Process ID in the timeline */
+#define TRACE_PID                           1U
+
+/** @brief Ring index mask */
+#define TRACE_RING_MASK                     (TRACE_RING_SIZE - 1U)
+
+/** @brief Name from one of the local name tables */
+#define TRACE_NAME(names, index) \
+    Trace_Name((names), static_cast<uint32_t>(sizeof(names) / sizeof((names)[0])), (index))
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Per-thread record ring
+ * @details Head and tail on their own cache lines, so the producer and the
+ *          drainer do not share a line on every record
+ */
+typedef struct {
+    alignas(64) std::atomic<uint32_t> Head;     /**< Written by the producer */
+    alignas(64) std::atomic<uint32_t> Tail;     /**< Written by the drainer */
+    std::atomic<uint64_t> Dropped;              /**< Records lost to a full ring */
+    std::atomic<boolean> Ready;                 /**< Name valid, ring in use */
+    char Name[TRACE_THREAD_NAME_LENGTH];
+    Trace_RecordType Records[TRACE_RING_SIZE];
+} Trace_RingType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Rings, claimed in thread order */
+static Trace_RingType Trace_Rings[TRACE_MAX_THREADS];
+
+/** @brief Rings claimed (may exceed TRACE_MAX_THREADS) */
+static std::atomic<uint32_t> Trace_NumRings(0U);
+
+/** @brief Incremented on every ring reset to invalidate the thread bindings */
+static std::atomic<uint32_t> Trace_Generation(1U);
+
+/** @brief Records of threads without a ring */
+static std::atomic<uint64_t> Trace_Unbound(0U);
+
+/** @brief Trace points record */
+static std::atomic<boolean> Trace_Active(FALSE);
+
+/** @brief Records exported */
+static std::atomic<uint64_t> Trace_Exported(0U);
+
+/** @brief Output file */
+static FILE* Trace_File = NULL_PTR;
+
+/** @brief No event written yet (no separator) */
+static boolean Trace_FirstEvent = TRUE;
+
+/** @brief Thread name metadata written, per ring */
+static boolean Trace_NameWritten[TRACE_MAX_THREADS];
+
+/** @brief Monotonic clock origin */
+static std::chrono::steady_clock::time_point Trace_Epoch;
+
+/** @brief Simulated timestamp (ns) */
+static std::atomic<uint64_t> Trace_SimTimeNs(0U);
+static std::atomic<boolean> Trace_SimTimeEnabled(FALSE);
+
+/** @brief Background drainer */
+static std::thread Trace_Drainer;
+static std::mutex Trace_DrainerMutex;
+static std::condition_variable Trace_DrainerWakeup;
+static boolean Trace_DrainerStopping = FALSE;
+
+/** @brief Ring of the calling thread (NULL_PTR = none free) */
+static thread_local Trace_RingType* Trace_ThreadRing = NULL_PTR;
+
+/** @brief Generation of Trace_ThreadRing (0 = not bound) */
+static thread_local uint32_t Trace_ThreadGeneration = 0U;
+
+/** @brief Name of the calling thread */
+static thread_local char Trace_ThreadName[TRACE_THREAD_NAME_LENGTH] = { '\0' };
+
+/** @brief Names for the timeline */
+static const char* const Trace_FlmStateNames[] = { "INIT", "NORMAL", "DEGRADED", "SAFE" };
+static const char* const Trace_ReasonNames[] = {
+    "NONE", "E2E_FAILURE", "WDGM_FAILURE", "MULTI_FAULT", "TIMEOUT", "MANUAL"
+};
+static const char* const Trace_E2EStatusNames[] = {
+    "OK", "NONEWDATA", "WRONGCRC", "SYNC", "INITIAL", "REPEATED", "OKSOMELOST", "WRONGSEQUENCE"
+};
+static const char* const Trace_E2ESmNames[] = { "VALID", "DEINIT", "NODATA", "INIT", "INVALID" };
+static const char* const Trace_DemStatusNames[] = { "PASSED", "FAILED", "PREPASSED", "PREFAILED" };
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static uint64_t Trace_GetTimeNs(void);
+static void Trace_ResetRings(void);
+static Trace_RingType* Trace_GetThreadRing(void);
+static void Trace_DrainerMain(void);
+static void Trace_Drain(void);
+static void Trace_BeginEvent(void);
+static void Trace_WriteRecord(uint32_t tid, const Trace_RecordType* record);
+static const char* Trace_Name(const char* const* names, uint32_t count, uint32_t index);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize the trace facility
+ */
+void Trace_Init(void) {
+    if (Trace_Active.load()) {
+        return;
+    }
+
+    Trace_ResetRings();
+    Trace_SimTimeEnabled.store(FALSE);
+}
+
+/**
+ * @brief Start tracing into a file
+ */
+Std_ReturnType Trace_Start(const char* Path) {
+    if ((Path == NULL_PTR) || Trace_Active.load()) {
+        return E_NOT_OK;
+    }
+
+    Trace_File = std::fopen(Path, "w");
+    if (Trace_File == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    Trace_ResetRings();
+    Trace_Epoch = std::chrono::steady_clock::now();
+    Trace_FirstEvent = TRUE;
+    (void)std::fprintf(Trace_File, "{\"traceEvents\":[\n");
+    Trace_BeginEvent();
+    (void)std::fprintf(Trace_File,
+                       "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"FLM ECU\"}}",
+                       TRACE_PID);
+
+    Trace_DrainerStopping = FALSE;
+    Trace_Active.store(TRUE);
+    Trace_Drainer = std::thread(Trace_DrainerMain);
+
+    return E_OK;
+}
+
+/**
+ * @brief Stop tracing
+ */
+void Trace_Stop(void) {
+    if (!Trace_Active.load()) {
+        return;
+    }
+
+    Trace_Active.store(FALSE);
+    {
+        std::lock_guard<std::mutex> lock(Trace_DrainerMutex);
+        Trace_DrainerStopping = TRUE;
+    }
+    Trace_DrainerWakeup.notify_one();
+    if (Trace_Drainer.joinable()) {
+        Trace_Drainer.join();
+    }
+
+    Trace_Drain();
+    (void)std::fprintf(Trace_File, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    (void)std::fclose(Trace_File);
+    Trace_File = NULL_PTR;
+}
+
+/**
+ * @brief Check whether a trace is running
+ */
+boolean Trace_IsActive(void) {
+    return Trace_Active.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Name the calling thread in the timeline
+ */
+void Trace_SetThreadName(const char* Name) {
+    if (Name == NULL_PTR) {
+        return;
+    }
+
+    (void)std::strncpy(Trace_ThreadName, Name, TRACE_THREAD_NAME_LENGTH - 1U);
+    Trace_ThreadName[TRACE_THREAD_NAME_LENGTH - 1U] = '\0';
+}
+
+/**
+ * @brief Write a record into the ring of the calling thread
+ */
+void Trace_Record(Trace_RecordKindType Kind, uint8_t Id, uint16_t Arg0, uint32_t Arg1) {
+    Trace_RingType* ring;
+    Trace_RecordType* record;
+    uint32_t head;
+
+    if (!Trace_Active.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    ring = Trace_GetThreadRing();
+    if (ring == NULL_PTR) {
+        Trace_Unbound.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    head = ring->Head.load(std::memory_order_relaxed);
+    if ((head - ring->Tail.load(std::memory_order_acquire)) >= TRACE_RING_SIZE) {
+        ring->Dropped.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    record = &ring->Records[head & TRACE_RING_MASK];
+    record->TimeNs = Trace_GetTimeNs();
+    record->Kind = static_cast<uint8_t>(Kind);
+    record->Id = Id;
+    record->Arg0 = Arg0;
+    record->Arg1 = Arg1;
+    ring->Head.store(head + 1U, std::memory_order_release);
+}
+
+/**
+ * @brief Get trace statistics
+ */
+Std_ReturnType Trace_GetStatistics(Trace_StatisticsType* Statistics) {
+    uint32_t numRings;
+    uint32_t i;
+
+    if (Statistics == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    numRings = Trace_NumRings.load();
+    numRings = (numRings < TRACE_MAX_THREADS) ? numRings : TRACE_MAX_THREADS;
+
+    Statistics->Records = Trace_Exported.load();
+    Statistics->Dropped = Trace_Unbound.load();
+    for (i = 0U; i < numRings; i++) {
+        Statistics->Dropped += Trace_Rings[i].Dropped.load();
+    }
+    Statistics->Threads = static_cast<uint8_t>(numRings);
+
+    return E_OK;
+}
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS
+ *============================================================================*/
+
+/**
+ * @brief Set simulated trace timestamp
+ */
+void Trace_SimSetTimeNs(uint64_t timeNs) {
+    Trace_SimTimeNs.store(timeNs, std::memory_order_relaxed);
+    Trace_SimTimeEnabled.store(TRUE, std::memory_order_relaxed);
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get the trace timestamp, relative to Trace_Start
+ */
+static uint64_t Trace_GetTimeNs(void) {
+    if (Trace_SimTimeEnabled.load(std::memory_order_relaxed)) {
+        return Trace_SimTimeNs.load(std::memory_order_relaxed);
+    }
+
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - Trace_Epoch).count());
+}
+
+/**
+ * @brief Release all rings and clear the statistics
+ */
+static void Trace_ResetRings(void) {
+    uint32_t i;
+
+    for (i = 0U; i < TRACE_MAX_THREADS; i++) {
+        Trace_Rings[i].Ready.store(FALSE);
+        Trace_Rings[i].Head.store(0U);
+        Trace_Rings[i].Tail.store(0U);
+        Trace_Rings[i].Dropped.store(0U);
+        Trace_NameWritten[i] = FALSE;
+    }
+    Trace_NumRings.store(0U);
+    Trace_Unbound.store(0U);
+    Trace_Exported.store(0U);
+    Trace_Generation.fetch_add(1U);
+}
+
+/**
+ * @brief Get the ring of the calling thread, claim one on first use
+ * @return Ring, NULL_PTR if all rings are taken
+ */
+static Trace_RingType* Trace_GetThreadRing(void) {
+    const uint32_t generation = Trace_Generation.load(std::memory_order_acquire);
+    Trace_RingType* ring;
+    uint32_t index;
+
+    if (Trace_ThreadGeneration == generation) {
+        return Trace_ThreadRing;
+    }
+
+    Trace_ThreadGeneration = generation;
+    Trace_ThreadRing = NULL_PTR;
+
+    index = Trace_NumRings.fetch_add(1U);
+    if (index >= TRACE_MAX_THREADS) {
+        return NULL_PTR;
+    }
+
+    ring = &Trace_Rings[index];
+    if (Trace_ThreadName[0] != '\0') {
+        (void)std::memcpy(ring->Name, Trace_ThreadName, sizeof(ring->Name));
+    } else {
+        (void)std::snprintf(ring->Name, sizeof(ring->Name), "thread-%u", index + 1U);
+    }
+    ring->Ready.store(TRUE, std::memory_order_release);
+    Trace_ThreadRing = ring;
+
+    return ring;
+}
+
+/**
+ * @brief Drainer thread: export the rings every TRACE_DRAIN_PERIOD_MS
+ */
+static void Trace_DrainerMain(void) {
+    std::unique_lock<std::mutex> lock(Trace_DrainerMutex);
+
+    while (!Trace_DrainerStopping) {
+        (void)Trace_DrainerWakeup.wait_for(lock, std::chrono::milliseconds(TRACE_DRAIN_PERIOD_MS));
+        lock.unlock();
+        Trace_Drain();
+        lock.lock();
+    }
+}
+
+/**
+ * @brief Export all records written so far
+ */
+static void Trace_Drain(void) {
+    uint32_t numRings = Trace_NumRings.load();
+    uint32_t i;
+    uint32_t tail;
+    uint32_t head;
+    uint64_t exported = 0U;
+
+    numRings = (numRings < TRACE_MAX_THREADS) ? numRings : TRACE_MAX_THREADS;
+
+    for (i = 0U; i < numRings; i++) {
+        Trace_RingType* ring = &Trace_Rings[i];
+
+        if (!ring->Ready.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        if (!Trace_NameWritten[i]) {
+            Trace_BeginEvent();
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,"
+                               "\"args\":{\"name\":\"%s\"}}",
+                               TRACE_PID, i + 1U, ring->Name);
+            Trace_NameWritten[i] = TRUE;
+        }
+
+        tail = ring->Tail.load(std::memory_order_relaxed);
+        head = ring->Head.load(std::memory_order_acquire);
+        while (tail != head) {
+            Trace_WriteRecord(i + 1U, &ring->Records[tail & TRACE_RING_MASK]);
+            tail++;
+            exported++;
+        }
+        ring->Tail.store(tail, std::memory_order_release);
+    }
+
+    (void)std::fflush(Trace_File);
+    Trace_Exported.fetch_add(exported);
+}
+
+/**
+ * @brief Write the separator before an event
+ */
+static void Trace_BeginEvent(void) {
+    if (!Trace_FirstEvent) {
+        (void)std::fprintf(Trace_File, ",\n");
+    }
+    Trace_FirstEvent = FALSE;
+}
+
+/**
+ * @brief Convert one record to a trace event
+ */
+static void Trace_WriteRecord(uint32_t tid, const Trace_RecordType* record) {
+    const double tsUs = static_cast<double>(record->TimeNs) / 1000.0;
+
+    Trace_BeginEvent();
+    switch (record->Kind) {
+        case TRACE_RECORD_RUNNABLE_ENTRY:
+        case TRACE_RECORD_RUNNABLE_EXIT:
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"%s\",\"cat\":\"runnable\",\"ph\":\"%s\",\"ts\":%.3f,"
+                               "\"pid\":%u,\"tid\":%u}",
+                               Trace_Name(Trace_RunnableNames, TRACE_NUM_RUNNABLES, record->Id),
+                               (record->Kind == TRACE_RECORD_RUNNABLE_ENTRY) ? "B" : "E",
+                               tsUs, TRACE_PID, tid);
+            break;
+
+        case TRACE_RECORD_FLM_STATE:
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"FLM %s\",\"cat\":\"flm\",\"ph\":\"i\",\"s\":\"p\","
+                               "\"ts\":%.3f,\"pid\":%u,\"tid\":%u,"
+                               "\"args\":{\"from\":\"%s\",\"to\":\"%s\"}},\n",
+                               TRACE_NAME(Trace_FlmStateNames, record->Arg1), tsUs, TRACE_PID, tid,
+                               TRACE_NAME(Trace_FlmStateNames, record->Arg0),
+                               TRACE_NAME(Trace_FlmStateNames, record->Arg1));
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"FLM state\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":%u,"
+                               "\"args\":{\"state\":%u}}",
+                               tsUs, TRACE_PID, record->Arg1);
+            break;
+
+        case TRACE_RECORD_SAFE_STATE:
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"Safe state\",\"cat\":\"safety\",\"ph\":\"i\",\"s\":\"g\","
+                               "\"ts\":%.3f,\"pid\":%u,\"tid\":%u,\"args\":{\"reason\":\"%s\"}}",
+                               tsUs, TRACE_PID, tid,
+                               TRACE_NAME(Trace_ReasonNames, record->Arg0));
+            break;
+
+        case TRACE_RECORD_E2E_STATUS:
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"E2E %s\",\"cat\":\"e2e\",\"ph\":\"i\",\"s\":\"t\","
+                               "\"ts\":%.3f,\"pid\":%u,\"tid\":%u,"
+                               "\"args\":{\"status\":\"%s\",\"sm\":\"%s\"}}",
+                               TRACE_NAME(Trace_E2EStatusNames, record->Arg0), tsUs, TRACE_PID, tid,
+                               TRACE_NAME(Trace_E2EStatusNames, record->Arg0),
+                               TRACE_NAME(Trace_E2ESmNames, record->Arg1));
+            break;
+
+        case TRACE_RECORD_DEM_EVENT:
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"Dem event %u\",\"cat\":\"dem\",\"ph\":\"i\",\"s\":\"t\","
+                               "\"ts\":%.3f,\"pid\":%u,\"tid\":%u,"
+                               "\"args\":{\"event\":%u,\"status\":\"%s\"}}",
+                               static_cast<uint32_t>(record->Id), tsUs, TRACE_PID, tid,
+                               static_cast<uint32_t>(record->Id),
+                               TRACE_NAME(Trace_DemStatusNames, record->Arg0));
+            break;
+
+        default:
+            (void)std::fprintf(Trace_File,
+                               "{\"name\":\"record %u\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,"
+                               "\"pid\":%u,\"tid\":%u}",
+                               static_cast<uint32_t>(record->Kind), tsUs, TRACE_PID, tid);
+            break;
+    }
+}
+
+/**
+ * @brief Look up a name, "?" if out of range
+ */
+static const char* Trace_Name(const char* const* names, uint32_t count, uint32_t index) {
+    return (index < count) ? names[index] : "?";
+}
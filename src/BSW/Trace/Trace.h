@@ -0,0 +1,177 @@
+/**
+ * @file Trace.h
+ * @brief Runtime Trace Facility
+ * @details Trace points write fixed-size binary records into a lock-free
+ *          single-producer ring of the calling thread. A background drainer
+ *          exports the rings as Chrome trace / Perfetto JSON, so a timeline
+ *          of a safe-state escalation is available without a debugger.
+ *          Producers never block: a full ring drops the record and counts it.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on the function
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Trace_Cfg.h"
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Trace record kinds
+ */
+typedef enum {
+    TRACE_RECORD_RUNNABLE_ENTRY = 0x00U,    /**< Id = runnable */
+    TRACE_RECORD_RUNNABLE_EXIT  = 0x01U,    /**< Id = runnable */
+    TRACE_RECORD_FLM_STATE      = 0x02U,    /**< Arg0 = from, Arg1 = to */
+    TRACE_RECORD_SAFE_STATE     = 0x03U,    /**< Arg0 = SafeStateReason */
+    TRACE_RECORD_E2E_STATUS     = 0x04U,    /**< Arg0 = E2E status, Arg1 = SM state */
+    TRACE_RECORD_DEM_EVENT      = 0x05U     /**< Id = event, Arg0 = event status */
+} Trace_RecordKindType;
+
+/**
+ * @brief Binary trace record
+ */
+typedef struct {
+    uint64_t TimeNs;                    /**< Monotonic timestamp */
+    uint8_t Kind;                       /**< Trace_RecordKindType */
+    uint8_t Id;                         /**< Runnable or event ID */
+    uint16_t Arg0;                      /**< Kind specific */
+    uint32_t Arg1;                      /**< Kind specific */
+} Trace_RecordType;
+
+STD_STATIC_ASSERT(sizeof(Trace_RecordType) == 16U, "Trace record must be 16 bytes");
+
+/**
+ * @brief Trace statistics
+ */
+typedef struct {
+    uint64_t Records;                   /**< Records exported */
+    uint64_t Dropped;                   /**< Records lost to a full ring or no free ring */
+    uint8_t Threads;                    /**< Threads with a ring */
+} Trace_StatisticsType;
+
+/*============================================================================*
+ * TRACE POINTS
+ *============================================================================*/
+
+#if (TRACE_ENABLED == STD_ON)
+
+/** @brief Main function entry */
+#define TRACE_RUNNABLE_ENTRY(runnableId) \
+    Trace_Record(TRACE_RECORD_RUNNABLE_ENTRY, static_cast<uint8_t>(runnableId), 0U, 0U)
+
+/** @brief Main function exit */
+#define TRACE_RUNNABLE_EXIT(runnableId) \
+    Trace_Record(TRACE_RECORD_RUNNABLE_EXIT, static_cast<uint8_t>(runnableId), 0U, 0U)
+
+/** @brief FLM state transition */
+#define TRACE_FLM_STATE(fromState, toState) \
+    Trace_Record(TRACE_RECORD_FLM_STATE, 0U, static_cast<uint16_t>(fromState), \
+                 static_cast<uint32_t>(toState))
+
+/** @brief Safe state requested */
+#define TRACE_SAFE_STATE(reason) \
+    Trace_Record(TRACE_RECORD_SAFE_STATE, 0U, static_cast<uint16_t>(reason), 0U)
+
+/** @brief E2E check status or state machine state changed */
+#define TRACE_E2E_STATUS(status, smState) \
+    Trace_Record(TRACE_RECORD_E2E_STATUS, 0U, static_cast<uint16_t>(status), \
+                 static_cast<uint32_t>(smState))
+
+/** @brief Dem event report */
+#define TRACE_DEM_EVENT(eventId, eventStatus) \
+    Trace_Record(TRACE_RECORD_DEM_EVENT, static_cast<uint8_t>(eventId), \
+                 static_cast<uint16_t>(eventStatus), 0U)
+
+#else
+
+#define TRACE_RUNNABLE_ENTRY(runnableId)        ((void)0)
+#define TRACE_RUNNABLE_EXIT(runnableId)         ((void)0)
+#define TRACE_FLM_STATE(fromState, toState)     ((void)0)
+#define TRACE_SAFE_STATE(reason)                ((void)0)
+#define TRACE_E2E_STATUS(status, smState)       ((void)0)
+#define TRACE_DEM_EVENT(eventId, eventStatus)   ((void)0)
+
+#endif /* TRACE_ENABLED */
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize the trace facility
+ * @details Releases all rings and returns to the monotonic clock. Ignored
+ *          while a trace is running.
+ */
+void Trace_Init(void);
+
+/**
+ * @brief Start tracing into a file
+ * @details Clears the rings and starts the background drainer
+ * @param[in] Path Output file (Chrome trace / Perfetto JSON)
+ * @return E_OK on success, E_NOT_OK if already running or the file cannot
+ *         be created
+ */
+Std_ReturnType Trace_Start(const char* Path);
+
+/**
+ * @brief Stop tracing
+ * @details Stops the drainer, exports the remaining records and completes
+ *          the file
+ */
+void Trace_Stop(void);
+
+/**
+ * @brief Check whether a trace is running
+ * @return TRUE while tracing
+ */
+boolean Trace_IsActive(void);
+
+/**
+ * @brief Name the calling thread in the timeline
+ * @details Takes effect on the first record of the thread after a
+ *          Trace_Start, call it at thread start
+ * @param[in] Name Thread name (truncated to TRACE_THREAD_NAME_LENGTH - 1)
+ */
+void Trace_SetThreadName(const char* Name);
+
+/**
+ * @brief Write a record into the ring of the calling thread
+ * @details Use the TRACE_* trace points instead of calling this directly
+ * @param[in] Kind Trace_RecordKindType
+ * @param[in] Id Runnable or event ID
+ * @param[in] Arg0 Kind specific
+ * @param[in] Arg1 Kind specific
+ */
+void Trace_Record(Trace_RecordKindType Kind, uint8_t Id, uint16_t Arg0, uint32_t Arg1);
+
+/**
+ * @brief Get trace statistics
+ * @param[out] Statistics Pointer to receive statistics
+ * @return E_OK on success, E_NOT_OK on NULL_PTR
+ */
+Std_ReturnType Trace_GetStatistics(Trace_StatisticsType* Statistics);
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS (FOR TESTING)
+ *============================================================================*/
+
+/**
+ * @brief Set simulated trace timestamp
+ * @details Replaces the monotonic clock until the next Trace_Init
+ * @param[in] timeNs Timestamp in nanoseconds
+ */
+void Trace_SimSetTimeNs(uint64_t timeNs);
+
+#endif /* TRACE_H */
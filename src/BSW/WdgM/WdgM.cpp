@@ -14,6 +14,16 @@
  * INCLUDES
  *============================================================================*/
 #include "WdgM.h"
+#include "BSW/Os/Os.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
+#if (WDGM_PROFILER_ENABLED == STD_ON)
+#include "WdgM_Profiler.h"
+#endif
+#if (WDGM_WDG_TRIGGER_ENABLED == STD_ON)
+#include "MCAL/Wdg/Wdg.h"
+#endif
+#include <chrono>
 #include <cstring>
 
 /*============================================================================*
@@ -44,14 +54,32 @@ static boolean WdgM_Expired = FALSE;
 /** @brief System time (ms) */
 static uint32_t WdgM_SystemTime = 0U;
 
+/** @brief Compiled supervision tables, indexed by (SEId - 1) */
+static WdgM_SupervisionTableType WdgM_SupervisionTable[WDGM_MAX_SUPERVISED_ENTITIES];
+
+/** @brief Simulated deadline timestamp (us) */
+static uint32_t WdgM_SimTimeUs = 0U;
+static boolean WdgM_SimTimeEnabled = FALSE;
+
 /*============================================================================*
  * LOCAL FUNCTION PROTOTYPES
  *============================================================================*/
 
 static uint8_t WdgM_GetEntityIndex(WdgM_SupervisedEntityIdType SEId);
-static void WdgM_PerformAliveSupervision(void);
-static void WdgM_UpdateLocalStatus(uint8_t index);
+static WdgM_CheckpointMaskType WdgM_GetCheckpointMask(WdgM_CheckpointIdType CPId);
+static uint32_t WdgM_GetTimeUs(void);
+static void WdgM_BuildSupervisionTable(uint8_t index);
+#if (WDGM_PROFILER_ENABLED == STD_ON)
+static void WdgM_ConfigureProfiler(uint8_t index);
+#endif
+static void WdgM_PerformDeadlineSupervision(uint8_t index, WdgM_CheckpointIdType CPId);
+static void WdgM_PerformLogicalSupervision(uint8_t index, WdgM_CheckpointIdType CPId);
+static boolean WdgM_PerformAliveSupervision(uint8_t index);
+static void WdgM_UpdateLocalStatus(uint8_t index, boolean aliveOk);
 static void WdgM_UpdateGlobalStatus(void);
+#if (WDGM_WDG_TRIGGER_ENABLED == STD_ON)
+static void WdgM_TriggerWatchdog(void);
+#endif
 
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
@@ -70,20 +98,34 @@ void WdgM_Init(const WdgM_ConfigType* ConfigPtr) {
     WdgM_ConfigPtr = ConfigPtr;
 
     /* Initialize entity data */
+    (void)memset(WdgM_EntityData, 0, sizeof(WdgM_EntityData));
+    (void)memset(WdgM_SupervisionTable, 0, sizeof(WdgM_SupervisionTable));
+
     for (i = 0U; i < WDGM_MAX_SUPERVISED_ENTITIES; i++) {
         WdgM_EntityData[i].localStatus = WDGM_LOCAL_STATUS_OK;
-        WdgM_EntityData[i].aliveCounter = 0U;
-        WdgM_EntityData[i].aliveIndicationsInCycle = 0U;
-        WdgM_EntityData[i].lastCheckpointTime = 0U;
-        WdgM_EntityData[i].failedCycleCount = 0U;
         WdgM_EntityData[i].isActive = TRUE;
     }
 
+#if (WDGM_PROFILER_ENABLED == STD_ON)
+    WdgM_Profiler_Init();
+#endif
+
+    /* Compile supervision tables from configuration */
+    for (i = 0U; i < WDGM_NUM_SUPERVISED_ENTITIES; i++) {
+        WdgM_BuildSupervisionTable(i);
+        WdgM_EntityData[i].localStatus =
+            WdgM_SupervisionTable[i].entityConfig->InitialStatus;
+#if (WDGM_PROFILER_ENABLED == STD_ON)
+        WdgM_ConfigureProfiler(i);
+#endif
+    }
+
     WdgM_GlobalStatus = WDGM_GLOBAL_STATUS_OK;
     WdgM_CurrentMode = WDGM_INITIAL_MODE;
     WdgM_SupervisionCycleCounter = 0U;
     WdgM_Expired = FALSE;
     WdgM_SystemTime = 0U;
+    WdgM_SimTimeEnabled = FALSE;
 
     WdgM_Initialized = TRUE;
 }
@@ -102,6 +144,9 @@ void WdgM_DeInit(void) {
  * @brief Main function for WdgM
  */
 void WdgM_MainFunction(void) {
+    uint8_t i;
+    boolean aliveOk;
+
     if (!WdgM_Initialized) {
         return;
     }
@@ -110,6 +155,11 @@ void WdgM_MainFunction(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_WDGM);
+
+    /* Checkpoints of other tasks update the entity data concurrently */
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
+
     /* Update system time */
     WdgM_SystemTime += WDGM_MAIN_FUNCTION_PERIOD_MS;
 
@@ -120,12 +170,29 @@ void WdgM_MainFunction(void) {
     if (WdgM_SupervisionCycleCounter >= WDGM_SUPERVISION_CYCLE_MS) {
         WdgM_SupervisionCycleCounter = 0U;
 
-        /* Perform alive supervision */
-        WdgM_PerformAliveSupervision();
+        for (i = 0U; i < WDGM_NUM_SUPERVISED_ENTITIES; i++) {
+            if (!WdgM_EntityData[i].isActive) {
+                continue;
+            }
+
+            /* Perform alive supervision */
+            aliveOk = WdgM_PerformAliveSupervision(i);
+
+            /* Combine with deadline and logical results of this cycle */
+            WdgM_UpdateLocalStatus(i, aliveOk);
+        }
     }
 
     /* Update global status */
     WdgM_UpdateGlobalStatus();
+
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+
+#if (WDGM_WDG_TRIGGER_ENABLED == STD_ON)
+    WdgM_TriggerWatchdog();
+#endif
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_WDGM);
 }
 
 /**
@@ -139,6 +206,130 @@ static uint8_t WdgM_GetEntityIndex(WdgM_SupervisedEntityIdType SEId) {
     return 0xFFU;  /* Invalid */
 }
 
+/**
+ * @brief Get checkpoint bit from ID
+ */
+static WdgM_CheckpointMaskType WdgM_GetCheckpointMask(WdgM_CheckpointIdType CPId) {
+    /* Checkpoint IDs 1..WDGM_MAX_CHECKPOINTS_PER_SE map to bits 0..n-1 */
+    if ((CPId >= 1U) && (CPId <= WDGM_MAX_CHECKPOINTS_PER_SE)) {
+        return static_cast<WdgM_CheckpointMaskType>(1U << (CPId - 1U));
+    }
+    return 0U;  /* Invalid */
+}
+
+/**
+ * @brief Get timestamp for deadline supervision
+ * @return Monotonic time in microseconds (wrapping)
+ */
+static uint32_t WdgM_GetTimeUs(void) {
+    if (WdgM_SimTimeEnabled) {
+        return WdgM_SimTimeUs;
+    }
+
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Compile supervision table for one entity
+ * @details Resolves the configuration entries of the entity and converts
+ *          the logical supervision transition list into successor bitsets
+ */
+static void WdgM_BuildSupervisionTable(uint8_t index) {
+    WdgM_SupervisionTableType* table = &WdgM_SupervisionTable[index];
+    const WdgM_SupervisedEntityConfigType* entityConfig = &WdgM_SEConfig[index];
+    const WdgM_LogicalSupervisionConfigType* logical;
+    WdgM_CheckpointMaskType sourceMask;
+    WdgM_CheckpointMaskType destMask;
+    uint8_t i;
+    uint8_t t;
+
+    table->entityConfig = entityConfig;
+
+    /* Alive supervision */
+    if (entityConfig->AliveSupervisionEnabled) {
+        for (i = 0U; i < WDGM_NUM_SUPERVISED_ENTITIES; i++) {
+            if (WdgM_AliveConfig[i].SEId == entityConfig->SEId) {
+                table->aliveConfig = &WdgM_AliveConfig[i];
+                table->validCheckpoints |=
+                    WdgM_GetCheckpointMask(WdgM_AliveConfig[i].CheckpointId);
+            }
+        }
+    }
+
+    /* Deadline supervision (one checkpoint pair per entity) */
+    if (entityConfig->DeadlineSupervisionEnabled) {
+        for (i = 0U; i < WDGM_NUM_DEADLINE_SUPERVISIONS; i++) {
+            if (WdgM_DeadlineConfig[i].SEId == entityConfig->SEId) {
+                table->deadlineConfig = &WdgM_DeadlineConfig[i];
+                table->validCheckpoints |=
+                    WdgM_GetCheckpointMask(WdgM_DeadlineConfig[i].StartCP);
+                table->validCheckpoints |=
+                    WdgM_GetCheckpointMask(WdgM_DeadlineConfig[i].StopCP);
+            }
+        }
+    }
+
+    /* Logical supervision: transition list -> successor bitsets */
+    if (entityConfig->LogicalSupervisionEnabled) {
+        for (i = 0U; i < WDGM_NUM_LOGICAL_SUPERVISIONS; i++) {
+            logical = &WdgM_LogicalConfig[i];
+            if (logical->SEId != entityConfig->SEId) {
+                continue;
+            }
+
+            table->initialCheckpoints |= WdgM_GetCheckpointMask(logical->InitialCP);
+            table->finalCheckpoints |= WdgM_GetCheckpointMask(logical->FinalCP);
+
+            for (t = 0U; t < logical->NumTransitions; t++) {
+                sourceMask = WdgM_GetCheckpointMask(logical->Transitions[t].SourceCP);
+                destMask = WdgM_GetCheckpointMask(logical->Transitions[t].DestCP);
+
+                if ((sourceMask != 0U) && (destMask != 0U)) {
+                    table->successors[logical->Transitions[t].SourceCP - 1U] |= destMask;
+                    table->validCheckpoints |= static_cast<WdgM_CheckpointMaskType>(
+                        sourceMask | destMask);
+                }
+            }
+
+            table->validCheckpoints |= static_cast<WdgM_CheckpointMaskType>(
+                table->initialCheckpoints | table->finalCheckpoints);
+        }
+    }
+}
+
+#if (WDGM_PROFILER_ENABLED == STD_ON)
+/**
+ * @brief Configure profiler for one entity
+ * @details Period is derived from the alive supervision table, the budget
+ *          is the deadline maximum (or the period if no deadline is set)
+ */
+static void WdgM_ConfigureProfiler(uint8_t index) {
+    const WdgM_SupervisionTableType* table = &WdgM_SupervisionTable[index];
+    uint32_t periodNs = 0U;
+    uint32_t budgetNs;
+
+    if ((table->aliveConfig != NULL_PTR) &&
+        (table->aliveConfig->ExpectedAliveIndications > 0U)) {
+        periodNs = static_cast<uint32_t>(
+            (static_cast<uint64_t>(WDGM_SUPERVISION_CYCLE_MS) * 1000000U *
+             table->aliveConfig->SupervisionReferenceCycle) /
+            table->aliveConfig->ExpectedAliveIndications);
+    }
+
+    if (table->deadlineConfig != NULL_PTR) {
+        budgetNs = table->deadlineConfig->DeadlineMax_us * 1000U;
+    } else {
+        budgetNs = periodNs;
+    }
+
+    WdgM_Profiler_ConfigureRunnable(index, table->entityConfig->Name, periodNs, budgetNs);
+}
+#endif
+
 /**
  * @brief Report checkpoint reached
  */
@@ -147,8 +338,7 @@ Std_ReturnType WdgM_CheckpointReached(
     WdgM_CheckpointIdType CPId
 ) {
     uint8_t index;
-
-    STD_UNUSED(CPId);
+    const WdgM_SupervisionTableType* table;
 
     if (!WdgM_Initialized) {
         return E_NOT_OK;
@@ -159,13 +349,107 @@ Std_ReturnType WdgM_CheckpointReached(
         return E_NOT_OK;
     }
 
+    table = &WdgM_SupervisionTable[index];
+    if ((table->validCheckpoints & WdgM_GetCheckpointMask(CPId)) == 0U) {
+        return E_NOT_OK;
+    }
+
+#if (WDGM_PROFILER_ENABLED == STD_ON)
+    /* Stop execution time measurement before supervision overhead */
+    if ((table->finalCheckpoints & WdgM_GetCheckpointMask(CPId)) != 0U) {
+        WdgM_Profiler_RunnableExit(index);
+    }
+#endif
+
+    /* Entity data is shared with WdgM_MainFunction in another task */
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
+
     /* Update alive indication */
-    WdgM_EntityData[index].aliveIndicationsInCycle++;
+    if ((table->aliveConfig != NULL_PTR) &&
+        (table->aliveConfig->CheckpointId == CPId)) {
+        WdgM_EntityData[index].aliveIndicationsInCycle++;
+    }
     WdgM_EntityData[index].lastCheckpointTime = WdgM_SystemTime;
 
+    /* Deadline supervision */
+    if (table->deadlineConfig != NULL_PTR) {
+        WdgM_PerformDeadlineSupervision(index, CPId);
+    }
+
+    /* Logical supervision */
+    if (table->initialCheckpoints != 0U) {
+        WdgM_PerformLogicalSupervision(index, CPId);
+    }
+
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+
+#if (WDGM_PROFILER_ENABLED == STD_ON)
+    /* Start execution time measurement after supervision overhead */
+    if ((table->initialCheckpoints & WdgM_GetCheckpointMask(CPId)) != 0U) {
+        WdgM_Profiler_RunnableEntry(index);
+    }
+#endif
+
     return E_OK;
 }
 
+/**
+ * @brief Perform deadline supervision for a reached checkpoint
+ * @details Measures the time between start and stop checkpoint and
+ *          latches a violation for the current supervision cycle
+ */
+static void WdgM_PerformDeadlineSupervision(uint8_t index, WdgM_CheckpointIdType CPId) {
+    const WdgM_DeadlineSupervisionConfigType* deadline =
+        WdgM_SupervisionTable[index].deadlineConfig;
+    WdgM_SupervisedEntityRuntimeType* entity = &WdgM_EntityData[index];
+    uint32_t elapsedUs;
+
+    if (CPId == deadline->StartCP) {
+        entity->deadlineStartTimeUs = WdgM_GetTimeUs();
+        entity->deadlineActive = TRUE;
+    } else if ((CPId == deadline->StopCP) && entity->deadlineActive) {
+        elapsedUs = WdgM_GetTimeUs() - entity->deadlineStartTimeUs;
+        entity->deadlineActive = FALSE;
+
+        if ((elapsedUs < deadline->DeadlineMin_us) ||
+            (elapsedUs > deadline->DeadlineMax_us)) {
+            entity->deadlineFailed = TRUE;
+        }
+    } else {
+        /* Checkpoint not part of the deadline pair */
+    }
+}
+
+/**
+ * @brief Perform logical supervision for a reached checkpoint
+ * @details O(1) transition check against the successor bitset of the
+ *          previously reached checkpoint
+ */
+static void WdgM_PerformLogicalSupervision(uint8_t index, WdgM_CheckpointIdType CPId) {
+    const WdgM_SupervisionTableType* table = &WdgM_SupervisionTable[index];
+    WdgM_SupervisedEntityRuntimeType* entity = &WdgM_EntityData[index];
+    WdgM_CheckpointMaskType cpMask = WdgM_GetCheckpointMask(CPId);
+    boolean transitionValid;
+
+    if (!entity->logicalActive) {
+        /* Graph must be entered through an initial checkpoint */
+        transitionValid = ((table->initialCheckpoints & cpMask) != 0U);
+    } else {
+        transitionValid =
+            ((table->successors[entity->lastCheckpoint - 1U] & cpMask) != 0U);
+    }
+
+    if (transitionValid) {
+        entity->lastCheckpoint = CPId;
+        /* Graph is left through a final checkpoint */
+        entity->logicalActive = ((table->finalCheckpoints & cpMask) == 0U);
+    } else {
+        /* Resynchronize at the next initial checkpoint */
+        entity->logicalFailed = TRUE;
+        entity->logicalActive = FALSE;
+    }
+}
+
 /**
  * @brief Update alive counter
  */
@@ -181,85 +465,80 @@ Std_ReturnType WdgM_UpdateAliveCounter(WdgM_SupervisedEntityIdType SEId) {
         return E_NOT_OK;
     }
 
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
     WdgM_EntityData[index].aliveCounter++;
     WdgM_EntityData[index].aliveIndicationsInCycle++;
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
 
     return E_OK;
 }
 
 /**
  * @brief Perform alive supervision
+ * @return TRUE if alive indications are within the configured margins
  */
-static void WdgM_PerformAliveSupervision(void) {
-    uint8_t i;
-    uint16_t expectedIndications;
-    uint16_t actualIndications;
-    int16_t margin;
+static boolean WdgM_PerformAliveSupervision(uint8_t index) {
+    const WdgM_AliveSupervisionConfigType* alive = WdgM_SupervisionTable[index].aliveConfig;
+    WdgM_SupervisedEntityRuntimeType* entity = &WdgM_EntityData[index];
+    int32_t margin;
 
-    for (i = 0U; i < WDGM_NUM_SUPERVISED_ENTITIES; i++) {
-        if (!WdgM_EntityData[i].isActive) {
-            continue;
-        }
-
-        actualIndications = WdgM_EntityData[i].aliveIndicationsInCycle;
-
-        /* Get expected indications based on entity */
-        switch (i) {
-            case 0:  /* SwitchEvent */
-                expectedIndications = WDGM_SWITCHEVENT_EXPECTED_ALIVE;
-                break;
-            case 1:  /* LightRequest */
-                expectedIndications = WDGM_LIGHTREQUEST_EXPECTED_ALIVE;
-                break;
-            case 2:  /* FLM */
-                expectedIndications = WDGM_FLM_EXPECTED_ALIVE;
-                break;
-            case 3:  /* Headlight */
-                expectedIndications = WDGM_HEADLIGHT_EXPECTED_ALIVE;
-                break;
-            case 4:  /* SafetyMonitor */
-                expectedIndications = WDGM_SAFETYMONITOR_EXPECTED_ALIVE;
-                break;
-            default:
-                expectedIndications = 10U;
-                break;
-        }
+    if (alive == NULL_PTR) {
+        return TRUE;
+    }
 
-        /* Calculate margin */
-        margin = static_cast<int16_t>(actualIndications) -
-                 static_cast<int16_t>(expectedIndications);
+    /* Evaluate once per configured number of supervision cycles */
+    entity->aliveReferenceCycles++;
+    if (entity->aliveReferenceCycles < alive->SupervisionReferenceCycle) {
+        return TRUE;
+    }
+    entity->aliveReferenceCycles = 0U;
 
-        /* Check if within tolerance */
-        if ((margin < -static_cast<int16_t>(WDGM_DEFAULT_MIN_MARGIN)) ||
-            (margin > static_cast<int16_t>(WDGM_DEFAULT_MAX_MARGIN))) {
-            /* Alive supervision failed */
-            WdgM_EntityData[i].failedCycleCount++;
+    /* Calculate margin */
+    margin = static_cast<int32_t>(entity->aliveIndicationsInCycle) -
+             static_cast<int32_t>(alive->ExpectedAliveIndications);
 
-            if (WdgM_EntityData[i].failedCycleCount >= WDGM_FAILED_REFERENCE_CYCLES) {
-                WdgM_EntityData[i].localStatus = WDGM_LOCAL_STATUS_EXPIRED;
-            } else {
-                WdgM_EntityData[i].localStatus = WDGM_LOCAL_STATUS_FAILED;
-            }
-        } else {
-            /* Alive supervision passed */
-            WdgM_EntityData[i].failedCycleCount = 0U;
-            WdgM_EntityData[i].localStatus = WDGM_LOCAL_STATUS_OK;
-        }
+    /* Reset indication counter for next cycle */
+    entity->aliveIndicationsInCycle = 0U;
 
-        /* Reset indication counter for next cycle */
-        WdgM_EntityData[i].aliveIndicationsInCycle = 0U;
-    }
+    /* Check if within tolerance */
+    return ((margin >= -static_cast<int32_t>(alive->MinMargin)) &&
+            (margin <= static_cast<int32_t>(alive->MaxMargin)));
 }
 
 /**
  * @brief Update local status for entity
+ * @details Combines alive, deadline and logical results of the supervision
+ *          cycle. EXPIRED is kept until WdgM is re-initialized.
  */
-static void WdgM_UpdateLocalStatus(uint8_t index) {
-    if (index >= WDGM_MAX_SUPERVISED_ENTITIES) {
+static void WdgM_UpdateLocalStatus(uint8_t index, boolean aliveOk) {
+    WdgM_SupervisedEntityRuntimeType* entity = &WdgM_EntityData[index];
+    boolean supervisionOk;
+
+    supervisionOk = aliveOk && !entity->deadlineFailed && !entity->logicalFailed;
+
+    entity->deadlineFailed = FALSE;
+    entity->logicalFailed = FALSE;
+
+    if (entity->localStatus == WDGM_LOCAL_STATUS_EXPIRED) {
         return;
     }
 
-    /* Already updated in supervision functions */
+    if (!supervisionOk) {
+        Metrics_Increment(METRICS_WDGM_FAILED(index));
+        if (entity->failedCycleCount < STD_UINT8_MAX) {
+            entity->failedCycleCount++;
+        }
+
+        if (entity->failedCycleCount >=
+            WdgM_SupervisionTable[index].entityConfig->FailedRefCycleCounter) {
+            entity->localStatus = WDGM_LOCAL_STATUS_EXPIRED;
+        } else {
+            entity->localStatus = WDGM_LOCAL_STATUS_FAILED;
+        }
+    } else {
+        entity->failedCycleCount = 0U;
+        entity->localStatus = WDGM_LOCAL_STATUS_OK;
+    }
 }
 
 /**
@@ -294,6 +573,28 @@ static void WdgM_UpdateGlobalStatus(void) {
     }
 }
 
+#if (WDGM_WDG_TRIGGER_ENABLED == STD_ON)
+/**
+ * @brief Trigger the watchdog driver according to the global status
+ * @details Triggering stops once supervision expired, so the watchdog fires
+ *          after WDGM_WDG_TRIGGER_TIMEOUT_MS (or at once with immediate reset)
+ */
+static void WdgM_TriggerWatchdog(void) {
+    if ((WdgM_GlobalStatus == WDGM_GLOBAL_STATUS_OK) ||
+        (WdgM_GlobalStatus == WDGM_GLOBAL_STATUS_FAILED)) {
+        Wdg_SetTriggerCondition(WDGM_WDG_TRIGGER_TIMEOUT_MS);
+    }
+#if (WDGM_IMMEDIATE_RESET == STD_ON)
+    else if (WdgM_GlobalStatus == WDGM_GLOBAL_STATUS_EXPIRED) {
+        Wdg_SetTriggerCondition(0U);
+    }
+#endif
+    else {
+        /* Stop triggering: let the watchdog run out */
+    }
+}
+#endif
+
 /**
  * @brief Get global supervision status
  */
@@ -385,7 +686,55 @@ void WdgM_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
  * @brief Perform reset (for testing)
  */
 void WdgM_PerformReset(void) {
-    /* In real system, would trigger MCU reset */
     WdgM_Expired = FALSE;
     WdgM_GlobalStatus = WDGM_GLOBAL_STATUS_STOPPED;
+
+#if (WDGM_WDG_TRIGGER_ENABLED == STD_ON)
+    /* Timeout 0: watchdog resets as fast as possible */
+    Wdg_SetTriggerCondition(0U);
+#endif
+}
+
+/**
+ * @brief Save supervision state
+ */
+void WdgM_SaveSnapshot(WdgM_SnapshotType* Snapshot) {
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
+    Snapshot->CurrentMode = WdgM_CurrentMode;
+    Snapshot->GlobalStatus = WdgM_GlobalStatus;
+    (void)memcpy(Snapshot->EntityData, WdgM_EntityData, sizeof(WdgM_EntityData));
+    Snapshot->SupervisionCycleCounter = WdgM_SupervisionCycleCounter;
+    Snapshot->Expired = WdgM_Expired;
+    Snapshot->SystemTime = WdgM_SystemTime;
+    Snapshot->SimTimeUs = WdgM_SimTimeUs;
+    Snapshot->SimTimeEnabled = WdgM_SimTimeEnabled;
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+}
+
+/**
+ * @brief Restore supervision state
+ */
+void WdgM_RestoreSnapshot(const WdgM_SnapshotType* Snapshot) {
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
+    WdgM_CurrentMode = Snapshot->CurrentMode;
+    WdgM_GlobalStatus = Snapshot->GlobalStatus;
+    (void)memcpy(WdgM_EntityData, Snapshot->EntityData, sizeof(WdgM_EntityData));
+    WdgM_SupervisionCycleCounter = Snapshot->SupervisionCycleCounter;
+    WdgM_Expired = Snapshot->Expired;
+    WdgM_SystemTime = Snapshot->SystemTime;
+    WdgM_SimTimeUs = Snapshot->SimTimeUs;
+    WdgM_SimTimeEnabled = Snapshot->SimTimeEnabled;
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+}
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS
+ *============================================================================*/
+
+/**
+ * @brief Set simulated timestamp for deadline supervision
+ */
+void WdgM_SimSetTimeUs(uint32_t timeUs) {
+    WdgM_SimTimeUs = timeUs;
+    WdgM_SimTimeEnabled = TRUE;
 }
@@ -24,6 +24,15 @@
  * TYPE DEFINITIONS
  *============================================================================*/
 
+/**
+ * @brief Checkpoint bitset type
+ * @details Bit (CPId - 1) represents checkpoint CPId of a supervised entity
+ */
+typedef uint8_t WdgM_CheckpointMaskType;
+
+STD_STATIC_ASSERT(WDGM_MAX_CHECKPOINTS_PER_SE <= 8U,
+                  "WdgM_CheckpointMaskType too small for checkpoint count");
+
 /**
  * @brief Supervised entity runtime data
  */
@@ -31,11 +40,38 @@ typedef struct {
     WdgM_LocalStatusType localStatus;
     uint16_t aliveCounter;
     uint16_t aliveIndicationsInCycle;
+    uint16_t aliveReferenceCycles;
     uint32_t lastCheckpointTime;
     uint8_t failedCycleCount;
     boolean isActive;
+
+    /* Deadline supervision */
+    uint32_t deadlineStartTimeUs;
+    boolean deadlineActive;
+    boolean deadlineFailed;
+
+    /* Logical supervision */
+    WdgM_CheckpointIdType lastCheckpoint;
+    boolean logicalActive;
+    boolean logicalFailed;
 } WdgM_SupervisedEntityRuntimeType;
 
+/**
+ * @brief Compiled supervision table for one supervised entity
+ * @details Built from WdgM_Cfg tables in WdgM_Init. Logical supervision
+ *          transitions are stored as successor bitsets so a checkpoint
+ *          transition is validated with a single mask test.
+ */
+typedef struct {
+    const WdgM_SupervisedEntityConfigType* entityConfig;
+    const WdgM_AliveSupervisionConfigType* aliveConfig;         /**< NULL_PTR if disabled */
+    const WdgM_DeadlineSupervisionConfigType* deadlineConfig;   /**< NULL_PTR if disabled */
+    WdgM_CheckpointMaskType validCheckpoints;
+    WdgM_CheckpointMaskType initialCheckpoints;                 /**< 0 if logical disabled */
+    WdgM_CheckpointMaskType finalCheckpoints;
+    WdgM_CheckpointMaskType successors[WDGM_MAX_CHECKPOINTS_PER_SE];
+} WdgM_SupervisionTableType;
+
 /**
  * @brief WdgM configuration type
  */
@@ -45,6 +81,22 @@ typedef struct {
     uint8_t failedRefCycles;
 } WdgM_ConfigType;
 
+/**
+ * @brief WdgM snapshot (Ecu_SaveSnapshot)
+ * @details The compiled supervision tables are derived from the
+ *          configuration by WdgM_Init and not part of it
+ */
+typedef struct {
+    WdgM_ModeType CurrentMode;
+    WdgM_GlobalStatusType GlobalStatus;
+    WdgM_SupervisedEntityRuntimeType EntityData[WDGM_MAX_SUPERVISED_ENTITIES];
+    uint32_t SupervisionCycleCounter;
+    boolean Expired;
+    uint32_t SystemTime;
+    uint32_t SimTimeUs;
+    boolean SimTimeEnabled;
+} WdgM_SnapshotType;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
@@ -124,8 +176,33 @@ Std_ReturnType WdgM_GetMode(WdgM_ModeType* Mode);
 void WdgM_GetVersionInfo(Std_VersionInfoType* VersionInfo);
 
 /**
- * @brief Perform reset (for testing)
+ * @brief Perform reset
+ * @details Requests an immediate reset from the watchdog driver
  */
 void WdgM_PerformReset(void);
 
+/**
+ * @brief Save supervision state (Ecu_SaveSnapshot)
+ * @param[out] Snapshot Supervision state
+ */
+void WdgM_SaveSnapshot(WdgM_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore supervision state (Ecu_RestoreSnapshot)
+ * @details WdgM must be initialized with the configuration of the snapshot
+ * @param[in] Snapshot Supervision state
+ */
+void WdgM_RestoreSnapshot(const WdgM_SnapshotType* Snapshot);
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS (FOR TESTING)
+ *============================================================================*/
+
+/**
+ * @brief Set simulated timestamp for deadline supervision
+ * @details Replaces the monotonic clock until the next WdgM_Init
+ * @param[in] timeUs Timestamp in microseconds
+ */
+void WdgM_SimSetTimeUs(uint32_t timeUs);
+
 #endif /* WDGM_H */
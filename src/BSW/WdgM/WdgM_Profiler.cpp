@@ -0,0 +1,482 @@
+/**
+ * @file WdgM_Profiler.cpp
+ * @brief Runnable Execution Time and Jitter Profiler Implementation
+ * @details HDR histograms with 32 sub-buckets per power of two: values below
+ *          32ns are exact, above that the relative bucket width is <= 1/16.
+ *          Recording is a clock read, a bit scan and a counter increment.
+ *          Histograms are updated and read under OS_SPINLOCK_WDGM, the clock
+ *          is read outside of it.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on supervision
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "WdgM_Profiler.h"
+#include "BSW/Os/Os.h"
+#include <chrono>
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Per-runnable profiler data
+ */
+typedef struct {
+    const char* name;
+    uint32_t periodNs;
+    uint32_t budgetNs;
+    uint64_t entryTimeNs;
+    uint64_t lastEntryTimeNs;
+    boolean entryValid;
+    boolean lastEntryValid;
+    WdgM_ProfilerHistogramType executionTime;
+    WdgM_ProfilerHistogramType activationJitter;
+} WdgM_ProfilerRunnableType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Profiler data, indexed by (SEId - 1) */
+static WdgM_ProfilerRunnableType WdgM_ProfilerData[WDGM_MAX_SUPERVISED_ENTITIES];
+
+/** @brief Simulated timestamp (ns) */
+static uint64_t WdgM_ProfilerSimTimeNs = 0U;
+static boolean WdgM_ProfilerSimTimeEnabled = FALSE;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static uint64_t WdgM_Profiler_GetTimeNs(void);
+static uint8_t WdgM_Profiler_MostSignificantBit(uint32_t value);
+static uint16_t WdgM_Profiler_GetBucketIndex(uint32_t valueNs);
+static uint32_t WdgM_Profiler_GetBucketUpperBound(uint16_t index);
+static void WdgM_Profiler_ClearHistogram(WdgM_ProfilerHistogramType* histogram);
+static void WdgM_Profiler_Record(WdgM_ProfilerHistogramType* histogram, uint64_t valueNs);
+static void WdgM_Profiler_Summarize(
+    const WdgM_ProfilerHistogramType* histogram,
+    WdgM_ProfilerSummaryType* summary
+);
+static void WdgM_Profiler_ExportBuckets(
+    FILE* stream,
+    const char* name,
+    const char* kind,
+    const WdgM_ProfilerHistogramType* histogram
+);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize profiler
+ */
+void WdgM_Profiler_Init(void) {
+    uint8_t i;
+
+    (void)memset(WdgM_ProfilerData, 0, sizeof(WdgM_ProfilerData));
+
+    for (i = 0U; i < WDGM_MAX_SUPERVISED_ENTITIES; i++) {
+        WdgM_Profiler_ClearHistogram(&WdgM_ProfilerData[i].executionTime);
+        WdgM_Profiler_ClearHistogram(&WdgM_ProfilerData[i].activationJitter);
+    }
+
+    WdgM_ProfilerSimTimeEnabled = FALSE;
+}
+
+/**
+ * @brief Configure one profiled runnable
+ */
+void WdgM_Profiler_ConfigureRunnable(
+    uint8_t entityIndex,
+    const char* name,
+    uint32_t periodNs,
+    uint32_t budgetNs
+) {
+    if (entityIndex >= WDGM_MAX_SUPERVISED_ENTITIES) {
+        return;
+    }
+
+    WdgM_ProfilerData[entityIndex].name = name;
+    WdgM_ProfilerData[entityIndex].periodNs = periodNs;
+    WdgM_ProfilerData[entityIndex].budgetNs = budgetNs;
+}
+
+/**
+ * @brief Record runnable entry checkpoint
+ */
+void WdgM_Profiler_RunnableEntry(uint8_t entityIndex) {
+    WdgM_ProfilerRunnableType* runnable;
+    uint64_t nowNs;
+    uint64_t intervalNs;
+    uint64_t jitterNs;
+
+    if (entityIndex >= WDGM_MAX_SUPERVISED_ENTITIES) {
+        return;
+    }
+
+    runnable = &WdgM_ProfilerData[entityIndex];
+    nowNs = WdgM_Profiler_GetTimeNs();
+
+    /* Statistics are read by the exporting thread */
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
+
+    /* Activation jitter against the nominal period */
+    if (runnable->lastEntryValid && (runnable->periodNs > 0U)) {
+        intervalNs = nowNs - runnable->lastEntryTimeNs;
+        jitterNs = (intervalNs >= runnable->periodNs) ?
+                   (intervalNs - runnable->periodNs) :
+                   (runnable->periodNs - intervalNs);
+        WdgM_Profiler_Record(&runnable->activationJitter, jitterNs);
+    }
+
+    runnable->lastEntryTimeNs = nowNs;
+    runnable->lastEntryValid = TRUE;
+    runnable->entryTimeNs = nowNs;
+    runnable->entryValid = TRUE;
+
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+}
+
+/**
+ * @brief Record runnable exit checkpoint
+ */
+void WdgM_Profiler_RunnableExit(uint8_t entityIndex) {
+    WdgM_ProfilerRunnableType* runnable;
+    uint64_t nowNs;
+
+    if (entityIndex >= WDGM_MAX_SUPERVISED_ENTITIES) {
+        return;
+    }
+
+    runnable = &WdgM_ProfilerData[entityIndex];
+    nowNs = WdgM_Profiler_GetTimeNs();
+
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
+
+    /* Exit without matching entry is ignored */
+    if (runnable->entryValid) {
+        WdgM_Profiler_Record(&runnable->executionTime, nowNs - runnable->entryTimeNs);
+        runnable->entryValid = FALSE;
+    }
+
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+}
+
+/**
+ * @brief Get profiling statistics for a runnable
+ */
+Std_ReturnType WdgM_Profiler_GetStatistics(
+    WdgM_SupervisedEntityIdType SEId,
+    WdgM_ProfilerStatisticsType* Statistics
+) {
+    const WdgM_ProfilerRunnableType* runnable;
+    WdgM_ProfilerHistogramType executionTime;
+    WdgM_ProfilerHistogramType activationJitter;
+
+    if ((Statistics == NULL_PTR) || (SEId < 1U) ||
+        (SEId > WDGM_MAX_SUPERVISED_ENTITIES)) {
+        return E_NOT_OK;
+    }
+
+    runnable = &WdgM_ProfilerData[SEId - 1U];
+    if (runnable->name == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    /* Consistent copy while the tasks keep recording */
+    Os_GetSpinlock(OS_SPINLOCK_WDGM);
+    executionTime = runnable->executionTime;
+    activationJitter = runnable->activationJitter;
+    Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+
+    WdgM_Profiler_Summarize(&executionTime, &Statistics->executionTime);
+    WdgM_Profiler_Summarize(&activationJitter, &Statistics->activationJitter);
+    Statistics->periodNs = runnable->periodNs;
+    Statistics->budgetNs = runnable->budgetNs;
+    Statistics->headroomNs = static_cast<int64_t>(runnable->budgetNs) -
+                             static_cast<int64_t>(executionTime.maxNs);
+
+    return E_OK;
+}
+
+/**
+ * @brief Get raw execution time histogram of a runnable
+ */
+const WdgM_ProfilerHistogramType* WdgM_Profiler_GetExecutionHistogram(
+    WdgM_SupervisedEntityIdType SEId
+) {
+    if ((SEId < 1U) || (SEId > WDGM_MAX_SUPERVISED_ENTITIES) ||
+        (WdgM_ProfilerData[SEId - 1U].name == NULL_PTR)) {
+        return NULL_PTR;
+    }
+
+    return &WdgM_ProfilerData[SEId - 1U].executionTime;
+}
+
+/**
+ * @brief Get value at a percentile of a histogram
+ */
+uint32_t WdgM_Profiler_GetPercentile(
+    const WdgM_ProfilerHistogramType* histogram,
+    uint16_t permille
+) {
+    uint64_t target;
+    uint64_t cumulative = 0U;
+    uint16_t i;
+
+    if ((histogram == NULL_PTR) || (histogram->totalCount == 0U)) {
+        return 0U;
+    }
+
+    if (permille > 1000U) {
+        permille = 1000U;
+    }
+
+    /* Rank of the percentile sample (at least the first sample) */
+    target = ((static_cast<uint64_t>(histogram->totalCount) * permille) + 999U) / 1000U;
+    if (target == 0U) {
+        target = 1U;
+    }
+
+    for (i = 0U; i < WDGM_PROFILER_NUM_BUCKETS; i++) {
+        cumulative += histogram->counts[i];
+        if (cumulative >= target) {
+            /* Bucket bound, but never above the exact maximum */
+            uint32_t upper = WdgM_Profiler_GetBucketUpperBound(i);
+            return (upper < histogram->maxNs) ? upper : histogram->maxNs;
+        }
+    }
+
+    return histogram->maxNs;
+}
+
+/**
+ * @brief Write profiling report
+ */
+void WdgM_Profiler_Export(FILE* stream, boolean includeBuckets) {
+    WdgM_ProfilerStatisticsType stats;
+    WdgM_ProfilerHistogramType executionTime;
+    WdgM_ProfilerHistogramType activationJitter;
+    uint8_t i;
+
+    if (stream == NULL_PTR) {
+        return;
+    }
+
+    (void)fprintf(stream, "=== Runnable profile (us) ===\n");
+    (void)fprintf(stream,
+        "%-14s %8s %9s %9s %9s %9s %9s %9s %10s %9s %9s\n",
+        "runnable", "count", "exec_min", "exec_p50", "exec_p99", "exec_p999",
+        "exec_max", "budget", "headroom", "jit_p99", "jit_max");
+
+    for (i = 0U; i < WDGM_MAX_SUPERVISED_ENTITIES; i++) {
+        if (WdgM_Profiler_GetStatistics(static_cast<WdgM_SupervisedEntityIdType>(i + 1U),
+                                        &stats) != E_OK) {
+            continue;
+        }
+
+        (void)fprintf(stream,
+            "%-14s %8u %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %10.1f %9.1f %9.1f\n",
+            WdgM_ProfilerData[i].name,
+            static_cast<unsigned int>(stats.executionTime.count),
+            static_cast<double>(stats.executionTime.minNs) / 1000.0,
+            static_cast<double>(stats.executionTime.p50Ns) / 1000.0,
+            static_cast<double>(stats.executionTime.p99Ns) / 1000.0,
+            static_cast<double>(stats.executionTime.p999Ns) / 1000.0,
+            static_cast<double>(stats.executionTime.maxNs) / 1000.0,
+            static_cast<double>(stats.budgetNs) / 1000.0,
+            static_cast<double>(stats.headroomNs) / 1000.0,
+            static_cast<double>(stats.activationJitter.p99Ns) / 1000.0,
+            static_cast<double>(stats.activationJitter.maxNs) / 1000.0);
+    }
+
+    if (includeBuckets) {
+        (void)fprintf(stream, "runnable,kind,upper_ns,count\n");
+        for (i = 0U; i < WDGM_MAX_SUPERVISED_ENTITIES; i++) {
+            if (WdgM_ProfilerData[i].name == NULL_PTR) {
+                continue;
+            }
+            Os_GetSpinlock(OS_SPINLOCK_WDGM);
+            executionTime = WdgM_ProfilerData[i].executionTime;
+            activationJitter = WdgM_ProfilerData[i].activationJitter;
+            Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+
+            WdgM_Profiler_ExportBuckets(stream, WdgM_ProfilerData[i].name, "exec",
+                                        &executionTime);
+            WdgM_Profiler_ExportBuckets(stream, WdgM_ProfilerData[i].name, "jitter",
+                                        &activationJitter);
+        }
+    }
+
+    (void)fflush(stream);
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get profiler timestamp
+ * @return Monotonic time in nanoseconds (clock_gettime(CLOCK_MONOTONIC) on Linux)
+ */
+static uint64_t WdgM_Profiler_GetTimeNs(void) {
+    if (WdgM_ProfilerSimTimeEnabled) {
+        return WdgM_ProfilerSimTimeNs;
+    }
+
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Get position of the most significant set bit
+ * @param[in] value Non-zero value
+ */
+static uint8_t WdgM_Profiler_MostSignificantBit(uint32_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint8_t>(31U - static_cast<uint32_t>(__builtin_clz(value)));
+#else
+    uint8_t msb = 0U;
+    while (value > 1U) {
+        value >>= 1U;
+        msb++;
+    }
+    return msb;
+#endif
+}
+
+/**
+ * @brief Map value to histogram bucket index
+ */
+static uint16_t WdgM_Profiler_GetBucketIndex(uint32_t valueNs) {
+    uint8_t bucket;
+
+    if (valueNs < WDGM_PROFILER_SUB_BUCKET_COUNT) {
+        return static_cast<uint16_t>(valueNs);
+    }
+
+    bucket = static_cast<uint8_t>(
+        WdgM_Profiler_MostSignificantBit(valueNs) - WDGM_PROFILER_SUB_BUCKET_BITS + 1U);
+
+    return static_cast<uint16_t>((bucket * WDGM_PROFILER_SUB_BUCKET_HALF) +
+                                 (valueNs >> bucket));
+}
+
+/**
+ * @brief Get largest value mapped to a bucket index
+ */
+static uint32_t WdgM_Profiler_GetBucketUpperBound(uint16_t index) {
+    uint32_t bucket;
+    uint32_t subBucket;
+
+    if (index < WDGM_PROFILER_SUB_BUCKET_COUNT) {
+        return index;
+    }
+
+    bucket = (static_cast<uint32_t>(index) / WDGM_PROFILER_SUB_BUCKET_HALF) - 1U;
+    subBucket = static_cast<uint32_t>(index) - (bucket * WDGM_PROFILER_SUB_BUCKET_HALF);
+
+    return static_cast<uint32_t>(
+        ((static_cast<uint64_t>(subBucket) + 1U) << bucket) - 1U);
+}
+
+/**
+ * @brief Clear histogram
+ */
+static void WdgM_Profiler_ClearHistogram(WdgM_ProfilerHistogramType* histogram) {
+    (void)memset(histogram, 0, sizeof(*histogram));
+    histogram->minNs = WDGM_PROFILER_MAX_VALUE_NS;
+}
+
+/**
+ * @brief Record one value into a histogram
+ */
+static void WdgM_Profiler_Record(WdgM_ProfilerHistogramType* histogram, uint64_t valueNs) {
+    uint32_t value;
+
+    value = (valueNs > WDGM_PROFILER_MAX_VALUE_NS) ?
+            WDGM_PROFILER_MAX_VALUE_NS : static_cast<uint32_t>(valueNs);
+
+    histogram->counts[WdgM_Profiler_GetBucketIndex(value)]++;
+    histogram->totalCount++;
+    histogram->sumNs += value;
+
+    if (value < histogram->minNs) {
+        histogram->minNs = value;
+    }
+    if (value > histogram->maxNs) {
+        histogram->maxNs = value;
+    }
+}
+
+/**
+ * @brief Summarize histogram
+ */
+static void WdgM_Profiler_Summarize(
+    const WdgM_ProfilerHistogramType* histogram,
+    WdgM_ProfilerSummaryType* summary
+) {
+    summary->count = histogram->totalCount;
+
+    if (histogram->totalCount == 0U) {
+        summary->minNs = 0U;
+        summary->maxNs = 0U;
+        summary->meanNs = 0U;
+        summary->p50Ns = 0U;
+        summary->p99Ns = 0U;
+        summary->p999Ns = 0U;
+        return;
+    }
+
+    summary->minNs = histogram->minNs;
+    summary->maxNs = histogram->maxNs;
+    summary->meanNs = static_cast<uint32_t>(histogram->sumNs / histogram->totalCount);
+    summary->p50Ns = WdgM_Profiler_GetPercentile(histogram, 500U);
+    summary->p99Ns = WdgM_Profiler_GetPercentile(histogram, 990U);
+    summary->p999Ns = WdgM_Profiler_GetPercentile(histogram, 999U);
+}
+
+/**
+ * @brief Write non-empty buckets of one histogram as CSV
+ */
+static void WdgM_Profiler_ExportBuckets(
+    FILE* stream,
+    const char* name,
+    const char* kind,
+    const WdgM_ProfilerHistogramType* histogram
+) {
+    uint16_t i;
+
+    for (i = 0U; i < WDGM_PROFILER_NUM_BUCKETS; i++) {
+        if (histogram->counts[i] != 0U) {
+            (void)fprintf(stream, "%s,%s,%u,%u\n", name, kind,
+                          static_cast<unsigned int>(WdgM_Profiler_GetBucketUpperBound(i)),
+                          static_cast<unsigned int>(histogram->counts[i]));
+        }
+    }
+}
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS
+ *============================================================================*/
+
+/**
+ * @brief Set simulated profiler timestamp
+ */
+void WdgM_Profiler_SimSetTimeNs(uint64_t timeNs) {
+    WdgM_ProfilerSimTimeNs = timeNs;
+    WdgM_ProfilerSimTimeEnabled = TRUE;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file WdgM_Profiler.h
+ * @brief Runnable Execution Time and Jitter Profiler
+ * @details Measures each supervised runnable between its entry and exit
+ *          checkpoint and records execution time and activation jitter in
+ *          fixed-size HDR (log-linear) histograms. Fed from
+ *          WdgM_CheckpointReached, no allocation at runtime.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety QM - Diagnostic instrumentation only, no influence on supervision
+ */
+
+#ifndef WDGM_PROFILER_H
+#define WDGM_PROFILER_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include <cstdio>
+#include "Std_Types.h"
+#include "Rte/Rte_Type.h"
+#include "WdgM_Cfg.h"
+
+/*============================================================================*
+ * CONFIGURATION CONSTANTS
+ *============================================================================*/
+
+/** @brief Sub-bucket resolution in bits (32 sub-buckets, ~3% precision) */
+#define WDGM_PROFILER_SUB_BUCKET_BITS       5U
+
+/** @brief Number of sub-buckets per power of two */
+#define WDGM_PROFILER_SUB_BUCKET_COUNT      (1U << WDGM_PROFILER_SUB_BUCKET_BITS)
+
+/** @brief Half of the sub-buckets (upper half is used above bucket 0) */
+#define WDGM_PROFILER_SUB_BUCKET_HALF       (WDGM_PROFILER_SUB_BUCKET_COUNT / 2U)
+
+/** @brief Largest trackable value in ns (larger values are clamped, ~4.3s) */
+#define WDGM_PROFILER_MAX_VALUE_NS          0xFFFFFFFFU
+
+/** @brief Number of histogram counters covering 0..WDGM_PROFILER_MAX_VALUE_NS */
+#define WDGM_PROFILER_NUM_BUCKETS \
+    (((32U - WDGM_PROFILER_SUB_BUCKET_BITS) + 2U) * WDGM_PROFILER_SUB_BUCKET_HALF)
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief HDR histogram with fixed log-linear buckets
+ */
+typedef struct {
+    uint32_t counts[WDGM_PROFILER_NUM_BUCKETS];
+    uint32_t totalCount;
+    uint64_t sumNs;
+    uint32_t minNs;
+    uint32_t maxNs;
+} WdgM_ProfilerHistogramType;
+
+/**
+ * @brief Summary of one histogram
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t minNs;
+    uint32_t maxNs;
+    uint32_t meanNs;
+    uint32_t p50Ns;
+    uint32_t p99Ns;
+    uint32_t p999Ns;
+} WdgM_ProfilerSummaryType;
+
+/**
+ * @brief Profiling result for one runnable
+ */
+typedef struct {
+    WdgM_ProfilerSummaryType executionTime;     /**< Entry to exit checkpoint */
+    WdgM_ProfilerSummaryType activationJitter;  /**< |entry-to-entry - period| */
+    uint32_t periodNs;                          /**< Nominal activation period */
+    uint32_t budgetNs;                          /**< Deadline max, or period if none */
+    int64_t headroomNs;                         /**< budget - worst observed execution */
+} WdgM_ProfilerStatisticsType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize profiler and clear all histograms
+ */
+void WdgM_Profiler_Init(void);
+
+/**
+ * @brief Configure one profiled runnable
+ * @param[in] entityIndex Supervised entity index (SEId - 1)
+ * @param[in] name Runnable name for reports
+ * @param[in] periodNs Nominal activation period
+ * @param[in] budgetNs Execution time budget
+ */
+void WdgM_Profiler_ConfigureRunnable(
+    uint8_t entityIndex,
+    const char* name,
+    uint32_t periodNs,
+    uint32_t budgetNs
+);
+
+/**
+ * @brief Record runnable entry checkpoint
+ * @param[in] entityIndex Supervised entity index (SEId - 1)
+ */
+void WdgM_Profiler_RunnableEntry(uint8_t entityIndex);
+
+/**
+ * @brief Record runnable exit checkpoint
+ * @param[in] entityIndex Supervised entity index (SEId - 1)
+ */
+void WdgM_Profiler_RunnableExit(uint8_t entityIndex);
+
+/**
+ * @brief Get profiling statistics for a runnable
+ * @details Summarizes a copy taken under OS_SPINLOCK_WDGM, callable while
+ *          the task threads record
+ * @param[in] SEId Supervised Entity ID
+ * @param[out] Statistics Pointer to receive statistics
+ * @return E_OK on success, E_NOT_OK if SEId is not profiled
+ */
+Std_ReturnType WdgM_Profiler_GetStatistics(
+    WdgM_SupervisedEntityIdType SEId,
+    WdgM_ProfilerStatisticsType* Statistics
+);
+
+/**
+ * @brief Get raw execution time histogram of a runnable
+ * @details Not synchronized with recording: read after the tasks stopped
+ * @param[in] SEId Supervised Entity ID
+ * @return Pointer to histogram, NULL_PTR if SEId is not profiled
+ */
+const WdgM_ProfilerHistogramType* WdgM_Profiler_GetExecutionHistogram(
+    WdgM_SupervisedEntityIdType SEId
+);
+
+/**
+ * @brief Get value at a percentile of a histogram
+ * @details Returns the upper bound of the bucket containing the percentile,
+ *          i.e. a conservative value for WCET estimation
+ * @param[in] histogram Histogram to evaluate
+ * @param[in] permille Percentile in 1/1000 (500 = median, 999 = p99.9)
+ * @return Value in ns, 0 if histogram is empty
+ */
+uint32_t WdgM_Profiler_GetPercentile(
+    const WdgM_ProfilerHistogramType* histogram,
+    uint16_t permille
+);
+
+/**
+ * @brief Write profiling report
+ * @param[in] stream Output stream
+ * @param[in] includeBuckets TRUE to append non-empty histogram buckets
+ */
+void WdgM_Profiler_Export(FILE* stream, boolean includeBuckets);
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS (FOR TESTING)
+ *============================================================================*/
+
+/**
+ * @brief Set simulated profiler timestamp
+ * @details Replaces the monotonic clock until the next WdgM_Profiler_Init
+ * @param[in] timeNs Timestamp in nanoseconds
+ */
+void WdgM_Profiler_SimSetTimeNs(uint64_t timeNs);
+
+#endif /* WDGM_PROFILER_H */
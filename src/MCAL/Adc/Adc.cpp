@@ -1,7 +1,11 @@
 /**
  * @file Adc.cpp
  * @brief AUTOSAR ADC Driver Implementation
- * @details MCAL ADC driver stub for simulation
+ * @details MCAL ADC driver: groups convert the simulated channel values into
+ *          their result buffers, continuous groups catch up with the elapsed
+ *          conversion periods on access. On the IIO backend the rounds are the
+ *          scans captured by the device buffer, fetched many scans per read()
+ *          and decoded by the scan element layout.
  * @version 1.0.0
  * @date 2024
  *
@@ -12,7 +16,19 @@
  * INCLUDES
  *============================================================================*/
 #include "Adc.h"
+#include "BSW/Trace/Trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <mutex>
+#include <string>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 /*============================================================================*
  * LOCAL TYPES AND MACROS
@@ -24,6 +40,52 @@
 /** @brief Default simulated current sense value */
 #define ADC_SIM_DEFAULT_CURRENT             500U
 
+/** @brief Channel without a scan element */
+#define ADC_IIO_ELEMENT_NONE                0xFFU
+
+/** @brief Maximum enabled scan elements (one per channel) */
+#define ADC_IIO_MAX_ELEMENTS                ADC_NUM_CHANNELS
+
+/**
+ * @brief Enabled IIO scan element
+ */
+typedef struct {
+    Adc_ChannelType Channel;                /**< ADC channel fed by the element */
+    uint16_t Index;                         /**< Scan index (order in the scan) */
+    uint16_t Offset;                        /**< Byte offset in the scan */
+    uint8_t StorageBytes;                   /**< Storage size */
+    uint8_t RealBits;                       /**< Valid bits */
+    uint8_t Shift;                          /**< Right shift of the valid bits */
+    boolean Signed;                         /**< Two's complement value */
+    boolean BigEndian;                      /**< Big endian storage */
+} Adc_IioElementType;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static uint64_t Adc_GetTimeUs(void);
+static const Adc_GroupConfigType* Adc_GetGroupConfig(Adc_GroupType Group);
+static Adc_StreamNumSampleType Adc_GetLastIndex(const Adc_GroupConfigType* group,
+                                                const Adc_GroupStateType* state);
+static void Adc_ConvertRounds(Adc_GroupType Group, uint64_t firstUs, uint32_t periodUs,
+                              Adc_StreamNumSampleType count);
+static void Adc_CatchUp(Adc_GroupType Group, boolean forRead);
+static void Adc_ReadDone(Adc_GroupType Group);
+
+static Std_ReturnType Adc_Iio_Open(const Adc_BackendConfigType* ConfigPtr);
+static void Adc_Iio_Close(void);
+static boolean Adc_Iio_DisableElements(const std::string& scanDir);
+static boolean Adc_Iio_AddElement(const std::string& scanDir, const char* name,
+                                  Adc_ChannelType Channel);
+static uint64_t Adc_Iio_Drain(void);
+static Adc_ValueGroupType Adc_Iio_Decode(const Adc_IioElementType* element,
+                                         const uint8_t* scan);
+static void Adc_Iio_Fill(Adc_ChannelType Channel, uint64_t firstScan, uint32_t step,
+                         uint16_t numSamples, Adc_ValueGroupType* samples);
+static boolean Adc_Iio_WriteAttr(const std::string& path, const char* value);
+static boolean Adc_Iio_ReadAttr(const std::string& path, char* value, size_t size);
+
 /*============================================================================*
  * LOCAL VARIABLES
  *============================================================================*/
@@ -34,14 +96,63 @@ static boolean Adc_Initialized = FALSE;
 /** @brief Configuration pointer */
 static const Adc_ConfigType* Adc_ConfigPtr = NULL_PTR;
 
+/** @brief Active group configuration */
+static const Adc_GroupConfigType* Adc_Groups = NULL_PTR;
+static uint8_t Adc_NumGroups = 0U;
+
 /** @brief Simulated ADC values */
 static Adc_ValueGroupType Adc_SimValues[ADC_NUM_CHANNELS];
 
-/** @brief Group status */
-static Adc_StatusType Adc_GroupStatus[ADC_NUM_CHANNELS];
+/** @brief Group runtime state */
+static Adc_GroupStateType Adc_GroupState[ADC_MAX_GROUPS];
+
+/** @brief Driver internal result buffers of single access groups */
+static Adc_ValueGroupType Adc_InternalResults[ADC_MAX_GROUPS][ADC_MAX_GROUP_CHANNELS];
+
+/** @brief Simulated time base (replaces the monotonic clock when enabled) */
+static uint64_t Adc_SimTimeUs = 0U;
+static boolean Adc_SimTimeEnabled = FALSE;
+
+/** @brief Simulated sample source (NULL_PTR = Adc_SimValues) */
+static Adc_SimSampleSourceType Adc_SimSource = NULL_PTR;
+
+/** @brief Simulated sample sources of single channels (NULL_PTR = Adc_SimSource) */
+static Adc_SimSampleSourceType Adc_SimChannelSources[ADC_NUM_CHANNELS];
+
+/** @brief Conversion hook (NULL_PTR = none) */
+static Adc_SimConversionHookType Adc_SimConversionHook = NULL_PTR;
+
+/** @brief Samples of one channel fetched from the sample source */
+static Adc_ValueGroupType Adc_SimBlock[ADC_MAX_STREAM_SAMPLES];
+
+/**
+ * @brief Serializes conversions and group state between the task threads and
+ *        the input simulation; recursive for reads from a group notification
+ */
+static std::recursive_mutex Adc_Mutex;
+
+/** @brief IIO backend active */
+static boolean Adc_IioActive = FALSE;
+
+/** @brief IIO device sysfs directory and character device */
+static std::string Adc_IioDir;
+static int Adc_IioFd = -1;
+
+/** @brief Enabled scan elements in scan order, element of each channel */
+static Adc_IioElementType Adc_IioElements[ADC_IIO_MAX_ELEMENTS];
+static uint8_t Adc_IioNumElements = 0U;
+static uint8_t Adc_IioChannelElement[ADC_NUM_CHANNELS];
+static uint16_t Adc_IioScanBytes = 0U;
 
-/** @brief Group conversion results */
-static Adc_ValueGroupType Adc_GroupResults[ADC_NUM_CHANNELS];
+/** @brief Decoded scans per channel (ring, scan n at n % ADC_IIO_RING_SCANS) */
+static Adc_ValueGroupType Adc_IioRing[ADC_NUM_CHANNELS][ADC_IIO_RING_SCANS];
+
+/** @brief Raw scans of one read() */
+static uint8_t Adc_IioRaw[ADC_IIO_READ_SCANS * ADC_IIO_MAX_SCAN_BYTES];
+
+/** @brief Capture statistics */
+static uint64_t Adc_IioScanCount = 0U;
+static uint32_t Adc_IioReadCalls = 0U;
 
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
@@ -60,13 +171,21 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr) {
 
     /* Store configuration */
     Adc_ConfigPtr = ConfigPtr;
+    if ((ConfigPtr->NumGroups > 0U) && (ConfigPtr->Groups != NULL_PTR) &&
+        (ConfigPtr->NumGroups <= ADC_MAX_GROUPS)) {
+        Adc_Groups = ConfigPtr->Groups;
+        Adc_NumGroups = ConfigPtr->NumGroups;
+    } else {
+        Adc_Groups = Adc_GroupConfig;
+        Adc_NumGroups = ADC_NUM_GROUPS;
+    }
 
     /* Initialize simulated values */
     for (i = 0U; i < ADC_NUM_CHANNELS; i++) {
         Adc_SimValues[i] = 0U;
-        Adc_GroupStatus[i] = ADC_IDLE;
-        Adc_GroupResults[i] = 0U;
     }
+    (void)std::memset(Adc_GroupState, 0, sizeof(Adc_GroupState));
+    (void)std::memset(Adc_InternalResults, 0, sizeof(Adc_InternalResults));
 
     /* Set default simulation values */
     Adc_SimValues[0] = ADC_SIM_DEFAULT_AMBIENT;  /* Ambient light channel */
@@ -88,93 +207,229 @@ void Adc_DeInit(void) {
     /* Reset all states */
     for (i = 0U; i < ADC_NUM_CHANNELS; i++) {
         Adc_SimValues[i] = 0U;
-        Adc_GroupStatus[i] = ADC_IDLE;
-        Adc_GroupResults[i] = 0U;
     }
+    (void)std::memset(Adc_GroupState, 0, sizeof(Adc_GroupState));
+    Adc_SimTimeUs = 0U;
+    Adc_SimTimeEnabled = FALSE;
+    Adc_Iio_Close();
 
     Adc_ConfigPtr = NULL_PTR;
+    Adc_Groups = NULL_PTR;
+    Adc_NumGroups = 0U;
     Adc_Initialized = FALSE;
 }
 
+/**
+ * @brief Set up the result buffer of a group
+ */
+Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr) {
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if ((Adc_GetGroupConfig(Group) == NULL_PTR) || (DataBufferPtr == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    if (Adc_GroupState[Group].Status != ADC_IDLE) {
+        return E_NOT_OK;
+    }
+
+    Adc_GroupState[Group].Buffer = DataBufferPtr;
+    return E_OK;
+}
+
 /**
  * @brief Start group conversion
  */
 void Adc_StartGroupConversion(Adc_GroupType Group) {
-    if (!Adc_Initialized) {
+    const Adc_GroupConfigType* group = Adc_GetGroupConfig(Group);
+    Adc_GroupStateType* state;
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if (group == NULL_PTR) {
         return;
     }
 
-    if (Group >= ADC_NUM_CHANNELS) {
+    state = &Adc_GroupState[Group];
+
+    /* Continuous conversion already running */
+    if (state->Running) {
         return;
     }
 
-    /* In simulation, conversion completes immediately */
-    Adc_GroupStatus[Group] = ADC_BUSY;
+    if (state->Buffer == NULL_PTR) {
+        if ((group->AccessMode != ADC_ACCESS_MODE_SINGLE) ||
+            (group->NumChannels > ADC_MAX_GROUP_CHANNELS)) {
+            /* Development error - streaming group without result buffer */
+            return;
+        }
+        state->Buffer = Adc_InternalResults[Group];
+    }
 
-    /* Copy simulated value to result */
-    Adc_GroupResults[Group] = Adc_SimValues[Group];
+    state->Status = ADC_BUSY;
+    state->WriteIndex = 0U;
+    state->NewSamples = 0U;
 
-    /* Mark as completed (simulated instant conversion) */
-    Adc_GroupStatus[Group] = ADC_COMPLETED;
+    if (Adc_IioActive) {
+        /* Continuous: every scan captured from now on, one-shot: latest scans */
+        const uint64_t scans = Adc_Iio_Drain();
+        if (group->ConvMode == ADC_CONV_MODE_CONTINUOUS) {
+            state->Running = TRUE;
+            state->NextConversion = scans;
+        } else {
+            Adc_ConvertRounds(Group,
+                              (scans > group->StreamingNumSamples) ?
+                              (scans - group->StreamingNumSamples) : 0U,
+                              1U, group->StreamingNumSamples);
+        }
+    } else if (group->ConvMode == ADC_CONV_MODE_CONTINUOUS) {
+        /* First round now, then every ConversionPeriodUs */
+        state->Running = TRUE;
+        state->NextConversion = Adc_GetTimeUs();
+        Adc_CatchUp(Group, FALSE);
+    } else {
+        /* In simulation, one-shot conversion completes immediately */
+        Adc_ConvertRounds(Group, Adc_GetTimeUs(), group->ConversionPeriodUs,
+                          group->StreamingNumSamples);
+    }
 }
 
 /**
  * @brief Stop group conversion
  */
 void Adc_StopGroupConversion(Adc_GroupType Group) {
-    if (!Adc_Initialized) {
-        return;
-    }
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
 
-    if (Group >= ADC_NUM_CHANNELS) {
+    if (Adc_GetGroupConfig(Group) == NULL_PTR) {
         return;
     }
 
-    Adc_GroupStatus[Group] = ADC_IDLE;
+    Adc_GroupState[Group].Running = FALSE;
+    Adc_GroupState[Group].NewSamples = 0U;
+    Adc_GroupState[Group].Status = ADC_IDLE;
 }
 
 /**
  * @brief Read group conversion results
  */
 Std_ReturnType Adc_ReadGroup(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr) {
-    if (!Adc_Initialized) {
+    const Adc_GroupConfigType* group = Adc_GetGroupConfig(Group);
+    const Adc_GroupStateType* state;
+    Adc_StreamNumSampleType last;
+    uint8_t ch;
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if ((group == NULL_PTR) || (DataBufferPtr == NULL_PTR)) {
         return E_NOT_OK;
     }
 
-    if (DataBufferPtr == NULL_PTR) {
+    Adc_CatchUp(Group, TRUE);
+
+    state = &Adc_GroupState[Group];
+    if ((state->Status != ADC_COMPLETED) && (state->Status != ADC_STREAM_COMPLETED)) {
         return E_NOT_OK;
     }
 
-    if (Group >= ADC_NUM_CHANNELS) {
-        return E_NOT_OK;
+    /* Return the latest result of every channel */
+    last = Adc_GetLastIndex(group, state);
+    for (ch = 0U; ch < group->NumChannels; ch++) {
+        DataBufferPtr[ch] = state->Buffer[(ch * group->StreamingNumSamples) + last];
     }
 
-    if (Adc_GroupStatus[Group] != ADC_COMPLETED) {
-        return E_NOT_OK;
+    Adc_ReadDone(Group);
+
+    return E_OK;
+}
+
+/**
+ * @brief Get the latest sample in the result buffer
+ */
+Adc_StreamNumSampleType Adc_GetStreamLastPointer(
+    Adc_GroupType Group,
+    Adc_ValueGroupType** PtrToSamplePtr
+) {
+    const Adc_GroupConfigType* group = Adc_GetGroupConfig(Group);
+    const Adc_GroupStateType* state;
+    Adc_StreamNumSampleType numSamples;
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if ((group == NULL_PTR) || (PtrToSamplePtr == NULL_PTR)) {
+        return 0U;
     }
 
-    /* Return the result */
-    *DataBufferPtr = Adc_GroupResults[Group];
+    Adc_CatchUp(Group, TRUE);
 
-    /* Reset status to idle after read */
-    Adc_GroupStatus[Group] = ADC_IDLE;
+    state = &Adc_GroupState[Group];
+    numSamples = state->NewSamples;
+    if (numSamples == 0U) {
+        *PtrToSamplePtr = NULL_PTR;
+        return 0U;
+    }
 
-    return E_OK;
+    *PtrToSamplePtr = &state->Buffer[Adc_GetLastIndex(group, state)];
+    Adc_ReadDone(Group);
+
+    return numSamples;
+}
+
+/**
+ * @brief Copy the samples converted since the previous read
+ */
+Adc_StreamNumSampleType Adc_ReadGroupStream(
+    Adc_GroupType Group,
+    Adc_ValueGroupType* DataBufferPtr,
+    Adc_StreamNumSampleType MaxSamples
+) {
+    const Adc_GroupConfigType* group = Adc_GetGroupConfig(Group);
+    const Adc_GroupStateType* state;
+    const Adc_ValueGroupType* src;
+    uint32_t numSamples;
+    uint32_t first;
+    uint32_t depth;
+    uint32_t j;
+    uint8_t ch;
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if ((group == NULL_PTR) || (DataBufferPtr == NULL_PTR) || (MaxSamples == 0U)) {
+        return 0U;
+    }
+
+    Adc_CatchUp(Group, TRUE);
+
+    state = &Adc_GroupState[Group];
+    numSamples = (state->NewSamples < MaxSamples) ? state->NewSamples : MaxSamples;
+    if (numSamples == 0U) {
+        return 0U;
+    }
+
+    /* Oldest sample to copy, the ring may wrap once */
+    depth = group->StreamingNumSamples;
+    first = (Adc_GetLastIndex(group, state) + depth + 1U - numSamples) % depth;
+
+    for (ch = 0U; ch < group->NumChannels; ch++) {
+        src = &state->Buffer[ch * depth];
+        for (j = 0U; j < numSamples; j++) {
+            DataBufferPtr[(ch * MaxSamples) + j] = src[(first + j) % depth];
+        }
+    }
+
+    Adc_ReadDone(Group);
+
+    return static_cast<Adc_StreamNumSampleType>(numSamples);
 }
 
 /**
  * @brief Get group status
  */
 Adc_StatusType Adc_GetGroupStatus(Adc_GroupType Group) {
-    if (!Adc_Initialized) {
-        return ADC_IDLE;
-    }
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
 
-    if (Group >= ADC_NUM_CHANNELS) {
+    if (Adc_GetGroupConfig(Group) == NULL_PTR) {
         return ADC_IDLE;
     }
 
-    return Adc_GroupStatus[Group];
+    Adc_CatchUp(Group, FALSE);
+
+    return Adc_GroupState[Group].Status;
 }
 
 /**
@@ -193,6 +448,86 @@ void Adc_DisableHardwareTrigger(Adc_GroupType Group) {
     STD_UNUSED(Group);
 }
 
+/**
+ * @brief Enable group notification
+ */
+void Adc_EnableGroupNotification(Adc_GroupType Group) {
+    const Adc_GroupConfigType* group = Adc_GetGroupConfig(Group);
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if ((group == NULL_PTR) || (group->Notification == NULL_PTR)) {
+        return;
+    }
+
+    Adc_GroupState[Group].NotificationEnabled = TRUE;
+}
+
+/**
+ * @brief Disable group notification
+ */
+void Adc_DisableGroupNotification(Adc_GroupType Group) {
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if (Adc_GetGroupConfig(Group) == NULL_PTR) {
+        return;
+    }
+
+    Adc_GroupState[Group].NotificationEnabled = FALSE;
+}
+
+/**
+ * @brief Advance continuous conversions and call notifications
+ */
+void Adc_MainFunction(void) {
+    uint8_t i;
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if (!Adc_Initialized) {
+        return;
+    }
+
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_ADC);
+
+    for (i = 0U; i < Adc_NumGroups; i++) {
+        Adc_CatchUp(i, FALSE);
+    }
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_ADC);
+}
+
+/**
+ * @brief Select the ADC backend
+ */
+Std_ReturnType Adc_SetBackend(const Adc_BackendConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    Adc_Iio_Close();
+
+    if (ConfigPtr->Backend == ADC_BACKEND_IIO) {
+        if (Adc_Iio_Open(ConfigPtr) != E_OK) {
+            Adc_Iio_Close();
+            return E_NOT_OK;
+        }
+        Adc_IioActive = TRUE;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Get IIO capture statistics
+ */
+void Adc_GetIioStats(Adc_IioStatsType* Stats) {
+    if (Stats == NULL_PTR) {
+        return;
+    }
+
+    Stats->ReadCalls = Adc_IioReadCalls;
+    Stats->Scans = Adc_IioScanCount;
+}
+
 /**
  * @brief Get version information
  */
@@ -208,6 +543,28 @@ void Adc_GetVersionInfo(Std_VersionInfoType* versioninfo) {
     versioninfo->sw_patch_version = ADC_SW_PATCH_VERSION;
 }
 
+/**
+ * @brief Save group states and simulated values
+ */
+void Adc_SaveSnapshot(Adc_SnapshotType* Snapshot) {
+    (void)std::memcpy(Snapshot->SimValues, Adc_SimValues, sizeof(Adc_SimValues));
+    (void)std::memcpy(Snapshot->GroupState, Adc_GroupState, sizeof(Adc_GroupState));
+    (void)std::memcpy(Snapshot->InternalResults, Adc_InternalResults, sizeof(Adc_InternalResults));
+    Snapshot->SimTimeUs = Adc_SimTimeUs;
+    Snapshot->SimTimeEnabled = Adc_SimTimeEnabled;
+}
+
+/**
+ * @brief Restore group states and simulated values
+ */
+void Adc_RestoreSnapshot(const Adc_SnapshotType* Snapshot) {
+    (void)std::memcpy(Adc_SimValues, Snapshot->SimValues, sizeof(Adc_SimValues));
+    (void)std::memcpy(Adc_GroupState, Snapshot->GroupState, sizeof(Adc_GroupState));
+    (void)std::memcpy(Adc_InternalResults, Snapshot->InternalResults, sizeof(Adc_InternalResults));
+    Adc_SimTimeUs = Snapshot->SimTimeUs;
+    Adc_SimTimeEnabled = Snapshot->SimTimeEnabled;
+}
+
 /*============================================================================*
  * SIMULATION FUNCTIONS
  *============================================================================*/
@@ -216,6 +573,8 @@ void Adc_GetVersionInfo(Std_VersionInfoType* versioninfo) {
  * @brief Set simulated ADC value
  */
 void Adc_SimSetValue(Adc_ChannelType Channel, Adc_ValueGroupType Value) {
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
     if (Channel >= ADC_NUM_CHANNELS) {
         return;
     }
@@ -232,6 +591,8 @@ void Adc_SimSetValue(Adc_ChannelType Channel, Adc_ValueGroupType Value) {
  * @brief Get current simulated ADC value
  */
 Adc_ValueGroupType Adc_SimGetValue(Adc_ChannelType Channel) {
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
     if (Channel >= ADC_NUM_CHANNELS) {
         return 0U;
     }
@@ -243,11 +604,611 @@ Adc_ValueGroupType Adc_SimGetValue(Adc_ChannelType Channel) {
  * @brief Trigger conversion complete
  */
 void Adc_SimTriggerComplete(Adc_GroupType Group) {
-    if (Group >= ADC_NUM_CHANNELS) {
+    const Adc_GroupConfigType* group = Adc_GetGroupConfig(Group);
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    if (group == NULL_PTR) {
+        return;
+    }
+
+    if (Adc_GroupState[Group].Buffer == NULL_PTR) {
+        if ((group->AccessMode != ADC_ACCESS_MODE_SINGLE) ||
+            (group->NumChannels > ADC_MAX_GROUP_CHANNELS)) {
+            return;
+        }
+        Adc_GroupState[Group].Buffer = Adc_InternalResults[Group];
+    }
+
+    /* Convert one round of the simulated values */
+    Adc_ConvertRounds(Group, Adc_GetTimeUs(), 0U, 1U);
+}
+
+/**
+ * @brief Set simulated conversion time base
+ */
+void Adc_SimSetTimeUs(uint64_t timeUs) {
+    std::lock_guard<std::recursive_mutex> lock(Adc_Mutex);
+
+    Adc_SimTimeUs = timeUs;
+    Adc_SimTimeEnabled = TRUE;
+}
+
+/**
+ * @brief Set simulated sample source
+ */
+void Adc_SimSetSampleSource(Adc_SimSampleSourceType Source) {
+    Adc_SimSource = Source;
+}
+
+/**
+ * @brief Set simulated sample source of one channel
+ */
+void Adc_SimSetChannelSource(Adc_ChannelType Channel, Adc_SimSampleSourceType Source) {
+    if (Channel >= ADC_NUM_CHANNELS) {
+        return;
+    }
+
+    Adc_SimChannelSources[Channel] = Source;
+}
+
+/**
+ * @brief Set conversion hook
+ */
+void Adc_SimSetConversionHook(Adc_SimConversionHookType Hook) {
+    Adc_SimConversionHook = Hook;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get time base of the continuous conversions
+ */
+static uint64_t Adc_GetTimeUs(void) {
+    if (Adc_SimTimeEnabled) {
+        return Adc_SimTimeUs;
+    }
+
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Get configuration of a valid group
+ * @return Group configuration, NULL_PTR if not initialized or invalid group
+ */
+static const Adc_GroupConfigType* Adc_GetGroupConfig(Adc_GroupType Group) {
+    if ((!Adc_Initialized) || (Group >= Adc_NumGroups)) {
+        return NULL_PTR;
+    }
+
+    return &Adc_Groups[Group];
+}
+
+/**
+ * @brief Get buffer index of the latest sample
+ */
+static Adc_StreamNumSampleType Adc_GetLastIndex(const Adc_GroupConfigType* group,
+                                                const Adc_GroupStateType* state) {
+    return (state->WriteIndex == 0U) ?
+           static_cast<Adc_StreamNumSampleType>(group->StreamingNumSamples - 1U) :
+           static_cast<Adc_StreamNumSampleType>(state->WriteIndex - 1U);
+}
+
+/**
+ * @brief Convert rounds of all channels of a group into the next sample slots
+ * @details A linear buffer stops at the end until it is read, a circular
+ *          buffer overwrites the oldest samples. The sample source delivers
+ *          one block per channel.
+ * @param[in] Group Group
+ * @param[in] firstUs Conversion time of the first round (first scan on IIO)
+ * @param[in] periodUs Time between rounds (scans between rounds on IIO)
+ * @param[in] count Number of rounds (at most the buffer depth)
+ */
+static void Adc_ConvertRounds(Adc_GroupType Group, uint64_t firstUs, uint32_t periodUs,
+                              Adc_StreamNumSampleType count) {
+    const Adc_GroupConfigType* group = &Adc_Groups[Group];
+    Adc_GroupStateType* state = &Adc_GroupState[Group];
+    Adc_StreamNumSampleType depth = group->StreamingNumSamples;
+    Adc_StreamNumSampleType chunk;
+    Adc_StreamNumSampleType done;
+    Adc_StreamNumSampleType index;
+    Adc_StreamNumSampleType j;
+    Adc_ValueGroupType* dst;
+    boolean wasFull = (state->NewSamples >= depth) ? TRUE : FALSE;
+    uint8_t ch;
+
+    if (group->BufferMode == ADC_STREAM_BUFFER_LINEAR) {
+        if (state->WriteIndex >= depth) {
+            return;
+        }
+        if (count > (depth - state->WriteIndex)) {
+            count = static_cast<Adc_StreamNumSampleType>(depth - state->WriteIndex);
+        }
+    }
+
+    for (done = 0U; done < count; done = static_cast<Adc_StreamNumSampleType>(done + chunk)) {
+        chunk = static_cast<Adc_StreamNumSampleType>(count - done);
+        if (chunk > ADC_MAX_STREAM_SAMPLES) {
+            chunk = ADC_MAX_STREAM_SAMPLES;
+        }
+
+        for (ch = 0U; ch < group->NumChannels; ch++) {
+            if (Adc_IioActive) {
+                Adc_Iio_Fill(group->Channels[ch],
+                             firstUs + (static_cast<uint64_t>(done) * periodUs),
+                             periodUs, chunk, Adc_SimBlock);
+            } else if (Adc_SimChannelSources[group->Channels[ch]] != NULL_PTR) {
+                Adc_SimChannelSources[group->Channels[ch]](group->Channels[ch],
+                    firstUs + (static_cast<uint64_t>(done) * periodUs),
+                    periodUs, chunk, Adc_SimBlock);
+            } else if (Adc_SimSource != NULL_PTR) {
+                Adc_SimSource(group->Channels[ch],
+                              firstUs + (static_cast<uint64_t>(done) * periodUs),
+                              periodUs, chunk, Adc_SimBlock);
+            } else {
+                for (j = 0U; j < chunk; j++) {
+                    Adc_SimBlock[j] = Adc_SimValues[group->Channels[ch]];
+                }
+            }
+
+            /* Inputs from outside the plant models */
+            if ((Adc_SimConversionHook != NULL_PTR) &&
+                (Adc_IioActive || (Adc_SimChannelSources[group->Channels[ch]] == NULL_PTR))) {
+                Adc_SimConversionHook(group->Channels[ch],
+                                      firstUs + (static_cast<uint64_t>(done) * periodUs),
+                                      periodUs, chunk, Adc_SimBlock);
+            }
+
+            dst = &state->Buffer[ch * depth];
+            index = state->WriteIndex;
+            for (j = 0U; j < chunk; j++) {
+                dst[index] = Adc_SimBlock[j];
+                index++;
+                if (index >= depth) {
+                    index = 0U;
+                }
+            }
+        }
+
+        state->WriteIndex = static_cast<Adc_StreamNumSampleType>(
+            (static_cast<uint32_t>(state->WriteIndex) + chunk) % depth);
+    }
+
+    /* A linear buffer ends at its depth, it is not wrapped */
+    if ((group->BufferMode == ADC_STREAM_BUFFER_LINEAR) && (state->WriteIndex == 0U)) {
+        state->WriteIndex = depth;
+    }
+
+    state->NewSamples = ((static_cast<uint32_t>(state->NewSamples) + count) < depth) ?
+                        static_cast<Adc_StreamNumSampleType>(state->NewSamples + count) : depth;
+    state->Status = (state->NewSamples >= depth) ? ADC_STREAM_COMPLETED : ADC_COMPLETED;
+
+    /* Single access: every conversion, streaming: when the buffer got full */
+    if ((state->NewSamples >= depth) && ((!wasFull) || (depth == 1U)) &&
+        state->NotificationEnabled && (group->Notification != NULL_PTR)) {
+        group->Notification();
+    }
+}
+
+/**
+ * @brief Perform the continuous conversions due until now
+ * @details Conversions run lazily: the rounds elapsed since the last call
+ *          are converted at once, at most one buffer depth. In simulation a
+ *          read always finds at least one new round.
+ * @param[in] Group Group
+ * @param[in] forRead Called by a read
+ */
+static void Adc_CatchUp(Adc_GroupType Group, boolean forRead) {
+    const Adc_GroupConfigType* group = &Adc_Groups[Group];
+    Adc_GroupStateType* state = &Adc_GroupState[Group];
+    uint64_t nowUs;
+    uint64_t firstUs;
+    uint64_t period;
+    uint64_t due;
+
+    if (!state->Running) {
+        return;
+    }
+
+    if (Adc_IioActive) {
+        /* One round per captured scan */
+        const uint64_t scans = Adc_Iio_Drain();
+        if (scans > state->NextConversion) {
+            due = scans - state->NextConversion;
+            if (due > group->StreamingNumSamples) {
+                due = group->StreamingNumSamples;
+            }
+            Adc_ConvertRounds(Group, scans - due, 1U, static_cast<Adc_StreamNumSampleType>(due));
+            state->NextConversion = scans;
+        }
+        if (forRead && (state->NewSamples == 0U) && (scans > 0U)) {
+            Adc_ConvertRounds(Group, scans - 1U, 0U, 1U);
+        }
         return;
     }
 
-    /* Copy simulated value and mark complete */
-    Adc_GroupResults[Group] = Adc_SimValues[Group];
-    Adc_GroupStatus[Group] = ADC_COMPLETED;
+    nowUs = Adc_GetTimeUs();
+    period = (group->ConversionPeriodUs > 0U) ? group->ConversionPeriodUs : 1U;
+
+    if (nowUs >= state->NextConversion) {
+        due = ((nowUs - state->NextConversion) / period) + 1U;
+        firstUs = state->NextConversion;
+        state->NextConversion += due * period;
+
+        /* Older rounds would be overwritten anyway */
+        if (due > group->StreamingNumSamples) {
+            firstUs += (due - group->StreamingNumSamples) * period;
+            due = group->StreamingNumSamples;
+        }
+        Adc_ConvertRounds(Group, firstUs, static_cast<uint32_t>(period),
+                          static_cast<Adc_StreamNumSampleType>(due));
+    }
+
+    if (forRead && (state->NewSamples == 0U)) {
+        Adc_ConvertRounds(Group, nowUs, 0U, 1U);
+    }
+}
+
+/**
+ * @brief Release the results after a read
+ */
+static void Adc_ReadDone(Adc_GroupType Group) {
+    Adc_GroupStateType* state = &Adc_GroupState[Group];
+
+    state->NewSamples = 0U;
+    if (Adc_Groups[Group].BufferMode == ADC_STREAM_BUFFER_LINEAR) {
+        state->WriteIndex = 0U;
+    }
+    state->Status = state->Running ? ADC_BUSY : ADC_IDLE;
+}
+
+/*============================================================================*
+ * LINUX IIO BACKEND
+ *============================================================================*/
+
+/**
+ * @brief Set up buffered capture on an IIO device
+ * @details Disables all scan elements, enables the mapped ones, computes the
+ *          scan layout (elements in index order, each aligned to its storage
+ *          size), sets the trigger and enables the buffer
+ */
+static Std_ReturnType Adc_Iio_Open(const Adc_BackendConfigType* ConfigPtr) {
+#if defined(__linux__)
+    const std::string dir = (ConfigPtr->DevicePath != NULL_PTR) ?
+                            ConfigPtr->DevicePath : ADC_IIO_DEVICE_PATH;
+    const std::string scanDir = dir + "/scan_elements";
+    std::string node;
+    char value[32];
+    uint16_t offset = 0U;
+    uint8_t maxBytes = 1U;
+    uint8_t i;
+
+    Adc_IioNumElements = 0U;
+    (void)std::memset(Adc_IioChannelElement, ADC_IIO_ELEMENT_NONE,
+                      sizeof(Adc_IioChannelElement));
+
+    /* Scan elements can only be changed with the buffer disabled */
+    if (!Adc_Iio_WriteAttr(dir + "/buffer/enable", "0")) {
+        return E_NOT_OK;
+    }
+    Adc_IioDir = dir;
+
+    if (!Adc_Iio_DisableElements(scanDir)) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0U; i < ADC_NUM_CHANNELS; i++) {
+        if (ConfigPtr->ScanElements != NULL_PTR) {
+            if ((ConfigPtr->ScanElements[i] != NULL_PTR) &&
+                !Adc_Iio_AddElement(scanDir, ConfigPtr->ScanElements[i], i)) {
+                return E_NOT_OK;
+            }
+        } else {
+            /* Default mapping: in_voltage<n> where the device has it */
+            (void)std::snprintf(value, sizeof(value), "in_voltage%u", static_cast<unsigned int>(i));
+            (void)Adc_Iio_AddElement(scanDir, value, i);
+        }
+    }
+
+    if ((Adc_IioNumElements == 0U) || (Adc_IioNumElements > ADC_IIO_MAX_ELEMENTS)) {
+        return E_NOT_OK;
+    }
+
+    /* Scan layout: index order, natural alignment, padded to the largest element */
+    std::sort(Adc_IioElements, Adc_IioElements + Adc_IioNumElements,
+              [](const Adc_IioElementType& a, const Adc_IioElementType& b) {
+                  return a.Index < b.Index;
+              });
+    for (i = 0U; i < Adc_IioNumElements; i++) {
+        Adc_IioElementType* element = &Adc_IioElements[i];
+        offset = static_cast<uint16_t>(
+            ((offset + element->StorageBytes - 1U) / element->StorageBytes) * element->StorageBytes);
+        element->Offset = offset;
+        offset = static_cast<uint16_t>(offset + element->StorageBytes);
+        maxBytes = (element->StorageBytes > maxBytes) ? element->StorageBytes : maxBytes;
+        Adc_IioChannelElement[element->Channel] = i;
+    }
+    Adc_IioScanBytes = static_cast<uint16_t>(((offset + maxBytes - 1U) / maxBytes) * maxBytes);
+    if (Adc_IioScanBytes > ADC_IIO_MAX_SCAN_BYTES) {
+        return E_NOT_OK;
+    }
+
+    if ((ConfigPtr->TriggerName != NULL_PTR) &&
+        !Adc_Iio_WriteAttr(dir + "/trigger/current_trigger", ConfigPtr->TriggerName)) {
+        return E_NOT_OK;
+    }
+
+    (void)std::snprintf(value, sizeof(value), "%u", static_cast<unsigned int>(
+        (ConfigPtr->BufferLength > 0U) ? ConfigPtr->BufferLength : ADC_IIO_BUFFER_LENGTH));
+    if (!Adc_Iio_WriteAttr(dir + "/buffer/length", value) ||
+        !Adc_Iio_WriteAttr(dir + "/buffer/enable", "1")) {
+        return E_NOT_OK;
+    }
+
+    node = (ConfigPtr->DeviceNode != NULL_PTR) ? std::string(ConfigPtr->DeviceNode) :
+           ("/dev/" + dir.substr(dir.find_last_of('/') + 1U));
+    Adc_IioFd = open(node.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (Adc_IioFd < 0) {
+        return E_NOT_OK;
+    }
+
+    Adc_IioScanCount = 0U;
+    Adc_IioReadCalls = 0U;
+    return E_OK;
+#else
+    STD_UNUSED(ConfigPtr);
+    return E_NOT_OK;
+#endif
+}
+
+/**
+ * @brief Stop capture and return to the simulation backend
+ */
+static void Adc_Iio_Close(void) {
+#if defined(__linux__)
+    if (Adc_IioFd >= 0) {
+        (void)close(Adc_IioFd);
+        Adc_IioFd = -1;
+    }
+
+    /* Device touched by Adc_Iio_Open: leave it with capture stopped */
+    if (!Adc_IioDir.empty()) {
+        (void)Adc_Iio_WriteAttr(Adc_IioDir + "/buffer/enable", "0");
+        (void)Adc_Iio_DisableElements(Adc_IioDir + "/scan_elements");
+        Adc_IioDir.clear();
+    }
+#endif
+    Adc_IioActive = FALSE;
+    Adc_IioNumElements = 0U;
+}
+
+/**
+ * @brief Disable all scan elements of a device
+ * @return FALSE if the device has no scan elements directory
+ */
+static boolean Adc_Iio_DisableElements(const std::string& scanDir) {
+#if defined(__linux__)
+    DIR* elements = opendir(scanDir.c_str());
+    struct dirent* entry;
+
+    if (elements == NULL_PTR) {
+        return FALSE;
+    }
+
+    while ((entry = readdir(elements)) != NULL_PTR) {
+        const size_t len = std::strlen(entry->d_name);
+        if ((len > 3U) && (std::strcmp(&entry->d_name[len - 3U], "_en") == 0)) {
+            (void)Adc_Iio_WriteAttr(scanDir + "/" + entry->d_name, "0");
+        }
+    }
+    (void)closedir(elements);
+
+    return TRUE;
+#else
+    STD_UNUSED(scanDir);
+    return FALSE;
+#endif
+}
+
+/**
+ * @brief Enable a scan element and record its type
+ * @details Type format "[be|le]:[s|u]bits/storagebits>>shift"; repeated
+ *          elements are not supported
+ * @return TRUE if the element exists and was enabled
+ */
+static boolean Adc_Iio_AddElement(const std::string& scanDir, const char* name,
+                                  Adc_ChannelType Channel) {
+    const std::string base = scanDir + "/" + name;
+    Adc_IioElementType* element;
+    char value[32];
+    char endian;
+    char sign;
+    unsigned int index;
+    unsigned int realBits;
+    unsigned int storageBits;
+    unsigned int shift;
+
+    if (Adc_IioNumElements >= ADC_IIO_MAX_ELEMENTS) {
+        return FALSE;
+    }
+    element = &Adc_IioElements[Adc_IioNumElements];
+
+    if (!Adc_Iio_ReadAttr(base + "_index", value, sizeof(value)) ||
+        (std::sscanf(value, "%u", &index) != 1)) {
+        return FALSE;
+    }
+    if (!Adc_Iio_ReadAttr(base + "_type", value, sizeof(value)) ||
+        (std::strchr(value, 'X') != NULL_PTR) ||
+        (std::sscanf(value, "%ce:%c%u/%u>>%u", &endian, &sign, &realBits,
+                     &storageBits, &shift) != 5)) {
+        return FALSE;
+    }
+    if ((realBits == 0U) || ((realBits + shift) > storageBits) ||
+        ((storageBits != 8U) && (storageBits != 16U) &&
+         (storageBits != 32U) && (storageBits != 64U))) {
+        return FALSE;
+    }
+    if (!Adc_Iio_WriteAttr(base + "_en", "1")) {
+        return FALSE;
+    }
+
+    element->Channel = Channel;
+    element->Index = static_cast<uint16_t>(index);
+    element->Offset = 0U;
+    element->StorageBytes = static_cast<uint8_t>(storageBits / 8U);
+    element->RealBits = static_cast<uint8_t>(realBits);
+    element->Shift = static_cast<uint8_t>(shift);
+    element->Signed = (sign == 's') ? TRUE : FALSE;
+    element->BigEndian = (endian == 'b') ? TRUE : FALSE;
+    Adc_IioNumElements++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Read and decode all scans captured so far
+ * @details Up to ADC_IIO_READ_SCANS scans per read(); a short read means the
+ *          kernel buffer is empty, so no extra read is spent on EAGAIN
+ * @return Number of scans captured since Adc_SetBackend
+ */
+static uint64_t Adc_Iio_Drain(void) {
+#if defined(__linux__)
+    const size_t capacity = static_cast<size_t>(ADC_IIO_READ_SCANS) * Adc_IioScanBytes;
+    ssize_t bytes;
+    size_t numScans;
+    size_t n;
+    uint8_t e;
+
+    if (Adc_IioFd < 0) {
+        return Adc_IioScanCount;
+    }
+
+    do {
+        bytes = read(Adc_IioFd, Adc_IioRaw, capacity);
+        Adc_IioReadCalls++;
+        if (bytes <= 0) {
+            break;
+        }
+
+        numScans = static_cast<size_t>(bytes) / Adc_IioScanBytes;
+        for (n = 0U; n < numScans; n++) {
+            const uint8_t* scan = &Adc_IioRaw[n * Adc_IioScanBytes];
+            const uint32_t slot = static_cast<uint32_t>(Adc_IioScanCount % ADC_IIO_RING_SCANS);
+            for (e = 0U; e < Adc_IioNumElements; e++) {
+                Adc_IioRing[Adc_IioElements[e].Channel][slot] =
+                    Adc_Iio_Decode(&Adc_IioElements[e], scan);
+            }
+            Adc_IioScanCount++;
+        }
+    } while (static_cast<size_t>(bytes) == capacity);
+#endif
+    return Adc_IioScanCount;
+}
+
+/**
+ * @brief Decode one element of a scan to an ADC value
+ * @details Scaled to ADC_RESOLUTION_BITS; negative values read as 0
+ */
+static Adc_ValueGroupType Adc_Iio_Decode(const Adc_IioElementType* element,
+                                         const uint8_t* scan) {
+    const uint8_t* data = &scan[element->Offset];
+    uint8_t valueBits = element->RealBits;
+    uint64_t raw = 0U;
+    uint8_t b;
+
+    for (b = 0U; b < element->StorageBytes; b++) {
+        const uint8_t byte = element->BigEndian ?
+                             data[element->StorageBytes - 1U - b] : data[b];
+        raw |= static_cast<uint64_t>(byte) << (8U * b);
+    }
+
+    raw >>= element->Shift;
+    if (element->RealBits < 64U) {
+        raw &= (static_cast<uint64_t>(1U) << element->RealBits) - 1U;
+    }
+
+    if (element->Signed) {
+        if ((raw >> (element->RealBits - 1U)) != 0U) {
+            return 0U;
+        }
+        valueBits = static_cast<uint8_t>(valueBits - 1U);
+    }
+
+    if (valueBits > ADC_RESOLUTION_BITS) {
+        raw >>= (valueBits - ADC_RESOLUTION_BITS);
+    } else {
+        raw <<= (ADC_RESOLUTION_BITS - valueBits);
+    }
+
+    return static_cast<Adc_ValueGroupType>((raw > ADC_MAX_VALUE) ? ADC_MAX_VALUE : raw);
+}
+
+/**
+ * @brief Samples of one channel from the decoded scans
+ * @details Scans not captured yet read as the latest scan, scans that left
+ *          the ring as the oldest kept one. Channels without a scan element
+ *          keep the simulated value.
+ * @param[in] Channel Channel
+ * @param[in] firstScan Scan of the first sample
+ * @param[in] step Scans between samples (0 = repeat)
+ * @param[in] numSamples Samples to deliver
+ * @param[out] samples Destination
+ */
+static void Adc_Iio_Fill(Adc_ChannelType Channel, uint64_t firstScan, uint32_t step,
+                         uint16_t numSamples, Adc_ValueGroupType* samples) {
+    const uint64_t oldest = (Adc_IioScanCount > ADC_IIO_RING_SCANS) ?
+                            (Adc_IioScanCount - ADC_IIO_RING_SCANS) : 0U;
+    uint64_t scan;
+    uint16_t j;
+
+    for (j = 0U; j < numSamples; j++) {
+        if ((Channel >= ADC_NUM_CHANNELS) || (Adc_IioScanCount == 0U) ||
+            (Adc_IioChannelElement[Channel] == ADC_IIO_ELEMENT_NONE)) {
+            samples[j] = (Channel < ADC_NUM_CHANNELS) ? Adc_SimValues[Channel] : 0U;
+            continue;
+        }
+
+        scan = firstScan + (static_cast<uint64_t>(j) * step);
+        if (scan >= Adc_IioScanCount) {
+            scan = Adc_IioScanCount - 1U;
+        } else if (scan < oldest) {
+            scan = oldest;
+        }
+        samples[j] = Adc_IioRing[Channel][scan % ADC_IIO_RING_SCANS];
+    }
+}
+
+static boolean Adc_Iio_WriteAttr(const std::string& path, const char* value) {
+    FILE* file = std::fopen(path.c_str(), "w");
+    boolean ok;
+
+    if (file == NULL_PTR) {
+        return FALSE;
+    }
+
+    ok = (std::fputs(value, file) >= 0) ? TRUE : FALSE;
+    if (std::fclose(file) != 0) {
+        ok = FALSE;
+    }
+
+    return ok;
+}
+
+static boolean Adc_Iio_ReadAttr(const std::string& path, char* value, size_t size) {
+    FILE* file = std::fopen(path.c_str(), "r");
+    boolean ok;
+
+    if (file == NULL_PTR) {
+        return FALSE;
+    }
+
+    ok = (std::fgets(value, static_cast<int>(size), file) != NULL_PTR) ? TRUE : FALSE;
+    (void)std::fclose(file);
+
+    return ok;
 }
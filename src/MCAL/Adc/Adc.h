@@ -1,7 +1,10 @@
 /**
  * @file Adc.h
  * @brief AUTOSAR ADC Driver Interface
- * @details MCAL ADC driver stub for simulation
+ * @details MCAL ADC driver with multi-channel groups, continuous conversion
+ *          and streaming into caller provided result buffers (DMA style).
+ *          Samples come from the simulation or from a Linux IIO device in
+ *          buffered (triggered) capture mode.
  * @version 1.0.0
  * @date 2024
  *
@@ -15,6 +18,7 @@
  * INCLUDES
  *============================================================================*/
 #include "Std_Types.h"
+#include "Adc_Cfg.h"
 
 /*============================================================================*
  * VERSION INFORMATION
@@ -42,6 +46,21 @@
 /** @brief Enable development error detection */
 #define ADC_DEV_ERROR_DETECT                STD_ON
 
+/** @brief Default IIO device (sysfs directory) */
+#define ADC_IIO_DEVICE_PATH                 "/sys/bus/iio/devices/iio:device0"
+
+/** @brief Default kernel buffer length of the IIO device (scans) */
+#define ADC_IIO_BUFFER_LENGTH               256U
+
+/** @brief Decoded scans kept per channel (>= deepest streaming group) */
+#define ADC_IIO_RING_SCANS                  512U
+
+/** @brief Scans fetched with one read() */
+#define ADC_IIO_READ_SCANS                  64U
+
+/** @brief Maximum size of one scan (bytes) */
+#define ADC_IIO_MAX_SCAN_BYTES              64U
+
 /*============================================================================*
  * TYPE DEFINITIONS
  *============================================================================*/
@@ -92,6 +111,94 @@ typedef enum {
  */
 typedef uint8_t Adc_GroupPriorityType;
 
+/**
+ * @brief Number of samples per channel in a streaming buffer
+ */
+typedef uint16_t Adc_StreamNumSampleType;
+
+/**
+ * @brief ADC group access mode type
+ */
+typedef enum {
+    ADC_ACCESS_MODE_SINGLE      = 0x00U,    /**< One sample per channel */
+    ADC_ACCESS_MODE_STREAMING   = 0x01U     /**< StreamingNumSamples per channel */
+} Adc_GroupAccessModeType;
+
+/**
+ * @brief ADC streaming buffer mode type
+ */
+typedef enum {
+    ADC_STREAM_BUFFER_LINEAR    = 0x00U,    /**< Stop when the buffer is full */
+    ADC_STREAM_BUFFER_CIRCULAR  = 0x01U     /**< Overwrite the oldest samples */
+} Adc_StreamBufferModeType;
+
+/**
+ * @brief Group notification (conversion / stream completed)
+ */
+typedef void (*Adc_NotificationType)(void);
+
+/**
+ * @brief ADC backend type
+ */
+typedef enum {
+    ADC_BACKEND_SIMULATION  = 0x00U,    /**< Simulated values / sample source */
+    ADC_BACKEND_IIO         = 0x01U     /**< Linux IIO buffered capture */
+} Adc_BackendIdType;
+
+/**
+ * @brief ADC backend configuration type
+ * @details The IIO device must offer a buffer; a trigger drives the capture
+ *          (e.g. an hrtimer trigger). Each captured scan is one conversion
+ *          round of the continuous groups.
+ */
+typedef struct {
+    Adc_BackendIdType Backend;          /**< Selected backend */
+    const char* DevicePath;             /**< IIO device sysfs directory
+                                             (NULL_PTR = ADC_IIO_DEVICE_PATH) */
+    const char* DeviceNode;             /**< Character device (NULL_PTR =
+                                             /dev/<device directory name>) */
+    const char* TriggerName;            /**< Trigger (NULL_PTR = keep current) */
+    const char* const* ScanElements;    /**< Scan element per channel, e.g.
+                                             "in_voltage0", NULL_PTR entries are
+                                             unmapped (NULL_PTR = in_voltage<n>
+                                             where present) */
+    uint16_t BufferLength;              /**< Kernel buffer length (0 = default) */
+} Adc_BackendConfigType;
+
+/**
+ * @brief IIO capture statistics
+ */
+typedef struct {
+    uint32_t ReadCalls;                 /**< read() calls on the device node */
+    uint64_t Scans;                     /**< Scans captured and decoded */
+} Adc_IioStatsType;
+
+/**
+ * @brief Simulated sample source
+ * @details Delivers the samples of one channel converted at
+ *          firstUs + i * periodUs, i = 0 .. numSamples - 1
+ */
+typedef void (*Adc_SimSampleSourceType)(
+    Adc_ChannelType Channel,
+    uint64_t firstUs,
+    uint32_t periodUs,
+    uint16_t numSamples,
+    Adc_ValueGroupType* samples
+);
+
+/**
+ * @brief Conversion hook (e.g. input recorder)
+ * @details Sees the samples of one channel converted at
+ *          firstUs + i * periodUs that did not come from a channel source
+ */
+typedef void (*Adc_SimConversionHookType)(
+    Adc_ChannelType Channel,
+    uint64_t firstUs,
+    uint32_t periodUs,
+    uint16_t numSamples,
+    const Adc_ValueGroupType* samples
+);
+
 /**
  * @brief ADC channel configuration type
  */
@@ -111,24 +218,67 @@ typedef struct {
     Adc_GroupPriorityType Priority;     /**< Group priority */
     uint8_t NumChannels;                /**< Number of channels in group */
     const Adc_ChannelType* Channels;    /**< Pointer to channel list */
+    Adc_GroupAccessModeType AccessMode; /**< Single or streaming access */
+    Adc_StreamBufferModeType BufferMode;/**< Streaming buffer mode */
+    Adc_StreamNumSampleType StreamingNumSamples; /**< Samples per channel (1 = single) */
+    uint16_t ConversionPeriodUs;        /**< Continuous conversion period */
+    Adc_NotificationType Notification;  /**< Completion notification (NULL_PTR = none) */
 } Adc_GroupConfigType;
 
 /**
  * @brief ADC configuration type
  */
 typedef struct {
-    uint8_t NumGroups;                      /**< Number of groups */
+    uint8_t NumGroups;                      /**< Number of groups (0 = Adc_GroupConfig) */
     const Adc_GroupConfigType* Groups;      /**< Pointer to group config */
     uint8_t NumChannels;                    /**< Number of channels */
     const Adc_ChannelConfigType* Channels;  /**< Pointer to channel config */
 } Adc_ConfigType;
 
+/**
+ * @brief Runtime state of a group
+ */
+typedef struct {
+    Adc_ValueGroupType* Buffer;             /**< Result buffer */
+    Adc_StatusType Status;                  /**< Conversion status */
+    boolean Running;                        /**< Continuous conversion active */
+    boolean NotificationEnabled;            /**< Notification enabled */
+    Adc_StreamNumSampleType WriteIndex;     /**< Next sample slot */
+    Adc_StreamNumSampleType NewSamples;     /**< Samples since the previous read */
+    uint64_t NextConversion;                /**< Due time (us) of the next round,
+                                                 next scan on the IIO backend */
+} Adc_GroupStateType;
+
+/**
+ * @brief ADC driver snapshot (Ecu_SaveSnapshot)
+ * @details The result buffers of the groups are referenced, not copied:
+ *          the snapshot is valid within the process that took it
+ */
+typedef struct {
+    Adc_ValueGroupType SimValues[ADC_NUM_CHANNELS];
+    Adc_GroupStateType GroupState[ADC_MAX_GROUPS];
+    Adc_ValueGroupType InternalResults[ADC_MAX_GROUPS][ADC_MAX_GROUP_CHANNELS];
+    uint64_t SimTimeUs;
+    boolean SimTimeEnabled;
+} Adc_SnapshotType;
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Groups of the FLM ECU, indexed by group ID (Adc_Cfg.cpp) */
+extern const Adc_GroupConfigType Adc_GroupConfig[ADC_NUM_GROUPS];
+
+/** @brief ADC configuration of the FLM ECU */
+extern const Adc_ConfigType Adc_Config;
+
 /*============================================================================*
  * FUNCTION PROTOTYPES
  *============================================================================*/
 
 /**
  * @brief Initialize ADC driver
+ * @details A configuration without groups selects Adc_GroupConfig
  * @param[in] ConfigPtr Pointer to configuration
  */
 void Adc_Init(const Adc_ConfigType* ConfigPtr);
@@ -138,8 +288,21 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr);
  */
 void Adc_DeInit(void);
 
+/**
+ * @brief Set up the result buffer of a group
+ * @details The buffer holds StreamingNumSamples per channel, all samples of
+ *          the first channel first. Single access groups without a buffer use
+ *          a driver internal one. Only allowed while the group is idle.
+ * @param[in] Group Group
+ * @param[in] DataBufferPtr Result buffer
+ * @return E_OK on success, E_NOT_OK if the group is not idle
+ */
+Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr);
+
 /**
  * @brief Start group conversion
+ * @details One-shot groups complete at once in simulation, continuous groups
+ *          convert every ConversionPeriodUs until stopped
  * @param[in] Group Group to start
  */
 void Adc_StartGroupConversion(Adc_GroupType Group);
@@ -152,12 +315,40 @@ void Adc_StopGroupConversion(Adc_GroupType Group);
 
 /**
  * @brief Read group conversion results
+ * @details Returns the latest sample of every channel of the group
  * @param[in] Group Group to read
- * @param[out] DataBufferPtr Pointer to result buffer
+ * @param[out] DataBufferPtr Pointer to result buffer (one value per channel)
  * @return E_OK if successful
  */
 Std_ReturnType Adc_ReadGroup(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr);
 
+/**
+ * @brief Get the latest sample in the result buffer
+ * @param[in] Group Group to read
+ * @param[out] PtrToSamplePtr Latest sample of the first channel
+ * @return Samples per channel converted since the previous read (at most
+ *         StreamingNumSamples), 0 if none
+ */
+Adc_StreamNumSampleType Adc_GetStreamLastPointer(
+    Adc_GroupType Group,
+    Adc_ValueGroupType** PtrToSamplePtr
+);
+
+/**
+ * @brief Copy the samples converted since the previous read
+ * @details Block access for oversampling consumers: samples are copied
+ *          oldest first, all samples of the first channel first
+ * @param[in] Group Group to read
+ * @param[out] DataBufferPtr Destination (MaxSamples per channel)
+ * @param[in] MaxSamples Capacity per channel, newest samples are kept
+ * @return Samples per channel copied, 0 if none
+ */
+Adc_StreamNumSampleType Adc_ReadGroupStream(
+    Adc_GroupType Group,
+    Adc_ValueGroupType* DataBufferPtr,
+    Adc_StreamNumSampleType MaxSamples
+);
+
 /**
  * @brief Get group status
  * @param[in] Group Group to query
@@ -177,12 +368,61 @@ void Adc_EnableHardwareTrigger(Adc_GroupType Group);
  */
 void Adc_DisableHardwareTrigger(Adc_GroupType Group);
 
+/**
+ * @brief Enable group notification
+ * @param[in] Group Group
+ */
+void Adc_EnableGroupNotification(Adc_GroupType Group);
+
+/**
+ * @brief Disable group notification
+ * @param[in] Group Group
+ */
+void Adc_DisableGroupNotification(Adc_GroupType Group);
+
+/**
+ * @brief Advance continuous conversions and call notifications
+ * @details Simulates the conversion end interrupt. Reads catch up on their
+ *          own, cyclic calls are only needed for timely notifications.
+ */
+void Adc_MainFunction(void);
+
+/**
+ * @brief Select the ADC backend
+ * @details Call after Adc_Init. The IIO backend enables the mapped scan
+ *          elements, sets the trigger and starts the device buffer; on failure
+ *          the driver stays on the simulation backend.
+ * @param[in] ConfigPtr Pointer to configuration
+ * @return E_OK on success, E_NOT_OK if the IIO device could not be set up
+ */
+Std_ReturnType Adc_SetBackend(const Adc_BackendConfigType* ConfigPtr);
+
+/**
+ * @brief Get IIO capture statistics
+ * @param[out] Stats Pointer to receive statistics
+ */
+void Adc_GetIioStats(Adc_IioStatsType* Stats);
+
 /**
  * @brief Get version information
  * @param[out] versioninfo Pointer to version info
  */
 void Adc_GetVersionInfo(Std_VersionInfoType* versioninfo);
 
+/**
+ * @brief Save group states and simulated values (Ecu_SaveSnapshot)
+ * @param[out] Snapshot Group states and simulated values
+ */
+void Adc_SaveSnapshot(Adc_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore group states and simulated values (Ecu_RestoreSnapshot)
+ * @details The ADC must be initialized with the configuration of the
+ *          snapshot
+ * @param[in] Snapshot Group states and simulated values
+ */
+void Adc_RestoreSnapshot(const Adc_SnapshotType* Snapshot);
+
 /*============================================================================*
  * SIMULATION FUNCTIONS (FOR TESTING)
  *============================================================================*/
@@ -203,8 +443,42 @@ Adc_ValueGroupType Adc_SimGetValue(Adc_ChannelType Channel);
 
 /**
  * @brief Trigger conversion complete (for simulation)
+ * @details Converts one round of the group now
  * @param[in] Group Group to complete
  */
 void Adc_SimTriggerComplete(Adc_GroupType Group);
 
+/**
+ * @brief Set simulated conversion time base
+ * @details Replaces the monotonic clock until Adc_DeInit; set before
+ *          Adc_Init to start the continuous groups in virtual time
+ * @param[in] timeUs Timestamp in microseconds
+ */
+void Adc_SimSetTimeUs(uint64_t timeUs);
+
+/**
+ * @brief Set simulated sample source (e.g. stimulus waveforms)
+ * @details Replaces the Adc_SimSetValue levels for all conversions
+ * @param[in] Source Sample source, NULL_PTR to use Adc_SimSetValue levels
+ */
+void Adc_SimSetSampleSource(Adc_SimSampleSourceType Source);
+
+/**
+ * @brief Set simulated sample source of one channel (e.g. a plant model)
+ * @details Takes precedence over the sample source and the Adc_SimSetValue
+ *          level of that channel
+ * @param[in] Channel Channel to feed
+ * @param[in] Source Sample source, NULL_PTR to remove
+ */
+void Adc_SimSetChannelSource(Adc_ChannelType Channel, Adc_SimSampleSourceType Source);
+
+/**
+ * @brief Set conversion hook
+ * @details Called for every converted block of the channels fed by the IIO
+ *          device, the sample source or the Adc_SimSetValue levels; channels
+ *          with a channel source (plant models) are not reported
+ * @param[in] Hook Conversion hook, NULL_PTR to remove
+ */
+void Adc_SimSetConversionHook(Adc_SimConversionHookType Hook);
+
 #endif /* ADC_H */
@@ -12,43 +12,10 @@
  * INCLUDES
  *============================================================================*/
 #include "Can.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
 #include <cstring>
 
-/*============================================================================*
- * LOCAL TYPES
- *============================================================================*/
-
-/**
- * @brief RX message buffer entry
- */
-typedef struct {
-    Can_IdType canId;
-    uint8_t dlc;
-    uint8_t data[CAN_MAX_DATA_LENGTH];
-    boolean used;
-} Can_RxBufferEntryType;
-
-/**
- * @brief TX message buffer entry
- */
-typedef struct {
-    PduIdType pduId;
-    Can_IdType canId;
-    uint8_t dlc;
-    uint8_t data[CAN_MAX_DATA_LENGTH];
-    boolean pending;
-} Can_TxBufferEntryType;
-
-/**
- * @brief Controller state structure
- */
-typedef struct {
-    Can_ControllerStateType state;
-    Can_ErrorStateType errorState;
-    boolean interruptsEnabled;
-    boolean busOffPending;
-} Can_ControllerStateStruct;
-
 /*============================================================================*
  * LOCAL VARIABLES
  *============================================================================*/
@@ -79,6 +46,9 @@ static boolean Can_LastTxMessageValid = FALSE;
 /** @brief TX message counter */
 static uint32_t Can_TxCounter = 0U;
 
+/** @brief Simulated reception hook (NULL_PTR = none) */
+static Can_SimRxHookType Can_SimRxHook = NULL_PTR;
+
 /** @brief Callbacks */
 static Can_RxIndicationFctType Can_RxIndicationCallback = NULL_PTR;
 static Can_TxConfirmationFctType Can_TxConfirmationCallback = NULL_PTR;
@@ -233,6 +203,7 @@ Can_ReturnType Can_Write(Can_HwHandleType Hth, const Can_PduType* PduInfo) {
     }
 
     if (Can_TxBufferCount >= CAN_TX_BUFFER_SIZE) {
+        Metrics_Increment(METRICS_CAN_TX_DROPPED);
         return CAN_BUSY;
     }
 
@@ -260,7 +231,11 @@ void Can_MainFunction_Write(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_CAN_WRITE);
+
     Can_ProcessTxBuffer();
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_CAN_WRITE);
 }
 
 /**
@@ -271,7 +246,11 @@ void Can_MainFunction_Read(void) {
         return;
     }
 
+    TRACE_RUNNABLE_ENTRY(TRACE_RUNNABLE_CAN_READ);
+
     Can_ProcessRxBuffer();
+
+    TRACE_RUNNABLE_EXIT(TRACE_RUNNABLE_CAN_READ);
 }
 
 /**
@@ -351,6 +330,38 @@ Std_ReturnType Can_CheckWakeup(uint8_t Controller) {
     return E_NOT_OK;  /* No wakeup in simulation */
 }
 
+/**
+ * @brief Save controller states and message buffers
+ */
+void Can_SaveSnapshot(Can_SnapshotType* Snapshot) {
+    (void)memcpy(Snapshot->ControllerStates, Can_ControllerStates, sizeof(Can_ControllerStates));
+    (void)memcpy(Snapshot->RxBuffer, Can_RxBuffer, sizeof(Can_RxBuffer));
+    Snapshot->RxBufferHead = Can_RxBufferHead;
+    Snapshot->RxBufferTail = Can_RxBufferTail;
+    Snapshot->RxBufferCount = Can_RxBufferCount;
+    (void)memcpy(Snapshot->TxBuffer, Can_TxBuffer, sizeof(Can_TxBuffer));
+    Snapshot->TxBufferCount = Can_TxBufferCount;
+    Snapshot->LastTxMessage = Can_LastTxMessage;
+    Snapshot->LastTxMessageValid = Can_LastTxMessageValid;
+    Snapshot->TxCounter = Can_TxCounter;
+}
+
+/**
+ * @brief Restore controller states and message buffers
+ */
+void Can_RestoreSnapshot(const Can_SnapshotType* Snapshot) {
+    (void)memcpy(Can_ControllerStates, Snapshot->ControllerStates, sizeof(Can_ControllerStates));
+    (void)memcpy(Can_RxBuffer, Snapshot->RxBuffer, sizeof(Can_RxBuffer));
+    Can_RxBufferHead = Snapshot->RxBufferHead;
+    Can_RxBufferTail = Snapshot->RxBufferTail;
+    Can_RxBufferCount = Snapshot->RxBufferCount;
+    (void)memcpy(Can_TxBuffer, Snapshot->TxBuffer, sizeof(Can_TxBuffer));
+    Can_TxBufferCount = Snapshot->TxBufferCount;
+    Can_LastTxMessage = Snapshot->LastTxMessage;
+    Can_LastTxMessageValid = Snapshot->LastTxMessageValid;
+    Can_TxCounter = Snapshot->TxCounter;
+}
+
 /*============================================================================*
  * CALLBACK CONFIGURATION
  *============================================================================*/
@@ -400,6 +411,7 @@ static void Can_ProcessTxBuffer(void) {
             Can_LastTxMessage = Can_TxBuffer[i];
             Can_LastTxMessageValid = TRUE;
             Can_TxCounter++;
+            Metrics_Increment(METRICS_CAN_TX);
 
             /* Call TX confirmation */
             if (Can_TxConfirmationCallback != NULL_PTR) {
@@ -420,7 +432,9 @@ void Can_SimReceiveMessage(uint8_t Controller,
                            Can_IdType CanId,
                            uint8_t Dlc,
                            const uint8_t* Data) {
-    STD_UNUSED(Controller);
+    if (Can_SimRxHook != NULL_PTR) {
+        Can_SimRxHook(Controller, CanId, Dlc, Data);
+    }
 
     if (!Can_Initialized) {
         return;
@@ -431,6 +445,7 @@ void Can_SimReceiveMessage(uint8_t Controller,
     }
 
     if (Can_RxBufferCount >= CAN_RX_FIFO_SIZE) {
+        Metrics_Increment(METRICS_CAN_RX_DROPPED);
         return;  /* Buffer full */
     }
 
@@ -441,6 +456,7 @@ void Can_SimReceiveMessage(uint8_t Controller,
 
     Can_RxBufferHead = (Can_RxBufferHead + 1U) % CAN_RX_FIFO_SIZE;
     Can_RxBufferCount++;
+    Metrics_Increment(METRICS_CAN_RX);
 }
 
 boolean Can_SimGetLastTxMessage(Can_IdType* CanId, uint8_t* Dlc, uint8_t* Data) {
@@ -483,3 +499,7 @@ void Can_SimTriggerBusOff(uint8_t Controller) {
 uint32_t Can_SimGetTxCount(void) {
     return Can_TxCounter;
 }
+
+void Can_SimSetRxHook(Can_SimRxHookType Hook) {
+    Can_SimRxHook = Hook;
+}
@@ -112,6 +112,53 @@ typedef struct {
     const Can_ControllerConfigType* Controllers; /**< Controllers config */
 } Can_ConfigType;
 
+/**
+ * @brief RX message buffer entry
+ */
+typedef struct {
+    Can_IdType canId;
+    uint8_t dlc;
+    uint8_t data[CAN_MAX_DATA_LENGTH];
+    boolean used;
+} Can_RxBufferEntryType;
+
+/**
+ * @brief TX message buffer entry
+ */
+typedef struct {
+    PduIdType pduId;
+    Can_IdType canId;
+    uint8_t dlc;
+    uint8_t data[CAN_MAX_DATA_LENGTH];
+    boolean pending;
+} Can_TxBufferEntryType;
+
+/**
+ * @brief Controller state structure
+ */
+typedef struct {
+    Can_ControllerStateType state;
+    Can_ErrorStateType errorState;
+    boolean interruptsEnabled;
+    boolean busOffPending;
+} Can_ControllerStateStruct;
+
+/**
+ * @brief CAN driver snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    Can_ControllerStateStruct ControllerStates[CAN_NUM_CONTROLLERS];
+    Can_RxBufferEntryType RxBuffer[CAN_RX_FIFO_SIZE];
+    uint8_t RxBufferHead;
+    uint8_t RxBufferTail;
+    uint8_t RxBufferCount;
+    Can_TxBufferEntryType TxBuffer[CAN_TX_BUFFER_SIZE];
+    uint8_t TxBufferCount;
+    Can_TxBufferEntryType LastTxMessage;
+    boolean LastTxMessageValid;
+    uint32_t TxCounter;
+} Can_SnapshotType;
+
 /**
  * @brief RX indication callback type
  */
@@ -120,6 +167,14 @@ typedef void (*Can_RxIndicationFctType)(Can_HwHandleType Hrh,
                                          uint8_t CanDlc,
                                          const uint8_t* CanSduPtr);
 
+/**
+ * @brief Simulated reception hook type (e.g. input recorder)
+ */
+typedef void (*Can_SimRxHookType)(uint8_t Controller,
+                                  Can_IdType CanId,
+                                  uint8_t Dlc,
+                                  const uint8_t* Data);
+
 /**
  * @brief TX confirmation callback type
  */
@@ -229,6 +284,18 @@ void Can_DisableControllerInterrupts(uint8_t Controller);
  */
 Std_ReturnType Can_CheckWakeup(uint8_t Controller);
 
+/**
+ * @brief Save controller states and message buffers (Ecu_SaveSnapshot)
+ * @param[out] Snapshot Controller states and message buffers
+ */
+void Can_SaveSnapshot(Can_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore controller states and message buffers (Ecu_RestoreSnapshot)
+ * @param[in] Snapshot Controller states and message buffers
+ */
+void Can_RestoreSnapshot(const Can_SnapshotType* Snapshot);
+
 /*============================================================================*
  * CALLBACK CONFIGURATION
  *============================================================================*/
@@ -276,6 +343,13 @@ void Can_SimReceiveMessage(uint8_t Controller,
  */
 boolean Can_SimGetLastTxMessage(Can_IdType* CanId, uint8_t* Dlc, uint8_t* Data);
 
+/**
+ * @brief Set simulated reception hook
+ * @details Called with every Can_SimReceiveMessage before it is checked
+ * @param[in] Hook Reception hook, NULL_PTR to remove
+ */
+void Can_SimSetRxHook(Can_SimRxHookType Hook);
+
 /**
  * @brief Clear RX buffer
  * @param[in] Controller Controller ID
@@ -1,7 +1,12 @@
 /**
  * @file Dio.cpp
  * @brief AUTOSAR DIO Driver Implementation
- * @details MCAL DIO driver stub for simulation
+ * @details MCAL DIO driver with simulation and Linux GPIO character device
+ *          backends. Ports are packed bitmasks (bit n = channel n of the
+ *          port); writes to several channels of a port are one
+ *          compare-and-swap, so concurrent readers see either the old or the
+ *          new port value. The GPIO backend holds one line request per port
+ *          and pushes a changed output register with one SET_VALUES ioctl.
  * @version 1.0.0
  * @date 2024
  *
@@ -12,6 +17,76 @@
  * INCLUDES
  *============================================================================*/
 #include "Dio.h"
+#include <atomic>
+#include <mutex>
+#include <cstring>
+#include <ctime>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#endif
+
+/*============================================================================*
+ * LOCAL TYPES AND MACROS
+ *============================================================================*/
+
+/** @brief Port mask of a channel */
+#define DIO_CHANNEL_MASK(ChannelId) \
+    static_cast<Dio_PortLevelType>(1U << DIO_CHANNEL_BIT(ChannelId))
+
+STD_STATIC_ASSERT(DIO_CHANNELS_PER_PORT == (8U * sizeof(Dio_PortLevelType)),
+                  "A port must fit into Dio_PortLevelType");
+STD_STATIC_ASSERT(DIO_NUM_CHANNELS <= (DIO_NUM_PORTS * DIO_CHANNELS_PER_PORT),
+                  "DIO channels exceed the configured ports");
+
+/**
+ * @brief DIO backend operations
+ */
+typedef struct {
+    const char* Name;
+    void (*Configure)(Dio_PortType PortId);     /**< Apply port directions */
+    void (*Write)(Dio_PortType PortId);         /**< Push output register */
+    Dio_PortLevelType (*ReadInputs)(Dio_PortType PortId,
+                                    Dio_PortLevelType Mask);  /**< Input levels */
+} Dio_BackendType;
+
+/**
+ * @brief GPIO line request of a port
+ */
+typedef struct {
+    int Fd;                                     /**< Line request fd */
+    uint8_t NumLines;                           /**< Requested lines, 0 = no request */
+    uint8_t LineBit[DIO_CHANNELS_PER_PORT];     /**< Port bit of request line i */
+    Dio_PortLevelType Mapped;                   /**< Port bits with a line */
+} Dio_GpioPortType;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static Dio_PortLevelType Dio_PortLevel(Dio_PortType PortId);
+static void Dio_UpdatePort(Dio_PortType PortId, Dio_PortLevelType Level,
+                           Dio_PortLevelType Mask);
+static void Dio_ConfigureAllPorts(void);
+
+static void Dio_Sim_Configure(Dio_PortType PortId);
+static void Dio_Sim_Write(Dio_PortType PortId);
+static Dio_PortLevelType Dio_Sim_ReadInputs(Dio_PortType PortId, Dio_PortLevelType Mask);
+
+static Std_ReturnType Dio_Gpio_Open(const Dio_ConfigType* ConfigPtr);
+static void Dio_Gpio_Close(void);
+static void Dio_Gpio_Configure(Dio_PortType PortId);
+static void Dio_Gpio_Write(Dio_PortType PortId);
+static Dio_PortLevelType Dio_Gpio_ReadInputs(Dio_PortType PortId, Dio_PortLevelType Mask);
+#if defined(__linux__)
+static void Dio_Gpio_BuildConfig(Dio_PortType PortId, struct gpio_v2_line_config* Config);
+#endif
+static uint64_t Dio_Gpio_ToLines(Dio_PortType PortId, Dio_PortLevelType Level);
+static Dio_PortLevelType Dio_Gpio_FromLines(Dio_PortType PortId, uint64_t Bits);
+static uint64_t Dio_GetMonotonicNs(void);
 
 /*============================================================================*
  * LOCAL VARIABLES
@@ -20,14 +95,39 @@
 /** @brief Initialization flag */
 static boolean Dio_Initialized = FALSE;
 
-/** @brief Output channel levels */
-static Dio_LevelType Dio_OutputLevels[DIO_NUM_CHANNELS];
+/** @brief Output levels per port */
+static std::atomic<Dio_PortLevelType> Dio_PortOutput[DIO_NUM_PORTS];
+
+/** @brief Simulated input levels per port */
+static std::atomic<Dio_PortLevelType> Dio_PortSimInput[DIO_NUM_PORTS];
+
+/** @brief Simulated input hook (NULL_PTR = none) */
+static Dio_SimInputHookType Dio_SimInputHook = NULL_PTR;
+
+/** @brief Channel directions per port (bit set = output) */
+static std::atomic<Dio_PortLevelType> Dio_PortDirection[DIO_NUM_PORTS];
+
+/** @brief Backend operations */
+static const Dio_BackendType Dio_SimBackend = {
+    "simulation", Dio_Sim_Configure, Dio_Sim_Write, Dio_Sim_ReadInputs
+};
+static const Dio_BackendType Dio_GpioBackend = {
+    "gpio-cdev", Dio_Gpio_Configure, Dio_Gpio_Write, Dio_Gpio_ReadInputs
+};
+
+/** @brief Active backend */
+static const Dio_BackendType* Dio_Backend = &Dio_SimBackend;
+
+/** @brief GPIO line requests per port */
+static Dio_GpioPortType Dio_GpioPorts[DIO_NUM_PORTS];
 
-/** @brief Simulated input levels */
-static Dio_LevelType Dio_SimInputLevels[DIO_NUM_CHANNELS];
+/** @brief Serializes pushes to the GPIO lines: the last push carries the latest register */
+static std::mutex Dio_GpioMutex;
 
-/** @brief Channel direction (TRUE = output, FALSE = input) */
-static boolean Dio_ChannelDirection[DIO_NUM_CHANNELS];
+/** @brief GPIO ioctl statistics */
+static std::atomic<uint32_t> Dio_GpioSetCalls(0U);
+static std::atomic<uint32_t> Dio_GpioGetCalls(0U);
+static std::atomic<uint64_t> Dio_GpioLastSetNs(0U);
 
 /*============================================================================*
  * FUNCTION IMPLEMENTATIONS
@@ -39,25 +139,72 @@ static boolean Dio_ChannelDirection[DIO_NUM_CHANNELS];
 void Dio_Init(void) {
     uint8_t i;
 
-    /* Initialize all channels to LOW */
-    for (i = 0U; i < DIO_NUM_CHANNELS; i++) {
-        Dio_OutputLevels[i] = STD_LOW;
-        Dio_SimInputLevels[i] = STD_LOW;
-        Dio_ChannelDirection[i] = FALSE;  /* Default to input */
+    /* Initialize all channels to LOW, default to input */
+    for (i = 0U; i < DIO_NUM_PORTS; i++) {
+        Dio_PortOutput[i].store(0U);
+        Dio_PortSimInput[i].store(0U);
+        Dio_PortDirection[i].store(0U);
     }
 
-    /* Configure headlight channels as outputs */
-    Dio_ChannelDirection[DIO_CHANNEL_LOW_BEAM] = TRUE;
-    Dio_ChannelDirection[DIO_CHANNEL_HIGH_BEAM] = TRUE;
-    Dio_ChannelDirection[DIO_CHANNEL_STATUS_LED] = TRUE;
-    Dio_ChannelDirection[DIO_CHANNEL_ERROR_LED] = TRUE;
+    /* Configure headlight channels and LEDs as outputs, feedback stays an input */
+    Dio_PortDirection[DIO_CHANNEL_PORT(DIO_CHANNEL_LOW_BEAM)].fetch_or(
+        DIO_CHANNEL_MASK(DIO_CHANNEL_LOW_BEAM));
+    Dio_PortDirection[DIO_CHANNEL_PORT(DIO_CHANNEL_HIGH_BEAM)].fetch_or(
+        DIO_CHANNEL_MASK(DIO_CHANNEL_HIGH_BEAM));
+    Dio_PortDirection[DIO_CHANNEL_PORT(DIO_CHANNEL_STATUS_LED)].fetch_or(
+        DIO_CHANNEL_MASK(DIO_CHANNEL_STATUS_LED));
+    Dio_PortDirection[DIO_CHANNEL_PORT(DIO_CHANNEL_ERROR_LED)].fetch_or(
+        DIO_CHANNEL_MASK(DIO_CHANNEL_ERROR_LED));
 
-    /* Feedback is an input */
-    Dio_ChannelDirection[DIO_CHANNEL_FEEDBACK] = FALSE;
+    /* Re-initialization with GPIO lines held: apply reset directions/levels */
+    Dio_ConfigureAllPorts();
 
     Dio_Initialized = TRUE;
 }
 
+/**
+ * @brief Select the DIO backend
+ */
+Std_ReturnType Dio_SetBackend(const Dio_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    Dio_Gpio_Close();
+    Dio_Backend = &Dio_SimBackend;
+
+    if (ConfigPtr->Backend == DIO_BACKEND_GPIO_CDEV) {
+        if (Dio_Gpio_Open(ConfigPtr) != E_OK) {
+            return E_NOT_OK;
+        }
+        Dio_Backend = &Dio_GpioBackend;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief De-initialize DIO driver
+ */
+void Dio_DeInit(void) {
+    Dio_Gpio_Close();
+    Dio_Backend = &Dio_SimBackend;
+    Dio_Initialized = FALSE;
+}
+
+/**
+ * @brief Get GPIO character device statistics
+ */
+void Dio_GetGpioStats(Dio_GpioStatsType* Stats) {
+    if (Stats == NULL_PTR) {
+        return;
+    }
+
+    Stats->SetValuesCalls = Dio_GpioSetCalls.load();
+    Stats->GetValuesCalls = Dio_GpioGetCalls.load();
+    Stats->LastSetValuesNs = Dio_GpioLastSetNs.load();
+}
+
 /**
  * @brief Read DIO channel level
  */
@@ -66,13 +213,9 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId) {
         return STD_LOW;
     }
 
-    /* For outputs, return the current output level */
-    /* For inputs, return the simulated input level */
-    if (Dio_ChannelDirection[ChannelId]) {
-        return Dio_OutputLevels[ChannelId];
-    } else {
-        return Dio_SimInputLevels[ChannelId];
-    }
+    /* Outputs read back the output level, inputs the simulated input level */
+    return ((Dio_PortLevel(DIO_CHANNEL_PORT(ChannelId)) & DIO_CHANNEL_MASK(ChannelId)) != 0U) ?
+           STD_HIGH : STD_LOW;
 }
 
 /**
@@ -83,101 +226,66 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level) {
         return;
     }
 
-    /* Only write to output channels */
-    if (Dio_ChannelDirection[ChannelId]) {
-        Dio_OutputLevels[ChannelId] = (Level != STD_LOW) ? STD_HIGH : STD_LOW;
-    }
+    Dio_UpdatePort(DIO_CHANNEL_PORT(ChannelId),
+                   (Level != STD_LOW) ? DIO_CHANNEL_MASK(ChannelId) : 0U,
+                   DIO_CHANNEL_MASK(ChannelId));
 }
 
 /**
  * @brief Flip (toggle) DIO channel
  */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId) {
-    Dio_LevelType currentLevel;
-    Dio_LevelType newLevel;
+    const Dio_PortLevelType mask = DIO_CHANNEL_MASK(ChannelId);
+    Dio_PortLevelType previous;
 
     if (ChannelId >= DIO_NUM_CHANNELS) {
         return STD_LOW;
     }
 
-    if (!Dio_ChannelDirection[ChannelId]) {
+    if ((Dio_PortDirection[DIO_CHANNEL_PORT(ChannelId)].load() & mask) == 0U) {
         /* Cannot flip input channel */
-        return Dio_SimInputLevels[ChannelId];
+        return Dio_ReadChannel(ChannelId);
     }
 
-    currentLevel = Dio_OutputLevels[ChannelId];
-    newLevel = (currentLevel == STD_LOW) ? STD_HIGH : STD_LOW;
-    Dio_OutputLevels[ChannelId] = newLevel;
+    previous = Dio_PortOutput[DIO_CHANNEL_PORT(ChannelId)].fetch_xor(mask);
+    Dio_Backend->Write(DIO_CHANNEL_PORT(ChannelId));
 
-    return newLevel;
+    return ((previous & mask) != 0U) ? STD_LOW : STD_HIGH;
 }
 
 /**
  * @brief Read DIO port
  */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId) {
-    Dio_PortLevelType portValue = 0U;
-    uint8_t baseChannel;
-    uint8_t i;
-
     if (PortId >= DIO_NUM_PORTS) {
         return 0U;
     }
 
-    baseChannel = PortId * DIO_CHANNELS_PER_PORT;
-
-    for (i = 0U; i < DIO_CHANNELS_PER_PORT; i++) {
-        Dio_ChannelType ch = baseChannel + i;
-        if (ch < DIO_NUM_CHANNELS) {
-            Dio_LevelType level;
-            if (Dio_ChannelDirection[ch]) {
-                level = Dio_OutputLevels[ch];
-            } else {
-                level = Dio_SimInputLevels[ch];
-            }
-            if (level != STD_LOW) {
-                portValue |= (1U << i);
-            }
-        }
-    }
-
-    return portValue;
+    return Dio_PortLevel(PortId);
 }
 
 /**
  * @brief Write DIO port
  */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level) {
-    uint8_t baseChannel;
-    uint8_t i;
-
     if (PortId >= DIO_NUM_PORTS) {
         return;
     }
 
-    baseChannel = PortId * DIO_CHANNELS_PER_PORT;
-
-    for (i = 0U; i < DIO_CHANNELS_PER_PORT; i++) {
-        Dio_ChannelType ch = baseChannel + i;
-        if ((ch < DIO_NUM_CHANNELS) && Dio_ChannelDirection[ch]) {
-            Dio_OutputLevels[ch] = ((Level & (1U << i)) != 0U) ? STD_HIGH : STD_LOW;
-        }
-    }
+    Dio_UpdatePort(PortId, Level, 0xFFU);
 }
 
 /**
  * @brief Read DIO channel group
  */
 Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr) {
-    Dio_PortLevelType portValue;
-
-    if (ChannelGroupIdPtr == NULL_PTR) {
+    if ((ChannelGroupIdPtr == NULL_PTR) || (ChannelGroupIdPtr->port >= DIO_NUM_PORTS)) {
         return 0U;
     }
 
-    portValue = Dio_ReadPort(ChannelGroupIdPtr->port);
-
-    return (portValue & ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset;
+    return static_cast<Dio_PortLevelType>(
+        (Dio_PortLevel(ChannelGroupIdPtr->port) & ChannelGroupIdPtr->mask) >>
+        ChannelGroupIdPtr->offset);
 }
 
 /**
@@ -185,18 +293,13 @@ Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupI
  */
 void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr,
                            Dio_PortLevelType Level) {
-    Dio_PortLevelType currentPort;
-    Dio_PortLevelType newValue;
-
-    if (ChannelGroupIdPtr == NULL_PTR) {
+    if ((ChannelGroupIdPtr == NULL_PTR) || (ChannelGroupIdPtr->port >= DIO_NUM_PORTS)) {
         return;
     }
 
-    currentPort = Dio_ReadPort(ChannelGroupIdPtr->port);
-    newValue = (currentPort & ~ChannelGroupIdPtr->mask) |
-               ((Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask);
-
-    Dio_WritePort(ChannelGroupIdPtr->port, newValue);
+    Dio_UpdatePort(ChannelGroupIdPtr->port,
+                   static_cast<Dio_PortLevelType>(Level << ChannelGroupIdPtr->offset),
+                   ChannelGroupIdPtr->mask);
 }
 
 /**
@@ -205,17 +308,13 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr,
 Dio_PortLevelType Dio_GetMaskedBits(Dio_PortType PortId,
                                      Dio_PortLevelType Level,
                                      Dio_PortLevelType Mask) {
-    Dio_PortLevelType portValue;
-
     STD_UNUSED(Level);
 
     if (PortId >= DIO_NUM_PORTS) {
         return 0U;
     }
 
-    portValue = Dio_ReadPort(PortId);
-
-    return portValue & Mask;
+    return Dio_PortLevel(PortId) & Mask;
 }
 
 /**
@@ -224,17 +323,11 @@ Dio_PortLevelType Dio_GetMaskedBits(Dio_PortType PortId,
 void Dio_SetMaskedBits(Dio_PortType PortId,
                        Dio_PortLevelType Level,
                        Dio_PortLevelType Mask) {
-    Dio_PortLevelType currentPort;
-    Dio_PortLevelType newValue;
-
     if (PortId >= DIO_NUM_PORTS) {
         return;
     }
 
-    currentPort = Dio_ReadPort(PortId);
-    newValue = (currentPort & ~Mask) | (Level & Mask);
-
-    Dio_WritePort(PortId, newValue);
+    Dio_UpdatePort(PortId, Level, Mask);
 }
 
 /**
@@ -252,6 +345,330 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
     VersionInfo->sw_patch_version = DIO_SW_PATCH_VERSION;
 }
 
+/**
+ * @brief Save port levels and directions
+ */
+void Dio_SaveSnapshot(Dio_SnapshotType* Snapshot) {
+    Dio_PortType port;
+
+    for (port = 0U; port < DIO_NUM_PORTS; port++) {
+        Snapshot->PortOutput[port] = Dio_PortOutput[port].load();
+        Snapshot->PortSimInput[port] = Dio_PortSimInput[port].load();
+        Snapshot->PortDirection[port] = Dio_PortDirection[port].load();
+    }
+}
+
+/**
+ * @brief Restore port levels and directions
+ */
+void Dio_RestoreSnapshot(const Dio_SnapshotType* Snapshot) {
+    Dio_PortType port;
+
+    for (port = 0U; port < DIO_NUM_PORTS; port++) {
+        Dio_PortOutput[port].store(Snapshot->PortOutput[port]);
+        Dio_PortSimInput[port].store(Snapshot->PortSimInput[port]);
+        Dio_PortDirection[port].store(Snapshot->PortDirection[port]);
+    }
+
+    Dio_ConfigureAllPorts();
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Level of all channels of a port: outputs read back, inputs from the backend
+ */
+static Dio_PortLevelType Dio_PortLevel(Dio_PortType PortId) {
+    const Dio_PortLevelType direction = Dio_PortDirection[PortId].load();
+    const Dio_PortLevelType inputs = static_cast<Dio_PortLevelType>(~direction);
+
+    return static_cast<Dio_PortLevelType>(
+        (Dio_PortOutput[PortId].load() & direction) |
+        Dio_Backend->ReadInputs(PortId, inputs));
+}
+
+/**
+ * @brief Set the masked output channels of a port in one atomic update
+ * @details Bits of input channels are left unchanged
+ */
+static void Dio_UpdatePort(Dio_PortType PortId, Dio_PortLevelType Level,
+                           Dio_PortLevelType Mask) {
+    const Dio_PortLevelType writable =
+        static_cast<Dio_PortLevelType>(Mask & Dio_PortDirection[PortId].load());
+    const Dio_PortLevelType keep = static_cast<Dio_PortLevelType>(~writable);
+    Dio_PortLevelType current = Dio_PortOutput[PortId].load();
+    Dio_PortLevelType next;
+
+    do {
+        next = static_cast<Dio_PortLevelType>((current & keep) | (Level & writable));
+    } while (!Dio_PortOutput[PortId].compare_exchange_weak(current, next));
+
+    /* Unchanged registers (e.g. the same command every cycle) cost no ioctl */
+    if (next != current) {
+        Dio_Backend->Write(PortId);
+    }
+}
+
+/**
+ * @brief Apply directions and output levels of all ports to the backend
+ */
+static void Dio_ConfigureAllPorts(void) {
+    Dio_PortType port;
+
+    for (port = 0U; port < DIO_NUM_PORTS; port++) {
+        Dio_Backend->Configure(port);
+    }
+}
+
+/*============================================================================*
+ * SIMULATION BACKEND
+ *============================================================================*/
+
+static void Dio_Sim_Configure(Dio_PortType PortId) {
+    STD_UNUSED(PortId);
+}
+
+static void Dio_Sim_Write(Dio_PortType PortId) {
+    STD_UNUSED(PortId);
+}
+
+static Dio_PortLevelType Dio_Sim_ReadInputs(Dio_PortType PortId, Dio_PortLevelType Mask) {
+    return static_cast<Dio_PortLevelType>(Dio_PortSimInput[PortId].load() & Mask);
+}
+
+/*============================================================================*
+ * LINUX GPIO CHARACTER DEVICE BACKEND
+ *============================================================================*/
+
+/**
+ * @brief Request the mapped lines of every port
+ * @details Lines of a port share one request so that a port update is one
+ *          ioctl; outputs start with the current register value
+ */
+static Std_ReturnType Dio_Gpio_Open(const Dio_ConfigType* ConfigPtr) {
+#if defined(__linux__)
+    const char* path = (ConfigPtr->ChipPath != NULL_PTR) ?
+                       ConfigPtr->ChipPath : DIO_GPIO_CHIP_PATH;
+    Std_ReturnType result = E_OK;
+    struct gpio_v2_line_request request;
+    Dio_PortType port;
+    uint8_t bit;
+    int chipFd;
+
+    chipFd = open(path, O_RDWR | O_CLOEXEC);
+    if (chipFd < 0) {
+        return E_NOT_OK;
+    }
+
+    for (port = 0U; (port < DIO_NUM_PORTS) && (result == E_OK); port++) {
+        Dio_GpioPortType* gpioPort = &Dio_GpioPorts[port];
+
+        std::memset(&request, 0, sizeof(request));
+        gpioPort->NumLines = 0U;
+        gpioPort->Mapped = 0U;
+
+        for (bit = 0U; bit < DIO_CHANNELS_PER_PORT; bit++) {
+            const uint32_t channel = (static_cast<uint32_t>(port) * DIO_CHANNELS_PER_PORT) + bit;
+            uint32_t line;
+
+            if (channel >= DIO_NUM_CHANNELS) {
+                break;
+            }
+            line = (ConfigPtr->LineOffsets != NULL_PTR) ?
+                   ConfigPtr->LineOffsets[channel] : channel;
+            if (line == DIO_GPIO_LINE_NONE) {
+                continue;
+            }
+
+            request.offsets[gpioPort->NumLines] = line;
+            gpioPort->LineBit[gpioPort->NumLines] = bit;
+            gpioPort->NumLines++;
+            gpioPort->Mapped = static_cast<Dio_PortLevelType>(gpioPort->Mapped | (1U << bit));
+        }
+
+        if (gpioPort->NumLines == 0U) {
+            continue;
+        }
+
+        std::strncpy(request.consumer, DIO_GPIO_CONSUMER, sizeof(request.consumer) - 1U);
+        request.num_lines = gpioPort->NumLines;
+        Dio_Gpio_BuildConfig(port, &request.config);
+
+        if (ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request) < 0) {
+            gpioPort->NumLines = 0U;
+            result = E_NOT_OK;
+        } else {
+            gpioPort->Fd = request.fd;
+        }
+    }
+
+    (void)close(chipFd);
+
+    if (result != E_OK) {
+        Dio_Gpio_Close();
+    }
+
+    return result;
+#else
+    STD_UNUSED(ConfigPtr);
+    return E_NOT_OK;
+#endif
+}
+
+/**
+ * @brief Release the line requests of all ports
+ */
+static void Dio_Gpio_Close(void) {
+#if defined(__linux__)
+    Dio_PortType port;
+
+    for (port = 0U; port < DIO_NUM_PORTS; port++) {
+        if (Dio_GpioPorts[port].NumLines > 0U) {
+            (void)close(Dio_GpioPorts[port].Fd);
+            Dio_GpioPorts[port].NumLines = 0U;
+            Dio_GpioPorts[port].Mapped = 0U;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Reconfigure the lines of a port after a direction change
+ */
+static void Dio_Gpio_Configure(Dio_PortType PortId) {
+#if defined(__linux__)
+    struct gpio_v2_line_config config;
+    std::lock_guard<std::mutex> lock(Dio_GpioMutex);
+
+    if (Dio_GpioPorts[PortId].NumLines == 0U) {
+        return;
+    }
+
+    Dio_Gpio_BuildConfig(PortId, &config);
+    (void)ioctl(Dio_GpioPorts[PortId].Fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config);
+#else
+    STD_UNUSED(PortId);
+#endif
+}
+
+/**
+ * @brief Push the output register of a port to its output lines in one ioctl
+ */
+static void Dio_Gpio_Write(Dio_PortType PortId) {
+#if defined(__linux__)
+    struct gpio_v2_line_values values;
+    std::lock_guard<std::mutex> lock(Dio_GpioMutex);
+
+    if (Dio_GpioPorts[PortId].NumLines == 0U) {
+        return;
+    }
+
+    /* Read under the lock: a concurrent writer either pushes after us or
+     * its value is already part of this register */
+    values.mask = Dio_Gpio_ToLines(PortId, Dio_PortDirection[PortId].load());
+    values.bits = Dio_Gpio_ToLines(PortId, Dio_PortOutput[PortId].load());
+    if (values.mask == 0U) {
+        return;
+    }
+
+    if (ioctl(Dio_GpioPorts[PortId].Fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) == 0) {
+        Dio_GpioLastSetNs.store(Dio_GetMonotonicNs());
+    }
+    Dio_GpioSetCalls++;
+#else
+    STD_UNUSED(PortId);
+#endif
+}
+
+/**
+ * @brief Read the input lines of a port in one ioctl
+ * @details Channels without a line keep their simulated input level
+ */
+static Dio_PortLevelType Dio_Gpio_ReadInputs(Dio_PortType PortId, Dio_PortLevelType Mask) {
+    Dio_PortLevelType level = Dio_Sim_ReadInputs(PortId, Mask);
+#if defined(__linux__)
+    struct gpio_v2_line_values values;
+    const Dio_PortLevelType mapped =
+        static_cast<Dio_PortLevelType>(Mask & Dio_GpioPorts[PortId].Mapped);
+
+    if ((Dio_GpioPorts[PortId].NumLines == 0U) || (mapped == 0U)) {
+        return level;
+    }
+
+    values.mask = Dio_Gpio_ToLines(PortId, mapped);
+    values.bits = 0U;
+    if (ioctl(Dio_GpioPorts[PortId].Fd, GPIO_V2_LINE_GET_VALUES_IOCTL, &values) == 0) {
+        level = static_cast<Dio_PortLevelType>(
+            (level & static_cast<Dio_PortLevelType>(~mapped)) |
+            (Dio_Gpio_FromLines(PortId, values.bits) & mapped));
+    }
+    Dio_GpioGetCalls++;
+#endif
+    return level;
+}
+
+#if defined(__linux__)
+/**
+ * @brief Line configuration of a port: outputs with their register level, rest inputs
+ */
+static void Dio_Gpio_BuildConfig(Dio_PortType PortId, struct gpio_v2_line_config* Config) {
+    std::memset(Config, 0, sizeof(*Config));
+
+    Config->flags = GPIO_V2_LINE_FLAG_INPUT;
+    Config->num_attrs = 2U;
+    Config->attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_FLAGS;
+    Config->attrs[0].attr.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+    Config->attrs[0].mask = Dio_Gpio_ToLines(PortId, Dio_PortDirection[PortId].load());
+    Config->attrs[1].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+    Config->attrs[1].attr.values = Dio_Gpio_ToLines(PortId, Dio_PortOutput[PortId].load());
+    Config->attrs[1].mask = Config->attrs[0].mask;
+}
+#endif
+
+/**
+ * @brief Port bits to line bits of the port's request
+ */
+static uint64_t Dio_Gpio_ToLines(Dio_PortType PortId, Dio_PortLevelType Level) {
+    const Dio_GpioPortType* gpioPort = &Dio_GpioPorts[PortId];
+    uint64_t bits = 0U;
+    uint8_t i;
+
+    for (i = 0U; i < gpioPort->NumLines; i++) {
+        if ((Level & (1U << gpioPort->LineBit[i])) != 0U) {
+            bits |= (static_cast<uint64_t>(1U) << i);
+        }
+    }
+
+    return bits;
+}
+
+/**
+ * @brief Line bits of the port's request to port bits
+ */
+static Dio_PortLevelType Dio_Gpio_FromLines(Dio_PortType PortId, uint64_t Bits) {
+    const Dio_GpioPortType* gpioPort = &Dio_GpioPorts[PortId];
+    Dio_PortLevelType level = 0U;
+    uint8_t i;
+
+    for (i = 0U; i < gpioPort->NumLines; i++) {
+        if ((Bits & (static_cast<uint64_t>(1U) << i)) != 0U) {
+            level = static_cast<Dio_PortLevelType>(level | (1U << gpioPort->LineBit[i]));
+        }
+    }
+
+    return level;
+}
+
+static uint64_t Dio_GetMonotonicNs(void) {
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL) +
+           static_cast<uint64_t>(ts.tv_nsec);
+}
+
 /*============================================================================*
  * SIMULATION FUNCTIONS
  *============================================================================*/
@@ -260,11 +677,27 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
  * @brief Set simulated input level
  */
 void Dio_SimSetInput(Dio_ChannelType ChannelId, Dio_LevelType Level) {
+    if (Dio_SimInputHook != NULL_PTR) {
+        Dio_SimInputHook(ChannelId, Level);
+    }
+
     if (ChannelId >= DIO_NUM_CHANNELS) {
         return;
     }
 
-    Dio_SimInputLevels[ChannelId] = (Level != STD_LOW) ? STD_HIGH : STD_LOW;
+    if (Level != STD_LOW) {
+        Dio_PortSimInput[DIO_CHANNEL_PORT(ChannelId)].fetch_or(DIO_CHANNEL_MASK(ChannelId));
+    } else {
+        Dio_PortSimInput[DIO_CHANNEL_PORT(ChannelId)].fetch_and(
+            static_cast<Dio_PortLevelType>(~DIO_CHANNEL_MASK(ChannelId)));
+    }
+}
+
+/**
+ * @brief Set simulated input hook
+ */
+void Dio_SimSetInputHook(Dio_SimInputHookType Hook) {
+    Dio_SimInputHook = Hook;
 }
 
 /**
@@ -275,7 +708,19 @@ Dio_LevelType Dio_SimGetOutput(Dio_ChannelType ChannelId) {
         return STD_LOW;
     }
 
-    return Dio_OutputLevels[ChannelId];
+    return ((Dio_PortOutput[DIO_CHANNEL_PORT(ChannelId)].load() &
+             DIO_CHANNEL_MASK(ChannelId)) != 0U) ? STD_HIGH : STD_LOW;
+}
+
+/**
+ * @brief Get current output register of a port
+ */
+Dio_PortLevelType Dio_SimGetOutputPort(Dio_PortType PortId) {
+    if (PortId >= DIO_NUM_PORTS) {
+        return 0U;
+    }
+
+    return Dio_PortOutput[PortId].load();
 }
 
 /**
@@ -286,5 +731,12 @@ void Dio_SimSetDirection(Dio_ChannelType ChannelId, boolean IsOutput) {
         return;
     }
 
-    Dio_ChannelDirection[ChannelId] = IsOutput;
+    if (IsOutput) {
+        Dio_PortDirection[DIO_CHANNEL_PORT(ChannelId)].fetch_or(DIO_CHANNEL_MASK(ChannelId));
+    } else {
+        Dio_PortDirection[DIO_CHANNEL_PORT(ChannelId)].fetch_and(
+            static_cast<Dio_PortLevelType>(~DIO_CHANNEL_MASK(ChannelId)));
+    }
+
+    Dio_Backend->Configure(DIO_CHANNEL_PORT(ChannelId));
 }
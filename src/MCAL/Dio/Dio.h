@@ -1,7 +1,13 @@
 /**
  * @file Dio.h
  * @brief AUTOSAR DIO Driver Interface
- * @details MCAL DIO driver stub for simulation
+ * @details MCAL DIO driver with pluggable backends:
+ *          - Simulation: inputs set with Dio_SimSetInput
+ *          - Linux GPIO character device: /dev/gpiochipN v2 uAPI, one line
+ *            request per port (testable against the gpio-sim module)
+ *          Each port is held as packed output, input and direction bitmasks;
+ *          port and group writes are single atomic read-modify-write
+ *          operations and reach the GPIO lines with one ioctl.
  * @version 1.0.0
  * @date 2024
  *
@@ -39,9 +45,24 @@
 /** @brief Channels per port */
 #define DIO_CHANNELS_PER_PORT               8U
 
+/** @brief Port of a channel */
+#define DIO_CHANNEL_PORT(ChannelId)         ((ChannelId) / DIO_CHANNELS_PER_PORT)
+
+/** @brief Bit of a channel within its port */
+#define DIO_CHANNEL_BIT(ChannelId)          ((ChannelId) % DIO_CHANNELS_PER_PORT)
+
 /** @brief Enable development error detection */
 #define DIO_DEV_ERROR_DETECT                STD_ON
 
+/** @brief Default GPIO chip of the character device backend */
+#define DIO_GPIO_CHIP_PATH                  "/dev/gpiochip0"
+
+/** @brief Consumer label of the requested GPIO lines */
+#define DIO_GPIO_CONSUMER                   "flm"
+
+/** @brief Channel without a GPIO line */
+#define DIO_GPIO_LINE_NONE                  0xFFFFFFFFU
+
 /*============================================================================*
  * TYPE DEFINITIONS
  *============================================================================*/
@@ -75,6 +96,48 @@ typedef uint8_t Dio_LevelType;
  */
 typedef uint8_t Dio_PortLevelType;
 
+/**
+ * @brief Simulated input hook type (e.g. input recorder)
+ */
+typedef void (*Dio_SimInputHookType)(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/**
+ * @brief DIO backend type
+ */
+typedef enum {
+    DIO_BACKEND_SIMULATION      = 0x00U,    /**< Simulated inputs, outputs in memory */
+    DIO_BACKEND_GPIO_CDEV       = 0x01U     /**< Linux GPIO character device */
+} Dio_BackendIdType;
+
+/**
+ * @brief DIO backend configuration type
+ */
+typedef struct {
+    Dio_BackendIdType Backend;      /**< Selected backend */
+    const char* ChipPath;           /**< GPIO chip (NULL_PTR = DIO_GPIO_CHIP_PATH) */
+    const uint32_t* LineOffsets;    /**< GPIO line per channel, DIO_NUM_CHANNELS
+                                         entries or DIO_GPIO_LINE_NONE
+                                         (NULL_PTR = channel n on line n) */
+} Dio_ConfigType;
+
+/**
+ * @brief GPIO character device statistics
+ */
+typedef struct {
+    uint32_t SetValuesCalls;        /**< GPIO_V2_LINE_SET_VALUES ioctls */
+    uint32_t GetValuesCalls;        /**< GPIO_V2_LINE_GET_VALUES ioctls */
+    uint64_t LastSetValuesNs;       /**< Monotonic time the last set returned (ns) */
+} Dio_GpioStatsType;
+
+/**
+ * @brief DIO driver snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    Dio_PortLevelType PortOutput[DIO_NUM_PORTS];
+    Dio_PortLevelType PortSimInput[DIO_NUM_PORTS];
+    Dio_PortLevelType PortDirection[DIO_NUM_PORTS];
+} Dio_SnapshotType;
+
 /*============================================================================*
  * DIO CHANNEL DEFINITIONS
  *============================================================================*/
@@ -174,12 +237,49 @@ void Dio_SetMaskedBits(Dio_PortType PortId,
                        Dio_PortLevelType Level,
                        Dio_PortLevelType Mask);
 
+/**
+ * @brief Select the DIO backend
+ * @details Call after Dio_Init. The GPIO backend requests the mapped lines of
+ *          each port with the current directions and output levels; on
+ *          failure the driver stays on the simulation backend.
+ * @param[in] ConfigPtr Pointer to configuration
+ * @return E_OK on success, E_NOT_OK if the GPIO lines could not be requested
+ */
+Std_ReturnType Dio_SetBackend(const Dio_ConfigType* ConfigPtr);
+
+/**
+ * @brief De-initialize DIO driver
+ * @details Releases the GPIO lines and returns to the simulation backend
+ */
+void Dio_DeInit(void);
+
+/**
+ * @brief Get GPIO character device statistics
+ * @details Command-to-pin latency: LastSetValuesNs minus the monotonic time
+ *          (CLOCK_MONOTONIC) the command was issued
+ * @param[out] Stats Pointer to receive statistics
+ */
+void Dio_GetGpioStats(Dio_GpioStatsType* Stats);
+
 /**
  * @brief Get version information
  * @param[out] VersionInfo Pointer to version info
  */
 void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo);
 
+/**
+ * @brief Save port levels and directions (Ecu_SaveSnapshot)
+ * @param[out] Snapshot Port levels and directions
+ */
+void Dio_SaveSnapshot(Dio_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore port levels and directions (Ecu_RestoreSnapshot)
+ * @details Applies the restored outputs to the active backend
+ * @param[in] Snapshot Port levels and directions
+ */
+void Dio_RestoreSnapshot(const Dio_SnapshotType* Snapshot);
+
 /*============================================================================*
  * SIMULATION FUNCTIONS (FOR TESTING)
  *============================================================================*/
@@ -191,6 +291,13 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo);
  */
 void Dio_SimSetInput(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
+/**
+ * @brief Set simulated input hook
+ * @details Called with every Dio_SimSetInput before it is checked
+ * @param[in] Hook Input hook, NULL_PTR to remove
+ */
+void Dio_SimSetInputHook(Dio_SimInputHookType Hook);
+
 /**
  * @brief Get current output level
  * @param[in] ChannelId Channel to read
@@ -198,6 +305,16 @@ void Dio_SimSetInput(Dio_ChannelType ChannelId, Dio_LevelType Level);
  */
 Dio_LevelType Dio_SimGetOutput(Dio_ChannelType ChannelId);
 
+/**
+ * @brief Get current output register of a port
+ * @details One atomic read: a port written with Dio_WritePort,
+ *          Dio_WriteChannelGroup or Dio_SetMaskedBits is never seen half
+ *          written, e.g. by a GPIO monitor thread
+ * @param[in] PortId Port to read
+ * @return Output levels of all channels of the port
+ */
+Dio_PortLevelType Dio_SimGetOutputPort(Dio_PortType PortId);
+
 /**
  * @brief Configure channel direction
  * @param[in] ChannelId Channel to configure
@@ -0,0 +1,201 @@
+/**
+ * @file Pwm.cpp
+ * @brief AUTOSAR PWM Driver Implementation
+ * @details MCAL PWM driver for simulation: channels hold their duty cycle
+ *          and the virtual time of the last update, the output level is
+ *          derived from the phase within the period and the on phase offset
+ *          of the channel
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Pwm.h"
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Initialization flag */
+static boolean Pwm_Initialized = FALSE;
+
+/** @brief On phase offset per channel */
+static const Pwm_PeriodType Pwm_ChannelPhaseUs[PWM_NUM_CHANNELS] = {
+    0U,                                 /* PWM_CHANNEL_LOW_BEAM */
+    PWM_HIGH_BEAM_PHASE_US              /* PWM_CHANNEL_HIGH_BEAM */
+};
+
+/** @brief Channel waveforms */
+static Pwm_SimChannelType Pwm_Channels[PWM_NUM_CHANNELS];
+
+/** @brief Simulated time base of the duty cycle updates */
+static uint64_t Pwm_SimTimeUs = 0U;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static void Pwm_Update(Pwm_ChannelType ChannelNumber, uint16_t DutyCycle);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize PWM driver
+ */
+void Pwm_Init(void) {
+    Pwm_ChannelType i;
+
+    (void)std::memset(Pwm_Channels, 0, sizeof(Pwm_Channels));
+    for (i = 0U; i < PWM_NUM_CHANNELS; i++) {
+        Pwm_Channels[i].DutyCycle = PWM_DUTY_0_PERCENT;
+        Pwm_Channels[i].PeriodUs = PWM_DEFAULT_PERIOD_US;
+        Pwm_Channels[i].StartUs = Pwm_SimTimeUs;
+        Pwm_Channels[i].PhaseUs = Pwm_ChannelPhaseUs[i];
+    }
+
+    Pwm_Initialized = TRUE;
+}
+
+/**
+ * @brief De-initialize PWM driver
+ */
+void Pwm_DeInit(void) {
+    Pwm_ChannelType i;
+
+    if (!Pwm_Initialized) {
+        return;
+    }
+
+    for (i = 0U; i < PWM_NUM_CHANNELS; i++) {
+        Pwm_Update(i, PWM_DUTY_0_PERCENT);
+    }
+
+    Pwm_SimTimeUs = 0U;
+    Pwm_Initialized = FALSE;
+}
+
+/**
+ * @brief Set duty cycle of a channel
+ */
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16_t DutyCycle) {
+    if (!Pwm_Initialized || (ChannelNumber >= PWM_NUM_CHANNELS)) {
+        return;
+    }
+
+    if (DutyCycle > PWM_DUTY_100_PERCENT) {
+        DutyCycle = PWM_DUTY_100_PERCENT;
+    }
+
+    Pwm_Update(ChannelNumber, DutyCycle);
+}
+
+/**
+ * @brief Set a channel to its idle state
+ */
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber) {
+    if (!Pwm_Initialized || (ChannelNumber >= PWM_NUM_CHANNELS)) {
+        return;
+    }
+
+    Pwm_Update(ChannelNumber, PWM_DUTY_0_PERCENT);
+}
+
+/**
+ * @brief Get output state of a channel
+ */
+Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber) {
+    const Pwm_SimChannelType* channel;
+    uint64_t phaseUs;
+
+    if (!Pwm_Initialized || (ChannelNumber >= PWM_NUM_CHANNELS)) {
+        return PWM_LOW;
+    }
+
+    channel = &Pwm_Channels[ChannelNumber];
+    phaseUs = ((Pwm_SimTimeUs - channel->StartUs) + channel->PeriodUs - channel->PhaseUs) %
+              channel->PeriodUs;
+
+    return ((phaseUs * PWM_DUTY_100_PERCENT) <
+            (static_cast<uint64_t>(channel->DutyCycle) * channel->PeriodUs)) ? PWM_HIGH : PWM_LOW;
+}
+
+/**
+ * @brief Get version information
+ */
+void Pwm_GetVersionInfo(Std_VersionInfoType* versioninfo) {
+    if (versioninfo == NULL_PTR) {
+        return;
+    }
+
+    versioninfo->vendorID = 0U;
+    versioninfo->moduleID = 121U;  /* PWM module ID */
+    versioninfo->sw_major_version = PWM_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = PWM_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = PWM_SW_PATCH_VERSION;
+}
+
+/**
+ * @brief Save channel waveforms
+ */
+void Pwm_SaveSnapshot(Pwm_SnapshotType* Snapshot) {
+    (void)std::memcpy(Snapshot->Channels, Pwm_Channels, sizeof(Pwm_Channels));
+    Snapshot->SimTimeUs = Pwm_SimTimeUs;
+}
+
+/**
+ * @brief Restore channel waveforms
+ */
+void Pwm_RestoreSnapshot(const Pwm_SnapshotType* Snapshot) {
+    (void)std::memcpy(Pwm_Channels, Snapshot->Channels, sizeof(Pwm_Channels));
+    Pwm_SimTimeUs = Snapshot->SimTimeUs;
+}
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS
+ *============================================================================*/
+
+/**
+ * @brief Set simulated time base
+ */
+void Pwm_SimSetTimeUs(uint64_t timeUs) {
+    Pwm_SimTimeUs = timeUs;
+}
+
+/**
+ * @brief Get output waveform of a channel
+ */
+Std_ReturnType Pwm_SimGetChannel(Pwm_ChannelType ChannelNumber, Pwm_SimChannelType* Channel) {
+    if ((ChannelNumber >= PWM_NUM_CHANNELS) || (Channel == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    *Channel = Pwm_Channels[ChannelNumber];
+    return E_OK;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Apply a duty cycle at the current virtual time
+ * @details An unchanged duty cycle keeps the running period
+ */
+static void Pwm_Update(Pwm_ChannelType ChannelNumber, uint16_t DutyCycle) {
+    Pwm_SimChannelType* channel = &Pwm_Channels[ChannelNumber];
+
+    if (DutyCycle == channel->DutyCycle) {
+        return;
+    }
+
+    channel->DutyCycle = DutyCycle;
+    channel->StartUs = Pwm_SimTimeUs;
+    channel->Updates++;
+}
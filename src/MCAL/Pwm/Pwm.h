@@ -0,0 +1,177 @@
+/**
+ * @file Pwm.h
+ * @brief AUTOSAR PWM Driver Interface
+ * @details MCAL PWM driver of the lamp output stages (simulated). Every
+ *          duty cycle update is stamped with the virtual time set by
+ *          Pwm_SimSetTimeUs and restarts the period, so a plant model can
+ *          reconstruct the output waveform at any later point in time.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef PWM_H
+#define PWM_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define PWM_AR_RELEASE_MAJOR_VERSION        23
+#define PWM_AR_RELEASE_MINOR_VERSION        11
+
+#define PWM_SW_MAJOR_VERSION                1
+#define PWM_SW_MINOR_VERSION                0
+#define PWM_SW_PATCH_VERSION                0
+
+/*============================================================================*
+ * CONFIGURATION
+ *============================================================================*/
+
+/** @brief Number of PWM channels */
+#define PWM_NUM_CHANNELS                    2U
+
+/** @brief Period of the lamp outputs (200 Hz, above visible flicker) */
+#define PWM_DEFAULT_PERIOD_US               5000U
+
+/** @brief Delay of the high beam on phase within the period: below 50% duty
+ *         the on phases of both beams do not overlap on the shared supply
+ *         and current sense */
+#define PWM_HIGH_BEAM_PHASE_US              (PWM_DEFAULT_PERIOD_US / 2U)
+
+/** @brief Duty cycle of an output that is always high (AUTOSAR 0x8000 = 100%) */
+#define PWM_DUTY_100_PERCENT                0x8000U
+
+/** @brief Duty cycle of an output that is always low */
+#define PWM_DUTY_0_PERCENT                  0x0000U
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief PWM channel type
+ */
+typedef uint8_t Pwm_ChannelType;
+
+/**
+ * @brief PWM period type (microseconds)
+ */
+typedef uint32_t Pwm_PeriodType;
+
+/**
+ * @brief PWM output state type
+ */
+typedef enum {
+    PWM_LOW                 = 0x00U,    /**< Output low */
+    PWM_HIGH                = 0x01U     /**< Output high */
+} Pwm_OutputStateType;
+
+/**
+ * @brief Output waveform of a channel since its last duty cycle update
+ */
+typedef struct {
+    uint16_t DutyCycle;                 /**< 0 .. PWM_DUTY_100_PERCENT */
+    Pwm_PeriodType PeriodUs;            /**< Period length */
+    uint64_t StartUs;                   /**< Virtual time of the update (period start) */
+    Pwm_PeriodType PhaseUs;             /**< Start of the on phase within the period */
+    uint32_t Updates;                   /**< Duty cycle updates since Pwm_Init */
+} Pwm_SimChannelType;
+
+/**
+ * @brief PWM driver snapshot (Ecu_SaveSnapshot)
+ */
+typedef struct {
+    Pwm_SimChannelType Channels[PWM_NUM_CHANNELS];
+    uint64_t SimTimeUs;
+} Pwm_SnapshotType;
+
+/*============================================================================*
+ * PWM CHANNEL DEFINITIONS
+ *============================================================================*/
+
+/** @brief Low beam output stage */
+#define PWM_CHANNEL_LOW_BEAM                0U
+
+/** @brief High beam output stage */
+#define PWM_CHANNEL_HIGH_BEAM               1U
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize PWM driver
+ * @details All channels idle (low) with PWM_DEFAULT_PERIOD_US
+ */
+void Pwm_Init(void);
+
+/**
+ * @brief De-initialize PWM driver
+ * @details Sets all channels to idle
+ */
+void Pwm_DeInit(void);
+
+/**
+ * @brief Set duty cycle of a channel
+ * @details Takes effect immediately and restarts the period
+ * @param[in] ChannelNumber Channel to update
+ * @param[in] DutyCycle 0 .. PWM_DUTY_100_PERCENT (larger values are clamped)
+ */
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16_t DutyCycle);
+
+/**
+ * @brief Set a channel to its idle state (low)
+ * @param[in] ChannelNumber Channel to update
+ */
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber);
+
+/**
+ * @brief Get output state of a channel at the current virtual time
+ * @param[in] ChannelNumber Channel to read
+ * @return PWM_HIGH or PWM_LOW
+ */
+Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber);
+
+/**
+ * @brief Get version information
+ * @param[out] versioninfo Pointer to version info structure
+ */
+void Pwm_GetVersionInfo(Std_VersionInfoType* versioninfo);
+
+/**
+ * @brief Save channel waveforms (Ecu_SaveSnapshot)
+ * @param[out] Snapshot Channel waveforms and time base
+ */
+void Pwm_SaveSnapshot(Pwm_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore channel waveforms (Ecu_RestoreSnapshot)
+ * @param[in] Snapshot Channel waveforms and time base
+ */
+void Pwm_RestoreSnapshot(const Pwm_SnapshotType* Snapshot);
+
+/*============================================================================*
+ * SIMULATION FUNCTIONS (FOR TESTING)
+ *============================================================================*/
+
+/**
+ * @brief Set simulated time base of the duty cycle updates
+ * @param[in] timeUs Virtual time in microseconds
+ */
+void Pwm_SimSetTimeUs(uint64_t timeUs);
+
+/**
+ * @brief Get output waveform of a channel
+ * @param[in] ChannelNumber Channel to read
+ * @param[out] Channel Duty cycle, period and time of the last update
+ * @return E_OK on success, E_NOT_OK for invalid channels
+ */
+Std_ReturnType Pwm_SimGetChannel(Pwm_ChannelType ChannelNumber, Pwm_SimChannelType* Channel);
+
+#endif /* PWM_H */
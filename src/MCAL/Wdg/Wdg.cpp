@@ -0,0 +1,540 @@
+/**
+ * @file Wdg.cpp
+ * @brief AUTOSAR Watchdog Driver Implementation
+ * @details Common trigger window / timeout handling with a monitor thread,
+ *          backends provide arming, keepalive and the reset action
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety ASIL B - [SysSafReq03] Watchdog supervision
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Wdg.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/watchdog.h>
+#endif
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Watchdog backend operations
+ */
+typedef struct {
+    const char* Name;
+    Std_ReturnType (*Start)(uint16_t timeoutMs);    /**< Arm the watchdog */
+    void (*Kick)(uint16_t timeoutMs);               /**< Trigger with new timeout */
+    void (*Stop)(void);                             /**< Disarm the watchdog */
+    void (*Reset)(Wdg_ResetReasonType reason);      /**< Default reset action */
+} Wdg_BackendType;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static uint64_t Wdg_GetTimeNs(void);
+static void Wdg_Fire(Wdg_ResetReasonType reason);
+static void Wdg_MonitorThread(void);
+static void Wdg_WriteResetStamp(Wdg_ResetReasonType reason);
+static void Wdg_ReadResetStamp(void);
+
+static Std_ReturnType Wdg_Sw_Start(uint16_t timeoutMs);
+static void Wdg_Sw_Kick(uint16_t timeoutMs);
+static void Wdg_Sw_Stop(void);
+static void Wdg_Sw_Reset(Wdg_ResetReasonType reason);
+
+static Std_ReturnType Wdg_Dev_Start(uint16_t timeoutMs);
+static void Wdg_Dev_Kick(uint16_t timeoutMs);
+static void Wdg_Dev_Stop(void);
+static void Wdg_Dev_Reset(Wdg_ResetReasonType reason);
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Backend table, indexed by Wdg_BackendIdType */
+static const Wdg_BackendType Wdg_Backends[] = {
+    { "software",     Wdg_Sw_Start,  Wdg_Sw_Kick,  Wdg_Sw_Stop,  Wdg_Sw_Reset },
+    { "linux-device", Wdg_Dev_Start, Wdg_Dev_Kick, Wdg_Dev_Stop, Wdg_Dev_Reset }
+};
+
+/** @brief Initialization flag */
+static boolean Wdg_Initialized = FALSE;
+
+/** @brief Active configuration */
+static Wdg_ConfigType Wdg_Config;
+
+/** @brief Active backend */
+static const Wdg_BackendType* Wdg_Backend = NULL_PTR;
+
+/** @brief Current mode */
+static WdgIf_ModeType Wdg_CurrentMode = WDGIF_OFF_MODE;
+
+/** @brief Watchdog armed (deadline monitored) */
+static std::atomic<bool> Wdg_Armed(false);
+
+/** @brief Watchdog fired, no further triggers accepted */
+static std::atomic<bool> Wdg_Fired(false);
+
+/** @brief Monotonic deadline of the current trigger (ns) */
+static std::atomic<uint64_t> Wdg_DeadlineNs(0U);
+
+/** @brief Reset reason of this run */
+static std::atomic<uint8_t> Wdg_ResetReason(WDG_RESET_NONE);
+
+/** @brief Time of the last accepted trigger (ns), 0 = none since arming */
+static uint64_t Wdg_LastTriggerNs = 0U;
+
+/** @brief Monitor thread */
+static std::thread Wdg_Monitor;
+static std::atomic<bool> Wdg_MonitorRunning(false);
+
+/** @brief Reset that preceded this run */
+static Wdg_ResetInfoType Wdg_PreviousReset = { WDG_RESET_NONE, 0U };
+
+/** @brief Linux watchdog device handle */
+static int Wdg_DevFd = -1;
+static uint16_t Wdg_DevTimeoutS = 0U;
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize watchdog driver
+ */
+void Wdg_Init(const Wdg_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR) {
+        return;
+    }
+
+    if (static_cast<uint8_t>(ConfigPtr->Backend) >=
+        (sizeof(Wdg_Backends) / sizeof(Wdg_Backends[0]))) {
+        return;
+    }
+
+    if (Wdg_Initialized) {
+        Wdg_DeInit();
+    }
+
+    Wdg_Config = *ConfigPtr;
+    Wdg_Backend = &Wdg_Backends[ConfigPtr->Backend];
+    Wdg_CurrentMode = WDGIF_OFF_MODE;
+    Wdg_Armed = false;
+    Wdg_Fired = false;
+    Wdg_ResetReason = WDG_RESET_NONE;
+    Wdg_LastTriggerNs = 0U;
+
+    Wdg_ReadResetStamp();
+
+    Wdg_Initialized = TRUE;
+}
+
+/**
+ * @brief De-initialize watchdog driver
+ */
+void Wdg_DeInit(void) {
+    if (!Wdg_Initialized) {
+        return;
+    }
+
+    Wdg_Armed = false;
+
+    Wdg_MonitorRunning = false;
+    if (Wdg_Monitor.joinable()) {
+        Wdg_Monitor.join();
+    }
+
+    /* A fired device watchdog must not be disarmed by the shutdown */
+    if (!Wdg_Fired) {
+        Wdg_Backend->Stop();
+    }
+
+    Wdg_CurrentMode = WDGIF_OFF_MODE;
+    Wdg_Initialized = FALSE;
+}
+
+/**
+ * @brief Switch watchdog mode
+ */
+Std_ReturnType Wdg_SetMode(WdgIf_ModeType Mode) {
+    if (!Wdg_Initialized) {
+        return E_NOT_OK;
+    }
+
+    if (Mode == WDGIF_OFF_MODE) {
+#if (WDG_DISABLE_ALLOWED == STD_ON)
+        if (Wdg_CurrentMode != WDGIF_OFF_MODE) {
+            Wdg_Armed = false;
+            Wdg_MonitorRunning = false;
+            if (Wdg_Monitor.joinable()) {
+                Wdg_Monitor.join();
+            }
+            Wdg_Backend->Stop();
+        }
+        Wdg_CurrentMode = WDGIF_OFF_MODE;
+        return E_OK;
+#else
+        return E_NOT_OK;
+#endif
+    }
+
+    if (Wdg_CurrentMode == WDGIF_OFF_MODE) {
+        if (Wdg_Backend->Start(Wdg_Config.TimeoutMs) != E_OK) {
+            return E_NOT_OK;
+        }
+
+        Wdg_LastTriggerNs = 0U;
+        Wdg_DeadlineNs = Wdg_GetTimeNs() +
+            (static_cast<uint64_t>(Wdg_Config.TimeoutMs) * 1000000U);
+        Wdg_Armed = true;
+
+        Wdg_MonitorRunning = true;
+        Wdg_Monitor = std::thread(Wdg_MonitorThread);
+    }
+
+    Wdg_CurrentMode = Mode;
+    return E_OK;
+}
+
+/**
+ * @brief Get current watchdog mode
+ */
+WdgIf_ModeType Wdg_GetMode(void) {
+    return Wdg_CurrentMode;
+}
+
+/**
+ * @brief Trigger the watchdog and set the timeout until the next trigger
+ */
+void Wdg_SetTriggerCondition(uint16_t timeout) {
+    uint64_t nowNs;
+
+    if ((!Wdg_Initialized) || (Wdg_CurrentMode == WDGIF_OFF_MODE) || Wdg_Fired) {
+        return;
+    }
+
+    if (timeout == 0U) {
+        Wdg_Fire(WDG_RESET_REQUESTED);
+        return;
+    }
+
+    nowNs = Wdg_GetTimeNs();
+
+    /* Window watchdog: too early a trigger is as bad as a missing one */
+    if ((Wdg_Config.WindowMs > 0U) && (Wdg_LastTriggerNs != 0U) &&
+        ((nowNs - Wdg_LastTriggerNs) < (static_cast<uint64_t>(Wdg_Config.WindowMs) * 1000000U))) {
+        Wdg_Fire(WDG_RESET_WINDOW_VIOLATION);
+        return;
+    }
+
+    Wdg_LastTriggerNs = nowNs;
+    Wdg_DeadlineNs = nowNs + (static_cast<uint64_t>(timeout) * 1000000U);
+    Wdg_Backend->Kick(timeout);
+}
+
+/**
+ * @brief Get reset reason of this run
+ */
+Wdg_ResetReasonType Wdg_GetResetReason(void) {
+    return static_cast<Wdg_ResetReasonType>(Wdg_ResetReason.load());
+}
+
+/**
+ * @brief Get information about the watchdog reset preceding this run
+ */
+Std_ReturnType Wdg_GetPreviousReset(Wdg_ResetInfoType* ResetInfo) {
+    if (ResetInfo == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    if (Wdg_PreviousReset.Reason == WDG_RESET_NONE) {
+        return E_NOT_OK;
+    }
+
+    *ResetInfo = Wdg_PreviousReset;
+    return E_OK;
+}
+
+/**
+ * @brief Get wall clock time for recovery time measurement
+ */
+uint64_t Wdg_GetWallClockNs(void) {
+    /* Wall clock: survives process restart and (with RTC) a device reset */
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Get version information
+ */
+void Wdg_GetVersionInfo(Std_VersionInfoType* VersionInfo) {
+    if (VersionInfo == NULL_PTR) {
+        return;
+    }
+
+    VersionInfo->vendorID = 0U;
+    VersionInfo->moduleID = 102U;  /* Wdg module ID */
+    VersionInfo->sw_major_version = WDG_SW_MAJOR_VERSION;
+    VersionInfo->sw_minor_version = WDG_SW_MINOR_VERSION;
+    VersionInfo->sw_patch_version = WDG_SW_PATCH_VERSION;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get monotonic time for trigger supervision
+ */
+static uint64_t Wdg_GetTimeNs(void) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+/**
+ * @brief Fire the watchdog (once per run)
+ * @param[in] reason Reset reason
+ */
+static void Wdg_Fire(Wdg_ResetReasonType reason) {
+    if (Wdg_Fired.exchange(true)) {
+        return;
+    }
+
+    Wdg_Armed = false;
+    Wdg_ResetReason = static_cast<uint8_t>(reason);
+
+    Wdg_WriteResetStamp(reason);
+
+    if (Wdg_Config.ResetCallback != NULL_PTR) {
+        Wdg_Config.ResetCallback(reason);
+    } else {
+        Wdg_Backend->Reset(reason);
+    }
+}
+
+/**
+ * @brief Monitor thread: fire when the trigger deadline passed
+ */
+static void Wdg_MonitorThread(void) {
+    while (Wdg_MonitorRunning) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(WDG_SW_POLL_PERIOD_MS));
+
+        if (Wdg_Armed && (Wdg_GetTimeNs() > Wdg_DeadlineNs)) {
+            Wdg_Fire(WDG_RESET_TIMEOUT);
+        }
+    }
+}
+
+/**
+ * @brief Record reset time for restart-to-first-frame measurement
+ */
+static void Wdg_WriteResetStamp(Wdg_ResetReasonType reason) {
+    FILE* stamp;
+
+    if (Wdg_Config.ResetStampPath == NULL_PTR) {
+        return;
+    }
+
+    stamp = std::fopen(Wdg_Config.ResetStampPath, "w");
+    if (stamp == NULL_PTR) {
+        return;
+    }
+
+    std::fprintf(stamp, "%u %llu\n", static_cast<unsigned int>(reason),
+                 static_cast<unsigned long long>(Wdg_GetWallClockNs()));
+    std::fclose(stamp);
+}
+
+/**
+ * @brief Consume reset time left by the previous run
+ */
+static void Wdg_ReadResetStamp(void) {
+    FILE* stamp;
+    unsigned int reason = 0U;
+    unsigned long long timeNs = 0U;
+
+    Wdg_PreviousReset.Reason = WDG_RESET_NONE;
+    Wdg_PreviousReset.ResetTimeNs = 0U;
+
+    if (Wdg_Config.ResetStampPath == NULL_PTR) {
+        return;
+    }
+
+    stamp = std::fopen(Wdg_Config.ResetStampPath, "r");
+    if (stamp == NULL_PTR) {
+        return;
+    }
+
+    if ((std::fscanf(stamp, "%u %llu", &reason, &timeNs) == 2) &&
+        (reason > static_cast<unsigned int>(WDG_RESET_NONE)) &&
+        (reason <= static_cast<unsigned int>(WDG_RESET_REQUESTED))) {
+        Wdg_PreviousReset.Reason = static_cast<Wdg_ResetReasonType>(reason);
+        Wdg_PreviousReset.ResetTimeNs = static_cast<uint64_t>(timeNs);
+    }
+
+    std::fclose(stamp);
+    (void)std::remove(Wdg_Config.ResetStampPath);
+}
+
+/*----------------------------------------------------------------------------*
+ * Software backend
+ *----------------------------------------------------------------------------*/
+
+static Std_ReturnType Wdg_Sw_Start(uint16_t timeoutMs) {
+    STD_UNUSED(timeoutMs);
+    return E_OK;
+}
+
+static void Wdg_Sw_Kick(uint16_t timeoutMs) {
+    STD_UNUSED(timeoutMs);
+}
+
+static void Wdg_Sw_Stop(void) {
+}
+
+/**
+ * @brief Restart the process image (software "MCU reset")
+ */
+static void Wdg_Sw_Reset(Wdg_ResetReasonType reason) {
+    std::fprintf(stderr, "Wdg: watchdog reset (reason %u), restarting\n",
+                 static_cast<unsigned int>(reason));
+    std::fflush(stdout);
+    std::fflush(stderr);
+
+#if defined(__linux__)
+    {
+        std::string cmdline;
+        std::vector<char*> argv;
+        FILE* file = std::fopen("/proc/self/cmdline", "r");
+        int c;
+        size_t pos;
+
+        if (file != NULL_PTR) {
+            while ((c = std::fgetc(file)) != EOF) {
+                cmdline.push_back(static_cast<char>(c));
+            }
+            std::fclose(file);
+        }
+
+        for (pos = 0U; pos < cmdline.size(); pos += std::char_traits<char>::length(&cmdline[pos]) + 1U) {
+            argv.push_back(&cmdline[pos]);
+        }
+        argv.push_back(NULL_PTR);
+
+        if (argv.size() > 1U) {
+            (void)execv("/proc/self/exe", argv.data());
+        }
+    }
+#endif
+
+    /* Restart not possible: terminate so that a supervisor restarts us */
+    std::abort();
+}
+
+/*----------------------------------------------------------------------------*
+ * Linux watchdog device backend
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @brief Convert timeout to device resolution (seconds, rounded up)
+ */
+static uint16_t Wdg_Dev_TimeoutSeconds(uint16_t timeoutMs) {
+    uint16_t seconds = static_cast<uint16_t>((timeoutMs + 999U) / 1000U);
+    return (seconds == 0U) ? 1U : seconds;
+}
+
+static Std_ReturnType Wdg_Dev_Start(uint16_t timeoutMs) {
+#if defined(__linux__)
+    int timeoutS = static_cast<int>(Wdg_Dev_TimeoutSeconds(timeoutMs));
+    const char* path = (Wdg_Config.DevicePath != NULL_PTR) ?
+                       Wdg_Config.DevicePath : WDG_LINUX_DEVICE_PATH;
+
+    /* Opening the device arms it */
+    Wdg_DevFd = open(path, O_WRONLY | O_CLOEXEC);
+    if (Wdg_DevFd < 0) {
+        return E_NOT_OK;
+    }
+
+    (void)ioctl(Wdg_DevFd, WDIOC_SETTIMEOUT, &timeoutS);
+    (void)ioctl(Wdg_DevFd, WDIOC_KEEPALIVE, 0);
+    Wdg_DevTimeoutS = static_cast<uint16_t>(timeoutS);
+    return E_OK;
+#else
+    STD_UNUSED(timeoutMs);
+    return E_NOT_OK;
+#endif
+}
+
+static void Wdg_Dev_Kick(uint16_t timeoutMs) {
+#if defined(__linux__)
+    int timeoutS = static_cast<int>(Wdg_Dev_TimeoutSeconds(timeoutMs));
+
+    if (Wdg_DevFd < 0) {
+        return;
+    }
+
+    if (static_cast<uint16_t>(timeoutS) != Wdg_DevTimeoutS) {
+        (void)ioctl(Wdg_DevFd, WDIOC_SETTIMEOUT, &timeoutS);
+        Wdg_DevTimeoutS = static_cast<uint16_t>(timeoutS);
+    }
+    (void)ioctl(Wdg_DevFd, WDIOC_KEEPALIVE, 0);
+#else
+    STD_UNUSED(timeoutMs);
+#endif
+}
+
+static void Wdg_Dev_Stop(void) {
+#if defined(__linux__)
+    if (Wdg_DevFd < 0) {
+        return;
+    }
+
+    /* Magic close: disarm unless the driver was loaded with nowayout */
+    (void)write(Wdg_DevFd, "V", 1U);
+    (void)close(Wdg_DevFd);
+    Wdg_DevFd = -1;
+#endif
+}
+
+/**
+ * @brief Stop keepalives and let the device reset with its shortest timeout
+ */
+static void Wdg_Dev_Reset(Wdg_ResetReasonType reason) {
+#if defined(__linux__)
+    int timeoutS = 1;
+
+    std::fprintf(stderr, "Wdg: watchdog reset (reason %u), waiting for device\n",
+                 static_cast<unsigned int>(reason));
+
+    if (Wdg_DevFd >= 0) {
+        (void)ioctl(Wdg_DevFd, WDIOC_SETTIMEOUT, &timeoutS);
+        Wdg_DevTimeoutS = 1U;
+    }
+#else
+    STD_UNUSED(reason);
+#endif
+}
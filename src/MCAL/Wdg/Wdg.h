@@ -0,0 +1,178 @@
+/**
+ * @file Wdg.h
+ * @brief AUTOSAR Watchdog Driver Interface
+ * @details MCAL watchdog driver below WdgM with pluggable backends:
+ *          - Software watchdog: monitor thread with trigger window, restarts
+ *            the process when the trigger is missed
+ *          - Linux watchdog device: /dev/watchdog (e.g. softdog) keepalive
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ *
+ * @safety ASIL B - [SysSafReq03] Watchdog supervision
+ */
+
+#ifndef WDG_H
+#define WDG_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define WDG_AR_RELEASE_MAJOR_VERSION        23
+#define WDG_AR_RELEASE_MINOR_VERSION        11
+
+#define WDG_SW_MAJOR_VERSION                1
+#define WDG_SW_MINOR_VERSION                0
+#define WDG_SW_PATCH_VERSION                0
+
+/*============================================================================*
+ * CONFIGURATION
+ *============================================================================*/
+
+/** @brief Default trigger timeout (ms) */
+#define WDG_DEFAULT_TIMEOUT_MS              50U
+
+/** @brief Default window open time after a trigger (ms, 0 = no window) */
+#define WDG_DEFAULT_WINDOW_MS               2U
+
+/** @brief Software watchdog monitor thread polling period (ms) */
+#define WDG_SW_POLL_PERIOD_MS               1U
+
+/** @brief Default Linux watchdog device */
+#define WDG_LINUX_DEVICE_PATH               "/dev/watchdog"
+
+/** @brief Default reset timestamp file for recovery time measurement */
+#define WDG_RESET_STAMP_PATH                "flm_wdg_reset.stamp"
+
+/** @brief Allow disabling an armed watchdog (WDGIF_OFF_MODE) */
+#define WDG_DISABLE_ALLOWED                 STD_ON
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Watchdog mode type
+ */
+typedef enum {
+    WDGIF_OFF_MODE      = 0x00U,    /**< Watchdog disabled */
+    WDGIF_SLOW_MODE     = 0x01U,    /**< Armed, used during startup */
+    WDGIF_FAST_MODE     = 0x02U     /**< Armed, normal operation */
+} WdgIf_ModeType;
+
+/**
+ * @brief Watchdog backend type
+ */
+typedef enum {
+    WDG_BACKEND_SOFTWARE        = 0x00U,    /**< Monitor thread, process restart */
+    WDG_BACKEND_LINUX_DEVICE    = 0x01U     /**< Linux /dev/watchdog interface */
+} Wdg_BackendIdType;
+
+/**
+ * @brief Watchdog reset reason type
+ */
+typedef enum {
+    WDG_RESET_NONE              = 0x00U,    /**< No reset */
+    WDG_RESET_TIMEOUT           = 0x01U,    /**< Trigger missed */
+    WDG_RESET_WINDOW_VIOLATION  = 0x02U,    /**< Trigger before window opened */
+    WDG_RESET_REQUESTED         = 0x03U     /**< Trigger condition 0 (reset request) */
+} Wdg_ResetReasonType;
+
+/**
+ * @brief Reset action callback
+ * @details Called once when the watchdog fires. NULL_PTR selects the default
+ *          action of the backend (process restart / device reset).
+ */
+typedef void (*Wdg_ResetCallbackType)(Wdg_ResetReasonType reason);
+
+/**
+ * @brief Information about the reset that preceded this run
+ */
+typedef struct {
+    Wdg_ResetReasonType Reason;     /**< Reset reason */
+    uint64_t ResetTimeNs;           /**< Wall clock time of the reset (ns) */
+} Wdg_ResetInfoType;
+
+/**
+ * @brief Watchdog configuration type
+ */
+typedef struct {
+    Wdg_BackendIdType Backend;              /**< Selected backend */
+    uint16_t TimeoutMs;                     /**< Initial trigger timeout */
+    uint16_t WindowMs;                      /**< Minimum time between triggers */
+    const char* DevicePath;                 /**< Watchdog device (Linux backend) */
+    const char* ResetStampPath;             /**< Reset timestamp file (NULL_PTR = off) */
+    Wdg_ResetCallbackType ResetCallback;    /**< Reset action (NULL_PTR = default) */
+} Wdg_ConfigType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize watchdog driver
+ * @details The watchdog stays in WDGIF_OFF_MODE until Wdg_SetMode. A reset
+ *          timestamp left by the previous run is consumed here.
+ * @param[in] ConfigPtr Pointer to configuration
+ */
+void Wdg_Init(const Wdg_ConfigType* ConfigPtr);
+
+/**
+ * @brief De-initialize watchdog driver
+ * @details Disarms the backend (magic close for the Linux device)
+ */
+void Wdg_DeInit(void);
+
+/**
+ * @brief Switch watchdog mode
+ * @param[in] Mode Requested mode
+ * @return E_OK on success, E_NOT_OK if the backend could not be started
+ */
+Std_ReturnType Wdg_SetMode(WdgIf_ModeType Mode);
+
+/**
+ * @brief Get current watchdog mode
+ * @return Current mode
+ */
+WdgIf_ModeType Wdg_GetMode(void);
+
+/**
+ * @brief Trigger the watchdog and set the timeout until the next trigger
+ * @details A timeout of 0 requests a reset as fast as possible. A trigger
+ *          before the window opened is a window violation and resets.
+ * @param[in] timeout Time in ms until the watchdog fires
+ */
+void Wdg_SetTriggerCondition(uint16_t timeout);
+
+/**
+ * @brief Get reset reason of this run
+ * @return WDG_RESET_NONE while the watchdog has not fired
+ */
+Wdg_ResetReasonType Wdg_GetResetReason(void);
+
+/**
+ * @brief Get information about the watchdog reset preceding this run
+ * @param[out] ResetInfo Pointer to receive reset information
+ * @return E_OK if this run was started by a watchdog reset
+ */
+Std_ReturnType Wdg_GetPreviousReset(Wdg_ResetInfoType* ResetInfo);
+
+/**
+ * @brief Get wall clock time for recovery time measurement
+ * @return Time in ns, comparable to Wdg_ResetInfoType::ResetTimeNs
+ */
+uint64_t Wdg_GetWallClockNs(void);
+
+/**
+ * @brief Get version information
+ * @param[out] VersionInfo Pointer to version info
+ */
+void Wdg_GetVersionInfo(Std_VersionInfoType* VersionInfo);
+
+#endif /* WDG_H */
@@ -0,0 +1,276 @@
+/**
+ * @file Rte.cpp
+ * @brief RTE Sender/Receiver Port Implementation
+ * @details Port buffers of the FLM application and the Rte_Write_* /
+ *          Rte_IRead_* APIs of the SWCs. Each port holds two buffers; the
+ *          publish sequence selects the published one (sequence & 1), so a
+ *          write is one buffer fill plus one release store and a read is one
+ *          acquire load.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Rte/Rte.h"
+#include "Rte/Rte_SwitchEvent.h"
+#include "Rte/Rte_LightRequest.h"
+#include "Rte/Rte_FLM.h"
+#include "Rte/Rte_Headlight.h"
+#include "Rte/Rte_SafetyMonitor.h"
+#include <atomic>
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL DEFINITIONS
+ *============================================================================*/
+
+/** @brief Initial port values: invalid inputs, lights off */
+#define RTE_LIGHTSWITCH_INIT        { { LIGHT_SWITCH_OFF, FALSE, 0U }, 0U, \
+                                      E2E_P01STATUS_INITIAL, E2E_SM_DEINIT, FALSE }
+#define RTE_AMBIENTLIGHT_INIT       { { 0U, 0U, FALSE }, SIGNAL_STATUS_INVALID, 0U }
+#define RTE_HEADLIGHTCMD_INIT       { HEADLIGHT_CMD_OFF, FLM_STATE_INIT, 0U }
+#define RTE_HEADLIGHTSTATUS_INIT    { HEADLIGHT_FAULT_NONE, FALSE, 0U }
+#define RTE_SAFETYSTATUS_INIT       { SAFETY_STATUS_OK, FALSE, HEADLIGHT_CMD_OFF, 0U }
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Port configuration
+ */
+typedef struct {
+    void* Buffers[2];                   /**< Double buffer */
+    const void* InitValue;              /**< Value before the first publish */
+    uint16_t Size;                      /**< Size of one buffer */
+} Rte_PortConfigType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Port buffers */
+static Rte_IrvLightSwitchType Rte_LightSwitchBuffers[2] = {
+    RTE_LIGHTSWITCH_INIT, RTE_LIGHTSWITCH_INIT
+};
+static Rte_IrvAmbientLightType Rte_AmbientLightBuffers[2] = {
+    RTE_AMBIENTLIGHT_INIT, RTE_AMBIENTLIGHT_INIT
+};
+static Rte_IrvHeadlightCmdType Rte_HeadlightCmdBuffers[2] = {
+    RTE_HEADLIGHTCMD_INIT, RTE_HEADLIGHTCMD_INIT
+};
+static Rte_IrvHeadlightStatusType Rte_HeadlightStatusBuffers[2] = {
+    RTE_HEADLIGHTSTATUS_INIT, RTE_HEADLIGHTSTATUS_INIT
+};
+static Rte_IrvSafetyStatusType Rte_SafetyStatusBuffers[2] = {
+    RTE_SAFETYSTATUS_INIT, RTE_SAFETYSTATUS_INIT
+};
+
+/** @brief Initial values, restored by Rte_Start */
+static const Rte_IrvLightSwitchType Rte_LightSwitchInit = RTE_LIGHTSWITCH_INIT;
+static const Rte_IrvAmbientLightType Rte_AmbientLightInit = RTE_AMBIENTLIGHT_INIT;
+static const Rte_IrvHeadlightCmdType Rte_HeadlightCmdInit = RTE_HEADLIGHTCMD_INIT;
+static const Rte_IrvHeadlightStatusType Rte_HeadlightStatusInit = RTE_HEADLIGHTSTATUS_INIT;
+static const Rte_IrvSafetyStatusType Rte_SafetyStatusInit = RTE_SAFETYSTATUS_INIT;
+
+/** @brief Ports, indexed by port ID */
+static const Rte_PortConfigType Rte_PortConfig[RTE_NUM_PORTS] = {
+    { { &Rte_LightSwitchBuffers[0], &Rte_LightSwitchBuffers[1] },
+      &Rte_LightSwitchInit, sizeof(Rte_IrvLightSwitchType) },
+    { { &Rte_AmbientLightBuffers[0], &Rte_AmbientLightBuffers[1] },
+      &Rte_AmbientLightInit, sizeof(Rte_IrvAmbientLightType) },
+    { { &Rte_HeadlightCmdBuffers[0], &Rte_HeadlightCmdBuffers[1] },
+      &Rte_HeadlightCmdInit, sizeof(Rte_IrvHeadlightCmdType) },
+    { { &Rte_HeadlightStatusBuffers[0], &Rte_HeadlightStatusBuffers[1] },
+      &Rte_HeadlightStatusInit, sizeof(Rte_IrvHeadlightStatusType) },
+    { { &Rte_SafetyStatusBuffers[0], &Rte_SafetyStatusBuffers[1] },
+      &Rte_SafetyStatusInit, sizeof(Rte_IrvSafetyStatusType) }
+};
+
+/** @brief Publish sequences: the published buffer is sequence & 1 */
+static std::atomic<uint32_t> Rte_PortSequence[RTE_NUM_PORTS];
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static Rte_StatusType Rte_PortWrite(Rte_PortIdType port, const void* data);
+static const void* Rte_PortRead(Rte_PortIdType port);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Start the RTE
+ */
+void Rte_Start(void) {
+    Rte_PortIdType port;
+
+    for (port = 0U; port < RTE_NUM_PORTS; port++) {
+        (void)std::memcpy(Rte_PortConfig[port].Buffers[0], Rte_PortConfig[port].InitValue,
+                          Rte_PortConfig[port].Size);
+        (void)std::memcpy(Rte_PortConfig[port].Buffers[1], Rte_PortConfig[port].InitValue,
+                          Rte_PortConfig[port].Size);
+        Rte_PortSequence[port].store(0U, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Get the publish sequence of a port
+ */
+uint32_t Rte_GetPortSequence(Rte_PortIdType Port) {
+    if (Port >= RTE_NUM_PORTS) {
+        return 0U;
+    }
+
+    return Rte_PortSequence[Port].load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Save the port buffers
+ */
+void Rte_SaveSnapshot(Rte_SnapshotType* Snapshot) {
+    Rte_PortIdType port;
+
+    (void)std::memcpy(Snapshot->LightSwitch, Rte_LightSwitchBuffers, sizeof(Rte_LightSwitchBuffers));
+    (void)std::memcpy(Snapshot->AmbientLight, Rte_AmbientLightBuffers, sizeof(Rte_AmbientLightBuffers));
+    (void)std::memcpy(Snapshot->HeadlightCmd, Rte_HeadlightCmdBuffers, sizeof(Rte_HeadlightCmdBuffers));
+    (void)std::memcpy(Snapshot->HeadlightStatus, Rte_HeadlightStatusBuffers,
+                      sizeof(Rte_HeadlightStatusBuffers));
+    (void)std::memcpy(Snapshot->SafetyStatus, Rte_SafetyStatusBuffers, sizeof(Rte_SafetyStatusBuffers));
+    for (port = 0U; port < RTE_NUM_PORTS; port++) {
+        Snapshot->PortSequence[port] = Rte_PortSequence[port].load(std::memory_order_acquire);
+    }
+}
+
+/**
+ * @brief Restore the port buffers
+ */
+void Rte_RestoreSnapshot(const Rte_SnapshotType* Snapshot) {
+    Rte_PortIdType port;
+
+    (void)std::memcpy(Rte_LightSwitchBuffers, Snapshot->LightSwitch, sizeof(Rte_LightSwitchBuffers));
+    (void)std::memcpy(Rte_AmbientLightBuffers, Snapshot->AmbientLight, sizeof(Rte_AmbientLightBuffers));
+    (void)std::memcpy(Rte_HeadlightCmdBuffers, Snapshot->HeadlightCmd, sizeof(Rte_HeadlightCmdBuffers));
+    (void)std::memcpy(Rte_HeadlightStatusBuffers, Snapshot->HeadlightStatus,
+                      sizeof(Rte_HeadlightStatusBuffers));
+    (void)std::memcpy(Rte_SafetyStatusBuffers, Snapshot->SafetyStatus, sizeof(Rte_SafetyStatusBuffers));
+    for (port = 0U; port < RTE_NUM_PORTS; port++) {
+        Rte_PortSequence[port].store(Snapshot->PortSequence[port], std::memory_order_release);
+    }
+}
+
+/*============================================================================*
+ * SWITCHEVENT PORTS
+ *============================================================================*/
+
+Rte_StatusType Rte_Write_SwitchEvent_LightSwitch(const Rte_IrvLightSwitchType* data) {
+    return Rte_PortWrite(RTE_PORT_LIGHTSWITCH, data);
+}
+
+/*============================================================================*
+ * LIGHTREQUEST PORTS
+ *============================================================================*/
+
+Rte_StatusType Rte_Write_LightRequest_AmbientLight(const Rte_IrvAmbientLightType* data) {
+    return Rte_PortWrite(RTE_PORT_AMBIENTLIGHT, data);
+}
+
+/*============================================================================*
+ * FLM PORTS
+ *============================================================================*/
+
+const Rte_IrvLightSwitchType* Rte_IRead_FLM_LightSwitch(void) {
+    return static_cast<const Rte_IrvLightSwitchType*>(Rte_PortRead(RTE_PORT_LIGHTSWITCH));
+}
+
+const Rte_IrvAmbientLightType* Rte_IRead_FLM_AmbientLight(void) {
+    return static_cast<const Rte_IrvAmbientLightType*>(Rte_PortRead(RTE_PORT_AMBIENTLIGHT));
+}
+
+Rte_StatusType Rte_Write_FLM_HeadlightCmd(const Rte_IrvHeadlightCmdType* data) {
+    return Rte_PortWrite(RTE_PORT_HEADLIGHTCMD, data);
+}
+
+Rte_StatusType Rte_Mode_FLM_SafetyMode(SafetyStatusType* status) {
+    if (status == NULL_PTR) {
+        return RTE_E_INVALID;
+    }
+
+    *status = static_cast<const Rte_IrvSafetyStatusType*>(
+        Rte_PortRead(RTE_PORT_SAFETYSTATUS))->globalStatus;
+    return RTE_E_OK;
+}
+
+/*============================================================================*
+ * HEADLIGHT PORTS
+ *============================================================================*/
+
+const Rte_IrvHeadlightCmdType* Rte_IRead_Headlight_HeadlightCmd(void) {
+    return static_cast<const Rte_IrvHeadlightCmdType*>(Rte_PortRead(RTE_PORT_HEADLIGHTCMD));
+}
+
+Rte_StatusType Rte_Write_Headlight_Status(const Rte_IrvHeadlightStatusType* data) {
+    return Rte_PortWrite(RTE_PORT_HEADLIGHTSTATUS, data);
+}
+
+/*============================================================================*
+ * SAFETYMONITOR PORTS
+ *============================================================================*/
+
+const Rte_IrvLightSwitchType* Rte_IRead_SafetyMonitor_LightSwitch(void) {
+    return static_cast<const Rte_IrvLightSwitchType*>(Rte_PortRead(RTE_PORT_LIGHTSWITCH));
+}
+
+const Rte_IrvAmbientLightType* Rte_IRead_SafetyMonitor_AmbientLight(void) {
+    return static_cast<const Rte_IrvAmbientLightType*>(Rte_PortRead(RTE_PORT_AMBIENTLIGHT));
+}
+
+const Rte_IrvHeadlightCmdType* Rte_IRead_SafetyMonitor_HeadlightCmd(void) {
+    return static_cast<const Rte_IrvHeadlightCmdType*>(Rte_PortRead(RTE_PORT_HEADLIGHTCMD));
+}
+
+const Rte_IrvHeadlightStatusType* Rte_IRead_SafetyMonitor_HeadlightStatus(void) {
+    return static_cast<const Rte_IrvHeadlightStatusType*>(Rte_PortRead(RTE_PORT_HEADLIGHTSTATUS));
+}
+
+Rte_StatusType Rte_Write_SafetyMonitor_SafetyStatus(const Rte_IrvSafetyStatusType* data) {
+    return Rte_PortWrite(RTE_PORT_SAFETYSTATUS, data);
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Publish port data
+ * @details Fills the inactive buffer, then flips the published index with a
+ *          release store; only the port's sender writes the sequence. Writes
+ *          before Rte_Start are accepted so SWCs can be used standalone.
+ */
+static Rte_StatusType Rte_PortWrite(Rte_PortIdType port, const void* data) {
+    const Rte_PortConfigType* config = &Rte_PortConfig[port];
+    uint32_t next;
+
+    if (data == NULL_PTR) {
+        return RTE_E_INVALID;
+    }
+
+    next = Rte_PortSequence[port].load(std::memory_order_relaxed) + 1U;
+    (void)std::memcpy(config->Buffers[next & 1U], data, config->Size);
+    Rte_PortSequence[port].store(next, std::memory_order_release);
+
+    return RTE_E_OK;
+}
+
+/**
+ * @brief Get the published buffer of a port
+ */
+static const void* Rte_PortRead(Rte_PortIdType port) {
+    return Rte_PortConfig[port].Buffers[Rte_PortSequence[port].load(std::memory_order_acquire) & 1U];
+}
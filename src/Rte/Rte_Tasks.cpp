@@ -0,0 +1,102 @@
+/**
+ * @file Rte_Tasks.cpp
+ * @brief OS Task Bodies of the FLM ECU
+ * @details Runnables of the 5ms, 10ms and 20ms tasks. BSW state shared with
+ *          BswM actions is accessed under the Os spinlocks, SWC data goes
+ *          through the RTE ports.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Rte/Rte_Tasks.h"
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/LightRequest/LightRequest.h"
+#include "Application/FLM/FLM_Application.h"
+#include "Application/Headlight/Headlight.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/Dem/Dem.h"
+#include "BSW/Com/Com.h"
+#include "BSW/BswM/BswM.h"
+#include "BSW/Os/Os.h"
+#include "MCAL/Can/Can.h"
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief FLM runnable hook (NULL_PTR = FLM always runs) */
+static Rte_SimFlmHookType Rte_SimFlmHook = NULL_PTR;
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief 5ms task
+ */
+void Rte_Task_5ms(void) {
+    /* Safety Monitor - highest priority */
+    SafetyMonitor_MainFunction();
+
+    /* Watchdog Manager */
+    WdgM_MainFunction();
+
+    /* BSW Mode Manager */
+    BswM_MainFunction();
+}
+
+/**
+ * @brief 10ms task
+ */
+void Rte_Task_10ms(void) {
+    /* COM RX processing */
+    Os_GetSpinlock(OS_SPINLOCK_COMSTACK);
+    Com_MainFunctionRx();
+
+    /* CAN RX processing */
+    Can_MainFunction_Read();
+    Os_ReleaseSpinlock(OS_SPINLOCK_COMSTACK);
+
+    /* SwitchEvent - CAN light switch processing */
+    SwitchEvent_MainFunction();
+
+    /* FLM Application - main control logic (stalled by fault injection) */
+    if ((Rte_SimFlmHook == NULL_PTR) || Rte_SimFlmHook()) {
+        FLM_MainFunction();
+    }
+
+    /* Headlight - output control */
+    Headlight_MainFunction();
+
+    /* CAN TX processing */
+    Os_GetSpinlock(OS_SPINLOCK_COMSTACK);
+    Can_MainFunction_Write();
+
+    /* COM TX processing */
+    Com_MainFunctionTx();
+
+    /* DEM main function */
+    Dem_MainFunction();
+    Os_ReleaseSpinlock(OS_SPINLOCK_COMSTACK);
+}
+
+/**
+ * @brief 20ms task
+ */
+void Rte_Task_20ms(void) {
+    /* LightRequest - ambient light sensor */
+    LightRequest_MainFunction();
+}
+
+/**
+ * @brief Set simulated FLM runnable hook
+ */
+void Rte_SimSetFlmHook(Rte_SimFlmHookType Hook) {
+    Rte_SimFlmHook = Hook;
+}
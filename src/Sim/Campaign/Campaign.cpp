@@ -0,0 +1,493 @@
+/**
+ * @file Campaign.cpp
+ * @brief Fault-Injection Campaign Implementation
+ * @details Closed-loop ticks on the task bodies of the main scheduler, warm
+ *          starts per injection time and forked variant workers
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Campaign.h"
+#include "BSW/EcuM/EcuM.h"
+#include "BSW/EcuM/Ecu_Snapshot.h"
+#include "BSW/E2E/E2E_P01.h"
+#include "BSW/Os/Os.h"
+#include "Rte/Rte_Tasks.h"
+#include "Sim/Lamp/Lamp.h"
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*============================================================================*
+ * LOCAL DEFINITIONS
+ *============================================================================*/
+
+/** @brief No fault active in a tick */
+#define CAMPAIGN_FAULT_NONE                 0xFFU
+
+/** @brief Byte of the light switch CRC */
+#define CAMPAIGN_E2E_CRC_BYTE               (FLM_E2E_CRC_OFFSET / 8U)
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Closed-loop state at one injection time
+ */
+typedef struct {
+    Ecu_SnapshotType Ecu;               /**< ECU modules */
+    Lamp_SnapshotType Lamp;             /**< Lamp model */
+    E2E_P01ProtectStateType Sender;     /**< Light switch sender */
+    uint32_t TickMs;                    /**< Time of the warm start */
+} Campaign_WarmStartType;
+
+/**
+ * @brief Memory shared with the workers, followed by the results
+ */
+typedef struct {
+    std::atomic<uint32_t> NextVariant;  /**< Next variant to claim */
+} Campaign_SharedType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Warm starts, indexed by injection time */
+static Campaign_WarmStartType Campaign_WarmStarts[CAMPAIGN_MAX_INJECTIONS];
+
+/** @brief Light switch sender */
+static E2E_P01ConfigType Campaign_SenderConfig;
+static E2E_P01ProtectStateType Campaign_Sender;
+
+/** @brief Virtual time of the next tick (ms) */
+static uint32_t Campaign_TickMs = 0U;
+
+/** @brief Fault active in the running tick */
+static uint8_t Campaign_TickFault = CAMPAIGN_FAULT_NONE;
+
+/** @brief Ambient level of a stuck sensor */
+static Adc_ValueGroupType Campaign_StuckLevel = 0U;
+
+/** @brief Fault model names, indexed by Campaign_FaultType */
+static const char* const Campaign_FaultNames[CAMPAIGN_NUM_FAULTS] = {
+    "e2e-crc",
+    "e2e-counter-jump",
+    "can-loss",
+    "adc-open",
+    "adc-short",
+    "adc-stuck",
+    "lamp-open-load",
+    "wdgm-alive-miss"
+};
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static Std_ReturnType Campaign_CheckCatalogue(const Campaign_CatalogueType* Catalogue);
+static void Campaign_ResetSim(void);
+static Std_ReturnType Campaign_WarmUp(const Campaign_CatalogueType* Catalogue);
+static void Campaign_RunWorker(const Campaign_CatalogueType* Catalogue,
+                               Campaign_SharedType* Shared, uint32_t NumVariants);
+static void Campaign_RunVariant(const Campaign_CatalogueType* Catalogue, uint32_t Variant,
+                                Campaign_ResultType* Result);
+static void Campaign_Tick(uint8_t Fault);
+static void Campaign_SendLightSwitch(uint8_t Fault);
+static boolean Campaign_FlmHook(void);
+static Adc_ValueGroupType Campaign_GetNominalAmbient(uint32_t tickMs);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Get the number of variants of a catalogue
+ */
+uint32_t Campaign_GetNumVariants(const Campaign_CatalogueType* Catalogue) {
+    if (Catalogue == NULL_PTR) {
+        return 0U;
+    }
+
+    return static_cast<uint32_t>(Catalogue->NumFaults) * Catalogue->NumInjections *
+           Catalogue->NumDurations;
+}
+
+/**
+ * @brief Run a campaign
+ */
+Std_ReturnType Campaign_Run(const Campaign_CatalogueType* Catalogue, uint8_t NumWorkers,
+                            Campaign_ResultType* Results, uint32_t NumResults) {
+    const uint32_t numVariants = Campaign_GetNumVariants(Catalogue);
+    EcuM_ConfigType ecumConfig;
+    Campaign_SharedType* shared;
+    pid_t workers[CAMPAIGN_MAX_WORKERS];
+    size_t sharedSize;
+    void* memory;
+    Std_ReturnType result;
+    uint8_t started = 0U;
+    uint8_t i;
+
+    if ((Campaign_CheckCatalogue(Catalogue) != E_OK) || (Results == NULL_PTR) ||
+        (NumResults < numVariants) || (NumWorkers == 0U) ||
+        (NumWorkers > CAMPAIGN_MAX_WORKERS)) {
+        return E_NOT_OK;
+    }
+
+    /* Results are written by the workers, so they live in shared memory */
+    sharedSize = sizeof(Campaign_SharedType) + (numVariants * sizeof(Campaign_ResultType));
+    memory = mmap(NULL_PTR, sharedSize, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        return E_NOT_OK;
+    }
+    shared = new (memory) Campaign_SharedType;
+    shared->NextVariant.store(0U);
+
+    Campaign_ResetSim();
+    Rte_SimSetFlmHook(Campaign_FlmHook);
+    ecumConfig.MaxParallelInit = 1U;
+    result = EcuM_Init(&ecumConfig, ECUM_STARTUP_COLD);
+    if (result == E_OK) {
+        Lamp_Init();
+        result = Campaign_WarmUp(Catalogue);
+    }
+
+    if ((result == E_OK) && (NumWorkers == 1U)) {
+        Campaign_RunWorker(Catalogue, shared, numVariants);
+    } else if (result == E_OK) {
+        /* No threads: the forked workers inherit the warm starts */
+        for (i = 0U; i < NumWorkers; i++) {
+            workers[i] = fork();
+            if (workers[i] == 0) {
+                Campaign_RunWorker(Catalogue, shared, numVariants);
+                _exit(0);
+            }
+            if (workers[i] < 0) {
+                result = E_NOT_OK;
+                break;
+            }
+            started++;
+        }
+        for (i = 0U; i < started; i++) {
+            int status = 0;
+
+            if ((waitpid(workers[i], &status, 0) != workers[i]) ||
+                !WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+                result = E_NOT_OK;
+            }
+        }
+    }
+
+    if (result == E_OK) {
+        (void)std::memcpy(Results, shared + 1, numVariants * sizeof(Campaign_ResultType));
+    }
+
+    Lamp_DeInit();
+    EcuM_GoDown(ECUM_STARTUP_COLD);
+    Rte_SimSetFlmHook(NULL_PTR);
+    shared->~Campaign_SharedType();
+    (void)munmap(memory, sharedSize);
+
+    return result;
+}
+
+/**
+ * @brief Check the results of one fault model against its known finding
+ */
+Std_ReturnType Campaign_CheckFinding(const Campaign_ResultType* Results, uint32_t NumResults,
+                                     Campaign_FaultType Fault, const Campaign_FindingType* Finding) {
+    uint32_t late = 0U;
+    uint32_t notDetected = 0U;
+    uint32_t i;
+
+    if ((Results == NULL_PTR) || (Finding == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0U; i < NumResults; i++) {
+        const Campaign_ResultType* result = &Results[i];
+
+        if (result->Fault != Fault) {
+            continue;
+        }
+        if (result->Outcome == CAMPAIGN_OUTCOME_NOT_DETECTED) {
+            notDetected++;
+            continue;
+        }
+        if (result->Outcome == CAMPAIGN_OUTCOME_LATE) {
+            late++;
+        }
+        if (result->ResponseMs > Finding->MaxResponseMs) {
+            return E_NOT_OK;
+        }
+    }
+
+    return ((late <= Finding->MaxLate) && (notDetected <= Finding->MaxNotDetected)) ? E_OK :
+                                                                                     E_NOT_OK;
+}
+
+/**
+ * @brief Get the name of a fault model
+ */
+const char* Campaign_GetFaultName(Campaign_FaultType Fault) {
+    if (static_cast<uint32_t>(Fault) >= CAMPAIGN_NUM_FAULTS) {
+        return "unknown";
+    }
+
+    return Campaign_FaultNames[Fault];
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Check a catalogue against the campaign limits
+ */
+static Std_ReturnType Campaign_CheckCatalogue(const Campaign_CatalogueType* Catalogue) {
+    uint8_t i;
+
+    if ((Catalogue == NULL_PTR) || (Catalogue->Faults == NULL_PTR) ||
+        (Catalogue->DurationsMs == NULL_PTR) || (Catalogue->NumFaults == 0U) ||
+        (Catalogue->NumDurations == 0U) || (Catalogue->NumInjections == 0U) ||
+        (Catalogue->NumInjections > CAMPAIGN_MAX_INJECTIONS) ||
+        (Catalogue->InjectionStepMs == 0U)) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0U; i < Catalogue->NumFaults; i++) {
+        if (static_cast<uint32_t>(Catalogue->Faults[i]) >= CAMPAIGN_NUM_FAULTS) {
+            return E_NOT_OK;
+        }
+    }
+    for (i = 0U; i < Catalogue->NumDurations; i++) {
+        if (Catalogue->DurationsMs[i] == 0U) {
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Reset the simulation state left by earlier runs in this process
+ * @details The cold start resets the simulation state of the modules (e.g. the
+ *          WdgM status override of SafetyMonitor) and the warm starts carry it
+ *          into every variant. The hooks are not part of any snapshot.
+ */
+static void Campaign_ResetSim(void) {
+    Adc_SimSetTimeUs(0U);
+    Pwm_SimSetTimeUs(0U);
+    WdgM_SimSetTimeUs(0U);
+    Adc_SimSetSampleSource(NULL_PTR);
+    Adc_SimSetConversionHook(NULL_PTR);
+    Dio_SimSetInputHook(NULL_PTR);
+    Can_SimSetRxHook(NULL_PTR);
+    Headlight_SimSetFeedbackHook(NULL_PTR);
+    Rte_SimSetFlmHook(NULL_PTR);
+}
+
+/**
+ * @brief Fault-free run from cold start, saving a warm start per injection time
+ */
+static Std_ReturnType Campaign_WarmUp(const Campaign_CatalogueType* Catalogue) {
+    uint16_t injection;
+    uint32_t startMs;
+
+    Campaign_SenderConfig.DataLength = FLM_E2E_LIGHTSWITCH_DATA_LENGTH;
+    Campaign_SenderConfig.DataID = FLM_E2E_LIGHTSWITCH_DATA_ID;
+    Campaign_SenderConfig.CounterOffset = FLM_E2E_COUNTER_OFFSET;
+    Campaign_SenderConfig.CRCOffset = FLM_E2E_CRC_OFFSET;
+    (void)E2E_P01ProtectInit(&Campaign_Sender);
+    Campaign_TickMs = 0U;
+
+    while (Campaign_TickMs < CAMPAIGN_WARMUP_MS) {
+        Campaign_Tick(CAMPAIGN_FAULT_NONE);
+    }
+
+    startMs = Campaign_TickMs;
+    for (injection = 0U; injection < Catalogue->NumInjections; injection++) {
+        Campaign_WarmStartType* warmStart = &Campaign_WarmStarts[injection];
+        const uint32_t injectionMs = startMs + Catalogue->FirstInjectionMs +
+                                     (static_cast<uint32_t>(injection) * Catalogue->InjectionStepMs);
+
+        while (Campaign_TickMs < injectionMs) {
+            Campaign_Tick(CAMPAIGN_FAULT_NONE);
+        }
+
+        /* Faults must hit a healthy ECU */
+        if (SafetyMonitor_IsInSafeState() || (FLM_GetCurrentState() != FLM_STATE_NORMAL)) {
+            return E_NOT_OK;
+        }
+
+        (void)Ecu_SaveSnapshot(&warmStart->Ecu);
+        Lamp_SaveSnapshot(&warmStart->Lamp);
+        warmStart->Sender = Campaign_Sender;
+        warmStart->TickMs = Campaign_TickMs;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Claim and run variants until none are left
+ */
+static void Campaign_RunWorker(const Campaign_CatalogueType* Catalogue,
+                               Campaign_SharedType* Shared, uint32_t NumVariants) {
+    Campaign_ResultType* results = reinterpret_cast<Campaign_ResultType*>(Shared + 1);
+    uint32_t variant = Shared->NextVariant.fetch_add(1U);
+
+    while (variant < NumVariants) {
+        Campaign_RunVariant(Catalogue, variant, &results[variant]);
+        variant = Shared->NextVariant.fetch_add(1U);
+    }
+}
+
+/**
+ * @brief Run one variant from its warm start
+ */
+static void Campaign_RunVariant(const Campaign_CatalogueType* Catalogue, uint32_t Variant,
+                                Campaign_ResultType* Result) {
+    const uint32_t duration = Variant % Catalogue->NumDurations;
+    const uint32_t injection = (Variant / Catalogue->NumDurations) % Catalogue->NumInjections;
+    const uint32_t fault = Variant / (static_cast<uint32_t>(Catalogue->NumDurations) *
+                                      Catalogue->NumInjections);
+    const Campaign_WarmStartType* warmStart = &Campaign_WarmStarts[injection];
+    uint32_t startMs;
+    uint32_t endMs;
+
+    Result->Fault = Catalogue->Faults[fault];
+    Result->InjectionMs = Catalogue->FirstInjectionMs + (injection * Catalogue->InjectionStepMs);
+    Result->DurationMs = Catalogue->DurationsMs[duration];
+    Result->Outcome = CAMPAIGN_OUTCOME_NOT_DETECTED;
+    Result->ResponseMs = 0U;
+    Result->Reason = SAFE_STATE_REASON_NONE;
+
+    (void)Ecu_RestoreSnapshot(&warmStart->Ecu);
+    Lamp_RestoreSnapshot(&warmStart->Lamp);
+    Campaign_Sender = warmStart->Sender;
+    Campaign_TickMs = warmStart->TickMs;
+
+    startMs = Campaign_TickMs;
+    endMs = startMs + Result->DurationMs;
+    Campaign_StuckLevel = Campaign_GetNominalAmbient(startMs);
+    if (Result->Fault == CAMPAIGN_FAULT_LAMP_OPEN_LOAD) {
+        (void)Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_OPEN_LOAD);
+    }
+
+    while (Campaign_TickMs < (endMs + CAMPAIGN_OBSERVATION_MS)) {
+        const uint32_t tickMs = Campaign_TickMs;
+
+        if (tickMs == endMs) {
+            (void)Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_NONE);
+        }
+        Campaign_Tick((tickMs < endMs) ? static_cast<uint8_t>(Result->Fault) :
+                                         static_cast<uint8_t>(CAMPAIGN_FAULT_NONE));
+
+        if (SafetyMonitor_IsInSafeState()) {
+            Result->ResponseMs = tickMs - startMs;
+            Result->Reason = SafetyMonitor_GetSafeStateReason();
+            Result->Outcome = (Result->ResponseMs <= FLM_FTTI_MS) ? CAMPAIGN_OUTCOME_IN_FTTI :
+                                                                    CAMPAIGN_OUTCOME_LATE;
+            break;
+        }
+    }
+
+    (void)Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_NONE);
+}
+
+/**
+ * @brief One 1ms tick running the task bodies of the main scheduler
+ */
+static void Campaign_Tick(uint8_t Fault) {
+    const uint32_t tickMs = Campaign_TickMs;
+    const uint64_t timeUs = static_cast<uint64_t>(tickMs) * 1000U;
+    Adc_ValueGroupType ambient = Campaign_GetNominalAmbient(tickMs);
+
+    if (Fault == CAMPAIGN_FAULT_ADC_OPEN) {
+        ambient = static_cast<Adc_ValueGroupType>(CAMPAIGN_AMBIENT_OPEN_LEVEL);
+    } else if (Fault == CAMPAIGN_FAULT_ADC_SHORT) {
+        ambient = static_cast<Adc_ValueGroupType>(CAMPAIGN_AMBIENT_SHORT_LEVEL);
+    } else if (Fault == CAMPAIGN_FAULT_ADC_STUCK) {
+        ambient = Campaign_StuckLevel;
+    }
+
+    Adc_SimSetTimeUs(timeUs);
+    Pwm_SimSetTimeUs(timeUs);
+    WdgM_SimSetTimeUs(static_cast<uint32_t>(timeUs));
+    Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT, ambient);
+    Adc_MainFunction();
+
+    Campaign_TickFault = Fault;
+    if ((tickMs % FLM_SAFETY_MONITOR_PERIOD_MS) == 0U) {
+        Rte_Task_5ms();
+    }
+    if ((tickMs % FLM_MAIN_FUNCTION_PERIOD_MS) == 0U) {
+        Campaign_SendLightSwitch(Fault);
+        Rte_Task_10ms();
+    }
+    if ((tickMs % FLM_AMBIENT_LIGHT_PERIOD_MS) == 0U) {
+        Rte_Task_20ms();
+    }
+
+    Campaign_TickMs++;
+}
+
+/**
+ * @brief Receive the E2E-protected light switch (AUTO), faulted on the wire
+ */
+static void Campaign_SendLightSwitch(uint8_t Fault) {
+    uint8_t data[4] = {0};
+    PduInfoType pduInfo;
+
+    if (Fault == CAMPAIGN_FAULT_CAN_LOSS) {
+        return;
+    }
+
+    if (Fault == CAMPAIGN_FAULT_E2E_COUNTER_JUMP) {
+        Campaign_Sender.Counter = static_cast<uint8_t>(
+            (Campaign_Sender.Counter + CAMPAIGN_E2E_COUNTER_JUMP) % (E2E_P01_COUNTER_MAX + 1U));
+    }
+
+    data[COM_LIGHTSWITCH_CMD_BYTE] = static_cast<uint8_t>(LIGHT_SWITCH_AUTO);
+    (void)E2E_P01Protect(&Campaign_SenderConfig, &Campaign_Sender, data, 4U);
+    if (Fault == CAMPAIGN_FAULT_E2E_CRC) {
+        data[CAMPAIGN_E2E_CRC_BYTE] ^= CAMPAIGN_E2E_CRC_FLIP_MASK;
+    }
+
+    pduInfo.SduDataPtr = data;
+    pduInfo.MetaDataPtr = NULL_PTR;
+    pduInfo.SduLength = 4U;
+    Os_GetSpinlock(OS_SPINLOCK_COMSTACK);
+    Com_RxIndication(COM_IPDU_LIGHTSWITCH_RX, &pduInfo);
+    Os_ReleaseSpinlock(OS_SPINLOCK_COMSTACK);
+}
+
+/**
+ * @brief FLM runnable hook: the alive-supervision fault stalls the runnable
+ */
+static boolean Campaign_FlmHook(void) {
+    return (Campaign_TickFault != CAMPAIGN_FAULT_WDGM_ALIVE_MISS) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Nominal ambient level: triangle between the dark levels
+ */
+static Adc_ValueGroupType Campaign_GetNominalAmbient(uint32_t tickMs) {
+    const uint32_t half = CAMPAIGN_AMBIENT_PERIOD_MS / 2U;
+    const uint32_t phase = tickMs % CAMPAIGN_AMBIENT_PERIOD_MS;
+    const uint32_t ramp = (phase < half) ? phase : (CAMPAIGN_AMBIENT_PERIOD_MS - phase);
+
+    return static_cast<Adc_ValueGroupType>(
+        CAMPAIGN_AMBIENT_MIN_LEVEL +
+        (((CAMPAIGN_AMBIENT_MAX_LEVEL - CAMPAIGN_AMBIENT_MIN_LEVEL) * ramp) / half));
+}
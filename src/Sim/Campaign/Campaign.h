@@ -0,0 +1,161 @@
+/**
+ * @file Campaign.h
+ * @brief Fault-Injection Campaign Interface
+ * @details Runs the cross product of fault model x injection time x fault
+ *          duration against the closed-loop ECU (lamp model, E2E-protected
+ *          light switch) and measures the time from the injection to
+ *          SafetyMonitor_IsInSafeState() against FLM_FTTI_MS:
+ *          - One fault-free run from cold start saves a warm start
+ *            (Ecu_SnapshotType, lamp model, sender state) at every injection
+ *            time; each variant restores its warm start and only simulates
+ *            from the injection on
+ *          - Module state is process-global, so variants run in forked
+ *            worker processes that pull variant indices from shared memory
+ *          - Results do not depend on the number of workers
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef CAMPAIGN_H
+#define CAMPAIGN_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "ComStack_Types.h"
+#include "Campaign_Cfg.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define CAMPAIGN_SW_MAJOR_VERSION           1
+#define CAMPAIGN_SW_MINOR_VERSION           0
+#define CAMPAIGN_SW_PATCH_VERSION           0
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Fault model
+ */
+typedef enum {
+    CAMPAIGN_FAULT_E2E_CRC          = 0x00U,    /**< Light switch CRC corrupted */
+    CAMPAIGN_FAULT_E2E_COUNTER_JUMP = 0x01U,    /**< Light switch counter jumps */
+    CAMPAIGN_FAULT_CAN_LOSS         = 0x02U,    /**< Light switch frames lost */
+    CAMPAIGN_FAULT_ADC_OPEN         = 0x03U,    /**< Ambient sensor open circuit */
+    CAMPAIGN_FAULT_ADC_SHORT        = 0x04U,    /**< Ambient sensor short to supply */
+    CAMPAIGN_FAULT_ADC_STUCK        = 0x05U,    /**< Ambient sensor frozen */
+    CAMPAIGN_FAULT_LAMP_OPEN_LOAD   = 0x06U,    /**< Low beam open load */
+    CAMPAIGN_FAULT_WDGM_ALIVE_MISS  = 0x07U     /**< FLM runnable not executed */
+} Campaign_FaultType;
+
+/** @brief Number of fault models */
+#define CAMPAIGN_NUM_FAULTS                 8U
+
+/**
+ * @brief Variant outcome
+ */
+typedef enum {
+    CAMPAIGN_OUTCOME_IN_FTTI        = 0x00U,    /**< Safe state within FLM_FTTI_MS */
+    CAMPAIGN_OUTCOME_LATE           = 0x01U,    /**< Safe state after FLM_FTTI_MS */
+    CAMPAIGN_OUTCOME_NOT_DETECTED   = 0x02U     /**< No safe state in the observation */
+} Campaign_OutcomeType;
+
+/**
+ * @brief Fault catalogue
+ * @details Variant index = (fault * NumInjections + injection) * NumDurations
+ *          + duration
+ */
+typedef struct {
+    const Campaign_FaultType* Faults;   /**< Fault models */
+    uint8_t NumFaults;                  /**< Number of fault models */
+    uint32_t FirstInjectionMs;          /**< First injection after the warm start */
+    uint32_t InjectionStepMs;           /**< Injection time step (> 0) */
+    uint16_t NumInjections;             /**< Injection times (<= CAMPAIGN_MAX_INJECTIONS) */
+    const uint32_t* DurationsMs;        /**< Fault durations (> 0) */
+    uint8_t NumDurations;               /**< Number of fault durations */
+} Campaign_CatalogueType;
+
+/**
+ * @brief Variant result
+ */
+typedef struct {
+    Campaign_FaultType Fault;           /**< Injected fault model */
+    uint32_t InjectionMs;               /**< Injection after the warm start */
+    uint32_t DurationMs;                /**< Fault duration */
+    Campaign_OutcomeType Outcome;       /**< Classification against FLM_FTTI_MS */
+    uint32_t ResponseMs;                /**< Injection to safe state (detected only) */
+    SafeStateReason Reason;             /**< Safe state reason (detected only) */
+} Campaign_ResultType;
+
+/**
+ * @brief Accepted outcome of one fault model (known findings)
+ * @details Bounds the variants of a catalogue that miss the FTTI or never
+ *          reach the safe state, so known gaps do not hide new ones
+ */
+typedef struct {
+    uint32_t MaxLate;                   /**< Accepted late variants */
+    uint32_t MaxNotDetected;            /**< Accepted variants without safe state */
+    uint32_t MaxResponseMs;             /**< Accepted slowest reaction */
+} Campaign_FindingType;
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Full catalogue of the flm_fault_campaign runner */
+extern const Campaign_CatalogueType Campaign_DefaultCatalogue;
+
+/** @brief Known findings of the default catalogue, indexed by Campaign_FaultType */
+extern const Campaign_FindingType Campaign_DefaultFindings[CAMPAIGN_NUM_FAULTS];
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Get the number of variants of a catalogue
+ * @param[in] Catalogue Fault catalogue
+ * @return Faults x injection times x durations (0 for NULL_PTR)
+ */
+uint32_t Campaign_GetNumVariants(const Campaign_CatalogueType* Catalogue);
+
+/**
+ * @brief Run a campaign
+ * @details Starts the ECU (EcuM_Init), runs all variants and shuts it down
+ *          again; call with the ECU down. With one worker the variants run in
+ *          the calling process, otherwise in forked processes.
+ * @param[in] Catalogue Fault catalogue
+ * @param[in] NumWorkers Worker processes (1..CAMPAIGN_MAX_WORKERS)
+ * @param[out] Results One result per variant, in variant index order
+ * @param[in] NumResults Size of Results (>= Campaign_GetNumVariants)
+ * @return E_OK on success, E_NOT_OK for an invalid catalogue, a failed
+ *         warm-up or a failed worker
+ */
+Std_ReturnType Campaign_Run(const Campaign_CatalogueType* Catalogue, uint8_t NumWorkers,
+                            Campaign_ResultType* Results, uint32_t NumResults);
+
+/**
+ * @brief Check the results of one fault model against its known finding
+ * @param[in] Results Results of Campaign_Run
+ * @param[in] NumResults Number of results
+ * @param[in] Fault Fault model
+ * @param[in] Finding Accepted outcome of the fault model
+ * @return E_OK if the late variants, the variants without safe state and the
+ *         slowest reaction stay within the finding, E_NOT_OK otherwise
+ */
+Std_ReturnType Campaign_CheckFinding(const Campaign_ResultType* Results, uint32_t NumResults,
+                                     Campaign_FaultType Fault, const Campaign_FindingType* Finding);
+
+/**
+ * @brief Get the name of a fault model
+ * @param[in] Fault Fault model
+ * @return Short name, "unknown" for invalid fault models
+ */
+const char* Campaign_GetFaultName(Campaign_FaultType Fault);
+
+#endif /* CAMPAIGN_H */
@@ -0,0 +1,310 @@
+/**
+ * @file Lamp.cpp
+ * @brief Headlamp Plant Model Implementation
+ * @details Each lamp runs in segments of constant duty cycle between two
+ *          PWM updates. Within a segment the filament temperature T follows
+ *              T(t) = Ts + (T0 - Ts) * exp(-t / tau)
+ *          with Ts the steady state of the duty cycle d from the power
+ *          balance d / r(Ts) = Ts, r(T) = r0 + (1 - r0) * T being the
+ *          filament resistance relative to the hot resistance. Samples at a
+ *          fixed period share one decay factor, the current of a sample is
+ *          Inom / r(T) during the high phase of the PWM and 0 otherwise.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Lamp.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Pwm/Pwm.h"
+#include <cmath>
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Lamps */
+static Lamp_StateType Lamp_State[LAMP_NUM_LAMPS];
+
+/** @brief Summed lamp current of the block being generated (mA) */
+static float Lamp_Block[LAMP_BLOCK_SAMPLES];
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static void Lamp_Generate(uint8_t Lamp, uint64_t firstUs, uint32_t periodUs, uint16_t n);
+static void Lamp_GenerateRun(uint8_t Lamp, uint64_t firstUs, uint32_t periodUs,
+                             uint16_t n, float* out);
+static void Lamp_Advance(uint8_t Lamp, uint64_t timeUs);
+static uint16_t Lamp_GetDutyCycle(uint8_t Lamp);
+static float Lamp_GetSteadyTemperature(uint8_t Lamp, uint16_t DutyCycle);
+static float Lamp_GetTimeConstant(uint8_t Lamp, float steady);
+static void Lamp_AdcSampleSource(Adc_ChannelType Channel, uint64_t firstUs,
+                                 uint32_t periodUs, uint16_t numSamples,
+                                 Adc_ValueGroupType* samples);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize the lamp model
+ */
+void Lamp_Init(void) {
+    Pwm_SimChannelType pwm;
+    uint8_t i;
+
+    (void)std::memset(Lamp_State, 0, sizeof(Lamp_State));
+    for (i = 0U; i < LAMP_NUM_LAMPS; i++) {
+        if (Pwm_SimGetChannel(Lamp_Config[i].PwmChannel, &pwm) == E_OK) {
+            Lamp_State[i].DutyCycle = pwm.DutyCycle;
+            Lamp_State[i].StartUs = pwm.StartUs;
+            Lamp_State[i].PeriodUs = pwm.PeriodUs;
+            Lamp_State[i].PhaseUs = pwm.PhaseUs;
+            Lamp_State[i].Updates = pwm.Updates;
+            Lamp_State[i].TimeUs = pwm.StartUs;
+        }
+        Lamp_State[i].Fault = LAMP_FAULT_NONE;
+    }
+
+    Adc_SimSetChannelSource(LAMP_ADC_CHANNEL, Lamp_AdcSampleSource);
+}
+
+/**
+ * @brief De-initialize the lamp model
+ */
+void Lamp_DeInit(void) {
+    Adc_SimSetChannelSource(LAMP_ADC_CHANNEL, NULL_PTR);
+    (void)std::memset(Lamp_State, 0, sizeof(Lamp_State));
+}
+
+/**
+ * @brief Inject or clear a lamp fault
+ */
+Std_ReturnType Lamp_SetFault(uint8_t Lamp, Lamp_FaultType Fault) {
+    if (Lamp >= LAMP_NUM_LAMPS) {
+        return E_NOT_OK;
+    }
+
+    Lamp_State[Lamp].Fault = Fault;
+    return E_OK;
+}
+
+/**
+ * @brief Save the lamp states
+ */
+void Lamp_SaveSnapshot(Lamp_SnapshotType* Snapshot) {
+    (void)std::memcpy(Snapshot->Lamps, Lamp_State, sizeof(Lamp_State));
+}
+
+/**
+ * @brief Restore the lamp states
+ */
+void Lamp_RestoreSnapshot(const Lamp_SnapshotType* Snapshot) {
+    (void)std::memcpy(Lamp_State, Snapshot->Lamps, sizeof(Lamp_State));
+}
+
+/**
+ * @brief Get filament temperature
+ */
+float Lamp_GetTemperature(uint8_t Lamp) {
+    if (Lamp >= LAMP_NUM_LAMPS) {
+        return 0.0f;
+    }
+
+    return Lamp_State[Lamp].Temperature;
+}
+
+/**
+ * @brief Generate current sense samples
+ */
+void Lamp_GenerateBlock(uint64_t firstUs, uint32_t periodUs,
+                        uint16_t numSamples, uint16_t* samples) {
+    uint16_t done;
+    uint16_t chunk;
+    uint16_t j;
+    uint8_t i;
+    float counts;
+
+    if (samples == NULL_PTR) {
+        return;
+    }
+
+    for (done = 0U; done < numSamples; done = static_cast<uint16_t>(done + chunk)) {
+        chunk = static_cast<uint16_t>(numSamples - done);
+        if (chunk > LAMP_BLOCK_SAMPLES) {
+            chunk = LAMP_BLOCK_SAMPLES;
+        }
+
+        (void)std::memset(Lamp_Block, 0, sizeof(Lamp_Block));
+        for (i = 0U; i < LAMP_NUM_LAMPS; i++) {
+            Lamp_Generate(i, firstUs + (static_cast<uint64_t>(done) * periodUs), periodUs, chunk);
+        }
+
+        /* Current sense: mA to ADC counts */
+        for (j = 0U; j < chunk; j++) {
+            counts = (Lamp_Block[j] / static_cast<float>(LAMP_SENSE_MA_PER_COUNT)) + 0.5f;
+            samples[done + j] = (counts < static_cast<float>(ADC_MAX_VALUE)) ?
+                                static_cast<uint16_t>(counts) : static_cast<uint16_t>(ADC_MAX_VALUE);
+        }
+    }
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Add the current of one lamp to Lamp_Block
+ * @details Samples before a pending PWM update see the previous segment
+ */
+static void Lamp_Generate(uint8_t Lamp, uint64_t firstUs, uint32_t periodUs, uint16_t n) {
+    Lamp_StateType* state = &Lamp_State[Lamp];
+    Pwm_SimChannelType pwm;
+    uint64_t numBefore = 0U;
+
+    if ((Pwm_SimGetChannel(Lamp_Config[Lamp].PwmChannel, &pwm) == E_OK) &&
+        (pwm.Updates != state->Updates)) {
+        if (pwm.StartUs > firstUs) {
+            numBefore = (periodUs == 0U) ? n :
+                        (((pwm.StartUs - firstUs) + periodUs - 1U) / periodUs);
+            if (numBefore > n) {
+                numBefore = n;
+            }
+        }
+
+        Lamp_GenerateRun(Lamp, firstUs, periodUs, static_cast<uint16_t>(numBefore), Lamp_Block);
+        Lamp_Advance(Lamp, pwm.StartUs);
+
+        state->DutyCycle = pwm.DutyCycle;
+        state->StartUs = pwm.StartUs;
+        state->PeriodUs = pwm.PeriodUs;
+        state->PhaseUs = pwm.PhaseUs;
+        state->Updates = pwm.Updates;
+    }
+
+    Lamp_GenerateRun(Lamp, firstUs + (numBefore * periodUs), periodUs,
+                     static_cast<uint16_t>(n - numBefore), &Lamp_Block[numBefore]);
+}
+
+/**
+ * @brief Add the current of one lamp within its running segment
+ * @param[in] Lamp Lamp ID
+ * @param[in] firstUs Time of the first sample (not before the segment start)
+ * @param[in] periodUs Time between samples
+ * @param[in] n Number of samples
+ * @param[in,out] out Summed current per sample (mA)
+ */
+static void Lamp_GenerateRun(uint8_t Lamp, uint64_t firstUs, uint32_t periodUs,
+                             uint16_t n, float* out) {
+    const Lamp_ConfigType* config = &Lamp_Config[Lamp];
+    Lamp_StateType* state = &Lamp_State[Lamp];
+    const uint16_t duty = Lamp_GetDutyCycle(Lamp);
+    const float steady = Lamp_GetSteadyTemperature(Lamp, duty);
+    const float coldRatio = config->ColdResistanceRatio;
+    const uint64_t onLimit = static_cast<uint64_t>(duty) * state->PeriodUs;
+    uint64_t phase;
+    float decay;
+    float temperature;
+    uint16_t j;
+
+    if ((n == 0U) || (state->PeriodUs == 0U)) {
+        return;
+    }
+
+    Lamp_Advance(Lamp, firstUs);
+    temperature = state->Temperature;
+    decay = std::exp(-static_cast<float>(periodUs) / Lamp_GetTimeConstant(Lamp, steady));
+    phase = (firstUs > state->StartUs) ? ((firstUs - state->StartUs) % state->PeriodUs) : 0U;
+    phase = (phase + state->PeriodUs - state->PhaseUs) % state->PeriodUs;
+
+    for (j = 0U; j < n; j++) {
+        /* High phase of the PWM: duty / 0x8000 of the period from the on phase offset */
+        if ((phase * PWM_DUTY_100_PERCENT) < onLimit) {
+            if (state->Fault == LAMP_FAULT_SHORT) {
+                out[j] += LAMP_SHORT_CIRCUIT_CURRENT_MA;
+            } else if (state->Fault == LAMP_FAULT_NONE) {
+                out[j] += config->NominalCurrentMa /
+                          (coldRatio + ((1.0f - coldRatio) * temperature));
+            } else {
+                /* Open load: no current */
+            }
+        }
+
+        temperature = steady + ((temperature - steady) * decay);
+        phase = (phase + periodUs) % state->PeriodUs;
+    }
+
+    state->Temperature = temperature;
+    state->TimeUs = firstUs + (static_cast<uint64_t>(n) * periodUs);
+}
+
+/**
+ * @brief Advance the filament temperature within the running segment
+ * @param[in] Lamp Lamp ID
+ * @param[in] timeUs Target time (earlier times leave the state unchanged)
+ */
+static void Lamp_Advance(uint8_t Lamp, uint64_t timeUs) {
+    Lamp_StateType* state = &Lamp_State[Lamp];
+    float steady;
+
+    if (timeUs <= state->TimeUs) {
+        return;
+    }
+
+    steady = Lamp_GetSteadyTemperature(Lamp, Lamp_GetDutyCycle(Lamp));
+    state->Temperature = steady + ((state->Temperature - steady) *
+                         std::exp(-static_cast<float>(timeUs - state->TimeUs) /
+                                  Lamp_GetTimeConstant(Lamp, steady)));
+    state->TimeUs = timeUs;
+}
+
+/**
+ * @brief Get duty cycle applied to the filament
+ * @return Running PWM duty cycle with closed relay, 0 otherwise
+ */
+static uint16_t Lamp_GetDutyCycle(uint8_t Lamp) {
+    if (Dio_ReadChannel(Lamp_Config[Lamp].RelayChannel) != STD_HIGH) {
+        return PWM_DUTY_0_PERCENT;
+    }
+
+    return Lamp_State[Lamp].DutyCycle;
+}
+
+/**
+ * @brief Get steady state temperature of a duty cycle
+ * @details Root of (1 - r0) * T^2 + r0 * T - d = 0 (heating power d / r(T)
+ *          balanced by losses proportional to T)
+ */
+static float Lamp_GetSteadyTemperature(uint8_t Lamp, uint16_t DutyCycle) {
+    const float coldRatio = Lamp_Config[Lamp].ColdResistanceRatio;
+    const float d = static_cast<float>(DutyCycle) / static_cast<float>(PWM_DUTY_100_PERCENT);
+
+    return (std::sqrt((coldRatio * coldRatio) + (4.0f * (1.0f - coldRatio) * d)) - coldRatio) /
+           (2.0f * (1.0f - coldRatio));
+}
+
+/**
+ * @brief Get thermal time constant towards a steady state
+ */
+static float Lamp_GetTimeConstant(uint8_t Lamp, float steady) {
+    return static_cast<float>((steady > Lamp_State[Lamp].Temperature) ?
+                              Lamp_Config[Lamp].HeatTimeUs : Lamp_Config[Lamp].CoolTimeUs);
+}
+
+/**
+ * @brief ADC sample source of the current sense channel
+ */
+static void Lamp_AdcSampleSource(Adc_ChannelType Channel, uint64_t firstUs,
+                                 uint32_t periodUs, uint16_t numSamples,
+                                 Adc_ValueGroupType* samples) {
+    STD_UNUSED(Channel);
+    Lamp_GenerateBlock(firstUs, periodUs, numSamples, samples);
+}
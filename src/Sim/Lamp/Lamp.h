@@ -0,0 +1,157 @@
+/**
+ * @file Lamp.h
+ * @brief Headlamp Plant Model Interface
+ * @details Electrical and thermal model of the headlamps driven by the PWM
+ *          output stages, feeding the current sense ADC channel:
+ *          - Filament temperature follows a first-order response towards
+ *            the steady state of the applied duty cycle, with separate
+ *            heating and cooling time constants
+ *          - Filament resistance rises with temperature, so a cold lamp
+ *            draws an inrush current of several times its nominal current
+ *          - Instantaneous current follows the PWM waveform; lamps of both
+ *            beams add up on the shared current sense
+ *          - Open load and short circuit faults per lamp
+ *          The temperature is updated in closed form per PWM segment (one
+ *          exponential per segment, one multiply per sample), so samples at
+ *          the ADC stream rate cost no stepping between them.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef LAMP_H
+#define LAMP_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Lamp_Cfg.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define LAMP_SW_MAJOR_VERSION               1
+#define LAMP_SW_MINOR_VERSION               0
+#define LAMP_SW_PATCH_VERSION               0
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Lamp fault
+ */
+typedef enum {
+    LAMP_FAULT_NONE         = 0x00U,    /**< Intact lamp */
+    LAMP_FAULT_OPEN_LOAD    = 0x01U,    /**< Broken filament or connector */
+    LAMP_FAULT_SHORT        = 0x02U     /**< Output shorted to ground */
+} Lamp_FaultType;
+
+/**
+ * @brief Lamp state
+ */
+typedef struct {
+    float Temperature;                  /**< Filament temperature at TimeUs */
+    uint64_t TimeUs;                    /**< Time of Temperature */
+    uint16_t DutyCycle;                 /**< Duty cycle of the running segment */
+    uint64_t StartUs;                   /**< PWM period start of the running segment */
+    uint32_t PeriodUs;                  /**< PWM period of the running segment */
+    uint32_t PhaseUs;                   /**< PWM on phase offset of the running segment */
+    uint32_t Updates;                   /**< PWM updates applied */
+    Lamp_FaultType Fault;               /**< Injected fault */
+} Lamp_StateType;
+
+/**
+ * @brief Lamp model snapshot
+ * @details The plant is not part of Ecu_SnapshotType; save it alongside to
+ *          fork closed-loop runs
+ */
+typedef struct {
+    Lamp_StateType Lamps[LAMP_NUM_LAMPS];
+} Lamp_SnapshotType;
+
+/**
+ * @brief Lamp configuration
+ */
+typedef struct {
+    uint8_t PwmChannel;                 /**< PWM output stage (Pwm_ChannelType) */
+    uint8_t RelayChannel;               /**< Beam relay (Dio_ChannelType) */
+    float NominalCurrentMa;             /**< Hot filament current at full duty */
+    float ColdResistanceRatio;          /**< Cold / hot filament resistance */
+    uint32_t HeatTimeUs;                /**< Thermal time constant, heating */
+    uint32_t CoolTimeUs;                /**< Thermal time constant, cooling */
+} Lamp_ConfigType;
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Lamps, indexed by lamp ID */
+extern const Lamp_ConfigType Lamp_Config[LAMP_NUM_LAMPS];
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize the lamp model
+ * @details Intact lamps, cold at the last PWM update; becomes the sample
+ *          source of LAMP_ADC_CHANNEL. Call after Adc_Init and Pwm_Init.
+ */
+void Lamp_Init(void);
+
+/**
+ * @brief De-initialize the lamp model
+ * @details Returns LAMP_ADC_CHANNEL to the other ADC sample sources
+ */
+void Lamp_DeInit(void);
+
+/**
+ * @brief Inject or clear a lamp fault
+ * @details Applies from the next generated sample on
+ * @param[in] Lamp Lamp ID
+ * @param[in] Fault Fault of the lamp
+ * @return E_OK on success, E_NOT_OK for invalid lamps
+ */
+Std_ReturnType Lamp_SetFault(uint8_t Lamp, Lamp_FaultType Fault);
+
+/**
+ * @brief Save the lamp states
+ * @details Thermal state, running PWM segments and injected faults
+ * @param[out] Snapshot Lamp states
+ */
+void Lamp_SaveSnapshot(Lamp_SnapshotType* Snapshot);
+
+/**
+ * @brief Restore the lamp states
+ * @details The ADC sample source installed by Lamp_Init stays in place
+ * @param[in] Snapshot Lamp states saved by Lamp_SaveSnapshot
+ */
+void Lamp_RestoreSnapshot(const Lamp_SnapshotType* Snapshot);
+
+/**
+ * @brief Get filament temperature
+ * @param[in] Lamp Lamp ID
+ * @return Temperature after the last generated sample (0 = ambient,
+ *         1 = steady state at full duty)
+ */
+float Lamp_GetTemperature(uint8_t Lamp);
+
+/**
+ * @brief Generate current sense samples
+ * @details Sample i is the summed lamp current at firstUs + i * periodUs in
+ *          ADC counts, clamped to the ADC range. Calls must advance in time;
+ *          duty cycle updates are picked up from the PWM driver at their
+ *          update time, of several updates between two calls only the last
+ *          one is seen.
+ * @param[in] firstUs Time of the first sample
+ * @param[in] periodUs Time between samples
+ * @param[in] numSamples Number of samples
+ * @param[out] samples Generated samples
+ */
+void Lamp_GenerateBlock(uint64_t firstUs, uint32_t periodUs,
+                        uint16_t numSamples, uint16_t* samples);
+
+#endif /* LAMP_H */
@@ -0,0 +1,879 @@
+/**
+ * @file Replay.cpp
+ * @brief Deterministic Record/Replay Implementation
+ * @details The recorder writes through the hooks of the MCAL modules, the
+ *          replayer loads the whole log at start and walks it with
+ *          independent cursors: one for the discrete inputs, one for the
+ *          outputs and one per ADC channel, so conversions of different
+ *          tasks are served in their own order.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Replay.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Can/Can.h"
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Pwm/Pwm.h"
+#include "BSW/Com/Com.h"
+#include "Application/Headlight/Headlight.h"
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+/*============================================================================*
+ * LOCAL CONSTANTS
+ *============================================================================*/
+
+/** @brief Log header: magic and format version */
+#define REPLAY_MAGIC_SIZE                   4U
+#define REPLAY_HEADER_SIZE                  (REPLAY_MAGIC_SIZE + 1U)
+
+/** @brief Event types */
+#define REPLAY_EVENT_CAN_RX                 0x01U   /**< Can_SimReceiveMessage */
+#define REPLAY_EVENT_COM_RX                 0x02U   /**< Com_RxIndication */
+#define REPLAY_EVENT_DIO_INPUT              0x03U   /**< Dio_SimSetInput */
+#define REPLAY_EVENT_FEEDBACK_CURRENT       0x04U   /**< Headlight_SimSetFeedbackCurrent */
+#define REPLAY_EVENT_OUTPUTS                0x06U   /**< Output snapshot */
+#define REPLAY_EVENT_END                    0x07U   /**< End of the recording */
+#define REPLAY_EVENT_ADC_BLOCK              0x10U   /**< Converted ADC samples, + channel */
+#define REPLAY_EVENT_ADC_MASK               0xF0U
+
+/** @brief Bytes of a COM SDU kept in the log */
+#define REPLAY_MAX_SDU_BYTES                64U
+
+/** @brief Output snapshot: DIO ports, PWM duties, CAN TX count and last frame */
+#define REPLAY_OUTPUTS_SIZE                 (DIO_NUM_PORTS + (PWM_NUM_CHANNELS * 2U) + 4U + 4U + 1U + \
+                                             CAN_MAX_DATA_LENGTH)
+
+/** @brief Varint of up to 64 bits */
+#define REPLAY_MAX_VARINT                   10U
+
+static const uint8_t Replay_Magic[REPLAY_MAGIC_SIZE] = { 'F', 'L', 'M', 'R' };
+
+/*============================================================================*
+ * LOCAL TYPES
+ *============================================================================*/
+
+/**
+ * @brief Position in the loaded log
+ */
+typedef struct {
+    size_t Pos;                         /**< Offset of the next event */
+    uint64_t TimeUs;                    /**< Time of the previous event */
+} Replay_CursorType;
+
+/**
+ * @brief Sample stream of one ADC channel
+ * @details Blocks continue the delta chain of the previous block of their
+ *          channel
+ */
+typedef struct {
+    Replay_CursorType Cursor;           /**< Next block (replay) */
+    Adc_ValueGroupType Last;            /**< Last sample */
+    uint64_t NextUs;                    /**< Time of the sample after the last block */
+    uint32_t PeriodUs;                  /**< Period of the last block */
+} Replay_AdcStreamType;
+
+/**
+ * @brief Decoded event
+ */
+typedef struct {
+    uint64_t TimeUs;                    /**< Virtual time */
+    uint8_t Type;                       /**< REPLAY_EVENT_* */
+    const uint8_t* Payload;             /**< Payload in the loaded log */
+    size_t Length;                      /**< Payload length */
+} Replay_EventType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Hooks and sample source run on the task threads */
+static std::mutex Replay_Mutex;
+
+/** @brief Current mode */
+static Replay_ModeType Replay_Mode = REPLAY_MODE_OFF;
+
+/** @brief Statistics */
+static Replay_StatsType Replay_Stats;
+
+/** @brief Virtual time of the current tick */
+static uint64_t Replay_TimeUs = 0U;
+
+/** @brief Record: log file and time of the last event */
+static FILE* Replay_File = NULL_PTR;
+static uint64_t Replay_LastEventUs = 0U;
+
+/** @brief Outputs of the previous tick (record) / of the recording (replay) */
+static uint8_t Replay_Outputs[REPLAY_OUTPUTS_SIZE];
+static boolean Replay_OutputsValid = FALSE;
+
+/** @brief ADC sample streams, recorded or replayed */
+static Replay_AdcStreamType Replay_AdcStreams[ADC_NUM_CHANNELS];
+
+/** @brief Replay: decoded samples of a block */
+static Adc_ValueGroupType Replay_AdcSamples[ADC_MAX_STREAM_SAMPLES];
+
+/** @brief Replay: loaded log and cursors */
+static std::vector<uint8_t> Replay_Log;
+static Replay_CursorType Replay_InputCursor;
+static Replay_CursorType Replay_OutputCursor;
+
+/** @brief Replay: last tick compared */
+static boolean Replay_TickDone = FALSE;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static size_t Replay_PutVarint(uint8_t* buffer, uint64_t value);
+static boolean Replay_GetVarint(const uint8_t* data, size_t length, size_t* pos, uint64_t* value);
+static uint64_t Replay_Zigzag(int64_t value);
+static int64_t Replay_Unzigzag(uint64_t value);
+static void Replay_Write(uint8_t type, const uint8_t* payload, size_t length);
+static boolean Replay_Next(Replay_CursorType* cursor, Replay_EventType* event);
+static void Replay_CaptureOutputs(uint8_t* outputs);
+static void Replay_Mismatch(void);
+static void Replay_ApplyInput(const Replay_EventType* event);
+static void Replay_ResetAdcStreams(void);
+static boolean Replay_DecodeAdc(const Replay_EventType* event, Replay_AdcStreamType* stream,
+                                uint64_t* firstUs, uint32_t* periodUs, uint16_t* numSamples);
+
+static void Replay_CanRxHook(uint8_t Controller, Can_IdType CanId, uint8_t Dlc,
+                             const uint8_t* Data);
+static void Replay_ComRxHook(PduIdType PduId, const PduInfoType* PduInfoPtr);
+static void Replay_DioInputHook(Dio_ChannelType ChannelId, Dio_LevelType Level);
+static void Replay_FeedbackHook(uint16_t current);
+static void Replay_AdcHook(Adc_ChannelType Channel, uint64_t firstUs, uint32_t periodUs,
+                           uint16_t numSamples, const Adc_ValueGroupType* samples);
+static void Replay_AdcSource(Adc_ChannelType Channel, uint64_t firstUs, uint32_t periodUs,
+                             uint16_t numSamples, Adc_ValueGroupType* samples);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Start recording
+ */
+Std_ReturnType Replay_StartRecord(const char* Path) {
+    uint8_t header[REPLAY_HEADER_SIZE];
+
+    if ((Replay_Mode != REPLAY_MODE_OFF) || (Path == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    Replay_File = std::fopen(Path, "wb");
+    if (Replay_File == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    (void)std::memcpy(header, Replay_Magic, REPLAY_MAGIC_SIZE);
+    header[REPLAY_MAGIC_SIZE] = REPLAY_LOG_VERSION;
+    (void)std::fwrite(header, 1U, REPLAY_HEADER_SIZE, Replay_File);
+
+    (void)std::memset(&Replay_Stats, 0, sizeof(Replay_Stats));
+    Replay_Stats.Mode = REPLAY_MODE_RECORD;
+    Replay_Stats.LogBytes = REPLAY_HEADER_SIZE;
+    Replay_TimeUs = 0U;
+    Replay_LastEventUs = 0U;
+    Replay_OutputsValid = FALSE;
+    Replay_ResetAdcStreams();
+    Replay_Mode = REPLAY_MODE_RECORD;
+
+    Can_SimSetRxHook(Replay_CanRxHook);
+    Com_SetRxIndicationHook(Replay_ComRxHook);
+    Dio_SimSetInputHook(Replay_DioInputHook);
+    Headlight_SimSetFeedbackHook(Replay_FeedbackHook);
+    Adc_SimSetConversionHook(Replay_AdcHook);
+
+    return E_OK;
+}
+
+/**
+ * @brief Start replaying
+ */
+Std_ReturnType Replay_StartReplay(const char* Path) {
+    FILE* file;
+    long size;
+    Replay_CursorType cursor;
+    Replay_EventType event;
+
+    if ((Replay_Mode != REPLAY_MODE_OFF) || (Path == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    file = std::fopen(Path, "rb");
+    if (file == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    (void)std::fseek(file, 0, SEEK_END);
+    size = std::ftell(file);
+    (void)std::fseek(file, 0, SEEK_SET);
+    if (size < static_cast<long>(REPLAY_HEADER_SIZE)) {
+        (void)std::fclose(file);
+        return E_NOT_OK;
+    }
+
+    Replay_Log.resize(static_cast<size_t>(size));
+    if (std::fread(Replay_Log.data(), 1U, Replay_Log.size(), file) != Replay_Log.size()) {
+        (void)std::fclose(file);
+        Replay_Log.clear();
+        return E_NOT_OK;
+    }
+    (void)std::fclose(file);
+
+    if ((std::memcmp(Replay_Log.data(), Replay_Magic, REPLAY_MAGIC_SIZE) != 0) ||
+        (Replay_Log[REPLAY_MAGIC_SIZE] != REPLAY_LOG_VERSION)) {
+        Replay_Log.clear();
+        return E_NOT_OK;
+    }
+
+    /* Validate the framing once, the cursors rely on it */
+    (void)std::memset(&Replay_Stats, 0, sizeof(Replay_Stats));
+    cursor.Pos = REPLAY_HEADER_SIZE;
+    cursor.TimeUs = 0U;
+    while (cursor.Pos < Replay_Log.size()) {
+        if (!Replay_Next(&cursor, &event)) {
+            Replay_Log.clear();
+            return E_NOT_OK;
+        }
+        Replay_Stats.DurationUs = event.TimeUs;
+    }
+
+    Replay_Stats.Mode = REPLAY_MODE_REPLAY;
+    Replay_Stats.LogBytes = static_cast<uint32_t>(Replay_Log.size());
+    Replay_InputCursor.Pos = REPLAY_HEADER_SIZE;
+    Replay_InputCursor.TimeUs = 0U;
+    Replay_OutputCursor = Replay_InputCursor;
+    Replay_ResetAdcStreams();
+    Replay_TimeUs = 0U;
+    Replay_OutputsValid = FALSE;
+    Replay_TickDone = FALSE;
+    Replay_Mode = REPLAY_MODE_REPLAY;
+
+    Adc_SimSetSampleSource(Replay_AdcSource);
+
+    return E_OK;
+}
+
+/**
+ * @brief Stop recording or replaying
+ */
+void Replay_Stop(void) {
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    if (Replay_Mode == REPLAY_MODE_RECORD) {
+        Can_SimSetRxHook(NULL_PTR);
+        Com_SetRxIndicationHook(NULL_PTR);
+        Dio_SimSetInputHook(NULL_PTR);
+        Headlight_SimSetFeedbackHook(NULL_PTR);
+        Adc_SimSetConversionHook(NULL_PTR);
+
+        Replay_Write(REPLAY_EVENT_END, NULL_PTR, 0U);
+        Replay_Stats.DurationUs = Replay_TimeUs;
+        (void)std::fclose(Replay_File);
+        Replay_File = NULL_PTR;
+    } else if (Replay_Mode == REPLAY_MODE_REPLAY) {
+        Adc_SimSetSampleSource(NULL_PTR);
+        Replay_Log.clear();
+        Replay_Log.shrink_to_fit();
+    } else {
+        /* Nothing active */
+    }
+
+    Replay_Mode = REPLAY_MODE_OFF;
+    Replay_Stats.Mode = REPLAY_MODE_OFF;
+}
+
+/**
+ * @brief Start of a tick
+ */
+void Replay_MainFunctionInputs(uint64_t TimeUs) {
+    Replay_CursorType cursor;
+    Replay_EventType event;
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    Replay_TimeUs = TimeUs;
+    if (Replay_Mode != REPLAY_MODE_REPLAY) {
+        return;
+    }
+
+    /* The MCAL functions called here have no hooks installed in replay */
+    cursor = Replay_InputCursor;
+    while (Replay_Next(&cursor, &event)) {
+        if (event.TimeUs > TimeUs) {
+            break;
+        }
+        Replay_ApplyInput(&event);
+        Replay_InputCursor = cursor;
+    }
+}
+
+/**
+ * @brief End of a tick
+ */
+void Replay_MainFunctionOutputs(uint64_t TimeUs) {
+    uint8_t outputs[REPLAY_OUTPUTS_SIZE];
+    Replay_CursorType cursor;
+    Replay_EventType event;
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    if (Replay_Mode == REPLAY_MODE_OFF) {
+        return;
+    }
+
+    Replay_TimeUs = TimeUs;
+    Replay_CaptureOutputs(outputs);
+
+    if (Replay_Mode == REPLAY_MODE_RECORD) {
+        if (!Replay_OutputsValid ||
+            (std::memcmp(outputs, Replay_Outputs, REPLAY_OUTPUTS_SIZE) != 0)) {
+            Replay_Write(REPLAY_EVENT_OUTPUTS, outputs, REPLAY_OUTPUTS_SIZE);
+            (void)std::memcpy(Replay_Outputs, outputs, REPLAY_OUTPUTS_SIZE);
+            Replay_OutputsValid = TRUE;
+            Replay_Stats.OutputEvents++;
+        }
+        return;
+    }
+
+    /* Latest recorded snapshot up to this tick */
+    cursor = Replay_OutputCursor;
+    while (Replay_Next(&cursor, &event)) {
+        if (event.TimeUs > TimeUs) {
+            break;
+        }
+        if ((event.Type == REPLAY_EVENT_OUTPUTS) && (event.Length == REPLAY_OUTPUTS_SIZE)) {
+            (void)std::memcpy(Replay_Outputs, event.Payload, REPLAY_OUTPUTS_SIZE);
+            Replay_OutputsValid = TRUE;
+            Replay_Stats.OutputEvents++;
+        }
+        Replay_OutputCursor = cursor;
+    }
+
+    if (Replay_OutputsValid &&
+        (std::memcmp(outputs, Replay_Outputs, REPLAY_OUTPUTS_SIZE) != 0)) {
+        Replay_Mismatch();
+    }
+
+    if (TimeUs >= Replay_Stats.DurationUs) {
+        Replay_TickDone = TRUE;
+    }
+}
+
+/**
+ * @brief Check for the end of a replay
+ */
+boolean Replay_IsFinished(void) {
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    return ((Replay_Mode != REPLAY_MODE_REPLAY) || Replay_TickDone) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Get statistics
+ */
+void Replay_GetStats(Replay_StatsType* Stats) {
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    if (Stats != NULL_PTR) {
+        *Stats = Replay_Stats;
+        if (Replay_Mode == REPLAY_MODE_RECORD) {
+            Stats->DurationUs = Replay_TimeUs;
+        }
+    }
+}
+
+/*============================================================================*
+ * LOCAL FUNCTIONS - ENCODING
+ *============================================================================*/
+
+static size_t Replay_PutVarint(uint8_t* buffer, uint64_t value) {
+    size_t n = 0U;
+
+    while (value >= 0x80U) {
+        buffer[n] = static_cast<uint8_t>(value | 0x80U);
+        value >>= 7U;
+        n++;
+    }
+    buffer[n] = static_cast<uint8_t>(value);
+
+    return n + 1U;
+}
+
+static boolean Replay_GetVarint(const uint8_t* data, size_t length, size_t* pos, uint64_t* value) {
+    uint64_t result = 0U;
+    uint32_t shift = 0U;
+
+    while ((*pos < length) && (shift < 64U)) {
+        const uint8_t byte = data[*pos];
+        (*pos)++;
+        result |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0U) {
+            *value = result;
+            return TRUE;
+        }
+        shift += 7U;
+    }
+
+    return FALSE;
+}
+
+static uint64_t Replay_Zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1U) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static int64_t Replay_Unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1U) ^ -static_cast<int64_t>(value & 1U);
+}
+
+/**
+ * @brief Append an event at the current tick (record, lock held)
+ */
+static void Replay_Write(uint8_t type, const uint8_t* payload, size_t length) {
+    uint8_t header[(2U * REPLAY_MAX_VARINT) + 1U];
+    size_t n;
+
+    /* Hook that raced with Replay_Stop */
+    if (Replay_File == NULL_PTR) {
+        return;
+    }
+
+    n = Replay_PutVarint(header, Replay_TimeUs - Replay_LastEventUs);
+    header[n] = type;
+    n++;
+    n += Replay_PutVarint(&header[n], length);
+
+    (void)std::fwrite(header, 1U, n, Replay_File);
+    if (length > 0U) {
+        (void)std::fwrite(payload, 1U, length, Replay_File);
+    }
+
+    Replay_LastEventUs = Replay_TimeUs;
+    Replay_Stats.LogBytes += static_cast<uint32_t>(n + length);
+}
+
+/**
+ * @brief Read the event at a cursor and advance it
+ * @return FALSE at the end of the log or on a truncated event
+ */
+static boolean Replay_Next(Replay_CursorType* cursor, Replay_EventType* event) {
+    const uint8_t* data = Replay_Log.data();
+    const size_t size = Replay_Log.size();
+    size_t pos = cursor->Pos;
+    uint64_t delta;
+    uint64_t length;
+
+    if (!Replay_GetVarint(data, size, &pos, &delta) || (pos >= size)) {
+        return FALSE;
+    }
+    event->Type = data[pos];
+    pos++;
+    if (!Replay_GetVarint(data, size, &pos, &length) ||
+        (length > REPLAY_MAX_PAYLOAD) || (length > (size - pos))) {
+        return FALSE;
+    }
+
+    event->TimeUs = cursor->TimeUs + delta;
+    event->Payload = &data[pos];
+    event->Length = static_cast<size_t>(length);
+    cursor->Pos = pos + event->Length;
+    cursor->TimeUs = event->TimeUs;
+
+    return TRUE;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTIONS - OUTPUTS AND INPUTS
+ *============================================================================*/
+
+static void Replay_CaptureOutputs(uint8_t* outputs) {
+    Pwm_SimChannelType pwm;
+    Can_IdType canId = 0U;
+    uint8_t dlc = 0U;
+    uint8_t data[CAN_MAX_DATA_LENGTH] = {0};
+    uint32_t txCount;
+    size_t n = 0U;
+    uint8_t i;
+
+    for (i = 0U; i < DIO_NUM_PORTS; i++) {
+        outputs[n] = Dio_SimGetOutputPort(i);
+        n++;
+    }
+    for (i = 0U; i < PWM_NUM_CHANNELS; i++) {
+        if (Pwm_SimGetChannel(i, &pwm) != E_OK) {
+            pwm.DutyCycle = 0U;
+        }
+        outputs[n] = static_cast<uint8_t>(pwm.DutyCycle);
+        outputs[n + 1U] = static_cast<uint8_t>(pwm.DutyCycle >> 8U);
+        n += 2U;
+    }
+
+    txCount = Can_SimGetTxCount();
+    (void)Can_SimGetLastTxMessage(&canId, &dlc, data);
+    for (i = 0U; i < 4U; i++) {
+        outputs[n] = static_cast<uint8_t>(txCount >> (8U * i));
+        outputs[n + 4U] = static_cast<uint8_t>(canId >> (8U * i));
+        n++;
+    }
+    n += 4U;
+    outputs[n] = dlc;
+    n++;
+    (void)std::memcpy(&outputs[n], data, CAN_MAX_DATA_LENGTH);
+}
+
+static void Replay_Mismatch(void) {
+    if (Replay_Stats.Mismatches == 0U) {
+        Replay_Stats.FirstMismatchUs = Replay_TimeUs;
+    }
+    Replay_Stats.Mismatches++;
+}
+
+/**
+ * @brief Apply a recorded discrete input (other events are skipped)
+ */
+static void Replay_ApplyInput(const Replay_EventType* event) {
+    const uint8_t* p = event->Payload;
+    const size_t length = event->Length;
+    size_t pos = 0U;
+    uint64_t value;
+    uint64_t id;
+
+    switch (event->Type) {
+        case REPLAY_EVENT_CAN_RX:
+            /* Controller, ID, DLC, data present, data */
+            pos = 1U;
+            if ((length >= 1U) && Replay_GetVarint(p, length, &pos, &id) &&
+                ((pos + 2U) <= length)) {
+                const uint8_t dlc = p[pos];
+                const boolean hasData = (p[pos + 1U] != 0U) ? TRUE : FALSE;
+                Can_SimReceiveMessage(p[0], static_cast<Can_IdType>(id), dlc,
+                                      hasData ? &p[pos + 2U] : NULL_PTR);
+                Replay_Stats.InputEvents++;
+            }
+            break;
+
+        case REPLAY_EVENT_COM_RX:
+            /* PDU ID, info present, data present, length, data */
+            if (Replay_GetVarint(p, length, &pos, &id) && ((pos + 2U) <= length)) {
+                const boolean hasInfo = (p[pos] != 0U) ? TRUE : FALSE;
+                const boolean hasData = (p[pos + 1U] != 0U) ? TRUE : FALSE;
+                uint8_t sdu[REPLAY_MAX_SDU_BYTES] = {0};
+                PduInfoType pduInfo;
+
+                pos += 2U;
+                if (Replay_GetVarint(p, length, &pos, &value)) {
+                    const size_t stored = length - pos;
+                    (void)std::memcpy(sdu, &p[pos],
+                                      (stored < REPLAY_MAX_SDU_BYTES) ? stored : REPLAY_MAX_SDU_BYTES);
+                    pduInfo.SduDataPtr = hasData ? sdu : NULL_PTR;
+                    pduInfo.MetaDataPtr = NULL_PTR;
+                    pduInfo.SduLength = static_cast<PduLengthType>(value);
+                    Com_RxIndication(static_cast<PduIdType>(id), hasInfo ? &pduInfo : NULL_PTR);
+                    Replay_Stats.InputEvents++;
+                }
+            }
+            break;
+
+        case REPLAY_EVENT_DIO_INPUT:
+            if (length == 2U) {
+                Dio_SimSetInput(p[0], p[1]);
+                Replay_Stats.InputEvents++;
+            }
+            break;
+
+        case REPLAY_EVENT_FEEDBACK_CURRENT:
+            if (Replay_GetVarint(p, length, &pos, &value)) {
+                Headlight_SimSetFeedbackCurrent(static_cast<uint16_t>(value));
+                Replay_Stats.InputEvents++;
+            }
+            break;
+
+        default:
+            /* ADC blocks have their own cursors, outputs are compared */
+            break;
+    }
+}
+
+/*============================================================================*
+ * LOCAL FUNCTIONS - RECORD HOOKS
+ *============================================================================*/
+
+static void Replay_CanRxHook(uint8_t Controller, Can_IdType CanId, uint8_t Dlc,
+                             const uint8_t* Data) {
+    uint8_t payload[2U + REPLAY_MAX_VARINT + 1U + CAN_MAX_DATA_LENGTH];
+    const size_t bytes = (Dlc < CAN_MAX_DATA_LENGTH) ? Dlc : CAN_MAX_DATA_LENGTH;
+    size_t n = 0U;
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    payload[n] = Controller;
+    n++;
+    n += Replay_PutVarint(&payload[n], CanId);
+    payload[n] = Dlc;
+    payload[n + 1U] = (Data != NULL_PTR) ? 1U : 0U;
+    n += 2U;
+    if (Data != NULL_PTR) {
+        (void)std::memcpy(&payload[n], Data, bytes);
+        n += bytes;
+    }
+
+    Replay_Write(REPLAY_EVENT_CAN_RX, payload, n);
+    Replay_Stats.InputEvents++;
+}
+
+static void Replay_ComRxHook(PduIdType PduId, const PduInfoType* PduInfoPtr) {
+    uint8_t payload[(2U * REPLAY_MAX_VARINT) + 2U + REPLAY_MAX_SDU_BYTES];
+    size_t n = 0U;
+    boolean hasData;
+    PduLengthType length;
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    hasData = ((PduInfoPtr != NULL_PTR) && (PduInfoPtr->SduDataPtr != NULL_PTR)) ? TRUE : FALSE;
+    length = (PduInfoPtr != NULL_PTR) ? PduInfoPtr->SduLength : 0U;
+
+    n += Replay_PutVarint(&payload[n], PduId);
+    payload[n] = (PduInfoPtr != NULL_PTR) ? 1U : 0U;
+    payload[n + 1U] = hasData ? 1U : 0U;
+    n += 2U;
+    n += Replay_PutVarint(&payload[n], length);
+    if (hasData) {
+        const size_t bytes = (length < REPLAY_MAX_SDU_BYTES) ? length : REPLAY_MAX_SDU_BYTES;
+        (void)std::memcpy(&payload[n], PduInfoPtr->SduDataPtr, bytes);
+        n += bytes;
+    }
+
+    Replay_Write(REPLAY_EVENT_COM_RX, payload, n);
+    Replay_Stats.InputEvents++;
+}
+
+static void Replay_DioInputHook(Dio_ChannelType ChannelId, Dio_LevelType Level) {
+    const uint8_t payload[2] = { ChannelId, Level };
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    Replay_Write(REPLAY_EVENT_DIO_INPUT, payload, sizeof(payload));
+    Replay_Stats.InputEvents++;
+}
+
+static void Replay_FeedbackHook(uint16_t current) {
+    uint8_t payload[REPLAY_MAX_VARINT];
+    size_t n;
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    n = Replay_PutVarint(payload, current);
+    Replay_Write(REPLAY_EVENT_FEEDBACK_CURRENT, payload, n);
+    Replay_Stats.InputEvents++;
+}
+
+/**
+ * @brief Record converted samples
+ * @details Type carries the channel. Payload: count << 2 | held << 1 |
+ *          continued, the first sample relative to the tick (zigzag) and
+ *          the period unless the block continues the previous one, then,
+ *          unless all samples equal the last one (held), the samples as
+ *          zigzag deltas with runs of repeated samples as 0, length.
+ */
+static void Replay_AdcHook(Adc_ChannelType Channel, uint64_t firstUs, uint32_t periodUs,
+                           uint16_t numSamples, const Adc_ValueGroupType* samples) {
+    uint8_t payload[REPLAY_MAX_PAYLOAD];
+    Replay_AdcStreamType* stream;
+    boolean continued;
+    boolean held = TRUE;
+    uint32_t run = 0U;
+    size_t n = 0U;
+    uint16_t i;
+
+    /* Worst case three bytes per sample */
+    if ((Channel >= ADC_NUM_CHANNELS) ||
+        (((3U * REPLAY_MAX_VARINT) + (3U * static_cast<size_t>(numSamples))) > REPLAY_MAX_PAYLOAD)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    stream = &Replay_AdcStreams[Channel];
+    continued = ((firstUs == stream->NextUs) && (periodUs == stream->PeriodUs)) ? TRUE : FALSE;
+    for (i = 0U; i < numSamples; i++) {
+        if (samples[i] != stream->Last) {
+            held = FALSE;
+        }
+    }
+    n += Replay_PutVarint(&payload[n], (static_cast<uint64_t>(numSamples) << 2U) |
+                                       (held ? 2U : 0U) | (continued ? 1U : 0U));
+    if (!continued) {
+        n += Replay_PutVarint(&payload[n], Replay_Zigzag(static_cast<int64_t>(firstUs - Replay_TimeUs)));
+        n += Replay_PutVarint(&payload[n], periodUs);
+    }
+
+    for (i = 0U; (i < numSamples) && !held; i++) {
+        if (samples[i] == stream->Last) {
+            run++;
+            continue;
+        }
+        if (run > 0U) {
+            payload[n] = 0U;
+            n++;
+            n += Replay_PutVarint(&payload[n], run);
+            run = 0U;
+        }
+        n += Replay_PutVarint(&payload[n], Replay_Zigzag(static_cast<int32_t>(samples[i]) -
+                                                         static_cast<int32_t>(stream->Last)));
+        stream->Last = samples[i];
+    }
+    if ((run > 0U) && !held) {
+        payload[n] = 0U;
+        n++;
+        n += Replay_PutVarint(&payload[n], run);
+    }
+
+    stream->NextUs = firstUs + (static_cast<uint64_t>(numSamples) * periodUs);
+    stream->PeriodUs = periodUs;
+
+    Replay_Write(static_cast<uint8_t>(REPLAY_EVENT_ADC_BLOCK | Channel), payload, n);
+    Replay_Stats.AdcBlocks++;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTIONS - REPLAY SAMPLE SOURCE
+ *============================================================================*/
+
+static void Replay_ResetAdcStreams(void) {
+    uint8_t ch;
+
+    for (ch = 0U; ch < ADC_NUM_CHANNELS; ch++) {
+        Replay_AdcStreams[ch].Cursor.Pos = REPLAY_HEADER_SIZE;
+        Replay_AdcStreams[ch].Cursor.TimeUs = 0U;
+        Replay_AdcStreams[ch].Last = 0U;
+        Replay_AdcStreams[ch].NextUs = 0U;
+        Replay_AdcStreams[ch].PeriodUs = 0U;
+    }
+}
+
+/**
+ * @brief Decode a block into Replay_AdcSamples and advance its stream
+ */
+static boolean Replay_DecodeAdc(const Replay_EventType* event, Replay_AdcStreamType* stream,
+                                uint64_t* firstUs, uint32_t* periodUs, uint16_t* numSamples) {
+    const uint8_t* p = event->Payload;
+    const size_t length = event->Length;
+    size_t pos = 0U;
+    uint64_t header;
+    uint64_t value;
+    uint64_t period;
+    uint16_t count;
+    uint16_t i = 0U;
+
+    if (!Replay_GetVarint(p, length, &pos, &header) ||
+        ((header >> 2U) > ADC_MAX_STREAM_SAMPLES)) {
+        return FALSE;
+    }
+    count = static_cast<uint16_t>(header >> 2U);
+
+    if ((header & 1U) != 0U) {
+        *firstUs = stream->NextUs;
+        *periodUs = stream->PeriodUs;
+    } else {
+        if (!Replay_GetVarint(p, length, &pos, &value) ||
+            !Replay_GetVarint(p, length, &pos, &period)) {
+            return FALSE;
+        }
+        *firstUs = event->TimeUs + static_cast<uint64_t>(Replay_Unzigzag(value));
+        *periodUs = static_cast<uint32_t>(period);
+    }
+
+    /* Held: all samples equal the last one */
+    for (; ((header & 2U) != 0U) && (i < count); i++) {
+        Replay_AdcSamples[i] = stream->Last;
+    }
+
+    while (i < count) {
+        if (!Replay_GetVarint(p, length, &pos, &value)) {
+            return FALSE;
+        }
+        if (value == 0U) {
+            /* Run of repeated samples */
+            if (!Replay_GetVarint(p, length, &pos, &value) || (value > static_cast<uint64_t>(count - i))) {
+                return FALSE;
+            }
+            for (; value > 0U; value--) {
+                Replay_AdcSamples[i] = stream->Last;
+                i++;
+            }
+        } else {
+            stream->Last = static_cast<Adc_ValueGroupType>(
+                static_cast<int64_t>(stream->Last) + Replay_Unzigzag(value));
+            Replay_AdcSamples[i] = stream->Last;
+            i++;
+        }
+    }
+
+    *numSamples = count;
+    stream->NextUs = *firstUs + (static_cast<uint64_t>(count) * *periodUs);
+    stream->PeriodUs = *periodUs;
+
+    return TRUE;
+}
+
+/**
+ * @brief Serve recorded samples
+ * @details Blocks the run skipped are dropped; a conversion without a
+ *          recorded block holds the last sample and counts as mismatch
+ */
+static void Replay_AdcSource(Adc_ChannelType Channel, uint64_t firstUs, uint32_t periodUs,
+                             uint16_t numSamples, Adc_ValueGroupType* samples) {
+    Replay_AdcStreamType stream;
+    Replay_EventType event;
+    uint64_t recFirstUs;
+    uint32_t recPeriodUs;
+    uint16_t recSamples;
+    uint16_t i;
+
+    std::lock_guard<std::mutex> lock(Replay_Mutex);
+
+    if ((Replay_Mode != REPLAY_MODE_REPLAY) || (Channel >= ADC_NUM_CHANNELS)) {
+        return;
+    }
+
+    stream = Replay_AdcStreams[Channel];
+    while (Replay_Next(&stream.Cursor, &event)) {
+        if (event.Type != static_cast<uint8_t>(REPLAY_EVENT_ADC_BLOCK | Channel)) {
+            Replay_AdcStreams[Channel].Cursor = stream.Cursor;
+            continue;
+        }
+        if (!Replay_DecodeAdc(&event, &stream, &recFirstUs, &recPeriodUs, &recSamples)) {
+            break;
+        }
+
+        if ((recFirstUs == firstUs) && (recPeriodUs == periodUs) && (recSamples == numSamples)) {
+            for (i = 0U; i < numSamples; i++) {
+                samples[i] = Replay_AdcSamples[i];
+            }
+            Replay_AdcStreams[Channel] = stream;
+            Replay_Stats.AdcBlocks++;
+            return;
+        }
+
+        if (recFirstUs >= firstUs) {
+            break;
+        }
+        Replay_AdcStreams[Channel] = stream;
+    }
+
+    for (i = 0U; i < numSamples; i++) {
+        samples[i] = Replay_AdcStreams[Channel].Last;
+    }
+    Replay_Mismatch();
+}
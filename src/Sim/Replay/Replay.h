@@ -0,0 +1,145 @@
+/**
+ * @file Replay.h
+ * @brief Deterministic Record/Replay Interface
+ * @details Captures every nondeterministic input at the MCAL boundary of a
+ *          run in virtual time and feeds it back for bit-exact regression:
+ *          - Record: Can_SimReceiveMessage, Com_RxIndication,
+ *            Dio_SimSetInput and Headlight_SimSetFeedbackCurrent calls, the
+ *            ADC samples converted outside the plant models (stimulus,
+ *            Adc_SimSetValue levels, IIO) and the outputs whenever they
+ *            change
+ *          - Replay: the discrete inputs are applied at the tick they were
+ *            recorded in, the ADC samples are served as sample source and
+ *            the outputs are compared with the recording after every tick
+ *          The plant models (lamp current) stay live in replay, so a change
+ *          of the control software shows up as an output mismatch.
+ *
+ *          Log: "FLMR" and a version byte, then events of varint time delta
+ *          (us), type, varint payload length and payload. ADC samples are
+ *          stored zigzag delta encoded. Nothing waits for the wall clock in
+ *          replay, a run replays as fast as the tasks execute.
+ *
+ *          Inputs are stamped with the time of the last
+ *          Replay_MainFunctionInputs; inject them between it and the tasks
+ *          of the tick.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define REPLAY_SW_MAJOR_VERSION             1
+#define REPLAY_SW_MINOR_VERSION             0
+#define REPLAY_SW_PATCH_VERSION             0
+
+/*============================================================================*
+ * CONFIGURATION
+ *============================================================================*/
+
+/** @brief Log format version */
+#define REPLAY_LOG_VERSION                  1U
+
+/** @brief Largest event payload (bytes) */
+#define REPLAY_MAX_PAYLOAD                  1024U
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Record/replay mode
+ */
+typedef enum {
+    REPLAY_MODE_OFF         = 0x00U,    /**< Neither recording nor replaying */
+    REPLAY_MODE_RECORD      = 0x01U,    /**< Capturing inputs and outputs */
+    REPLAY_MODE_REPLAY      = 0x02U     /**< Feeding back a recording */
+} Replay_ModeType;
+
+/**
+ * @brief Record/replay statistics
+ */
+typedef struct {
+    Replay_ModeType Mode;               /**< Current mode */
+    uint32_t InputEvents;               /**< Discrete inputs recorded / applied */
+    uint32_t AdcBlocks;                 /**< ADC sample blocks recorded / served */
+    uint32_t OutputEvents;              /**< Output changes recorded / compared */
+    uint32_t Mismatches;                /**< Ticks with outputs differing from the recording,
+                                             ADC conversions not in the recording */
+    uint64_t FirstMismatchUs;           /**< Virtual time of the first mismatch */
+    uint64_t DurationUs;                /**< Virtual time of the recording */
+    uint32_t LogBytes;                  /**< Size of the log */
+} Replay_StatsType;
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Start recording
+ * @details Installs the input hooks. Call after the MCAL modules are
+ *          initialized.
+ * @param[in] Path Log file
+ * @return E_OK on success, E_NOT_OK if the file cannot be created or a
+ *         recording or replay is active
+ */
+Std_ReturnType Replay_StartRecord(const char* Path);
+
+/**
+ * @brief Start replaying
+ * @details Loads the log and becomes the ADC sample source; the stimulus
+ *          engine must not run. Call after the MCAL modules are initialized
+ *          and the plant models installed.
+ * @param[in] Path Log file
+ * @return E_OK on success, E_NOT_OK if the file is missing or not a valid
+ *         log, or a recording or replay is active
+ */
+Std_ReturnType Replay_StartReplay(const char* Path);
+
+/**
+ * @brief Stop recording or replaying
+ * @details Closes a recording with its end time and removes the hooks and
+ *          the sample source
+ */
+void Replay_Stop(void);
+
+/**
+ * @brief Start of a tick
+ * @details Record: stamps the following inputs with TimeUs. Replay: applies
+ *          the inputs recorded up to TimeUs.
+ * @param[in] TimeUs Virtual time of the tick
+ */
+void Replay_MainFunctionInputs(uint64_t TimeUs);
+
+/**
+ * @brief End of a tick
+ * @details Record: logs the outputs if they changed. Replay: compares the
+ *          outputs with the ones recorded up to TimeUs.
+ * @param[in] TimeUs Virtual time of the tick
+ */
+void Replay_MainFunctionOutputs(uint64_t TimeUs);
+
+/**
+ * @brief Check for the end of a replay
+ * @return TRUE if the last tick of the recording was replayed (or no replay
+ *         is active)
+ */
+boolean Replay_IsFinished(void);
+
+/**
+ * @brief Get statistics
+ * @param[out] Stats Pointer to statistics
+ */
+void Replay_GetStats(Replay_StatsType* Stats);
+
+#endif /* REPLAY_H */
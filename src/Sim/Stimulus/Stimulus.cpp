@@ -0,0 +1,809 @@
+/**
+ * @file Stimulus.cpp
+ * @brief Sensor Stimulus Engine Implementation
+ * @details Waveform tracks evaluated in blocks: each block is split into
+ *          runs of samples within one segment, a run is computed by a
+ *          branch-free loop of the segment shape, noise and clamping are
+ *          separate passes over the block. The loops are written for the
+ *          compiler's auto-vectorizer.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Stimulus.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/*============================================================================*
+ * LOCAL DEFINITIONS
+ *============================================================================*/
+
+#define STIMULUS_PI                 3.14159265358979f
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Segment placed on the track time line
+ */
+typedef struct {
+    Stimulus_ShapeType Shape;
+    uint64_t StartUs;                   /**< Start on the track */
+    uint64_t DurationUs;                /**< Length (> 0) */
+    float From;
+    float To;
+    uint64_t ParamUs;                   /**< Transition time / flicker period */
+    uint32_t FirstPoint;                /**< Table: first point in the pool */
+    uint32_t NumPoints;                 /**< Table: number of points */
+} Stimulus_SegmentType;
+
+/**
+ * @brief Track state
+ */
+typedef struct {
+    boolean Used;
+    Stimulus_TargetType Target;
+    uint8_t Channel;
+    boolean Loop;
+    float NoiseAmplitude;
+    uint32_t NoiseSeed;
+    uint64_t EndUs;                     /**< End of the last segment */
+    uint8_t NumSegments;
+    Stimulus_SegmentType Segments[STIMULUS_MAX_TRACK_SEGMENTS];
+} Stimulus_TrackType;
+
+/**
+ * @brief Recorded point (time relative to the segment start)
+ */
+typedef struct {
+    uint64_t TimeUs;
+    float Value;
+} Stimulus_TablePointType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Tracks */
+static Stimulus_TrackType Stimulus_Tracks[STIMULUS_MAX_TRACKS];
+
+/** @brief Recorded points of all table segments */
+static Stimulus_TablePointType Stimulus_TablePoints[STIMULUS_MAX_TABLE_POINTS];
+static uint32_t Stimulus_NumTablePoints = 0U;
+
+/** @brief Waveform values of the block being generated (per thread: the
+ *         inputs and the ADC conversions of the tasks use it concurrently) */
+static thread_local float Stimulus_Block[STIMULUS_BLOCK_SAMPLES];
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static void Stimulus_ClearTracks(void);
+static Stimulus_TrackType* Stimulus_FindTrack(Stimulus_TargetType Target, uint8_t Channel);
+static Stimulus_TrackType* Stimulus_GetTrack(Stimulus_TargetType Target, uint8_t Channel);
+static void Stimulus_DropEmptyTrack(Stimulus_TrackType* track);
+static boolean Stimulus_IsSegmentValid(const Stimulus_SegmentConfigType* Segment);
+static Std_ReturnType Stimulus_AppendSegment(Stimulus_TrackType* track,
+                                             const Stimulus_SegmentConfigType* Segment);
+static void Stimulus_GenerateRun(const Stimulus_SegmentType* seg, uint64_t localUs,
+                                 uint32_t periodUs, uint16_t n, float* out);
+static void Stimulus_GenerateTable(const Stimulus_SegmentType* seg, uint64_t localUs,
+                                   uint32_t periodUs, uint16_t n, float* out);
+static void Stimulus_GenerateWaveform(const Stimulus_TrackType* track, uint64_t firstUs,
+                                      uint32_t periodUs, uint16_t n);
+static void Stimulus_AddNoise(const Stimulus_TrackType* track, uint64_t firstUs,
+                              uint32_t periodUs, uint16_t n);
+static uint32_t Stimulus_Hash(uint32_t x);
+static uint32_t Stimulus_Random(uint32_t* state, uint32_t low, uint32_t high);
+static void Stimulus_AdcSampleSource(Adc_ChannelType Channel, uint64_t firstUs,
+                                     uint32_t periodUs, uint16_t numSamples,
+                                     Adc_ValueGroupType* samples);
+
+/*============================================================================*
+ * FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Initialize the stimulus engine
+ */
+void Stimulus_Init(void) {
+    Stimulus_ClearTracks();
+    Adc_SimSetSampleSource(Stimulus_AdcSampleSource);
+}
+
+/**
+ * @brief De-initialize the stimulus engine
+ */
+void Stimulus_DeInit(void) {
+    Adc_SimSetSampleSource(NULL_PTR);
+    Stimulus_ClearTracks();
+}
+
+/**
+ * @brief Add a track
+ */
+Std_ReturnType Stimulus_AddTrack(const Stimulus_TrackConfigType* Track) {
+    Stimulus_TrackType* track;
+    uint8_t i;
+
+    if ((Track == NULL_PTR) || (Track->Segments == NULL_PTR) || (Track->NumSegments == 0U) ||
+        (Track->NumSegments > STIMULUS_MAX_TRACK_SEGMENTS)) {
+        return E_NOT_OK;
+    }
+
+    /* Check all segments first: a rejected track leaves the channel as it was */
+    for (i = 0U; i < Track->NumSegments; i++) {
+        if (!Stimulus_IsSegmentValid(&Track->Segments[i])) {
+            return E_NOT_OK;
+        }
+    }
+
+    track = Stimulus_GetTrack(Track->Target, Track->Channel);
+    if (track == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    /* Replace the waveform of the channel */
+    track->NumSegments = 0U;
+    track->EndUs = 0U;
+    track->Loop = Track->Loop;
+    track->NoiseAmplitude = static_cast<float>(Track->NoiseAmplitude);
+    track->NoiseSeed = Track->NoiseSeed;
+
+    for (i = 0U; i < Track->NumSegments; i++) {
+        if (Stimulus_AppendSegment(track, &Track->Segments[i]) != E_OK) {
+            Stimulus_DropEmptyTrack(track);
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Append a segment to the track of a channel
+ */
+Std_ReturnType Stimulus_AddSegment(Stimulus_TargetType Target, uint8_t Channel,
+                                   const Stimulus_SegmentConfigType* Segment) {
+    Stimulus_TrackType* track;
+    Std_ReturnType result;
+
+    if ((Segment == NULL_PTR) || !Stimulus_IsSegmentValid(Segment)) {
+        return E_NOT_OK;
+    }
+
+    track = Stimulus_GetTrack(Target, Channel);
+    if (track == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    result = Stimulus_AppendSegment(track, Segment);
+    Stimulus_DropEmptyTrack(track);
+
+    return result;
+}
+
+/**
+ * @brief Set sensor noise of a track
+ */
+Std_ReturnType Stimulus_SetNoise(Stimulus_TargetType Target, uint8_t Channel,
+                                 uint16_t Amplitude, uint32_t Seed) {
+    Stimulus_TrackType* track = Stimulus_FindTrack(Target, Channel);
+
+    if (track == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    track->NoiseAmplitude = static_cast<float>(Amplitude);
+    track->NoiseSeed = Seed;
+
+    return E_OK;
+}
+
+/**
+ * @brief Append a recorded sensor trace to the track of a channel
+ */
+Std_ReturnType Stimulus_LoadCsv(Stimulus_TargetType Target, uint8_t Channel,
+                                const char* Path, boolean Loop) {
+    char line[STIMULUS_CSV_LINE_LENGTH];
+    Stimulus_TrackType* track;
+    Stimulus_SegmentType* seg;
+    FILE* file;
+    uint32_t firstPoint = Stimulus_NumTablePoints;
+    uint32_t numPoints = 0U;
+    uint64_t timeUs;
+    uint64_t originUs = 0U;
+    double timeMs;
+    double value;
+    char* p;
+    char* end;
+    boolean valid = TRUE;
+
+    if (Path == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    file = std::fopen(Path, "r");
+    if (file == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    while (valid && (std::fgets(line, static_cast<int>(sizeof(line)), file) != NULL_PTR)) {
+        p = line;
+        while ((*p == ' ') || (*p == '\t')) {
+            p++;
+        }
+        /* Header, comment or empty line */
+        if ((*p < '0') || (*p > '9')) {
+            continue;
+        }
+
+        timeMs = std::strtod(p, &end);
+        p = end;
+        while ((*p == ' ') || (*p == '\t') || (*p == ',') || (*p == ';')) {
+            p++;
+        }
+        value = std::strtod(p, &end);
+        if ((end == p) || (timeMs < 0.0)) {
+            valid = FALSE;
+            break;
+        }
+
+        timeUs = static_cast<uint64_t>((timeMs * 1000.0) + 0.5);
+        if (numPoints == 0U) {
+            originUs = timeUs;
+        }
+        timeUs -= (timeUs >= originUs) ? originUs : timeUs;
+
+        if ((Stimulus_NumTablePoints >= STIMULUS_MAX_TABLE_POINTS) ||
+            ((numPoints > 0U) &&
+             (timeUs <= Stimulus_TablePoints[Stimulus_NumTablePoints - 1U].TimeUs))) {
+            valid = FALSE;
+            break;
+        }
+
+        Stimulus_TablePoints[Stimulus_NumTablePoints].TimeUs = timeUs;
+        Stimulus_TablePoints[Stimulus_NumTablePoints].Value = static_cast<float>(value);
+        Stimulus_NumTablePoints++;
+        numPoints++;
+    }
+
+    (void)std::fclose(file);
+
+    /* A file without points creates no track */
+    track = (valid && (numPoints > 0U)) ? Stimulus_GetTrack(Target, Channel) : NULL_PTR;
+    if ((track == NULL_PTR) || (track->NumSegments >= STIMULUS_MAX_TRACK_SEGMENTS)) {
+        /* Give the points back */
+        Stimulus_NumTablePoints = firstPoint;
+        return E_NOT_OK;
+    }
+
+    seg = &track->Segments[track->NumSegments];
+    seg->Shape = STIMULUS_SHAPE_TABLE;
+    seg->StartUs = track->EndUs;
+    seg->DurationUs = Stimulus_TablePoints[firstPoint + numPoints - 1U].TimeUs + 1U;
+    seg->From = Stimulus_TablePoints[firstPoint].Value;
+    seg->To = Stimulus_TablePoints[firstPoint + numPoints - 1U].Value;
+    seg->ParamUs = 0U;
+    seg->FirstPoint = firstPoint;
+    seg->NumPoints = numPoints;
+
+    track->NumSegments++;
+    track->EndUs += seg->DurationUs;
+    track->Loop = Loop;
+
+    return E_OK;
+}
+
+/**
+ * @brief Load a named scenario
+ */
+Std_ReturnType Stimulus_LoadScenario(const char* Name) {
+    const Stimulus_ScenarioConfigType* scenario = NULL_PTR;
+    uint8_t i;
+
+    if (Name == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0U; i < STIMULUS_NUM_SCENARIOS; i++) {
+        if (std::strcmp(Stimulus_ScenarioConfig[i].Name, Name) == 0) {
+            scenario = &Stimulus_ScenarioConfig[i];
+            break;
+        }
+    }
+
+    if (scenario == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    Stimulus_ClearTracks();
+    for (i = 0U; i < scenario->NumTracks; i++) {
+        if (Stimulus_AddTrack(&scenario->Tracks[i]) != E_OK) {
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Build a random ambient light scenario
+ */
+Std_ReturnType Stimulus_BuildRandomAmbient(uint32_t Seed, uint32_t DurationMs) {
+    Stimulus_TrackType* track;
+    Stimulus_SegmentConfigType segment;
+    uint32_t state = Stimulus_Hash(Seed) | 1U;
+    uint32_t timeMs = 0U;
+    uint32_t level;
+    uint32_t target;
+    uint32_t swing;
+
+    if (DurationMs == 0U) {
+        return E_NOT_OK;
+    }
+
+    Stimulus_ClearTracks();
+    track = Stimulus_GetTrack(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT);
+    track->Loop = TRUE;
+    track->NoiseAmplitude = static_cast<float>(Stimulus_Random(&state, 0U, STIMULUS_RANDOM_MAX_NOISE));
+    track->NoiseSeed = Stimulus_Hash(state);
+
+    level = Stimulus_Random(&state, STIMULUS_RANDOM_MIN_LEVEL, STIMULUS_RANDOM_MAX_LEVEL);
+
+    while ((timeMs < DurationMs) && (track->NumSegments < STIMULUS_MAX_TRACK_SEGMENTS)) {
+        segment.Shape = static_cast<Stimulus_ShapeType>(
+            Stimulus_Random(&state, STIMULUS_SHAPE_HOLD, STIMULUS_SHAPE_FLICKER));
+        segment.DurationMs = Stimulus_Random(&state, STIMULUS_RANDOM_MIN_SEGMENT_MS,
+                                             STIMULUS_RANDOM_MAX_SEGMENT_MS);
+        segment.From = static_cast<float>(level);
+        segment.To = static_cast<float>(level);
+        segment.ParamMs = 0U;
+
+        target = Stimulus_Random(&state, STIMULUS_RANDOM_MIN_LEVEL, STIMULUS_RANDOM_MAX_LEVEL);
+
+        switch (segment.Shape) {
+            case STIMULUS_SHAPE_RAMP:
+            case STIMULUS_SHAPE_SCURVE:
+                segment.To = static_cast<float>(target);
+                level = target;
+                break;
+
+            case STIMULUS_SHAPE_TUNNEL:
+                /* Tunnel darker than the road outside, back out at the end */
+                segment.To = static_cast<float>(
+                    Stimulus_Random(&state, STIMULUS_RANDOM_MIN_LEVEL, level));
+                segment.ParamMs = Stimulus_Random(&state, 0U, segment.DurationMs / 2U);
+                break;
+
+            case STIMULUS_SHAPE_FLICKER:
+                swing = level - STIMULUS_RANDOM_MIN_LEVEL;
+                if ((STIMULUS_RANDOM_MAX_LEVEL - level) < swing) {
+                    swing = STIMULUS_RANDOM_MAX_LEVEL - level;
+                }
+                segment.To = static_cast<float>(Stimulus_Random(&state, 0U, swing));
+                segment.ParamMs = Stimulus_Random(&state, 20U, 1000U);
+                break;
+
+            default:
+                break;
+        }
+
+        (void)Stimulus_AppendSegment(track, &segment);
+        timeMs += segment.DurationMs;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Get scenario length
+ */
+uint32_t Stimulus_GetDurationMs(void) {
+    uint64_t endUs = 0U;
+    uint8_t i;
+
+    for (i = 0U; i < STIMULUS_MAX_TRACKS; i++) {
+        if (Stimulus_Tracks[i].Used && (Stimulus_Tracks[i].EndUs > endUs)) {
+            endUs = Stimulus_Tracks[i].EndUs;
+        }
+    }
+
+    return static_cast<uint32_t>(endUs / 1000U);
+}
+
+/**
+ * @brief Generate samples of a channel
+ */
+Std_ReturnType Stimulus_GenerateBlock(Stimulus_TargetType Target, uint8_t Channel,
+                                      uint64_t firstUs, uint32_t periodUs,
+                                      uint16_t numSamples, uint16_t* samples) {
+    const Stimulus_TrackType* track = Stimulus_FindTrack(Target, Channel);
+    const float maxValue = (Target == STIMULUS_TARGET_DIO) ? 1.0f : static_cast<float>(ADC_MAX_VALUE);
+    uint16_t done;
+    uint16_t n;
+    uint16_t j;
+    float v;
+
+    if ((track == NULL_PTR) || (samples == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    for (done = 0U; done < numSamples; done = static_cast<uint16_t>(done + n)) {
+        n = static_cast<uint16_t>(numSamples - done);
+        if (n > STIMULUS_BLOCK_SAMPLES) {
+            n = STIMULUS_BLOCK_SAMPLES;
+        }
+
+        Stimulus_GenerateWaveform(track, firstUs, periodUs, n);
+        Stimulus_AddNoise(track, firstUs, periodUs, n);
+
+        /* Clamp to the converter range and round */
+        for (j = 0U; j < n; j++) {
+            v = Stimulus_Block[j];
+            v = (v < 0.0f) ? 0.0f : v;
+            v = (v > maxValue) ? maxValue : v;
+            samples[done + j] = static_cast<uint16_t>(v + 0.5f);
+        }
+
+        firstUs += static_cast<uint64_t>(n) * periodUs;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief Apply the stimulus at a point in virtual time
+ */
+void Stimulus_MainFunction(uint64_t timeUs) {
+    const Stimulus_TrackType* track;
+    uint16_t value;
+    uint8_t i;
+
+    for (i = 0U; i < STIMULUS_MAX_TRACKS; i++) {
+        track = &Stimulus_Tracks[i];
+        if ((!track->Used) || (track->NumSegments == 0U)) {
+            continue;
+        }
+
+        /* Keep the last level of a track without a value */
+        if (Stimulus_GenerateBlock(track->Target, track->Channel, timeUs, 0U, 1U, &value) != E_OK) {
+            continue;
+        }
+
+        if (track->Target == STIMULUS_TARGET_ADC) {
+            Adc_SimSetValue(track->Channel, value);
+        } else {
+            Dio_SimSetInput(track->Channel, (value != 0U) ? STD_HIGH : STD_LOW);
+        }
+    }
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Remove all tracks and recorded points
+ */
+static void Stimulus_ClearTracks(void) {
+    (void)std::memset(Stimulus_Tracks, 0, sizeof(Stimulus_Tracks));
+    Stimulus_NumTablePoints = 0U;
+}
+
+/**
+ * @brief Find the track of a channel
+ * @return Track, NULL_PTR if the channel has none or an empty one
+ */
+static Stimulus_TrackType* Stimulus_FindTrack(Stimulus_TargetType Target, uint8_t Channel) {
+    uint8_t i;
+
+    for (i = 0U; i < STIMULUS_MAX_TRACKS; i++) {
+        if (Stimulus_Tracks[i].Used && (Stimulus_Tracks[i].NumSegments > 0U) &&
+            (Stimulus_Tracks[i].Target == Target) && (Stimulus_Tracks[i].Channel == Channel)) {
+            return &Stimulus_Tracks[i];
+        }
+    }
+
+    return NULL_PTR;
+}
+
+/**
+ * @brief Find or create the track of a channel
+ * @return Track, NULL_PTR if the channel is invalid or the pool is full
+ */
+static Stimulus_TrackType* Stimulus_GetTrack(Stimulus_TargetType Target, uint8_t Channel) {
+    Stimulus_TrackType* track = Stimulus_FindTrack(Target, Channel);
+    uint8_t i;
+
+    if (track != NULL_PTR) {
+        return track;
+    }
+
+    if (((Target == STIMULUS_TARGET_ADC) && (Channel >= ADC_NUM_CHANNELS)) ||
+        ((Target == STIMULUS_TARGET_DIO) && (Channel >= DIO_NUM_CHANNELS))) {
+        return NULL_PTR;
+    }
+
+    for (i = 0U; i < STIMULUS_MAX_TRACKS; i++) {
+        if (!Stimulus_Tracks[i].Used) {
+            track = &Stimulus_Tracks[i];
+            (void)std::memset(track, 0, sizeof(*track));
+            track->Used = TRUE;
+            track->Target = Target;
+            track->Channel = Channel;
+            return track;
+        }
+    }
+
+    return NULL_PTR;
+}
+
+/**
+ * @brief Give back a track without segments
+ * @details Tracks are created before their first segment is placed; a track
+ *          whose segments were all rejected must not be generated
+ */
+static void Stimulus_DropEmptyTrack(Stimulus_TrackType* track) {
+    if (track->NumSegments == 0U) {
+        (void)std::memset(track, 0, sizeof(*track));
+    }
+}
+
+/**
+ * @brief Check a synthetic segment
+ */
+static boolean Stimulus_IsSegmentValid(const Stimulus_SegmentConfigType* Segment) {
+    return ((Segment->Shape != STIMULUS_SHAPE_TABLE) && (Segment->DurationMs != 0U)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Place a segment at the end of a track
+ */
+static Std_ReturnType Stimulus_AppendSegment(Stimulus_TrackType* track,
+                                             const Stimulus_SegmentConfigType* Segment) {
+    Stimulus_SegmentType* seg;
+
+    if ((track->NumSegments >= STIMULUS_MAX_TRACK_SEGMENTS) || !Stimulus_IsSegmentValid(Segment)) {
+        return E_NOT_OK;
+    }
+
+    seg = &track->Segments[track->NumSegments];
+    seg->Shape = Segment->Shape;
+    seg->StartUs = track->EndUs;
+    seg->DurationUs = static_cast<uint64_t>(Segment->DurationMs) * 1000U;
+    seg->From = Segment->From;
+    seg->To = Segment->To;
+    seg->ParamUs = static_cast<uint64_t>(Segment->ParamMs) * 1000U;
+    seg->FirstPoint = 0U;
+    seg->NumPoints = 0U;
+
+    track->NumSegments++;
+    track->EndUs += seg->DurationUs;
+
+    return E_OK;
+}
+
+/**
+ * @brief Waveform of the samples of a block (without noise)
+ * @details Splits the block into runs of samples within one segment. Behind
+ *          the end of a track without loop the last value is held.
+ */
+static void Stimulus_GenerateWaveform(const Stimulus_TrackType* track, uint64_t firstUs,
+                                      uint32_t periodUs, uint16_t n) {
+    const Stimulus_SegmentType* seg;
+    uint64_t trackUs;
+    uint64_t segEndUs;
+    uint64_t runSamples;
+    uint16_t done = 0U;
+    uint16_t run;
+    uint8_t s = 0U;
+
+    while (done < n) {
+        trackUs = firstUs + (static_cast<uint64_t>(done) * periodUs);
+        if (trackUs >= track->EndUs) {
+            if (!track->Loop) {
+                seg = &track->Segments[track->NumSegments - 1U];
+                Stimulus_GenerateRun(seg, seg->DurationUs, 0U,
+                                     static_cast<uint16_t>(n - done), &Stimulus_Block[done]);
+                return;
+            }
+            trackUs %= track->EndUs;
+        }
+
+        /* Segments are sorted; restart the search after a wrap */
+        if ((s >= track->NumSegments) || (trackUs < track->Segments[s].StartUs)) {
+            s = 0U;
+        }
+        while ((trackUs - track->Segments[s].StartUs) >= track->Segments[s].DurationUs) {
+            s++;
+        }
+        seg = &track->Segments[s];
+
+        /* Samples up to the end of the segment */
+        segEndUs = seg->StartUs + seg->DurationUs;
+        runSamples = (periodUs > 0U) ? (((segEndUs - trackUs) + periodUs - 1U) / periodUs)
+                                     : static_cast<uint64_t>(n - done);
+        run = (runSamples < static_cast<uint64_t>(n - done)) ?
+              static_cast<uint16_t>(runSamples) : static_cast<uint16_t>(n - done);
+
+        Stimulus_GenerateRun(seg, trackUs - seg->StartUs, periodUs, run, &Stimulus_Block[done]);
+        done = static_cast<uint16_t>(done + run);
+    }
+}
+
+/**
+ * @brief Waveform of a run of samples within one segment
+ * @param[in] seg Segment
+ * @param[in] localUs Time of the first sample relative to the segment start
+ * @param[in] periodUs Time between samples
+ * @param[in] n Number of samples
+ * @param[out] out Waveform values
+ */
+static void Stimulus_GenerateRun(const Stimulus_SegmentType* seg, uint64_t localUs,
+                                 uint32_t periodUs, uint16_t n, float* out) {
+    const float duration = static_cast<float>(seg->DurationUs);
+    const float x0 = static_cast<float>(localUs) / duration;
+    const float dx = static_cast<float>(periodUs) / duration;
+    const float delta = seg->To - seg->From;
+    float edge;
+    float x;
+    float u;
+    uint16_t j;
+
+    switch (seg->Shape) {
+        case STIMULUS_SHAPE_RAMP:
+            for (j = 0U; j < n; j++) {
+                x = std::fmin(x0 + (dx * static_cast<float>(j)), 1.0f);
+                out[j] = seg->From + (delta * x);
+            }
+            break;
+
+        case STIMULUS_SHAPE_SCURVE:
+            for (j = 0U; j < n; j++) {
+                x = std::fmin(x0 + (dx * static_cast<float>(j)), 1.0f);
+                out[j] = seg->From + (delta * 0.5f * (1.0f - std::cos(STIMULUS_PI * x)));
+            }
+            break;
+
+        case STIMULUS_SHAPE_TUNNEL:
+            /* Entry and exit ramps as fraction of the segment (min. 1us) */
+            edge = static_cast<float>((seg->ParamUs > 0U) ? seg->ParamUs : 1U) / duration;
+            for (j = 0U; j < n; j++) {
+                x = std::fmin(x0 + (dx * static_cast<float>(j)), 1.0f);
+                u = std::fmin(std::fmin(x, 1.0f - x) / edge, 1.0f);
+                out[j] = seg->From + (delta * u);
+            }
+            break;
+
+        case STIMULUS_SHAPE_FLICKER: {
+            const float period = static_cast<float>((seg->ParamUs > 0U) ? seg->ParamUs : 1U);
+            const float p0 = static_cast<float>(localUs % ((seg->ParamUs > 0U) ? seg->ParamUs : 1U)) / period;
+            const float dp = static_cast<float>(periodUs) / period;
+            for (j = 0U; j < n; j++) {
+                out[j] = seg->From +
+                         (seg->To * std::sin(2.0f * STIMULUS_PI * (p0 + (dp * static_cast<float>(j)))));
+            }
+            break;
+        }
+
+        case STIMULUS_SHAPE_TABLE:
+            Stimulus_GenerateTable(seg, localUs, periodUs, n, out);
+            break;
+
+        case STIMULUS_SHAPE_HOLD:
+        default:
+            for (j = 0U; j < n; j++) {
+                out[j] = seg->From;
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Recorded trace of a run of samples, linear interpolation
+ */
+static void Stimulus_GenerateTable(const Stimulus_SegmentType* seg, uint64_t localUs,
+                                   uint32_t periodUs, uint16_t n, float* out) {
+    const Stimulus_TablePointType* points = &Stimulus_TablePoints[seg->FirstPoint];
+    const uint32_t last = seg->NumPoints - 1U;
+    uint32_t k = 0U;
+    uint64_t t;
+    uint16_t j;
+    float w;
+
+    for (j = 0U; j < n; j++) {
+        t = localUs + (static_cast<uint64_t>(j) * periodUs);
+
+        /* Sample times ascend within a run */
+        while ((k < last) && (points[k + 1U].TimeUs <= t)) {
+            k++;
+        }
+
+        if (k >= last) {
+            out[j] = points[last].Value;
+        } else {
+            w = static_cast<float>(t - points[k].TimeUs) /
+                static_cast<float>(points[k + 1U].TimeUs - points[k].TimeUs);
+            out[j] = points[k].Value + ((points[k + 1U].Value - points[k].Value) * w);
+        }
+    }
+}
+
+/**
+ * @brief Add the noise of a track to the block
+ * @details Noise of a sample depends only on seed and sample time
+ */
+static void Stimulus_AddNoise(const Stimulus_TrackType* track, uint64_t firstUs,
+                              uint32_t periodUs, uint16_t n) {
+    const float scale = (2.0f * track->NoiseAmplitude) / 16777216.0f;
+    uint64_t t;
+    uint32_t h;
+    uint16_t j;
+
+    if (track->NoiseAmplitude <= 0.0f) {
+        return;
+    }
+
+    for (j = 0U; j < n; j++) {
+        t = firstUs + (static_cast<uint64_t>(j) * periodUs);
+        h = Stimulus_Hash(static_cast<uint32_t>(t) ^
+                          (static_cast<uint32_t>(t >> 32U) * 0x9E3779B9U) ^ track->NoiseSeed);
+        Stimulus_Block[j] += (static_cast<float>(h >> 8U) * scale) - track->NoiseAmplitude;
+    }
+}
+
+/**
+ * @brief Integer hash (counter based noise)
+ */
+static uint32_t Stimulus_Hash(uint32_t x) {
+    x ^= x >> 16U;
+    x *= 0x7FEB352DU;
+    x ^= x >> 15U;
+    x *= 0x846CA68BU;
+    x ^= x >> 16U;
+    return x;
+}
+
+/**
+ * @brief Random number in [low, high] (xorshift)
+ */
+static uint32_t Stimulus_Random(uint32_t* state, uint32_t low, uint32_t high) {
+    uint32_t x = *state;
+
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+
+    return (high > low) ? (low + (x % ((high - low) + 1U))) : low;
+}
+
+/**
+ * @brief ADC conversions of a block, channels without track keep their level
+ */
+static void Stimulus_AdcSampleSource(Adc_ChannelType Channel, uint64_t firstUs,
+                                     uint32_t periodUs, uint16_t numSamples,
+                                     Adc_ValueGroupType* samples) {
+    Adc_ValueGroupType value;
+    uint16_t j;
+
+    if (Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, Channel, firstUs, periodUs,
+                               numSamples, samples) != E_OK) {
+        value = Adc_SimGetValue(Channel);
+        for (j = 0U; j < numSamples; j++) {
+            samples[j] = value;
+        }
+    }
+}
@@ -0,0 +1,214 @@
+/**
+ * @file Stimulus.h
+ * @brief Sensor Stimulus Engine Interface
+ * @details Plays waveforms into the simulated ADC and DIO channels in
+ *          virtual time:
+ *          - Segments: hold/step, ramp, dusk/dawn S-curve, tunnel entry and
+ *            exit, flicker, recorded sensor tables (CSV)
+ *          - Deterministic sensor noise per track
+ *          - Block generator feeding the ADC conversions of a whole block
+ *            at once (Adc_SimSetSampleSource)
+ *          - Named and procedurally generated ambient light scenarios
+ *          All tracks live in static pools, nothing is allocated after
+ *          loading a scenario.
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+#ifndef STIMULUS_H
+#define STIMULUS_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include "Std_Types.h"
+#include "Stimulus_Cfg.h"
+
+/*============================================================================*
+ * VERSION INFORMATION
+ *============================================================================*/
+#define STIMULUS_SW_MAJOR_VERSION           1
+#define STIMULUS_SW_MINOR_VERSION           0
+#define STIMULUS_SW_PATCH_VERSION           0
+
+/*============================================================================*
+ * TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Stimulated peripheral
+ */
+typedef enum {
+    STIMULUS_TARGET_ADC     = 0x00U,    /**< ADC channel (Adc_ChannelType) */
+    STIMULUS_TARGET_DIO     = 0x01U     /**< DIO input channel (Dio_ChannelType) */
+} Stimulus_TargetType;
+
+/**
+ * @brief Segment waveform
+ */
+typedef enum {
+    STIMULUS_SHAPE_HOLD     = 0x00U,    /**< Constant From (step sequences) */
+    STIMULUS_SHAPE_RAMP     = 0x01U,    /**< Linear From -> To */
+    STIMULUS_SHAPE_SCURVE   = 0x02U,    /**< Raised cosine From -> To (dusk/dawn) */
+    STIMULUS_SHAPE_TUNNEL   = 0x03U,    /**< From, ramp to To within ParamMs,
+                                             To, ramp back within ParamMs */
+    STIMULUS_SHAPE_FLICKER  = 0x04U,    /**< From +/- To, sine of period ParamMs */
+    STIMULUS_SHAPE_TABLE    = 0x05U     /**< Recorded points, linear interpolation */
+} Stimulus_ShapeType;
+
+/**
+ * @brief Segment configuration
+ */
+typedef struct {
+    Stimulus_ShapeType Shape;           /**< Waveform */
+    uint32_t DurationMs;                /**< Segment length */
+    float From;                         /**< Start level (center for flicker) */
+    float To;                           /**< End level (amplitude for flicker) */
+    uint32_t ParamMs;                   /**< Transition time / flicker period */
+} Stimulus_SegmentConfigType;
+
+/**
+ * @brief Track configuration (waveform of one channel)
+ */
+typedef struct {
+    Stimulus_TargetType Target;                 /**< Stimulated peripheral */
+    uint8_t Channel;                            /**< Channel of the peripheral */
+    boolean Loop;                               /**< Repeat after the last segment */
+    uint16_t NoiseAmplitude;                    /**< Peak noise (0 = none) */
+    uint32_t NoiseSeed;                         /**< Noise sequence */
+    const Stimulus_SegmentConfigType* Segments; /**< Segments in play order */
+    uint8_t NumSegments;                        /**< Number of segments */
+} Stimulus_TrackConfigType;
+
+/**
+ * @brief Scenario configuration
+ */
+typedef struct {
+    const char* Name;                           /**< Name (--scenario <name>) */
+    const char* Description;                    /**< One line description */
+    const Stimulus_TrackConfigType* Tracks;     /**< Tracks of the scenario */
+    uint8_t NumTracks;                          /**< Number of tracks */
+} Stimulus_ScenarioConfigType;
+
+/*============================================================================*
+ * EXTERNAL CONFIGURATION DATA
+ *============================================================================*/
+
+/** @brief Named scenarios, indexed by scenario ID */
+extern const Stimulus_ScenarioConfigType Stimulus_ScenarioConfig[STIMULUS_NUM_SCENARIOS];
+
+/*============================================================================*
+ * FUNCTION PROTOTYPES
+ *============================================================================*/
+
+/**
+ * @brief Initialize the stimulus engine
+ * @details Clears all tracks and becomes the ADC sample source. Call after
+ *          Adc_Init.
+ */
+void Stimulus_Init(void);
+
+/**
+ * @brief De-initialize the stimulus engine
+ * @details Clears all tracks and restores the Adc_SimSetValue levels
+ */
+void Stimulus_DeInit(void);
+
+/**
+ * @brief Add a track
+ * @details Replaces an existing track of the same channel
+ * @param[in] Track Track configuration (segments are copied)
+ * @return E_OK on success, E_NOT_OK if the track or segment pool is full
+ */
+Std_ReturnType Stimulus_AddTrack(const Stimulus_TrackConfigType* Track);
+
+/**
+ * @brief Append a segment to the track of a channel
+ * @details Creates the track (no noise, no loop) if needed
+ * @param[in] Target Stimulated peripheral
+ * @param[in] Channel Channel of the peripheral
+ * @param[in] Segment Segment configuration
+ * @return E_OK on success, E_NOT_OK if a pool is full
+ */
+Std_ReturnType Stimulus_AddSegment(Stimulus_TargetType Target, uint8_t Channel,
+                                   const Stimulus_SegmentConfigType* Segment);
+
+/**
+ * @brief Set sensor noise of a track
+ * @param[in] Target Stimulated peripheral
+ * @param[in] Channel Channel of the peripheral
+ * @param[in] Amplitude Peak noise (0 = none)
+ * @param[in] Seed Noise sequence
+ * @return E_OK on success, E_NOT_OK without track
+ */
+Std_ReturnType Stimulus_SetNoise(Stimulus_TargetType Target, uint8_t Channel,
+                                 uint16_t Amplitude, uint32_t Seed);
+
+/**
+ * @brief Append a recorded sensor trace to the track of a channel
+ * @details Lines "time_ms,value" with ascending times; header, comment and
+ *          empty lines are skipped. The first line is played at the start
+ *          of the segment, values in between are interpolated linearly.
+ * @param[in] Target Stimulated peripheral
+ * @param[in] Channel Channel of the peripheral
+ * @param[in] Path CSV file
+ * @param[in] Loop Repeat the track after the trace
+ * @return E_OK on success, E_NOT_OK if unreadable, empty or the pools are full
+ */
+Std_ReturnType Stimulus_LoadCsv(Stimulus_TargetType Target, uint8_t Channel,
+                                const char* Path, boolean Loop);
+
+/**
+ * @brief Load a named scenario (replaces all tracks)
+ * @param[in] Name Scenario name of Stimulus_ScenarioConfig
+ * @return E_OK on success, E_NOT_OK for unknown names
+ */
+Std_ReturnType Stimulus_LoadScenario(const char* Name);
+
+/**
+ * @brief Build a random ambient light scenario (replaces all tracks)
+ * @details Sequence of holds, ramps, dusk/dawn curves, tunnels and flicker
+ *          with levels in [STIMULUS_RANDOM_MIN_LEVEL, STIMULUS_RANDOM_MAX_LEVEL]
+ *          and noise up to STIMULUS_RANDOM_MAX_NOISE on the ambient channel.
+ *          The same seed always builds the same scenario. The track is
+ *          looped, so it also covers durations beyond the segment pool.
+ * @param[in] Seed Scenario seed
+ * @param[in] DurationMs Scenario length
+ * @return E_OK on success, E_NOT_OK for a zero duration
+ */
+Std_ReturnType Stimulus_BuildRandomAmbient(uint32_t Seed, uint32_t DurationMs);
+
+/**
+ * @brief Get scenario length
+ * @return End of the longest track in ms (0 without tracks)
+ */
+uint32_t Stimulus_GetDurationMs(void);
+
+/**
+ * @brief Generate samples of a channel
+ * @details Sample i is the waveform at firstUs + i * periodUs including
+ *          noise, clamped to the ADC range (DIO: 0 or 1). Results do not
+ *          depend on how a time range is split into blocks.
+ * @param[in] Target Stimulated peripheral
+ * @param[in] Channel Channel of the peripheral
+ * @param[in] firstUs Time of the first sample
+ * @param[in] periodUs Time between samples
+ * @param[in] numSamples Number of samples
+ * @param[out] samples Generated samples
+ * @return E_OK on success, E_NOT_OK without track
+ */
+Std_ReturnType Stimulus_GenerateBlock(Stimulus_TargetType Target, uint8_t Channel,
+                                      uint64_t firstUs, uint32_t periodUs,
+                                      uint16_t numSamples, uint16_t* samples);
+
+/**
+ * @brief Apply the stimulus at a point in virtual time
+ * @details Drives the DIO inputs and the Adc_SimSetValue levels; ADC
+ *          conversions take their samples from the generator directly.
+ * @param[in] timeUs Virtual time
+ */
+void Stimulus_MainFunction(uint64_t timeUs);
+
+#endif /* STIMULUS_H */
@@ -0,0 +1,275 @@
+/**
+ * @file fault_campaign.cpp
+ * @brief FLM Fault-Injection Campaign Runner
+ * @details Runs the fault catalogue against the closed-loop ECU and reports
+ *          the fault reaction time against the FTTI per fault model
+ * @version 1.0.0
+ * @date 2024
+ *
+ * @copyright AUTOSAR Classic Platform R23-11
+ */
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+#include "FLM_Config.h"
+
+/* Simulation */
+#include "Sim/Campaign/Campaign.h"
+
+/*============================================================================*
+ * LOCAL TYPE DEFINITIONS
+ *============================================================================*/
+
+/**
+ * @brief Outcome statistics of one fault model
+ */
+typedef struct {
+    uint32_t Variants;                  /**< Variants run */
+    uint32_t InFtti;                    /**< Safe state within the FTTI */
+    uint32_t Late;                      /**< Safe state after the FTTI */
+    uint32_t NotDetected;               /**< No safe state */
+    uint32_t MinResponseMs;             /**< Fastest reaction */
+    uint32_t MaxResponseMs;             /**< Slowest reaction */
+    uint64_t SumResponseMs;             /**< Sum of the reactions */
+    uint32_t ShortestDetectedMs;        /**< Shortest fault leading to a safe state */
+} Campaign_SummaryType;
+
+/*============================================================================*
+ * LOCAL VARIABLES
+ *============================================================================*/
+
+/** @brief Worker processes (0 = one per hardware thread) */
+static uint32_t Campaign_NumWorkers = 0U;
+
+/** @brief Per-variant results (NULL_PTR = none) */
+static const char* Campaign_CsvPath = NULL_PTR;
+
+/** @brief Gate on the known findings instead of strict FTTI compliance */
+static boolean Campaign_KnownFindings = FALSE;
+
+/*============================================================================*
+ * LOCAL FUNCTION PROTOTYPES
+ *============================================================================*/
+
+static void Campaign_ParseArguments(int argc, char* argv[]);
+static boolean Campaign_PrintSummary(const std::vector<Campaign_ResultType>& results);
+static boolean Campaign_CheckKnownFindings(const std::vector<Campaign_ResultType>& results);
+static Std_ReturnType Campaign_WriteCsv(const std::vector<Campaign_ResultType>& results);
+
+/*============================================================================*
+ * MAIN FUNCTION
+ *============================================================================*/
+
+/**
+ * @brief Runner entry point
+ * @return EXIT_SUCCESS if every detected fault reached the safe state
+ *         within the FTTI (--known-findings: if no fault model is worse than
+ *         its known finding)
+ */
+int main(int argc, char* argv[]) {
+    const Campaign_CatalogueType* catalogue = &Campaign_DefaultCatalogue;
+    std::vector<Campaign_ResultType> results(Campaign_GetNumVariants(catalogue));
+    std::chrono::steady_clock::time_point start;
+    double seconds;
+    boolean compliant;
+
+    Campaign_ParseArguments(argc, argv);
+    if (Campaign_NumWorkers == 0U) {
+        Campaign_NumWorkers = std::thread::hardware_concurrency();
+    }
+    if (Campaign_NumWorkers == 0U) {
+        Campaign_NumWorkers = 1U;
+    }
+    if (Campaign_NumWorkers > CAMPAIGN_MAX_WORKERS) {
+        Campaign_NumWorkers = CAMPAIGN_MAX_WORKERS;
+    }
+
+    std::cout << "FLM fault campaign: " << results.size() << " variants ("
+              << static_cast<uint32_t>(catalogue->NumFaults) << " faults x "
+              << catalogue->NumInjections << " injection times x "
+              << static_cast<uint32_t>(catalogue->NumDurations) << " durations), "
+              << Campaign_NumWorkers << " workers, FTTI " << FLM_FTTI_MS << "ms" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    if (Campaign_Run(catalogue, static_cast<uint8_t>(Campaign_NumWorkers), results.data(),
+                     static_cast<uint32_t>(results.size())) != E_OK) {
+        std::cerr << "Campaign failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Completed in " << seconds << "s ("
+              << static_cast<uint32_t>(static_cast<double>(results.size()) / seconds)
+              << " variants/s)" << std::endl << std::endl;
+
+    compliant = Campaign_PrintSummary(results);
+    if (Campaign_KnownFindings) {
+        compliant = Campaign_CheckKnownFindings(results);
+    }
+
+    if ((Campaign_CsvPath != NULL_PTR) && (Campaign_WriteCsv(results) != E_OK)) {
+        std::cerr << "Cannot write " << Campaign_CsvPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return compliant ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*============================================================================*
+ * LOCAL FUNCTION IMPLEMENTATIONS
+ *============================================================================*/
+
+/**
+ * @brief Parse command line options
+ * @details --workers <n>                   Worker processes (default: one
+ *                                          per hardware thread)
+ *          --csv <path>                    Write one line per variant
+ *          --known-findings                Fail only on outcomes worse than
+ *                                          Campaign_DefaultFindings
+ */
+static void Campaign_ParseArguments(int argc, char* argv[]) {
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if ((std::strcmp(argv[i], "--workers") == 0) && ((i + 1) < argc)) {
+            Campaign_NumWorkers = static_cast<uint32_t>(std::strtoul(argv[++i], NULL_PTR, 10));
+        } else if ((std::strcmp(argv[i], "--csv") == 0) && ((i + 1) < argc)) {
+            Campaign_CsvPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--known-findings") == 0) {
+            Campaign_KnownFindings = TRUE;
+        } else {
+            std::cout << "Ignoring unknown option: " << argv[i] << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Print the outcome per fault model
+ * @return TRUE if no variant reached the safe state after the FTTI
+ */
+static boolean Campaign_PrintSummary(const std::vector<Campaign_ResultType>& results) {
+    Campaign_SummaryType summary[CAMPAIGN_NUM_FAULTS];
+    const Campaign_ResultType* worst = NULL_PTR;
+    uint32_t late = 0U;
+    uint32_t i;
+
+    (void)std::memset(summary, 0, sizeof(summary));
+    for (i = 0U; i < CAMPAIGN_NUM_FAULTS; i++) {
+        summary[i].MinResponseMs = UINT32_MAX;
+        summary[i].ShortestDetectedMs = UINT32_MAX;
+    }
+
+    for (const Campaign_ResultType& result : results) {
+        Campaign_SummaryType* entry = &summary[result.Fault];
+
+        entry->Variants++;
+        if (result.Outcome == CAMPAIGN_OUTCOME_NOT_DETECTED) {
+            entry->NotDetected++;
+            continue;
+        }
+
+        if (result.Outcome == CAMPAIGN_OUTCOME_IN_FTTI) {
+            entry->InFtti++;
+        } else {
+            entry->Late++;
+            late++;
+        }
+        if ((worst == NULL_PTR) || (result.ResponseMs > worst->ResponseMs)) {
+            worst = &result;
+        }
+        entry->MinResponseMs = (result.ResponseMs < entry->MinResponseMs) ?
+                               result.ResponseMs : entry->MinResponseMs;
+        entry->MaxResponseMs = (result.ResponseMs > entry->MaxResponseMs) ?
+                               result.ResponseMs : entry->MaxResponseMs;
+        entry->SumResponseMs += result.ResponseMs;
+        entry->ShortestDetectedMs = (result.DurationMs < entry->ShortestDetectedMs) ?
+                                    result.DurationMs : entry->ShortestDetectedMs;
+    }
+
+    std::printf("%-18s %8s %8s %8s %8s %22s %12s\n", "Fault", "Variants", "InFTTI",
+                "Late", "NoSafe", "Response min/avg/max", "Detected >=");
+    for (i = 0U; i < CAMPAIGN_NUM_FAULTS; i++) {
+        const Campaign_SummaryType* entry = &summary[i];
+        const uint32_t detected = entry->InFtti + entry->Late;
+
+        if (entry->Variants == 0U) {
+            continue;
+        }
+        std::printf("%-18s %8u %8u %8u %8u", Campaign_GetFaultName(static_cast<Campaign_FaultType>(i)),
+                    entry->Variants, entry->InFtti, entry->Late, entry->NotDetected);
+        if (detected > 0U) {
+            std::printf(" %8u/%5u/%5u ms %9u ms\n", entry->MinResponseMs,
+                        static_cast<uint32_t>(entry->SumResponseMs / detected),
+                        entry->MaxResponseMs, entry->ShortestDetectedMs);
+        } else {
+            std::printf(" %22s %12s\n", "-", "-");
+        }
+    }
+    std::printf("\n");
+
+    if (worst != NULL_PTR) {
+        std::printf("Slowest reaction: %s at +%ums for %ums -> safe state after %ums (reason %u)\n",
+                    Campaign_GetFaultName(worst->Fault), worst->InjectionMs, worst->DurationMs,
+                    worst->ResponseMs, static_cast<uint32_t>(worst->Reason));
+    }
+    std::printf("FTTI compliance (%ums): %s, %u of %u variants late\n", FLM_FTTI_MS,
+                (late == 0U) ? "PASS" : "FAIL", late, static_cast<uint32_t>(results.size()));
+
+    return (late == 0U) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Check every fault model against its known finding
+ * @return TRUE if no fault model is worse than its known finding
+ */
+static boolean Campaign_CheckKnownFindings(const std::vector<Campaign_ResultType>& results) {
+    uint32_t regressions = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < CAMPAIGN_NUM_FAULTS; i++) {
+        const Campaign_FaultType fault = static_cast<Campaign_FaultType>(i);
+
+        if (Campaign_CheckFinding(results.data(), static_cast<uint32_t>(results.size()), fault,
+                                  &Campaign_DefaultFindings[i]) != E_OK) {
+            std::printf("Regression: %s is worse than its known finding\n",
+                        Campaign_GetFaultName(fault));
+            regressions++;
+        }
+    }
+    std::printf("Known findings: %s, %u of %u fault models regressed\n",
+                (regressions == 0U) ? "PASS" : "FAIL", regressions, CAMPAIGN_NUM_FAULTS);
+
+    return (regressions == 0U) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Write one line per variant
+ */
+static Std_ReturnType Campaign_WriteCsv(const std::vector<Campaign_ResultType>& results) {
+    static const char* const outcomes[] = { "in_ftti", "late", "not_detected" };
+    FILE* file = std::fopen(Campaign_CsvPath, "w");
+
+    if (file == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    (void)std::fprintf(file, "fault,injection_ms,duration_ms,outcome,response_ms,reason\n");
+    for (const Campaign_ResultType& result : results) {
+        (void)std::fprintf(file, "%s,%u,%u,%s,%u,%u\n", Campaign_GetFaultName(result.Fault),
+                           result.InjectionMs, result.DurationMs, outcomes[result.Outcome],
+                           result.ResponseMs, static_cast<uint32_t>(result.Reason));
+    }
+
+    return (std::fclose(file) == 0) ? E_OK : E_NOT_OK;
+}
@@ -1,7 +1,8 @@
 /**
  * @file main.cpp
  * @brief FLM Application Entry Point and Task Scheduler
- * @details Main entry point implementing simplified RTOS scheduling
+ * @details Main entry point: system tick driving the OS tasks and the
+ *          simulated sensors
  * @version 1.0.0
  * @date 2024
  *
@@ -12,10 +13,13 @@
  * INCLUDES
  *============================================================================*/
 #include <iostream>
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <cstdint>
 #include <csignal>
+#include <cstdlib>
+#include <cstring>
 
 /* Standard AUTOSAR types */
 #include "Std_Types.h"
@@ -25,13 +29,22 @@
 #include "MCAL/Adc/Adc.h"
 #include "MCAL/Dio/Dio.h"
 #include "MCAL/Can/Can.h"
+#include "MCAL/Wdg/Wdg.h"
+#include "MCAL/Pwm/Pwm.h"
 
 /* BSW */
 #include "BSW/E2E/E2E_P01.h"
 #include "BSW/WdgM/WdgM.h"
+#include "BSW/WdgM/WdgM_Profiler.h"
 #include "BSW/Dem/Dem.h"
 #include "BSW/Com/Com.h"
 #include "BSW/BswM/BswM.h"
+#include "BSW/EcuM/EcuM.h"
+#include "BSW/Os/Os.h"
+#include "BSW/Trace/Trace.h"
+#include "BSW/Metrics/Metrics.h"
+#include "BSW/Metrics/Metrics_Export.h"
+#include "BSW/Log/Log.h"
 
 /* Application SWCs */
 #include "Application/SwitchEvent/SwitchEvent.h"
@@ -40,14 +53,22 @@
 #include "Application/Headlight/Headlight.h"
 #include "Application/SafetyMonitor/SafetyMonitor.h"
 
+/* RTE */
+#include "Rte/Rte_Tasks.h"
+
+/* Simulation */
+#include "Sim/Stimulus/Stimulus.h"
+#include "Sim/Lamp/Lamp.h"
+#include "Sim/Replay/Replay.h"
+
 /*============================================================================*
  * LOCAL DEFINITIONS
  *============================================================================*/
 
-/** @brief Maximum simulation ticks (0 = infinite) */
+/** @brief Default simulation ticks (0 = infinite, --ticks overrides) */
 #define MAX_SIMULATION_TICKS    1000U
 
-/** @brief Enable real-time simulation */
+/** @brief Enable real-time simulation (--fast runs at simulation speed) */
 #define REAL_TIME_SIMULATION    1
 
 /*============================================================================*
@@ -57,22 +78,110 @@
 /** @brief System running flag */
 static volatile boolean System_Running = TRUE;
 
-/** @brief Current tick counter (ms) */
-static uint32_t System_TickMs = 0U;
+/** @brief Runnable profile export requested (SIGUSR1) */
+static volatile boolean System_ProfileRequested = FALSE;
+
+/** @brief Shutdown requested (SIGINT), reported by the scheduler */
+static volatile boolean System_ShutdownRequested = FALSE;
+
+/** @brief Current tick counter (ms), also read by the FLM hook on the 10ms
+ *         task thread */
+static std::atomic<uint32_t> System_TickMs(0U);
+
+/** @brief Watchdog backend (--wdg-device [path]) */
+static Wdg_BackendIdType System_WdgBackend = WDG_BACKEND_SOFTWARE;
+static const char* System_WdgDevicePath = WDG_LINUX_DEVICE_PATH;
+
+/** @brief DIO backend (--dio-gpiochip [path]) */
+static Dio_BackendIdType System_DioBackend = DIO_BACKEND_SIMULATION;
+static const char* System_DioChipPath = DIO_GPIO_CHIP_PATH;
+
+/** @brief ADC backend (--adc-iio [path] [--adc-iio-trigger <name>]) */
+static Adc_BackendIdType System_AdcBackend = ADC_BACKEND_SIMULATION;
+static const char* System_AdcIioPath = ADC_IIO_DEVICE_PATH;
+static const char* System_AdcIioTrigger = NULL_PTR;
+
+/** @brief FLM_MainFunction-to-pin latency on the GPIO backend (ns) */
+static uint64_t System_PinLatencyMinNs = UINT64_MAX;
+static uint64_t System_PinLatencyMaxNs = 0U;
+static uint64_t System_PinLatencySumNs = 0U;
+static uint32_t System_PinLatencyCount = 0U;
+
+/** @brief GPIO statistics and time at the start of FLM_MainFunction */
+static Dio_GpioStatsType System_FlmDioStats;
+static uint64_t System_FlmStartNs = 0U;
+
+/** @brief Tick at which FLM stops running (--inject-supervision-fault <ms>) */
+static uint32_t System_FaultInjectionMs = 0U;
+static boolean System_FaultInjectionEnabled = FALSE;
+
+/** @brief Concurrent init items at startup (--parallel-init <n>) */
+static uint8_t System_MaxParallelInit = ECUM_DEFAULT_PARALLEL_INIT;
+
+/** @brief Sensor stimulus (--scenario <name>, --stimulus-csv <path>,
+ *         --random-ambient <seed>) */
+static const char* System_ScenarioName = STIMULUS_DEFAULT_SCENARIO;
+static const char* System_StimulusCsvPath = NULL_PTR;
+static uint32_t System_RandomAmbientSeed = 0U;
+static boolean System_RandomAmbientEnabled = FALSE;
+
+/** @brief Sleep for each tick (--fast disables) */
+static boolean System_RealTime = (REAL_TIME_SIMULATION != 0) ? TRUE : FALSE;
+
+/** @brief Simulation length (--ticks <n>, 0 = infinite) */
+static uint32_t System_MaxTicks = MAX_SIMULATION_TICKS;
+
+/** @brief Ticks dropped after the scheduler fell behind the wall clock */
+static uint32_t System_LostTicks = 0U;
+
+/** @brief Task mapping (--multicore [core5,core10,core20]) */
+static Os_MappingType System_TaskMapping = OS_MAPPING_SINGLE_THREAD;
+static int16_t System_TaskCores[OS_NUM_FLM_TASKS] = {
+    OS_TASK_5MS_CORE, OS_TASK_10MS_CORE, OS_TASK_20MS_CORE
+};
+
+/** @brief Record/replay log (--record <path>, --replay <path>) */
+static const char* System_RecordPath = NULL_PTR;
+static const char* System_ReplayPath = NULL_PTR;
+static Replay_ModeType System_ReplayMode = REPLAY_MODE_OFF;
+
+/** @brief Timeline of the run (--trace <path>) */
+static const char* System_TracePath = NULL_PTR;
+
+/** @brief Metrics export (--metrics-port <port>, --metrics-file <path>) */
+static Metrics_ExportConfigType System_MetricsExport = {
+    FALSE, METRICS_DEFAULT_HTTP_PORT, NULL_PTR, METRICS_DEFAULT_DUMP_PERIOD_MS
+};
+
+/** @brief Wall clock at scheduler start (replay speed) */
+static std::chrono::steady_clock::time_point System_StartTime;
+
+/** @brief Process exit status (replay mismatches fail the run) */
+static int System_ExitStatus = EXIT_SUCCESS;
+
+/** @brief Restart-to-first-valid-frame measurement pending */
+static boolean System_RecoveryPending = FALSE;
+static Wdg_ResetInfoType System_PreviousReset;
 
 /*============================================================================*
  * LOCAL FUNCTION PROTOTYPES
  *============================================================================*/
 
+static void System_ParseArguments(int argc, char* argv[]);
+static void System_ParseCores(const char* list);
 static void System_Init(void);
 static void System_DeInit(void);
 static void System_RunScheduler(void);
-static void System_Task_5ms(void);
 static void System_Task_10ms(void);
-static void System_Task_20ms(void);
+static boolean System_FlmHook(void);
+static void System_InitStimulus(void);
 static void System_SimulateInputs(void);
 static void System_PrintStatus(void);
+static void System_CheckRecovery(void);
+static void System_PrintPinLatency(void);
+static void System_PrintReplay(void);
 static void System_SignalHandler(int signal);
+static void System_ProfileSignalHandler(int signal);
 
 /*============================================================================*
  * MAIN FUNCTION
@@ -82,9 +191,6 @@ static void System_SignalHandler(int signal);
  * @brief Application entry point
  */
 int main(int argc, char* argv[]) {
-    STD_UNUSED(argc);
-    STD_UNUSED(argv);
-
     std::cout << "========================================" << std::endl;
     std::cout << "AUTOSAR FLM Safety Use Case" << std::endl;
     std::cout << "Front Light Management System" << std::endl;
@@ -92,8 +198,14 @@ int main(int argc, char* argv[]) {
     std::cout << "========================================" << std::endl;
     std::cout << std::endl;
 
+    System_ParseArguments(argc, argv);
+
     /* Register signal handler for graceful shutdown */
     std::signal(SIGINT, System_SignalHandler);
+#ifdef SIGUSR1
+    /* Runnable profile on demand: kill -USR1 <pid> */
+    std::signal(SIGUSR1, System_ProfileSignalHandler);
+#endif
 
     /* Initialize system */
     System_Init();
@@ -111,126 +223,375 @@ int main(int argc, char* argv[]) {
     std::cout << std::endl;
     std::cout << "System shutdown complete." << std::endl;
 
-    return 0;
+    return System_ExitStatus;
 }
 
 /*============================================================================*
  * LOCAL FUNCTION IMPLEMENTATIONS
  *============================================================================*/
 
+/**
+ * @brief Parse command line options
+ * @details --wdg-device [path]             Use Linux watchdog device backend
+ *          --dio-gpiochip [path]           Drive DIO channels on GPIO lines
+ *                                          (channel n = line n)
+ *          --adc-iio [path]                Capture ADC channel n from the
+ *                                          IIO scan element in_voltage<n>
+ *          --adc-iio-trigger <name>        IIO trigger driving the capture
+ *          --inject-supervision-fault <ms> Stop FLM runnable at <ms> to
+ *                                          measure watchdog recovery
+ *          --parallel-init <n>             Initialize up to <n> independent
+ *                                          modules concurrently
+ *          --scenario <name>               Ambient light scenario
+ *          --stimulus-csv <path>           Recorded ambient light trace
+ *          --random-ambient <seed>         Random ambient light scenario
+ *          --multicore [c5,c10,c20]        Run the 5/10/20ms tasks on own
+ *                                          threads pinned to these cores
+ *          --record <path>                 Record inputs and outputs
+ *          --replay <path>                 Replay a recording at simulation
+ *                                          speed and compare the outputs
+ *          --trace <path>                  Write a Chrome trace / Perfetto
+ *                                          timeline of the run
+ *          --metrics-port <port>           Serve Prometheus metrics on
+ *                                          127.0.0.1:<port>/metrics
+ *          --metrics-file <path>           Rewrite the metrics to <path>
+ *                                          every second
+ *          --ticks <n>                     Stop after <n> ticks (0 = run
+ *                                          until Ctrl+C)
+ *          --fast                          Run at simulation speed
+ */
+static void System_ParseArguments(int argc, char* argv[]) {
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--wdg-device") == 0) {
+            System_WdgBackend = WDG_BACKEND_LINUX_DEVICE;
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-')) {
+                System_WdgDevicePath = argv[++i];
+            }
+        } else if (std::strcmp(argv[i], "--dio-gpiochip") == 0) {
+            System_DioBackend = DIO_BACKEND_GPIO_CDEV;
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-')) {
+                System_DioChipPath = argv[++i];
+            }
+        } else if (std::strcmp(argv[i], "--adc-iio") == 0) {
+            System_AdcBackend = ADC_BACKEND_IIO;
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-')) {
+                System_AdcIioPath = argv[++i];
+            }
+        } else if ((std::strcmp(argv[i], "--adc-iio-trigger") == 0) && ((i + 1) < argc)) {
+            System_AdcIioTrigger = argv[++i];
+        } else if ((std::strcmp(argv[i], "--inject-supervision-fault") == 0) && ((i + 1) < argc)) {
+            System_FaultInjectionMs = static_cast<uint32_t>(std::strtoul(argv[++i], NULL_PTR, 10));
+            System_FaultInjectionEnabled = TRUE;
+        } else if ((std::strcmp(argv[i], "--parallel-init") == 0) && ((i + 1) < argc)) {
+            System_MaxParallelInit = static_cast<uint8_t>(std::strtoul(argv[++i], NULL_PTR, 10));
+        } else if ((std::strcmp(argv[i], "--scenario") == 0) && ((i + 1) < argc)) {
+            System_ScenarioName = argv[++i];
+        } else if ((std::strcmp(argv[i], "--stimulus-csv") == 0) && ((i + 1) < argc)) {
+            System_StimulusCsvPath = argv[++i];
+        } else if ((std::strcmp(argv[i], "--random-ambient") == 0) && ((i + 1) < argc)) {
+            System_RandomAmbientSeed = static_cast<uint32_t>(std::strtoul(argv[++i], NULL_PTR, 10));
+            System_RandomAmbientEnabled = TRUE;
+        } else if (std::strcmp(argv[i], "--multicore") == 0) {
+            System_TaskMapping = OS_MAPPING_MULTI_CORE;
+            /* A core list may start with "-" (unpinned): tell it from the
+             * next option by its characters */
+            if (((i + 1) < argc) && (argv[i + 1][0] != '\0') &&
+                (std::strspn(argv[i + 1], "0123456789-,") == std::strlen(argv[i + 1])) &&
+                (std::strncmp(argv[i + 1], "--", 2U) != 0)) {
+                System_ParseCores(argv[++i]);
+            }
+        } else if ((std::strcmp(argv[i], "--record") == 0) && ((i + 1) < argc)) {
+            System_RecordPath = argv[++i];
+        } else if ((std::strcmp(argv[i], "--replay") == 0) && ((i + 1) < argc)) {
+            System_ReplayPath = argv[++i];
+            System_RealTime = FALSE;
+        } else if ((std::strcmp(argv[i], "--trace") == 0) && ((i + 1) < argc)) {
+            System_TracePath = argv[++i];
+        } else if ((std::strcmp(argv[i], "--metrics-port") == 0) && ((i + 1) < argc)) {
+            System_MetricsExport.HttpPort = static_cast<uint16_t>(std::strtoul(argv[++i], NULL_PTR, 10));
+            System_MetricsExport.HttpEnabled = TRUE;
+        } else if ((std::strcmp(argv[i], "--metrics-file") == 0) && ((i + 1) < argc)) {
+            System_MetricsExport.DumpPath = argv[++i];
+        } else if ((std::strcmp(argv[i], "--ticks") == 0) && ((i + 1) < argc)) {
+            System_MaxTicks = static_cast<uint32_t>(std::strtoul(argv[++i], NULL_PTR, 10));
+        } else if (std::strcmp(argv[i], "--fast") == 0) {
+            System_RealTime = FALSE;
+        } else {
+            std::cout << "Ignoring unknown option: " << argv[i] << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Parse a comma separated core list for the 5/10/20ms tasks
+ * @details Missing entries keep their default core, "-" leaves a task
+ *          unpinned
+ */
+static void System_ParseCores(const char* list) {
+    const char* cursor = list;
+    char* end;
+    uint8_t task;
+
+    for (task = 0U; (task < OS_NUM_FLM_TASKS) && (*cursor != '\0'); task++) {
+        if (*cursor == '-') {
+            System_TaskCores[task] = OS_CORE_ANY;
+            cursor++;
+        } else {
+            System_TaskCores[task] = static_cast<int16_t>(std::strtol(cursor, &end, 10));
+            cursor = end;
+        }
+        if (*cursor != ',') {
+            break;
+        }
+        cursor++;
+    }
+}
+
 /**
  * @brief Initialize all system components
+ * @details The watchdog driver is started ahead of EcuM so that a reset of
+ *          the previous run is known before any other module comes up
  */
 static void System_Init(void) {
-    /* ADC configuration (stub) */
-    static const Adc_ConfigType adcConfig = {
-        .NumGroups = 2,
-        .Groups = NULL_PTR,
-        .NumChannels = 2,
-        .Channels = NULL_PTR
+    /* EcuM configuration */
+    const EcuM_ConfigType ecumConfig = { System_MaxParallelInit };
+
+    /* OS tasks in priority order, deadline = period */
+    static Os_TaskConfigType osTasks[OS_NUM_FLM_TASKS] = {
+        { "Task_5ms",  Rte_Task_5ms,     OS_TASK_5MS_PERIOD_MS,  0U, OS_TASK_5MS_PRIORITY,  OS_CORE_ANY },
+        { "Task_10ms", System_Task_10ms, OS_TASK_10MS_PERIOD_MS, 0U, OS_TASK_10MS_PRIORITY, OS_CORE_ANY },
+        { "Task_20ms", Rte_Task_20ms,    OS_TASK_20MS_PERIOD_MS, 0U, OS_TASK_20MS_PRIORITY, OS_CORE_ANY }
     };
-
-    /* CAN configuration (stub) */
-    static const Can_ConfigType canConfig = {
-        .NumControllers = 1,
-        .Controllers = NULL_PTR
+    static Os_ConfigType osConfig = { OS_MAPPING_SINGLE_THREAD, osTasks, OS_NUM_FLM_TASKS };
+    uint8_t task;
+
+    /* Watchdog driver configuration */
+    Wdg_ConfigType wdgConfig = {
+        /* Backend, TimeoutMs, WindowMs,
+           DevicePath, ResetStampPath, ResetCallback */
+        System_WdgBackend, WDG_DEFAULT_TIMEOUT_MS, WDG_DEFAULT_WINDOW_MS,
+        System_WdgDevicePath, WDG_RESET_STAMP_PATH, NULL_PTR
     };
 
-    /* WdgM configuration */
-    static const WdgM_ConfigType wdgmConfig = {
-        .numSupervisedEntities = WDGM_NUM_SUPERVISED_ENTITIES,
-        .supervisionCycleMs = WDGM_SUPERVISION_CYCLE_MS,
-        .failedRefCycles = WDGM_FAILED_REFERENCE_CYCLES
-    };
+    /* Ticks faster than the wall clock would always hit the window */
+    if (!System_RealTime) {
+        wdgConfig.WindowMs = 0U;
+    }
 
-    /* BswM configuration (stub) */
-    static const BswM_ConfigType bswmConfig = {
-        .numModes = 5
-    };
+    Wdg_Init(&wdgConfig);
+
+    /* Started by a watchdog reset: measure time to first valid frame */
+    if (Wdg_GetPreviousReset(&System_PreviousReset) == E_OK) {
+        std::cout << "Restarted by watchdog (reason "
+                  << static_cast<int>(System_PreviousReset.Reason) << ")" << std::endl;
+        System_RecoveryPending = TRUE;
+        /* The injected fault caused this restart, do not repeat it */
+        System_FaultInjectionEnabled = FALSE;
+    }
 
-    std::cout << "Initializing MCAL..." << std::endl;
+    /* Counters from the first main function on */
+    (void)Metrics_Init();
+    if (System_MetricsExport.HttpEnabled || (System_MetricsExport.DumpPath != NULL_PTR)) {
+        if (Metrics_StartExport(&System_MetricsExport) != E_OK) {
+            std::cout << "Cannot export metrics on port " << System_MetricsExport.HttpPort << std::endl;
+        } else if (System_MetricsExport.HttpEnabled) {
+            std::cout << "Metrics at http://127.0.0.1:" << Metrics_GetHttpPort() << "/metrics" << std::endl;
+        }
+    }
 
-    /* Initialize MCAL */
-    Adc_Init(&adcConfig);
-    Dio_Init();
-    Can_Init(&canConfig);
+    /* Timeline from the first main function on */
+    if (System_TracePath != NULL_PTR) {
+        Trace_Init();
+        Trace_SetThreadName("Scheduler");
+        if (Trace_Start(System_TracePath) != E_OK) {
+            std::cout << "Cannot write trace " << System_TracePath << std::endl;
+        }
+    }
 
-    std::cout << "Initializing BSW..." << std::endl;
+    std::cout << "Initializing MCAL, BSW and Application SWCs..." << std::endl;
 
-    /* Initialize BSW */
-    Dem_Init();
-    WdgM_Init(&wdgmConfig);
-    Com_Init();
-    BswM_Init(&bswmConfig);
+    /* Sensors and output stages run in virtual time, starting with the first tick */
+    Adc_SimSetTimeUs(0U);
+    Pwm_SimSetTimeUs(0U);
 
-    /* Start CAN controller */
-    Can_SetControllerMode(0, CAN_MODE_START);
+    /* MCAL, BSW and SWCs in dependency order; CAN controller and I-PDU
+     * groups are started by the BswM rules */
+    if (EcuM_Init(&ecumConfig, ECUM_STARTUP_COLD) != E_OK) {
+        std::cout << "EcuM startup failed" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+    EcuM_PrintStartupProfile(stdout);
+
+    /* Sensors from an IIO device, fall back to simulation without it */
+    if (System_AdcBackend == ADC_BACKEND_IIO) {
+        const Adc_BackendConfigType adcConfig = {
+            /* Backend, DevicePath, DeviceNode,
+               TriggerName, ScanElements, BufferLength */
+            ADC_BACKEND_IIO, System_AdcIioPath, NULL_PTR,
+            System_AdcIioTrigger, NULL_PTR, ADC_IIO_BUFFER_LENGTH
+        };
+
+        if (Adc_SetBackend(&adcConfig) != E_OK) {
+            std::cout << "IIO device " << System_AdcIioPath
+                      << " not available, using simulated ADC" << std::endl;
+            System_AdcBackend = ADC_BACKEND_SIMULATION;
+        }
+    }
 
-    std::cout << "Initializing Application SWCs..." << std::endl;
+    /* Outputs on GPIO lines, fall back to simulation without the chip */
+    if (System_DioBackend == DIO_BACKEND_GPIO_CDEV) {
+        const Dio_ConfigType dioConfig = {
+            /* Backend, ChipPath, LineOffsets */
+            DIO_BACKEND_GPIO_CDEV, System_DioChipPath, NULL_PTR
+        };
+
+        if (Dio_SetBackend(&dioConfig) != E_OK) {
+            std::cout << "GPIO chip " << System_DioChipPath
+                      << " not available, using simulated DIO" << std::endl;
+            System_DioBackend = DIO_BACKEND_SIMULATION;
+        }
+    }
 
-    /* Initialize Application SWCs */
-    SwitchEvent_Init();
-    LightRequest_Init();
-    FLM_Init();
-    Headlight_Init();
-    SafetyMonitor_Init();
+    /* Arm watchdog, fall back to the software watchdog without a device */
+    if (Wdg_SetMode(WDGIF_FAST_MODE) != E_OK) {
+        std::cout << "Watchdog device " << System_WdgDevicePath
+                  << " not available, using software watchdog" << std::endl;
+        wdgConfig.Backend = WDG_BACKEND_SOFTWARE;
+        Wdg_Init(&wdgConfig);
+        (void)Wdg_SetMode(WDGIF_FAST_MODE);
+    }
 
     /* Set initial simulation values */
     Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT, 2000U);  /* Mid-range ambient */
     Adc_SimSetValue(FLM_ADC_CHANNEL_CURRENT, 0U);     /* No current (lights off) */
+    System_InitStimulus();
+
+    /* Start the OS tasks */
+    Rte_SimSetFlmHook(System_FlmHook);
+    osConfig.Mapping = System_TaskMapping;
+    if (System_TaskMapping == OS_MAPPING_MULTI_CORE) {
+        for (task = 0U; task < OS_NUM_FLM_TASKS; task++) {
+            osTasks[task].CoreId = System_TaskCores[task];
+        }
+    }
+    if (Os_Init(&osConfig) != E_OK) {
+        std::cout << "OS startup failed" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
 
     std::cout << "Initialization complete." << std::endl;
+
+    /* Scheduler messages go through the asynchronous logger */
+    Log_Init();
+    (void)Log_Start(stdout);
 }
 
 /**
  * @brief De-initialize all system components
  */
 static void System_DeInit(void) {
+    /* Write the pending scheduler messages before the direct output */
+    Log_Stop();
+
     std::cout << "De-initializing system..." << std::endl;
 
+    /* Task response times, then stop the task threads */
+    Os_PrintTaskStats(stdout);
+    if (System_LostTicks > 0U) {
+        std::cout << "Scheduler: " << System_LostTicks
+                  << " ticks lost behind the wall clock" << std::endl;
+    }
+    Os_DeInit();
+    Rte_SimSetFlmHook(NULL_PTR);
+
+    /* Final dump with the complete run */
+    Metrics_StopExport();
+
+    if (Trace_IsActive()) {
+        Trace_StatisticsType traceStats;
+        Trace_Stop();
+        (void)Trace_GetStatistics(&traceStats);
+        std::cout << "Trace: " << traceStats.Records << " records from "
+                  << static_cast<uint32_t>(traceStats.Threads) << " threads, "
+                  << traceStats.Dropped << " dropped -> " << System_TracePath << std::endl;
+    }
+
+    System_PrintReplay();
+    Replay_Stop();
+
+    /* Export runnable execution time / jitter profile */
+    WdgM_Profiler_Export(stdout, FALSE);
+    System_PrintPinLatency();
+    if (System_AdcBackend == ADC_BACKEND_IIO) {
+        Adc_IioStatsType adcStats;
+        Adc_GetIioStats(&adcStats);
+        std::cout << "ADC IIO: " << adcStats.Scans << " scans in "
+                  << adcStats.ReadCalls << " reads" << std::endl;
+    }
+
     /* De-initialize in reverse order */
-    BswM_Deinit();
-    WdgM_DeInit();
-    Dem_Shutdown();
-    Com_DeInit();
-    Can_DeInit();
-    Adc_DeInit();
+    Lamp_DeInit();
+    Stimulus_DeInit();
+    EcuM_GoDown(ECUM_STARTUP_COLD);
+    Wdg_DeInit();
 }
 
 /**
  * @brief Main scheduler loop
  */
 static void System_RunScheduler(void) {
+    static const char* const reasonNames[] = {
+        "NONE", "E2E_FAILURE", "WDGM_FAILURE", "MULTI_FAULT", "TIMEOUT", "MANUAL"
+    };
     uint32_t tickCount = 0U;
+    boolean safeStateReported = FALSE;
+    SafeStateReason reason;
+    std::chrono::steady_clock::time_point nextTick;
+    std::chrono::steady_clock::time_point now;
+    uint32_t lostTicks;
+
+    System_StartTime = std::chrono::steady_clock::now();
+    nextTick = System_StartTime;
 
     while (System_Running) {
         /* Simulate inputs (for demonstration) */
         System_SimulateInputs();
 
-        /* 5ms tasks */
-        if ((System_TickMs % 5U) == 0U) {
-            System_Task_5ms();
-        }
+        /* ADC conversion end handling (streaming groups, notifications) */
+        Adc_MainFunction();
 
-        /* 10ms tasks */
-        if ((System_TickMs % 10U) == 0U) {
-            System_Task_10ms();
-        }
+        /* 5ms, 10ms and 20ms tasks */
+        Os_Tick(System_TickMs);
 
-        /* 20ms tasks */
-        if ((System_TickMs % 20U) == 0U) {
-            System_Task_20ms();
-        }
+        /* Record or compare the outputs of this tick */
+        Replay_MainFunctionOutputs(static_cast<uint64_t>(System_TickMs) * 1000U);
 
         /* Print status every 100ms */
         if ((System_TickMs % 100U) == 0U) {
             System_PrintStatus();
         }
 
-        /* Check for safe state */
-        if (SafetyMonitor_IsInSafeState()) {
-            std::cout << "*** SAFE STATE ENTERED ***" << std::endl;
-            std::cout << "Reason: " << static_cast<int>(SafetyMonitor_GetSafeStateReason()) << std::endl;
+        /* Restart-to-first-valid-frame after watchdog reset */
+        if (System_RecoveryPending) {
+            System_CheckRecovery();
+        }
+
+        /* Export runnable profile on demand */
+        if (System_ProfileRequested) {
+            System_ProfileRequested = FALSE;
+            Log_Flush();
+            WdgM_Profiler_Export(stdout, FALSE);
+        }
+
+        /* Report safe state entry once */
+        if (SafetyMonitor_IsInSafeState() && !safeStateReported) {
+            reason = SafetyMonitor_GetSafeStateReason();
+            LOG_WARNING("*** SAFE STATE ENTERED ***");
+            LOG_WARNING("Reason: %d (%s)", static_cast<int>(reason),
+                        (reason < (sizeof(reasonNames) / sizeof(reasonNames[0]))) ? reasonNames[reason] : "?");
+            safeStateReported = TRUE;
             /* Continue running in safe state for demonstration */
         }
 
@@ -239,67 +600,68 @@ static void System_RunScheduler(void) {
         tickCount++;
 
         /* Check simulation limit */
-        if ((MAX_SIMULATION_TICKS > 0U) && (tickCount >= MAX_SIMULATION_TICKS)) {
-            std::cout << "Simulation limit reached." << std::endl;
+        if ((System_MaxTicks > 0U) && (tickCount >= System_MaxTicks)) {
+            LOG_INFO("Simulation limit reached.");
+            System_Running = FALSE;
+        }
+        if ((System_ReplayMode == REPLAY_MODE_REPLAY) && Replay_IsFinished()) {
+            LOG_INFO("End of recording reached.");
             System_Running = FALSE;
         }
 
-#if REAL_TIME_SIMULATION
-        /* Sleep for 1ms to simulate real-time */
-        std::this_thread::sleep_for(std::chrono::milliseconds(FLM_SYSTEM_TICK_MS));
-#endif
+        /* Sleep until the next 1ms tick to simulate real-time (no drift).
+         * After a stall the missed ticks are dropped: catching up would run
+         * the 5ms task back-to-back and trigger the watchdog inside its window.
+         * Whole ticks are dropped so that the Os releases move with the
+         * tick grid; their activations count as lost */
+        if (System_RealTime) {
+            nextTick += std::chrono::milliseconds(FLM_SYSTEM_TICK_MS);
+            now = std::chrono::steady_clock::now();
+            if (now > nextTick) {
+                lostTicks = static_cast<uint32_t>((now - nextTick) /
+                                                  std::chrono::milliseconds(FLM_SYSTEM_TICK_MS));
+                System_LostTicks += lostTicks;
+                Os_SkipTicks(System_TickMs, lostTicks);
+                nextTick += std::chrono::milliseconds(lostTicks * FLM_SYSTEM_TICK_MS);
+            }
+            std::this_thread::sleep_until(nextTick);
+        }
     }
-}
-
-/**
- * @brief 5ms task
- */
-static void System_Task_5ms(void) {
-    /* Safety Monitor - highest priority */
-    SafetyMonitor_MainFunction();
-
-    /* Watchdog Manager */
-    WdgM_MainFunction();
 
-    /* BSW Mode Manager */
-    BswM_MainFunction();
+    if (System_ShutdownRequested) {
+        LOG_INFO("\nReceived shutdown signal...");
+    }
 }
 
 /**
- * @brief 10ms task
+ * @brief 10ms task with the FLM_MainFunction-to-pin latency measurement
  */
 static void System_Task_10ms(void) {
-    /* COM RX processing */
-    Com_MainFunctionRx();
-
-    /* CAN RX processing */
-    Can_MainFunction_Read();
-
-    /* SwitchEvent - CAN light switch processing */
-    SwitchEvent_MainFunction();
-
-    /* FLM Application - main control logic */
-    FLM_MainFunction();
-
-    /* Headlight - output control */
-    Headlight_MainFunction();
-
-    /* CAN TX processing */
-    Can_MainFunction_Write();
-
-    /* COM TX processing */
-    Com_MainFunctionTx();
-
-    /* DEM main function */
-    Dem_MainFunction();
+    Dio_GpioStatsType dioAfter;
+
+    Rte_Task_10ms();
+
+    /* Command reached the pins in this task: FLM_MainFunction-to-pin latency */
+    Dio_GetGpioStats(&dioAfter);
+    if (dioAfter.SetValuesCalls != System_FlmDioStats.SetValuesCalls) {
+        const uint64_t latencyNs = dioAfter.LastSetValuesNs - System_FlmStartNs;
+        System_PinLatencyMinNs = (latencyNs < System_PinLatencyMinNs) ? latencyNs : System_PinLatencyMinNs;
+        System_PinLatencyMaxNs = (latencyNs > System_PinLatencyMaxNs) ? latencyNs : System_PinLatencyMaxNs;
+        System_PinLatencySumNs += latencyNs;
+        System_PinLatencyCount++;
+    }
 }
 
 /**
- * @brief 20ms task
+ * @brief FLM runnable hook: latency start, stall by fault injection
+ * @return TRUE to run FLM_MainFunction
  */
-static void System_Task_20ms(void) {
-    /* LightRequest - ambient light sensor */
-    LightRequest_MainFunction();
+static boolean System_FlmHook(void) {
+    Dio_GetGpioStats(&System_FlmDioStats);
+    System_FlmStartNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+
+    return (System_FaultInjectionEnabled && (System_TickMs >= System_FaultInjectionMs)) ? FALSE : TRUE;
 }
 
 /**
@@ -312,6 +674,17 @@ static void System_SimulateInputs(void) {
     E2E_P01ProtectStateType e2eProtectState;
     uint8_t canMessage[4] = {0};
 
+    /* Recorded inputs replace the generated ones. Frames are received under
+     * the COM stack lock: jobs of the previous tick may still be running */
+    Os_GetSpinlock(OS_SPINLOCK_COMSTACK);
+    Replay_MainFunctionInputs(static_cast<uint64_t>(System_TickMs) * 1000U);
+    Os_ReleaseSpinlock(OS_SPINLOCK_COMSTACK);
+    if (System_ReplayMode == REPLAY_MODE_REPLAY) {
+        Adc_SimSetTimeUs(static_cast<uint64_t>(System_TickMs) * 1000U);
+        Pwm_SimSetTimeUs(static_cast<uint64_t>(System_TickMs) * 1000U);
+        return;
+    }
+
     /* Configure E2E for simulation */
     e2eConfig.DataLength = FLM_E2E_LIGHTSWITCH_DATA_LENGTH;
     e2eConfig.DataID = FLM_E2E_LIGHTSWITCH_DATA_ID;
@@ -333,7 +706,9 @@ static void System_SimulateInputs(void) {
         PduInfoType pduInfo;
         pduInfo.SduDataPtr = canMessage;
         pduInfo.SduLength = 4U;
+        Os_GetSpinlock(OS_SPINLOCK_COMSTACK);
         Com_RxIndication(COM_IPDU_LIGHTSWITCH_RX, &pduInfo);
+        Os_ReleaseSpinlock(OS_SPINLOCK_COMSTACK);
 
         e2eCounter++;
         if (e2eCounter > 14U) {
@@ -341,26 +716,69 @@ static void System_SimulateInputs(void) {
         }
     }
 
-    /* Simulate ambient light changes */
-    if ((simCounter % 100U) == 0U) {
-        /* Vary ambient light between 500 and 2500 */
-        uint16_t ambient = 1500U + static_cast<uint16_t>((simCounter / 100U) % 10U) * 100U;
-        if ((simCounter / 1000U) % 2U == 1U) {
-            ambient = 500U;  /* Simulate dark condition */
+    /* Advance virtual time, sensors follow the stimulus waveforms and the
+     * current sense follows the lamp model */
+    Adc_SimSetTimeUs(static_cast<uint64_t>(System_TickMs) * 1000U);
+    Pwm_SimSetTimeUs(static_cast<uint64_t>(System_TickMs) * 1000U);
+    Stimulus_MainFunction(static_cast<uint64_t>(System_TickMs) * 1000U);
+
+    simCounter++;
+}
+
+/**
+ * @brief Load the sensor stimulus selected on the command line
+ * @details A recorded trace takes precedence over a random scenario, which
+ *          takes precedence over a named scenario; falls back to the
+ *          default scenario if loading fails. The lamp model drives the
+ *          current sense. A replay feeds the recorded sensors instead of
+ *          the stimulus, a recording starts with the first tick.
+ */
+static void System_InitStimulus(void) {
+    Std_ReturnType result;
+
+    Lamp_Init();
+
+    if (System_ReplayPath != NULL_PTR) {
+        if (Replay_StartReplay(System_ReplayPath) != E_OK) {
+            std::cout << "Recording " << System_ReplayPath << " not available" << std::endl;
+            std::exit(EXIT_FAILURE);
         }
-        Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT, ambient);
+        System_ReplayMode = REPLAY_MODE_REPLAY;
+        std::cout << "Replay: " << System_ReplayPath << std::endl;
+        return;
     }
 
-    /* Simulate headlight current feedback */
-    HeadlightCommand cmd = Headlight_GetCurrentCommand();
-    if (cmd != HEADLIGHT_CMD_OFF) {
-        /* Simulate current when lights are on */
-        Headlight_SimSetFeedbackCurrent(5000U);  /* 5A */
+    Stimulus_Init();
+
+    if (System_StimulusCsvPath != NULL_PTR) {
+        result = Stimulus_LoadCsv(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                  System_StimulusCsvPath, TRUE);
+        std::cout << "Stimulus: " << System_StimulusCsvPath;
+    } else if (System_RandomAmbientEnabled) {
+        result = Stimulus_BuildRandomAmbient(System_RandomAmbientSeed,
+                                             (System_MaxTicks > 0U) ?
+                                             (System_MaxTicks * FLM_SYSTEM_TICK_MS) :
+                                             STIMULUS_RANDOM_MAX_SEGMENT_MS);
+        std::cout << "Stimulus: random ambient, seed " << System_RandomAmbientSeed;
     } else {
-        Headlight_SimSetFeedbackCurrent(0U);
+        result = Stimulus_LoadScenario(System_ScenarioName);
+        std::cout << "Stimulus: scenario " << System_ScenarioName;
     }
 
-    simCounter++;
+    if (result != E_OK) {
+        std::cout << " not available, using scenario " << STIMULUS_DEFAULT_SCENARIO;
+        (void)Stimulus_LoadScenario(STIMULUS_DEFAULT_SCENARIO);
+    }
+    std::cout << " (" << Stimulus_GetDurationMs() << " ms)" << std::endl;
+
+    if (System_RecordPath != NULL_PTR) {
+        if (Replay_StartRecord(System_RecordPath) == E_OK) {
+            System_ReplayMode = REPLAY_MODE_RECORD;
+            std::cout << "Recording: " << System_RecordPath << std::endl;
+        } else {
+            std::cout << "Cannot create recording " << System_RecordPath << std::endl;
+        }
+    }
 }
 
 /**
@@ -373,18 +791,97 @@ static void System_PrintStatus(void) {
     HeadlightCommand headlightCmd = FLM_GetHeadlightCommand();
     SafetyStatusType safetyStatus = SafetyMonitor_GetGlobalStatus();
 
-    const char* stateNames[] = {"INIT", "NORMAL", "DEGRADED", "SAFE"};
-    const char* cmdNames[] = {"OFF", "LOW_BEAM", "HIGH_BEAM"};
-    const char* switchNames[] = {"OFF", "LOW", "HIGH", "AUTO"};
-    const char* safetyNames[] = {"OK", "WARNING", "DEGRADED", "SAFE_STATE"};
-
-    std::cout << "[" << System_TickMs << "ms] ";
-    std::cout << "State:" << stateNames[flmState] << " ";
-    std::cout << "Switch:" << (switchStatus.isValid ? switchNames[switchStatus.command] : "INVALID") << " ";
-    std::cout << "Ambient:" << (ambientLight.isValid ? std::to_string(ambientLight.adcValue) : "INVALID") << " ";
-    std::cout << "Headlight:" << cmdNames[headlightCmd] << " ";
-    std::cout << "Safety:" << safetyNames[safetyStatus];
-    std::cout << std::endl;
+    /* Static: the logger formats after this function returned */
+    static const char* const stateNames[] = {"INIT", "NORMAL", "DEGRADED", "SAFE"};
+    static const char* const cmdNames[] = {"OFF", "LOW_BEAM", "HIGH_BEAM"};
+    static const char* const switchNames[] = {"OFF", "LOW", "HIGH", "AUTO"};
+    static const char* const safetyNames[] = {"OK", "WARNING", "DEGRADED", "SAFE_STATE"};
+    const char* switchName = switchStatus.isValid ? switchNames[switchStatus.command] : "INVALID";
+
+    if (ambientLight.isValid) {
+        LOG_INFO("[%ums] State:%s Switch:%s Ambient:%u Headlight:%s Safety:%s",
+                 System_TickMs.load(), stateNames[flmState], switchName,
+                 static_cast<uint32_t>(ambientLight.adcValue), cmdNames[headlightCmd],
+                 safetyNames[safetyStatus]);
+    } else {
+        LOG_INFO("[%ums] State:%s Switch:%s Ambient:INVALID Headlight:%s Safety:%s",
+                 System_TickMs.load(), stateNames[flmState], switchName, cmdNames[headlightCmd],
+                 safetyNames[safetyStatus]);
+    }
+}
+
+/**
+ * @brief Report recovery time once the first valid light switch frame arrived
+ */
+static void System_CheckRecovery(void) {
+    LightSwitchStatus switchStatus = SwitchEvent_GetLightRequest();
+    uint64_t recoveryNs;
+
+    if (!switchStatus.isValid) {
+        return;
+    }
+
+    recoveryNs = Wdg_GetWallClockNs() - System_PreviousReset.ResetTimeNs;
+    LOG_INFO("Watchdog recovery: restart-to-first-valid-frame %g ms",
+             static_cast<double>(recoveryNs) / 1000000.0);
+    System_RecoveryPending = FALSE;
+}
+
+/**
+ * @brief Print FLM_MainFunction-to-pin latency of the GPIO backend
+ */
+static void System_PrintPinLatency(void) {
+    Dio_GpioStatsType stats;
+
+    if (System_DioBackend != DIO_BACKEND_GPIO_CDEV) {
+        return;
+    }
+
+    Dio_GetGpioStats(&stats);
+    std::cout << "DIO GPIO: " << stats.SetValuesCalls << " set / "
+              << stats.GetValuesCalls << " get ioctls" << std::endl;
+    if (System_PinLatencyCount > 0U) {
+        std::cout << "FLM_MainFunction-to-pin latency: min "
+                  << (static_cast<double>(System_PinLatencyMinNs) / 1000.0) << " us, avg "
+                  << (static_cast<double>(System_PinLatencySumNs) /
+                      (1000.0 * static_cast<double>(System_PinLatencyCount))) << " us, max "
+                  << (static_cast<double>(System_PinLatencyMaxNs) / 1000.0) << " us ("
+                  << System_PinLatencyCount << " output changes)" << std::endl;
+    }
+}
+
+/**
+ * @brief Print record/replay summary
+ * @details A replay with output mismatches fails the run
+ */
+static void System_PrintReplay(void) {
+    Replay_StatsType stats;
+    const double wallMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - System_StartTime).count();
+
+    if (System_ReplayMode == REPLAY_MODE_OFF) {
+        return;
+    }
+
+    Replay_GetStats(&stats);
+    if (System_ReplayMode == REPLAY_MODE_RECORD) {
+        std::cout << "Recorded " << (stats.DurationUs / 1000U) << " ms: "
+                  << stats.InputEvents << " inputs, " << stats.AdcBlocks << " ADC blocks, "
+                  << stats.OutputEvents << " output changes" << std::endl;
+        return;
+    }
+
+    std::cout << "Replayed " << (stats.DurationUs / 1000U) << " ms in " << wallMs << " ms ("
+              << ((wallMs > 0.0) ? (static_cast<double>(stats.DurationUs) / (1000.0 * wallMs)) : 0.0)
+              << "x real time): " << stats.InputEvents << " inputs, "
+              << stats.AdcBlocks << " ADC blocks, " << stats.OutputEvents << " output changes" << std::endl;
+    if (stats.Mismatches > 0U) {
+        std::cout << "REPLAY MISMATCH: " << stats.Mismatches << " mismatches, first at "
+                  << (stats.FirstMismatchUs / 1000U) << " ms" << std::endl;
+        System_ExitStatus = EXIT_FAILURE;
+    } else {
+        std::cout << "Replay matches the recording" << std::endl;
+    }
 }
 
 /**
@@ -392,6 +889,14 @@ static void System_PrintStatus(void) {
  */
 static void System_SignalHandler(int signal) {
     STD_UNUSED(signal);
-    std::cout << std::endl << "Received shutdown signal..." << std::endl;
+    System_ShutdownRequested = TRUE;
     System_Running = FALSE;
 }
+
+/**
+ * @brief Signal handler for on-demand profile export
+ */
+static void System_ProfileSignalHandler(int signal) {
+    STD_UNUSED(signal);
+    System_ProfileRequested = TRUE;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file Test_Util.h
+ * @brief Shared Helpers for the Unit Tests
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+/*============================================================================*
+ * INCLUDES
+ *============================================================================*/
+#include <gtest/gtest.h>
+#include <string>
+#include <unistd.h>
+
+/*============================================================================*
+ * HELPER FUNCTIONS
+ *============================================================================*/
+
+/**
+ * @brief Path of a scratch file for the running test
+ * @details Named after the test and the process under the gtest temp
+ *          directory, so tests run in parallel by ctest do not share it
+ * @param prefix File name prefix, e.g. "flm_trace_"
+ * @param ext File name extension including the dot
+ * @return Path of the file, not created
+ */
+inline std::string TestTempPath(const char* prefix, const char* ext) {
+    return ::testing::TempDir() + prefix +
+           ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_" +
+           std::to_string(getpid()) + ext;
+}
+
+#endif /* TEST_UTIL_H */
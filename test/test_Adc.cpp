@@ -0,0 +1,455 @@
+/**
+ * @file test_Adc.cpp
+ * @brief Unit Tests for ADC Driver
+ * @details Tests multi-channel groups, continuous streaming into result
+ *          buffers, group notification and the IIO backend (scan layout on a
+ *          fake device tree, buffered capture on iio_dummy where available)
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "MCAL/Adc/Adc.h"
+
+/** @brief Notifications received */
+static uint32_t Test_NotificationCount = 0U;
+
+static void Test_Notification(void) {
+    Test_NotificationCount++;
+}
+
+/** @brief Channel lists of the test groups */
+static const Adc_ChannelType Test_StreamChannels[] = { 0U, 1U };
+
+/** @brief Groups: circular stream, linear stream with notification */
+static const Adc_GroupConfigType Test_Groups[] = {
+    { 0U, ADC_TRIGG_SRC_SW, ADC_CONV_MODE_CONTINUOUS, 0U, 2U, Test_StreamChannels,
+      ADC_ACCESS_MODE_STREAMING, ADC_STREAM_BUFFER_CIRCULAR, 8U, 250U, NULL_PTR },
+    { 1U, ADC_TRIGG_SRC_SW, ADC_CONV_MODE_CONTINUOUS, 0U, 1U, Test_StreamChannels,
+      ADC_ACCESS_MODE_STREAMING, ADC_STREAM_BUFFER_LINEAR, 4U, 100U, Test_Notification }
+};
+
+static const Adc_ConfigType Test_Config = { 2U, Test_Groups, 2U, NULL_PTR };
+
+/**
+ * @brief Adc Test Fixture
+ */
+class AdcTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Test_NotificationCount = 0U;
+    }
+
+    void TearDown() override {
+        Adc_DeInit();
+    }
+};
+
+/**
+ * @test One-shot groups complete at once, multi-channel group reads all channels
+ */
+TEST_F(AdcTest, OneShot_MultiChannelGroup) {
+    Adc_ValueGroupType values[2] = { 0U, 0U };
+
+    Adc_Init(&Adc_Config);
+    Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT, 1234U);
+    Adc_SimSetValue(FLM_ADC_CHANNEL_CURRENT, 321U);
+
+    EXPECT_EQ(Adc_ReadGroup(ADC_GROUP_SENSORS, values), E_NOT_OK);
+
+    Adc_StartGroupConversion(ADC_GROUP_SENSORS);
+    EXPECT_EQ(Adc_GetGroupStatus(ADC_GROUP_SENSORS), ADC_STREAM_COMPLETED);
+    ASSERT_EQ(Adc_ReadGroup(ADC_GROUP_SENSORS, values), E_OK);
+    EXPECT_EQ(values[0], 1234U);
+    EXPECT_EQ(values[1], 321U);
+    EXPECT_EQ(Adc_GetGroupStatus(ADC_GROUP_SENSORS), ADC_IDLE);
+
+    /* Single channel groups keep the channel numbering */
+    Adc_StartGroupConversion(ADC_GROUP_CURRENT);
+    ASSERT_EQ(Adc_ReadGroup(ADC_GROUP_CURRENT, values), E_OK);
+    EXPECT_EQ(values[0], 321U);
+}
+
+/**
+ * @test Streaming group needs a result buffer, set up only while idle
+ */
+TEST_F(AdcTest, Streaming_ResultBufferRequired) {
+    Adc_ValueGroupType stream[2U * 8U];
+
+    Adc_Init(&Test_Config);
+    Adc_SimSetTimeUs(1000U);
+
+    Adc_StartGroupConversion(0U);
+    EXPECT_EQ(Adc_GetGroupStatus(0U), ADC_IDLE);
+
+    ASSERT_EQ(Adc_SetupResultBuffer(0U, stream), E_OK);
+    Adc_StartGroupConversion(0U);
+    EXPECT_NE(Adc_GetGroupStatus(0U), ADC_IDLE);
+    EXPECT_EQ(Adc_SetupResultBuffer(0U, stream), E_NOT_OK);
+
+    Adc_StopGroupConversion(0U);
+    EXPECT_EQ(Adc_GetGroupStatus(0U), ADC_IDLE);
+    EXPECT_EQ(Adc_SetupResultBuffer(0U, stream), E_OK);
+}
+
+/**
+ * @test Continuous conversion fills the ring at the conversion rate
+ */
+TEST_F(AdcTest, Streaming_CircularBlockRead) {
+    Adc_ValueGroupType stream[2U * 8U];
+    Adc_ValueGroupType block[2U * 8U];
+    Adc_StreamNumSampleType numSamples;
+    Adc_StreamNumSampleType i;
+
+    Adc_Init(&Test_Config);
+    Adc_SimSetTimeUs(1000U);
+    ASSERT_EQ(Adc_SetupResultBuffer(0U, stream), E_OK);
+
+    /* First round at start, then every 250us */
+    Adc_SimSetValue(0U, 100U);
+    Adc_SimSetValue(1U, 900U);
+    Adc_StartGroupConversion(0U);
+    Adc_SimSetTimeUs(1000U + 750U);
+    EXPECT_EQ(Adc_GetGroupStatus(0U), ADC_COMPLETED);
+
+    numSamples = Adc_ReadGroupStream(0U, block, 8U);
+    ASSERT_EQ(numSamples, 4U);
+    for (i = 0U; i < numSamples; i++) {
+        EXPECT_EQ(block[i], 100U);
+        EXPECT_EQ(block[8U + i], 900U);
+    }
+    EXPECT_EQ(Adc_GetGroupStatus(0U), ADC_BUSY);
+
+    /* 6 rounds with a new value wrap the ring, oldest first in the block */
+    Adc_SimSetTimeUs(1000U + 1000U);
+    Adc_SimSetValue(0U, 200U);
+    (void)Adc_GetGroupStatus(0U);
+    Adc_SimSetTimeUs(1000U + 2250U);
+    Adc_SimSetValue(0U, 300U);
+    numSamples = Adc_ReadGroupStream(0U, block, 8U);
+    ASSERT_EQ(numSamples, 6U);
+    EXPECT_EQ(block[0], 200U);
+    for (i = 1U; i < numSamples; i++) {
+        EXPECT_EQ(block[i], 300U);
+    }
+
+    /* Overrun: only the buffer depth is kept */
+    Adc_SimSetTimeUs(1000U + 100000U);
+    EXPECT_EQ(Adc_GetGroupStatus(0U), ADC_STREAM_COMPLETED);
+    EXPECT_EQ(Adc_ReadGroupStream(0U, block, 4U), 4U);
+}
+
+/**
+ * @test Latest sample pointer and single read of a streaming group
+ */
+TEST_F(AdcTest, Streaming_LastPointerAndReadGroup) {
+    Adc_ValueGroupType stream[2U * 8U];
+    Adc_ValueGroupType values[2];
+    Adc_ValueGroupType* last = NULL_PTR;
+
+    Adc_Init(&Test_Config);
+    Adc_SimSetTimeUs(5000U);
+    ASSERT_EQ(Adc_SetupResultBuffer(0U, stream), E_OK);
+    Adc_SimSetValue(0U, 10U);
+    Adc_StartGroupConversion(0U);
+
+    Adc_SimSetTimeUs(5000U + 500U);
+    Adc_SimSetValue(0U, 20U);
+    Adc_SimSetTimeUs(5000U + 501U);
+    Adc_SimSetValue(1U, 30U);
+
+    EXPECT_EQ(Adc_GetStreamLastPointer(0U, &last), 3U);
+    ASSERT_NE(last, nullptr);
+    EXPECT_EQ(last, &stream[2]);
+    EXPECT_EQ(*last, 20U);
+
+    /* A read without elapsed period still completes one round */
+    ASSERT_EQ(Adc_ReadGroup(0U, values), E_OK);
+    EXPECT_EQ(values[0], 20U);
+    EXPECT_EQ(values[1], 30U);
+}
+
+/**
+ * @test Linear buffer stops when full and notifies once per stream
+ */
+TEST_F(AdcTest, Streaming_LinearNotification) {
+    Adc_ValueGroupType stream[4U];
+    Adc_ValueGroupType* last = NULL_PTR;
+
+    Adc_Init(&Test_Config);
+    Adc_SimSetTimeUs(1000U);
+    ASSERT_EQ(Adc_SetupResultBuffer(1U, stream), E_OK);
+    Adc_EnableGroupNotification(1U);
+    Adc_StartGroupConversion(1U);
+
+    Adc_SimSetTimeUs(1000U + 250U);
+    Adc_MainFunction();
+    EXPECT_EQ(Test_NotificationCount, 0U);
+
+    Adc_SimSetTimeUs(1000U + 1000U);
+    Adc_MainFunction();
+    EXPECT_EQ(Test_NotificationCount, 1U);
+    EXPECT_EQ(Adc_GetGroupStatus(1U), ADC_STREAM_COMPLETED);
+
+    /* Full linear buffer converts nothing until read */
+    Adc_SimSetTimeUs(1000U + 2000U);
+    Adc_MainFunction();
+    EXPECT_EQ(Test_NotificationCount, 1U);
+    EXPECT_EQ(Adc_GetStreamLastPointer(1U, &last), 4U);
+    EXPECT_EQ(last, &stream[3]);
+
+    Adc_DisableGroupNotification(1U);
+    Adc_SimSetTimeUs(1000U + 3000U);
+    Adc_MainFunction();
+    EXPECT_EQ(Test_NotificationCount, 1U);
+    EXPECT_EQ(Adc_GetGroupStatus(1U), ADC_STREAM_COMPLETED);
+}
+
+/**
+ * @test Configuration without groups selects the ECU groups
+ */
+TEST_F(AdcTest, EmptyConfig_DefaultGroups) {
+    static const Adc_ConfigType emptyConfig = { 0U, NULL_PTR, 0U, NULL_PTR };
+    Adc_ValueGroupType value = 0U;
+
+    Adc_Init(&emptyConfig);
+    Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT, 777U);
+    Adc_StartGroupConversion(ADC_GROUP_AMBIENT);
+    ASSERT_EQ(Adc_ReadGroup(ADC_GROUP_AMBIENT, &value), E_OK);
+    EXPECT_EQ(value, 777U);
+    EXPECT_EQ(Adc_GetGroupStatus(ADC_NUM_GROUPS), ADC_IDLE);
+}
+
+/*============================================================================*
+ * IIO BACKEND TESTS
+ *============================================================================*/
+
+/**
+ * @brief Fake IIO device: sysfs attributes in a temporary directory and a
+ *        regular file as character device, scans appended by the test
+ */
+class FakeIioDevice {
+public:
+    FakeIioDevice() {
+        char pattern[] = "/tmp/flm_iio_XXXXXX";
+        const char* created = mkdtemp(pattern);
+        dir = (created != NULL_PTR) ? created : "";
+        (void)mkdir((dir + "/buffer").c_str(), 0755);
+        (void)mkdir((dir + "/trigger").c_str(), 0755);
+        (void)mkdir((dir + "/scan_elements").c_str(), 0755);
+        Write("buffer/enable", "0");
+        Write("buffer/length", "2");
+        Write("trigger/current_trigger", "");
+        AddElement("in_voltage0", 0U, "le:u12/16>>0");
+        AddElement("in_current1", 1U, "be:u14/16>>2");
+        AddElement("in_timestamp", 3U, "le:s64/64>>0");
+        Write("scan_elements/in_timestamp_en", "1");
+        Write("dev", "");
+    }
+
+    ~FakeIioDevice() {
+        const std::string cmd = "rm -rf " + dir;
+        (void)std::system(cmd.c_str());
+    }
+
+    std::string Dir() const { return dir; }
+    std::string Node() const { return dir + "/dev"; }
+
+    void Write(const std::string& name, const char* value) const {
+        std::ofstream file(dir + "/" + name);
+        file << value;
+    }
+
+    std::string Read(const std::string& name) const {
+        std::ifstream file(dir + "/" + name);
+        std::string value;
+        std::getline(file, value);
+        return value;
+    }
+
+    /** @brief Append one scan: voltage0 (le u12), current1 (be u14 >> 2) */
+    void AppendScan(uint16_t voltage, uint16_t current) const {
+        const uint16_t shifted = static_cast<uint16_t>(current << 2);
+        const unsigned char scan[4] = {
+            static_cast<unsigned char>(voltage & 0xFFU), static_cast<unsigned char>(voltage >> 8),
+            static_cast<unsigned char>(shifted >> 8), static_cast<unsigned char>(shifted & 0xFFU)
+        };
+        std::ofstream file(Node(), std::ios::binary | std::ios::app);
+        file.write(reinterpret_cast<const char*>(scan), sizeof(scan));
+    }
+
+private:
+    void AddElement(const char* name, uint32_t index, const char* type) const {
+        const std::string base = std::string("scan_elements/") + name;
+        Write(base + "_index", std::to_string(index).c_str());
+        Write(base + "_type", type);
+        Write(base + "_en", "0");
+    }
+
+    std::string dir;
+};
+
+/** @brief Scan elements of the fake device: channel 0 and 1 */
+static const char* const Test_IioElements[ADC_NUM_CHANNELS] = {
+    "in_voltage0", "in_current1", NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+};
+
+/**
+ * @test Device without buffer stays on the simulation backend
+ */
+TEST_F(AdcTest, Iio_DeviceUnavailable) {
+    const Adc_BackendConfigType config = {
+        ADC_BACKEND_IIO, "/nonexistent/iio:device0", NULL_PTR, NULL_PTR, NULL_PTR, 0U
+    };
+    Adc_ValueGroupType value = 0U;
+
+    Adc_Init(&Adc_Config);
+    EXPECT_EQ(Adc_SetBackend(&config), E_NOT_OK);
+
+    Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT, 555U);
+    Adc_StartGroupConversion(ADC_GROUP_AMBIENT);
+    ASSERT_EQ(Adc_ReadGroup(ADC_GROUP_AMBIENT, &value), E_OK);
+    EXPECT_EQ(value, 555U);
+}
+
+/**
+ * @test Buffer setup and scan layout: elements enabled, others disabled,
+ *       scans decoded into the stream in capture order
+ */
+TEST_F(AdcTest, Iio_ScanLayoutStream) {
+    FakeIioDevice device;
+    const std::string dir = device.Dir();
+    const std::string node = device.Node();
+    const Adc_BackendConfigType config = {
+        ADC_BACKEND_IIO, dir.c_str(), node.c_str(), "flm-trigger", Test_IioElements, 128U
+    };
+    Adc_ValueGroupType stream[2U * 8U];
+    Adc_ValueGroupType block[2U * 8U];
+    Adc_IioStatsType stats;
+
+    Adc_Init(&Test_Config);
+    ASSERT_EQ(Adc_SetBackend(&config), E_OK);
+    EXPECT_EQ(device.Read("scan_elements/in_voltage0_en"), "1");
+    EXPECT_EQ(device.Read("scan_elements/in_current1_en"), "1");
+    EXPECT_EQ(device.Read("scan_elements/in_timestamp_en"), "0");
+    EXPECT_EQ(device.Read("trigger/current_trigger"), "flm-trigger");
+    EXPECT_EQ(device.Read("buffer/length"), "128");
+    EXPECT_EQ(device.Read("buffer/enable"), "1");
+
+    ASSERT_EQ(Adc_SetupResultBuffer(0U, stream), E_OK);
+    Adc_StartGroupConversion(0U);
+
+    /* 12 bit values as is, 14 bit values scaled to 12 bit */
+    device.AppendScan(0x123U, 0x1000U);
+    device.AppendScan(0x456U, 0x3FFFU);
+    device.AppendScan(0xFFFU, 0x0004U);
+
+    ASSERT_EQ(Adc_ReadGroupStream(0U, block, 8U), 3U);
+    EXPECT_EQ(block[0], 0x123U);
+    EXPECT_EQ(block[1], 0x456U);
+    EXPECT_EQ(block[2], 0xFFFU);
+    EXPECT_EQ(block[8U + 0U], 0x400U);
+    EXPECT_EQ(block[8U + 1U], 0xFFFU);
+    EXPECT_EQ(block[8U + 2U], 0x001U);
+
+    /* All three scans with one read */
+    Adc_GetIioStats(&stats);
+    EXPECT_EQ(stats.Scans, 3U);
+    EXPECT_LE(stats.ReadCalls, 2U);
+
+    Adc_DeInit();
+    EXPECT_EQ(device.Read("buffer/enable"), "0");
+    EXPECT_EQ(device.Read("scan_elements/in_voltage0_en"), "0");
+}
+
+/**
+ * @test One-shot groups read the latest captured scan through Adc_ReadGroup
+ */
+TEST_F(AdcTest, Iio_ReadGroupLatestScan) {
+    FakeIioDevice device;
+    const std::string dir = device.Dir();
+    const std::string node = device.Node();
+    const Adc_BackendConfigType config = {
+        ADC_BACKEND_IIO, dir.c_str(), node.c_str(), NULL_PTR, Test_IioElements, 0U
+    };
+    Adc_ValueGroupType values[2] = { 0U, 0U };
+
+    Adc_Init(&Adc_Config);
+    ASSERT_EQ(Adc_SetBackend(&config), E_OK);
+
+    device.AppendScan(100U, 200U);
+    device.AppendScan(1500U, 800U);
+
+    Adc_StartGroupConversion(ADC_GROUP_SENSORS);
+    ASSERT_EQ(Adc_ReadGroup(ADC_GROUP_SENSORS, values), E_OK);
+    EXPECT_EQ(values[0], 1500U);
+    EXPECT_EQ(values[1], 200U);
+}
+
+/**
+ * @test Buffered capture on iio_dummy with an hrtimer trigger
+ */
+TEST_F(AdcTest, IioDummy_TriggeredCapture) {
+    const std::string dummyDir = "/sys/kernel/config/iio/devices/dummy/flm_adc_test";
+    const std::string triggerDir = "/sys/kernel/config/iio/triggers/hrtimer/flm_adc_trig";
+    static const char* const elements[ADC_NUM_CHANNELS] = {
+        "in_voltage0", NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR, NULL_PTR
+    };
+    std::string devicePath;
+    Adc_ValueGroupType stream[2U * 8U];
+    Adc_ValueGroupType block[2U * 8U];
+    Adc_IioStatsType stats;
+    uint32_t i;
+
+    if ((mkdir(dummyDir.c_str(), 0755) != 0) || (mkdir(triggerDir.c_str(), 0755) != 0)) {
+        (void)rmdir(dummyDir.c_str());
+        GTEST_SKIP() << "iio_dummy or iio-trig-hrtimer not available";
+    }
+
+    /* Find the devices by name */
+    for (i = 0U; i < 64U; i++) {
+        const std::string dev = "/sys/bus/iio/devices/iio:device" + std::to_string(i);
+        const std::string trig = "/sys/bus/iio/devices/trigger" + std::to_string(i);
+        std::string name;
+        std::ifstream devName(dev + "/name");
+        std::ifstream trigName(trig + "/name");
+        if (std::getline(devName, name) && (name == "flm_adc_test")) {
+            devicePath = dev;
+        }
+        if (std::getline(trigName, name) && (name == "flm_adc_trig")) {
+            std::ofstream(trig + "/sampling_frequency") << "1000";
+        }
+    }
+
+    const Adc_BackendConfigType config = {
+        ADC_BACKEND_IIO, devicePath.c_str(), NULL_PTR, "flm_adc_trig", elements, 0U
+    };
+
+    Adc_Init(&Test_Config);
+    if (devicePath.empty() || (Adc_SetBackend(&config) != E_OK)) {
+        Adc_DeInit();
+        (void)rmdir(triggerDir.c_str());
+        (void)rmdir(dummyDir.c_str());
+        GTEST_SKIP() << "iio_dummy without buffer support";
+    }
+
+    ASSERT_EQ(Adc_SetupResultBuffer(0U, stream), E_OK);
+    Adc_StartGroupConversion(0U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_GT(Adc_ReadGroupStream(0U, block, 8U), 0U);
+    Adc_GetIioStats(&stats);
+    EXPECT_GT(stats.Scans, static_cast<uint64_t>(stats.ReadCalls));
+
+    Adc_DeInit();
+    (void)rmdir(triggerDir.c_str());
+    (void)rmdir(dummyDir.c_str());
+}
@@ -0,0 +1,196 @@
+/**
+ * @file test_BswM.cpp
+ * @brief Unit Tests for BSW Mode Manager
+ * @details Tests rule evaluation, dirty tracking and action lists
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "BSW/BswM/BswM.h"
+#include "BSW/Com/Com.h"
+#include "BSW/Dem/Dem.h"
+#include "MCAL/Can/Can.h"
+
+/**
+ * @brief BswM Test Fixture
+ */
+class BswMTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        static const Can_ConfigType canConfig = { 1U, NULL_PTR };
+        static const BswM_ConfigType bswmConfig = { 5U };
+
+        Can_Init(&canConfig);
+        Com_Init();
+        Dem_Init();
+        BswM_Init(&bswmConfig);
+    }
+
+    void TearDown() override {
+        BswM_Deinit();
+        Dem_Shutdown();
+        Com_DeInit();
+        Can_DeInit();
+    }
+
+    BswM_ModeType CurrentMode(void) {
+        BswM_ModeType mode = BSWM_MODE_SLEEP;
+        EXPECT_EQ(BswM_GetCurrentMode(&mode), E_OK);
+        return mode;
+    }
+
+    boolean RuleState(uint8_t ruleId) {
+        boolean state = FALSE;
+        EXPECT_EQ(BswM_GetRuleState(ruleId, &state), E_OK);
+        return state;
+    }
+
+    Can_ControllerStateType CanState(void) {
+        Can_ControllerStateType state = CAN_CS_UNINIT;
+        EXPECT_EQ(Can_GetControllerMode(BSWM_CAN_CONTROLLER, &state), E_OK);
+        return state;
+    }
+};
+
+/**
+ * @test First main function evaluates all rules and enters RUN
+ */
+TEST_F(BswMTest, Startup_EntersRun) {
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_STARTUP);
+
+    BswM_MainFunction();
+
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_RUN);
+    EXPECT_EQ(BswM_SimGetRuleEvaluationCount(), BSWM_NUM_RULES);
+    EXPECT_TRUE(RuleState(BSWM_RULE_RUN));
+    EXPECT_TRUE(RuleState(BSWM_RULE_COM_RX));
+    EXPECT_TRUE(RuleState(BSWM_RULE_COM_TX));
+    EXPECT_FALSE(RuleState(BSWM_RULE_SHUTDOWN));
+    EXPECT_EQ(CanState(), CAN_CS_STARTED);
+    EXPECT_TRUE(Com_IsIpduGroupStarted(COM_IPDUGROUP_RX));
+    EXPECT_TRUE(Com_IsIpduGroupStarted(COM_IPDUGROUP_TX));
+}
+
+/**
+ * @test Unchanged mode ports do not cause rule evaluations
+ */
+TEST_F(BswMTest, NoChange_NoEvaluation) {
+    BswM_MainFunction();
+    uint32_t count = BswM_SimGetRuleEvaluationCount();
+
+    BswM_MainFunction();
+    EXPECT_EQ(BswM_RequestMode(0U, BSWM_MODE_RUN), E_OK);  /* same value */
+    BswM_MainFunction();
+
+    EXPECT_EQ(BswM_SimGetRuleEvaluationCount(), count);
+}
+
+/**
+ * @test Loss of communication re-evaluates only the communication rules
+ */
+TEST_F(BswMTest, NoCommunication_StopsComAndDemCondition) {
+    BswM_MainFunction();
+    uint32_t count = BswM_SimGetRuleEvaluationCount();
+
+    BswM_ComM_CurrentMode(BSWM_COMM_NETWORK_CAN, COMM_NO_COMMUNICATION);
+    BswM_MainFunction();
+
+    EXPECT_EQ(BswM_SimGetRuleEvaluationCount(), count + 2U);
+    EXPECT_FALSE(RuleState(BSWM_RULE_COM_RX));
+    EXPECT_FALSE(RuleState(BSWM_RULE_COM_TX));
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_RUN);
+    EXPECT_EQ(CanState(), CAN_CS_STOPPED);
+    EXPECT_FALSE(Com_IsIpduGroupStarted(COM_IPDUGROUP_RX));
+    EXPECT_FALSE(Com_IsIpduGroupStarted(COM_IPDUGROUP_TX));
+    EXPECT_EQ(Com_TriggerIPDUSend(COM_IPDU_HEADLIGHT_STATUS_TX), E_NOT_OK);
+
+    /* Communication events are suppressed, others still processed */
+    EXPECT_EQ(Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT, DEM_EVENT_STATUS_FAILED), E_NOT_OK);
+    EXPECT_EQ(Dem_SetEventStatus(DEM_EVENT_HEADLIGHT_OPEN_LOAD, DEM_EVENT_STATUS_FAILED), E_OK);
+
+    BswM_ComM_CurrentMode(BSWM_COMM_NETWORK_CAN, COMM_FULL_COMMUNICATION);
+    BswM_MainFunction();
+
+    EXPECT_EQ(CanState(), CAN_CS_STARTED);
+    EXPECT_TRUE(Com_IsIpduGroupStarted(COM_IPDUGROUP_RX));
+    EXPECT_TRUE(Com_IsIpduGroupStarted(COM_IPDUGROUP_TX));
+    EXPECT_EQ(Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT, DEM_EVENT_STATUS_FAILED), E_OK);
+}
+
+/**
+ * @test Silent communication keeps reception but stops transmission
+ */
+TEST_F(BswMTest, SilentCommunication_RxOnly) {
+    BswM_MainFunction();
+
+    BswM_ComM_CurrentMode(BSWM_COMM_NETWORK_CAN, COMM_SILENT_COMMUNICATION);
+    BswM_MainFunction();
+
+    EXPECT_TRUE(Com_IsIpduGroupStarted(COM_IPDUGROUP_RX));
+    EXPECT_FALSE(Com_IsIpduGroupStarted(COM_IPDUGROUP_TX));
+    EXPECT_EQ(CanState(), CAN_CS_STARTED);
+}
+
+/**
+ * @test Mode request is arbitrated in the next main function
+ */
+TEST_F(BswMTest, RequestPostRun_Arbitrated) {
+    BswM_MainFunction();
+
+    EXPECT_EQ(BswM_RequestMode(0U, BSWM_MODE_POST_RUN), E_OK);
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_RUN);
+
+    BswM_MainFunction();
+
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_POST_RUN);
+    EXPECT_FALSE(RuleState(BSWM_RULE_RUN));
+    EXPECT_TRUE(RuleState(BSWM_RULE_POST_RUN));
+    EXPECT_FALSE(Com_IsIpduGroupStarted(COM_IPDUGROUP_TX));
+    EXPECT_TRUE(Com_IsIpduGroupStarted(COM_IPDUGROUP_RX));
+    EXPECT_EQ(Dem_SetEventStatus(DEM_EVENT_HEADLIGHT_OPEN_LOAD, DEM_EVENT_STATUS_FAILED), E_NOT_OK);
+    EXPECT_EQ(Dem_SetEventStatus(DEM_EVENT_SAFE_STATE_ENTERED, DEM_EVENT_STATUS_FAILED), E_OK);
+
+    EXPECT_EQ(BswM_RequestMode(0U, BSWM_MODE_RUN), E_OK);
+    BswM_MainFunction();
+
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_RUN);
+    EXPECT_TRUE(Com_IsIpduGroupStarted(COM_IPDUGROUP_TX));
+}
+
+/**
+ * @test EcuM leaving RUN releases the RUN mode rule
+ */
+TEST_F(BswMTest, EcuMState_GatesRun) {
+    BswM_EcuM_CurrentState(BSWM_ECUM_STATE_STARTUP);
+    BswM_MainFunction();
+
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_STARTUP);
+    EXPECT_FALSE(RuleState(BSWM_RULE_RUN));
+
+    BswM_EcuM_CurrentState(BSWM_ECUM_STATE_RUN);
+    BswM_MainFunction();
+
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_RUN);
+}
+
+/**
+ * @test Invalid requests are rejected
+ */
+TEST_F(BswMTest, InvalidRequests) {
+    boolean state = FALSE;
+
+    EXPECT_EQ(BswM_GetRuleState(BSWM_RULE_RUN, &state), E_NOT_OK);  /* not evaluated yet */
+    EXPECT_EQ(BswM_GetRuleState(BSWM_NUM_RULES, &state), E_NOT_OK);
+
+    /* Out of range port value is ignored */
+    BswM_MainFunction();
+    uint32_t count = BswM_SimGetRuleEvaluationCount();
+    BswM_EcuM_CurrentState(static_cast<uint8_t>(BSWM_MAX_PORT_VALUES));
+    BswM_MainFunction();
+    EXPECT_EQ(BswM_SimGetRuleEvaluationCount(), count);
+    EXPECT_EQ(CurrentMode(), BSWM_MODE_RUN);
+
+    BswM_Deinit();
+    EXPECT_EQ(BswM_RequestMode(0U, BSWM_MODE_RUN), E_NOT_OK);
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_Cal.cpp
+ * @brief Unit Tests for Sensor Calibration
+ * @details Tests lookup table compilation, table-free interpolation,
+ *          polynomial curves and configuration checks
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "BSW/Cal/Cal.h"
+
+/** @brief Nonlinear test curve with a falling segment */
+static const uint16_t Test_Raw[] = { 100U, 700U, 1300U, 2000U, 3000U, 3900U };
+static const uint16_t Test_Values[] = { 50U, 400U, 333U, 2100U, 9000U, 65000U };
+
+/** @brief Quadratic test curve: 10 + 0.5 x + 0.001 x^2 */
+static const float64 Test_Coefficients[] = { 10.0, 0.5, 0.001 };
+
+static const Cal_CurveConfigType Test_PiecewiseLut = {
+    CAL_CURVE_PIECEWISE_LINEAR, CAL_MODE_LUT, 6U, Test_Raw, Test_Values,
+    0U, NULL_PTR, 0U, 0xFFFFU
+};
+
+static const Cal_CurveConfigType Test_PiecewiseInterp = {
+    CAL_CURVE_PIECEWISE_LINEAR, CAL_MODE_INTERPOLATE, 6U, Test_Raw, Test_Values,
+    0U, NULL_PTR, 0U, 0xFFFFU
+};
+
+static const Cal_CurveConfigType Test_PolyLut = {
+    CAL_CURVE_POLYNOMIAL, CAL_MODE_LUT, 0U, NULL_PTR, NULL_PTR,
+    2U, Test_Coefficients, 0U, 0xFFFFU
+};
+
+static const Cal_CurveConfigType Test_PolyInterp = {
+    CAL_CURVE_POLYNOMIAL, CAL_MODE_INTERPOLATE, 0U, NULL_PTR, NULL_PTR,
+    2U, Test_Coefficients, 0U, 0xFFFFU
+};
+
+/** @brief Quadratic reference value */
+static float64 Test_Quadratic(uint16_t raw) {
+    const float64 x = static_cast<float64>(raw);
+    return Test_Coefficients[0] + (Test_Coefficients[1] * x) + (Test_Coefficients[2] * x * x);
+}
+
+/**
+ * @brief Cal Test Fixture
+ */
+class CalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Cal_Init(&Cal_Config);
+    }
+
+    void TearDown() override {
+        Cal_DeInit();
+    }
+};
+
+/**
+ * @test FLM curves: ambient thresholds and linear current sense
+ */
+TEST_F(CalTest, DefaultConfig_FlmCurves) {
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 0U), 0U);
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 800U), 200U);
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 1000U), 250U);
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 600U), 140U);
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 4095U), 6000U);
+
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT, 0U), 0U);
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT, 500U), 500U * FLM_HEADLIGHT_CURRENT_FACTOR);
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_HEADLIGHT_CURRENT, 4095U), 4095U * FLM_HEADLIGHT_CURRENT_FACTOR);
+}
+
+/**
+ * @test Piecewise curve: lookup table equals interpolation for every raw value
+ */
+TEST_F(CalTest, Piecewise_LutMatchesInterpolation) {
+    uint32_t raw;
+    uint8_t i;
+
+    ASSERT_EQ(Cal_SetCurve(0U, &Test_PiecewiseLut), E_OK);
+    ASSERT_EQ(Cal_SetCurve(1U, &Test_PiecewiseInterp), E_OK);
+
+    for (raw = 0U; raw <= CAL_INPUT_MAX; raw++) {
+        ASSERT_EQ(Cal_Convert(0U, static_cast<uint16_t>(raw)),
+                  Cal_Convert(1U, static_cast<uint16_t>(raw))) << "raw " << raw;
+    }
+
+    /* Exact at the breakpoints, constant outside */
+    for (i = 0U; i < 6U; i++) {
+        EXPECT_EQ(Cal_Convert(1U, Test_Raw[i]), Test_Values[i]);
+    }
+    EXPECT_EQ(Cal_Convert(1U, 0U), 50U);
+    EXPECT_EQ(Cal_Convert(1U, 4095U), 65000U);
+
+    /* Rounded linear interpolation, rising and falling segments */
+    EXPECT_EQ(Cal_Convert(1U, 400U), 225U);
+    EXPECT_EQ(Cal_Convert(1U, 1000U), 367U);
+    EXPECT_EQ(Cal_Convert(1U, 3450U), 37000U);
+}
+
+/**
+ * @test Polynomial curve: exact table, sampled interpolation close to it
+ */
+TEST_F(CalTest, Polynomial_Accuracy) {
+    uint32_t raw;
+    float64 expected;
+    int32_t lut;
+    int32_t interp;
+
+    ASSERT_EQ(Cal_SetCurve(0U, &Test_PolyLut), E_OK);
+    ASSERT_EQ(Cal_SetCurve(1U, &Test_PolyInterp), E_OK);
+
+    for (raw = 0U; raw <= CAL_INPUT_MAX; raw++) {
+        expected = Test_Quadratic(static_cast<uint16_t>(raw));
+        lut = Cal_Convert(0U, static_cast<uint16_t>(raw));
+        interp = Cal_Convert(1U, static_cast<uint16_t>(raw));
+
+        ASSERT_NEAR(lut, expected, 0.5 + 1e-9) << "raw " << raw;
+        /* Chord error of a quadratic: a * (segment / 2)^2, segment = 128 */
+        ASSERT_NEAR(interp, expected, 0.001 * 64.0 * 64.0 + 1.0) << "raw " << raw;
+    }
+}
+
+/**
+ * @test Output limits and raw values beyond the input range
+ */
+TEST_F(CalTest, Clamping_OutputAndInput) {
+    Cal_CurveConfigType curve = Test_PiecewiseInterp;
+
+    curve.OutMin = 300U;
+    curve.OutMax = 5000U;
+    ASSERT_EQ(Cal_SetCurve(0U, &curve), E_OK);
+    curve.Mode = CAL_MODE_LUT;
+    ASSERT_EQ(Cal_SetCurve(1U, &curve), E_OK);
+
+    EXPECT_EQ(Cal_Convert(0U, 0U), 300U);
+    EXPECT_EQ(Cal_Convert(1U, 0U), 300U);
+    EXPECT_EQ(Cal_Convert(0U, 4095U), 5000U);
+    EXPECT_EQ(Cal_Convert(1U, 4095U), 5000U);
+    EXPECT_EQ(Cal_Convert(0U, 700U), 400U);
+
+    /* Beyond the ADC range: treated as the largest raw value */
+    EXPECT_EQ(Cal_Convert(0U, 0xFFFFU), 5000U);
+    EXPECT_EQ(Cal_Convert(1U, 0xFFFFU), 5000U);
+}
+
+/**
+ * @test Invalid curves are rejected, the previous curve stays active
+ */
+TEST_F(CalTest, InvalidConfig_Rejected) {
+    static const uint16_t unsortedRaw[] = { 100U, 100U, 300U };
+    static const uint16_t rangeRaw[] = { 100U, 4096U };
+    static const uint16_t values[] = { 1U, 2U, 3U };
+    Cal_CurveConfigType curve = Test_PiecewiseLut;
+
+    curve.RawPoints = unsortedRaw;
+    curve.Values = values;
+    curve.NumPoints = 3U;
+    EXPECT_EQ(Cal_SetCurve(CAL_CURVE_AMBIENT_LUX, &curve), E_NOT_OK);
+
+    curve.RawPoints = rangeRaw;
+    curve.NumPoints = 2U;
+    EXPECT_EQ(Cal_SetCurve(CAL_CURVE_AMBIENT_LUX, &curve), E_NOT_OK);
+
+    curve.NumPoints = 1U;
+    EXPECT_EQ(Cal_SetCurve(CAL_CURVE_AMBIENT_LUX, &curve), E_NOT_OK);
+
+    curve = Test_PolyLut;
+    curve.Degree = CAL_MAX_POLY_DEGREE + 1U;
+    EXPECT_EQ(Cal_SetCurve(CAL_CURVE_AMBIENT_LUX, &curve), E_NOT_OK);
+
+    curve = Test_PolyLut;
+    curve.OutMin = 10U;
+    curve.OutMax = 5U;
+    EXPECT_EQ(Cal_SetCurve(CAL_CURVE_AMBIENT_LUX, &curve), E_NOT_OK);
+
+    EXPECT_EQ(Cal_SetCurve(CAL_CURVE_AMBIENT_LUX, NULL_PTR), E_NOT_OK);
+    EXPECT_EQ(Cal_SetCurve(CAL_NUM_CURVES, &Test_PolyLut), E_NOT_OK);
+
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 800U), 200U);
+    EXPECT_EQ(Cal_Convert(CAL_NUM_CURVES, 800U), 0U);
+}
+
+/**
+ * @test Not initialized or unconfigured curves convert to 0
+ */
+TEST_F(CalTest, Uninitialized_ReturnsZero) {
+    static const Cal_ConfigType tooMany = { CAL_NUM_CURVES + 1U, NULL_PTR };
+    static const Cal_CurveConfigType curves[CAL_NUM_CURVES] = { Test_PiecewiseLut };
+    static const Cal_ConfigType partial = { 1U, curves };
+
+    Cal_DeInit();
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 800U), 0U);
+    EXPECT_EQ(Cal_SetCurve(CAL_CURVE_AMBIENT_LUX, &Test_PiecewiseLut), E_NOT_OK);
+
+    Cal_Init(&tooMany);
+    EXPECT_EQ(Cal_Convert(CAL_CURVE_AMBIENT_LUX, 800U), 0U);
+
+    Cal_Init(&partial);
+    EXPECT_EQ(Cal_Convert(0U, 700U), 400U);
+    EXPECT_EQ(Cal_Convert(1U, 700U), 0U);
+}
@@ -0,0 +1,260 @@
+/**
+ * @file test_Campaign.cpp
+ * @brief Unit Tests for the Fault-Injection Campaign
+ * @details Runs a small catalogue inline and on forked workers and checks
+ *          the fault reactions and the catalogue validation
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Sim/Campaign/Campaign.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+#include "MCAL/Adc/Adc.h"
+#include "FLM_Config.h"
+#include <vector>
+
+/* External test helper function declaration */
+extern void SafetyMonitor_SimSetWdgmStatus(WdgM_GlobalStatusType status);
+
+/** @brief Every fault model */
+static const Campaign_FaultType TestCampaign_Faults[] = {
+    CAMPAIGN_FAULT_E2E_CRC,
+    CAMPAIGN_FAULT_E2E_COUNTER_JUMP,
+    CAMPAIGN_FAULT_CAN_LOSS,
+    CAMPAIGN_FAULT_ADC_OPEN,
+    CAMPAIGN_FAULT_ADC_SHORT,
+    CAMPAIGN_FAULT_ADC_STUCK,
+    CAMPAIGN_FAULT_LAMP_OPEN_LOAD,
+    CAMPAIGN_FAULT_WDGM_ALIVE_MISS
+};
+
+/** @brief A transient and a persistent fault (ms) */
+static const uint32_t TestCampaign_Durations[] = { 5U, 500U };
+
+/** @brief 8 faults x 4 injection times x 2 durations */
+static const Campaign_CatalogueType TestCampaign_Catalogue = {
+    TestCampaign_Faults, 8U, 0U, 7U, 4U, TestCampaign_Durations, 2U
+};
+
+/**
+ * @brief Campaign Test Fixture
+ */
+class CampaignTest : public ::testing::Test {
+protected:
+    std::vector<Campaign_ResultType> Run(const Campaign_CatalogueType* catalogue, uint8_t workers) {
+        std::vector<Campaign_ResultType> results(Campaign_GetNumVariants(catalogue));
+
+        EXPECT_EQ(Campaign_Run(catalogue, workers, results.data(),
+                               static_cast<uint32_t>(results.size())), E_OK);
+        return results;
+    }
+};
+
+/*============================================================================*
+ * VARIANT TESTS
+ *============================================================================*/
+
+TEST_F(CampaignTest, Run_CoversCrossProductInOrder) {
+    std::vector<Campaign_ResultType> results = Run(&TestCampaign_Catalogue, 1U);
+
+    ASSERT_EQ(results.size(), 64U);
+    /* Duration fastest, then injection time, then fault */
+    EXPECT_EQ(results[0].Fault, CAMPAIGN_FAULT_E2E_CRC);
+    EXPECT_EQ(results[0].DurationMs, 5U);
+    EXPECT_EQ(results[1].DurationMs, 500U);
+    EXPECT_EQ(results[2].InjectionMs, 7U);
+    EXPECT_EQ(results[63].Fault, CAMPAIGN_FAULT_WDGM_ALIVE_MISS);
+    EXPECT_EQ(results[63].InjectionMs, 21U);
+}
+
+TEST_F(CampaignTest, Run_PersistentFaultsReachSafeState) {
+    std::vector<Campaign_ResultType> results = Run(&TestCampaign_Catalogue, 1U);
+
+    for (const Campaign_ResultType& result : results) {
+        if (result.DurationMs != 500U) {
+            continue;
+        }
+        switch (result.Fault) {
+            case CAMPAIGN_FAULT_E2E_CRC:
+            case CAMPAIGN_FAULT_E2E_COUNTER_JUMP:
+            case CAMPAIGN_FAULT_CAN_LOSS:
+                EXPECT_EQ(result.Outcome, CAMPAIGN_OUTCOME_IN_FTTI) << result.InjectionMs;
+                EXPECT_EQ(result.Reason, SAFE_STATE_REASON_E2E_FAILURE);
+                EXPECT_GE(result.ResponseMs, FLM_E2E_TIMEOUT_MS);
+                break;
+            case CAMPAIGN_FAULT_WDGM_ALIVE_MISS:
+                EXPECT_EQ(result.Outcome, CAMPAIGN_OUTCOME_IN_FTTI) << result.InjectionMs;
+                EXPECT_EQ(result.Reason, SAFE_STATE_REASON_WDGM_FAILURE);
+                break;
+            case CAMPAIGN_FAULT_ADC_OPEN:
+            case CAMPAIGN_FAULT_ADC_SHORT:
+            case CAMPAIGN_FAULT_LAMP_OPEN_LOAD:
+                EXPECT_NE(result.Outcome, CAMPAIGN_OUTCOME_NOT_DETECTED) << result.InjectionMs;
+                break;
+            default:
+                /* A plausible frozen level cannot be told from darkness */
+                EXPECT_EQ(result.Outcome, CAMPAIGN_OUTCOME_NOT_DETECTED);
+                break;
+        }
+        if (result.Outcome != CAMPAIGN_OUTCOME_NOT_DETECTED) {
+            EXPECT_EQ(result.Outcome == CAMPAIGN_OUTCOME_IN_FTTI, result.ResponseMs <= FLM_FTTI_MS);
+        } else {
+            EXPECT_EQ(result.Reason, SAFE_STATE_REASON_NONE);
+        }
+    }
+}
+
+TEST_F(CampaignTest, Run_TransientSensorFaultsAreTolerated) {
+    std::vector<Campaign_ResultType> results = Run(&TestCampaign_Catalogue, 1U);
+
+    for (const Campaign_ResultType& result : results) {
+        if ((result.DurationMs == 5U) &&
+            ((result.Fault == CAMPAIGN_FAULT_ADC_OPEN) || (result.Fault == CAMPAIGN_FAULT_ADC_SHORT) ||
+             (result.Fault == CAMPAIGN_FAULT_WDGM_ALIVE_MISS))) {
+            EXPECT_EQ(result.Outcome, CAMPAIGN_OUTCOME_NOT_DETECTED)
+                << Campaign_GetFaultName(result.Fault) << " at " << result.InjectionMs;
+        }
+    }
+}
+
+TEST_F(CampaignTest, Run_WorkersMatchInlineRun) {
+    std::vector<Campaign_ResultType> inlineRun = Run(&TestCampaign_Catalogue, 1U);
+    std::vector<Campaign_ResultType> forked = Run(&TestCampaign_Catalogue, 3U);
+    size_t i;
+
+    ASSERT_EQ(inlineRun.size(), forked.size());
+    for (i = 0U; i < inlineRun.size(); i++) {
+        EXPECT_EQ(forked[i].Fault, inlineRun[i].Fault) << i;
+        EXPECT_EQ(forked[i].InjectionMs, inlineRun[i].InjectionMs) << i;
+        EXPECT_EQ(forked[i].DurationMs, inlineRun[i].DurationMs) << i;
+        EXPECT_EQ(forked[i].Outcome, inlineRun[i].Outcome) << i;
+        EXPECT_EQ(forked[i].ResponseMs, inlineRun[i].ResponseMs) << i;
+        EXPECT_EQ(forked[i].Reason, inlineRun[i].Reason) << i;
+    }
+}
+
+TEST_F(CampaignTest, Run_IgnoresSimStateOfEarlierTests) {
+    std::vector<Campaign_ResultType> clean = Run(&TestCampaign_Catalogue, 1U);
+    std::vector<Campaign_ResultType> leftover;
+    size_t i;
+
+    /* Left behind by other tests in the same process */
+    SafetyMonitor_SimSetWdgmStatus(WDGM_GLOBAL_STATUS_FAILED);
+    Adc_SimSetSampleSource([](Adc_ChannelType, uint64_t, uint32_t, uint16_t numSamples,
+                              Adc_ValueGroupType* samples) {
+        uint16_t i;
+
+        for (i = 0U; i < numSamples; i++) {
+            samples[i] = 0U;
+        }
+    });
+    leftover = Run(&TestCampaign_Catalogue, 1U);
+
+    ASSERT_EQ(leftover.size(), clean.size());
+    for (i = 0U; i < clean.size(); i++) {
+        EXPECT_EQ(leftover[i].Outcome, clean[i].Outcome) << i;
+        EXPECT_EQ(leftover[i].ResponseMs, clean[i].ResponseMs) << i;
+        EXPECT_EQ(leftover[i].Reason, clean[i].Reason) << i;
+    }
+}
+
+/*============================================================================*
+ * CATALOGUE TESTS
+ *============================================================================*/
+
+TEST_F(CampaignTest, Run_RejectsInvalidCatalogue) {
+    static const uint32_t zeroDuration[] = { 0U };
+    Campaign_CatalogueType catalogue = TestCampaign_Catalogue;
+    std::vector<Campaign_ResultType> results(Campaign_GetNumVariants(&catalogue));
+    const uint32_t numResults = static_cast<uint32_t>(results.size());
+
+    EXPECT_EQ(Campaign_GetNumVariants(NULL_PTR), 0U);
+    EXPECT_EQ(Campaign_Run(NULL_PTR, 1U, results.data(), numResults), E_NOT_OK);
+    EXPECT_EQ(Campaign_Run(&catalogue, 1U, NULL_PTR, numResults), E_NOT_OK);
+    EXPECT_EQ(Campaign_Run(&catalogue, 1U, results.data(), numResults - 1U), E_NOT_OK);
+    EXPECT_EQ(Campaign_Run(&catalogue, 0U, results.data(), numResults), E_NOT_OK);
+    EXPECT_EQ(Campaign_Run(&catalogue, CAMPAIGN_MAX_WORKERS + 1U, results.data(), numResults),
+              E_NOT_OK);
+
+    catalogue.InjectionStepMs = 0U;
+    EXPECT_EQ(Campaign_Run(&catalogue, 1U, results.data(), numResults), E_NOT_OK);
+    catalogue = TestCampaign_Catalogue;
+
+    catalogue.NumInjections = CAMPAIGN_MAX_INJECTIONS + 1U;
+    EXPECT_EQ(Campaign_Run(&catalogue, 1U, results.data(), numResults), E_NOT_OK);
+    catalogue = TestCampaign_Catalogue;
+
+    catalogue.DurationsMs = zeroDuration;
+    catalogue.NumDurations = 1U;
+    EXPECT_EQ(Campaign_Run(&catalogue, 1U, results.data(), numResults), E_NOT_OK);
+}
+
+TEST_F(CampaignTest, GetFaultName_NamesEveryFault) {
+    EXPECT_STREQ(Campaign_GetFaultName(CAMPAIGN_FAULT_E2E_CRC), "e2e-crc");
+    EXPECT_STREQ(Campaign_GetFaultName(CAMPAIGN_FAULT_WDGM_ALIVE_MISS), "wdgm-alive-miss");
+}
+
+/*============================================================================*
+ * KNOWN FINDINGS TESTS
+ *============================================================================*/
+
+TEST_F(CampaignTest, CheckFinding_BoundsLateUndetectedAndResponse) {
+    std::vector<Campaign_ResultType> results = Run(&TestCampaign_Catalogue, 1U);
+    const uint32_t numResults = static_cast<uint32_t>(results.size());
+    Campaign_FindingType finding = { 0U, 0U, 0U };
+    uint32_t late = 0U;
+    uint32_t notDetected = 0U;
+    uint32_t maxResponseMs = 0U;
+
+    for (const Campaign_ResultType& result : results) {
+        if (result.Fault != CAMPAIGN_FAULT_ADC_SHORT) {
+            continue;
+        }
+        if (result.Outcome == CAMPAIGN_OUTCOME_NOT_DETECTED) {
+            notDetected++;
+        } else {
+            late += (result.Outcome == CAMPAIGN_OUTCOME_LATE) ? 1U : 0U;
+            maxResponseMs = (result.ResponseMs > maxResponseMs) ? result.ResponseMs : maxResponseMs;
+        }
+    }
+    /* Known gap: a persistent short reaches the safe state after the FTTI */
+    ASSERT_GT(late, 0U);
+    ASSERT_GT(notDetected, 0U);
+
+    finding = { late, notDetected, maxResponseMs };
+    EXPECT_EQ(Campaign_CheckFinding(results.data(), numResults, CAMPAIGN_FAULT_ADC_SHORT, &finding),
+              E_OK);
+
+    /* One more late variant, undetected variant or slower reaction is a regression */
+    finding = { late - 1U, notDetected, maxResponseMs };
+    EXPECT_EQ(Campaign_CheckFinding(results.data(), numResults, CAMPAIGN_FAULT_ADC_SHORT, &finding),
+              E_NOT_OK);
+    finding = { late, notDetected - 1U, maxResponseMs };
+    EXPECT_EQ(Campaign_CheckFinding(results.data(), numResults, CAMPAIGN_FAULT_ADC_SHORT, &finding),
+              E_NOT_OK);
+    finding = { late, notDetected, maxResponseMs - 1U };
+    EXPECT_EQ(Campaign_CheckFinding(results.data(), numResults, CAMPAIGN_FAULT_ADC_SHORT, &finding),
+              E_NOT_OK);
+
+    EXPECT_EQ(Campaign_CheckFinding(NULL_PTR, numResults, CAMPAIGN_FAULT_ADC_SHORT, &finding),
+              E_NOT_OK);
+    EXPECT_EQ(Campaign_CheckFinding(results.data(), numResults, CAMPAIGN_FAULT_ADC_SHORT, NULL_PTR),
+              E_NOT_OK);
+}
+
+TEST_F(CampaignTest, DefaultFindings_NoGapOutsideTheKnownFaults) {
+    uint32_t i;
+
+    for (i = 0U; i < CAMPAIGN_NUM_FAULTS; i++) {
+        const Campaign_FindingType* finding = &Campaign_DefaultFindings[i];
+
+        if ((i == CAMPAIGN_FAULT_ADC_OPEN) || (i == CAMPAIGN_FAULT_ADC_SHORT) ||
+            (i == CAMPAIGN_FAULT_LAMP_OPEN_LOAD)) {
+            EXPECT_GT(finding->MaxResponseMs, FLM_FTTI_MS) << i;
+        } else {
+            EXPECT_EQ(finding->MaxLate, 0U) << i;
+            EXPECT_EQ(finding->MaxResponseMs, FLM_FTTI_MS) << i;
+        }
+    }
+}
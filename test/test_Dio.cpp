@@ -0,0 +1,290 @@
+/**
+ * @file test_Dio.cpp
+ * @brief Unit Tests for DIO Driver
+ * @details Tests packed port storage, direction masks, atomic group writes and
+ *          the GPIO character device backend against the gpio-sim module
+ *          (skipped without configfs access to gpio-sim)
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "MCAL/Dio/Dio.h"
+
+/** @brief gpio-sim configfs directory of the test chip */
+#define TEST_GPIO_SIM_DIR   "/sys/kernel/config/gpio-sim/flm_dio_test"
+
+/**
+ * @brief Simulated GPIO chip (gpio-sim) with one bank of 16 lines
+ */
+class GpioSimChip {
+public:
+    GpioSimChip() : live(false) {
+        if ((mkdir(TEST_GPIO_SIM_DIR, 0755) != 0) ||
+            (mkdir(TEST_GPIO_SIM_DIR "/bank0", 0755) != 0) ||
+            !WriteAttr(TEST_GPIO_SIM_DIR "/bank0/num_lines", "16") ||
+            !WriteAttr(TEST_GPIO_SIM_DIR "/live", "1")) {
+            return;
+        }
+        chipName = ReadAttr(TEST_GPIO_SIM_DIR "/bank0/chip_name");
+        devName = ReadAttr(TEST_GPIO_SIM_DIR "/dev_name");
+        live = !chipName.empty() && !devName.empty();
+    }
+
+    ~GpioSimChip() {
+        (void)WriteAttr(TEST_GPIO_SIM_DIR "/live", "0");
+        (void)rmdir(TEST_GPIO_SIM_DIR "/bank0");
+        (void)rmdir(TEST_GPIO_SIM_DIR);
+    }
+
+    bool IsLive() const { return live; }
+
+    std::string ChipPath() const { return "/dev/" + chipName; }
+
+    /** @brief Level the driver drives on a line */
+    int LineValue(uint32_t line) const {
+        std::string value = ReadAttr(LineDir(line) + "/value");
+        return value.empty() ? -1 : std::stoi(value);
+    }
+
+    /** @brief Drive an input line through its simulated pull */
+    bool SetPull(uint32_t line, bool high) const {
+        return WriteAttr(LineDir(line) + "/pull", high ? "pull-up" : "pull-down");
+    }
+
+private:
+    std::string LineDir(uint32_t line) const {
+        return "/sys/devices/platform/" + devName + "/" + chipName +
+               "/sim_gpio" + std::to_string(line);
+    }
+
+    static bool WriteAttr(const std::string& path, const char* value) {
+        std::ofstream file(path);
+        file << value;
+        file.flush();
+        return file.good();
+    }
+
+    static std::string ReadAttr(const std::string& path) {
+        std::ifstream file(path);
+        std::string value;
+        std::getline(file, value);
+        return value;
+    }
+
+    bool live;
+    std::string chipName;
+    std::string devName;
+};
+
+/**
+ * @brief Dio Test Fixture
+ */
+class DioTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Dio_Init();
+    }
+
+    void TearDown() override {
+        Dio_DeInit();
+    }
+};
+
+/*============================================================================*
+ * CHANNEL AND PORT TESTS
+ *============================================================================*/
+
+TEST_F(DioTest, Init_OutputsLow) {
+    EXPECT_EQ(Dio_ReadPort(0U), 0U);
+    EXPECT_EQ(Dio_SimGetOutputPort(0U), 0U);
+}
+
+TEST_F(DioTest, WriteChannel_SetsPortBit) {
+    Dio_WriteChannel(DIO_CHANNEL_HIGH_BEAM, STD_HIGH);
+
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_HIGH_BEAM), STD_HIGH);
+    EXPECT_EQ(Dio_ReadPort(0U), 0x02U);
+}
+
+TEST_F(DioTest, WritePort_IgnoresInputChannels) {
+    Dio_WritePort(0U, 0xFFU);
+
+    /* Channels 0, 1, 3 and 4 are outputs; feedback (2) and 5..7 are inputs */
+    EXPECT_EQ(Dio_SimGetOutputPort(0U), 0x1BU);
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_FEEDBACK), STD_LOW);
+}
+
+TEST_F(DioTest, ReadPort_MergesInputsAndOutputs) {
+    Dio_SimSetInput(DIO_CHANNEL_FEEDBACK, STD_HIGH);
+    Dio_SimSetInput(DIO_CHANNEL_LOW_BEAM, STD_HIGH);  /* Output: not visible */
+    Dio_WriteChannel(DIO_CHANNEL_ERROR_LED, STD_HIGH);
+
+    EXPECT_EQ(Dio_ReadPort(0U), 0x14U);
+}
+
+TEST_F(DioTest, FlipChannel_TogglesOutputOnly) {
+    EXPECT_EQ(Dio_FlipChannel(DIO_CHANNEL_STATUS_LED), STD_HIGH);
+    EXPECT_EQ(Dio_FlipChannel(DIO_CHANNEL_STATUS_LED), STD_LOW);
+
+    Dio_SimSetInput(DIO_CHANNEL_FEEDBACK, STD_HIGH);
+    EXPECT_EQ(Dio_FlipChannel(DIO_CHANNEL_FEEDBACK), STD_HIGH);
+    EXPECT_EQ(Dio_SimGetOutputPort(0U), 0U);
+}
+
+TEST_F(DioTest, ChannelGroup_ShiftAndMask) {
+    const Dio_ChannelGroupType group = {0x18U, 3U, 0U};  /* Status and error LED */
+
+    Dio_WriteChannel(DIO_CHANNEL_LOW_BEAM, STD_HIGH);
+    Dio_WriteChannelGroup(&group, 0x03U);
+
+    EXPECT_EQ(Dio_SimGetOutputPort(0U), 0x19U);
+    EXPECT_EQ(Dio_ReadChannelGroup(&group), 0x03U);
+
+    Dio_WriteChannelGroup(&group, 0x02U);
+    EXPECT_EQ(Dio_SimGetOutputPort(0U), 0x11U);
+}
+
+TEST_F(DioTest, InvalidPortAndGroup_Ignored) {
+    const Dio_ChannelGroupType group = {0x03U, 0U, DIO_NUM_PORTS};
+
+    Dio_WritePort(DIO_NUM_PORTS, 0xFFU);
+    Dio_WriteChannelGroup(&group, 0x03U);
+    Dio_WriteChannelGroup(NULL_PTR, 0x03U);
+
+    EXPECT_EQ(Dio_ReadPort(DIO_NUM_PORTS), 0U);
+    EXPECT_EQ(Dio_ReadChannelGroup(&group), 0U);
+    EXPECT_EQ(Dio_SimGetOutputPort(0U), 0U);
+}
+
+/*============================================================================*
+ * ATOMICITY TESTS
+ *============================================================================*/
+
+TEST_F(DioTest, GroupWrite_NeverHalfWritten) {
+    const Dio_ChannelGroupType beams = {0x03U, 0U, 0U};
+    std::atomic<boolean> stop(FALSE);
+    std::atomic<uint32_t> torn(0U);
+    uint32_t i;
+
+    std::thread monitor([&]() {
+        while (!stop) {
+            Dio_PortLevelType level =
+                static_cast<Dio_PortLevelType>(Dio_SimGetOutputPort(0U) & 0x03U);
+            if ((level == 0x01U) || (level == 0x02U)) {
+                torn++;
+            }
+        }
+    });
+
+    /* Beams switch together; the LED channel is written concurrently */
+    for (i = 0U; i < 20000U; i++) {
+        Dio_WriteChannelGroup(&beams, ((i & 1U) != 0U) ? 0x03U : 0x00U);
+        Dio_FlipChannel(DIO_CHANNEL_STATUS_LED);
+    }
+
+    stop = TRUE;
+    monitor.join();
+
+    EXPECT_EQ(torn.load(), 0U);
+    EXPECT_EQ(Dio_SimGetOutputPort(0U) & 0x03U, 0x03U);
+}
+
+/*============================================================================*
+ * GPIO CHARACTER DEVICE BACKEND TESTS
+ *============================================================================*/
+
+TEST_F(DioTest, GpioChip_Unavailable) {
+    const Dio_ConfigType config = {DIO_BACKEND_GPIO_CDEV, "/nonexistent/gpiochip", NULL_PTR};
+
+    EXPECT_EQ(Dio_SetBackend(&config), E_NOT_OK);
+
+    /* Stays on the simulation backend */
+    Dio_WriteChannel(DIO_CHANNEL_LOW_BEAM, STD_HIGH);
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_LOW_BEAM), STD_HIGH);
+}
+
+TEST_F(DioTest, GpioSim_GroupWriteOneIoctl) {
+    GpioSimChip chip;
+    const Dio_ChannelGroupType beams = {0x03U, 0U, 0U};
+    Dio_GpioStatsType before;
+    Dio_GpioStatsType after;
+
+    if (!chip.IsLive()) {
+        GTEST_SKIP() << "gpio-sim not available";
+    }
+
+    const std::string path = chip.ChipPath();
+    const Dio_ConfigType config = {DIO_BACKEND_GPIO_CDEV, path.c_str(), NULL_PTR};
+    ASSERT_EQ(Dio_SetBackend(&config), E_OK);
+
+    Dio_GetGpioStats(&before);
+    Dio_WriteChannelGroup(&beams, 0x03U);
+    Dio_GetGpioStats(&after);
+
+    EXPECT_EQ(after.SetValuesCalls - before.SetValuesCalls, 1U);
+    EXPECT_GT(after.LastSetValuesNs, 0U);
+    EXPECT_EQ(chip.LineValue(DIO_CHANNEL_LOW_BEAM), 1);
+    EXPECT_EQ(chip.LineValue(DIO_CHANNEL_HIGH_BEAM), 1);
+    EXPECT_EQ(chip.LineValue(DIO_CHANNEL_STATUS_LED), 0);
+
+    /* Unchanged register: no ioctl */
+    Dio_WriteChannelGroup(&beams, 0x03U);
+    Dio_GetGpioStats(&before);
+    EXPECT_EQ(before.SetValuesCalls, after.SetValuesCalls);
+
+    Dio_WriteChannel(DIO_CHANNEL_HIGH_BEAM, STD_LOW);
+    EXPECT_EQ(chip.LineValue(DIO_CHANNEL_LOW_BEAM), 1);
+    EXPECT_EQ(chip.LineValue(DIO_CHANNEL_HIGH_BEAM), 0);
+}
+
+TEST_F(DioTest, GpioSim_ReadInputLine) {
+    GpioSimChip chip;
+
+    if (!chip.IsLive()) {
+        GTEST_SKIP() << "gpio-sim not available";
+    }
+
+    const std::string path = chip.ChipPath();
+    const Dio_ConfigType config = {DIO_BACKEND_GPIO_CDEV, path.c_str(), NULL_PTR};
+    ASSERT_EQ(Dio_SetBackend(&config), E_OK);
+
+    ASSERT_TRUE(chip.SetPull(DIO_CHANNEL_FEEDBACK, true));
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_FEEDBACK), STD_HIGH);
+
+    ASSERT_TRUE(chip.SetPull(DIO_CHANNEL_FEEDBACK, false));
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_FEEDBACK), STD_LOW);
+}
+
+TEST_F(DioTest, GpioSim_LineMappingAndDirection) {
+    GpioSimChip chip;
+    uint32_t lines[DIO_NUM_CHANNELS];
+    uint32_t i;
+
+    if (!chip.IsLive()) {
+        GTEST_SKIP() << "gpio-sim not available";
+    }
+
+    /* Reverse mapping: channel n on line 15 - n */
+    for (i = 0U; i < DIO_NUM_CHANNELS; i++) {
+        lines[i] = 15U - i;
+    }
+
+    const std::string path = chip.ChipPath();
+    const Dio_ConfigType config = {DIO_BACKEND_GPIO_CDEV, path.c_str(), lines};
+    ASSERT_EQ(Dio_SetBackend(&config), E_OK);
+
+    Dio_WriteChannel(DIO_CHANNEL_ERROR_LED, STD_HIGH);
+    EXPECT_EQ(chip.LineValue(15U - DIO_CHANNEL_ERROR_LED), 1);
+
+    /* Channel 8 becomes an output on line 7 */
+    Dio_SimSetDirection(8U, TRUE);
+    Dio_WriteChannel(8U, STD_HIGH);
+    EXPECT_EQ(chip.LineValue(7U), 1);
+}
@@ -0,0 +1,177 @@
+/**
+ * @file test_EcuM.cpp
+ * @brief Unit Tests for ECU State Manager
+ * @details Tests dependency ordering, startup profile and warm restart of
+ *          the startup sequencer
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "BSW/EcuM/EcuM.h"
+#include "BSW/BswM/BswM.h"
+#include "BSW/Dem/Dem.h"
+#include "MCAL/Can/Can.h"
+
+/**
+ * @brief EcuM Test Fixture
+ */
+class EcuMTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        config.MaxParallelInit = ECUM_MAX_PARALLEL_INIT;
+    }
+
+    void TearDown() override {
+        EcuM_GoDown(ECUM_STARTUP_COLD);
+    }
+
+    /** @brief Every item started after all of its dependencies returned */
+    static void ExpectDependencyOrder(void) {
+        const EcuM_StartupProfileType* profile = EcuM_GetStartupProfile();
+        uint8_t i;
+        uint8_t dep;
+
+        for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+            if (!profile->Items[i].Executed) {
+                continue;
+            }
+            for (dep = 0U; dep < ECUM_NUM_INIT_ITEMS; dep++) {
+                if ((EcuM_InitItemConfig[i].DependsOn & ECUM_DEP(dep)) != 0U) {
+                    if (profile->Items[dep].Executed) {
+                        EXPECT_GE(profile->Items[i].StartNs, profile->Items[dep].EndNs)
+                            << EcuM_InitItemConfig[i].Name << " after "
+                            << EcuM_InitItemConfig[dep].Name;
+                        EXPECT_GT(profile->Items[i].Wave, profile->Items[dep].Wave);
+                    }
+                }
+            }
+        }
+    }
+
+    EcuM_ConfigType config;
+};
+
+/**
+ * @test Cold start initializes every item in dependency order
+ */
+TEST_F(EcuMTest, ColdStart_DependencyOrder) {
+    const EcuM_StartupProfileType* profile;
+    uint8_t i;
+
+    ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_COLD), E_OK);
+    EXPECT_EQ(EcuM_GetState(), ECUM_STATE_RUN);
+
+    profile = EcuM_GetStartupProfile();
+    EXPECT_EQ(profile->StartupType, ECUM_STARTUP_COLD);
+    EXPECT_GT(profile->NumWaves, 1U);
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        EXPECT_TRUE(profile->Items[i].Executed) << EcuM_InitItemConfig[i].Name;
+        EXPECT_TRUE(EcuM_IsItemInitialized(i));
+        EXPECT_LE(profile->Items[i].EndNs, profile->TotalNs);
+    }
+    ExpectDependencyOrder();
+
+    /* Second start without shutdown is rejected */
+    EXPECT_EQ(EcuM_Init(&config, ECUM_STARTUP_COLD), E_NOT_OK);
+}
+
+/**
+ * @test Serial startup runs all items on the calling thread
+ */
+TEST_F(EcuMTest, SerialStart_SingleWorker) {
+    const EcuM_StartupProfileType* profile;
+    uint8_t i;
+
+    config.MaxParallelInit = 1U;
+    ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_COLD), E_OK);
+
+    profile = EcuM_GetStartupProfile();
+    EXPECT_EQ(profile->MaxParallelInit, 1U);
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        EXPECT_EQ(profile->Items[i].Worker, 0U);
+    }
+    ExpectDependencyOrder();
+}
+
+/**
+ * @test Phase profile aggregates the item profiles
+ */
+TEST_F(EcuMTest, StartupProfile_Phases) {
+    const EcuM_StartupProfileType* profile;
+    uint8_t numExecuted = 0U;
+    uint8_t i;
+
+    ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_COLD), E_OK);
+
+    profile = EcuM_GetStartupProfile();
+    for (i = 0U; i < ECUM_NUM_PHASES; i++) {
+        numExecuted = static_cast<uint8_t>(numExecuted + profile->Phases[i].NumExecuted);
+        EXPECT_GT(profile->Phases[i].NumExecuted, 0U);
+        EXPECT_LE(profile->Phases[i].StartNs, profile->Phases[i].EndNs);
+        EXPECT_LE(profile->Phases[i].EndNs, profile->TotalNs);
+    }
+    EXPECT_EQ(numExecuted, ECUM_NUM_INIT_ITEMS);
+    EXPECT_LE(profile->Phases[ECUM_PHASE_MCAL].StartNs, profile->Phases[ECUM_PHASE_SWC].StartNs);
+}
+
+/**
+ * @test Warm restart keeps preserved state and re-initializes the rest
+ */
+TEST_F(EcuMTest, WarmStart_SkipsPreservedItems) {
+    const EcuM_StartupProfileType* profile;
+    Dem_UdsStatusByteType status = 0U;
+    Can_ControllerStateType canState = CAN_CS_UNINIT;
+    BswM_ModeType mode = BSWM_MODE_SLEEP;
+    uint8_t i;
+
+    ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_COLD), E_OK);
+    ASSERT_EQ(Dem_SetEventStatus(DEM_EVENT_WDGM_SUPERVISION_FAILED, DEM_EVENT_STATUS_FAILED), E_OK);
+
+    EcuM_GoDown(ECUM_STARTUP_WARM);
+    EXPECT_EQ(EcuM_GetState(), ECUM_STATE_UNINIT);
+    EXPECT_TRUE(EcuM_IsItemInitialized(ECUM_ITEM_DEM));
+    EXPECT_FALSE(EcuM_IsItemInitialized(ECUM_ITEM_BSWM));
+
+    ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_WARM), E_OK);
+
+    profile = EcuM_GetStartupProfile();
+    EXPECT_EQ(profile->StartupType, ECUM_STARTUP_WARM);
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        EXPECT_NE(profile->Items[i].Executed, EcuM_InitItemConfig[i].PreservedOnWarmStart)
+            << EcuM_InitItemConfig[i].Name;
+    }
+    ExpectDependencyOrder();
+
+    /* Event memory survived, the rest of the stack is running again */
+    ASSERT_EQ(Dem_GetEventStatus(DEM_EVENT_WDGM_SUPERVISION_FAILED, &status), E_OK);
+    EXPECT_NE(status & DEM_UDS_STATUS_TF, 0U);
+    ASSERT_EQ(Can_GetControllerMode(BSWM_CAN_CONTROLLER, &canState), E_OK);
+    BswM_MainFunction();
+    EXPECT_EQ(BswM_GetCurrentMode(&mode), E_OK);
+    EXPECT_EQ(mode, BSWM_MODE_RUN);
+}
+
+/**
+ * @test Warm start after a cold shutdown falls back to a cold start
+ */
+TEST_F(EcuMTest, WarmStart_AfterColdShutdown_IsCold) {
+    const EcuM_StartupProfileType* profile;
+    Dem_UdsStatusByteType status = 0xFFU;
+    uint8_t i;
+
+    ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_COLD), E_OK);
+    ASSERT_EQ(Dem_SetEventStatus(DEM_EVENT_WDGM_SUPERVISION_FAILED, DEM_EVENT_STATUS_FAILED), E_OK);
+    EcuM_GoDown(ECUM_STARTUP_COLD);
+    EXPECT_FALSE(EcuM_IsItemInitialized(ECUM_ITEM_DEM));
+
+    ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_WARM), E_OK);
+
+    profile = EcuM_GetStartupProfile();
+    EXPECT_EQ(profile->StartupType, ECUM_STARTUP_COLD);
+    for (i = 0U; i < ECUM_NUM_INIT_ITEMS; i++) {
+        EXPECT_TRUE(profile->Items[i].Executed);
+    }
+    ASSERT_EQ(Dem_GetEventStatus(DEM_EVENT_WDGM_SUPERVISION_FAILED, &status), E_OK);
+    EXPECT_EQ(status & DEM_UDS_STATUS_TF, 0U);
+}
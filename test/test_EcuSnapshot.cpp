@@ -0,0 +1,222 @@
+/**
+ * @file test_EcuSnapshot.cpp
+ * @brief Unit Tests for the ECU State Snapshot
+ * @details Runs the started ECU in virtual time, forks runs from one saved
+ *          state and checks that a restored ECU repeats the run exactly
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "BSW/EcuM/Ecu_Snapshot.h"
+#include "BSW/EcuM/EcuM.h"
+#include "BSW/E2E/E2E_P01.h"
+#include "FLM_Config.h"
+#include <cstring>
+#include <vector>
+
+/** @brief Warm-up before the snapshot (ms) */
+#define TEST_SNAPSHOT_WARMUP_MS     1000U
+
+/** @brief Run after the snapshot (ms) */
+#define TEST_SNAPSHOT_RUN_MS        1000U
+
+/**
+ * @brief ECU Snapshot Test Fixture
+ * @details 1ms ticks in virtual time with the task split of the main
+ *          scheduler; the ambient light ramps and the light switch is
+ *          received every 10ms
+ */
+class EcuSnapshotTest : public ::testing::Test {
+protected:
+    EcuM_ConfigType config;
+    E2E_P01ConfigType e2eConfig;
+    E2E_P01ProtectStateType e2eProtectState;
+    uint32_t tickMs;
+
+    void SetUp() override {
+        config.MaxParallelInit = 1U;
+        Adc_SimSetTimeUs(0U);
+        Pwm_SimSetTimeUs(0U);
+        WdgM_SimSetTimeUs(0U);
+        ASSERT_EQ(EcuM_Init(&config, ECUM_STARTUP_COLD), E_OK);
+
+        e2eConfig.DataLength = FLM_E2E_LIGHTSWITCH_DATA_LENGTH;
+        e2eConfig.DataID = FLM_E2E_LIGHTSWITCH_DATA_ID;
+        e2eConfig.CounterOffset = FLM_E2E_COUNTER_OFFSET;
+        e2eConfig.CRCOffset = FLM_E2E_CRC_OFFSET;
+        E2E_P01ProtectInit(&e2eProtectState);
+        tickMs = 0U;
+    }
+
+    void TearDown() override {
+        EcuM_GoDown(ECUM_STARTUP_COLD);
+    }
+
+    /** @brief One tick; returns the outputs observed after it */
+    std::vector<uint32_t> RunTick(LightSwitchCmd lightSwitch) {
+        const uint64_t timeUs = static_cast<uint64_t>(tickMs) * 1000U;
+        std::vector<uint32_t> outputs;
+        Pwm_SimChannelType lowBeam;
+        uint16_t numEvents = 0U;
+
+        Adc_SimSetTimeUs(timeUs);
+        Pwm_SimSetTimeUs(timeUs);
+        WdgM_SimSetTimeUs(static_cast<uint32_t>(timeUs));
+        /* Dusk: 2000 counts falling to 500 over 2s */
+        Adc_SimSetValue(FLM_ADC_CHANNEL_AMBIENT,
+                        static_cast<Adc_ValueGroupType>(2000U - ((tickMs % 2000U) * 3U / 4U)));
+        Adc_MainFunction();
+
+        if ((tickMs % 5U) == 0U) {
+            SafetyMonitor_MainFunction();
+            WdgM_MainFunction();
+            BswM_MainFunction();
+        }
+        if ((tickMs % 10U) == 0U) {
+            uint8_t data[4] = {0};
+            PduInfoType pduInfo;
+
+            data[COM_LIGHTSWITCH_CMD_BYTE] = static_cast<uint8_t>(lightSwitch);
+            E2E_P01Protect(&e2eConfig, &e2eProtectState, data, 4U);
+            pduInfo.SduDataPtr = data;
+            pduInfo.MetaDataPtr = NULL_PTR;
+            pduInfo.SduLength = 4U;
+            Com_RxIndication(COM_IPDU_LIGHTSWITCH_RX, &pduInfo);
+
+            Com_MainFunctionRx();
+            Can_MainFunction_Read();
+            SwitchEvent_MainFunction();
+            FLM_MainFunction();
+            Headlight_MainFunction();
+            Can_MainFunction_Write();
+            Com_MainFunctionTx();
+            Dem_MainFunction();
+        }
+        if ((tickMs % 20U) == 0U) {
+            LightRequest_MainFunction();
+        }
+        tickMs++;
+
+        (void)Pwm_SimGetChannel(PWM_CHANNEL_LOW_BEAM, &lowBeam);
+        (void)Dem_GetNumberOfEvents(&numEvents);
+        outputs.push_back(Dio_SimGetOutputPort(0U));
+        outputs.push_back(lowBeam.DutyCycle);
+        outputs.push_back(static_cast<uint32_t>(FLM_GetCurrentState()));
+        outputs.push_back(Headlight_GetState()->feedbackCurrent);
+        outputs.push_back(LightRequest_GetState()->ambientLight.adcValue);
+        outputs.push_back(static_cast<uint32_t>(SwitchEvent_GetState()->e2eSmStatus));
+        outputs.push_back(Can_SimGetTxCount());
+        outputs.push_back(Rte_GetPortSequence(RTE_PORT_HEADLIGHTCMD));
+        outputs.push_back(numEvents);
+        return outputs;
+    }
+
+    /** @brief Run; returns the outputs of every tick */
+    std::vector<std::vector<uint32_t>> Run(uint32_t durationMs, LightSwitchCmd lightSwitch) {
+        std::vector<std::vector<uint32_t>> trace;
+        uint32_t i;
+
+        for (i = 0U; i < durationMs; i++) {
+            trace.push_back(RunTick(lightSwitch));
+        }
+        return trace;
+    }
+};
+
+/*============================================================================*
+ * RESTORE TESTS
+ *============================================================================*/
+
+TEST_F(EcuSnapshotTest, Restore_RepeatsRunFromSnapshot) {
+    static Ecu_SnapshotType snapshot;
+    std::vector<std::vector<uint32_t>> first;
+    std::vector<std::vector<uint32_t>> second;
+    E2E_P01ProtectStateType senderState;
+
+    (void)Run(TEST_SNAPSHOT_WARMUP_MS, LIGHT_SWITCH_AUTO);
+    ASSERT_EQ(FLM_GetCurrentState(), FLM_STATE_NORMAL);
+    ASSERT_EQ(Ecu_SaveSnapshot(&snapshot), E_OK);
+    EXPECT_EQ(snapshot.Header.Magic, ECU_SNAPSHOT_MAGIC);
+    EXPECT_EQ(snapshot.Header.Version, ECU_SNAPSHOT_VERSION);
+    EXPECT_EQ(snapshot.Header.Size, sizeof(Ecu_SnapshotType));
+
+    senderState = e2eProtectState;
+    first = Run(TEST_SNAPSHOT_RUN_MS, LIGHT_SWITCH_AUTO);
+    /* The dusk turned the lights on after the snapshot */
+    EXPECT_NE(first.front()[1], first.back()[1]);
+
+    ASSERT_EQ(Ecu_RestoreSnapshot(&snapshot), E_OK);
+    EXPECT_EQ(FLM_GetState()->currentTime, snapshot.Flm.State.currentTime);
+    e2eProtectState = senderState;
+    tickMs = TEST_SNAPSHOT_WARMUP_MS;
+    second = Run(TEST_SNAPSHOT_RUN_MS, LIGHT_SWITCH_AUTO);
+
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(EcuSnapshotTest, Restore_ForksFromCopiedBlob) {
+    static Ecu_SnapshotType snapshot;
+    static Ecu_SnapshotType copy;
+    std::vector<uint8_t> blob(sizeof(Ecu_SnapshotType));
+    std::vector<std::vector<uint32_t>> autoRun;
+    std::vector<std::vector<uint32_t>> offRun;
+    E2E_P01ProtectStateType senderState;
+
+    (void)Run(TEST_SNAPSHOT_WARMUP_MS, LIGHT_SWITCH_AUTO);
+    ASSERT_EQ(Ecu_SaveSnapshot(&snapshot), E_OK);
+    (void)std::memcpy(blob.data(), &snapshot, blob.size());
+    senderState = e2eProtectState;
+
+    /* Fork 1: automatic mode */
+    autoRun = Run(TEST_SNAPSHOT_RUN_MS, LIGHT_SWITCH_AUTO);
+
+    /* Fork 2 from the copy: driver switches the lights off */
+    (void)std::memcpy(&copy, blob.data(), blob.size());
+    ASSERT_EQ(Ecu_RestoreSnapshot(&copy), E_OK);
+    e2eProtectState = senderState;
+    tickMs = TEST_SNAPSHOT_WARMUP_MS;
+    offRun = Run(TEST_SNAPSHOT_RUN_MS, LIGHT_SWITCH_OFF);
+    EXPECT_NE(autoRun, offRun);
+    EXPECT_EQ(offRun.back()[1], 0U);
+
+    /* Fork 1 again from the copy */
+    ASSERT_EQ(Ecu_RestoreSnapshot(&copy), E_OK);
+    e2eProtectState = senderState;
+    tickMs = TEST_SNAPSHOT_WARMUP_MS;
+    EXPECT_EQ(Run(TEST_SNAPSHOT_RUN_MS, LIGHT_SWITCH_AUTO), autoRun);
+}
+
+/*============================================================================*
+ * BLOB FORMAT TESTS
+ *============================================================================*/
+
+TEST_F(EcuSnapshotTest, Restore_RejectsInvalidBlob) {
+    static Ecu_SnapshotType snapshot;
+    uint32_t currentTime;
+
+    EXPECT_EQ(Ecu_SaveSnapshot(NULL_PTR), E_NOT_OK);
+    EXPECT_EQ(Ecu_RestoreSnapshot(NULL_PTR), E_NOT_OK);
+
+    ASSERT_EQ(Ecu_SaveSnapshot(&snapshot), E_OK);
+    (void)Run(100U, LIGHT_SWITCH_AUTO);
+    currentTime = FLM_GetState()->currentTime;
+
+    snapshot.Header.Magic ^= 1U;
+    EXPECT_EQ(Ecu_RestoreSnapshot(&snapshot), E_NOT_OK);
+    snapshot.Header.Magic ^= 1U;
+
+    snapshot.Header.Version++;
+    EXPECT_EQ(Ecu_RestoreSnapshot(&snapshot), E_NOT_OK);
+    snapshot.Header.Version--;
+
+    snapshot.Header.Size--;
+    EXPECT_EQ(Ecu_RestoreSnapshot(&snapshot), E_NOT_OK);
+    snapshot.Header.Size++;
+
+    /* Nothing restored */
+    EXPECT_EQ(FLM_GetState()->currentTime, currentTime);
+
+    EXPECT_EQ(Ecu_RestoreSnapshot(&snapshot), E_OK);
+    EXPECT_NE(FLM_GetState()->currentTime, currentTime);
+}
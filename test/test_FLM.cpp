@@ -25,7 +25,7 @@ protected:
 
     void SetUp() override {
         /* Initialize MCAL */
-        static const Adc_ConfigType adcConfig = {0};
+        static const Adc_ConfigType adcConfig = {};
         Adc_Init(&adcConfig);
         Dio_Init();
 
@@ -213,3 +213,79 @@ TEST_F(FLMTest, StateAccess) {
     EXPECT_NE(state, nullptr);
     EXPECT_TRUE(state->isInitialized);
 }
+
+/*============================================================================*
+ * TRANSITION TABLE TESTS
+ *============================================================================*/
+
+/**
+ * @test Every transition leaves its configured source state
+ */
+TEST_F(FLMTest, TransitionTable_Consistent) {
+    for (uint32_t i = 0U; i < FLM_NUM_TRANSITIONS; i++) {
+        const FLM_TransitionConfigType* transition = &FLM_TransitionConfig[i];
+
+        EXPECT_NE(transition->Name, nullptr);
+        EXPECT_LT(static_cast<uint32_t>(transition->FromState), FLM_NUM_STATES);
+        EXPECT_LT(static_cast<uint32_t>(transition->ToState), FLM_NUM_STATES);
+        EXPECT_NE(transition->FromState, FLM_STATE_SAFE);
+        EXPECT_NE(transition->FromState, transition->ToState);
+        EXPECT_EQ(transition->GuardValue & ~transition->GuardMask, 0U);
+    }
+}
+
+/**
+ * @test Lost light switch frames lead through DEGRADED to SAFE within the FTTI
+ */
+TEST_F(FLMTest, TransitionCoverage_DegradedTimeout) {
+    uint32_t hits = 0U;
+    uint32_t degradedCycles = 0U;
+    int i;
+
+    for (i = 0; i < 10; i++) {
+        SendValidMessage(LIGHT_SWITCH_LOW_BEAM);
+        RunAllTasks();
+    }
+    ASSERT_EQ(FLM_GetCurrentState(), FLM_STATE_NORMAL);
+
+    /* No more frames */
+    for (i = 0; (i < 100) && (FLM_GetCurrentState() != FLM_STATE_SAFE); i++) {
+        RunAllTasks();
+        if (FLM_GetCurrentState() == FLM_STATE_DEGRADED) {
+            degradedCycles++;
+        }
+    }
+
+    EXPECT_EQ(FLM_GetCurrentState(), FLM_STATE_SAFE);
+    EXPECT_EQ(degradedCycles, ((FLM_FTTI_MS - FLM_SAFE_STATE_TRANSITION_MS) / FLM_MAIN_FUNCTION_PERIOD_MS) + 1U);
+
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_TRANSITION_INIT_NORMAL, &hits), E_OK);
+    EXPECT_EQ(hits, 1U);
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_TRANSITION_NORMAL_DEGRADED, &hits), E_OK);
+    EXPECT_EQ(hits, 1U);
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_TRANSITION_DEGRADED_SAFE_TIMEOUT, &hits), E_OK);
+    EXPECT_EQ(hits, 1U);
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_TRANSITION_DEGRADED_NORMAL, &hits), E_OK);
+    EXPECT_EQ(hits, 0U);
+}
+
+/**
+ * @test Safe state request has priority and SAFE is final
+ */
+TEST_F(FLMTest, TransitionCoverage_SafeRequestFromInit) {
+    uint32_t hits = 0U;
+
+    FLM_TriggerSafeState(SAFE_STATE_REASON_MANUAL);
+    for (int i = 0; i < 10; i++) {
+        SendValidMessage(LIGHT_SWITCH_LOW_BEAM);
+        RunAllTasks();
+    }
+
+    EXPECT_EQ(FLM_GetCurrentState(), FLM_STATE_SAFE);
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_TRANSITION_INIT_SAFE_REQUEST, &hits), E_OK);
+    EXPECT_EQ(hits, 1U);
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_TRANSITION_INIT_NORMAL, &hits), E_OK);
+    EXPECT_EQ(hits, 0U);
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_NUM_TRANSITIONS, &hits), E_NOT_OK);
+    EXPECT_EQ(FLM_GetTransitionCoverage(FLM_TRANSITION_INIT_NORMAL, nullptr), E_NOT_OK);
+}
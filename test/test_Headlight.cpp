@@ -0,0 +1,416 @@
+/**
+ * @file test_Headlight.cpp
+ * @brief Unit Tests for Headlight SWC, PWM Driver and Lamp Model
+ * @details Tests soft-start and fade ramps of the output stages, the
+ *          current sense statistics window and the output stage diagnosis
+ *          (blanking, debouncing) against the simulated lamp currents
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Application/Headlight/Headlight.h"
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/LightRequest/LightRequest.h"
+#include "Application/FLM/FLM_Application.h"
+#include "BSW/E2E/E2E_P01.h"
+#include "BSW/Cal/Cal.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Pwm/Pwm.h"
+#include "Sim/Lamp/Lamp.h"
+#include "FLM_Config.h"
+
+/**
+ * @brief Headlight Test Fixture
+ * @details Runs the 1ms tick of the application in virtual time with the
+ *          lamp model on the current sense
+ */
+class HeadlightTest : public ::testing::Test {
+protected:
+    E2E_P01ConfigType e2eConfig;
+    E2E_P01ProtectStateType e2eProtectState;
+    uint64_t timeUs;
+
+    void SetUp() override {
+        static const Adc_ConfigType adcConfig = {};
+
+        timeUs = 0U;
+        Adc_SimSetTimeUs(0U);
+        Pwm_SimSetTimeUs(0U);
+
+        /* Initialize MCAL */
+        Adc_Init(&adcConfig);
+        Dio_Init();
+        Pwm_Init();
+        Cal_Init(&Cal_Config);
+
+        /* Initialize SWCs */
+        SwitchEvent_Init();
+        LightRequest_Init();
+        FLM_Init();
+        Headlight_Init();
+        Lamp_Init();
+
+        /* Configure E2E */
+        e2eConfig.DataLength = FLM_E2E_LIGHTSWITCH_DATA_LENGTH;
+        e2eConfig.DataID = FLM_E2E_LIGHTSWITCH_DATA_ID;
+        e2eConfig.CounterOffset = FLM_E2E_COUNTER_OFFSET;
+        e2eConfig.CRCOffset = FLM_E2E_CRC_OFFSET;
+        E2E_P01ProtectInit(&e2eProtectState);
+
+        /* Set valid ambient light */
+        LightRequest_SimSetAdcValue(2000);
+
+        /* FLM leaves INIT with the lights off */
+        RunCycles(LIGHT_SWITCH_OFF, 10U);
+    }
+
+    void TearDown() override {
+        Lamp_DeInit();
+        Cal_DeInit();
+        Pwm_DeInit();
+        Adc_DeInit();
+    }
+
+    /** @brief Advance virtual time by 1ms ticks */
+    void RunTicks(uint32_t ticks) {
+        uint32_t tick;
+
+        for (tick = 0U; tick < ticks; tick++) {
+            timeUs += 1000U;
+            Adc_SimSetTimeUs(timeUs);
+            Pwm_SimSetTimeUs(timeUs);
+            Adc_MainFunction();
+        }
+    }
+
+    /** @brief Run one 10ms cycle: ten ticks, then the 10ms runnables */
+    void RunCycle(LightSwitchCmd cmd) {
+        RunTicks(10U);
+        RunRunnables(cmd);
+    }
+
+    /** @brief Run the 10ms runnables */
+    void RunRunnables(LightSwitchCmd cmd) {
+        uint8_t data[4] = {0};
+
+        data[COM_LIGHTSWITCH_CMD_BYTE] = static_cast<uint8_t>(cmd);
+        E2E_P01Protect(&e2eConfig, &e2eProtectState, data, 4);
+        SwitchEvent_ProcessCanMessage(data, 4);
+        SwitchEvent_MainFunction();
+        LightRequest_MainFunction();
+        FLM_MainFunction();
+        Headlight_MainFunction();
+    }
+
+    void RunCycles(LightSwitchCmd cmd, uint32_t cycles) {
+        uint32_t i;
+
+        for (i = 0U; i < cycles; i++) {
+            RunCycle(cmd);
+        }
+    }
+
+    /** @brief Run until the headlight takes over the command (at most 20 cycles) */
+    void RunUntilCommand(LightSwitchCmd cmd, HeadlightCommand expected) {
+        uint32_t i;
+
+        for (i = 0U; (i < 20U) && (Headlight_GetState()->requestedCommand != expected); i++) {
+            RunCycle(cmd);
+        }
+        ASSERT_EQ(Headlight_GetState()->requestedCommand, expected);
+    }
+};
+
+/*============================================================================*
+ * PWM DRIVER TESTS
+ *============================================================================*/
+
+TEST_F(HeadlightTest, Pwm_OutputStateFollowsDutyCycle) {
+    const uint64_t onUs = timeUs + PWM_HIGH_BEAM_PHASE_US;
+
+    Pwm_SimSetTimeUs(timeUs);
+    Pwm_SetDutyCycle(PWM_CHANNEL_HIGH_BEAM, PWM_DUTY_100_PERCENT / 4U);
+    Pwm_SetDutyCycle(PWM_CHANNEL_LOW_BEAM, PWM_DUTY_100_PERCENT / 4U);
+
+    /* High beam on phase starts half a period after the low beam one */
+    EXPECT_EQ(Pwm_GetOutputState(PWM_CHANNEL_LOW_BEAM), PWM_HIGH);
+    EXPECT_EQ(Pwm_GetOutputState(PWM_CHANNEL_HIGH_BEAM), PWM_LOW);
+    Pwm_SimSetTimeUs(onUs);
+    EXPECT_EQ(Pwm_GetOutputState(PWM_CHANNEL_LOW_BEAM), PWM_LOW);
+    EXPECT_EQ(Pwm_GetOutputState(PWM_CHANNEL_HIGH_BEAM), PWM_HIGH);
+    Pwm_SimSetTimeUs(onUs + (PWM_DEFAULT_PERIOD_US / 4U) - 1U);
+    EXPECT_EQ(Pwm_GetOutputState(PWM_CHANNEL_HIGH_BEAM), PWM_HIGH);
+    Pwm_SimSetTimeUs(onUs + (PWM_DEFAULT_PERIOD_US / 4U));
+    EXPECT_EQ(Pwm_GetOutputState(PWM_CHANNEL_HIGH_BEAM), PWM_LOW);
+    Pwm_SimSetTimeUs(onUs + PWM_DEFAULT_PERIOD_US);
+    EXPECT_EQ(Pwm_GetOutputState(PWM_CHANNEL_HIGH_BEAM), PWM_HIGH);
+
+    /* Out of range duty cycles are clamped, invalid channels ignored */
+    Pwm_SetDutyCycle(PWM_CHANNEL_HIGH_BEAM, 0xFFFFU);
+    Pwm_SetDutyCycle(PWM_NUM_CHANNELS, PWM_DUTY_100_PERCENT);
+    Pwm_SimChannelType channel;
+    ASSERT_EQ(Pwm_SimGetChannel(PWM_CHANNEL_HIGH_BEAM, &channel), E_OK);
+    EXPECT_EQ(channel.DutyCycle, PWM_DUTY_100_PERCENT);
+    EXPECT_EQ(Pwm_SimGetChannel(PWM_NUM_CHANNELS, &channel), E_NOT_OK);
+    EXPECT_EQ(Pwm_GetOutputState(PWM_NUM_CHANNELS), PWM_LOW);
+}
+
+/*============================================================================*
+ * LAMP MODEL TESTS
+ *============================================================================*/
+
+TEST_F(HeadlightTest, Lamp_ColdInrushDecays) {
+    const Dio_ChannelGroupType beams = {0x03U, 0U, 0U};
+    uint16_t samples[40];
+    uint32_t meanMa[3];
+    uint32_t window;
+    uint32_t sum;
+    uint32_t i;
+
+    /* Both beams hard on: no ramp */
+    Pwm_SimSetTimeUs(timeUs);
+    Dio_WriteChannelGroup(&beams, 0x03U);
+    Pwm_SetDutyCycle(PWM_CHANNEL_LOW_BEAM, PWM_DUTY_100_PERCENT);
+    Pwm_SetDutyCycle(PWM_CHANNEL_HIGH_BEAM, PWM_DUTY_100_PERCENT);
+
+    for (window = 0U; window < 3U; window++) {
+        Lamp_GenerateBlock(timeUs + (window * 10000U), 250U, 40U, samples);
+        sum = 0U;
+        for (i = 0U; i < 40U; i++) {
+            sum += samples[i];
+        }
+        meanMa[window] = (sum / 40U) * LAMP_SENSE_MA_PER_COUNT;
+    }
+
+    /* Cold filaments draw far above the short circuit threshold for two cycles */
+    EXPECT_GT(meanMa[0], 2U * FLM_HEADLIGHT_MAX_CURRENT_MA);
+    EXPECT_GT(meanMa[1], FLM_HEADLIGHT_MAX_CURRENT_MA);
+    EXPECT_LT(meanMa[2], meanMa[1]);
+    EXPECT_GT(Lamp_GetTemperature(LAMP_LOW_BEAM), 0.5f);
+    EXPECT_LT(Lamp_GetTemperature(LAMP_LOW_BEAM), 1.0f);
+}
+
+TEST_F(HeadlightTest, Lamp_BlockSplitIndependent) {
+    const Dio_ChannelGroupType beams = {0x03U, 0U, 0U};
+    uint16_t whole[64];
+    uint16_t split[64];
+
+    Pwm_SimSetTimeUs(timeUs);
+    Dio_WriteChannelGroup(&beams, 0x01U);
+    Pwm_SetDutyCycle(PWM_CHANNEL_LOW_BEAM, PWM_DUTY_100_PERCENT / 2U);
+    Lamp_GenerateBlock(timeUs, 250U, 64U, whole);
+
+    Lamp_Init();
+    Lamp_GenerateBlock(timeUs, 250U, 24U, split);
+    Lamp_GenerateBlock(timeUs + (24U * 250U), 250U, 40U, &split[24]);
+
+    for (uint32_t i = 0U; i < 64U; i++) {
+        EXPECT_NEAR(whole[i], split[i], 1) << "sample " << i;
+    }
+}
+
+/*============================================================================*
+ * OUTPUT STAGE TESTS
+ *============================================================================*/
+
+TEST_F(HeadlightTest, SoftStart_DutyRampsToFull) {
+    const Headlight_StateType* state = Headlight_GetState();
+    uint16_t previous = 0U;
+    uint32_t cycles = 1U;
+
+    RunUntilCommand(LIGHT_SWITCH_LOW_BEAM, HEADLIGHT_CMD_LOW_BEAM);
+    EXPECT_GT(state->lowBeamDuty, 0U);
+    EXPECT_LT(state->lowBeamDuty, PWM_DUTY_100_PERCENT / 5U);
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_LOW_BEAM), STD_HIGH);
+
+    while (state->lowBeamDuty < PWM_DUTY_100_PERCENT) {
+        previous = state->lowBeamDuty;
+        RunCycle(LIGHT_SWITCH_LOW_BEAM);
+        ASSERT_GT(state->lowBeamDuty, previous);
+        cycles++;
+    }
+
+    EXPECT_GE(cycles * FLM_MAIN_FUNCTION_PERIOD_MS, HEADLIGHT_SOFT_START_MS);
+    EXPECT_LE(cycles * FLM_MAIN_FUNCTION_PERIOD_MS,
+              HEADLIGHT_SOFT_START_MS + FLM_MAIN_FUNCTION_PERIOD_MS);
+    EXPECT_EQ(state->highBeamDuty, 0U);
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_HIGH_BEAM), STD_LOW);
+}
+
+TEST_F(HeadlightTest, SoftStart_NoFalseShortCircuit) {
+    const Headlight_StateType* state = Headlight_GetState();
+    uint16_t peak = 0U;
+    uint32_t i;
+
+    RunUntilCommand(LIGHT_SWITCH_HIGH_BEAM, HEADLIGHT_CMD_HIGH_BEAM);
+    for (i = 0U; i < 50U; i++) {
+        RunCycle(LIGHT_SWITCH_HIGH_BEAM);
+        peak = (state->feedbackCurrent > peak) ? state->feedbackCurrent : peak;
+    }
+
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_NONE);
+    EXPECT_LT(peak, FLM_HEADLIGHT_MAX_CURRENT_MA);
+    EXPECT_TRUE(Headlight_GetActualState());
+
+    /* Two hot lamps at full duty */
+    EXPECT_NEAR(state->feedbackCurrent, 2.0f * LAMP_H7_NOMINAL_CURRENT_MA,
+                0.1f * LAMP_H7_NOMINAL_CURRENT_MA);
+}
+
+TEST_F(HeadlightTest, Fade_RelayOpensAfterRamp) {
+    const Headlight_StateType* state = Headlight_GetState();
+    uint16_t previous;
+
+    RunUntilCommand(LIGHT_SWITCH_LOW_BEAM, HEADLIGHT_CMD_LOW_BEAM);
+    RunCycles(LIGHT_SWITCH_LOW_BEAM, 30U);
+    ASSERT_EQ(state->lowBeamDuty, PWM_DUTY_100_PERCENT);
+
+    RunUntilCommand(LIGHT_SWITCH_OFF, HEADLIGHT_CMD_OFF);
+    while (state->lowBeamDuty > 0U) {
+        /* Relay stays closed while the beam fades */
+        EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_LOW_BEAM), STD_HIGH);
+        previous = state->lowBeamDuty;
+        RunCycle(LIGHT_SWITCH_OFF);
+        ASSERT_LT(state->lowBeamDuty, previous);
+    }
+
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_LOW_BEAM), STD_LOW);
+    RunCycles(LIGHT_SWITCH_OFF, 2U);
+    EXPECT_EQ(state->feedbackCurrent, 0U);
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_NONE);
+}
+
+/*============================================================================*
+ * OUTPUT STAGE DIAGNOSIS TESTS [SysSafReq10]
+ *============================================================================*/
+
+TEST_F(HeadlightTest, OpenLoad_DetectedFromLampCurrent) {
+    uint32_t cycles = 0U;
+
+    RunUntilCommand(LIGHT_SWITCH_LOW_BEAM, HEADLIGHT_CMD_LOW_BEAM);
+    RunCycles(LIGHT_SWITCH_LOW_BEAM, 20U);
+    ASSERT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_NONE);
+
+    ASSERT_EQ(Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_OPEN_LOAD), E_OK);
+    while ((Headlight_GetFaultStatus() == HEADLIGHT_FAULT_NONE) && (cycles < 10U)) {
+        RunCycle(LIGHT_SWITCH_LOW_BEAM);
+        cycles++;
+    }
+
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_OPEN_LOAD);
+    EXPECT_LE(cycles * FLM_MAIN_FUNCTION_PERIOD_MS,
+              FLM_HEADLIGHT_FAULT_DETECT_MS + FLM_MAIN_FUNCTION_PERIOD_MS);
+}
+
+TEST_F(HeadlightTest, ShortCircuit_DetectedAndSwitchedOff) {
+    const Headlight_StateType* state = Headlight_GetState();
+    Pwm_SimChannelType pwm;
+    uint32_t cycles = 0U;
+
+    RunUntilCommand(LIGHT_SWITCH_LOW_BEAM, HEADLIGHT_CMD_LOW_BEAM);
+    RunCycles(LIGHT_SWITCH_LOW_BEAM, 20U);
+
+    ASSERT_EQ(Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_SHORT), E_OK);
+    while ((Headlight_GetFaultStatus() == HEADLIGHT_FAULT_NONE) && (cycles < 10U)) {
+        RunCycle(LIGHT_SWITCH_LOW_BEAM);
+        cycles++;
+    }
+
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_SHORT);
+    EXPECT_LE(cycles * FLM_MAIN_FUNCTION_PERIOD_MS,
+              FLM_HEADLIGHT_FAULT_DETECT_MS + FLM_MAIN_FUNCTION_PERIOD_MS);
+
+    /* Output stage and relay off within the detecting cycle */
+    ASSERT_EQ(Pwm_SimGetChannel(PWM_CHANNEL_LOW_BEAM, &pwm), E_OK);
+    EXPECT_EQ(pwm.DutyCycle, PWM_DUTY_0_PERCENT);
+    EXPECT_EQ(state->lowBeamDuty, PWM_DUTY_0_PERCENT);
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_LOW_BEAM), STD_LOW);
+}
+
+TEST_F(HeadlightTest, ShortCircuit_AtSwitchOnDetectedAfterBlanking) {
+    uint32_t cycles = 0U;
+
+    /* Shorted lamp from the start: the on phase peak fails at the lowest
+     * soft-start duty cycle */
+    ASSERT_EQ(Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_SHORT), E_OK);
+    RunUntilCommand(LIGHT_SWITCH_LOW_BEAM, HEADLIGHT_CMD_LOW_BEAM);
+    while ((Headlight_GetFaultStatus() == HEADLIGHT_FAULT_NONE) && (cycles < 10U)) {
+        RunCycle(LIGHT_SWITCH_LOW_BEAM);
+        cycles++;
+    }
+
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_SHORT);
+    EXPECT_GT(cycles * FLM_MAIN_FUNCTION_PERIOD_MS * 1000U, HEADLIGHT_BLANK_LOW_SHORT_US);
+    EXPECT_LE(cycles * FLM_MAIN_FUNCTION_PERIOD_MS, FLM_HEADLIGHT_FAULT_DETECT_MS);
+    EXPECT_LT(Headlight_GetState()->lowBeamDuty, PWM_DUTY_100_PERCENT / 2U);
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_LOW_BEAM), STD_LOW);
+}
+
+TEST_F(HeadlightTest, ShortCircuit_AtColdHighBeamSwitchOnDetected) {
+    uint32_t cycles = 0U;
+
+    /* Both filaments cold: the phase shifted on phases keep the inrush of
+     * the intact lamp apart from the short */
+    ASSERT_EQ(Lamp_SetFault(LAMP_HIGH_BEAM, LAMP_FAULT_SHORT), E_OK);
+    RunUntilCommand(LIGHT_SWITCH_HIGH_BEAM, HEADLIGHT_CMD_HIGH_BEAM);
+    while ((Headlight_GetFaultStatus() == HEADLIGHT_FAULT_NONE) && (cycles < 10U)) {
+        RunCycle(LIGHT_SWITCH_HIGH_BEAM);
+        cycles++;
+    }
+
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_SHORT);
+    EXPECT_GT(cycles * FLM_MAIN_FUNCTION_PERIOD_MS * 1000U, HEADLIGHT_BLANK_HIGH_SHORT_US);
+    EXPECT_LE(cycles * FLM_MAIN_FUNCTION_PERIOD_MS, FLM_HEADLIGHT_FAULT_DETECT_MS);
+    EXPECT_EQ(Dio_ReadChannel(DIO_CHANNEL_HIGH_BEAM), STD_LOW);
+}
+
+TEST_F(HeadlightTest, ShortCircuit_SpikeBelowConfirmTimeIgnored) {
+    RunUntilCommand(LIGHT_SWITCH_LOW_BEAM, HEADLIGHT_CMD_LOW_BEAM);
+    RunCycles(LIGHT_SWITCH_LOW_BEAM, 20U);
+
+    /* 3ms overcurrent spike at the end of a cycle: the window peak fails
+     * for less than the confirm time */
+    RunTicks(7U);
+    ASSERT_EQ(Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_SHORT), E_OK);
+    RunTicks(3U);
+    ASSERT_EQ(Lamp_SetFault(LAMP_LOW_BEAM, LAMP_FAULT_NONE), E_OK);
+    RunRunnables(LIGHT_SWITCH_LOW_BEAM);
+
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_NONE);
+    EXPECT_GT(Headlight_GetState()->shortCircuitCounter, 0U);
+    EXPECT_LT(Headlight_GetState()->shortCircuitCounter, HEADLIGHT_FAULT_CONFIRM_US);
+
+    /* The window max holds the spike for one more window, then pass samples
+     * count the fail time down again */
+    RunCycle(LIGHT_SWITCH_LOW_BEAM);
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_NONE);
+    RunCycle(LIGHT_SWITCH_LOW_BEAM);
+    EXPECT_EQ(Headlight_GetState()->shortCircuitCounter, 0U);
+    EXPECT_EQ(Headlight_GetFaultStatus(), HEADLIGHT_FAULT_NONE);
+}
+
+/*============================================================================*
+ * FEEDBACK STATISTICS TESTS
+ *============================================================================*/
+
+TEST_F(HeadlightTest, FeedbackWindow_MinMaxMean) {
+    const Headlight_StateType* state = Headlight_GetState();
+
+    /* Half way through the soft-start: the window covers on and off phases */
+    RunUntilCommand(LIGHT_SWITCH_LOW_BEAM, HEADLIGHT_CMD_LOW_BEAM);
+    RunCycles(LIGHT_SWITCH_LOW_BEAM, 4U);
+    ASSERT_LT(state->lowBeamDuty, PWM_DUTY_100_PERCENT);
+    EXPECT_EQ(state->feedbackMin, 0U);
+    EXPECT_GT(state->feedbackMax, state->feedbackCurrent);
+    EXPECT_GT(state->feedbackCurrent, FLM_HEADLIGHT_MIN_CURRENT_MA);
+
+    /* Full duty, hot filament: flat current */
+    RunCycles(LIGHT_SWITCH_LOW_BEAM, 40U);
+    EXPECT_LE(state->feedbackMin, state->feedbackCurrent);
+    EXPECT_GE(state->feedbackMax, state->feedbackCurrent);
+    EXPECT_LT(state->feedbackMax - state->feedbackMin, 200U);
+    EXPECT_NEAR(state->feedbackCurrent, LAMP_H7_NOMINAL_CURRENT_MA,
+                0.1f * LAMP_H7_NOMINAL_CURRENT_MA);
+}
@@ -8,7 +8,9 @@
 
 #include <gtest/gtest.h>
 #include "Application/LightRequest/LightRequest.h"
+#include "Application/LightRequest/LightRequest_Batch.h"
 #include "MCAL/Adc/Adc.h"
+#include "BSW/Cal/Cal.h"
 #include "FLM_Config.h"
 
 /**
@@ -18,14 +20,16 @@ class LightRequestTest : public ::testing::Test {
 protected:
     void SetUp() override {
         /* Initialize ADC */
-        static const Adc_ConfigType adcConfig = {0};
+        static const Adc_ConfigType adcConfig = {};
         Adc_Init(&adcConfig);
+        Cal_Init(&Cal_Config);
 
         /* Initialize LightRequest */
         LightRequest_Init();
     }
 
     void TearDown() override {
+        Cal_DeInit();
         Adc_DeInit();
     }
 };
@@ -98,11 +102,10 @@ TEST_F(LightRequestTest, RateOfChange_Plausibility) {
         LightRequest_MainFunction();
     }
 
-    /* Sudden large change (> 500 per 100ms) */
-    LightRequest_SimSetAdcValue(3000);  /* 1500 change */
-
-    /* Run enough cycles to trigger rate check (5 cycles * 20ms = 100ms) */
-    for (int i = 0; i < 20; i++) {
+    /* Sustained large change (600 per 100ms): the rate is checked every
+     * 100ms (5 cycles * 20ms) and must exceed the limit in 3 checks in a row */
+    for (int i = 1; i <= 20; i++) {
+        LightRequest_SimSetAdcValue(static_cast<uint16_t>(1500 + (i * 120)));
         LightRequest_MainFunction();
     }
 
@@ -144,7 +147,7 @@ TEST_F(LightRequestTest, AdcToLux_Conversion) {
     }
 
     AmbientLightLevel level = LightRequest_GetAmbientLight();
-    /* lux = ADC / 4, so 800 / 4 = 200 */
+    /* Ambient calibration curve breakpoint: ADC 800 = 200 lux */
     EXPECT_EQ(level.luxValue, 200);
 }
 
@@ -157,3 +160,321 @@ TEST_F(LightRequestTest, StateAccess) {
     EXPECT_NE(state, nullptr);
     EXPECT_TRUE(state->isInitialized);
 }
+
+/**
+ * @test Running sum moving average equals the window mean for long windows
+ */
+TEST_F(LightRequestTest, Filter_MovingAverage_LongWindow) {
+    static const LightRequest_FilterStageConfigType stages[] = {
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, 300U }
+    };
+    static LightRequest_FilterChainType chain;
+    static uint16_t samples[1000];
+    uint32_t sum;
+    uint32_t count;
+    uint32_t i;
+    uint32_t j;
+
+    ASSERT_EQ(LightRequest_FilterInit(&chain, stages, 1U), E_OK);
+
+    for (i = 0U; i < 1000U; i++) {
+        samples[i] = static_cast<uint16_t>((i * 37U) % 4096U);
+        sum = 0U;
+        count = (i < 300U) ? (i + 1U) : 300U;
+        for (j = (i + 1U) - count; j <= i; j++) {
+            sum += samples[j];
+        }
+        ASSERT_EQ(LightRequest_FilterUpdate(&chain, samples[i]), sum / count) << "sample " << i;
+    }
+
+    /* Reset starts a new window */
+    LightRequest_FilterReset(&chain);
+    EXPECT_EQ(LightRequest_FilterUpdate(&chain, 123U), 123U);
+}
+
+/**
+ * @test Fixed-point IIR low-pass step response
+ */
+TEST_F(LightRequestTest, Filter_IirLowPass_StepResponse) {
+    static const LightRequest_FilterStageConfigType stages[] = {
+        { LIGHTREQUEST_FILTER_IIR_LOWPASS, LIGHTREQUEST_FILTER_IIR_ONE / 2U }
+    };
+    static LightRequest_FilterChainType chain;
+    uint16_t value = 0U;
+    int i;
+
+    ASSERT_EQ(LightRequest_FilterInit(&chain, stages, 1U), E_OK);
+
+    /* First sample initializes the state */
+    EXPECT_EQ(LightRequest_FilterUpdate(&chain, 1000U), 1000U);
+    EXPECT_EQ(LightRequest_FilterUpdate(&chain, 3000U), 2000U);
+    EXPECT_EQ(LightRequest_FilterUpdate(&chain, 3000U), 2500U);
+    EXPECT_EQ(LightRequest_FilterUpdate(&chain, 3000U), 2750U);
+
+    /* Settles on the input without truncation offset */
+    for (i = 0; i < 40; i++) {
+        value = LightRequest_FilterUpdate(&chain, 3000U);
+    }
+    EXPECT_EQ(value, 3000U);
+}
+
+/**
+ * @test Median stage rejects single spikes ahead of the average
+ */
+TEST_F(LightRequestTest, Filter_Median_RejectsSpikes) {
+    static const LightRequest_FilterStageConfigType stages[] = {
+        { LIGHTREQUEST_FILTER_MEDIAN, 5U },
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, 8U }
+    };
+    static LightRequest_FilterChainType chain;
+    uint16_t value;
+    int i;
+
+    ASSERT_EQ(LightRequest_FilterInit(&chain, stages, 2U), E_OK);
+
+    for (i = 0; i < 50; i++) {
+        /* Spike every 4th sample, alternating high and low */
+        if ((i % 4) == 3) {
+            value = ((i % 8) == 3) ? 4095U : 0U;
+        } else {
+            value = static_cast<uint16_t>(1000 + (i % 3));
+        }
+        value = LightRequest_FilterUpdate(&chain, value);
+        if (i >= 4) {
+            EXPECT_NEAR(value, 1001U, 2U) << "sample " << i;
+        }
+    }
+}
+
+/**
+ * @test Invalid filter configurations are rejected
+ */
+TEST_F(LightRequestTest, Filter_InvalidConfiguration) {
+    static LightRequest_FilterChainType chain;
+    const LightRequest_FilterStageConfigType longWindow[] = {
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, LIGHTREQUEST_FILTER_MAX_WINDOW + 1U }
+    };
+    const LightRequest_FilterStageConfigType evenMedian[] = {
+        { LIGHTREQUEST_FILTER_MEDIAN, 4U }
+    };
+    const LightRequest_FilterStageConfigType zeroIir[] = {
+        { LIGHTREQUEST_FILTER_IIR_LOWPASS, 0U }
+    };
+    const LightRequest_FilterStageConfigType tooMany[LIGHTREQUEST_FILTER_MAX_STAGES + 1U] = {};
+
+    EXPECT_EQ(LightRequest_FilterInit(&chain, longWindow, 1U), E_NOT_OK);
+    EXPECT_EQ(LightRequest_FilterInit(&chain, evenMedian, 1U), E_NOT_OK);
+    EXPECT_EQ(LightRequest_FilterInit(&chain, zeroIir, 1U), E_NOT_OK);
+    EXPECT_EQ(LightRequest_FilterInit(&chain, tooMany, LIGHTREQUEST_FILTER_MAX_STAGES + 1U), E_NOT_OK);
+
+    /* Empty chain passes samples */
+    EXPECT_EQ(chain.NumStages, 0U);
+    EXPECT_EQ(LightRequest_FilterUpdate(&chain, 777U), 777U);
+
+    /* LightRequest keeps its chain */
+    EXPECT_EQ(LightRequest_SetFilterChain(evenMedian, 1U), E_NOT_OK);
+    EXPECT_EQ(LightRequest_GetState()->filter.NumStages, LIGHTREQUEST_NUM_FILTER_STAGES);
+}
+
+/**
+ * @test Long window chain in LightRequest smooths noise and restarts validity
+ */
+TEST_F(LightRequestTest, Filter_LongWindowChain) {
+    static const LightRequest_FilterStageConfigType stages[] = {
+        { LIGHTREQUEST_FILTER_MEDIAN, 3U },
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, 256U }
+    };
+    int i;
+
+    ASSERT_EQ(LightRequest_SetFilterChain(stages, 2U), E_OK);
+
+    for (i = 0; i < 600; i++) {
+        LightRequest_SimSetAdcValue(static_cast<uint16_t>(((i % 2) == 0) ? 1900 : 2100));
+        LightRequest_MainFunction();
+        if (i == 0) {
+            EXPECT_FALSE(LightRequest_GetAmbientLight().isValid);
+        }
+    }
+
+    EXPECT_TRUE(LightRequest_GetAmbientLight().isValid);
+    EXPECT_NEAR(LightRequest_GetFilteredAdcValue(), 2000U, 2U);
+}
+
+/*============================================================================*
+ * BATCH EVALUATION
+ *============================================================================*/
+
+/** @brief Channels and cycles of the batch comparison (odd: vector tails) */
+#define TEST_BATCH_CHANNELS     37U
+#define TEST_BATCH_CYCLES       150U
+
+/**
+ * @brief Sensor value of a channel: stable, steps, ramps through open and
+ *        short circuit, open circuit dropout, random levels
+ */
+static uint16_t Test_BatchSample(uint32_t channel, uint32_t cycle) {
+    const uint32_t hash = ((channel * 2654435761U) ^ (cycle * 40503U)) * 2246822519U;
+    const uint32_t noise = (hash >> 20U) % 41U;
+
+    switch (channel % 5U) {
+        case 0U:
+            return static_cast<uint16_t>(1480U + noise);
+        case 1U:
+            return ((cycle / (23U + (channel % 7U))) % 2U == 0U) ? 800U : 2800U;
+        case 2U:
+            return static_cast<uint16_t>(((cycle * (10U + (channel % 40U))) % 4050U) + 40U);
+        case 3U:
+            return ((cycle >= 40U) && (cycle < 50U)) ? 50U : static_cast<uint16_t>(2000U + noise);
+        default:
+            return static_cast<uint16_t>(
+                ((((channel * 7919U) ^ ((cycle / 8U) * 104729U)) * 2246822519U) >> 20U) % 4096U);
+    }
+}
+
+/**
+ * @test Batch evaluation equals LightRequest_MainFunction on every
+ *       implementation, for several filter chains
+ */
+TEST_F(LightRequestTest, Batch_MatchesScalarPath) {
+    static const LightRequest_FilterStageConfigType iirAverage[] = {
+        { LIGHTREQUEST_FILTER_IIR_LOWPASS, 3000U },
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, 16U }
+    };
+    static const LightRequest_FilterStageConfigType averageIir[] = {
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, 7U },
+        { LIGHTREQUEST_FILTER_IIR_LOWPASS, LIGHTREQUEST_FILTER_IIR_ONE }
+    };
+    static const struct {
+        const LightRequest_FilterStageConfigType* Stages;
+        uint8_t NumStages;
+    } chains[] = {
+        { LightRequest_FilterChainConfig, LIGHTREQUEST_NUM_FILTER_STAGES },
+        { iirAverage, 2U },
+        { averageIir, 2U }
+    };
+    static const LightRequest_BatchIsaType isas[] = {
+        LIGHTREQUEST_BATCH_ISA_SCALAR, LIGHTREQUEST_BATCH_ISA_SSE41, LIGHTREQUEST_BATCH_ISA_AVX2
+    };
+    static LightRequest_BatchType batch;
+    static uint16_t refFiltered[TEST_BATCH_CHANNELS][TEST_BATCH_CYCLES];
+    static uint16_t refRate[TEST_BATCH_CHANNELS][TEST_BATCH_CYCLES];
+    static uint8_t refStatus[TEST_BATCH_CHANNELS][TEST_BATCH_CYCLES];
+    static boolean refFault[TEST_BATCH_CHANNELS][TEST_BATCH_CYCLES];
+    uint16_t samples[TEST_BATCH_CHANNELS];
+    const LightRequest_StateType* state = LightRequest_GetState();
+    uint32_t faults = 0U;
+    uint32_t k;
+    uint32_t i;
+    uint32_t c;
+    uint32_t t;
+
+    for (k = 0U; k < sizeof(chains) / sizeof(chains[0]); k++) {
+        /* Reference: the SWC, one channel after the other */
+        for (c = 0U; c < TEST_BATCH_CHANNELS; c++) {
+            LightRequest_Init();
+            ASSERT_EQ(LightRequest_SetFilterChain(chains[k].Stages, chains[k].NumStages), E_OK);
+            for (t = 0U; t < TEST_BATCH_CYCLES; t++) {
+                LightRequest_SimSetAdcValue(Test_BatchSample(c, t));
+                LightRequest_MainFunction();
+                refFiltered[c][t] = state->adcFilteredValue;
+                refRate[c][t] = state->rateOfChange;
+                refStatus[c][t] = static_cast<uint8_t>(state->signalStatus);
+                refFault[c][t] = state->plausibilityFault;
+            }
+            faults += refFault[c][TEST_BATCH_CYCLES - 1U] ? 1U : 0U;
+        }
+
+        for (i = 0U; i < sizeof(isas) / sizeof(isas[0]); i++) {
+            if (!LightRequest_BatchIsaSupported(isas[i])) {
+                continue;
+            }
+            ASSERT_EQ(LightRequest_BatchInit(&batch, TEST_BATCH_CHANNELS,
+                                             chains[k].Stages, chains[k].NumStages), E_OK);
+            ASSERT_EQ(LightRequest_BatchSetIsa(&batch, isas[i]), E_OK);
+
+            for (t = 0U; t < TEST_BATCH_CYCLES; t++) {
+                for (c = 0U; c < TEST_BATCH_CHANNELS; c++) {
+                    samples[c] = Test_BatchSample(c, t);
+                }
+                LightRequest_BatchUpdate(&batch, samples);
+
+                for (c = 0U; c < TEST_BATCH_CHANNELS; c++) {
+                    ASSERT_EQ(batch.Filtered[c], refFiltered[c][t])
+                        << "chain " << k << " isa " << i << " channel " << c << " cycle " << t;
+                    ASSERT_EQ(batch.RateOfChange[c], refRate[c][t])
+                        << "chain " << k << " isa " << i << " channel " << c << " cycle " << t;
+                    ASSERT_EQ(batch.Status[c], refStatus[c][t])
+                        << "chain " << k << " isa " << i << " channel " << c << " cycle " << t;
+                    ASSERT_EQ(batch.PlausibilityFault[c] != 0U, refFault[c][t])
+                        << "chain " << k << " isa " << i << " channel " << c << " cycle " << t;
+                }
+            }
+        }
+    }
+
+    /* The scenarios exercise the plausibility path */
+    EXPECT_GT(faults, 0U);
+}
+
+/**
+ * @test Vector implementations agree with the scalar loop at full capacity
+ */
+TEST_F(LightRequestTest, Batch_FullCapacity) {
+    static const LightRequest_FilterStageConfigType stages[] = {
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, 5U },
+        { LIGHTREQUEST_FILTER_IIR_LOWPASS, 12345U }
+    };
+    static LightRequest_BatchType scalar;
+    static LightRequest_BatchType vector;
+    static uint16_t samples[LIGHTREQUEST_BATCH_MAX_CHANNELS];
+    uint32_t c;
+    uint32_t t;
+
+    ASSERT_EQ(LightRequest_BatchInit(&scalar, LIGHTREQUEST_BATCH_MAX_CHANNELS, stages, 2U), E_OK);
+    ASSERT_EQ(LightRequest_BatchInit(&vector, LIGHTREQUEST_BATCH_MAX_CHANNELS, stages, 2U), E_OK);
+    ASSERT_EQ(LightRequest_BatchSetIsa(&scalar, LIGHTREQUEST_BATCH_ISA_SCALAR), E_OK);
+
+    for (t = 0U; t < 60U; t++) {
+        for (c = 0U; c < LIGHTREQUEST_BATCH_MAX_CHANNELS; c++) {
+            samples[c] = Test_BatchSample(c, t);
+        }
+        LightRequest_BatchUpdate(&scalar, samples);
+        LightRequest_BatchUpdate(&vector, samples);
+
+        ASSERT_EQ(memcmp(scalar.Filtered, vector.Filtered, sizeof(scalar.Filtered)), 0) << "cycle " << t;
+        ASSERT_EQ(memcmp(scalar.Status, vector.Status, sizeof(scalar.Status)), 0) << "cycle " << t;
+        ASSERT_EQ(memcmp(scalar.RateOfChange, vector.RateOfChange, sizeof(scalar.RateOfChange)), 0)
+            << "cycle " << t;
+        ASSERT_EQ(memcmp(scalar.PlausibilityFault, vector.PlausibilityFault,
+                         sizeof(scalar.PlausibilityFault)), 0) << "cycle " << t;
+    }
+}
+
+/**
+ * @test Unsupported batch configurations are rejected
+ */
+TEST_F(LightRequestTest, Batch_InvalidConfiguration) {
+    static LightRequest_BatchType batch;
+    const LightRequest_FilterStageConfigType median[] = {
+        { LIGHTREQUEST_FILTER_MEDIAN, 3U }
+    };
+    const LightRequest_FilterStageConfigType longWindow[] = {
+        { LIGHTREQUEST_FILTER_MOVING_AVERAGE, LIGHTREQUEST_BATCH_MAX_WINDOW + 1U }
+    };
+
+    EXPECT_EQ(LightRequest_BatchInit(&batch, 8U, median, 1U), E_NOT_OK);
+    EXPECT_EQ(LightRequest_BatchInit(&batch, 8U, longWindow, 1U), E_NOT_OK);
+    EXPECT_EQ(LightRequest_BatchInit(&batch, 0U, NULL_PTR, 0U), E_NOT_OK);
+    EXPECT_EQ(LightRequest_BatchInit(&batch, LIGHTREQUEST_BATCH_MAX_CHANNELS + 1U, NULL_PTR, 0U),
+              E_NOT_OK);
+    EXPECT_EQ(LightRequest_BatchInit(nullptr, 8U, NULL_PTR, 0U), E_NOT_OK);
+
+    /* Fastest supported implementation is selected */
+    ASSERT_EQ(LightRequest_BatchInit(&batch, 8U, NULL_PTR, 0U), E_OK);
+    EXPECT_TRUE(LightRequest_BatchIsaSupported(batch.Isa));
+    if (LightRequest_BatchIsaSupported(LIGHTREQUEST_BATCH_ISA_AVX2)) {
+        EXPECT_EQ(batch.Isa, LIGHTREQUEST_BATCH_ISA_AVX2);
+    }
+    EXPECT_TRUE(LightRequest_BatchIsaSupported(LIGHTREQUEST_BATCH_ISA_SCALAR));
+    EXPECT_EQ(batch.Status[0], SIGNAL_STATUS_INVALID);
+}
@@ -0,0 +1,186 @@
+/**
+ * @file test_Log.cpp
+ * @brief Unit Tests for the Asynchronous Logger
+ * @details Tests the deferred formatting, level filtering, rate limiting,
+ *          drop accounting and the merge of the per-thread rings
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Test_Util.h"
+#include "BSW/Log/Log.h"
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Log Test Fixture
+ */
+class LogTest : public ::testing::Test {
+protected:
+    std::string path;
+    FILE* stream = NULL_PTR;
+
+    void SetUp() override {
+#if (LOG_COMPILE_LEVEL != LOG_LEVEL_DEBUG)
+        GTEST_SKIP() << "Log statements compiled out";
+#endif
+        path = TestTempPath("flm_log_", ".txt");
+        Log_Init();
+        stream = std::fopen(path.c_str(), "w");
+        ASSERT_NE(stream, nullptr);
+    }
+
+    void TearDown() override {
+        Log_Stop();
+        Log_Init();
+        if (stream != NULL_PTR) {
+            (void)std::fclose(stream);
+        }
+        (void)std::remove(path.c_str());
+    }
+
+    std::string ReadLog(void) {
+        std::ifstream file(path);
+        std::stringstream content;
+
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    Log_StatisticsType GetStatistics(void) {
+        Log_StatisticsType stats;
+
+        EXPECT_EQ(Log_GetStatistics(&stats), E_OK);
+        return stats;
+    }
+};
+
+/*============================================================================*
+ * CONTROL TESTS
+ *============================================================================*/
+
+TEST_F(LogTest, Write_IgnoredWhileStopped) {
+    LOG_ERROR("not captured");
+
+    EXPECT_FALSE(Log_IsEnabled(LOG_LEVEL_ERROR));
+    EXPECT_EQ(GetStatistics().Threads, 0U);
+    EXPECT_EQ(Log_Start(NULL_PTR), E_NOT_OK);
+    ASSERT_EQ(Log_Start(stream), E_OK);
+    EXPECT_EQ(Log_Start(stream), E_NOT_OK);
+    Log_Stop();
+
+    EXPECT_EQ(ReadLog(), "");
+}
+
+TEST_F(LogTest, Level_FiltersWithoutEvaluatingArguments) {
+    int evaluated = 0;
+
+    ASSERT_EQ(Log_Start(stream), E_OK);
+    LOG_DEBUG("debug %d", ++evaluated);
+    LOG_INFO("info %d", ++evaluated);
+    Log_SetLevel(LOG_LEVEL_ERROR);
+    LOG_WARNING("warning %d", ++evaluated);
+    LOG_ERROR("error %d", ++evaluated);
+    Log_Stop();
+
+    EXPECT_EQ(evaluated, 2);
+    EXPECT_EQ(ReadLog(), "info 1\nERROR: error 2\n");
+}
+
+/*============================================================================*
+ * FORMAT TESTS
+ *============================================================================*/
+
+TEST_F(LogTest, Writer_FormatsCapturedArguments) {
+    static const char* const names[] = { "NORMAL", "SAFE" };
+    const int64_t negative = -42;
+    const uint64_t large = 18446744073709551615ULL;
+
+    ASSERT_EQ(Log_Start(stream), E_OK);
+    LOG_INFO("[%ums] State:%s Ambient:%u", 1200U, names[1], static_cast<uint32_t>(2048U));
+    LOG_INFO("%d|%5d|%-5d|%05d|%+d|%lld", -7, 42, 42, -42, 3, static_cast<long long>(negative));
+    LOG_INFO("%x|%04X|%llu|%c|%%|%.3s|%-6s|", 0xBEEFU, 0xAU, static_cast<unsigned long long>(large), 'Z',
+             "abcdef", "ab");
+    LOG_INFO("%.2f|%8.3f|%g|%s", 3.14159, -2.5, 23.8, static_cast<const char*>(NULL_PTR));
+    Log_Stop();
+
+    EXPECT_EQ(ReadLog(),
+              "[1200ms] State:SAFE Ambient:2048\n"
+              "-7|   42|42   |-0042|+3|-42\n"
+              "beef|000A|18446744073709551615|Z|%|abc|ab    |\n"
+              "3.14|  -2.500|23.8|(null)\n");
+    EXPECT_EQ(GetStatistics().Written, 4U);
+}
+
+TEST_F(LogTest, Writer_TruncatesLongLines) {
+    std::string longText(2U * LOG_LINE_SIZE, 'x');
+
+    ASSERT_EQ(Log_Start(stream), E_OK);
+    LOG_INFO("%s", longText.c_str());
+    Log_Stop();
+
+    const std::string log = ReadLog();
+    EXPECT_EQ(log.size(), LOG_LINE_SIZE - 1U);
+    EXPECT_EQ(log.back(), '\n');
+}
+
+/*============================================================================*
+ * RATE LIMIT TESTS
+ *============================================================================*/
+
+TEST_F(LogTest, RateLimit_ReportsSuppressedCount) {
+    int i;
+
+    ASSERT_EQ(Log_Start(stream), E_OK);
+    /* One statement: the rate limit is per call site */
+    for (i = 0; i <= 50; i++) {
+        if (i == 50) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        }
+        LOG_WARNING_RATELIMITED(20U, "safe state %d", i);
+    }
+    Log_Stop();
+
+    EXPECT_EQ(ReadLog(),
+              "WARNING: safe state 0\n"
+              "WARNING: safe state 50 (49 similar messages suppressed)\n");
+    EXPECT_EQ(GetStatistics().Suppressed, 49U);
+}
+
+/*============================================================================*
+ * RING TESTS
+ *============================================================================*/
+
+TEST_F(LogTest, Write_FullRingDropsWithoutBlocking) {
+    const uint32_t written = 8U * LOG_RING_SIZE;
+    uint32_t i;
+
+    ASSERT_EQ(Log_Start(stream), E_OK);
+    for (i = 0U; i < written; i++) {
+        LOG_INFO("message %u", i);
+    }
+    Log_Stop();
+
+    /* The writer wakes every 10ms, far slower than the producer */
+    EXPECT_GT(GetStatistics().Dropped, 0U);
+    EXPECT_EQ(GetStatistics().Written + GetStatistics().Dropped, written);
+    EXPECT_NE(ReadLog().find("log messages dropped\n"), std::string::npos);
+}
+
+TEST_F(LogTest, Writer_MergesThreadsInTimeOrder) {
+    ASSERT_EQ(Log_Start(stream), E_OK);
+    LOG_INFO("scheduler 1");
+    std::thread worker([] {
+        LOG_INFO("worker");
+    });
+    worker.join();
+    LOG_INFO("scheduler 2");
+    Log_Stop();
+
+    EXPECT_EQ(ReadLog(), "scheduler 1\nworker\nscheduler 2\n");
+    EXPECT_EQ(GetStatistics().Threads, 2U);
+}
@@ -0,0 +1,230 @@
+/**
+ * @file test_Metrics.cpp
+ * @brief Unit Tests for the Metrics Registry
+ * @details Tests the per-thread aggregation, the Prometheus text format, the
+ *          loopback HTTP endpoint, the file dump and the stack instrumentation
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Test_Util.h"
+#include "BSW/Metrics/Metrics.h"
+#include "BSW/Metrics/Metrics_Export.h"
+#include "BSW/Dem/Dem.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+#include "Application/FLM/FLM_Application.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Metrics Test Fixture
+ */
+class MetricsTest : public ::testing::Test {
+protected:
+    std::string path;
+
+    void SetUp() override {
+        path = TestTempPath("flm_metrics_", ".prom");
+        ASSERT_EQ(Metrics_Init(), E_OK);
+    }
+
+    void TearDown() override {
+        Metrics_StopExport();
+        (void)Metrics_Init();
+        (void)std::remove(path.c_str());
+    }
+
+    std::string RenderText(void) {
+        static char buffer[METRICS_TEXT_BUFFER_SIZE];
+        uint32_t length = 0U;
+
+        EXPECT_EQ(Metrics_WriteText(buffer, sizeof(buffer), &length), E_OK);
+        return std::string(buffer, length);
+    }
+
+    std::string Scrape(uint16_t port, const char* request) {
+        struct sockaddr_in address;
+        std::string response;
+        char chunk[1024];
+        ssize_t count;
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+        (void)std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) == 0) {
+            (void)send(fd, request, std::strlen(request), 0);
+            while ((count = recv(fd, chunk, sizeof(chunk), 0)) > 0) {
+                response.append(chunk, static_cast<size_t>(count));
+            }
+        }
+        (void)close(fd);
+
+        return response;
+    }
+};
+
+/*============================================================================*
+ * REGISTRY TESTS
+ *============================================================================*/
+
+TEST_F(MetricsTest, Counter_AggregatesAcrossThreads) {
+    const uint32_t perThread = 10000U;
+    std::thread workers[3];
+    uint32_t i;
+
+    for (i = 0U; i < 3U; i++) {
+        workers[i] = std::thread([perThread] {
+            uint32_t j;
+
+            for (j = 0U; j < perThread; j++) {
+                Metrics_Increment(METRICS_CAN_RX);
+            }
+        });
+    }
+    for (i = 0U; i < 3U; i++) {
+        workers[i].join();
+    }
+    Metrics_Add(METRICS_CAN_RX, 5U);
+
+    EXPECT_EQ(Metrics_GetValue(METRICS_CAN_RX), (3U * perThread) + 5U);
+    EXPECT_EQ(Metrics_GetValue(METRICS_CAN_TX), 0U);
+}
+
+TEST_F(MetricsTest, Update_IgnoresWrongTypeAndUnknownSeries) {
+    Metrics_Increment(METRICS_FLM_STATE);
+    Metrics_SetGauge(METRICS_CAN_RX, 7);
+    Metrics_Observe(METRICS_CAN_RX, 7U);
+    Metrics_Increment(METRICS_NUM_SERIES);
+
+    EXPECT_EQ(Metrics_GetValue(METRICS_FLM_STATE), 0U);
+    EXPECT_EQ(Metrics_GetValue(METRICS_CAN_RX), 0U);
+    EXPECT_EQ(Metrics_GetValue(METRICS_NUM_SERIES), 0U);
+}
+
+TEST_F(MetricsTest, Histogram_CountsBucketsAndSum) {
+    Metrics_Observe(METRICS_FLM_STATE_VISIT, 10U);
+    Metrics_Observe(METRICS_FLM_STATE_VISIT, 30U);
+    Metrics_Observe(METRICS_FLM_STATE_VISIT, 400000U);
+
+    EXPECT_EQ(Metrics_GetValue(METRICS_FLM_STATE_VISIT), 3U);
+    EXPECT_EQ(Metrics_GetHistogramSum(METRICS_FLM_STATE_VISIT), 400040U);
+
+    const std::string text = RenderText();
+    EXPECT_NE(text.find("flm_state_visit_ms_bucket{le=\"10\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("flm_state_visit_ms_bucket{le=\"50\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("flm_state_visit_ms_bucket{le=\"300000\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("flm_state_visit_ms_bucket{le=\"+Inf\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("flm_state_visit_ms_sum 400040\n"), std::string::npos);
+    EXPECT_NE(text.find("flm_state_visit_ms_count 3\n"), std::string::npos);
+}
+
+/*============================================================================*
+ * TEXT FORMAT TESTS
+ *============================================================================*/
+
+TEST_F(MetricsTest, WriteText_OneHeaderPerFamily) {
+    Metrics_Increment(METRICS_E2E_STATUS(E2E_P01STATUS_WRONGCRC));
+    Metrics_SetGauge(METRICS_FLM_STATE, FLM_STATE_DEGRADED);
+
+    const std::string text = RenderText();
+    const std::string type = "# TYPE flm_e2e_checks_total counter\n";
+    const size_t header = text.find(type);
+
+    ASSERT_NE(header, std::string::npos);
+    EXPECT_EQ(text.find(type, header + 1U), std::string::npos);
+    EXPECT_NE(text.find("# HELP flm_e2e_checks_total "), std::string::npos);
+    EXPECT_NE(text.find("flm_e2e_checks_total{status=\"WRONGCRC\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("flm_e2e_checks_total{status=\"OK\"} 0\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE flm_state gauge\nflm_state 2\n"), std::string::npos);
+}
+
+TEST_F(MetricsTest, WriteText_ReportsTruncation) {
+    char buffer[64];
+    uint32_t length = 0U;
+
+    EXPECT_EQ(Metrics_WriteText(NULL_PTR, sizeof(buffer), &length), E_NOT_OK);
+    EXPECT_EQ(Metrics_WriteText(buffer, sizeof(buffer), &length), E_NOT_OK);
+    EXPECT_LT(length, sizeof(buffer));
+    EXPECT_EQ(buffer[length], '\0');
+}
+
+/*============================================================================*
+ * EXPORT TESTS
+ *============================================================================*/
+
+TEST_F(MetricsTest, Http_ServesScrapeOnLoopback) {
+    const Metrics_ExportConfigType config = { TRUE, 0U, NULL_PTR, 0U };
+
+    Metrics_Increment(METRICS_SAFE_STATE(SAFE_STATE_REASON_TIMEOUT));
+    ASSERT_EQ(Metrics_StartExport(&config), E_OK);
+    ASSERT_NE(Metrics_GetHttpPort(), 0U);
+    EXPECT_EQ(Metrics_StartExport(&config), E_NOT_OK);
+
+    const std::string response = Scrape(Metrics_GetHttpPort(), "GET /metrics HTTP/1.1\r\nHost: x\r\n\r\n");
+    EXPECT_EQ(response.rfind("HTTP/1.0 200 OK\r\n", 0U), 0U);
+    EXPECT_NE(response.find("Content-Type: text/plain; version=0.0.4"), std::string::npos);
+    EXPECT_NE(response.find("flm_safe_state_entries_total{reason=\"TIMEOUT\"} 1\n"), std::string::npos);
+
+    const std::string missing = Scrape(Metrics_GetHttpPort(), "GET / HTTP/1.1\r\n\r\n");
+    EXPECT_EQ(missing.rfind("HTTP/1.0 404 Not Found\r\n", 0U), 0U);
+
+    Metrics_StopExport();
+    EXPECT_EQ(Metrics_GetHttpPort(), 0U);
+}
+
+TEST_F(MetricsTest, Dump_RewritesFileAndOnStop) {
+    const Metrics_ExportConfigType config = { FALSE, 0U, path.c_str(), 20U };
+    const Metrics_ExportConfigType nothing = { FALSE, 0U, NULL_PTR, 0U };
+    std::stringstream content;
+
+    EXPECT_EQ(Metrics_StartExport(&nothing), E_NOT_OK);
+    ASSERT_EQ(Metrics_StartExport(&config), E_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_TRUE(std::ifstream(path).good());
+
+    Metrics_Add(METRICS_CAN_TX, 42U);
+    Metrics_StopExport();
+
+    content << std::ifstream(path).rdbuf();
+    EXPECT_NE(content.str().find("flm_can_frames_total{direction=\"tx\"} 42\n"), std::string::npos);
+    EXPECT_FALSE(std::ifstream(path + ".tmp").good());
+}
+
+/*============================================================================*
+ * INSTRUMENTATION TESTS
+ *============================================================================*/
+
+TEST_F(MetricsTest, SafeStateEntry_CountedOncePerReason) {
+    SafetyMonitor_Init();
+    FLM_Init();
+
+    SafetyMonitor_TriggerSafeState(SAFE_STATE_REASON_MANUAL);
+    SafetyMonitor_TriggerSafeState(SAFE_STATE_REASON_WDGM_FAILURE);
+
+    EXPECT_EQ(Metrics_GetValue(METRICS_SAFE_STATE(SAFE_STATE_REASON_MANUAL)), 1U);
+    EXPECT_EQ(Metrics_GetValue(METRICS_SAFE_STATE(SAFE_STATE_REASON_WDGM_FAILURE)), 0U);
+}
+
+TEST_F(MetricsTest, DemEvent_CountsTestFailedTransitions) {
+    Dem_Init();
+
+    (void)Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT, DEM_EVENT_STATUS_PASSED);
+    (void)Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT, DEM_EVENT_STATUS_FAILED);
+    (void)Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT, DEM_EVENT_STATUS_FAILED);
+    (void)Dem_SetEventStatus(DEM_EVENT_CAN_TIMEOUT, DEM_EVENT_STATUS_PASSED);
+
+    EXPECT_EQ(Metrics_GetValue(METRICS_DEM_TRANSITION(DEM_EVENT_CAN_TIMEOUT, TRUE)), 1U);
+    EXPECT_EQ(Metrics_GetValue(METRICS_DEM_TRANSITION(DEM_EVENT_CAN_TIMEOUT, FALSE)), 1U);
+    EXPECT_NE(RenderText().find(
+        "flm_dem_event_transitions_total{event=\"CAN_TIMEOUT\",to=\"failed\"} 1\n"), std::string::npos);
+}
@@ -0,0 +1,384 @@
+/**
+ * @file test_Os.cpp
+ * @brief Unit Tests for the OS Task Mapping
+ * @details Tests periodic activation in both mappings, concurrency and
+ *          pinning of the task threads, deadline supervision and spinlocks
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "BSW/Os/Os.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+/*============================================================================*
+ * TEST TASKS
+ *============================================================================*/
+
+static std::atomic<uint32_t> TestOs_Runs[3];
+static std::thread::id TestOs_ThreadIds[3];
+static int TestOs_Cpu[3];
+static std::atomic<uint32_t> TestOs_Rendezvous(0U);
+static std::atomic<bool> TestOs_Concurrent(false);
+static uint32_t TestOs_SleepUs = 0U;
+
+static void TestOs_Record(uint8_t task) {
+    TestOs_Runs[task]++;
+    TestOs_ThreadIds[task] = std::this_thread::get_id();
+#if defined(__linux__)
+    TestOs_Cpu[task] = sched_getcpu();
+#endif
+}
+
+static void TestOs_Task0(void) { TestOs_Record(0U); }
+static void TestOs_Task1(void) { TestOs_Record(1U); }
+
+static void TestOs_Task2(void) {
+    TestOs_Record(2U);
+    if (TestOs_SleepUs > 0U) {
+        std::this_thread::sleep_for(std::chrono::microseconds(TestOs_SleepUs));
+    }
+}
+
+/** @brief Meets its partner task, only possible if both run at once */
+static void TestOs_MeetTask(void) {
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+    TestOs_Rendezvous++;
+    while (TestOs_Rendezvous.load() < 2U) {
+        if (std::chrono::steady_clock::now() > timeout) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+    TestOs_Concurrent = true;
+}
+
+/**
+ * @brief OS Test Fixture
+ */
+class OsTest : public ::testing::Test {
+protected:
+    Os_TaskConfigType tasks[3] = {
+        { "Task_5ms",  TestOs_Task0, 5U,  0U, 0U, OS_CORE_ANY },
+        { "Task_10ms", TestOs_Task1, 10U, 0U, 0U, OS_CORE_ANY },
+        { "Task_20ms", TestOs_Task2, 20U, 0U, 0U, OS_CORE_ANY }
+    };
+    Os_ConfigType config = { OS_MAPPING_SINGLE_THREAD, tasks, 3U };
+
+    void SetUp() override {
+        uint8_t i;
+
+        for (i = 0U; i < 3U; i++) {
+            TestOs_Runs[i] = 0U;
+            TestOs_ThreadIds[i] = std::thread::id();
+            TestOs_Cpu[i] = -1;
+        }
+        TestOs_Rendezvous = 0U;
+        TestOs_Concurrent = false;
+        TestOs_SleepUs = 0U;
+    }
+
+    void TearDown() override {
+        Os_DeInit();
+    }
+
+    void RunTicks(uint32_t ticks) {
+        uint32_t tick;
+
+        for (tick = 0U; tick < ticks; tick++) {
+            Os_Tick(tick);
+        }
+    }
+
+    /** @brief Wait until the jobs of the first releases completed or were lost */
+    void WaitForReleases(Os_TaskIdType taskId, uint32_t releases) {
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        Os_TaskStatsType stats;
+
+        while ((Os_GetTaskStats(taskId, &stats) == E_OK) &&
+               ((stats.Activations + stats.LostActivations) < releases) &&
+               (std::chrono::steady_clock::now() < timeout)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+/*============================================================================*
+ * CONFIGURATION TESTS
+ *============================================================================*/
+
+TEST_F(OsTest, Init_RejectsInvalidConfig) {
+    Os_TaskStatsType stats;
+
+    EXPECT_EQ(Os_Init(NULL_PTR), E_NOT_OK);
+
+    config.NumTasks = 0U;
+    EXPECT_EQ(Os_Init(&config), E_NOT_OK);
+    config.NumTasks = OS_MAX_TASKS + 1U;
+    EXPECT_EQ(Os_Init(&config), E_NOT_OK);
+    config.NumTasks = 3U;
+
+    tasks[1].PeriodMs = 0U;
+    EXPECT_EQ(Os_Init(&config), E_NOT_OK);
+    tasks[1].PeriodMs = 10U;
+    tasks[2].Entry = NULL_PTR;
+    EXPECT_EQ(Os_Init(&config), E_NOT_OK);
+    tasks[2].Entry = TestOs_Task2;
+
+    /* Not initialized: ticks are ignored */
+    Os_Tick(0U);
+    EXPECT_EQ(TestOs_Runs[0].load(), 0U);
+    EXPECT_EQ(Os_GetTaskStats(0U, &stats), E_NOT_OK);
+
+    ASSERT_EQ(Os_Init(&config), E_OK);
+    EXPECT_EQ(Os_Init(&config), E_NOT_OK);
+    EXPECT_EQ(Os_GetTaskStats(3U, &stats), E_NOT_OK);
+    EXPECT_EQ(Os_GetTaskStats(0U, NULL_PTR), E_NOT_OK);
+}
+
+/*============================================================================*
+ * TASK MAPPING TESTS
+ *============================================================================*/
+
+TEST_F(OsTest, SingleThread_ActivatesByPeriod) {
+    Os_TaskStatsType stats;
+
+    ASSERT_EQ(Os_Init(&config), E_OK);
+    RunTicks(40U);
+
+    EXPECT_EQ(TestOs_Runs[0].load(), 8U);
+    EXPECT_EQ(TestOs_Runs[1].load(), 4U);
+    EXPECT_EQ(TestOs_Runs[2].load(), 2U);
+    EXPECT_EQ(TestOs_ThreadIds[1], std::this_thread::get_id());
+
+    ASSERT_EQ(Os_GetTaskStats(2U, &stats), E_OK);
+    EXPECT_EQ(stats.Activations, 2U);
+    EXPECT_EQ(stats.DeadlineMisses, 0U);
+    EXPECT_EQ(stats.Core, OS_CORE_ANY);
+    EXPECT_FALSE(stats.RealTime);
+}
+
+TEST_F(OsTest, MultiCore_ActivatesByPeriodOnTaskThreads) {
+    Os_TaskStatsType stats;
+    Os_TaskIdType i;
+
+    config.Mapping = OS_MAPPING_MULTI_CORE;
+    ASSERT_EQ(Os_Init(&config), E_OK);
+    RunTicks(40U);
+    WaitForReleases(0U, 8U);
+    WaitForReleases(1U, 4U);
+    WaitForReleases(2U, 2U);
+
+    /* Every release runs, unless a loaded machine delays the previous job */
+    for (i = 0U; i < 3U; i++) {
+        ASSERT_EQ(Os_GetTaskStats(i, &stats), E_OK);
+        EXPECT_EQ(TestOs_Runs[i].load(), stats.Activations);
+        EXPECT_EQ(stats.Activations + stats.LostActivations, 40U / tasks[i].PeriodMs);
+    }
+
+    /* One thread per task, none of them the tick thread */
+    EXPECT_NE(TestOs_ThreadIds[0], std::this_thread::get_id());
+    EXPECT_NE(TestOs_ThreadIds[0], TestOs_ThreadIds[1]);
+    EXPECT_NE(TestOs_ThreadIds[1], TestOs_ThreadIds[2]);
+    EXPECT_NE(TestOs_ThreadIds[0], TestOs_ThreadIds[2]);
+}
+
+TEST_F(OsTest, MultiCore_TasksOfOneTickRunConcurrently) {
+    tasks[0].Entry = TestOs_MeetTask;
+    tasks[1].Entry = TestOs_MeetTask;
+    config.Mapping = OS_MAPPING_MULTI_CORE;
+    ASSERT_EQ(Os_Init(&config), E_OK);
+
+    Os_Tick(0U);
+    WaitForReleases(0U, 1U);
+    WaitForReleases(1U, 1U);
+    EXPECT_TRUE(TestOs_Concurrent.load());
+}
+
+TEST_F(OsTest, MultiCore_TaskPinnedToCore) {
+    Os_TaskStatsType stats;
+
+    tasks[1].CoreId = 0;
+    config.Mapping = OS_MAPPING_MULTI_CORE;
+    ASSERT_EQ(Os_Init(&config), E_OK);
+    RunTicks(20U);
+    WaitForReleases(1U, 2U);
+
+    ASSERT_EQ(Os_GetTaskStats(1U, &stats), E_OK);
+    ASSERT_EQ(Os_GetTaskStats(0U, &stats), E_OK);
+    EXPECT_EQ(stats.Core, OS_CORE_ANY);
+
+    ASSERT_EQ(Os_GetTaskStats(1U, &stats), E_OK);
+    if (stats.Core == OS_CORE_ANY) {
+        GTEST_SKIP() << "CPU affinity not permitted";
+    }
+    EXPECT_EQ(stats.Core, 0);
+#if defined(__linux__)
+    EXPECT_EQ(TestOs_Cpu[1], 0);
+#endif
+}
+
+TEST_F(OsTest, MultiCore_NoRealTimeWithoutOwnCore) {
+    Os_TaskStatsType stats;
+    Os_TaskIdType i;
+
+    /* Tasks 0 and 1 share core 0, task 2 is unpinned: a spinning SCHED_FIFO
+     * task could starve the lock holder on its core */
+    for (i = 0U; i < 3U; i++) {
+        tasks[i].Priority = static_cast<uint8_t>(30U - (i * 10U));
+    }
+    tasks[0].CoreId = 0;
+    tasks[1].CoreId = 0;
+    config.Mapping = OS_MAPPING_MULTI_CORE;
+    ASSERT_EQ(Os_Init(&config), E_OK);
+    RunTicks(10U);
+    WaitForReleases(1U, 1U);
+
+    for (i = 0U; i < 3U; i++) {
+        ASSERT_EQ(Os_GetTaskStats(i, &stats), E_OK);
+        EXPECT_FALSE(stats.RealTime);
+    }
+}
+
+/*============================================================================*
+ * DEADLINE SUPERVISION TESTS
+ *============================================================================*/
+
+TEST_F(OsTest, Deadline_MissDetectedInBothMappings) {
+    Os_MappingType mapping;
+    Os_TaskStatsType stats;
+
+    for (mapping = OS_MAPPING_SINGLE_THREAD; mapping <= OS_MAPPING_MULTI_CORE;
+         mapping = static_cast<Os_MappingType>(mapping + 1)) {
+        /* Interference: 2ms of a 1ms deadline */
+        tasks[2].DeadlineUs = 1000U;
+        TestOs_SleepUs = 2000U;
+        config.Mapping = mapping;
+        ASSERT_EQ(Os_Init(&config), E_OK);
+        RunTicks(40U);
+        WaitForReleases(0U, 8U);
+        WaitForReleases(2U, 2U);
+
+        /* Releases of a loaded machine may be lost, and count as misses */
+        ASSERT_EQ(Os_GetTaskStats(2U, &stats), E_OK);
+        EXPECT_EQ(stats.Activations + stats.LostActivations, 2U);
+        EXPECT_EQ(stats.DeadlineMisses, 2U);
+        EXPECT_GE(stats.MaxResponseNs, 2000000U);
+        EXPECT_GE(stats.SumResponseNs, stats.Activations * 2000000ULL);
+
+        /* Deadline = period */
+        ASSERT_EQ(Os_GetTaskStats(0U, &stats), E_OK);
+        EXPECT_EQ(stats.Activations + stats.LostActivations, 8U);
+        EXPECT_GE(stats.DeadlineMisses, stats.LostActivations);
+
+        Os_DeInit();
+    }
+}
+
+TEST_F(OsTest, Deadline_LateTickCountsFromNominalRelease) {
+    Os_TaskStatsType stats;
+
+    tasks[0].DeadlineUs = 1000U;
+    ASSERT_EQ(Os_Init(&config), E_OK);
+
+    Os_Tick(0U);
+    /* Tick 5 comes 4ms after its nominal time */
+    std::this_thread::sleep_for(std::chrono::milliseconds(9));
+    Os_Tick(5U);
+
+    ASSERT_EQ(Os_GetTaskStats(0U, &stats), E_OK);
+    EXPECT_EQ(stats.Activations, 2U);
+    EXPECT_GE(stats.DeadlineMisses, 1U);
+    EXPECT_GE(stats.LastResponseNs, 4000000U);
+}
+
+TEST_F(OsTest, Deadline_OverrunLosesActivationWithoutDelayingOthers) {
+    Os_TaskStatsType stats;
+
+    /* The 20ms job runs 35ms: the release at tick 20 finds it running */
+    TestOs_SleepUs = 35000U;
+    config.Mapping = OS_MAPPING_MULTI_CORE;
+    ASSERT_EQ(Os_Init(&config), E_OK);
+    RunTicks(25U);
+    WaitForReleases(0U, 5U);
+    WaitForReleases(2U, 2U);
+
+    /* Tick 20 came while the job ran: completed after its deadline, and
+     * one lost activation */
+    ASSERT_EQ(Os_GetTaskStats(2U, &stats), E_OK);
+    EXPECT_EQ(stats.Activations, 1U);
+    EXPECT_EQ(stats.LostActivations, 1U);
+    EXPECT_EQ(stats.DeadlineMisses, 2U);
+    EXPECT_GE(stats.LastResponseNs, 35000000U);
+    EXPECT_EQ(TestOs_Runs[2].load(), 1U);
+
+    /* The 5ms task was released at ticks 0 .. 20 */
+    ASSERT_EQ(Os_GetTaskStats(0U, &stats), E_OK);
+    EXPECT_EQ(stats.Activations + stats.LostActivations, 5U);
+}
+
+TEST_F(OsTest, Deadline_DroppedTicksResyncReleases) {
+    Os_TaskStatsType stats;
+    std::chrono::steady_clock::time_point start;
+    uint32_t tick;
+
+    /* Stall of 30 ticks after tick 0, the tick source drops ticks 1 .. 29 */
+    ASSERT_EQ(Os_Init(&config), E_OK);
+    Os_Tick(0U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    Os_SkipTicks(1U, 29U);
+
+    /* Ticks at real time again: without the resync every release would be
+     * 29ms late */
+    start = std::chrono::steady_clock::now();
+    for (tick = 1U; tick <= 40U; tick++) {
+        std::this_thread::sleep_until(start + std::chrono::milliseconds(tick - 1U));
+        Os_Tick(tick);
+    }
+
+    /* Releases at 5 .. 25, 10 and 20, 20 of the dropped interval are lost */
+    ASSERT_EQ(Os_GetTaskStats(0U, &stats), E_OK);
+    EXPECT_EQ(stats.Activations, 9U);
+    EXPECT_EQ(stats.LostActivations, 5U);
+    EXPECT_LE(stats.DeadlineMisses, stats.LostActivations + 1U);
+    EXPECT_LT(stats.MaxResponseNs, 29000000U);
+    ASSERT_EQ(Os_GetTaskStats(1U, &stats), E_OK);
+    EXPECT_EQ(stats.LostActivations, 2U);
+    ASSERT_EQ(Os_GetTaskStats(2U, &stats), E_OK);
+    EXPECT_EQ(stats.LostActivations, 1U);
+}
+
+/*============================================================================*
+ * SPINLOCK TESTS
+ *============================================================================*/
+
+TEST_F(OsTest, Spinlock_MutualExclusion) {
+    uint32_t counter = 0U;
+    auto worker = [&counter]() {
+        uint32_t i;
+
+        for (i = 0U; i < 20000U; i++) {
+            Os_GetSpinlock(OS_SPINLOCK_WDGM);
+            counter++;
+            Os_ReleaseSpinlock(OS_SPINLOCK_WDGM);
+        }
+    };
+
+    std::thread first(worker);
+    std::thread second(worker);
+    first.join();
+    second.join();
+
+    EXPECT_EQ(counter, 40000U);
+
+    /* Invalid IDs are ignored */
+    Os_GetSpinlock(OS_NUM_SPINLOCKS);
+    Os_ReleaseSpinlock(OS_NUM_SPINLOCKS);
+}
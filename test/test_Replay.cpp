@@ -0,0 +1,289 @@
+/**
+ * @file test_Replay.cpp
+ * @brief Unit Tests for Deterministic Record/Replay
+ * @details Records a closed-loop run (stimulus, COM frames, lamp model) and
+ *          replays it bit-exact, detects a diverging replay and checks the
+ *          discrete inputs and the log format
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Test_Util.h"
+#include "Sim/Replay/Replay.h"
+#include "Sim/Stimulus/Stimulus.h"
+#include "Sim/Lamp/Lamp.h"
+#include "Application/Headlight/Headlight.h"
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/LightRequest/LightRequest.h"
+#include "Application/FLM/FLM_Application.h"
+#include "BSW/E2E/E2E_P01.h"
+#include "BSW/Com/Com.h"
+#include "BSW/Cal/Cal.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Pwm/Pwm.h"
+#include "FLM_Config.h"
+#include <cstdio>
+#include <string>
+
+/** @brief Length of the closed-loop run (ms) */
+#define TEST_REPLAY_RUN_MS      3000U
+
+/**
+ * @brief Replay Test Fixture
+ * @details 1ms ticks in virtual time: inputs, ADC, the 10ms runnables, then
+ *          the outputs, as in the main scheduler
+ */
+class ReplayTest : public ::testing::Test {
+protected:
+    E2E_P01ConfigType e2eConfig;
+    E2E_P01ProtectStateType e2eProtectState;
+    std::string path;
+
+    void SetUp() override {
+        path = TestTempPath("flm_replay_", ".flmr");
+        StartSystem();
+    }
+
+    void TearDown() override {
+        StopSystem();
+        (void)std::remove(path.c_str());
+    }
+
+    void StartSystem(void) {
+        static const Adc_ConfigType adcConfig = {};
+
+        Adc_SimSetTimeUs(0U);
+        Pwm_SimSetTimeUs(0U);
+
+        Adc_Init(&adcConfig);
+        Dio_Init();
+        Pwm_Init();
+        Cal_Init(&Cal_Config);
+        Com_Init();
+        Com_IpduGroupStart(COM_IPDUGROUP_RX);
+
+        SwitchEvent_Init();
+        LightRequest_Init();
+        FLM_Init();
+        Headlight_Init();
+        Lamp_Init();
+
+        e2eConfig.DataLength = FLM_E2E_LIGHTSWITCH_DATA_LENGTH;
+        e2eConfig.DataID = FLM_E2E_LIGHTSWITCH_DATA_ID;
+        e2eConfig.CounterOffset = FLM_E2E_COUNTER_OFFSET;
+        e2eConfig.CRCOffset = FLM_E2E_CRC_OFFSET;
+        E2E_P01ProtectInit(&e2eProtectState);
+    }
+
+    void StopSystem(void) {
+        Replay_Stop();
+        Stimulus_DeInit();
+        Lamp_DeInit();
+        Com_DeInit();
+        Cal_DeInit();
+        Pwm_DeInit();
+        Adc_DeInit();
+    }
+
+    /** @brief One tick; recorded runs generate the inputs themselves */
+    void RunTick(uint32_t tickMs, boolean generateInputs) {
+        const uint64_t timeUs = static_cast<uint64_t>(tickMs) * 1000U;
+
+        Replay_MainFunctionInputs(timeUs);
+        if (generateInputs && ((tickMs % 10U) == 0U)) {
+            uint8_t data[4] = {0};
+            PduInfoType pduInfo;
+
+            data[COM_LIGHTSWITCH_CMD_BYTE] = static_cast<uint8_t>(LIGHT_SWITCH_AUTO);
+            E2E_P01Protect(&e2eConfig, &e2eProtectState, data, 4U);
+            pduInfo.SduDataPtr = data;
+            pduInfo.MetaDataPtr = NULL_PTR;
+            pduInfo.SduLength = 4U;
+            Com_RxIndication(COM_IPDU_LIGHTSWITCH_RX, &pduInfo);
+        }
+        Adc_SimSetTimeUs(timeUs);
+        Pwm_SimSetTimeUs(timeUs);
+        if (generateInputs) {
+            Stimulus_MainFunction(timeUs);
+        }
+
+        Adc_MainFunction();
+        if ((tickMs % 10U) == 0U) {
+            Com_MainFunctionRx();
+            SwitchEvent_MainFunction();
+            LightRequest_MainFunction();
+            FLM_MainFunction();
+            Headlight_MainFunction();
+        }
+
+        Replay_MainFunctionOutputs(timeUs);
+    }
+
+    /** @brief Record the closed-loop run with the demo ambient steps */
+    void Record(Replay_StatsType* stats) {
+        uint32_t tickMs;
+
+        Stimulus_Init();
+        ASSERT_EQ(Stimulus_LoadScenario("demo"), E_OK);
+        ASSERT_EQ(Replay_StartRecord(path.c_str()), E_OK);
+
+        for (tickMs = 0U; tickMs < TEST_REPLAY_RUN_MS; tickMs++) {
+            RunTick(tickMs, TRUE);
+        }
+
+        Replay_Stop();
+        Replay_GetStats(stats);
+        Stimulus_DeInit();
+    }
+
+    /** @brief Restart the system and replay until the end of the recording */
+    uint32_t Replay(void (*atTick)(uint32_t tickMs)) {
+        uint32_t tickMs;
+
+        StopSystem();
+        StartSystem();
+        EXPECT_EQ(Replay_StartReplay(path.c_str()), E_OK);
+
+        for (tickMs = 0U; (tickMs < (2U * TEST_REPLAY_RUN_MS)) && !Replay_IsFinished(); tickMs++) {
+            if (atTick != NULL_PTR) {
+                atTick(tickMs);
+            }
+            RunTick(tickMs, FALSE);
+        }
+
+        return tickMs;
+    }
+};
+
+/*============================================================================*
+ * CLOSED-LOOP REPLAY TESTS
+ *============================================================================*/
+
+TEST_F(ReplayTest, Replay_ReproducesRecordedRun) {
+    Replay_StatsType recorded;
+    Replay_StatsType replayed;
+
+    Record(&recorded);
+    EXPECT_EQ(recorded.InputEvents, TEST_REPLAY_RUN_MS / 10U);
+    EXPECT_GT(recorded.AdcBlocks, 0U);
+    /* The lights followed the ambient steps */
+    EXPECT_GT(recorded.OutputEvents, 2U);
+
+    EXPECT_EQ(Replay(NULL_PTR), TEST_REPLAY_RUN_MS);
+
+    Replay_GetStats(&replayed);
+    EXPECT_EQ(replayed.Mode, REPLAY_MODE_REPLAY);
+    EXPECT_EQ(replayed.Mismatches, 0U);
+    EXPECT_EQ(replayed.InputEvents, recorded.InputEvents);
+    EXPECT_EQ(replayed.AdcBlocks, recorded.AdcBlocks);
+    EXPECT_EQ(replayed.OutputEvents, recorded.OutputEvents);
+    EXPECT_EQ(replayed.DurationUs, (TEST_REPLAY_RUN_MS - 1U) * 1000U);
+}
+
+TEST_F(ReplayTest, Replay_DetectsDivergingRun) {
+    Replay_StatsType recorded;
+    Replay_StatsType replayed;
+
+    Record(&recorded);
+
+    /* The control software behaves differently from the recording: a slower
+     * ambient filter delays the switch-on at the dark step */
+    (void)Replay([](uint32_t tickMs) {
+        static const LightRequest_FilterStageConfigType slowFilter[] = {
+            { LIGHTREQUEST_FILTER_IIR_LOWPASS, 1024U }
+        };
+
+        if (tickMs == 1000U) {
+            (void)LightRequest_SetFilterChain(slowFilter, 1U);
+        }
+    });
+
+    Replay_GetStats(&replayed);
+    EXPECT_GT(replayed.Mismatches, 0U);
+    EXPECT_GE(replayed.FirstMismatchUs, 1000000U);
+}
+
+TEST_F(ReplayTest, Record_LogIsCompact) {
+    Replay_StatsType recorded;
+    FILE* file;
+    long size;
+
+    Record(&recorded);
+
+    file = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    (void)std::fseek(file, 0, SEEK_END);
+    size = std::ftell(file);
+    (void)std::fclose(file);
+
+    EXPECT_EQ(static_cast<uint32_t>(size), recorded.LogBytes);
+    /* Delta and run-length coded: smaller than the raw 16 bit ambient samples */
+    EXPECT_LT(static_cast<uint32_t>(size),
+              (TEST_REPLAY_RUN_MS * 1000U / ADC_STREAM_CONVERSION_PERIOD_US) * 2U);
+}
+
+/*============================================================================*
+ * DISCRETE INPUT TESTS
+ *============================================================================*/
+
+TEST_F(ReplayTest, Replay_AppliesInputsAtRecordedTick) {
+    Replay_StatsType stats;
+    uint32_t tickMs;
+
+    ASSERT_EQ(Replay_StartRecord(path.c_str()), E_OK);
+    for (tickMs = 0U; tickMs < 50U; tickMs++) {
+        Replay_MainFunctionInputs(static_cast<uint64_t>(tickMs) * 1000U);
+        if ((tickMs % 10U) == 5U) {
+            Dio_SimSetInput(FLM_DIO_CHANNEL_FEEDBACK, ((tickMs / 10U) % 2U == 0U) ? STD_HIGH : STD_LOW);
+        }
+        Replay_MainFunctionOutputs(static_cast<uint64_t>(tickMs) * 1000U);
+    }
+    Replay_Stop();
+
+    Dio_SimSetInput(FLM_DIO_CHANNEL_FEEDBACK, STD_LOW);
+    ASSERT_EQ(Replay_StartReplay(path.c_str()), E_OK);
+    for (tickMs = 0U; !Replay_IsFinished(); tickMs++) {
+        ASSERT_LT(tickMs, 100U);
+        Replay_MainFunctionInputs(static_cast<uint64_t>(tickMs) * 1000U);
+        if (tickMs >= 5U) {
+            EXPECT_EQ(Dio_ReadChannel(FLM_DIO_CHANNEL_FEEDBACK),
+                      (((tickMs - 5U) / 10U) % 2U == 0U) ? STD_HIGH : STD_LOW) << tickMs;
+        }
+        Replay_MainFunctionOutputs(static_cast<uint64_t>(tickMs) * 1000U);
+    }
+
+    Replay_GetStats(&stats);
+    EXPECT_EQ(stats.InputEvents, 5U);
+    EXPECT_EQ(stats.Mismatches, 0U);
+}
+
+/*============================================================================*
+ * LOG FORMAT TESTS
+ *============================================================================*/
+
+TEST_F(ReplayTest, StartReplay_RejectsInvalidLog) {
+    static const char garbage[] = "FLMX\x01\x00\x07\x00";
+    static const char truncated[] = "FLMR\x01\x00\x06\x20\x01";
+    FILE* file;
+
+    EXPECT_EQ(Replay_StartReplay("test_replay_missing.flmr"), E_NOT_OK);
+
+    file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    (void)std::fwrite(garbage, 1U, sizeof(garbage) - 1U, file);
+    (void)std::fclose(file);
+    EXPECT_EQ(Replay_StartReplay(path.c_str()), E_NOT_OK);
+
+    file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    (void)std::fwrite(truncated, 1U, sizeof(truncated) - 1U, file);
+    (void)std::fclose(file);
+    EXPECT_EQ(Replay_StartReplay(path.c_str()), E_NOT_OK);
+
+    /* Nothing active: a recording can start */
+    EXPECT_TRUE(Replay_IsFinished());
+    EXPECT_EQ(Replay_StartRecord(path.c_str()), E_OK);
+    EXPECT_EQ(Replay_StartReplay(path.c_str()), E_NOT_OK);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_Rte.cpp
+ * @brief Unit Tests for the RTE Sender/Receiver Ports
+ * @details Tests the double-buffered port slots (publish by index flip,
+ *          zero-copy snapshots) and the port wiring between the SWCs
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Rte/Rte.h"
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/LightRequest/LightRequest.h"
+#include "Application/FLM/FLM_Application.h"
+#include "Application/Headlight/Headlight.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Pwm/Pwm.h"
+#include "BSW/Cal/Cal.h"
+
+/**
+ * @brief RTE Test Fixture
+ */
+class RteTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Rte_Start();
+    }
+};
+
+/*============================================================================*
+ * PORT SLOT TESTS
+ *============================================================================*/
+
+TEST_F(RteTest, Start_InitialValuesNeverWritten) {
+    SafetyStatusType mode = SAFETY_STATUS_SAFE_STATE;
+    uint8_t port;
+
+    for (port = 0U; port < RTE_NUM_PORTS; port++) {
+        EXPECT_EQ(Rte_GetPortSequence(port), 0U);
+    }
+    EXPECT_EQ(Rte_GetPortSequence(RTE_NUM_PORTS), 0U);
+
+    EXPECT_FALSE(Rte_IRead_FLM_LightSwitch()->status.isValid);
+    EXPECT_EQ(Rte_IRead_FLM_LightSwitch()->e2eSmStatus, E2E_SM_DEINIT);
+    EXPECT_FALSE(Rte_IRead_FLM_AmbientLight()->level.isValid);
+    EXPECT_EQ(Rte_IRead_Headlight_HeadlightCmd()->command, HEADLIGHT_CMD_OFF);
+    EXPECT_EQ(Rte_IRead_SafetyMonitor_HeadlightCmd()->flmState, FLM_STATE_INIT);
+    EXPECT_EQ(Rte_IRead_SafetyMonitor_HeadlightStatus()->faultStatus, HEADLIGHT_FAULT_NONE);
+    EXPECT_EQ(Rte_Mode_FLM_SafetyMode(&mode), RTE_E_OK);
+    EXPECT_EQ(mode, SAFETY_STATUS_OK);
+    EXPECT_EQ(Rte_Mode_FLM_SafetyMode(NULL_PTR), RTE_E_INVALID);
+}
+
+TEST_F(RteTest, Write_PublishesByIndexFlip) {
+    Rte_IrvHeadlightCmdType data = { HEADLIGHT_CMD_LOW_BEAM, FLM_STATE_NORMAL, 10U };
+    const Rte_IrvHeadlightCmdType* first;
+    const Rte_IrvHeadlightCmdType* second;
+
+    EXPECT_EQ(Rte_Write_FLM_HeadlightCmd(&data), RTE_E_OK);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_HEADLIGHTCMD), 1U);
+    first = Rte_IRead_Headlight_HeadlightCmd();
+    EXPECT_EQ(first->command, HEADLIGHT_CMD_LOW_BEAM);
+
+    /* All receivers of a port see the same buffer */
+    EXPECT_EQ(Rte_IRead_SafetyMonitor_HeadlightCmd(), first);
+
+    /* The next publish goes to the other buffer: the held snapshot is intact */
+    data.command = HEADLIGHT_CMD_HIGH_BEAM;
+    data.timestamp = 20U;
+    EXPECT_EQ(Rte_Write_FLM_HeadlightCmd(&data), RTE_E_OK);
+    second = Rte_IRead_Headlight_HeadlightCmd();
+    EXPECT_NE(second, first);
+    EXPECT_EQ(first->command, HEADLIGHT_CMD_LOW_BEAM);
+    EXPECT_EQ(first->timestamp, 10U);
+    EXPECT_EQ(second->command, HEADLIGHT_CMD_HIGH_BEAM);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_HEADLIGHTCMD), 2U);
+
+    /* Other ports are untouched */
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_LIGHTSWITCH), 0U);
+    EXPECT_EQ(Rte_Write_FLM_HeadlightCmd(NULL_PTR), RTE_E_INVALID);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_HEADLIGHTCMD), 2U);
+}
+
+/*============================================================================*
+ * PORT WIRING TESTS
+ *============================================================================*/
+
+TEST_F(RteTest, Swc_InitAndMainFunctionPublish) {
+    static const Adc_ConfigType adcConfig = {};
+    SafetyStatusType mode = SAFETY_STATUS_OK;
+
+    Adc_Init(&adcConfig);
+    Dio_Init();
+    Pwm_Init();
+    Cal_Init(&Cal_Config);
+    SwitchEvent_Init();
+    LightRequest_Init();
+    FLM_Init();
+    Headlight_Init();
+    SafetyMonitor_Init();
+
+    /* Every SWC publishes its initial outputs */
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_LIGHTSWITCH), 1U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_AMBIENTLIGHT), 1U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_HEADLIGHTCMD), 1U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_HEADLIGHTSTATUS), 1U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_SAFETYSTATUS), 1U);
+
+    /* One publish per runnable execution, read back by the receivers */
+    LightRequest_SimSetAdcValue(2000);
+    SwitchEvent_MainFunction();
+    LightRequest_MainFunction();
+    FLM_MainFunction();
+    Headlight_MainFunction();
+    SafetyMonitor_TriggerSafeState(SAFE_STATE_REASON_MANUAL);
+    SafetyMonitor_MainFunction();
+
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_LIGHTSWITCH), 2U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_AMBIENTLIGHT), 2U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_HEADLIGHTCMD), 2U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_HEADLIGHTSTATUS), 2U);
+    EXPECT_EQ(Rte_GetPortSequence(RTE_PORT_SAFETYSTATUS), 2U);
+
+    EXPECT_EQ(Rte_IRead_FLM_AmbientLight()->level.adcValue,
+              LightRequest_GetAmbientLight().adcValue);
+    EXPECT_EQ(Rte_IRead_SafetyMonitor_LightSwitch()->e2eSmStatus,
+              SwitchEvent_GetE2ESmStatus());
+    EXPECT_EQ(Rte_IRead_SafetyMonitor_HeadlightCmd()->flmState, FLM_GetCurrentState());
+    EXPECT_EQ(Rte_IRead_SafetyMonitor_HeadlightStatus()->actualState,
+              Headlight_GetActualState());
+    EXPECT_EQ(Rte_Mode_FLM_SafetyMode(&mode), RTE_E_OK);
+    EXPECT_EQ(mode, SAFETY_STATUS_SAFE_STATE);
+
+    Cal_DeInit();
+    Pwm_DeInit();
+    Adc_DeInit();
+}
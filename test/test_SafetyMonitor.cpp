@@ -13,6 +13,7 @@
 #include "Application/FLM/FLM_Application.h"
 #include "Application/Headlight/Headlight.h"
 #include "MCAL/Adc/Adc.h"
+#include "BSW/Cal/Cal.h"
 #include "MCAL/Dio/Dio.h"
 #include "FLM_Config.h"
 
@@ -26,9 +27,10 @@ class SafetyMonitorTest : public ::testing::Test {
 protected:
     void SetUp() override {
         /* Initialize MCAL */
-        static const Adc_ConfigType adcConfig = {0};
+        static const Adc_ConfigType adcConfig = {};
         Adc_Init(&adcConfig);
         Dio_Init();
+        Cal_Init(&Cal_Config);
 
         /* Initialize all SWCs */
         SwitchEvent_Init();
@@ -42,6 +44,7 @@ protected:
     }
 
     void TearDown() override {
+        Cal_DeInit();
         Adc_DeInit();
     }
 };
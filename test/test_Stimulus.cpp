@@ -0,0 +1,325 @@
+/**
+ * @file test_Stimulus.cpp
+ * @brief Unit Tests for Sensor Stimulus Engine
+ * @details Tests waveform shapes, block generation, recorded traces,
+ *          scenarios and random ambient scenarios through LightRequest
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Test_Util.h"
+#include <cstdio>
+#include "Sim/Stimulus/Stimulus.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include "Application/LightRequest/LightRequest.h"
+
+/**
+ * @brief Stimulus Test Fixture
+ */
+class StimulusTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Adc_Init(&Adc_Config);
+        Stimulus_Init();
+    }
+
+    void TearDown() override {
+        Stimulus_DeInit();
+        Adc_DeInit();
+    }
+
+    /** @brief Sample of the ambient track at a point in time */
+    static uint16_t SampleAt(uint64_t timeUs) {
+        uint16_t value = 0U;
+        EXPECT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                         timeUs, 0U, 1U, &value), E_OK);
+        return value;
+    }
+};
+
+/**
+ * @test Segment shapes on the track time line
+ */
+TEST_F(StimulusTest, Shapes_Waveforms) {
+    const Stimulus_SegmentConfigType segments[] = {
+        { STIMULUS_SHAPE_HOLD, 100U, 1000.0f, 1000.0f, 0U },
+        { STIMULUS_SHAPE_RAMP, 1000U, 1000.0f, 2000.0f, 0U },
+        { STIMULUS_SHAPE_SCURVE, 1000U, 2000.0f, 1000.0f, 0U },
+        { STIMULUS_SHAPE_TUNNEL, 1000U, 1000.0f, 200.0f, 100U },
+        { STIMULUS_SHAPE_FLICKER, 1000U, 1500.0f, 500.0f, 200U }
+    };
+    uint8_t i;
+
+    for (i = 0U; i < 5U; i++) {
+        ASSERT_EQ(Stimulus_AddSegment(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, &segments[i]), E_OK);
+    }
+    EXPECT_EQ(Stimulus_GetDurationMs(), 4100U);
+
+    EXPECT_EQ(SampleAt(50000U), 1000U);
+    /* Ramp: half way */
+    EXPECT_EQ(SampleAt(600000U), 1500U);
+    /* S-curve: flat at the ends, half way in the middle */
+    EXPECT_NEAR(SampleAt(1110000U), 1998U, 2U);
+    EXPECT_EQ(SampleAt(1600000U), 1500U);
+    /* Tunnel: half way down the entry ramp, inside, on the way out */
+    EXPECT_EQ(SampleAt(2150000U), 600U);
+    EXPECT_EQ(SampleAt(2600000U), 200U);
+    EXPECT_EQ(SampleAt(3050000U), 600U);
+    /* Flicker: quarter and three quarter period */
+    EXPECT_EQ(SampleAt(3150000U), 2000U);
+    EXPECT_EQ(SampleAt(3250000U), 1000U);
+    /* Without loop the last value is held */
+    EXPECT_EQ(SampleAt(10000000U), 1500U);
+
+    /* Values are clamped to the converter range */
+    const Stimulus_SegmentConfigType high = { STIMULUS_SHAPE_HOLD, 10U, 9000.0f, 9000.0f, 0U };
+    ASSERT_EQ(Stimulus_AddSegment(STIMULUS_TARGET_ADC, 1U, &high), E_OK);
+    uint16_t value = 0U;
+    ASSERT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, 1U, 0U, 0U, 1U, &value), E_OK);
+    EXPECT_EQ(value, ADC_MAX_VALUE);
+}
+
+/**
+ * @test Block results do not depend on the block split, noise is bounded
+ */
+TEST_F(StimulusTest, GenerateBlock_SplitInvariant) {
+    const Stimulus_SegmentConfigType segments[] = {
+        { STIMULUS_SHAPE_RAMP, 300U, 500.0f, 3000.0f, 0U },
+        { STIMULUS_SHAPE_FLICKER, 300U, 2000.0f, 800.0f, 70U }
+    };
+    const Stimulus_TrackConfigType track = {
+        STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, TRUE, 50U, 1234U, segments, 2U
+    };
+    static uint16_t whole[3000];
+    static uint16_t split[3000];
+    static uint16_t clean[3000];
+    uint16_t done = 0U;
+    uint16_t n = 1U;
+    uint16_t i;
+
+    ASSERT_EQ(Stimulus_AddTrack(&track), E_OK);
+    ASSERT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                     100000U, 250U, 3000U, whole), E_OK);
+
+    /* Uneven block sizes across segment ends and loop wraps */
+    while (done < 3000U) {
+        if (n > (3000U - done)) {
+            n = static_cast<uint16_t>(3000U - done);
+        }
+        ASSERT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                         100000U + (static_cast<uint64_t>(done) * 250U), 250U,
+                                         n, &split[done]), E_OK);
+        done = static_cast<uint16_t>(done + n);
+        n = static_cast<uint16_t>((n * 3U) + 1U);
+    }
+
+    ASSERT_EQ(Stimulus_SetNoise(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, 0U, 0U), E_OK);
+    ASSERT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                     100000U, 250U, 3000U, clean), E_OK);
+
+    for (i = 0U; i < 3000U; i++) {
+        ASSERT_EQ(whole[i], split[i]) << "sample " << i;
+        EXPECT_NEAR(whole[i], clean[i], 51);
+    }
+    EXPECT_NE(whole[10], clean[10]);
+
+    /* No track: nothing generated */
+    EXPECT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, 5U, 0U, 250U, 10U, clean), E_NOT_OK);
+    EXPECT_EQ(Stimulus_SetNoise(STIMULUS_TARGET_DIO, 5U, 10U, 1U), E_NOT_OK);
+}
+
+/**
+ * @test Recorded trace from CSV, interpolated and looped
+ */
+TEST_F(StimulusTest, LoadCsv_RecordedTrace) {
+    const std::string trace = TestTempPath("flm_stimulus_", ".csv");
+    const char* path = trace.c_str();
+    FILE* file = std::fopen(path, "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("time_ms,value\n# sensor log\n1000,800\n1100,1800\n1300,1800\n\n1400,600\n", file);
+    std::fclose(file);
+
+    ASSERT_EQ(Stimulus_LoadCsv(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, path, TRUE), E_OK);
+    EXPECT_EQ(Stimulus_GetDurationMs(), 400U);
+
+    EXPECT_EQ(SampleAt(0U), 800U);
+    EXPECT_EQ(SampleAt(50000U), 1300U);
+    EXPECT_EQ(SampleAt(200000U), 1800U);
+    EXPECT_EQ(SampleAt(350000U), 1200U);
+    /* Second loop */
+    EXPECT_EQ(SampleAt(400001U + 50000U), 1300U);
+
+    /* Descending times are rejected */
+    file = std::fopen(path, "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("0,100\n50,200\n40,300\n", file);
+    std::fclose(file);
+    EXPECT_EQ(Stimulus_LoadCsv(STIMULUS_TARGET_ADC, 1U, path, FALSE), E_NOT_OK);
+    EXPECT_EQ(Stimulus_LoadCsv(STIMULUS_TARGET_ADC, 1U, "does_not_exist.csv", FALSE), E_NOT_OK);
+    (void)std::remove(path);
+}
+
+/**
+ * @test A rejected segment or an empty trace leaves no track behind
+ */
+TEST_F(StimulusTest, Rejected_NoEmptyTrack) {
+    const Stimulus_SegmentConfigType empty = { STIMULUS_SHAPE_HOLD, 0U, 1000.0f, 1000.0f, 0U };
+    const Stimulus_SegmentConfigType table = { STIMULUS_SHAPE_TABLE, 100U, 0.0f, 0.0f, 0U };
+    const Stimulus_SegmentConfigType hold = { STIMULUS_SHAPE_HOLD, 100U, 700.0f, 700.0f, 0U };
+    const Stimulus_SegmentConfigType mixed[] = { hold, empty };
+    const Stimulus_TrackConfigType track = { STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                             TRUE, 0U, 0U, mixed, 2U };
+    const std::string path = TestTempPath("flm_stimulus_", ".csv");
+    uint16_t value = 0U;
+
+    EXPECT_EQ(Stimulus_AddSegment(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, &empty), E_NOT_OK);
+    EXPECT_EQ(Stimulus_AddSegment(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, &table), E_NOT_OK);
+    EXPECT_EQ(Stimulus_AddTrack(&track), E_NOT_OK);
+
+    /* Header only */
+    FILE* file = std::fopen(path.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("time_ms,value\n# no samples\n", file);
+    std::fclose(file);
+    EXPECT_EQ(Stimulus_LoadCsv(STIMULUS_TARGET_ADC, 1U, path.c_str(), FALSE), E_NOT_OK);
+    (void)std::remove(path.c_str());
+
+    EXPECT_EQ(Stimulus_GetDurationMs(), 0U);
+    EXPECT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, 0U, 0U, 1U, &value),
+              E_NOT_OK);
+    EXPECT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, 1U, 0U, 0U, 1U, &value), E_NOT_OK);
+    Stimulus_MainFunction(1000U);
+
+    /* A rejected track keeps the waveform of the channel */
+    ASSERT_EQ(Stimulus_AddSegment(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, &hold), E_OK);
+    EXPECT_EQ(Stimulus_AddTrack(&track), E_NOT_OK);
+    EXPECT_EQ(SampleAt(250000U), 700U);
+}
+
+/**
+ * @test Streaming conversions sample the waveform at their conversion time
+ */
+TEST_F(StimulusTest, AdcStream_FollowsWaveform) {
+    const Stimulus_SegmentConfigType ramp = { STIMULUS_SHAPE_RAMP, 1000U, 0.0f, 4000.0f, 0U };
+    static Adc_ValueGroupType stream[ADC_AMBIENT_STREAM_SAMPLES];
+    static Adc_ValueGroupType block[ADC_AMBIENT_STREAM_SAMPLES];
+    Adc_StreamNumSampleType numSamples;
+    Adc_StreamNumSampleType i;
+
+    ASSERT_EQ(Stimulus_AddSegment(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT, &ramp), E_OK);
+
+    Adc_SimSetTimeUs(0U);
+    ASSERT_EQ(Adc_SetupResultBuffer(ADC_GROUP_AMBIENT_STREAM, stream), E_OK);
+    Adc_StartGroupConversion(ADC_GROUP_AMBIENT_STREAM);
+
+    /* 20ms of conversions at 4kHz: 1 count per conversion */
+    Adc_SimSetTimeUs(20000U);
+    numSamples = Adc_ReadGroupStream(ADC_GROUP_AMBIENT_STREAM, block, ADC_AMBIENT_STREAM_SAMPLES);
+    ASSERT_EQ(numSamples, 81U);
+    for (i = 0U; i < numSamples; i++) {
+        EXPECT_EQ(block[i], i);
+    }
+
+    /* Channels without track keep their simulated level */
+    Adc_SimSetValue(FLM_ADC_CHANNEL_CURRENT, 321U);
+    Adc_StartGroupConversion(ADC_GROUP_CURRENT);
+    ASSERT_EQ(Adc_ReadGroup(ADC_GROUP_CURRENT, block), E_OK);
+    EXPECT_EQ(block[0], 321U);
+}
+
+/**
+ * @test Step sequence on a DIO input
+ */
+TEST_F(StimulusTest, DioSteps_MainFunction) {
+    const Stimulus_SegmentConfigType steps[] = {
+        { STIMULUS_SHAPE_HOLD, 10U, 0.0f, 0.0f, 0U },
+        { STIMULUS_SHAPE_HOLD, 20U, 1.0f, 1.0f, 0U }
+    };
+    const Stimulus_TrackConfigType track = { STIMULUS_TARGET_DIO, 7U, TRUE, 0U, 0U, steps, 2U };
+
+    Dio_Init();
+    Dio_SimSetDirection(7U, FALSE);
+    ASSERT_EQ(Stimulus_AddTrack(&track), E_OK);
+
+    Stimulus_MainFunction(5000U);
+    EXPECT_EQ(Dio_ReadChannel(7U), STD_LOW);
+    Stimulus_MainFunction(15000U);
+    EXPECT_EQ(Dio_ReadChannel(7U), STD_HIGH);
+    Stimulus_MainFunction(35000U);
+    EXPECT_EQ(Dio_ReadChannel(7U), STD_LOW);
+
+    /* Unknown channel */
+    const Stimulus_TrackConfigType invalid = { STIMULUS_TARGET_DIO, DIO_NUM_CHANNELS, FALSE, 0U, 0U, steps, 2U };
+    EXPECT_EQ(Stimulus_AddTrack(&invalid), E_NOT_OK);
+}
+
+/**
+ * @test Named scenarios
+ */
+TEST_F(StimulusTest, Scenarios_LoadByName) {
+    uint8_t i;
+
+    for (i = 0U; i < STIMULUS_NUM_SCENARIOS; i++) {
+        EXPECT_EQ(Stimulus_LoadScenario(Stimulus_ScenarioConfig[i].Name), E_OK)
+            << Stimulus_ScenarioConfig[i].Name;
+        EXPECT_GT(Stimulus_GetDurationMs(), 0U);
+    }
+    EXPECT_EQ(Stimulus_LoadScenario("unknown"), E_NOT_OK);
+
+    /* Demo pattern: steps of 100 every 100ms, dark second, repeated */
+    ASSERT_EQ(Stimulus_LoadScenario(STIMULUS_DEFAULT_SCENARIO), E_OK);
+    EXPECT_EQ(Stimulus_GetDurationMs(), 2000U);
+    EXPECT_EQ(SampleAt(0U), 1500U);
+    EXPECT_EQ(SampleAt(350000U), 1800U);
+    EXPECT_EQ(SampleAt(1500000U), 500U);
+    EXPECT_EQ(SampleAt(2950000U), 2400U);
+
+    Stimulus_MainFunction(1500000U);
+    EXPECT_EQ(Adc_SimGetValue(FLM_ADC_CHANNEL_AMBIENT), 500U);
+}
+
+/**
+ * @test Random ambient scenarios through LightRequest: realistic levels are
+ *       never taken for open or short circuit
+ */
+TEST_F(StimulusTest, RandomAmbient_LightRequestStress) {
+    static Adc_ValueGroupType samples[ADC_MAX_STREAM_SAMPLES];
+    static Adc_ValueGroupType again[ADC_MAX_STREAM_SAMPLES];
+    const uint32_t numScenarios = 40U;
+    const uint32_t durationMs = 30000U;
+    uint32_t seed;
+    uint32_t timeMs;
+    uint16_t i;
+    SignalStatus status;
+
+    for (seed = 1U; seed <= numScenarios; seed++) {
+        /* Same seed, same scenario; levels within the realistic range */
+        ASSERT_EQ(Stimulus_BuildRandomAmbient(seed, durationMs), E_OK);
+        ASSERT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                         0U, 117U * 1000U, ADC_MAX_STREAM_SAMPLES, samples), E_OK);
+        ASSERT_EQ(Stimulus_BuildRandomAmbient(seed, durationMs), E_OK);
+        ASSERT_EQ(Stimulus_GenerateBlock(STIMULUS_TARGET_ADC, FLM_ADC_CHANNEL_AMBIENT,
+                                         0U, 117U * 1000U, ADC_MAX_STREAM_SAMPLES, again), E_OK);
+        for (i = 0U; i < ADC_MAX_STREAM_SAMPLES; i++) {
+            ASSERT_EQ(samples[i], again[i]);
+            ASSERT_GE(samples[i], STIMULUS_RANDOM_MIN_LEVEL - STIMULUS_RANDOM_MAX_NOISE);
+            ASSERT_LE(samples[i], STIMULUS_RANDOM_MAX_LEVEL + STIMULUS_RANDOM_MAX_NOISE);
+        }
+
+        Adc_Init(&Adc_Config);
+        Adc_SimSetTimeUs(0U);
+        LightRequest_Init();
+
+        for (timeMs = FLM_AMBIENT_LIGHT_PERIOD_MS; timeMs <= durationMs;
+             timeMs += FLM_AMBIENT_LIGHT_PERIOD_MS) {
+            Adc_SimSetTimeUs(static_cast<uint64_t>(timeMs) * 1000U);
+            LightRequest_MainFunction();
+
+            status = LightRequest_GetSignalStatus();
+            ASSERT_NE(status, SIGNAL_STATUS_OPEN_CIRCUIT) << "seed " << seed << " at " << timeMs;
+            ASSERT_NE(status, SIGNAL_STATUS_SHORT_CIRCUIT) << "seed " << seed << " at " << timeMs;
+        }
+    }
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_Trace.cpp
+ * @brief Unit Tests for the Trace Facility
+ * @details Tests the per-thread rings, the drop accounting and the Chrome
+ *          trace / Perfetto JSON export
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "Test_Util.h"
+#include "BSW/Trace/Trace.h"
+#include "Application/SafetyMonitor/SafetyMonitor.h"
+#include "Application/SwitchEvent/SwitchEvent.h"
+#include "Application/LightRequest/LightRequest.h"
+#include "Application/FLM/FLM_Application.h"
+#include "Application/Headlight/Headlight.h"
+#include "MCAL/Adc/Adc.h"
+#include "MCAL/Dio/Dio.h"
+#include "BSW/Cal/Cal.h"
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Trace Test Fixture
+ */
+class TraceTest : public ::testing::Test {
+protected:
+    std::string path;
+
+    void SetUp() override {
+        path = TestTempPath("flm_trace_", ".json");
+        Trace_Init();
+    }
+
+    void TearDown() override {
+        Trace_Stop();
+        Trace_Init();
+        (void)std::remove(path.c_str());
+    }
+
+    std::string ReadTrace(void) {
+        std::ifstream file(path);
+        std::stringstream content;
+
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    Trace_StatisticsType GetStatistics(void) {
+        Trace_StatisticsType stats;
+
+        EXPECT_EQ(Trace_GetStatistics(&stats), E_OK);
+        return stats;
+    }
+};
+
+/*============================================================================*
+ * CONTROL TESTS
+ *============================================================================*/
+
+TEST_F(TraceTest, Record_IgnoredWhileStopped) {
+    Trace_Record(TRACE_RECORD_RUNNABLE_ENTRY, TRACE_RUNNABLE_FLM, 0U, 0U);
+
+    EXPECT_FALSE(Trace_IsActive());
+    EXPECT_EQ(GetStatistics().Threads, 0U);
+    EXPECT_EQ(GetStatistics().Dropped, 0U);
+}
+
+TEST_F(TraceTest, Start_RejectsInvalidUse) {
+    Trace_StatisticsType* nullStats = NULL_PTR;
+
+    EXPECT_EQ(Trace_Start(NULL_PTR), E_NOT_OK);
+    EXPECT_EQ(Trace_Start("/nonexistent-dir/trace.json"), E_NOT_OK);
+    EXPECT_EQ(Trace_GetStatistics(nullStats), E_NOT_OK);
+
+    ASSERT_EQ(Trace_Start(path.c_str()), E_OK);
+    EXPECT_TRUE(Trace_IsActive());
+    EXPECT_EQ(Trace_Start(path.c_str()), E_NOT_OK);
+}
+
+/*============================================================================*
+ * RING TESTS
+ *============================================================================*/
+
+TEST_F(TraceTest, Record_OneRingPerThread) {
+    const uint32_t perThread = 100U;
+    uint32_t i;
+
+    ASSERT_EQ(Trace_Start(path.c_str()), E_OK);
+
+    std::thread worker([perThread] {
+        uint32_t j;
+
+        Trace_SetThreadName("Worker");
+        for (j = 0U; j < perThread; j++) {
+            Trace_Record(TRACE_RECORD_RUNNABLE_ENTRY, TRACE_RUNNABLE_HEADLIGHT, 0U, 0U);
+            Trace_Record(TRACE_RECORD_RUNNABLE_EXIT, TRACE_RUNNABLE_HEADLIGHT, 0U, 0U);
+        }
+    });
+    for (i = 0U; i < perThread; i++) {
+        Trace_Record(TRACE_RECORD_RUNNABLE_ENTRY, TRACE_RUNNABLE_FLM, 0U, 0U);
+        Trace_Record(TRACE_RECORD_RUNNABLE_EXIT, TRACE_RUNNABLE_FLM, 0U, 0U);
+    }
+    worker.join();
+    Trace_Stop();
+
+    EXPECT_EQ(GetStatistics().Threads, 2U);
+    EXPECT_EQ(GetStatistics().Records, 4U * perThread);
+    EXPECT_EQ(GetStatistics().Dropped, 0U);
+
+    const std::string trace = ReadTrace();
+    EXPECT_NE(trace.find("\"args\":{\"name\":\"Worker\"}"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Headlight_MainFunction\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"FLM_MainFunction\""), std::string::npos);
+}
+
+TEST_F(TraceTest, Record_FullRingDropsWithoutBlocking) {
+    const uint32_t written = 8U * TRACE_RING_SIZE;
+    uint32_t i;
+
+    ASSERT_EQ(Trace_Start(path.c_str()), E_OK);
+    for (i = 0U; i < written; i++) {
+        Trace_Record(TRACE_RECORD_DEM_EVENT, 1U, DEM_EVENT_STATUS_FAILED, 0U);
+    }
+    Trace_Stop();
+
+    /* The drainer wakes every 10ms, far slower than the producer */
+    EXPECT_GT(GetStatistics().Dropped, 0U);
+    EXPECT_EQ(GetStatistics().Records + GetStatistics().Dropped, written);
+}
+
+/*============================================================================*
+ * EXPORT TESTS
+ *============================================================================*/
+
+TEST_F(TraceTest, Stop_WritesChromeTraceEvents) {
+    ASSERT_EQ(Trace_Start(path.c_str()), E_OK);
+    Trace_SimSetTimeNs(1000000U);
+    Trace_Record(TRACE_RECORD_RUNNABLE_ENTRY, TRACE_RUNNABLE_SWITCHEVENT, 0U, 0U);
+    Trace_Record(TRACE_RECORD_E2E_STATUS, 0U, E2E_P01STATUS_WRONGCRC, E2E_SM_INVALID);
+    Trace_SimSetTimeNs(1250500U);
+    Trace_Record(TRACE_RECORD_RUNNABLE_EXIT, TRACE_RUNNABLE_SWITCHEVENT, 0U, 0U);
+    Trace_Record(TRACE_RECORD_FLM_STATE, 0U, FLM_STATE_NORMAL, FLM_STATE_SAFE);
+    Trace_Record(TRACE_RECORD_SAFE_STATE, 0U, SAFE_STATE_REASON_WDGM_FAILURE, 0U);
+    Trace_Record(TRACE_RECORD_DEM_EVENT, 8U, DEM_EVENT_STATUS_PREFAILED, 0U);
+    Trace_Stop();
+
+    const std::string trace = ReadTrace();
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0U), 0U);
+    EXPECT_EQ(trace.substr(trace.size() - 27U), "\n],\"displayTimeUnit\":\"ms\"}\n");
+    EXPECT_NE(trace.find("\"name\":\"SwitchEvent_MainFunction\",\"cat\":\"runnable\","
+                         "\"ph\":\"B\",\"ts\":1000.000"), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"E\",\"ts\":1250.500"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"status\":\"WRONGCRC\",\"sm\":\"INVALID\"}"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"from\":\"NORMAL\",\"to\":\"SAFE\"}"), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"C\",\"ts\":1250.500,\"pid\":1,\"args\":{\"state\":3}"),
+              std::string::npos);
+    EXPECT_NE(trace.find("\"s\":\"g\""), std::string::npos);
+    EXPECT_NE(trace.find("\"reason\":\"WDGM_FAILURE\""), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"event\":8,\"status\":\"PREFAILED\"}"), std::string::npos);
+    EXPECT_EQ(GetStatistics().Records, 6U);
+}
+
+TEST_F(TraceTest, SafeStateEscalation_AppearsInTimeline) {
+#if (TRACE_ENABLED == STD_ON)
+    static const Adc_ConfigType adcConfig = { 0U, NULL_PTR, 0U, NULL_PTR };
+    int i;
+
+    Adc_Init(&adcConfig);
+    Dio_Init();
+    Cal_Init(&Cal_Config);
+    SwitchEvent_Init();
+    LightRequest_Init();
+    FLM_Init();
+    Headlight_Init();
+    SafetyMonitor_Init();
+
+    ASSERT_EQ(Trace_Start(path.c_str()), E_OK);
+    FLM_MainFunction();
+    SafetyMonitor_TriggerSafeState(SAFE_STATE_REASON_E2E_FAILURE);
+    for (i = 0; i < 3; i++) {
+        SafetyMonitor_MainFunction();
+        FLM_MainFunction();
+    }
+    Trace_Stop();
+
+    Cal_DeInit();
+    Adc_DeInit();
+
+    const std::string trace = ReadTrace();
+    const size_t safeState = trace.find("\"reason\":\"E2E_FAILURE\"");
+    const size_t flmSafe = trace.find("\"to\":\"SAFE\"");
+    ASSERT_NE(safeState, std::string::npos);
+    ASSERT_NE(flmSafe, std::string::npos);
+    /* One thread: records are exported in order */
+    EXPECT_LT(safeState, flmSafe);
+    EXPECT_NE(trace.find("\"name\":\"SafetyMonitor_MainFunction\""), std::string::npos);
+#else
+    GTEST_SKIP() << "Trace points compiled out";
+#endif
+}
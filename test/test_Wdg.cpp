@@ -0,0 +1,254 @@
+/**
+ * @file test_Wdg.cpp
+ * @brief Unit Tests for Watchdog Driver
+ * @details Tests trigger window, timeout, reset request and WdgM/BswM
+ *          integration of the software watchdog backend
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include "MCAL/Wdg/Wdg.h"
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/BswM/BswM.h"
+
+/** @brief Reset reason captured by the test reset callback */
+static std::atomic<uint8_t> Test_ResetReason(WDG_RESET_NONE);
+static std::atomic<uint32_t> Test_ResetCount(0U);
+
+static void Test_ResetCallback(Wdg_ResetReasonType reason) {
+    Test_ResetReason = static_cast<uint8_t>(reason);
+    Test_ResetCount++;
+}
+
+/**
+ * @brief Wdg Test Fixture
+ */
+class WdgTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Test_ResetReason = WDG_RESET_NONE;
+        Test_ResetCount = 0U;
+
+        config.Backend = WDG_BACKEND_SOFTWARE;
+        config.TimeoutMs = 30U;
+        config.WindowMs = 2U;
+        config.DevicePath = NULL_PTR;
+        config.ResetStampPath = NULL_PTR;
+        config.ResetCallback = Test_ResetCallback;
+    }
+
+    void TearDown() override {
+        Wdg_DeInit();
+    }
+
+    static void SleepMs(uint32_t ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+
+    /** @brief Wait until the watchdog fired or the limit elapsed */
+    static void WaitForReset(uint32_t limitMs) {
+        uint32_t waited = 0U;
+        while ((Test_ResetCount == 0U) && (waited < limitMs)) {
+            SleepMs(1U);
+            waited++;
+        }
+    }
+
+    Wdg_ConfigType config;
+};
+
+/**
+ * @test API rejects mode change before initialization
+ */
+TEST_F(WdgTest, NotInitialized) {
+    EXPECT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_NOT_OK);
+    Wdg_SetTriggerCondition(0U);
+    EXPECT_EQ(Test_ResetCount, 0U);
+}
+
+/**
+ * @test Regular triggering inside the window keeps the watchdog quiet
+ */
+TEST_F(WdgTest, RegularTrigger_NoReset) {
+    uint32_t i;
+
+    /* Timeout far above the trigger period: parallel test runs delay the sleeps */
+    config.TimeoutMs = 500U;
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+
+    for (i = 0U; i < 30U; i++) {
+        SleepMs(5U);
+        Wdg_SetTriggerCondition(500U);
+    }
+
+    EXPECT_EQ(Test_ResetCount, 0U);
+    EXPECT_EQ(Wdg_GetResetReason(), WDG_RESET_NONE);
+}
+
+/**
+ * @test Missing trigger fires the watchdog after the timeout
+ */
+TEST_F(WdgTest, MissedTrigger_Timeout) {
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+    Wdg_SetTriggerCondition(30U);
+
+    WaitForReset(1000U);
+
+    EXPECT_EQ(Test_ResetCount, 1U);
+    EXPECT_EQ(Wdg_GetResetReason(), WDG_RESET_TIMEOUT);
+}
+
+/**
+ * @test Trigger before the window opened is a window violation
+ */
+TEST_F(WdgTest, EarlyTrigger_WindowViolation) {
+    config.WindowMs = 20U;
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+
+    Wdg_SetTriggerCondition(100U);
+    Wdg_SetTriggerCondition(100U);
+
+    EXPECT_EQ(Test_ResetCount, 1U);
+    EXPECT_EQ(Wdg_GetResetReason(), WDG_RESET_WINDOW_VIOLATION);
+}
+
+/**
+ * @test Trigger condition 0 requests an immediate reset, only once
+ */
+TEST_F(WdgTest, TimeoutZero_ResetRequested) {
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+
+    Wdg_SetTriggerCondition(0U);
+    Wdg_SetTriggerCondition(0U);
+    SleepMs(50U);
+
+    EXPECT_EQ(Test_ResetCount, 1U);
+    EXPECT_EQ(Wdg_GetResetReason(), WDG_RESET_REQUESTED);
+}
+
+/**
+ * @test Disabled watchdog does not fire
+ */
+TEST_F(WdgTest, OffMode_NoReset) {
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_OFF_MODE), E_OK);
+
+    SleepMs(60U);
+
+    EXPECT_EQ(Test_ResetCount, 0U);
+    EXPECT_EQ(Wdg_GetMode(), WDGIF_OFF_MODE);
+}
+
+/**
+ * @test Missing watchdog device is reported when arming
+ */
+TEST_F(WdgTest, LinuxDevice_Unavailable) {
+    config.Backend = WDG_BACKEND_LINUX_DEVICE;
+    config.DevicePath = "/nonexistent/watchdog";
+    Wdg_Init(&config);
+
+    EXPECT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_NOT_OK);
+    EXPECT_EQ(Wdg_GetMode(), WDGIF_OFF_MODE);
+}
+
+/**
+ * @test Reset stamp is handed over to the next run
+ */
+TEST_F(WdgTest, ResetStamp_PreviousReset) {
+    Wdg_ResetInfoType info;
+    uint64_t before = Wdg_GetWallClockNs();
+
+    config.ResetStampPath = "test_wdg_reset.stamp";
+    (void)std::remove(config.ResetStampPath);
+
+    Wdg_Init(&config);
+    EXPECT_EQ(Wdg_GetPreviousReset(&info), E_NOT_OK);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+    Wdg_SetTriggerCondition(0U);
+
+    /* "Restart" */
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_GetPreviousReset(&info), E_OK);
+    EXPECT_EQ(info.Reason, WDG_RESET_REQUESTED);
+    EXPECT_GE(info.ResetTimeNs, before);
+    EXPECT_LE(info.ResetTimeNs, Wdg_GetWallClockNs());
+
+    /* Stamp is consumed */
+    Wdg_Init(&config);
+    EXPECT_EQ(Wdg_GetPreviousReset(&info), E_NOT_OK);
+}
+
+/**
+ * @test WdgM stops triggering after supervision expired
+ */
+TEST_F(WdgTest, WdgMExpired_WatchdogTimeout) {
+    static const WdgM_ConfigType wdgmConfig = {
+        WDGM_NUM_SUPERVISED_ENTITIES,
+        WDGM_SUPERVISION_CYCLE_MS,
+        WDGM_FAILED_REFERENCE_CYCLES
+    };
+    WdgM_GlobalStatusType status = WDGM_GLOBAL_STATUS_OK;
+    uint32_t i;
+
+    config.TimeoutMs = 50U;
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+    WdgM_Init(&wdgmConfig);
+
+    /* No checkpoints reported: alive supervision fails until EXPIRED */
+    for (i = 0U; (i < 200U) && (status != WDGM_GLOBAL_STATUS_EXPIRED); i++) {
+        SleepMs(3U);
+        WdgM_MainFunction();
+        (void)WdgM_GetGlobalStatus(&status);
+    }
+    ASSERT_EQ(status, WDGM_GLOBAL_STATUS_EXPIRED);
+    EXPECT_EQ(Test_ResetCount, 0U);
+
+    /* WdgM keeps running but no longer triggers */
+    for (i = 0U; (i < 100U) && (Test_ResetCount == 0U); i++) {
+        SleepMs(5U);
+        WdgM_MainFunction();
+    }
+
+    EXPECT_EQ(Test_ResetCount, 1U);
+    EXPECT_EQ(Wdg_GetResetReason(), WDG_RESET_TIMEOUT);
+
+    WdgM_DeInit();
+}
+
+/**
+ * @test BswM reset request is performed through WdgM and the watchdog
+ */
+TEST_F(WdgTest, BswMRequestReset_Immediate) {
+    static const WdgM_ConfigType wdgmConfig = {
+        WDGM_NUM_SUPERVISED_ENTITIES,
+        WDGM_SUPERVISION_CYCLE_MS,
+        WDGM_FAILED_REFERENCE_CYCLES
+    };
+    static const BswM_ConfigType bswmConfig = { 5U };
+
+    Wdg_Init(&config);
+    ASSERT_EQ(Wdg_SetMode(WDGIF_FAST_MODE), E_OK);
+    WdgM_Init(&wdgmConfig);
+    BswM_Init(&bswmConfig);
+
+    BswM_RequestReset();
+    EXPECT_EQ(Test_ResetCount, 0U);
+
+    BswM_MainFunction();
+    EXPECT_EQ(Test_ResetCount, 1U);
+    EXPECT_EQ(Wdg_GetResetReason(), WDG_RESET_REQUESTED);
+
+    BswM_Deinit();
+    WdgM_DeInit();
+}
@@ -0,0 +1,331 @@
+/**
+ * @file test_WdgM.cpp
+ * @brief Unit Tests for Watchdog Manager
+ * @details Tests table-driven alive, deadline and logical supervision
+ * @version 1.0.0
+ * @date 2024
+ */
+
+#include <gtest/gtest.h>
+#include "BSW/WdgM/WdgM.h"
+#include "BSW/WdgM/WdgM_Profiler.h"
+#include "WdgM_Cfg.h"
+
+/**
+ * @brief WdgM Test Fixture
+ */
+class WdgMTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        static const WdgM_ConfigType config = {
+            WDGM_NUM_SUPERVISED_ENTITIES,
+            WDGM_SUPERVISION_CYCLE_MS,
+            WDGM_FAILED_REFERENCE_CYCLES
+        };
+        WdgM_Init(&config);
+        WdgM_SimSetTimeUs(0U);
+        tick = 0U;
+    }
+
+    void TearDown() override {
+        WdgM_DeInit();
+    }
+
+    /** @brief Report a complete, valid program flow for one entity */
+    void ReportFlow(WdgM_SupervisedEntityIdType seId) {
+        switch (seId) {
+            case WDGM_SE_FLM:
+                EXPECT_EQ(WdgM_CheckpointReached(seId, WDGM_CP_FLM_ENTRY), E_OK);
+                EXPECT_EQ(WdgM_CheckpointReached(seId, WDGM_CP_FLM_STATEMACHINE), E_OK);
+                EXPECT_EQ(WdgM_CheckpointReached(seId, WDGM_CP_FLM_EXIT), E_OK);
+                break;
+            case WDGM_SE_SAFETYMONITOR:
+                EXPECT_EQ(WdgM_CheckpointReached(seId, WDGM_CP_SAFETYMONITOR_ENTRY), E_OK);
+                EXPECT_EQ(WdgM_CheckpointReached(seId, WDGM_CP_SAFETYMONITOR_AGGREGATION), E_OK);
+                EXPECT_EQ(WdgM_CheckpointReached(seId, WDGM_CP_SAFETYMONITOR_EXIT), E_OK);
+                break;
+            default:
+                /* ENTRY = 1, EXIT = 2 for the remaining entities */
+                EXPECT_EQ(WdgM_CheckpointReached(seId, 0x0001U), E_OK);
+                EXPECT_EQ(WdgM_CheckpointReached(seId, 0x0002U), E_OK);
+                break;
+        }
+    }
+
+    /**
+     * @brief Run one 5ms tick with the nominal task schedule
+     * @param skipSeId Entity that misses its activation (0 = none)
+     */
+    void RunTick(WdgM_SupervisedEntityIdType skipSeId = 0U) {
+        if (skipSeId != WDGM_SE_SAFETYMONITOR) {
+            ReportFlow(WDGM_SE_SAFETYMONITOR);
+        }
+        if ((tick % 2U) == 0U) {
+            if (skipSeId != WDGM_SE_SWITCHEVENT) { ReportFlow(WDGM_SE_SWITCHEVENT); }
+            if (skipSeId != WDGM_SE_FLM) { ReportFlow(WDGM_SE_FLM); }
+            if (skipSeId != WDGM_SE_HEADLIGHT) { ReportFlow(WDGM_SE_HEADLIGHT); }
+        }
+        if (((tick % 4U) == 0U) && (skipSeId != WDGM_SE_LIGHTREQUEST)) {
+            ReportFlow(WDGM_SE_LIGHTREQUEST);
+        }
+        WdgM_MainFunction();
+        tick++;
+    }
+
+    /** @brief Run one supervision cycle (100ms) */
+    void RunCycle(WdgM_SupervisedEntityIdType skipSeId = 0U) {
+        uint32_t i;
+        for (i = 0U; i < (WDGM_SUPERVISION_CYCLE_MS / WDGM_MAIN_FUNCTION_PERIOD_MS); i++) {
+            RunTick(skipSeId);
+        }
+    }
+
+    WdgM_LocalStatusType LocalStatus(WdgM_SupervisedEntityIdType seId) {
+        WdgM_LocalStatusType status = WDGM_LOCAL_STATUS_DEACTIVATED;
+        EXPECT_EQ(WdgM_GetLocalStatus(seId, &status), E_OK);
+        return status;
+    }
+
+    WdgM_GlobalStatusType GlobalStatus(void) {
+        WdgM_GlobalStatusType status = WDGM_GLOBAL_STATUS_DEACTIVATED;
+        EXPECT_EQ(WdgM_GetGlobalStatus(&status), E_OK);
+        return status;
+    }
+
+    uint32_t tick;
+};
+
+/**
+ * @test Nominal schedule keeps all entities OK
+ */
+TEST_F(WdgMTest, NominalSchedule_AllOk) {
+    for (int i = 0; i < 5; i++) {
+        RunCycle();
+    }
+
+    EXPECT_EQ(GlobalStatus(), WDGM_GLOBAL_STATUS_OK);
+    EXPECT_EQ(LocalStatus(WDGM_SE_LIGHTREQUEST), WDGM_LOCAL_STATUS_OK);
+    EXPECT_EQ(LocalStatus(WDGM_SE_SAFETYMONITOR), WDGM_LOCAL_STATUS_OK);
+}
+
+/**
+ * @test Missing alive indications fail and then expire the entity
+ */
+TEST_F(WdgMTest, AliveMiss_FailsThenExpires) {
+    RunCycle(WDGM_SE_HEADLIGHT);
+    EXPECT_EQ(LocalStatus(WDGM_SE_HEADLIGHT), WDGM_LOCAL_STATUS_FAILED);
+    EXPECT_EQ(LocalStatus(WDGM_SE_FLM), WDGM_LOCAL_STATUS_OK);
+    EXPECT_EQ(GlobalStatus(), WDGM_GLOBAL_STATUS_FAILED);
+
+    for (uint32_t i = 1U; i < WDGM_FAILED_REFERENCE_CYCLES; i++) {
+        RunCycle(WDGM_SE_HEADLIGHT);
+    }
+    EXPECT_EQ(LocalStatus(WDGM_SE_HEADLIGHT), WDGM_LOCAL_STATUS_EXPIRED);
+    EXPECT_EQ(GlobalStatus(), WDGM_GLOBAL_STATUS_EXPIRED);
+}
+
+/**
+ * @test A single failed cycle recovers when indications return
+ */
+TEST_F(WdgMTest, AliveMiss_RecoversBeforeExpiry) {
+    RunCycle(WDGM_SE_SWITCHEVENT);
+    EXPECT_EQ(LocalStatus(WDGM_SE_SWITCHEVENT), WDGM_LOCAL_STATUS_FAILED);
+
+    RunCycle();
+    EXPECT_EQ(LocalStatus(WDGM_SE_SWITCHEVENT), WDGM_LOCAL_STATUS_OK);
+    EXPECT_EQ(GlobalStatus(), WDGM_GLOBAL_STATUS_OK);
+}
+
+/**
+ * @test Expired status is kept until re-initialization
+ */
+TEST_F(WdgMTest, Expired_IsPersistent) {
+    for (uint32_t i = 0U; i < WDGM_FAILED_REFERENCE_CYCLES; i++) {
+        RunCycle(WDGM_SE_LIGHTREQUEST);
+    }
+    ASSERT_EQ(LocalStatus(WDGM_SE_LIGHTREQUEST), WDGM_LOCAL_STATUS_EXPIRED);
+
+    RunCycle();
+    EXPECT_EQ(LocalStatus(WDGM_SE_LIGHTREQUEST), WDGM_LOCAL_STATUS_EXPIRED);
+}
+
+/**
+ * @test Only the configured alive checkpoint counts as alive indication
+ */
+TEST_F(WdgMTest, Alive_CountsEntryCheckpointOnly) {
+    /* Each FLM flow reports three checkpoints but one alive indication */
+    RunCycle();
+    EXPECT_EQ(LocalStatus(WDGM_SE_FLM), WDGM_LOCAL_STATUS_OK);
+
+    /* Twice the expected number of flows is outside the max margin */
+    for (uint32_t i = 0U; i < (WDGM_SUPERVISION_CYCLE_MS / WDGM_MAIN_FUNCTION_PERIOD_MS); i++) {
+        ReportFlow(WDGM_SE_FLM);
+        WdgM_MainFunction();
+    }
+    EXPECT_EQ(LocalStatus(WDGM_SE_FLM), WDGM_LOCAL_STATUS_FAILED);
+}
+
+/**
+ * @test Skipping an intermediate checkpoint violates logical supervision
+ */
+TEST_F(WdgMTest, Logical_SkippedCheckpoint_Fails) {
+    uint32_t i;
+
+    for (i = 0U; i < (WDGM_SUPERVISION_CYCLE_MS / WDGM_MAIN_FUNCTION_PERIOD_MS); i++) {
+        if (i == 4U) {
+            /* FLM: ENTRY -> EXIT without STATEMACHINE */
+            (void)WdgM_CheckpointReached(WDGM_SE_FLM, WDGM_CP_FLM_ENTRY);
+            (void)WdgM_CheckpointReached(WDGM_SE_FLM, WDGM_CP_FLM_EXIT);
+            ReportFlow(WDGM_SE_SAFETYMONITOR);
+            WdgM_MainFunction();
+            tick++;
+        } else {
+            RunTick();
+        }
+    }
+
+    EXPECT_EQ(LocalStatus(WDGM_SE_FLM), WDGM_LOCAL_STATUS_FAILED);
+    EXPECT_EQ(LocalStatus(WDGM_SE_HEADLIGHT), WDGM_LOCAL_STATUS_OK);
+}
+
+/**
+ * @test Graph must be entered through its initial checkpoint
+ */
+TEST_F(WdgMTest, Logical_StartWithoutEntry_Fails) {
+    EXPECT_EQ(WdgM_CheckpointReached(WDGM_SE_SAFETYMONITOR,
+                                     WDGM_CP_SAFETYMONITOR_AGGREGATION), E_OK);
+    RunCycle();
+
+    EXPECT_EQ(LocalStatus(WDGM_SE_SAFETYMONITOR), WDGM_LOCAL_STATUS_FAILED);
+}
+
+/**
+ * @test Unknown checkpoint IDs are rejected
+ */
+TEST_F(WdgMTest, UnknownCheckpoint_Rejected) {
+    EXPECT_EQ(WdgM_CheckpointReached(WDGM_SE_SWITCHEVENT, 0x0000U), E_NOT_OK);
+    EXPECT_EQ(WdgM_CheckpointReached(WDGM_SE_SWITCHEVENT, 0x0003U), E_NOT_OK);
+    EXPECT_EQ(WdgM_CheckpointReached(WDGM_SE_FLM, 0x0004U), E_NOT_OK);
+    EXPECT_EQ(WdgM_CheckpointReached(0x0009U, 0x0001U), E_NOT_OK);
+}
+
+/**
+ * @test Execution time above the maximum deadline is detected
+ */
+TEST_F(WdgMTest, Deadline_Exceeded_Fails) {
+    uint32_t i;
+
+    for (i = 0U; i < (WDGM_SUPERVISION_CYCLE_MS / WDGM_MAIN_FUNCTION_PERIOD_MS); i++) {
+        if (i == 2U) {
+            WdgM_SimSetTimeUs(1000U);
+            (void)WdgM_CheckpointReached(WDGM_SE_HEADLIGHT, WDGM_CP_HEADLIGHT_ENTRY);
+            WdgM_SimSetTimeUs(1000U + WDGM_HEADLIGHT_DEADLINE_MAX_US + 1U);
+            (void)WdgM_CheckpointReached(WDGM_SE_HEADLIGHT, WDGM_CP_HEADLIGHT_EXIT);
+            ReportFlow(WDGM_SE_SAFETYMONITOR);
+            ReportFlow(WDGM_SE_SWITCHEVENT);
+            ReportFlow(WDGM_SE_FLM);
+            WdgM_MainFunction();
+            tick++;
+        } else {
+            RunTick();
+        }
+    }
+
+    EXPECT_EQ(LocalStatus(WDGM_SE_HEADLIGHT), WDGM_LOCAL_STATUS_FAILED);
+    EXPECT_EQ(LocalStatus(WDGM_SE_FLM), WDGM_LOCAL_STATUS_OK);
+}
+
+/**
+ * @test Execution time at the maximum deadline is accepted
+ */
+TEST_F(WdgMTest, Deadline_AtLimit_Ok) {
+    WdgM_SimSetTimeUs(5000U);
+    (void)WdgM_CheckpointReached(WDGM_SE_SAFETYMONITOR, WDGM_CP_SAFETYMONITOR_ENTRY);
+    (void)WdgM_CheckpointReached(WDGM_SE_SAFETYMONITOR, WDGM_CP_SAFETYMONITOR_AGGREGATION);
+    WdgM_SimSetTimeUs(5000U + WDGM_SAFETYMONITOR_DEADLINE_MAX_US);
+    (void)WdgM_CheckpointReached(WDGM_SE_SAFETYMONITOR, WDGM_CP_SAFETYMONITOR_EXIT);
+    tick = 1U;  /* SafetyMonitor flow of tick 0 already reported */
+
+    for (uint32_t i = 1U; i < (WDGM_SUPERVISION_CYCLE_MS / WDGM_MAIN_FUNCTION_PERIOD_MS); i++) {
+        RunTick();
+    }
+    WdgM_MainFunction();
+
+    EXPECT_EQ(LocalStatus(WDGM_SE_SAFETYMONITOR), WDGM_LOCAL_STATUS_OK);
+}
+
+/**
+ * @test API rejects calls before initialization
+ */
+TEST_F(WdgMTest, NotInitialized_Rejected) {
+    WdgM_GlobalStatusType status;
+
+    WdgM_DeInit();
+
+    EXPECT_EQ(WdgM_CheckpointReached(WDGM_SE_FLM, WDGM_CP_FLM_ENTRY), E_NOT_OK);
+    EXPECT_EQ(WdgM_GetGlobalStatus(&status), E_NOT_OK);
+    EXPECT_EQ(status, WDGM_GLOBAL_STATUS_DEACTIVATED);
+}
+
+/**
+ * @test Profiler records execution time between entry and exit checkpoint
+ */
+TEST_F(WdgMTest, Profiler_ExecutionTime) {
+    WdgM_ProfilerStatisticsType stats;
+    uint64_t timeNs = 0U;
+
+    for (uint32_t i = 0U; i < 100U; i++) {
+        WdgM_Profiler_SimSetTimeNs(timeNs);
+        (void)WdgM_CheckpointReached(WDGM_SE_FLM, WDGM_CP_FLM_ENTRY);
+        (void)WdgM_CheckpointReached(WDGM_SE_FLM, WDGM_CP_FLM_STATEMACHINE);
+        /* 99 runs of 1000ns, one run of 4000ns */
+        WdgM_Profiler_SimSetTimeNs(timeNs + ((i == 50U) ? 4000U : 1000U));
+        (void)WdgM_CheckpointReached(WDGM_SE_FLM, WDGM_CP_FLM_EXIT);
+        timeNs += 10000000U;
+    }
+
+    ASSERT_EQ(WdgM_Profiler_GetStatistics(WDGM_SE_FLM, &stats), E_OK);
+    EXPECT_EQ(stats.executionTime.count, 100U);
+    EXPECT_EQ(stats.executionTime.minNs, 1000U);
+    EXPECT_EQ(stats.executionTime.maxNs, 4000U);
+    EXPECT_EQ(stats.executionTime.meanNs, 1030U);
+    /* HDR bucket bound: within 1/16 above the recorded value */
+    EXPECT_GE(stats.executionTime.p50Ns, 1000U);
+    EXPECT_LE(stats.executionTime.p50Ns, 1000U + (1000U / 16U));
+    EXPECT_EQ(stats.executionTime.p999Ns, 4000U);
+    EXPECT_EQ(stats.budgetNs, WDGM_FLM_DEADLINE_MAX_US * 1000U);
+    EXPECT_EQ(stats.headroomNs, static_cast<int64_t>(WDGM_FLM_DEADLINE_MAX_US * 1000U) - 4000);
+}
+
+/**
+ * @test Profiler records activation jitter against the nominal period
+ */
+TEST_F(WdgMTest, Profiler_ActivationJitter) {
+    WdgM_ProfilerStatisticsType stats;
+
+    /* LightRequest: 20ms period, activations at 0, 20.5ms, 40ms */
+    WdgM_Profiler_SimSetTimeNs(0U);
+    ReportFlow(WDGM_SE_LIGHTREQUEST);
+    WdgM_Profiler_SimSetTimeNs(20500000U);
+    ReportFlow(WDGM_SE_LIGHTREQUEST);
+    WdgM_Profiler_SimSetTimeNs(40000000U);
+    ReportFlow(WDGM_SE_LIGHTREQUEST);
+
+    ASSERT_EQ(WdgM_Profiler_GetStatistics(WDGM_SE_LIGHTREQUEST, &stats), E_OK);
+    EXPECT_EQ(stats.periodNs, 20000000U);
+    EXPECT_EQ(stats.activationJitter.count, 2U);
+    EXPECT_EQ(stats.activationJitter.maxNs, 500000U);
+    EXPECT_EQ(stats.executionTime.count, 3U);
+}
+
+/**
+ * @test Percentiles of an empty or unknown histogram
+ */
+TEST_F(WdgMTest, Profiler_EmptyAndUnknown) {
+    WdgM_ProfilerStatisticsType stats;
+
+    EXPECT_EQ(WdgM_Profiler_GetPercentile(
+        WdgM_Profiler_GetExecutionHistogram(WDGM_SE_HEADLIGHT), 990U), 0U);
+    EXPECT_EQ(WdgM_Profiler_GetExecutionHistogram(0x0008U), nullptr);
+    EXPECT_EQ(WdgM_Profiler_GetStatistics(0x0000U, &stats), E_NOT_OK);
+}